@@ -11,6 +11,8 @@ import argparse
 import serial
 import threading
 import time
+import re
+import collections
 
 # Define command line argument interface
 parser = argparse.ArgumentParser(description='Stream g-code file to Smoothie over telnet.')
@@ -20,6 +22,8 @@ parser.add_argument('device',
         help='Smoothie Serial Device')
 parser.add_argument('-q','--quiet',action='store_true', default=False,
         help='suppress output text')
+parser.add_argument('-w','--window',action='store_true', default=False,
+        help='use streaming mode (M810), keep just the receive buffer full and have the oks sent a few at a time')
 args = parser.parse_args()
 
 f = args.gcode_file
@@ -37,17 +41,48 @@ print("Streaming " + args.gcode_file.name + " to " + args.device)
 
 okcnt= 0
 
+# in streaming mode the lengths of the lines sent that have not been acknowledged, and the room there is for them
+rxsize= 0
+inflight= collections.deque()
+inflight_bytes= 0
+window= threading.Condition()
+
+if args.window:
+    s.write("M810 S1\n")
+    while True:
+        rep= s.readline()
+        m= re.match(r"ok R(\d+)", rep)
+        if m:
+            rxsize= int(m.group(1))
+            break
+    if rxsize == 0:
+        print("The receive buffer size is not known, streaming without a window")
+    elif verbose:
+        print("Receive buffer is " + str(rxsize) + " bytes")
+
+def acknowledged(n):
+    """n more lines have been handled, their room in the receive buffer is free again"""
+    global okcnt, inflight_bytes
+    with window:
+        okcnt += n
+        for i in range(min(n, len(inflight))):
+            inflight_bytes -= inflight.popleft()
+        window.notify()
+
 def read_thread():
     """thread worker function"""
-    global okcnt
     flag= 1
     while flag :
         rep= s.readline()
+        m= re.match(r"ok N(\d+)", rep)
+        if m:
+            acknowledged(int(m.group(1)))
+            continue
         n= rep.count("ok")
         if n == 0 :
             print("Incoming: " + rep)
         else :
-            okcnt += n
+            acknowledged(n)
 
     print("Read thread exited")
     return
@@ -63,6 +98,13 @@ for line in f:
     if line.startswith(';') :
         continue
     l= line.strip()
+    if rxsize > 0:
+        # wait until the line fits in what is left of the receive buffer
+        with window:
+            while inflight_bytes + len(l) + 1 > rxsize and inflight:
+                window.wait(1)
+            inflight.append(len(l) + 1)
+            inflight_bytes += len(l) + 1
     s.write(l + '\n')
     linecnt+=1
     if verbose: print("SND " + str(linecnt) + ": " + line.strip() + " - " + str(okcnt))
@@ -0,0 +1,164 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "BinaryGcodeEncoder.h"
+
+#include "modules/communication/utils/BinaryGcode.h"
+
+#include <ctype.h>
+#include <stdlib.h>
+#include <string.h>
+
+// M codes GcodeDispatch handles itself from the text of the line
+static const int text_mcodes[]= {28, 29, 30, 117, 500, 501, 502, 503, 504, 1000};
+
+static void put16(std::string &s, uint16_t v)
+{
+    s += (char)(v & 0xFF);
+    s += (char)(v >> 8);
+}
+
+std::string BinaryGcodeEncoder::record(const std::string &line, bool allow_fixed)
+{
+    std::string l= line.substr(0, line.find_first_of(";("));
+    const char *p= l.c_str();
+    while(*p == ' ' || *p == '\t') ++p;
+
+    char cmd= *p++;
+    if((cmd != 'G' && cmd != 'M') || !isdigit(*p)) return "";
+    unsigned long code= strtoul(p, (char **)&p, 10), subcode= 0;
+    if(*p == '.') {
+        if(!isdigit(p[1])) return "";
+        subcode= strtoul(p + 1, (char **)&p, 10);
+    }
+    if(code >= 1 << 13 || subcode > 7) return "";
+    if(cmd == 'M') {
+        for (int m : text_mcodes) {
+            if(m == (int)code) return "";
+        }
+    }
+
+    float values[16];
+    int32_t fixed[16];
+    uint16_t mask= 0;
+    bool all_fixed= allow_fixed;
+    for (;;) {
+        while(*p == ' ' || *p == '\t') ++p;
+        if(*p == '\0') break;
+
+        const char *lp= strchr(BinaryGcode::letter_order, *p);
+        if(lp == nullptr) return "";
+        int i= lp - BinaryGcode::letter_order;
+        if(mask & (1 << i)) return ""; // the firmware takes the first, keep it simple and send it as text
+        ++p;
+
+        // only plain decimals, so the value is exactly what strtof would make of the text
+        const char *start= p;
+        bool negative= *p == '-';
+        if(*p == '-' || *p == '+') ++p;
+        int64_t f= 0;
+        int digits= 0, decimals= -1;
+        for (; isdigit(*p) || (*p == '.' && decimals < 0); ++p) {
+            if(*p == '.') { decimals= 0; continue; }
+            if(f < 100000000000LL) f= f * 10 + (*p - '0');
+            ++digits;
+            if(decimals >= 0) ++decimals;
+        }
+        if(digits == 0) return "";
+
+        values[i]= strtof(std::string(start, p).c_str(), nullptr);
+        if(decimals < 0) decimals= 0;
+        for (; decimals < 3; ++decimals) f *= 10;
+        if(decimals > 3 || f > 0x7FFFFF) all_fixed= false;
+        fixed[i]= negative ? -f : f;
+        mask |= 1 << i;
+    }
+    if(__builtin_popcount(mask) > BinaryGcode::max_values) return "";
+
+    std::string r;
+    if(cmd == 'G') r += (char)(all_fixed ? BinaryGcode::G_FIXED : BinaryGcode::G_FLOAT);
+    else r += (char)(all_fixed ? BinaryGcode::M_FIXED : BinaryGcode::M_FLOAT);
+    put16(r, code | subcode << 13);
+    put16(r, mask);
+    for (int i = 0; i < 16; ++i) {
+        if(!(mask & (1 << i))) continue;
+        if(all_fixed) {
+            uint32_t u= fixed[i];
+            r += (char)(u & 0xFF);
+            r += (char)((u >> 8) & 0xFF);
+            r += (char)((u >> 16) & 0xFF);
+        } else {
+            uint32_t u;
+            memcpy(&u, &values[i], sizeof(u));
+            put16(r, u & 0xFFFF);
+            put16(r, u >> 16);
+        }
+    }
+    return r;
+}
+
+std::string BinaryGcodeEncoder::frame(const std::string &records)
+{
+    std::string body;
+    body += (char)(records.size() + (synced ? 3 : 4));
+    body += (char)sequence++;
+    if(!synced) body += (char)BinaryGcode::SYNC;
+    synced= true;
+    body += records;
+
+    std::string f(1, (char)BinaryGcode::frame_start);
+    f += body;
+    put16(f, BinaryGcode::crc16((const uint8_t *)body.data(), body.size()));
+    return f;
+}
+
+void BinaryGcodeEncoder::add_line(const std::string &line, std::string &out)
+{
+    std::string r= record(line, allow_fixed);
+    if(r.empty()) {
+        flush(out);
+        out += line;
+        out += '\n';
+        return;
+    }
+
+    // len counts seq, the SYNC record if there is one, the records and the crc
+    if(pending.size() + r.size() + (synced ? 3 : 4) > BinaryGcode::max_length) flush(out);
+    pending += r;
+}
+
+void BinaryGcodeEncoder::flush(std::string &out)
+{
+    if(pending.empty()) return;
+    out += frame(pending);
+    pending.clear();
+}
+
+std::vector<std::string> BinaryGcodeEncoder::split(const std::string &stream)
+{
+    std::vector<std::string> units;
+    size_t i= 0, n= stream.size();
+    while(i < n) {
+        if((uint8_t)stream[i] == BinaryGcode::frame_start) {
+            // as USBSerial, a bad length ends the frame after it
+            size_t len= i + 1 < n ? (uint8_t)stream[i + 1] : 0;
+            size_t take= 2 + ((len >= 3 && len <= BinaryGcode::max_length) ? len : 0);
+            if(take > n - i) take= n - i;
+            units.push_back(stream.substr(i, take));
+            i += take;
+            continue;
+        }
+
+        size_t e= stream.find('\n', i);
+        if(e == std::string::npos) e= n;
+        std::string l= stream.substr(i, e - i);
+        if(!l.empty() && l.back() == '\r') l.pop_back();
+        units.push_back(l);
+        i= e + 1;
+    }
+    return units;
+}
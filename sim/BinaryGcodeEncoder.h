@@ -0,0 +1,44 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+/*
+    The reference encoder for the binary Gcode frames described in BinaryGcode.h.
+
+    Lines that are a single G or M with numeric words become records, packed as many to a frame as fit. Anything else,
+    and the M codes GcodeDispatch handles from the text of the line, stays text and is written between the frames in
+    the order it came. A value goes as fixed point when every value of the record is an exact number of thousandths in
+    range, otherwise all of the record's values are floats. Either way the firmware gets the same float as parsing the
+    text would have given.
+*/
+class BinaryGcodeEncoder {
+    public:
+        BinaryGcodeEncoder(bool allow_fixed= true) : allow_fixed(allow_fixed), sequence(0), synced(false) {}
+
+        // the record for a line of G-code, empty if it has to be sent as text
+        static std::string record(const std::string &line, bool allow_fixed= true);
+        // a frame holding the records, with the next sequence number, the first one made starts with a SYNC record
+        std::string frame(const std::string &records);
+
+        // add a line to the stream being encoded, records are held back until a frame is full or a text line comes
+        void add_line(const std::string &line, std::string &out);
+        void flush(std::string &out);
+
+        // split a stream into the frames and text lines USBSerial would hand to GcodeDispatch, without the newlines
+        static std::vector<std::string> split(const std::string &stream);
+
+    private:
+        std::string pending;
+        bool allow_fixed;
+        uint8_t sequence;
+        bool synced;
+};
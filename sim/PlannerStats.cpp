@@ -0,0 +1,57 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "PlannerStats.h"
+#include "modules/robot/Planner.h"
+
+#include <string.h>
+#include <chrono>
+
+using sim_clock= std::chrono::steady_clock;
+
+PlannerStats planner_stats;
+
+static sim_clock::time_point append_start;
+static sim_clock::time_point recalculate_start;
+
+static uint64_t elapsed_ns(sim_clock::time_point start)
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(sim_clock::now() - start).count();
+}
+
+void planner_stats_reset()
+{
+    memset(&planner_stats, 0, sizeof(planner_stats));
+}
+
+void planner_stats_append_begin()
+{
+    append_start= sim_clock::now();
+}
+
+void planner_stats_append_end()
+{
+    uint64_t ns= elapsed_ns(append_start);
+    ++planner_stats.appends;
+    planner_stats.append_ns += ns;
+    if(ns > planner_stats.max_append_ns) planner_stats.max_append_ns= ns;
+}
+
+void planner_stats_recalculate_begin()
+{
+    recalculate_start= sim_clock::now();
+}
+
+void planner_stats_recalculate_end(uint32_t blocks_touched)
+{
+    uint64_t ns= elapsed_ns(recalculate_start);
+    ++planner_stats.recalculates;
+    planner_stats.recalculate_ns += ns;
+    if(ns > planner_stats.max_recalculate_ns) planner_stats.max_recalculate_ns= ns;
+    planner_stats.blocks_touched += blocks_touched;
+    if(blocks_touched > planner_stats.max_blocks_touched) planner_stats.max_blocks_touched= blocks_touched;
+}
@@ -0,0 +1,25 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <stdint.h>
+
+// Collected from the hooks the planner calls when built with PLANNER_STATS
+struct PlannerStats {
+    uint64_t appends;               // calls to Planner::append_block
+    uint64_t append_ns;             // host time spent in append_block, not counting the wait for room in the queue
+    uint64_t max_append_ns;
+    uint64_t recalculates;          // calls to Planner::recalculate
+    uint64_t recalculate_ns;
+    uint64_t max_recalculate_ns;
+    uint64_t blocks_touched;        // blocks whose trapezoid was recalculated
+    uint32_t max_blocks_touched;    // the most touched by a single recalculate
+};
+
+extern PlannerStats planner_stats;
+void planner_stats_reset();
@@ -0,0 +1,28 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <stdint.h>
+#include <string>
+
+// Glue between the host simulator driver, the simulated Kernel and the HAL stubs
+
+// config text the simulated Kernel loads, must be set before the Kernel is created
+void sim_set_config(const char *start, const char *end);
+
+// replaces or adds a setting given as setting=value in the config text, returns false if it is not in that form
+bool sim_override_setting(std::string &config, const char *setting);
+
+// runs the step ticker for the given number of ticks, this is the only way simulated time advances
+void sim_run_ticks(uint32_t n);
+
+// number of step ticker ticks run since start
+uint64_t sim_get_ticks();
+
+// host time spent in ON_IDLE handlers, which includes running the step ticker
+uint64_t sim_get_idle_ns();
@@ -0,0 +1,85 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// Host implementations of the few LPC17xx/mbed calls the motion pipeline makes, see stubs/ for the headers
+
+#include "libs/LPC17xx/sLPC17xx.h"
+#include "system_LPC17xx.h"
+#include "us_ticker_api.h"
+#include "wait_api.h"
+#include "port_api.h"
+#include "StepTicker.h"
+#include "SimpleShell.h"
+#include "Sim.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+
+uint32_t SystemCoreClock= 100000000;
+
+// backing store for the peripheral registers, laid out like the real memory map
+static uint8_t gpio_space[0x100];
+static uint8_t apb0_space[0x80000];
+static uint8_t apb1_space[0x80000];
+static uint8_t ahb_space[0x10000];
+
+void *sim_peripheral(uint32_t base)
+{
+    if(base >= LPC_AHB_BASE) return &ahb_space[base - LPC_AHB_BASE];
+    if(base >= LPC_APB1_BASE) return &apb1_space[base - LPC_APB1_BASE];
+    if(base >= LPC_APB0_BASE) return &apb0_space[base - LPC_APB0_BASE];
+    return &gpio_space[base - LPC_GPIO_BASE];
+}
+
+SCB_Type *sim_scb(void)
+{
+    static SCB_Type scb;
+    return &scb;
+}
+
+void sim_system_reset(void)
+{
+    fprintf(stderr, "system reset requested, exiting\n");
+    exit(1);
+}
+
+// the simulated clock is derived from the number of step ticks run
+uint32_t us_ticker_read(void)
+{
+    StepTicker *st= StepTicker::getInstance();
+    if(st == nullptr || st->get_frequency() <= 0) return 0;
+    return (uint32_t)(sim_get_ticks() * 1000000ULL / (uint64_t)st->get_frequency());
+}
+
+void wait_us(int us)
+{
+    StepTicker *st= StepTicker::getInstance();
+    if(st == nullptr || us <= 0) return;
+    sim_run_ticks(ceilf(us * st->get_frequency() / 1000000.0F));
+}
+
+void wait_ms(int ms)
+{
+    wait_us(ms * 1000);
+}
+
+void wait(float s)
+{
+    wait_us(s * 1000000.0F);
+}
+
+PinName port_pin(PortName port, int pin_n)
+{
+    return (PinName)(LPC_GPIO0_BASE + ((port << PORT_SHIFT) | pin_n));
+}
+
+// there is no shell in the simulator, $ commands are reported as unknown
+bool SimpleShell::parse_command(const char *cmd, string args, StreamOutput *stream)
+{
+    return false;
+}
@@ -0,0 +1,193 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+This is part of the host simulator, it replaces Kernel.cpp with a Kernel that only creates the motion pipeline
+(StepTicker, Conveyor, GcodeDispatch, Robot and Planner), the same way the test framework replaces it with a mockable one
+*/
+
+#include "libs/Kernel.h"
+#include "libs/Module.h"
+#include "libs/Config.h"
+#include "libs/StreamOutputPool.h"
+#include "checksumm.h"
+#include "ConfigValue.h"
+#include "FirmConfigSource.h"
+
+#include "libs/StepTicker.h"
+#include "modules/communication/GcodeDispatch.h"
+#include "modules/robot/Planner.h"
+#include "modules/robot/Robot.h"
+#include "modules/robot/Conveyor.h"
+
+#include "Sim.h"
+
+#include <chrono>
+#include <string>
+#include <string.h>
+
+#define base_stepping_frequency_checksum            CHECKSUM("base_stepping_frequency")
+#define microseconds_per_step_pulse_checksum        CHECKSUM("microseconds_per_step_pulse")
+#define max_steps_per_tick_checksum                 CHECKSUM("max_steps_per_tick")
+#define grbl_mode_checksum                          CHECKSUM("grbl_mode")
+#define ok_per_line_checksum                        CHECKSUM("ok_per_line")
+
+Kernel* Kernel::instance;
+
+static const char *config_start= nullptr;
+static const char *config_end= nullptr;
+static uint64_t idle_ns= 0;
+
+void sim_set_config(const char *start, const char *end)
+{
+    config_start= start;
+    config_end= end;
+}
+
+// replaces or adds a config setting given as key=value
+bool sim_override_setting(std::string &config, const char *setting)
+{
+    const char *eq= strchr(setting, '=');
+    if(eq == nullptr || eq == setting) return false;
+    std::string key(setting, eq - setting);
+
+    std::string out;
+    size_t pos= 0;
+    while(pos < config.size()) {
+        size_t eol= config.find('\n', pos);
+        if(eol == std::string::npos) eol= config.size() - 1;
+        std::string line= config.substr(pos, eol - pos + 1);
+        size_t ks= line.find_first_not_of(" \t");
+        bool match= ks != std::string::npos && line.compare(ks, key.size(), key) == 0 &&
+                    (ks + key.size() == line.size() || strchr(" \t\r\n", line[ks + key.size()]) != nullptr);
+        if(!match) out.append(line);
+        pos= eol + 1;
+    }
+    if(!out.empty() && out.back() != '\n') out.append("\n");
+    out.append(key).append(" ").append(eq + 1).append("\n");
+    config.swap(out);
+    return true;
+}
+
+uint64_t sim_get_idle_ns()
+{
+    return idle_ns;
+}
+
+// console output of the simulated firmware goes to stderr so it does not get mixed up with the step log
+class StderrStream : public StreamOutput {
+    public:
+        int puts(const char *str) { return fputs(str, stderr); }
+};
+
+Kernel::Kernel(){
+    halted= false;
+    feed_hold= false;
+
+    instance= this; // setup the Singleton instance of the kernel
+
+    this->serial= nullptr;
+    this->slow_ticker= nullptr;
+    this->adc= nullptr;
+    this->simpleshell= nullptr;
+    this->configurator= nullptr;
+
+    this->streams = new StreamOutputPool();
+    this->streams->append_stream(new StderrStream());
+
+    this->current_path   = "/";
+
+    this->config= new Config(new FirmConfigSource("sim", config_start, config_end));
+    this->config->config_cache_load();
+
+    this->use_leds= false;
+    this->grbl_mode= this->config->value( grbl_mode_checksum )->by_default(false)->as_bool();
+    this->ok_per_line= this->config->value( ok_per_line_checksum )->by_default(true)->as_bool();
+
+    this->step_ticker = new StepTicker();
+
+    // Configure the step ticker
+    this->base_stepping_frequency = this->config->value(base_stepping_frequency_checksum)->by_default(100000)->as_number();
+    float microseconds_per_step_pulse = this->config->value(microseconds_per_step_pulse_checksum)->by_default(1)->as_number();
+
+    this->step_ticker->set_frequency( this->base_stepping_frequency );
+    if(!this->step_ticker->set_unstep_time( microseconds_per_step_pulse )) {
+        this->streams->printf("WARNING: microseconds_per_step_pulse is longer than a tick at base_stepping_frequency\n");
+    }
+    if(!this->step_ticker->set_max_steps_per_tick( this->config->value(max_steps_per_tick_checksum)->by_default(1)->as_int() )) {
+        this->streams->printf("WARNING: max_steps_per_tick 2 needs three step pulses to fit in a tick at base_stepping_frequency, stepping once per tick\n");
+    }
+
+    // Core modules
+    this->add_module( this->conveyor       = new Conveyor()      );
+    this->add_module( this->gcode_dispatch = new GcodeDispatch() );
+    this->add_module( this->robot          = new Robot()         );
+
+    this->planner = new Planner();
+}
+
+// Add a module to Kernel. We don't actually hold a list of modules we just call its on_module_loaded
+void Kernel::add_module(Module* module){
+    module->on_module_loaded();
+}
+
+// Adds a hook for a given module and event
+void Kernel::register_for_event(_EVENT_ENUM id_event, Module *mod){
+    this->hooks[id_event].push_back(mod);
+    if(id_event == ON_GCODE_RECEIVED) this->gcode_hooks.add(mod);
+}
+
+// Call a specific event with an argument
+void Kernel::call_event(_EVENT_ENUM id_event, void * argument){
+    // time spent in ON_IDLE is kept apart so the driver can tell planning time from time spent waiting for the queue
+    std::chrono::steady_clock::time_point idle_start;
+    if(id_event == ON_IDLE) idle_start= std::chrono::steady_clock::now();
+
+    bool was_idle= true;
+    if(id_event == ON_HALT) {
+        this->halted= (argument == nullptr);
+        was_idle= conveyor->is_idle(); // see if we were doing anything like printing
+    }
+
+    // send to all registered modules
+    if(id_event == ON_GCODE_RECEIVED) {
+        // only to the modules that want this G or M code
+        gcode_hooks.dispatch(static_cast<Gcode *>(argument));
+    } else {
+        for (auto m : hooks[id_event]) {
+            (m->*kernel_callback_functions[id_event])(argument);
+        }
+    }
+
+    if(id_event == ON_HALT && this->halted && !was_idle) {
+        // we need to try to correct current positions if we were running
+        this->robot->reset_position_from_current_actuator_position();
+    }
+
+    if(id_event == ON_IDLE) {
+        idle_ns += std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - idle_start).count();
+    }
+}
+
+bool Kernel::kernel_has_event(_EVENT_ENUM id_event, Module *mod)
+{
+    for (auto m : hooks[id_event]) {
+        if(m == mod) return true;
+    }
+    return false;
+}
+
+void Kernel::unregister_for_event(_EVENT_ENUM id_event, Module *mod)
+{
+    if(id_event == ON_GCODE_RECEIVED) gcode_hooks.remove(mod);
+    for (auto i = hooks[id_event].begin(); i != hooks[id_event].end(); ++i) {
+        if(*i == mod) {
+            hooks[id_event].erase(i);
+            return;
+        }
+    }
+}
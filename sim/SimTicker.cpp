@@ -0,0 +1,111 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+    The virtual clock of the host simulator.
+
+    StepTicker::step_tick() is run from here instead of the TIMER0 interrupt. The SimTicker module runs a fixed number
+    of ticks on every ON_IDLE, so time only moves on while the firmware is idle and a run is fully deterministic.
+*/
+
+#include "libs/Kernel.h"
+#include "libs/StepTicker.h"
+#include "libs/StepperMotor.h"
+#include "libs/LPC17xx/sLPC17xx.h"
+#include "modules/robot/Robot.h"
+#include "SimTicker.h"
+#include "Sim.h"
+
+#include <vector>
+#include <chrono>
+
+using sim_clock= std::chrono::steady_clock;
+
+static uint64_t ticks= 0;
+static FILE *step_log= nullptr;
+static StreamOutput *timeline= nullptr;
+static std::vector<int32_t> last_position;
+static const Block *last_block= nullptr;
+static SimTicker::stats_t stats;
+
+static void run_pendsv(StepTicker *st)
+{
+    const uint32_t pendsvset= 0x10000000;
+    if((SCB->ICSR & pendsvset) == 0) return;
+    SCB->ICSR &= ~pendsvset;
+    st->handle_finish();
+}
+
+uint64_t sim_get_ticks()
+{
+    return ticks;
+}
+
+void sim_run_ticks(uint32_t n)
+{
+    StepTicker *st= THEKERNEL->step_ticker;
+    std::vector<StepperMotor*> &actuators= THEROBOT->actuators;
+
+    if(last_position.size() != actuators.size()) {
+        last_position.clear();
+        for(auto a : actuators) last_position.push_back(a->get_current_step());
+    }
+
+    sim_clock::time_point start= sim_clock::now();
+    for (uint32_t i = 0; i < n; ++i) {
+        // PendSV, if the main loop pended it, runs before the next tick
+        run_pendsv(st);
+
+        // the TIMER0 interrupt followed by the TIMER1 unstep interrupt, which runs again while motors are due a second step
+        // then PendSV if they pended it
+        st->step_tick();
+        while(st->is_unstep_pending()) st->unstep_tick();
+        run_pendsv(st);
+
+        const Block *b= st->get_current_block();
+        if(b != nullptr && b != last_block) ++stats.blocks;
+        last_block= b;
+
+        // find any motor that stepped on this tick, it may have stepped twice with max_steps_per_tick 2
+        for (size_t m = 0; m < actuators.size(); ++m) {
+            int32_t pos= actuators[m]->get_current_step();
+            while(pos != last_position[m]) {
+                if(step_log != nullptr) fprintf(step_log, "%llu %u %c\n", (unsigned long long)ticks, (unsigned)m, pos > last_position[m] ? '+' : '-');
+                last_position[m] += (pos > last_position[m]) ? 1 : -1;
+                ++stats.steps;
+            }
+        }
+        ++ticks;
+    }
+    stats.tick_ns += std::chrono::duration_cast<std::chrono::nanoseconds>(sim_clock::now() - start).count();
+
+    // empty it often enough that it never fills up
+    if(timeline != nullptr) st->print_timeline(timeline, false);
+}
+
+SimTicker::SimTicker(uint32_t ticks_per_idle, FILE *log, StreamOutput *tl)
+{
+    this->ticks_per_idle= ticks_per_idle;
+    step_log= log;
+    timeline= tl;
+    if(timeline != nullptr) THEKERNEL->step_ticker->print_timeline(timeline, true);
+}
+
+void SimTicker::on_module_loaded()
+{
+    register_for_event(ON_IDLE);
+}
+
+void SimTicker::on_idle(void *)
+{
+    sim_run_ticks(ticks_per_idle);
+}
+
+const SimTicker::stats_t& SimTicker::get_stats() const
+{
+    return stats;
+}
@@ -0,0 +1,35 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include "libs/Module.h"
+
+#include <stdint.h>
+#include <stdio.h>
+
+class StreamOutput;
+
+// stands in for the step ticker interrupt, runs ticks_per_idle step ticks on every ON_IDLE
+// if log is set every step is written to it as: <tick> <actuator> <+|->
+// if timeline is set the step ticker's step timeline is written to it after every run of ticks, see StepTimeline.h
+class SimTicker : public Module {
+    public:
+        SimTicker(uint32_t ticks_per_idle, FILE *log, StreamOutput *timeline= nullptr);
+        void on_module_loaded();
+        void on_idle(void *);
+
+        using stats_t= struct {
+            uint64_t blocks;    // blocks started by the step ticker
+            uint64_t steps;     // steps issued on all actuators
+            uint64_t tick_ns;   // host time spent running ticks
+        };
+        const stats_t& get_stats() const;
+
+    private:
+        uint32_t ticks_per_idle;
+};
@@ -0,0 +1,766 @@
+; CAM pocketing with arcs
+G21
+G90
+G0 Z5 F3000
+G0 X10 Y10
+G1 Z-0.50 F600
+G1 X13.000 Y10.000 F1500
+G1 X67.000 Y10.000
+G3 X70.000 Y13.000 I0 J3.000
+G1 X70.000 Y47.000
+G3 X67.000 Y50.000 I-3.000 J0
+G1 X13.000 Y50.000
+G3 X10.000 Y47.000 I0 J-3.000
+G1 X10.000 Y13.000
+G3 X13.000 Y10.000 I3.000 J0
+G1 X14.500 Y11.500 F1500
+G1 X65.500 Y11.500
+G3 X68.500 Y14.500 I0 J3.000
+G1 X68.500 Y45.500
+G3 X65.500 Y48.500 I-3.000 J0
+G1 X14.500 Y48.500
+G3 X11.500 Y45.500 I0 J-3.000
+G1 X11.500 Y14.500
+G3 X14.500 Y11.500 I3.000 J0
+G1 X16.000 Y13.000 F1500
+G1 X64.000 Y13.000
+G3 X67.000 Y16.000 I0 J3.000
+G1 X67.000 Y44.000
+G3 X64.000 Y47.000 I-3.000 J0
+G1 X16.000 Y47.000
+G3 X13.000 Y44.000 I0 J-3.000
+G1 X13.000 Y16.000
+G3 X16.000 Y13.000 I3.000 J0
+G1 X17.500 Y14.500 F1500
+G1 X62.500 Y14.500
+G3 X65.500 Y17.500 I0 J3.000
+G1 X65.500 Y42.500
+G3 X62.500 Y45.500 I-3.000 J0
+G1 X17.500 Y45.500
+G3 X14.500 Y42.500 I0 J-3.000
+G1 X14.500 Y17.500
+G3 X17.500 Y14.500 I3.000 J0
+G1 X19.000 Y16.000 F1500
+G1 X61.000 Y16.000
+G3 X64.000 Y19.000 I0 J3.000
+G1 X64.000 Y41.000
+G3 X61.000 Y44.000 I-3.000 J0
+G1 X19.000 Y44.000
+G3 X16.000 Y41.000 I0 J-3.000
+G1 X16.000 Y19.000
+G3 X19.000 Y16.000 I3.000 J0
+G1 X20.500 Y17.500 F1500
+G1 X59.500 Y17.500
+G3 X62.500 Y20.500 I0 J3.000
+G1 X62.500 Y39.500
+G3 X59.500 Y42.500 I-3.000 J0
+G1 X20.500 Y42.500
+G3 X17.500 Y39.500 I0 J-3.000
+G1 X17.500 Y20.500
+G3 X20.500 Y17.500 I3.000 J0
+G1 X22.000 Y19.000 F1500
+G1 X58.000 Y19.000
+G3 X61.000 Y22.000 I0 J3.000
+G1 X61.000 Y38.000
+G3 X58.000 Y41.000 I-3.000 J0
+G1 X22.000 Y41.000
+G3 X19.000 Y38.000 I0 J-3.000
+G1 X19.000 Y22.000
+G3 X22.000 Y19.000 I3.000 J0
+G1 X23.500 Y20.500 F1500
+G1 X56.500 Y20.500
+G3 X59.500 Y23.500 I0 J3.000
+G1 X59.500 Y36.500
+G3 X56.500 Y39.500 I-3.000 J0
+G1 X23.500 Y39.500
+G3 X20.500 Y36.500 I0 J-3.000
+G1 X20.500 Y23.500
+G3 X23.500 Y20.500 I3.000 J0
+G1 X25.000 Y22.000 F1500
+G1 X55.000 Y22.000
+G3 X58.000 Y25.000 I0 J3.000
+G1 X58.000 Y35.000
+G3 X55.000 Y38.000 I-3.000 J0
+G1 X25.000 Y38.000
+G3 X22.000 Y35.000 I0 J-3.000
+G1 X22.000 Y25.000
+G3 X25.000 Y22.000 I3.000 J0
+G1 X26.500 Y23.500 F1500
+G1 X53.500 Y23.500
+G3 X56.500 Y26.500 I0 J3.000
+G1 X56.500 Y33.500
+G3 X53.500 Y36.500 I-3.000 J0
+G1 X26.500 Y36.500
+G3 X23.500 Y33.500 I0 J-3.000
+G1 X23.500 Y26.500
+G3 X26.500 Y23.500 I3.000 J0
+G1 X20 Y60 F1500
+G2 X23.000 Y60 I1.5 J0
+G2 X20.500 Y60 I-1.25 J0
+G2 X23.500 Y60 I1.5 J0
+G2 X21.000 Y60 I-1.25 J0
+G2 X24.000 Y60 I1.5 J0
+G2 X21.500 Y60 I-1.25 J0
+G2 X24.500 Y60 I1.5 J0
+G2 X22.000 Y60 I-1.25 J0
+G2 X25.000 Y60 I1.5 J0
+G2 X22.500 Y60 I-1.25 J0
+G2 X25.500 Y60 I1.5 J0
+G2 X23.000 Y60 I-1.25 J0
+G2 X26.000 Y60 I1.5 J0
+G2 X23.500 Y60 I-1.25 J0
+G2 X26.500 Y60 I1.5 J0
+G2 X24.000 Y60 I-1.25 J0
+G2 X27.000 Y60 I1.5 J0
+G2 X24.500 Y60 I-1.25 J0
+G2 X27.500 Y60 I1.5 J0
+G2 X25.000 Y60 I-1.25 J0
+G2 X28.000 Y60 I1.5 J0
+G2 X25.500 Y60 I-1.25 J0
+G2 X28.500 Y60 I1.5 J0
+G2 X26.000 Y60 I-1.25 J0
+G2 X29.000 Y60 I1.5 J0
+G2 X26.500 Y60 I-1.25 J0
+G2 X29.500 Y60 I1.5 J0
+G2 X27.000 Y60 I-1.25 J0
+G2 X30.000 Y60 I1.5 J0
+G2 X27.500 Y60 I-1.25 J0
+G2 X30.500 Y60 I1.5 J0
+G2 X28.000 Y60 I-1.25 J0
+G2 X31.000 Y60 I1.5 J0
+G2 X28.500 Y60 I-1.25 J0
+G2 X31.500 Y60 I1.5 J0
+G2 X29.000 Y60 I-1.25 J0
+G2 X32.000 Y60 I1.5 J0
+G2 X29.500 Y60 I-1.25 J0
+G2 X32.500 Y60 I1.5 J0
+G2 X30.000 Y60 I-1.25 J0
+G2 X33.000 Y60 I1.5 J0
+G2 X30.500 Y60 I-1.25 J0
+G2 X33.500 Y60 I1.5 J0
+G2 X31.000 Y60 I-1.25 J0
+G2 X34.000 Y60 I1.5 J0
+G2 X31.500 Y60 I-1.25 J0
+G2 X34.500 Y60 I1.5 J0
+G2 X32.000 Y60 I-1.25 J0
+G2 X35.000 Y60 I1.5 J0
+G2 X32.500 Y60 I-1.25 J0
+G2 X35.500 Y60 I1.5 J0
+G2 X33.000 Y60 I-1.25 J0
+G2 X36.000 Y60 I1.5 J0
+G2 X33.500 Y60 I-1.25 J0
+G2 X36.500 Y60 I1.5 J0
+G2 X34.000 Y60 I-1.25 J0
+G2 X37.000 Y60 I1.5 J0
+G2 X34.500 Y60 I-1.25 J0
+G2 X37.500 Y60 I1.5 J0
+G2 X35.000 Y60 I-1.25 J0
+G2 X38.000 Y60 I1.5 J0
+G2 X35.500 Y60 I-1.25 J0
+G2 X38.500 Y60 I1.5 J0
+G2 X36.000 Y60 I-1.25 J0
+G2 X39.000 Y60 I1.5 J0
+G2 X36.500 Y60 I-1.25 J0
+G2 X39.500 Y60 I1.5 J0
+G2 X37.000 Y60 I-1.25 J0
+G2 X40.000 Y60 I1.5 J0
+G2 X37.500 Y60 I-1.25 J0
+G2 X40.500 Y60 I1.5 J0
+G2 X38.000 Y60 I-1.25 J0
+G2 X41.000 Y60 I1.5 J0
+G2 X38.500 Y60 I-1.25 J0
+G2 X41.500 Y60 I1.5 J0
+G2 X39.000 Y60 I-1.25 J0
+G2 X42.000 Y60 I1.5 J0
+G2 X39.500 Y60 I-1.25 J0
+G2 X42.500 Y60 I1.5 J0
+G2 X40.000 Y60 I-1.25 J0
+G2 X43.000 Y60 I1.5 J0
+G2 X40.500 Y60 I-1.25 J0
+G2 X43.500 Y60 I1.5 J0
+G2 X41.000 Y60 I-1.25 J0
+G2 X44.000 Y60 I1.5 J0
+G2 X41.500 Y60 I-1.25 J0
+G2 X44.500 Y60 I1.5 J0
+G2 X42.000 Y60 I-1.25 J0
+G2 X45.000 Y60 I1.5 J0
+G2 X42.500 Y60 I-1.25 J0
+G2 X45.500 Y60 I1.5 J0
+G2 X43.000 Y60 I-1.25 J0
+G2 X46.000 Y60 I1.5 J0
+G2 X43.500 Y60 I-1.25 J0
+G2 X46.500 Y60 I1.5 J0
+G2 X44.000 Y60 I-1.25 J0
+G2 X47.000 Y60 I1.5 J0
+G2 X44.500 Y60 I-1.25 J0
+G2 X47.500 Y60 I1.5 J0
+G2 X45.000 Y60 I-1.25 J0
+G2 X48.000 Y60 I1.5 J0
+G2 X45.500 Y60 I-1.25 J0
+G2 X48.500 Y60 I1.5 J0
+G2 X46.000 Y60 I-1.25 J0
+G2 X49.000 Y60 I1.5 J0
+G2 X46.500 Y60 I-1.25 J0
+G2 X49.500 Y60 I1.5 J0
+G2 X47.000 Y60 I-1.25 J0
+G2 X50.000 Y60 I1.5 J0
+G2 X47.500 Y60 I-1.25 J0
+G2 X50.500 Y60 I1.5 J0
+G2 X48.000 Y60 I-1.25 J0
+G2 X51.000 Y60 I1.5 J0
+G2 X48.500 Y60 I-1.25 J0
+G2 X51.500 Y60 I1.5 J0
+G2 X49.000 Y60 I-1.25 J0
+G2 X52.000 Y60 I1.5 J0
+G2 X49.500 Y60 I-1.25 J0
+G2 X52.500 Y60 I1.5 J0
+G2 X50.000 Y60 I-1.25 J0
+G2 X53.000 Y60 I1.5 J0
+G2 X50.500 Y60 I-1.25 J0
+G2 X53.500 Y60 I1.5 J0
+G2 X51.000 Y60 I-1.25 J0
+G2 X54.000 Y60 I1.5 J0
+G2 X51.500 Y60 I-1.25 J0
+G2 X54.500 Y60 I1.5 J0
+G2 X52.000 Y60 I-1.25 J0
+G2 X55.000 Y60 I1.5 J0
+G2 X52.500 Y60 I-1.25 J0
+G2 X55.500 Y60 I1.5 J0
+G2 X53.000 Y60 I-1.25 J0
+G2 X56.000 Y60 I1.5 J0
+G2 X53.500 Y60 I-1.25 J0
+G2 X56.500 Y60 I1.5 J0
+G2 X54.000 Y60 I-1.25 J0
+G2 X57.000 Y60 I1.5 J0
+G2 X54.500 Y60 I-1.25 J0
+G2 X57.500 Y60 I1.5 J0
+G2 X55.000 Y60 I-1.25 J0
+G2 X58.000 Y60 I1.5 J0
+G2 X55.500 Y60 I-1.25 J0
+G2 X58.500 Y60 I1.5 J0
+G2 X56.000 Y60 I-1.25 J0
+G2 X59.000 Y60 I1.5 J0
+G2 X56.500 Y60 I-1.25 J0
+G2 X59.500 Y60 I1.5 J0
+G2 X57.000 Y60 I-1.25 J0
+G2 X60.000 Y60 I1.5 J0
+G2 X57.500 Y60 I-1.25 J0
+G2 X60.500 Y60 I1.5 J0
+G2 X58.000 Y60 I-1.25 J0
+G2 X61.000 Y60 I1.5 J0
+G2 X58.500 Y60 I-1.25 J0
+G2 X61.500 Y60 I1.5 J0
+G2 X59.000 Y60 I-1.25 J0
+G2 X62.000 Y60 I1.5 J0
+G2 X59.500 Y60 I-1.25 J0
+G2 X62.500 Y60 I1.5 J0
+G2 X60.000 Y60 I-1.25 J0
+G0 Z5
+G0 X10 Y10
+G1 Z-1.00 F600
+G1 X13.000 Y10.000 F1500
+G1 X67.000 Y10.000
+G3 X70.000 Y13.000 I0 J3.000
+G1 X70.000 Y47.000
+G3 X67.000 Y50.000 I-3.000 J0
+G1 X13.000 Y50.000
+G3 X10.000 Y47.000 I0 J-3.000
+G1 X10.000 Y13.000
+G3 X13.000 Y10.000 I3.000 J0
+G1 X14.500 Y11.500 F1500
+G1 X65.500 Y11.500
+G3 X68.500 Y14.500 I0 J3.000
+G1 X68.500 Y45.500
+G3 X65.500 Y48.500 I-3.000 J0
+G1 X14.500 Y48.500
+G3 X11.500 Y45.500 I0 J-3.000
+G1 X11.500 Y14.500
+G3 X14.500 Y11.500 I3.000 J0
+G1 X16.000 Y13.000 F1500
+G1 X64.000 Y13.000
+G3 X67.000 Y16.000 I0 J3.000
+G1 X67.000 Y44.000
+G3 X64.000 Y47.000 I-3.000 J0
+G1 X16.000 Y47.000
+G3 X13.000 Y44.000 I0 J-3.000
+G1 X13.000 Y16.000
+G3 X16.000 Y13.000 I3.000 J0
+G1 X17.500 Y14.500 F1500
+G1 X62.500 Y14.500
+G3 X65.500 Y17.500 I0 J3.000
+G1 X65.500 Y42.500
+G3 X62.500 Y45.500 I-3.000 J0
+G1 X17.500 Y45.500
+G3 X14.500 Y42.500 I0 J-3.000
+G1 X14.500 Y17.500
+G3 X17.500 Y14.500 I3.000 J0
+G1 X19.000 Y16.000 F1500
+G1 X61.000 Y16.000
+G3 X64.000 Y19.000 I0 J3.000
+G1 X64.000 Y41.000
+G3 X61.000 Y44.000 I-3.000 J0
+G1 X19.000 Y44.000
+G3 X16.000 Y41.000 I0 J-3.000
+G1 X16.000 Y19.000
+G3 X19.000 Y16.000 I3.000 J0
+G1 X20.500 Y17.500 F1500
+G1 X59.500 Y17.500
+G3 X62.500 Y20.500 I0 J3.000
+G1 X62.500 Y39.500
+G3 X59.500 Y42.500 I-3.000 J0
+G1 X20.500 Y42.500
+G3 X17.500 Y39.500 I0 J-3.000
+G1 X17.500 Y20.500
+G3 X20.500 Y17.500 I3.000 J0
+G1 X22.000 Y19.000 F1500
+G1 X58.000 Y19.000
+G3 X61.000 Y22.000 I0 J3.000
+G1 X61.000 Y38.000
+G3 X58.000 Y41.000 I-3.000 J0
+G1 X22.000 Y41.000
+G3 X19.000 Y38.000 I0 J-3.000
+G1 X19.000 Y22.000
+G3 X22.000 Y19.000 I3.000 J0
+G1 X23.500 Y20.500 F1500
+G1 X56.500 Y20.500
+G3 X59.500 Y23.500 I0 J3.000
+G1 X59.500 Y36.500
+G3 X56.500 Y39.500 I-3.000 J0
+G1 X23.500 Y39.500
+G3 X20.500 Y36.500 I0 J-3.000
+G1 X20.500 Y23.500
+G3 X23.500 Y20.500 I3.000 J0
+G1 X25.000 Y22.000 F1500
+G1 X55.000 Y22.000
+G3 X58.000 Y25.000 I0 J3.000
+G1 X58.000 Y35.000
+G3 X55.000 Y38.000 I-3.000 J0
+G1 X25.000 Y38.000
+G3 X22.000 Y35.000 I0 J-3.000
+G1 X22.000 Y25.000
+G3 X25.000 Y22.000 I3.000 J0
+G1 X26.500 Y23.500 F1500
+G1 X53.500 Y23.500
+G3 X56.500 Y26.500 I0 J3.000
+G1 X56.500 Y33.500
+G3 X53.500 Y36.500 I-3.000 J0
+G1 X26.500 Y36.500
+G3 X23.500 Y33.500 I0 J-3.000
+G1 X23.500 Y26.500
+G3 X26.500 Y23.500 I3.000 J0
+G1 X20 Y60 F1500
+G2 X23.000 Y60 I1.5 J0
+G2 X20.500 Y60 I-1.25 J0
+G2 X23.500 Y60 I1.5 J0
+G2 X21.000 Y60 I-1.25 J0
+G2 X24.000 Y60 I1.5 J0
+G2 X21.500 Y60 I-1.25 J0
+G2 X24.500 Y60 I1.5 J0
+G2 X22.000 Y60 I-1.25 J0
+G2 X25.000 Y60 I1.5 J0
+G2 X22.500 Y60 I-1.25 J0
+G2 X25.500 Y60 I1.5 J0
+G2 X23.000 Y60 I-1.25 J0
+G2 X26.000 Y60 I1.5 J0
+G2 X23.500 Y60 I-1.25 J0
+G2 X26.500 Y60 I1.5 J0
+G2 X24.000 Y60 I-1.25 J0
+G2 X27.000 Y60 I1.5 J0
+G2 X24.500 Y60 I-1.25 J0
+G2 X27.500 Y60 I1.5 J0
+G2 X25.000 Y60 I-1.25 J0
+G2 X28.000 Y60 I1.5 J0
+G2 X25.500 Y60 I-1.25 J0
+G2 X28.500 Y60 I1.5 J0
+G2 X26.000 Y60 I-1.25 J0
+G2 X29.000 Y60 I1.5 J0
+G2 X26.500 Y60 I-1.25 J0
+G2 X29.500 Y60 I1.5 J0
+G2 X27.000 Y60 I-1.25 J0
+G2 X30.000 Y60 I1.5 J0
+G2 X27.500 Y60 I-1.25 J0
+G2 X30.500 Y60 I1.5 J0
+G2 X28.000 Y60 I-1.25 J0
+G2 X31.000 Y60 I1.5 J0
+G2 X28.500 Y60 I-1.25 J0
+G2 X31.500 Y60 I1.5 J0
+G2 X29.000 Y60 I-1.25 J0
+G2 X32.000 Y60 I1.5 J0
+G2 X29.500 Y60 I-1.25 J0
+G2 X32.500 Y60 I1.5 J0
+G2 X30.000 Y60 I-1.25 J0
+G2 X33.000 Y60 I1.5 J0
+G2 X30.500 Y60 I-1.25 J0
+G2 X33.500 Y60 I1.5 J0
+G2 X31.000 Y60 I-1.25 J0
+G2 X34.000 Y60 I1.5 J0
+G2 X31.500 Y60 I-1.25 J0
+G2 X34.500 Y60 I1.5 J0
+G2 X32.000 Y60 I-1.25 J0
+G2 X35.000 Y60 I1.5 J0
+G2 X32.500 Y60 I-1.25 J0
+G2 X35.500 Y60 I1.5 J0
+G2 X33.000 Y60 I-1.25 J0
+G2 X36.000 Y60 I1.5 J0
+G2 X33.500 Y60 I-1.25 J0
+G2 X36.500 Y60 I1.5 J0
+G2 X34.000 Y60 I-1.25 J0
+G2 X37.000 Y60 I1.5 J0
+G2 X34.500 Y60 I-1.25 J0
+G2 X37.500 Y60 I1.5 J0
+G2 X35.000 Y60 I-1.25 J0
+G2 X38.000 Y60 I1.5 J0
+G2 X35.500 Y60 I-1.25 J0
+G2 X38.500 Y60 I1.5 J0
+G2 X36.000 Y60 I-1.25 J0
+G2 X39.000 Y60 I1.5 J0
+G2 X36.500 Y60 I-1.25 J0
+G2 X39.500 Y60 I1.5 J0
+G2 X37.000 Y60 I-1.25 J0
+G2 X40.000 Y60 I1.5 J0
+G2 X37.500 Y60 I-1.25 J0
+G2 X40.500 Y60 I1.5 J0
+G2 X38.000 Y60 I-1.25 J0
+G2 X41.000 Y60 I1.5 J0
+G2 X38.500 Y60 I-1.25 J0
+G2 X41.500 Y60 I1.5 J0
+G2 X39.000 Y60 I-1.25 J0
+G2 X42.000 Y60 I1.5 J0
+G2 X39.500 Y60 I-1.25 J0
+G2 X42.500 Y60 I1.5 J0
+G2 X40.000 Y60 I-1.25 J0
+G2 X43.000 Y60 I1.5 J0
+G2 X40.500 Y60 I-1.25 J0
+G2 X43.500 Y60 I1.5 J0
+G2 X41.000 Y60 I-1.25 J0
+G2 X44.000 Y60 I1.5 J0
+G2 X41.500 Y60 I-1.25 J0
+G2 X44.500 Y60 I1.5 J0
+G2 X42.000 Y60 I-1.25 J0
+G2 X45.000 Y60 I1.5 J0
+G2 X42.500 Y60 I-1.25 J0
+G2 X45.500 Y60 I1.5 J0
+G2 X43.000 Y60 I-1.25 J0
+G2 X46.000 Y60 I1.5 J0
+G2 X43.500 Y60 I-1.25 J0
+G2 X46.500 Y60 I1.5 J0
+G2 X44.000 Y60 I-1.25 J0
+G2 X47.000 Y60 I1.5 J0
+G2 X44.500 Y60 I-1.25 J0
+G2 X47.500 Y60 I1.5 J0
+G2 X45.000 Y60 I-1.25 J0
+G2 X48.000 Y60 I1.5 J0
+G2 X45.500 Y60 I-1.25 J0
+G2 X48.500 Y60 I1.5 J0
+G2 X46.000 Y60 I-1.25 J0
+G2 X49.000 Y60 I1.5 J0
+G2 X46.500 Y60 I-1.25 J0
+G2 X49.500 Y60 I1.5 J0
+G2 X47.000 Y60 I-1.25 J0
+G2 X50.000 Y60 I1.5 J0
+G2 X47.500 Y60 I-1.25 J0
+G2 X50.500 Y60 I1.5 J0
+G2 X48.000 Y60 I-1.25 J0
+G2 X51.000 Y60 I1.5 J0
+G2 X48.500 Y60 I-1.25 J0
+G2 X51.500 Y60 I1.5 J0
+G2 X49.000 Y60 I-1.25 J0
+G2 X52.000 Y60 I1.5 J0
+G2 X49.500 Y60 I-1.25 J0
+G2 X52.500 Y60 I1.5 J0
+G2 X50.000 Y60 I-1.25 J0
+G2 X53.000 Y60 I1.5 J0
+G2 X50.500 Y60 I-1.25 J0
+G2 X53.500 Y60 I1.5 J0
+G2 X51.000 Y60 I-1.25 J0
+G2 X54.000 Y60 I1.5 J0
+G2 X51.500 Y60 I-1.25 J0
+G2 X54.500 Y60 I1.5 J0
+G2 X52.000 Y60 I-1.25 J0
+G2 X55.000 Y60 I1.5 J0
+G2 X52.500 Y60 I-1.25 J0
+G2 X55.500 Y60 I1.5 J0
+G2 X53.000 Y60 I-1.25 J0
+G2 X56.000 Y60 I1.5 J0
+G2 X53.500 Y60 I-1.25 J0
+G2 X56.500 Y60 I1.5 J0
+G2 X54.000 Y60 I-1.25 J0
+G2 X57.000 Y60 I1.5 J0
+G2 X54.500 Y60 I-1.25 J0
+G2 X57.500 Y60 I1.5 J0
+G2 X55.000 Y60 I-1.25 J0
+G2 X58.000 Y60 I1.5 J0
+G2 X55.500 Y60 I-1.25 J0
+G2 X58.500 Y60 I1.5 J0
+G2 X56.000 Y60 I-1.25 J0
+G2 X59.000 Y60 I1.5 J0
+G2 X56.500 Y60 I-1.25 J0
+G2 X59.500 Y60 I1.5 J0
+G2 X57.000 Y60 I-1.25 J0
+G2 X60.000 Y60 I1.5 J0
+G2 X57.500 Y60 I-1.25 J0
+G2 X60.500 Y60 I1.5 J0
+G2 X58.000 Y60 I-1.25 J0
+G2 X61.000 Y60 I1.5 J0
+G2 X58.500 Y60 I-1.25 J0
+G2 X61.500 Y60 I1.5 J0
+G2 X59.000 Y60 I-1.25 J0
+G2 X62.000 Y60 I1.5 J0
+G2 X59.500 Y60 I-1.25 J0
+G2 X62.500 Y60 I1.5 J0
+G2 X60.000 Y60 I-1.25 J0
+G0 Z5
+G0 X10 Y10
+G1 Z-1.50 F600
+G1 X13.000 Y10.000 F1500
+G1 X67.000 Y10.000
+G3 X70.000 Y13.000 I0 J3.000
+G1 X70.000 Y47.000
+G3 X67.000 Y50.000 I-3.000 J0
+G1 X13.000 Y50.000
+G3 X10.000 Y47.000 I0 J-3.000
+G1 X10.000 Y13.000
+G3 X13.000 Y10.000 I3.000 J0
+G1 X14.500 Y11.500 F1500
+G1 X65.500 Y11.500
+G3 X68.500 Y14.500 I0 J3.000
+G1 X68.500 Y45.500
+G3 X65.500 Y48.500 I-3.000 J0
+G1 X14.500 Y48.500
+G3 X11.500 Y45.500 I0 J-3.000
+G1 X11.500 Y14.500
+G3 X14.500 Y11.500 I3.000 J0
+G1 X16.000 Y13.000 F1500
+G1 X64.000 Y13.000
+G3 X67.000 Y16.000 I0 J3.000
+G1 X67.000 Y44.000
+G3 X64.000 Y47.000 I-3.000 J0
+G1 X16.000 Y47.000
+G3 X13.000 Y44.000 I0 J-3.000
+G1 X13.000 Y16.000
+G3 X16.000 Y13.000 I3.000 J0
+G1 X17.500 Y14.500 F1500
+G1 X62.500 Y14.500
+G3 X65.500 Y17.500 I0 J3.000
+G1 X65.500 Y42.500
+G3 X62.500 Y45.500 I-3.000 J0
+G1 X17.500 Y45.500
+G3 X14.500 Y42.500 I0 J-3.000
+G1 X14.500 Y17.500
+G3 X17.500 Y14.500 I3.000 J0
+G1 X19.000 Y16.000 F1500
+G1 X61.000 Y16.000
+G3 X64.000 Y19.000 I0 J3.000
+G1 X64.000 Y41.000
+G3 X61.000 Y44.000 I-3.000 J0
+G1 X19.000 Y44.000
+G3 X16.000 Y41.000 I0 J-3.000
+G1 X16.000 Y19.000
+G3 X19.000 Y16.000 I3.000 J0
+G1 X20.500 Y17.500 F1500
+G1 X59.500 Y17.500
+G3 X62.500 Y20.500 I0 J3.000
+G1 X62.500 Y39.500
+G3 X59.500 Y42.500 I-3.000 J0
+G1 X20.500 Y42.500
+G3 X17.500 Y39.500 I0 J-3.000
+G1 X17.500 Y20.500
+G3 X20.500 Y17.500 I3.000 J0
+G1 X22.000 Y19.000 F1500
+G1 X58.000 Y19.000
+G3 X61.000 Y22.000 I0 J3.000
+G1 X61.000 Y38.000
+G3 X58.000 Y41.000 I-3.000 J0
+G1 X22.000 Y41.000
+G3 X19.000 Y38.000 I0 J-3.000
+G1 X19.000 Y22.000
+G3 X22.000 Y19.000 I3.000 J0
+G1 X23.500 Y20.500 F1500
+G1 X56.500 Y20.500
+G3 X59.500 Y23.500 I0 J3.000
+G1 X59.500 Y36.500
+G3 X56.500 Y39.500 I-3.000 J0
+G1 X23.500 Y39.500
+G3 X20.500 Y36.500 I0 J-3.000
+G1 X20.500 Y23.500
+G3 X23.500 Y20.500 I3.000 J0
+G1 X25.000 Y22.000 F1500
+G1 X55.000 Y22.000
+G3 X58.000 Y25.000 I0 J3.000
+G1 X58.000 Y35.000
+G3 X55.000 Y38.000 I-3.000 J0
+G1 X25.000 Y38.000
+G3 X22.000 Y35.000 I0 J-3.000
+G1 X22.000 Y25.000
+G3 X25.000 Y22.000 I3.000 J0
+G1 X26.500 Y23.500 F1500
+G1 X53.500 Y23.500
+G3 X56.500 Y26.500 I0 J3.000
+G1 X56.500 Y33.500
+G3 X53.500 Y36.500 I-3.000 J0
+G1 X26.500 Y36.500
+G3 X23.500 Y33.500 I0 J-3.000
+G1 X23.500 Y26.500
+G3 X26.500 Y23.500 I3.000 J0
+G1 X20 Y60 F1500
+G2 X23.000 Y60 I1.5 J0
+G2 X20.500 Y60 I-1.25 J0
+G2 X23.500 Y60 I1.5 J0
+G2 X21.000 Y60 I-1.25 J0
+G2 X24.000 Y60 I1.5 J0
+G2 X21.500 Y60 I-1.25 J0
+G2 X24.500 Y60 I1.5 J0
+G2 X22.000 Y60 I-1.25 J0
+G2 X25.000 Y60 I1.5 J0
+G2 X22.500 Y60 I-1.25 J0
+G2 X25.500 Y60 I1.5 J0
+G2 X23.000 Y60 I-1.25 J0
+G2 X26.000 Y60 I1.5 J0
+G2 X23.500 Y60 I-1.25 J0
+G2 X26.500 Y60 I1.5 J0
+G2 X24.000 Y60 I-1.25 J0
+G2 X27.000 Y60 I1.5 J0
+G2 X24.500 Y60 I-1.25 J0
+G2 X27.500 Y60 I1.5 J0
+G2 X25.000 Y60 I-1.25 J0
+G2 X28.000 Y60 I1.5 J0
+G2 X25.500 Y60 I-1.25 J0
+G2 X28.500 Y60 I1.5 J0
+G2 X26.000 Y60 I-1.25 J0
+G2 X29.000 Y60 I1.5 J0
+G2 X26.500 Y60 I-1.25 J0
+G2 X29.500 Y60 I1.5 J0
+G2 X27.000 Y60 I-1.25 J0
+G2 X30.000 Y60 I1.5 J0
+G2 X27.500 Y60 I-1.25 J0
+G2 X30.500 Y60 I1.5 J0
+G2 X28.000 Y60 I-1.25 J0
+G2 X31.000 Y60 I1.5 J0
+G2 X28.500 Y60 I-1.25 J0
+G2 X31.500 Y60 I1.5 J0
+G2 X29.000 Y60 I-1.25 J0
+G2 X32.000 Y60 I1.5 J0
+G2 X29.500 Y60 I-1.25 J0
+G2 X32.500 Y60 I1.5 J0
+G2 X30.000 Y60 I-1.25 J0
+G2 X33.000 Y60 I1.5 J0
+G2 X30.500 Y60 I-1.25 J0
+G2 X33.500 Y60 I1.5 J0
+G2 X31.000 Y60 I-1.25 J0
+G2 X34.000 Y60 I1.5 J0
+G2 X31.500 Y60 I-1.25 J0
+G2 X34.500 Y60 I1.5 J0
+G2 X32.000 Y60 I-1.25 J0
+G2 X35.000 Y60 I1.5 J0
+G2 X32.500 Y60 I-1.25 J0
+G2 X35.500 Y60 I1.5 J0
+G2 X33.000 Y60 I-1.25 J0
+G2 X36.000 Y60 I1.5 J0
+G2 X33.500 Y60 I-1.25 J0
+G2 X36.500 Y60 I1.5 J0
+G2 X34.000 Y60 I-1.25 J0
+G2 X37.000 Y60 I1.5 J0
+G2 X34.500 Y60 I-1.25 J0
+G2 X37.500 Y60 I1.5 J0
+G2 X35.000 Y60 I-1.25 J0
+G2 X38.000 Y60 I1.5 J0
+G2 X35.500 Y60 I-1.25 J0
+G2 X38.500 Y60 I1.5 J0
+G2 X36.000 Y60 I-1.25 J0
+G2 X39.000 Y60 I1.5 J0
+G2 X36.500 Y60 I-1.25 J0
+G2 X39.500 Y60 I1.5 J0
+G2 X37.000 Y60 I-1.25 J0
+G2 X40.000 Y60 I1.5 J0
+G2 X37.500 Y60 I-1.25 J0
+G2 X40.500 Y60 I1.5 J0
+G2 X38.000 Y60 I-1.25 J0
+G2 X41.000 Y60 I1.5 J0
+G2 X38.500 Y60 I-1.25 J0
+G2 X41.500 Y60 I1.5 J0
+G2 X39.000 Y60 I-1.25 J0
+G2 X42.000 Y60 I1.5 J0
+G2 X39.500 Y60 I-1.25 J0
+G2 X42.500 Y60 I1.5 J0
+G2 X40.000 Y60 I-1.25 J0
+G2 X43.000 Y60 I1.5 J0
+G2 X40.500 Y60 I-1.25 J0
+G2 X43.500 Y60 I1.5 J0
+G2 X41.000 Y60 I-1.25 J0
+G2 X44.000 Y60 I1.5 J0
+G2 X41.500 Y60 I-1.25 J0
+G2 X44.500 Y60 I1.5 J0
+G2 X42.000 Y60 I-1.25 J0
+G2 X45.000 Y60 I1.5 J0
+G2 X42.500 Y60 I-1.25 J0
+G2 X45.500 Y60 I1.5 J0
+G2 X43.000 Y60 I-1.25 J0
+G2 X46.000 Y60 I1.5 J0
+G2 X43.500 Y60 I-1.25 J0
+G2 X46.500 Y60 I1.5 J0
+G2 X44.000 Y60 I-1.25 J0
+G2 X47.000 Y60 I1.5 J0
+G2 X44.500 Y60 I-1.25 J0
+G2 X47.500 Y60 I1.5 J0
+G2 X45.000 Y60 I-1.25 J0
+G2 X48.000 Y60 I1.5 J0
+G2 X45.500 Y60 I-1.25 J0
+G2 X48.500 Y60 I1.5 J0
+G2 X46.000 Y60 I-1.25 J0
+G2 X49.000 Y60 I1.5 J0
+G2 X46.500 Y60 I-1.25 J0
+G2 X49.500 Y60 I1.5 J0
+G2 X47.000 Y60 I-1.25 J0
+G2 X50.000 Y60 I1.5 J0
+G2 X47.500 Y60 I-1.25 J0
+G2 X50.500 Y60 I1.5 J0
+G2 X48.000 Y60 I-1.25 J0
+G2 X51.000 Y60 I1.5 J0
+G2 X48.500 Y60 I-1.25 J0
+G2 X51.500 Y60 I1.5 J0
+G2 X49.000 Y60 I-1.25 J0
+G2 X52.000 Y60 I1.5 J0
+G2 X49.500 Y60 I-1.25 J0
+G2 X52.500 Y60 I1.5 J0
+G2 X50.000 Y60 I-1.25 J0
+G2 X53.000 Y60 I1.5 J0
+G2 X50.500 Y60 I-1.25 J0
+G2 X53.500 Y60 I1.5 J0
+G2 X51.000 Y60 I-1.25 J0
+G2 X54.000 Y60 I1.5 J0
+G2 X51.500 Y60 I-1.25 J0
+G2 X54.500 Y60 I1.5 J0
+G2 X52.000 Y60 I-1.25 J0
+G2 X55.000 Y60 I1.5 J0
+G2 X52.500 Y60 I-1.25 J0
+G2 X55.500 Y60 I1.5 J0
+G2 X53.000 Y60 I-1.25 J0
+G2 X56.000 Y60 I1.5 J0
+G2 X53.500 Y60 I-1.25 J0
+G2 X56.500 Y60 I1.5 J0
+G2 X54.000 Y60 I-1.25 J0
+G2 X57.000 Y60 I1.5 J0
+G2 X54.500 Y60 I-1.25 J0
+G2 X57.500 Y60 I1.5 J0
+G2 X55.000 Y60 I-1.25 J0
+G2 X58.000 Y60 I1.5 J0
+G2 X55.500 Y60 I-1.25 J0
+G2 X58.500 Y60 I1.5 J0
+G2 X56.000 Y60 I-1.25 J0
+G2 X59.000 Y60 I1.5 J0
+G2 X56.500 Y60 I-1.25 J0
+G2 X59.500 Y60 I1.5 J0
+G2 X57.000 Y60 I-1.25 J0
+G2 X60.000 Y60 I1.5 J0
+G2 X57.500 Y60 I-1.25 J0
+G2 X60.500 Y60 I1.5 J0
+G2 X58.000 Y60 I-1.25 J0
+G2 X61.000 Y60 I1.5 J0
+G2 X58.500 Y60 I-1.25 J0
+G2 X61.500 Y60 I1.5 J0
+G2 X59.000 Y60 I-1.25 J0
+G2 X62.000 Y60 I1.5 J0
+G2 X59.500 Y60 I-1.25 J0
+G2 X62.500 Y60 I1.5 J0
+G2 X60.000 Y60 I-1.25 J0
+G0 Z5
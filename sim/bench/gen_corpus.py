@@ -0,0 +1,111 @@
+#!/usr/bin/env python
+"""Generates the G-code corpus used by plannerbench.
+
+The files imitate the jobs that are hard on the planner:
+  stl_slice.gcode     perimeters of sliced STL meshes, lots of tiny segments with small direction changes
+  cam_arcs.gcode      CAM pocketing with G2/G3 arcs, which Robot cuts into short segments
+  laser_raster.gcode  laser raster engraving, short G1 moves where only the S value changes
+  tiny_segments.gcode a long gentle curve of 0.05mm segments at high feed rate, the deceleration distance is
+                      longer than the queue so every block in it is replanned on every append
+
+The output is deterministic so results from different revisions can be compared, run it from this directory:
+  python gen_corpus.py
+"""
+
+from __future__ import print_function
+import math
+import random
+
+
+def stl_slice(out):
+    rnd = random.Random(1)
+    print("; sliced STL perimeters, 0.1-0.3mm segments", file=out)
+    print("G21\nG90\nG92 E0\nG1 Z0.3 F3000", file=out)
+    e = 0.0
+    for layer in range(4):
+        z = 0.3 + layer * 0.2
+        print("G1 Z%.3f F3000" % z, file=out)
+        for perimeter in range(2):
+            r0 = 20.0 - perimeter * 0.45
+            a = 0.0
+            first = True
+            while a < 2 * math.pi:
+                # a lumpy circle, like a tesselated organic surface
+                r = r0 + 0.8 * math.sin(5 * a + layer) + 0.3 * math.sin(13 * a)
+                x = 50 + r * math.cos(a)
+                y = 50 + r * math.sin(a)
+                if first:
+                    print("G0 X%.3f Y%.3f F6000" % (x, y), file=out)
+                    first = False
+                else:
+                    e += 0.004
+                    print("G1 X%.3f Y%.3f E%.5f F2400" % (x, y, e), file=out)
+                a += rnd.uniform(0.1, 0.3) / r0
+
+
+def cam_arcs(out):
+    print("; CAM pocketing with arcs", file=out)
+    print("G21\nG90\nG0 Z5 F3000", file=out)
+    for depth in range(3):
+        z = -0.5 * (depth + 1)
+        print("G0 X10 Y10\nG1 Z%.2f F600" % z, file=out)
+        # concentric rounded rectangles
+        for ring in range(10):
+            o = ring * 1.5
+            r = 3.0
+            x0, y0, x1, y1 = 10 + o, 10 + o, 70 - o, 50 - o
+            if x1 - x0 < 2 * r or y1 - y0 < 2 * r:
+                break
+            print("G1 X%.3f Y%.3f F1500" % (x0 + r, y0), file=out)
+            print("G1 X%.3f Y%.3f" % (x1 - r, y0), file=out)
+            print("G3 X%.3f Y%.3f I0 J%.3f" % (x1, y0 + r, r), file=out)
+            print("G1 X%.3f Y%.3f" % (x1, y1 - r), file=out)
+            print("G3 X%.3f Y%.3f I%.3f J0" % (x1 - r, y1, -r), file=out)
+            print("G1 X%.3f Y%.3f" % (x0 + r, y1), file=out)
+            print("G3 X%.3f Y%.3f I0 J%.3f" % (x0, y1 - r, -r), file=out)
+            print("G1 X%.3f Y%.3f" % (x0, y0 + r), file=out)
+            print("G3 X%.3f Y%.3f I%.3f J0" % (x0 + r, y0, r), file=out)
+        # trochoidal slot
+        print("G1 X20 Y60 F1500", file=out)
+        x = 20.0
+        while x < 60:
+            print("G2 X%.3f Y60 I1.5 J0" % (x + 3), file=out)
+            print("G2 X%.3f Y60 I-1.25 J0" % (x + 0.5), file=out)
+            x += 0.5
+        print("G0 Z5", file=out)
+
+
+def laser_raster(out):
+    rnd = random.Random(2)
+    print("; laser raster engraving, 0.1mm pixels", file=out)
+    print("G21\nG90\nG0 X10 Y10 F6000", file=out)
+    for row in range(60):
+        y = 10 + row * 0.1
+        xs = range(150) if row % 2 == 0 else range(149, -1, -1)
+        print("G0 X%.2f Y%.2f" % (10 + xs[0] * 0.1, y), file=out)
+        s = None
+        for px in xs:
+            # a gradient with some noise, runs of equal power are merged like a real raster does
+            v = round((0.5 + 0.5 * math.sin(px / 12.0 + row / 9.0)) * 10 + rnd.uniform(-1, 1)) / 10.0
+            v = min(max(v, 0.0), 1.0)
+            if v == s:
+                continue
+            print("G1 X%.2f S%.1f F6000" % (10 + px * 0.1, v), file=out)
+            s = v
+
+
+def tiny_segments(out):
+    print("; long gentle curve of 0.05mm segments at 200mm/s", file=out)
+    print("G21\nG90\nG1 X10 Y10 F12000", file=out)
+    x, y = 10.0, 10.0
+    for i in range(1, 6000):
+        a = i * 0.0005
+        x += 0.05 * math.cos(a)
+        y += 0.05 * math.sin(a)
+        print("G1 X%.4f Y%.4f" % (x, y), file=out)
+
+
+if __name__ == "__main__":
+    for name, gen in (("stl_slice", stl_slice), ("cam_arcs", cam_arcs), ("laser_raster", laser_raster), ("tiny_segments", tiny_segments)):
+        with open(name + ".gcode", "w") as out:
+            gen(out)
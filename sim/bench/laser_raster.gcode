@@ -0,0 +1,5124 @@
+; laser raster engraving, 0.1mm pixels
+G21
+G90
+G0 X10 Y10 F6000
+G0 X10.00 Y10.00
+G1 X10.00 S0.6 F6000
+G1 X10.20 S0.5 F6000
+G1 X10.40 S0.7 F6000
+G1 X10.60 S0.8 F6000
+G1 X10.70 S0.7 F6000
+G1 X10.80 S0.8 F6000
+G1 X10.90 S0.9 F6000
+G1 X11.10 S0.8 F6000
+G1 X11.20 S0.9 F6000
+G1 X11.40 S1.0 F6000
+G1 X12.00 S0.9 F6000
+G1 X12.20 S1.0 F6000
+G1 X12.30 S0.9 F6000
+G1 X12.50 S1.0 F6000
+G1 X12.60 S0.9 F6000
+G1 X12.80 S0.8 F6000
+G1 X12.90 S0.7 F6000
+G1 X13.00 S0.8 F6000
+G1 X13.10 S0.7 F6000
+G1 X13.30 S0.8 F6000
+G1 X13.40 S0.7 F6000
+G1 X13.50 S0.5 F6000
+G1 X13.60 S0.6 F6000
+G1 X13.80 S0.5 F6000
+G1 X14.10 S0.4 F6000
+G1 X14.20 S0.3 F6000
+G1 X14.30 S0.4 F6000
+G1 X14.40 S0.3 F6000
+G1 X14.50 S0.1 F6000
+G1 X14.60 S0.2 F6000
+G1 X14.80 S0.1 F6000
+G1 X15.20 S0.0 F6000
+G1 X15.30 S0.1 F6000
+G1 X15.40 S0.0 F6000
+G1 X15.50 S0.1 F6000
+G1 X15.70 S0.0 F6000
+G1 X15.90 S0.1 F6000
+G1 X16.10 S0.0 F6000
+G1 X16.40 S0.1 F6000
+G1 X16.60 S0.2 F6000
+G1 X16.70 S0.1 F6000
+G1 X16.80 S0.3 F6000
+G1 X16.90 S0.2 F6000
+G1 X17.00 S0.4 F6000
+G1 X17.40 S0.5 F6000
+G1 X17.80 S0.6 F6000
+G1 X17.90 S0.7 F6000
+G1 X18.10 S0.6 F6000
+G1 X18.20 S0.8 F6000
+G1 X18.40 S0.9 F6000
+G1 X18.50 S0.8 F6000
+G1 X18.60 S0.9 F6000
+G1 X18.70 S0.8 F6000
+G1 X18.80 S1.0 F6000
+G1 X18.90 S0.9 F6000
+G1 X19.10 S1.0 F6000
+G1 X19.20 S0.9 F6000
+G1 X19.30 S1.0 F6000
+G1 X19.50 S0.9 F6000
+G1 X19.70 S1.0 F6000
+G1 X20.00 S0.9 F6000
+G1 X20.20 S0.8 F6000
+G1 X20.30 S0.9 F6000
+G1 X20.40 S0.8 F6000
+G1 X20.50 S0.9 F6000
+G1 X20.60 S0.7 F6000
+G1 X20.70 S0.8 F6000
+G1 X20.80 S0.6 F6000
+G1 X21.00 S0.7 F6000
+G1 X21.10 S0.5 F6000
+G1 X21.40 S0.4 F6000
+G1 X21.50 S0.3 F6000
+G1 X21.60 S0.5 F6000
+G1 X21.70 S0.3 F6000
+G1 X21.80 S0.2 F6000
+G1 X22.00 S0.3 F6000
+G1 X22.10 S0.2 F6000
+G1 X22.20 S0.1 F6000
+G1 X22.40 S0.0 F6000
+G1 X22.50 S0.1 F6000
+G1 X23.10 S0.0 F6000
+G1 X23.80 S0.1 F6000
+G1 X23.90 S0.0 F6000
+G1 X24.00 S0.1 F6000
+G1 X24.20 S0.2 F6000
+G1 X24.30 S0.1 F6000
+G1 X24.40 S0.3 F6000
+G1 X24.50 S0.2 F6000
+G1 X24.60 S0.3 F6000
+G1 X24.90 S0.4 F6000
+G0 X24.90 Y10.10
+G1 X24.90 S0.4 F6000
+G1 X24.70 S0.3 F6000
+G1 X24.50 S0.2 F6000
+G1 X24.40 S0.3 F6000
+G1 X24.30 S0.2 F6000
+G1 X24.20 S0.3 F6000
+G1 X24.00 S0.2 F6000
+G1 X23.90 S0.1 F6000
+G1 X23.70 S0.0 F6000
+G1 X23.60 S0.1 F6000
+G1 X23.20 S0.0 F6000
+G1 X22.50 S0.1 F6000
+G1 X22.40 S0.0 F6000
+G1 X22.20 S0.1 F6000
+G1 X21.90 S0.2 F6000
+G1 X21.70 S0.3 F6000
+G1 X21.60 S0.4 F6000
+G1 X21.50 S0.3 F6000
+G1 X21.40 S0.5 F6000
+G1 X21.00 S0.6 F6000
+G1 X20.70 S0.7 F6000
+G1 X20.30 S0.9 F6000
+G1 X20.20 S0.8 F6000
+G1 X20.10 S0.9 F6000
+G1 X20.00 S1.0 F6000
+G1 X19.80 S0.9 F6000
+G1 X19.70 S1.0 F6000
+G1 X19.50 S0.9 F6000
+G1 X19.40 S1.0 F6000
+G1 X19.30 S0.9 F6000
+G1 X19.20 S1.0 F6000
+G1 X18.90 S0.9 F6000
+G1 X18.50 S0.8 F6000
+G1 X18.40 S0.9 F6000
+G1 X18.30 S0.8 F6000
+G1 X18.10 S0.7 F6000
+G1 X18.00 S0.8 F6000
+G1 X17.90 S0.6 F6000
+G1 X17.80 S0.7 F6000
+G1 X17.70 S0.6 F6000
+G1 X17.50 S0.5 F6000
+G1 X17.20 S0.4 F6000
+G1 X17.10 S0.3 F6000
+G1 X16.90 S0.2 F6000
+G1 X16.80 S0.3 F6000
+G1 X16.50 S0.2 F6000
+G1 X16.40 S0.0 F6000
+G1 X16.30 S0.1 F6000
+G1 X16.00 S0.0 F6000
+G1 X15.70 S0.1 F6000
+G1 X15.60 S0.0 F6000
+G1 X15.30 S0.1 F6000
+G1 X14.90 S0.0 F6000
+G1 X14.70 S0.1 F6000
+G1 X14.50 S0.2 F6000
+G1 X14.30 S0.3 F6000
+G1 X14.10 S0.4 F6000
+G1 X14.00 S0.3 F6000
+G1 X13.90 S0.4 F6000
+G1 X13.80 S0.5 F6000
+G1 X13.70 S0.4 F6000
+G1 X13.60 S0.5 F6000
+G1 X13.30 S0.7 F6000
+G1 X13.20 S0.8 F6000
+G1 X13.10 S0.7 F6000
+G1 X12.80 S0.8 F6000
+G1 X12.70 S0.9 F6000
+G1 X12.20 S1.0 F6000
+G1 X11.90 S0.9 F6000
+G1 X11.80 S1.0 F6000
+G1 X11.60 S0.9 F6000
+G1 X11.50 S1.0 F6000
+G1 X11.20 S0.9 F6000
+G1 X11.10 S1.0 F6000
+G1 X10.90 S0.9 F6000
+G1 X10.80 S0.8 F6000
+G1 X10.60 S0.7 F6000
+G1 X10.50 S0.8 F6000
+G1 X10.30 S0.6 F6000
+G1 X10.00 S0.5 F6000
+G0 X10.00 Y10.20
+G1 X10.00 S0.7 F6000
+G1 X10.40 S0.9 F6000
+G1 X10.50 S0.8 F6000
+G1 X10.60 S0.9 F6000
+G1 X10.90 S1.0 F6000
+G1 X11.00 S0.9 F6000
+G1 X11.10 S1.0 F6000
+G1 X11.60 S0.9 F6000
+G1 X11.70 S1.0 F6000
+G1 X12.20 S0.8 F6000
+G1 X12.30 S1.0 F6000
+G1 X12.40 S0.9 F6000
+G1 X12.80 S0.7 F6000
+G1 X12.90 S0.8 F6000
+G1 X13.10 S0.6 F6000
+G1 X13.20 S0.7 F6000
+G1 X13.30 S0.6 F6000
+G1 X13.40 S0.5 F6000
+G1 X13.50 S0.6 F6000
+G1 X13.60 S0.4 F6000
+G1 X13.90 S0.3 F6000
+G1 X14.20 S0.2 F6000
+G1 X14.30 S0.3 F6000
+G1 X14.40 S0.1 F6000
+G1 X14.50 S0.0 F6000
+G1 X14.60 S0.1 F6000
+G1 X15.00 S0.0 F6000
+G1 X15.70 S0.1 F6000
+G1 X15.80 S0.0 F6000
+G1 X15.90 S0.1 F6000
+G1 X16.30 S0.2 F6000
+G1 X16.50 S0.1 F6000
+G1 X16.60 S0.2 F6000
+G1 X16.80 S0.3 F6000
+G1 X17.10 S0.4 F6000
+G1 X17.20 S0.6 F6000
+G1 X17.30 S0.5 F6000
+G1 X17.40 S0.6 F6000
+G1 X17.70 S0.7 F6000
+G1 X17.90 S0.8 F6000
+G1 X18.20 S0.9 F6000
+G1 X18.30 S0.8 F6000
+G1 X18.40 S1.0 F6000
+G1 X18.50 S0.9 F6000
+G1 X18.60 S1.0 F6000
+G1 X19.10 S0.9 F6000
+G1 X19.20 S1.0 F6000
+G1 X19.80 S0.9 F6000
+G1 X20.10 S0.8 F6000
+G1 X20.30 S0.9 F6000
+G1 X20.40 S0.7 F6000
+G1 X20.50 S0.8 F6000
+G1 X20.60 S0.7 F6000
+G1 X20.70 S0.6 F6000
+G1 X20.90 S0.5 F6000
+G1 X21.10 S0.4 F6000
+G1 X21.60 S0.3 F6000
+G1 X21.90 S0.1 F6000
+G1 X22.20 S0.0 F6000
+G1 X22.30 S0.1 F6000
+G1 X22.40 S0.0 F6000
+G1 X22.60 S0.1 F6000
+G1 X22.70 S0.0 F6000
+G1 X22.80 S0.1 F6000
+G1 X22.90 S0.0 F6000
+G1 X23.10 S0.1 F6000
+G1 X23.20 S0.0 F6000
+G1 X23.30 S0.1 F6000
+G1 X23.70 S0.2 F6000
+G1 X24.00 S0.3 F6000
+G1 X24.30 S0.4 F6000
+G1 X24.40 S0.3 F6000
+G1 X24.50 S0.4 F6000
+G1 X24.80 S0.5 F6000
+G0 X24.90 Y10.30
+G1 X24.90 S0.7 F6000
+G1 X24.80 S0.5 F6000
+G1 X24.50 S0.4 F6000
+G1 X24.40 S0.5 F6000
+G1 X24.30 S0.3 F6000
+G1 X24.20 S0.2 F6000
+G1 X23.90 S0.3 F6000
+G1 X23.80 S0.2 F6000
+G1 X23.60 S0.1 F6000
+G1 X23.40 S0.0 F6000
+G1 X23.30 S0.1 F6000
+G1 X23.20 S0.0 F6000
+G1 X22.70 S0.1 F6000
+G1 X22.60 S0.0 F6000
+G1 X22.00 S0.1 F6000
+G1 X21.70 S0.2 F6000
+G1 X21.40 S0.4 F6000
+G1 X21.30 S0.3 F6000
+G1 X21.10 S0.5 F6000
+G1 X21.00 S0.4 F6000
+G1 X20.90 S0.6 F6000
+G1 X20.80 S0.5 F6000
+G1 X20.70 S0.6 F6000
+G1 X20.60 S0.7 F6000
+G1 X20.50 S0.6 F6000
+G1 X20.40 S0.8 F6000
+G1 X20.10 S0.9 F6000
+G1 X20.00 S0.8 F6000
+G1 X19.90 S0.9 F6000
+G1 X19.60 S1.0 F6000
+G1 X18.60 S0.9 F6000
+G1 X18.40 S1.0 F6000
+G1 X18.30 S0.8 F6000
+G1 X18.20 S1.0 F6000
+G1 X18.10 S0.9 F6000
+G1 X17.90 S0.7 F6000
+G1 X17.70 S0.8 F6000
+G1 X17.60 S0.6 F6000
+G1 X17.30 S0.5 F6000
+G1 X17.00 S0.4 F6000
+G1 X16.90 S0.5 F6000
+G1 X16.80 S0.4 F6000
+G1 X16.70 S0.2 F6000
+G1 X16.60 S0.4 F6000
+G1 X16.50 S0.2 F6000
+G1 X16.20 S0.1 F6000
+G1 X16.00 S0.0 F6000
+G1 X15.80 S0.1 F6000
+G1 X15.60 S0.0 F6000
+G1 X15.40 S0.1 F6000
+G1 X15.30 S0.0 F6000
+G1 X14.50 S0.1 F6000
+G1 X14.30 S0.2 F6000
+G1 X14.20 S0.3 F6000
+G1 X13.90 S0.4 F6000
+G1 X13.80 S0.3 F6000
+G1 X13.60 S0.5 F6000
+G1 X13.40 S0.4 F6000
+G1 X13.30 S0.5 F6000
+G1 X13.10 S0.6 F6000
+G1 X12.90 S0.7 F6000
+G1 X12.80 S0.8 F6000
+G1 X12.30 S0.9 F6000
+G1 X12.20 S1.0 F6000
+G1 X12.10 S0.9 F6000
+G1 X12.00 S1.0 F6000
+G1 X11.70 S0.9 F6000
+G1 X11.60 S1.0 F6000
+G1 X11.50 S0.9 F6000
+G1 X11.30 S1.0 F6000
+G1 X10.80 S0.9 F6000
+G1 X10.70 S0.8 F6000
+G1 X10.60 S0.9 F6000
+G1 X10.30 S0.8 F6000
+G1 X10.20 S0.6 F6000
+G0 X10.00 Y10.40
+G1 X10.00 S0.7 F6000
+G1 X10.10 S0.8 F6000
+G1 X10.20 S0.7 F6000
+G1 X10.30 S0.9 F6000
+G1 X10.50 S1.0 F6000
+G1 X10.60 S0.9 F6000
+G1 X10.90 S1.0 F6000
+G1 X11.10 S0.9 F6000
+G1 X11.20 S1.0 F6000
+G1 X11.90 S0.9 F6000
+G1 X12.00 S1.0 F6000
+G1 X12.10 S0.9 F6000
+G1 X12.20 S1.0 F6000
+G1 X12.30 S0.8 F6000
+G1 X12.60 S0.7 F6000
+G1 X12.80 S0.8 F6000
+G1 X12.90 S0.6 F6000
+G1 X13.00 S0.7 F6000
+G1 X13.10 S0.6 F6000
+G1 X13.30 S0.5 F6000
+G1 X13.40 S0.4 F6000
+G1 X13.60 S0.3 F6000
+G1 X13.80 S0.2 F6000
+G1 X14.00 S0.1 F6000
+G1 X14.10 S0.2 F6000
+G1 X14.30 S0.1 F6000
+G1 X14.40 S0.0 F6000
+G1 X14.50 S0.1 F6000
+G1 X14.70 S0.0 F6000
+G1 X15.00 S0.1 F6000
+G1 X15.10 S0.0 F6000
+G1 X15.40 S0.1 F6000
+G1 X15.50 S0.0 F6000
+G1 X15.70 S0.1 F6000
+G1 X15.80 S0.0 F6000
+G1 X15.90 S0.1 F6000
+G1 X16.20 S0.2 F6000
+G1 X16.50 S0.3 F6000
+G1 X16.60 S0.4 F6000
+G1 X16.70 S0.3 F6000
+G1 X16.80 S0.4 F6000
+G1 X17.10 S0.6 F6000
+G1 X17.30 S0.5 F6000
+G1 X17.40 S0.7 F6000
+G1 X17.50 S0.8 F6000
+G1 X17.80 S0.9 F6000
+G1 X18.00 S0.8 F6000
+G1 X18.10 S0.9 F6000
+G1 X18.20 S1.0 F6000
+G1 X18.40 S0.9 F6000
+G1 X18.50 S1.0 F6000
+G1 X19.00 S0.9 F6000
+G1 X19.30 S1.0 F6000
+G1 X19.40 S0.9 F6000
+G1 X19.50 S1.0 F6000
+G1 X19.60 S0.9 F6000
+G1 X19.80 S1.0 F6000
+G1 X19.90 S0.8 F6000
+G1 X20.10 S0.7 F6000
+G1 X20.30 S0.6 F6000
+G1 X20.40 S0.7 F6000
+G1 X20.60 S0.5 F6000
+G1 X20.70 S0.6 F6000
+G1 X20.80 S0.5 F6000
+G1 X20.90 S0.4 F6000
+G1 X21.10 S0.3 F6000
+G1 X21.30 S0.2 F6000
+G1 X21.40 S0.3 F6000
+G1 X21.50 S0.2 F6000
+G1 X21.90 S0.1 F6000
+G1 X22.00 S0.0 F6000
+G1 X22.90 S0.1 F6000
+G1 X23.00 S0.0 F6000
+G1 X23.30 S0.1 F6000
+G1 X23.50 S0.0 F6000
+G1 X23.60 S0.1 F6000
+G1 X23.70 S0.2 F6000
+G1 X23.90 S0.3 F6000
+G1 X24.20 S0.4 F6000
+G1 X24.50 S0.5 F6000
+G1 X24.70 S0.7 F6000
+G1 X24.80 S0.6 F6000
+G1 X24.90 S0.7 F6000
+G0 X24.90 Y10.50
+G1 X24.90 S0.8 F6000
+G1 X24.80 S0.7 F6000
+G1 X24.60 S0.5 F6000
+G1 X24.40 S0.6 F6000
+G1 X24.30 S0.4 F6000
+G1 X24.10 S0.5 F6000
+G1 X24.00 S0.4 F6000
+G1 X23.80 S0.2 F6000
+G1 X23.50 S0.1 F6000
+G1 X23.30 S0.2 F6000
+G1 X23.20 S0.0 F6000
+G1 X23.00 S0.1 F6000
+G1 X22.70 S0.0 F6000
+G1 X22.50 S0.1 F6000
+G1 X22.40 S0.0 F6000
+G1 X22.20 S0.1 F6000
+G1 X22.00 S0.0 F6000
+G1 X21.90 S0.1 F6000
+G1 X21.80 S0.0 F6000
+G1 X21.70 S0.1 F6000
+G1 X21.20 S0.3 F6000
+G1 X20.90 S0.4 F6000
+G1 X20.80 S0.3 F6000
+G1 X20.70 S0.5 F6000
+G1 X20.40 S0.7 F6000
+G1 X20.30 S0.6 F6000
+G1 X20.20 S0.7 F6000
+G1 X19.90 S0.9 F6000
+G1 X19.80 S0.8 F6000
+G1 X19.70 S0.9 F6000
+G1 X19.40 S1.0 F6000
+G1 X19.10 S0.9 F6000
+G1 X19.00 S1.0 F6000
+G1 X18.90 S0.9 F6000
+G1 X18.80 S1.0 F6000
+G1 X18.70 S0.9 F6000
+G1 X18.60 S1.0 F6000
+G1 X18.20 S0.9 F6000
+G1 X17.80 S0.8 F6000
+G1 X17.30 S0.7 F6000
+G1 X17.20 S0.5 F6000
+G1 X17.10 S0.6 F6000
+G1 X16.80 S0.5 F6000
+G1 X16.70 S0.4 F6000
+G1 X16.50 S0.3 F6000
+G1 X16.40 S0.4 F6000
+G1 X16.30 S0.2 F6000
+G1 X16.20 S0.3 F6000
+G1 X16.10 S0.2 F6000
+G1 X15.90 S0.1 F6000
+G1 X15.60 S0.2 F6000
+G1 X15.50 S0.1 F6000
+G1 X15.40 S0.0 F6000
+G1 X15.20 S0.1 F6000
+G1 X15.00 S0.0 F6000
+G1 X14.90 S0.1 F6000
+G1 X14.80 S0.0 F6000
+G1 X14.60 S0.1 F6000
+G1 X14.50 S0.0 F6000
+G1 X14.40 S0.2 F6000
+G1 X14.20 S0.1 F6000
+G1 X14.10 S0.2 F6000
+G1 X13.70 S0.3 F6000
+G1 X13.40 S0.4 F6000
+G1 X13.10 S0.5 F6000
+G1 X13.00 S0.6 F6000
+G1 X12.70 S0.7 F6000
+G1 X12.40 S0.8 F6000
+G1 X12.30 S0.9 F6000
+G1 X11.70 S1.0 F6000
+G1 X11.60 S0.9 F6000
+G1 X11.50 S1.0 F6000
+G1 X11.10 S0.9 F6000
+G1 X11.00 S1.0 F6000
+G1 X10.90 S0.9 F6000
+G1 X10.70 S1.0 F6000
+G1 X10.60 S0.9 F6000
+G1 X10.50 S1.0 F6000
+G1 X10.40 S0.9 F6000
+G1 X10.30 S0.8 F6000
+G1 X10.20 S0.7 F6000
+G1 X10.00 S0.8 F6000
+G0 X10.00 Y10.60
+G1 X10.00 S0.9 F6000
+G1 X10.10 S0.8 F6000
+G1 X10.30 S0.9 F6000
+G1 X10.40 S1.0 F6000
+G1 X10.90 S0.9 F6000
+G1 X11.00 S1.0 F6000
+G1 X11.10 S0.9 F6000
+G1 X11.20 S1.0 F6000
+G1 X11.60 S0.9 F6000
+G1 X12.00 S0.8 F6000
+G1 X12.10 S0.9 F6000
+G1 X12.30 S0.7 F6000
+G1 X12.50 S0.8 F6000
+G1 X12.60 S0.7 F6000
+G1 X12.70 S0.6 F6000
+G1 X12.90 S0.5 F6000
+G1 X13.00 S0.6 F6000
+G1 X13.10 S0.5 F6000
+G1 X13.20 S0.4 F6000
+G1 X13.30 S0.3 F6000
+G1 X13.60 S0.2 F6000
+G1 X13.80 S0.1 F6000
+G1 X13.90 S0.2 F6000
+G1 X14.20 S0.1 F6000
+G1 X14.40 S0.0 F6000
+G1 X14.60 S0.1 F6000
+G1 X14.70 S0.0 F6000
+G1 X14.90 S0.1 F6000
+G1 X15.00 S0.0 F6000
+G1 X15.30 S0.1 F6000
+G1 X15.40 S0.0 F6000
+G1 X15.50 S0.1 F6000
+G1 X16.00 S0.3 F6000
+G1 X16.10 S0.2 F6000
+G1 X16.20 S0.3 F6000
+G1 X16.30 S0.4 F6000
+G1 X16.50 S0.5 F6000
+G1 X16.60 S0.4 F6000
+G1 X16.80 S0.5 F6000
+G1 X17.00 S0.7 F6000
+G1 X17.50 S0.9 F6000
+G1 X17.60 S0.8 F6000
+G1 X17.90 S0.9 F6000
+G1 X18.40 S1.0 F6000
+G1 X18.50 S0.9 F6000
+G1 X18.70 S1.0 F6000
+G1 X19.20 S0.9 F6000
+G1 X19.30 S1.0 F6000
+G1 X19.40 S0.8 F6000
+G1 X19.70 S0.9 F6000
+G1 X19.80 S0.8 F6000
+G1 X20.20 S0.7 F6000
+G1 X20.30 S0.6 F6000
+G1 X20.60 S0.4 F6000
+G1 X20.80 S0.3 F6000
+G1 X20.90 S0.2 F6000
+G1 X21.00 S0.3 F6000
+G1 X21.30 S0.2 F6000
+G1 X21.40 S0.1 F6000
+G1 X21.50 S0.2 F6000
+G1 X21.70 S0.1 F6000
+G1 X21.90 S0.0 F6000
+G1 X22.20 S0.1 F6000
+G1 X22.30 S0.0 F6000
+G1 X22.40 S0.1 F6000
+G1 X22.60 S0.0 F6000
+G1 X22.70 S0.1 F6000
+G1 X22.80 S0.0 F6000
+G1 X23.00 S0.1 F6000
+G1 X23.10 S0.2 F6000
+G1 X23.20 S0.1 F6000
+G1 X23.40 S0.3 F6000
+G1 X23.50 S0.2 F6000
+G1 X23.60 S0.3 F6000
+G1 X23.70 S0.2 F6000
+G1 X23.80 S0.3 F6000
+G1 X24.10 S0.4 F6000
+G1 X24.30 S0.5 F6000
+G1 X24.40 S0.6 F6000
+G1 X24.60 S0.7 F6000
+G0 X24.90 Y10.70
+G1 X24.90 S0.9 F6000
+G1 X24.80 S0.8 F6000
+G1 X24.70 S0.6 F6000
+G1 X24.60 S0.7 F6000
+G1 X24.50 S0.6 F6000
+G1 X24.20 S0.5 F6000
+G1 X24.10 S0.4 F6000
+G1 X23.90 S0.5 F6000
+G1 X23.80 S0.3 F6000
+G1 X23.70 S0.4 F6000
+G1 X23.60 S0.3 F6000
+G1 X23.50 S0.2 F6000
+G1 X23.10 S0.1 F6000
+G1 X22.80 S0.0 F6000
+G1 X22.00 S0.1 F6000
+G1 X21.90 S0.0 F6000
+G1 X21.40 S0.2 F6000
+G1 X20.80 S0.3 F6000
+G1 X20.70 S0.4 F6000
+G1 X20.60 S0.3 F6000
+G1 X20.50 S0.4 F6000
+G1 X20.40 S0.5 F6000
+G1 X20.30 S0.6 F6000
+G1 X20.20 S0.5 F6000
+G1 X20.00 S0.7 F6000
+G1 X19.60 S0.8 F6000
+G1 X19.20 S0.9 F6000
+G1 X19.10 S1.0 F6000
+G1 X19.00 S0.9 F6000
+G1 X18.90 S1.0 F6000
+G1 X18.40 S0.9 F6000
+G1 X18.30 S1.0 F6000
+G1 X18.20 S0.9 F6000
+G1 X18.10 S1.0 F6000
+G1 X17.80 S0.9 F6000
+G1 X17.70 S0.8 F6000
+G1 X17.50 S0.9 F6000
+G1 X17.30 S0.8 F6000
+G1 X17.20 S0.7 F6000
+G1 X17.10 S0.8 F6000
+G1 X17.00 S0.7 F6000
+G1 X16.90 S0.6 F6000
+G1 X16.70 S0.5 F6000
+G1 X16.60 S0.4 F6000
+G1 X16.50 S0.5 F6000
+G1 X16.20 S0.3 F6000
+G1 X16.10 S0.4 F6000
+G1 X16.00 S0.3 F6000
+G1 X15.90 S0.2 F6000
+G1 X15.80 S0.3 F6000
+G1 X15.70 S0.1 F6000
+G1 X15.60 S0.0 F6000
+G1 X15.50 S0.2 F6000
+G1 X15.40 S0.0 F6000
+G1 X15.30 S0.1 F6000
+G1 X15.00 S0.0 F6000
+G1 X14.90 S0.1 F6000
+G1 X14.80 S0.0 F6000
+G1 X14.60 S0.1 F6000
+G1 X14.50 S0.0 F6000
+G1 X14.30 S0.1 F6000
+G1 X14.00 S0.2 F6000
+G1 X13.30 S0.3 F6000
+G1 X13.10 S0.4 F6000
+G1 X12.90 S0.6 F6000
+G1 X12.80 S0.4 F6000
+G1 X12.70 S0.6 F6000
+G1 X12.60 S0.5 F6000
+G1 X12.50 S0.6 F6000
+G1 X12.30 S0.8 F6000
+G1 X11.80 S0.9 F6000
+G1 X11.70 S1.0 F6000
+G1 X11.60 S0.9 F6000
+G1 X11.50 S1.0 F6000
+G1 X11.30 S0.9 F6000
+G1 X11.20 S1.0 F6000
+G1 X11.00 S0.9 F6000
+G1 X10.90 S1.0 F6000
+G1 X10.70 S0.9 F6000
+G1 X10.60 S1.0 F6000
+G1 X10.50 S0.9 F6000
+G1 X10.40 S1.0 F6000
+G1 X10.30 S0.9 F6000
+G1 X10.20 S1.0 F6000
+G1 X10.10 S0.9 F6000
+G0 X10.00 Y10.80
+G1 X10.00 S1.0 F6000
+G1 X10.10 S0.9 F6000
+G1 X10.20 S0.8 F6000
+G1 X10.30 S0.9 F6000
+G1 X10.40 S1.0 F6000
+G1 X11.20 S0.9 F6000
+G1 X11.50 S1.0 F6000
+G1 X11.70 S0.9 F6000
+G1 X11.90 S0.7 F6000
+G1 X12.20 S0.6 F6000
+G1 X12.30 S0.7 F6000
+G1 X12.60 S0.5 F6000
+G1 X12.90 S0.4 F6000
+G1 X13.10 S0.3 F6000
+G1 X13.20 S0.4 F6000
+G1 X13.30 S0.3 F6000
+G1 X13.50 S0.2 F6000
+G1 X13.60 S0.1 F6000
+G1 X13.90 S0.0 F6000
+G1 X14.10 S0.1 F6000
+G1 X14.30 S0.0 F6000
+G1 X14.40 S0.1 F6000
+G1 X14.50 S0.0 F6000
+G1 X14.60 S0.1 F6000
+G1 X14.70 S0.0 F6000
+G1 X15.00 S0.1 F6000
+G1 X15.20 S0.0 F6000
+G1 X15.40 S0.2 F6000
+G1 X15.50 S0.1 F6000
+G1 X15.70 S0.2 F6000
+G1 X16.00 S0.3 F6000
+G1 X16.20 S0.5 F6000
+G1 X16.30 S0.4 F6000
+G1 X16.40 S0.5 F6000
+G1 X16.60 S0.6 F6000
+G1 X16.70 S0.7 F6000
+G1 X16.90 S0.6 F6000
+G1 X17.00 S0.7 F6000
+G1 X17.20 S0.8 F6000
+G1 X17.40 S0.9 F6000
+G1 X17.50 S0.8 F6000
+G1 X17.60 S1.0 F6000
+G1 X17.90 S0.9 F6000
+G1 X18.00 S1.0 F6000
+G1 X18.10 S0.9 F6000
+G1 X18.20 S1.0 F6000
+G1 X18.40 S0.9 F6000
+G1 X18.50 S1.0 F6000
+G1 X18.60 S0.9 F6000
+G1 X18.70 S1.0 F6000
+G1 X18.90 S0.9 F6000
+G1 X19.10 S0.8 F6000
+G1 X19.20 S0.9 F6000
+G1 X19.40 S0.8 F6000
+G1 X19.50 S0.7 F6000
+G1 X19.80 S0.6 F6000
+G1 X19.90 S0.7 F6000
+G1 X20.00 S0.6 F6000
+G1 X20.10 S0.5 F6000
+G1 X20.20 S0.4 F6000
+G1 X20.30 S0.6 F6000
+G1 X20.40 S0.3 F6000
+G1 X20.70 S0.4 F6000
+G1 X20.90 S0.3 F6000
+G1 X21.00 S0.1 F6000
+G1 X21.10 S0.2 F6000
+G1 X21.20 S0.0 F6000
+G1 X21.50 S0.1 F6000
+G1 X22.10 S0.0 F6000
+G1 X22.20 S0.1 F6000
+G1 X22.50 S0.0 F6000
+G1 X22.60 S0.1 F6000
+G1 X23.00 S0.2 F6000
+G1 X23.40 S0.3 F6000
+G1 X23.50 S0.2 F6000
+G1 X23.60 S0.4 F6000
+G1 X23.70 S0.3 F6000
+G1 X23.90 S0.4 F6000
+G1 X24.00 S0.5 F6000
+G1 X24.10 S0.6 F6000
+G1 X24.40 S0.7 F6000
+G1 X24.50 S0.8 F6000
+G0 X24.90 Y10.90
+G1 X24.90 S1.0 F6000
+G1 X24.80 S0.8 F6000
+G1 X24.70 S0.9 F6000
+G1 X24.50 S0.7 F6000
+G1 X24.40 S0.6 F6000
+G1 X24.30 S0.7 F6000
+G1 X24.00 S0.6 F6000
+G1 X23.90 S0.5 F6000
+G1 X23.60 S0.4 F6000
+G1 X23.40 S0.3 F6000
+G1 X23.20 S0.2 F6000
+G1 X22.90 S0.1 F6000
+G1 X22.80 S0.2 F6000
+G1 X22.70 S0.1 F6000
+G1 X22.60 S0.0 F6000
+G1 X22.50 S0.1 F6000
+G1 X22.00 S0.0 F6000
+G1 X21.80 S0.1 F6000
+G1 X21.70 S0.0 F6000
+G1 X21.60 S0.1 F6000
+G1 X21.50 S0.0 F6000
+G1 X21.20 S0.1 F6000
+G1 X21.10 S0.2 F6000
+G1 X20.90 S0.3 F6000
+G1 X20.60 S0.4 F6000
+G1 X20.50 S0.3 F6000
+G1 X20.40 S0.4 F6000
+G1 X20.30 S0.5 F6000
+G1 X20.00 S0.6 F6000
+G1 X19.70 S0.7 F6000
+G1 X19.40 S0.8 F6000
+G1 X19.30 S0.7 F6000
+G1 X19.20 S0.8 F6000
+G1 X19.10 S0.9 F6000
+G1 X19.00 S1.0 F6000
+G1 X18.90 S0.9 F6000
+G1 X18.80 S1.0 F6000
+G1 X18.70 S0.9 F6000
+G1 X18.60 S1.0 F6000
+G1 X18.40 S0.9 F6000
+G1 X18.30 S1.0 F6000
+G1 X18.00 S0.9 F6000
+G1 X17.50 S1.0 F6000
+G1 X17.30 S0.8 F6000
+G1 X16.70 S0.6 F6000
+G1 X16.30 S0.5 F6000
+G1 X16.10 S0.3 F6000
+G1 X16.00 S0.4 F6000
+G1 X15.80 S0.2 F6000
+G1 X15.50 S0.1 F6000
+G1 X15.40 S0.2 F6000
+G1 X15.30 S0.0 F6000
+G1 X15.00 S0.1 F6000
+G1 X14.80 S0.0 F6000
+G1 X14.50 S0.1 F6000
+G1 X14.40 S0.0 F6000
+G1 X14.00 S0.1 F6000
+G1 X13.70 S0.0 F6000
+G1 X13.60 S0.2 F6000
+G1 X13.50 S0.1 F6000
+G1 X13.40 S0.2 F6000
+G1 X13.10 S0.3 F6000
+G1 X12.90 S0.4 F6000
+G1 X12.70 S0.5 F6000
+G1 X12.40 S0.6 F6000
+G1 X12.10 S0.8 F6000
+G1 X12.00 S0.7 F6000
+G1 X11.90 S0.8 F6000
+G1 X11.60 S0.9 F6000
+G1 X11.40 S0.8 F6000
+G1 X11.30 S1.0 F6000
+G1 X10.20 S0.9 F6000
+G1 X10.10 S0.8 F6000
+G1 X10.00 S0.9 F6000
+G0 X10.00 Y11.00
+G1 X10.00 S1.0 F6000
+G1 X10.10 S0.9 F6000
+G1 X10.20 S1.0 F6000
+G1 X10.30 S0.9 F6000
+G1 X10.40 S1.0 F6000
+G1 X10.80 S0.9 F6000
+G1 X10.90 S1.0 F6000
+G1 X11.00 S0.9 F6000
+G1 X11.10 S1.0 F6000
+G1 X11.30 S0.9 F6000
+G1 X11.70 S0.7 F6000
+G1 X11.80 S0.8 F6000
+G1 X11.90 S0.7 F6000
+G1 X12.10 S0.6 F6000
+G1 X12.30 S0.5 F6000
+G1 X12.50 S0.6 F6000
+G1 X12.60 S0.4 F6000
+G1 X12.70 S0.3 F6000
+G1 X12.90 S0.4 F6000
+G1 X13.00 S0.3 F6000
+G1 X13.10 S0.2 F6000
+G1 X13.50 S0.1 F6000
+G1 X13.60 S0.2 F6000
+G1 X13.70 S0.1 F6000
+G1 X13.80 S0.0 F6000
+G1 X14.20 S0.1 F6000
+G1 X14.30 S0.0 F6000
+G1 X14.40 S0.1 F6000
+G1 X14.50 S0.0 F6000
+G1 X14.60 S0.1 F6000
+G1 X14.70 S0.0 F6000
+G1 X14.90 S0.1 F6000
+G1 X15.00 S0.2 F6000
+G1 X15.10 S0.1 F6000
+G1 X15.20 S0.2 F6000
+G1 X15.30 S0.1 F6000
+G1 X15.50 S0.3 F6000
+G1 X15.70 S0.2 F6000
+G1 X15.80 S0.3 F6000
+G1 X16.00 S0.4 F6000
+G1 X16.10 S0.5 F6000
+G1 X16.20 S0.4 F6000
+G1 X16.40 S0.5 F6000
+G1 X16.50 S0.7 F6000
+G1 X16.70 S0.8 F6000
+G1 X16.90 S0.9 F6000
+G1 X17.00 S0.8 F6000
+G1 X17.10 S0.7 F6000
+G1 X17.20 S0.8 F6000
+G1 X17.30 S0.9 F6000
+G1 X17.40 S0.8 F6000
+G1 X17.50 S0.9 F6000
+G1 X17.70 S1.0 F6000
+G1 X18.20 S0.9 F6000
+G1 X18.30 S1.0 F6000
+G1 X18.40 S0.9 F6000
+G1 X18.50 S1.0 F6000
+G1 X18.70 S0.9 F6000
+G1 X18.80 S1.0 F6000
+G1 X19.00 S0.9 F6000
+G1 X19.10 S0.8 F6000
+G1 X19.20 S0.7 F6000
+G1 X19.30 S0.8 F6000
+G1 X19.40 S0.7 F6000
+G1 X19.50 S0.6 F6000
+G1 X19.60 S0.7 F6000
+G1 X19.90 S0.5 F6000
+G1 X20.00 S0.4 F6000
+G1 X20.30 S0.3 F6000
+G1 X20.40 S0.4 F6000
+G1 X20.50 S0.3 F6000
+G1 X20.60 S0.2 F6000
+G1 X20.70 S0.1 F6000
+G1 X20.90 S0.2 F6000
+G1 X21.00 S0.1 F6000
+G1 X21.10 S0.2 F6000
+G1 X21.20 S0.0 F6000
+G1 X21.40 S0.1 F6000
+G1 X21.50 S0.0 F6000
+G1 X21.90 S0.1 F6000
+G1 X22.10 S0.0 F6000
+G1 X22.50 S0.1 F6000
+G1 X22.80 S0.2 F6000
+G1 X23.00 S0.1 F6000
+G1 X23.10 S0.2 F6000
+G1 X23.20 S0.3 F6000
+G1 X23.40 S0.4 F6000
+G1 X23.90 S0.5 F6000
+G1 X24.00 S0.6 F6000
+G1 X24.10 S0.7 F6000
+G1 X24.30 S0.6 F6000
+G1 X24.40 S0.8 F6000
+G1 X24.60 S0.9 F6000
+G1 X24.80 S1.0 F6000
+G0 X24.90 Y11.10
+G1 X24.90 S1.0 F6000
+G1 X24.80 S0.9 F6000
+G1 X24.30 S0.7 F6000
+G1 X24.20 S0.8 F6000
+G1 X24.10 S0.6 F6000
+G1 X24.00 S0.7 F6000
+G1 X23.90 S0.5 F6000
+G1 X23.80 S0.6 F6000
+G1 X23.50 S0.5 F6000
+G1 X23.30 S0.3 F6000
+G1 X23.20 S0.2 F6000
+G1 X23.10 S0.3 F6000
+G1 X23.00 S0.2 F6000
+G1 X22.50 S0.1 F6000
+G1 X22.10 S0.0 F6000
+G1 X21.90 S0.1 F6000
+G1 X21.80 S0.0 F6000
+G1 X21.70 S0.1 F6000
+G1 X21.60 S0.0 F6000
+G1 X21.40 S0.1 F6000
+G1 X21.30 S0.0 F6000
+G1 X20.90 S0.1 F6000
+G1 X20.70 S0.2 F6000
+G1 X20.60 S0.1 F6000
+G1 X20.50 S0.2 F6000
+G1 X20.40 S0.3 F6000
+G1 X20.30 S0.4 F6000
+G1 X19.80 S0.5 F6000
+G1 X19.60 S0.6 F6000
+G1 X19.40 S0.7 F6000
+G1 X19.00 S0.9 F6000
+G1 X18.70 S1.0 F6000
+G1 X18.60 S0.8 F6000
+G1 X18.50 S1.0 F6000
+G1 X18.40 S0.9 F6000
+G1 X18.20 S1.0 F6000
+G1 X18.10 S0.9 F6000
+G1 X18.00 S1.0 F6000
+G1 X17.80 S0.9 F6000
+G1 X17.70 S1.0 F6000
+G1 X17.60 S0.9 F6000
+G1 X17.50 S1.0 F6000
+G1 X17.10 S0.8 F6000
+G1 X17.00 S0.9 F6000
+G1 X16.90 S0.7 F6000
+G1 X16.70 S0.8 F6000
+G1 X16.60 S0.7 F6000
+G1 X16.40 S0.5 F6000
+G1 X16.30 S0.6 F6000
+G1 X16.10 S0.5 F6000
+G1 X15.80 S0.3 F6000
+G1 X15.20 S0.2 F6000
+G1 X15.10 S0.1 F6000
+G1 X15.00 S0.2 F6000
+G1 X14.90 S0.1 F6000
+G1 X14.40 S0.0 F6000
+G1 X14.30 S0.1 F6000
+G1 X14.20 S0.0 F6000
+G1 X14.00 S0.1 F6000
+G1 X13.90 S0.0 F6000
+G1 X13.70 S0.1 F6000
+G1 X13.60 S0.0 F6000
+G1 X13.30 S0.1 F6000
+G1 X13.10 S0.3 F6000
+G1 X13.00 S0.2 F6000
+G1 X12.80 S0.4 F6000
+G1 X12.70 S0.2 F6000
+G1 X12.60 S0.4 F6000
+G1 X12.50 S0.3 F6000
+G1 X12.40 S0.5 F6000
+G1 X12.00 S0.6 F6000
+G1 X11.90 S0.7 F6000
+G1 X11.80 S0.6 F6000
+G1 X11.60 S0.7 F6000
+G1 X11.40 S0.9 F6000
+G1 X10.90 S1.0 F6000
+G1 X10.80 S0.9 F6000
+G1 X10.70 S1.0 F6000
+G1 X10.50 S0.9 F6000
+G1 X10.40 S1.0 F6000
+G0 X10.00 Y11.20
+G1 X10.00 S1.0 F6000
+G1 X10.10 S0.9 F6000
+G1 X10.20 S1.0 F6000
+G1 X10.30 S0.9 F6000
+G1 X10.40 S1.0 F6000
+G1 X10.80 S0.9 F6000
+G1 X11.20 S0.8 F6000
+G1 X11.30 S0.9 F6000
+G1 X11.50 S0.8 F6000
+G1 X11.60 S0.7 F6000
+G1 X11.70 S0.6 F6000
+G1 X11.90 S0.7 F6000
+G1 X12.00 S0.5 F6000
+G1 X12.30 S0.4 F6000
+G1 X12.50 S0.3 F6000
+G1 X12.60 S0.4 F6000
+G1 X12.80 S0.2 F6000
+G1 X12.90 S0.1 F6000
+G1 X13.10 S0.2 F6000
+G1 X13.20 S0.1 F6000
+G1 X13.30 S0.0 F6000
+G1 X13.50 S0.1 F6000
+G1 X13.60 S0.0 F6000
+G1 X13.70 S0.1 F6000
+G1 X13.80 S0.0 F6000
+G1 X14.60 S0.1 F6000
+G1 X14.70 S0.2 F6000
+G1 X14.80 S0.0 F6000
+G1 X14.90 S0.2 F6000
+G1 X15.00 S0.1 F6000
+G1 X15.30 S0.2 F6000
+G1 X15.50 S0.3 F6000
+G1 X15.60 S0.4 F6000
+G1 X15.70 S0.3 F6000
+G1 X15.80 S0.5 F6000
+G1 X16.00 S0.6 F6000
+G1 X16.10 S0.5 F6000
+G1 X16.20 S0.7 F6000
+G1 X16.60 S0.9 F6000
+G1 X16.70 S0.8 F6000
+G1 X16.80 S0.7 F6000
+G1 X16.90 S0.9 F6000
+G1 X17.00 S0.8 F6000
+G1 X17.10 S1.0 F6000
+G1 X17.20 S0.9 F6000
+G1 X17.40 S1.0 F6000
+G1 X18.10 S0.9 F6000
+G1 X18.20 S1.0 F6000
+G1 X18.30 S0.9 F6000
+G1 X18.40 S1.0 F6000
+G1 X18.50 S0.9 F6000
+G1 X18.60 S0.8 F6000
+G1 X18.80 S0.9 F6000
+G1 X18.90 S0.7 F6000
+G1 X19.00 S0.8 F6000
+G1 X19.10 S0.7 F6000
+G1 X19.20 S0.8 F6000
+G1 X19.30 S0.6 F6000
+G1 X19.60 S0.5 F6000
+G1 X19.70 S0.6 F6000
+G1 X19.80 S0.4 F6000
+G1 X20.00 S0.3 F6000
+G1 X20.20 S0.2 F6000
+G1 X20.30 S0.3 F6000
+G1 X20.60 S0.2 F6000
+G1 X20.70 S0.1 F6000
+G1 X20.90 S0.2 F6000
+G1 X21.00 S0.1 F6000
+G1 X21.10 S0.0 F6000
+G1 X21.30 S0.1 F6000
+G1 X21.50 S0.0 F6000
+G1 X22.30 S0.1 F6000
+G1 X22.50 S0.2 F6000
+G1 X22.60 S0.3 F6000
+G1 X23.10 S0.4 F6000
+G1 X23.40 S0.5 F6000
+G1 X23.50 S0.4 F6000
+G1 X23.60 S0.6 F6000
+G1 X23.70 S0.7 F6000
+G1 X23.80 S0.6 F6000
+G1 X23.90 S0.7 F6000
+G1 X24.10 S0.8 F6000
+G1 X24.20 S0.7 F6000
+G1 X24.40 S0.8 F6000
+G1 X24.50 S0.9 F6000
+G1 X24.60 S1.0 F6000
+G1 X24.70 S0.9 F6000
+G1 X24.80 S1.0 F6000
+G1 X24.90 S0.9 F6000
+G0 X24.90 Y11.30
+G1 X24.90 S1.0 F6000
+G1 X24.60 S0.9 F6000
+G1 X24.30 S0.8 F6000
+G1 X24.20 S0.7 F6000
+G1 X24.10 S0.8 F6000
+G1 X23.90 S0.7 F6000
+G1 X23.60 S0.6 F6000
+G1 X23.40 S0.5 F6000
+G1 X23.30 S0.6 F6000
+G1 X23.20 S0.4 F6000
+G1 X22.90 S0.3 F6000
+G1 X22.70 S0.2 F6000
+G1 X22.60 S0.1 F6000
+G1 X22.50 S0.2 F6000
+G1 X22.30 S0.1 F6000
+G1 X22.20 S0.0 F6000
+G1 X22.10 S0.2 F6000
+G1 X22.00 S0.1 F6000
+G1 X21.80 S0.0 F6000
+G1 X21.40 S0.1 F6000
+G1 X21.30 S0.0 F6000
+G1 X20.80 S0.1 F6000
+G1 X20.70 S0.2 F6000
+G1 X20.50 S0.1 F6000
+G1 X20.30 S0.2 F6000
+G1 X20.20 S0.3 F6000
+G1 X20.00 S0.4 F6000
+G1 X19.90 S0.3 F6000
+G1 X19.70 S0.5 F6000
+G1 X19.50 S0.6 F6000
+G1 X19.30 S0.7 F6000
+G1 X19.00 S0.8 F6000
+G1 X18.90 S0.9 F6000
+G1 X18.60 S0.8 F6000
+G1 X18.40 S0.9 F6000
+G1 X18.20 S1.0 F6000
+G1 X17.70 S0.9 F6000
+G1 X17.60 S1.0 F6000
+G1 X17.40 S0.9 F6000
+G1 X17.30 S1.0 F6000
+G1 X17.20 S0.9 F6000
+G1 X17.10 S1.0 F6000
+G1 X17.00 S0.9 F6000
+G1 X16.90 S1.0 F6000
+G1 X16.80 S0.9 F6000
+G1 X16.60 S0.7 F6000
+G1 X16.50 S0.8 F6000
+G1 X16.30 S0.6 F6000
+G1 X16.20 S0.7 F6000
+G1 X16.10 S0.6 F6000
+G1 X16.00 S0.7 F6000
+G1 X15.90 S0.6 F6000
+G1 X15.70 S0.5 F6000
+G1 X15.60 S0.4 F6000
+G1 X15.40 S0.2 F6000
+G1 X15.20 S0.3 F6000
+G1 X15.00 S0.1 F6000
+G1 X14.80 S0.0 F6000
+G1 X14.70 S0.1 F6000
+G1 X14.10 S0.0 F6000
+G1 X14.00 S0.1 F6000
+G1 X13.90 S0.0 F6000
+G1 X13.80 S0.1 F6000
+G1 X13.70 S0.0 F6000
+G1 X13.30 S0.1 F6000
+G1 X13.00 S0.2 F6000
+G1 X12.80 S0.1 F6000
+G1 X12.70 S0.3 F6000
+G1 X12.20 S0.4 F6000
+G1 X12.10 S0.5 F6000
+G1 X11.90 S0.6 F6000
+G1 X11.60 S0.7 F6000
+G1 X11.20 S0.8 F6000
+G1 X11.10 S0.9 F6000
+G1 X10.90 S1.0 F6000
+G1 X10.80 S0.9 F6000
+G1 X10.70 S1.0 F6000
+G1 X10.40 S0.9 F6000
+G1 X10.30 S1.0 F6000
+G0 X10.00 Y11.40
+G1 X10.00 S0.9 F6000
+G1 X10.10 S1.0 F6000
+G1 X10.40 S0.9 F6000
+G1 X10.50 S1.0 F6000
+G1 X10.60 S0.9 F6000
+G1 X11.00 S0.8 F6000
+G1 X11.10 S0.9 F6000
+G1 X11.20 S0.8 F6000
+G1 X11.40 S0.6 F6000
+G1 X11.50 S0.7 F6000
+G1 X11.70 S0.6 F6000
+G1 X11.90 S0.5 F6000
+G1 X12.00 S0.4 F6000
+G1 X12.10 S0.5 F6000
+G1 X12.30 S0.4 F6000
+G1 X12.40 S0.2 F6000
+G1 X12.50 S0.3 F6000
+G1 X12.60 S0.2 F6000
+G1 X12.70 S0.1 F6000
+G1 X12.80 S0.2 F6000
+G1 X13.00 S0.1 F6000
+G1 X13.10 S0.0 F6000
+G1 X13.20 S0.1 F6000
+G1 X13.30 S0.0 F6000
+G1 X13.60 S0.1 F6000
+G1 X13.80 S0.0 F6000
+G1 X13.90 S0.1 F6000
+G1 X14.20 S0.0 F6000
+G1 X14.30 S0.1 F6000
+G1 X14.60 S0.2 F6000
+G1 X14.70 S0.0 F6000
+G1 X14.80 S0.1 F6000
+G1 X14.90 S0.2 F6000
+G1 X15.10 S0.4 F6000
+G1 X15.50 S0.5 F6000
+G1 X15.80 S0.6 F6000
+G1 X15.90 S0.7 F6000
+G1 X16.00 S0.6 F6000
+G1 X16.10 S0.7 F6000
+G1 X16.30 S0.8 F6000
+G1 X16.50 S0.7 F6000
+G1 X16.60 S0.8 F6000
+G1 X16.70 S0.9 F6000
+G1 X16.90 S0.8 F6000
+G1 X17.00 S1.0 F6000
+G1 X17.10 S0.9 F6000
+G1 X17.30 S1.0 F6000
+G1 X17.60 S0.9 F6000
+G1 X17.80 S1.0 F6000
+G1 X18.00 S0.9 F6000
+G1 X18.10 S1.0 F6000
+G1 X18.20 S0.8 F6000
+G1 X18.30 S0.9 F6000
+G1 X18.50 S0.8 F6000
+G1 X18.80 S0.7 F6000
+G1 X19.00 S0.6 F6000
+G1 X19.10 S0.7 F6000
+G1 X19.20 S0.5 F6000
+G1 X19.40 S0.6 F6000
+G1 X19.50 S0.5 F6000
+G1 X19.60 S0.4 F6000
+G1 X19.70 S0.5 F6000
+G1 X19.80 S0.3 F6000
+G1 X20.00 S0.2 F6000
+G1 X20.20 S0.3 F6000
+G1 X20.30 S0.2 F6000
+G1 X20.40 S0.1 F6000
+G1 X20.50 S0.2 F6000
+G1 X20.60 S0.0 F6000
+G1 X21.00 S0.1 F6000
+G1 X21.10 S0.0 F6000
+G1 X21.60 S0.1 F6000
+G1 X21.70 S0.0 F6000
+G1 X21.80 S0.1 F6000
+G1 X22.00 S0.0 F6000
+G1 X22.10 S0.1 F6000
+G1 X22.40 S0.2 F6000
+G1 X22.60 S0.3 F6000
+G1 X22.90 S0.4 F6000
+G1 X23.00 S0.3 F6000
+G1 X23.10 S0.4 F6000
+G1 X23.20 S0.5 F6000
+G1 X23.30 S0.6 F6000
+G1 X23.40 S0.5 F6000
+G1 X23.50 S0.7 F6000
+G1 X23.70 S0.8 F6000
+G1 X23.90 S0.7 F6000
+G1 X24.00 S0.9 F6000
+G1 X24.10 S0.8 F6000
+G1 X24.20 S0.9 F6000
+G1 X24.30 S1.0 F6000
+G1 X24.40 S0.9 F6000
+G1 X24.50 S1.0 F6000
+G1 X24.60 S0.9 F6000
+G1 X24.70 S1.0 F6000
+G1 X24.80 S0.9 F6000
+G1 X24.90 S1.0 F6000
+G0 X24.90 Y11.50
+G1 X24.90 S1.0 F6000
+G1 X24.70 S0.9 F6000
+G1 X24.50 S1.0 F6000
+G1 X24.40 S0.9 F6000
+G1 X24.20 S0.8 F6000
+G1 X24.10 S1.0 F6000
+G1 X24.00 S0.9 F6000
+G1 X23.90 S0.8 F6000
+G1 X23.80 S0.9 F6000
+G1 X23.70 S0.8 F6000
+G1 X23.60 S0.7 F6000
+G1 X23.50 S0.6 F6000
+G1 X23.40 S0.7 F6000
+G1 X23.30 S0.6 F6000
+G1 X23.20 S0.5 F6000
+G1 X23.10 S0.4 F6000
+G1 X22.90 S0.5 F6000
+G1 X22.80 S0.4 F6000
+G1 X22.60 S0.3 F6000
+G1 X22.50 S0.2 F6000
+G1 X22.40 S0.3 F6000
+G1 X22.30 S0.2 F6000
+G1 X22.20 S0.3 F6000
+G1 X22.10 S0.2 F6000
+G1 X22.00 S0.1 F6000
+G1 X21.90 S0.2 F6000
+G1 X21.70 S0.1 F6000
+G1 X21.50 S0.0 F6000
+G1 X21.10 S0.1 F6000
+G1 X21.00 S0.0 F6000
+G1 X20.70 S0.1 F6000
+G1 X20.40 S0.0 F6000
+G1 X20.30 S0.2 F6000
+G1 X19.80 S0.3 F6000
+G1 X19.70 S0.4 F6000
+G1 X19.60 S0.5 F6000
+G1 X19.50 S0.4 F6000
+G1 X19.40 S0.6 F6000
+G1 X19.30 S0.5 F6000
+G1 X19.10 S0.7 F6000
+G1 X19.00 S0.6 F6000
+G1 X18.90 S0.7 F6000
+G1 X18.80 S0.8 F6000
+G1 X18.60 S0.9 F6000
+G1 X18.50 S0.8 F6000
+G1 X18.40 S0.9 F6000
+G1 X18.20 S0.8 F6000
+G1 X18.10 S1.0 F6000
+G1 X17.60 S0.9 F6000
+G1 X17.50 S1.0 F6000
+G1 X17.30 S0.9 F6000
+G1 X17.20 S1.0 F6000
+G1 X17.10 S0.9 F6000
+G1 X16.40 S0.8 F6000
+G1 X16.30 S0.7 F6000
+G1 X16.20 S0.8 F6000
+G1 X16.00 S0.6 F6000
+G1 X15.90 S0.7 F6000
+G1 X15.80 S0.6 F6000
+G1 X15.70 S0.5 F6000
+G1 X15.40 S0.4 F6000
+G1 X15.30 S0.3 F6000
+G1 X15.20 S0.4 F6000
+G1 X15.10 S0.2 F6000
+G1 X15.00 S0.3 F6000
+G1 X14.80 S0.2 F6000
+G1 X14.60 S0.1 F6000
+G1 X14.20 S0.0 F6000
+G1 X14.10 S0.1 F6000
+G1 X13.90 S0.0 F6000
+G1 X13.80 S0.1 F6000
+G1 X13.70 S0.0 F6000
+G1 X13.60 S0.1 F6000
+G1 X13.50 S0.0 F6000
+G1 X13.40 S0.1 F6000
+G1 X13.20 S0.0 F6000
+G1 X13.10 S0.1 F6000
+G1 X12.70 S0.2 F6000
+G1 X12.60 S0.3 F6000
+G1 X12.50 S0.2 F6000
+G1 X12.40 S0.3 F6000
+G1 X12.10 S0.4 F6000
+G1 X11.90 S0.5 F6000
+G1 X11.60 S0.6 F6000
+G1 X11.50 S0.7 F6000
+G1 X11.30 S0.6 F6000
+G1 X11.20 S0.8 F6000
+G1 X11.10 S0.7 F6000
+G1 X11.00 S0.8 F6000
+G1 X10.90 S0.9 F6000
+G1 X10.60 S0.8 F6000
+G1 X10.50 S0.9 F6000
+G1 X10.30 S1.0 F6000
+G1 X10.20 S0.9 F6000
+G1 X10.00 S1.0 F6000
+G0 X10.00 Y11.60
+G1 X10.00 S1.0 F6000
+G1 X10.40 S0.9 F6000
+G1 X10.50 S0.8 F6000
+G1 X10.60 S0.9 F6000
+G1 X10.70 S0.8 F6000
+G1 X10.80 S0.9 F6000
+G1 X10.90 S0.8 F6000
+G1 X11.10 S0.7 F6000
+G1 X11.20 S0.8 F6000
+G1 X11.30 S0.6 F6000
+G1 X11.50 S0.5 F6000
+G1 X12.00 S0.4 F6000
+G1 X12.10 S0.3 F6000
+G1 X12.30 S0.2 F6000
+G1 X12.80 S0.1 F6000
+G1 X13.10 S0.0 F6000
+G1 X13.20 S0.1 F6000
+G1 X13.40 S0.0 F6000
+G1 X13.70 S0.1 F6000
+G1 X13.80 S0.0 F6000
+G1 X14.00 S0.1 F6000
+G1 X14.30 S0.0 F6000
+G1 X14.50 S0.1 F6000
+G1 X14.60 S0.3 F6000
+G1 X14.70 S0.1 F6000
+G1 X14.80 S0.3 F6000
+G1 X14.90 S0.2 F6000
+G1 X15.00 S0.4 F6000
+G1 X15.10 S0.3 F6000
+G1 X15.20 S0.5 F6000
+G1 X15.60 S0.6 F6000
+G1 X15.80 S0.8 F6000
+G1 X15.90 S0.7 F6000
+G1 X16.00 S0.8 F6000
+G1 X16.10 S0.7 F6000
+G1 X16.20 S0.8 F6000
+G1 X16.30 S0.9 F6000
+G1 X16.50 S1.0 F6000
+G1 X16.80 S0.9 F6000
+G1 X17.10 S1.0 F6000
+G1 X17.20 S0.9 F6000
+G1 X17.30 S1.0 F6000
+G1 X17.40 S0.9 F6000
+G1 X17.70 S1.0 F6000
+G1 X17.80 S0.9 F6000
+G1 X18.00 S1.0 F6000
+G1 X18.10 S0.8 F6000
+G1 X18.20 S0.9 F6000
+G1 X18.30 S0.8 F6000
+G1 X18.60 S0.7 F6000
+G1 X18.70 S0.6 F6000
+G1 X18.80 S0.7 F6000
+G1 X18.90 S0.6 F6000
+G1 X19.00 S0.5 F6000
+G1 X19.20 S0.6 F6000
+G1 X19.30 S0.4 F6000
+G1 X19.50 S0.3 F6000
+G1 X19.70 S0.4 F6000
+G1 X19.80 S0.3 F6000
+G1 X19.90 S0.2 F6000
+G1 X20.00 S0.1 F6000
+G1 X20.30 S0.2 F6000
+G1 X20.50 S0.1 F6000
+G1 X20.60 S0.0 F6000
+G1 X20.70 S0.1 F6000
+G1 X20.80 S0.0 F6000
+G1 X21.30 S0.1 F6000
+G1 X21.40 S0.0 F6000
+G1 X21.50 S0.1 F6000
+G1 X21.60 S0.0 F6000
+G1 X21.80 S0.1 F6000
+G1 X21.90 S0.0 F6000
+G1 X22.00 S0.1 F6000
+G1 X22.10 S0.2 F6000
+G1 X22.30 S0.3 F6000
+G1 X22.40 S0.2 F6000
+G1 X22.50 S0.4 F6000
+G1 X23.10 S0.6 F6000
+G1 X23.30 S0.7 F6000
+G1 X23.40 S0.6 F6000
+G1 X23.60 S0.7 F6000
+G1 X23.70 S0.8 F6000
+G1 X23.80 S0.9 F6000
+G1 X24.00 S0.8 F6000
+G1 X24.20 S1.0 F6000
+G1 X24.30 S0.9 F6000
+G1 X24.40 S1.0 F6000
+G0 X24.90 Y11.70
+G1 X24.90 S0.9 F6000
+G1 X24.80 S1.0 F6000
+G1 X24.50 S0.9 F6000
+G1 X24.00 S1.0 F6000
+G1 X23.90 S0.9 F6000
+G1 X23.70 S0.8 F6000
+G1 X23.50 S0.7 F6000
+G1 X23.40 S0.8 F6000
+G1 X23.30 S0.7 F6000
+G1 X23.20 S0.6 F6000
+G1 X23.10 S0.7 F6000
+G1 X23.00 S0.5 F6000
+G1 X22.90 S0.6 F6000
+G1 X22.80 S0.5 F6000
+G1 X22.60 S0.4 F6000
+G1 X22.50 S0.3 F6000
+G1 X22.30 S0.2 F6000
+G1 X22.20 S0.3 F6000
+G1 X22.10 S0.1 F6000
+G1 X22.00 S0.2 F6000
+G1 X21.80 S0.1 F6000
+G1 X21.50 S0.0 F6000
+G1 X21.40 S0.1 F6000
+G1 X21.20 S0.0 F6000
+G1 X21.10 S0.1 F6000
+G1 X21.00 S0.0 F6000
+G1 X20.90 S0.1 F6000
+G1 X20.80 S0.0 F6000
+G1 X20.40 S0.1 F6000
+G1 X20.30 S0.0 F6000
+G1 X20.20 S0.1 F6000
+G1 X20.10 S0.2 F6000
+G1 X19.50 S0.3 F6000
+G1 X19.30 S0.4 F6000
+G1 X19.00 S0.5 F6000
+G1 X18.90 S0.6 F6000
+G1 X18.80 S0.7 F6000
+G1 X18.60 S0.6 F6000
+G1 X18.50 S0.8 F6000
+G1 X18.40 S0.7 F6000
+G1 X18.20 S0.8 F6000
+G1 X18.10 S1.0 F6000
+G1 X18.00 S0.9 F6000
+G1 X17.80 S0.8 F6000
+G1 X17.70 S0.9 F6000
+G1 X17.60 S1.0 F6000
+G1 X17.50 S0.9 F6000
+G1 X17.40 S1.0 F6000
+G1 X17.30 S0.9 F6000
+G1 X17.00 S1.0 F6000
+G1 X16.60 S0.9 F6000
+G1 X16.50 S1.0 F6000
+G1 X16.40 S0.8 F6000
+G1 X16.20 S0.9 F6000
+G1 X16.10 S0.8 F6000
+G1 X16.00 S0.9 F6000
+G1 X15.90 S0.7 F6000
+G1 X15.80 S0.6 F6000
+G1 X15.70 S0.7 F6000
+G1 X15.50 S0.5 F6000
+G1 X15.10 S0.3 F6000
+G1 X15.00 S0.4 F6000
+G1 X14.90 S0.3 F6000
+G1 X14.70 S0.4 F6000
+G1 X14.60 S0.3 F6000
+G1 X14.50 S0.1 F6000
+G1 X14.20 S0.2 F6000
+G1 X14.10 S0.1 F6000
+G1 X14.00 S0.0 F6000
+G1 X13.90 S0.1 F6000
+G1 X13.60 S0.0 F6000
+G1 X13.50 S0.1 F6000
+G1 X13.30 S0.0 F6000
+G1 X13.10 S0.1 F6000
+G1 X12.70 S0.0 F6000
+G1 X12.60 S0.1 F6000
+G1 X12.50 S0.2 F6000
+G1 X12.20 S0.3 F6000
+G1 X12.10 S0.2 F6000
+G1 X11.90 S0.3 F6000
+G1 X11.70 S0.4 F6000
+G1 X11.60 S0.5 F6000
+G1 X11.50 S0.4 F6000
+G1 X11.40 S0.5 F6000
+G1 X11.30 S0.6 F6000
+G1 X11.20 S0.7 F6000
+G1 X10.60 S0.9 F6000
+G1 X10.50 S0.8 F6000
+G1 X10.20 S0.9 F6000
+G1 X10.10 S1.0 F6000
+G0 X10.00 Y11.80
+G1 X10.00 S1.0 F6000
+G1 X10.20 S0.9 F6000
+G1 X10.60 S0.8 F6000
+G1 X10.70 S0.7 F6000
+G1 X11.10 S0.6 F6000
+G1 X11.40 S0.5 F6000
+G1 X11.50 S0.4 F6000
+G1 X11.60 S0.5 F6000
+G1 X11.70 S0.3 F6000
+G1 X11.80 S0.4 F6000
+G1 X11.90 S0.3 F6000
+G1 X12.00 S0.2 F6000
+G1 X12.20 S0.1 F6000
+G1 X12.40 S0.0 F6000
+G1 X12.50 S0.1 F6000
+G1 X12.60 S0.0 F6000
+G1 X12.70 S0.1 F6000
+G1 X12.80 S0.0 F6000
+G1 X12.90 S0.1 F6000
+G1 X13.10 S0.0 F6000
+G1 X13.20 S0.1 F6000
+G1 X13.30 S0.0 F6000
+G1 X13.40 S0.1 F6000
+G1 X13.50 S0.0 F6000
+G1 X13.60 S0.1 F6000
+G1 X13.90 S0.2 F6000
+G1 X14.00 S0.0 F6000
+G1 X14.10 S0.2 F6000
+G1 X14.20 S0.1 F6000
+G1 X14.30 S0.2 F6000
+G1 X14.60 S0.3 F6000
+G1 X14.90 S0.4 F6000
+G1 X15.10 S0.6 F6000
+G1 X15.20 S0.4 F6000
+G1 X15.30 S0.6 F6000
+G1 X15.40 S0.7 F6000
+G1 X15.70 S0.8 F6000
+G1 X15.90 S0.9 F6000
+G1 X16.20 S1.0 F6000
+G1 X16.30 S0.9 F6000
+G1 X16.60 S1.0 F6000
+G1 X17.20 S0.9 F6000
+G1 X17.40 S1.0 F6000
+G1 X17.60 S0.8 F6000
+G1 X17.70 S0.9 F6000
+G1 X17.80 S0.8 F6000
+G1 X18.00 S0.9 F6000
+G1 X18.10 S0.7 F6000
+G1 X18.40 S0.8 F6000
+G1 X18.50 S0.7 F6000
+G1 X18.60 S0.6 F6000
+G1 X18.90 S0.5 F6000
+G1 X19.10 S0.4 F6000
+G1 X19.20 S0.3 F6000
+G1 X19.30 S0.4 F6000
+G1 X19.40 S0.2 F6000
+G1 X19.50 S0.3 F6000
+G1 X19.70 S0.2 F6000
+G1 X19.80 S0.1 F6000
+G1 X19.90 S0.0 F6000
+G1 X20.00 S0.1 F6000
+G1 X20.10 S0.0 F6000
+G1 X20.20 S0.1 F6000
+G1 X20.30 S0.0 F6000
+G1 X20.80 S0.1 F6000
+G1 X20.90 S0.0 F6000
+G1 X21.50 S0.1 F6000
+G1 X21.60 S0.2 F6000
+G1 X21.70 S0.1 F6000
+G1 X21.80 S0.2 F6000
+G1 X22.10 S0.3 F6000
+G1 X22.20 S0.2 F6000
+G1 X22.30 S0.3 F6000
+G1 X22.60 S0.5 F6000
+G1 X23.00 S0.6 F6000
+G1 X23.10 S0.8 F6000
+G1 X23.30 S0.7 F6000
+G1 X23.50 S0.8 F6000
+G1 X23.60 S0.9 F6000
+G1 X23.70 S0.8 F6000
+G1 X23.80 S1.0 F6000
+G1 X23.90 S0.9 F6000
+G1 X24.30 S1.0 F6000
+G1 X24.80 S0.9 F6000
+G0 X24.90 Y11.90
+G1 X24.90 S1.0 F6000
+G1 X24.80 S0.9 F6000
+G1 X24.70 S1.0 F6000
+G1 X23.90 S0.9 F6000
+G1 X23.60 S0.8 F6000
+G1 X23.50 S0.9 F6000
+G1 X23.40 S0.8 F6000
+G1 X23.10 S0.7 F6000
+G1 X22.80 S0.6 F6000
+G1 X22.60 S0.4 F6000
+G1 X22.40 S0.5 F6000
+G1 X22.30 S0.4 F6000
+G1 X22.00 S0.3 F6000
+G1 X21.70 S0.1 F6000
+G1 X21.60 S0.2 F6000
+G1 X21.50 S0.0 F6000
+G1 X21.40 S0.1 F6000
+G1 X21.00 S0.0 F6000
+G1 X20.90 S0.1 F6000
+G1 X20.80 S0.0 F6000
+G1 X20.40 S0.1 F6000
+G1 X20.30 S0.0 F6000
+G1 X20.20 S0.1 F6000
+G1 X20.10 S0.0 F6000
+G1 X20.00 S0.1 F6000
+G1 X19.90 S0.2 F6000
+G1 X19.80 S0.0 F6000
+G1 X19.70 S0.2 F6000
+G1 X19.30 S0.3 F6000
+G1 X19.20 S0.4 F6000
+G1 X19.00 S0.3 F6000
+G1 X18.90 S0.5 F6000
+G1 X18.80 S0.4 F6000
+G1 X18.70 S0.5 F6000
+G1 X18.50 S0.6 F6000
+G1 X18.20 S0.8 F6000
+G1 X18.10 S0.7 F6000
+G1 X17.90 S0.9 F6000
+G1 X17.80 S0.8 F6000
+G1 X17.70 S1.0 F6000
+G1 X17.50 S0.9 F6000
+G1 X17.40 S1.0 F6000
+G1 X17.30 S0.9 F6000
+G1 X17.20 S1.0 F6000
+G1 X16.70 S0.9 F6000
+G1 X16.60 S1.0 F6000
+G1 X16.40 S0.9 F6000
+G1 X16.30 S1.0 F6000
+G1 X16.20 S0.8 F6000
+G1 X16.10 S0.9 F6000
+G1 X16.00 S1.0 F6000
+G1 X15.90 S0.8 F6000
+G1 X15.80 S0.7 F6000
+G1 X15.50 S0.6 F6000
+G1 X15.40 S0.8 F6000
+G1 X15.30 S0.6 F6000
+G1 X15.00 S0.5 F6000
+G1 X14.90 S0.6 F6000
+G1 X14.80 S0.4 F6000
+G1 X14.50 S0.3 F6000
+G1 X14.30 S0.2 F6000
+G1 X14.10 S0.1 F6000
+G1 X13.50 S0.0 F6000
+G1 X12.70 S0.1 F6000
+G1 X12.50 S0.0 F6000
+G1 X12.40 S0.1 F6000
+G1 X12.10 S0.2 F6000
+G1 X12.00 S0.3 F6000
+G1 X11.90 S0.2 F6000
+G1 X11.80 S0.4 F6000
+G1 X11.60 S0.3 F6000
+G1 X11.50 S0.5 F6000
+G1 X11.10 S0.6 F6000
+G1 X10.90 S0.7 F6000
+G1 X10.80 S0.6 F6000
+G1 X10.70 S0.7 F6000
+G1 X10.40 S0.9 F6000
+G1 X10.20 S0.8 F6000
+G1 X10.10 S1.0 F6000
+G0 X10.00 Y12.00
+G1 X10.00 S1.0 F6000
+G1 X10.10 S0.9 F6000
+G1 X10.20 S0.8 F6000
+G1 X10.40 S0.7 F6000
+G1 X10.60 S0.8 F6000
+G1 X10.70 S0.7 F6000
+G1 X10.90 S0.6 F6000
+G1 X11.00 S0.5 F6000
+G1 X11.20 S0.4 F6000
+G1 X11.40 S0.3 F6000
+G1 X11.50 S0.4 F6000
+G1 X11.60 S0.2 F6000
+G1 X12.00 S0.1 F6000
+G1 X12.10 S0.2 F6000
+G1 X12.20 S0.1 F6000
+G1 X12.30 S0.0 F6000
+G1 X12.40 S0.1 F6000
+G1 X12.50 S0.0 F6000
+G1 X12.90 S0.1 F6000
+G1 X13.00 S0.0 F6000
+G1 X13.30 S0.1 F6000
+G1 X13.40 S0.0 F6000
+G1 X13.50 S0.1 F6000
+G1 X13.60 S0.2 F6000
+G1 X13.70 S0.1 F6000
+G1 X13.80 S0.2 F6000
+G1 X13.90 S0.0 F6000
+G1 X14.00 S0.2 F6000
+G1 X14.30 S0.3 F6000
+G1 X14.40 S0.4 F6000
+G1 X15.00 S0.6 F6000
+G1 X15.10 S0.7 F6000
+G1 X15.20 S0.6 F6000
+G1 X15.30 S0.7 F6000
+G1 X15.40 S0.6 F6000
+G1 X15.50 S0.8 F6000
+G1 X15.80 S0.9 F6000
+G1 X16.10 S1.0 F6000
+G1 X16.20 S0.9 F6000
+G1 X16.30 S1.0 F6000
+G1 X16.80 S0.9 F6000
+G1 X16.90 S1.0 F6000
+G1 X17.40 S0.9 F6000
+G1 X17.50 S1.0 F6000
+G1 X17.60 S0.8 F6000
+G1 X17.70 S0.9 F6000
+G1 X17.90 S0.8 F6000
+G1 X18.00 S0.7 F6000
+G1 X18.40 S0.6 F6000
+G1 X18.60 S0.5 F6000
+G1 X18.70 S0.4 F6000
+G1 X18.90 S0.3 F6000
+G1 X19.00 S0.4 F6000
+G1 X19.20 S0.3 F6000
+G1 X19.40 S0.1 F6000
+G1 X19.50 S0.3 F6000
+G1 X19.60 S0.2 F6000
+G1 X19.80 S0.1 F6000
+G1 X19.90 S0.0 F6000
+G1 X20.40 S0.1 F6000
+G1 X20.50 S0.0 F6000
+G1 X20.70 S0.1 F6000
+G1 X20.80 S0.0 F6000
+G1 X21.00 S0.1 F6000
+G1 X21.10 S0.0 F6000
+G1 X21.40 S0.2 F6000
+G1 X21.80 S0.3 F6000
+G1 X22.20 S0.4 F6000
+G1 X22.30 S0.5 F6000
+G1 X22.70 S0.7 F6000
+G1 X22.90 S0.8 F6000
+G1 X23.30 S0.9 F6000
+G1 X23.70 S1.0 F6000
+G1 X24.10 S0.9 F6000
+G1 X24.20 S1.0 F6000
+G1 X24.50 S0.9 F6000
+G1 X24.70 S1.0 F6000
+G1 X24.90 S0.9 F6000
+G0 X24.90 Y12.10
+G1 X24.90 S0.9 F6000
+G1 X24.80 S1.0 F6000
+G1 X24.60 S0.9 F6000
+G1 X24.50 S1.0 F6000
+G1 X24.40 S0.9 F6000
+G1 X24.30 S1.0 F6000
+G1 X24.10 S0.9 F6000
+G1 X23.90 S1.0 F6000
+G1 X23.60 S0.9 F6000
+G1 X23.00 S0.8 F6000
+G1 X22.90 S0.7 F6000
+G1 X22.50 S0.6 F6000
+G1 X22.40 S0.5 F6000
+G1 X22.30 S0.6 F6000
+G1 X22.20 S0.4 F6000
+G1 X22.10 S0.5 F6000
+G1 X22.00 S0.4 F6000
+G1 X21.90 S0.3 F6000
+G1 X21.80 S0.2 F6000
+G1 X21.70 S0.3 F6000
+G1 X21.60 S0.2 F6000
+G1 X21.40 S0.1 F6000
+G1 X21.30 S0.0 F6000
+G1 X21.20 S0.1 F6000
+G1 X21.00 S0.0 F6000
+G1 X20.90 S0.1 F6000
+G1 X20.80 S0.0 F6000
+G1 X20.70 S0.1 F6000
+G1 X20.50 S0.0 F6000
+G1 X20.40 S0.1 F6000
+G1 X20.20 S0.0 F6000
+G1 X20.00 S0.1 F6000
+G1 X19.90 S0.0 F6000
+G1 X19.80 S0.1 F6000
+G1 X19.70 S0.0 F6000
+G1 X19.60 S0.1 F6000
+G1 X19.50 S0.0 F6000
+G1 X19.40 S0.2 F6000
+G1 X19.00 S0.3 F6000
+G1 X18.70 S0.4 F6000
+G1 X18.40 S0.5 F6000
+G1 X18.30 S0.6 F6000
+G1 X18.20 S0.5 F6000
+G1 X18.10 S0.7 F6000
+G1 X17.90 S0.8 F6000
+G1 X17.70 S0.9 F6000
+G1 X17.50 S0.8 F6000
+G1 X17.40 S0.9 F6000
+G1 X17.30 S0.8 F6000
+G1 X17.20 S1.0 F6000
+G1 X16.80 S0.9 F6000
+G1 X16.70 S1.0 F6000
+G1 X16.60 S0.9 F6000
+G1 X16.50 S1.0 F6000
+G1 X16.20 S0.9 F6000
+G1 X16.00 S1.0 F6000
+G1 X15.90 S0.8 F6000
+G1 X15.80 S0.9 F6000
+G1 X15.70 S0.8 F6000
+G1 X15.50 S0.7 F6000
+G1 X15.30 S0.8 F6000
+G1 X15.20 S0.7 F6000
+G1 X15.10 S0.6 F6000
+G1 X15.00 S0.5 F6000
+G1 X14.70 S0.4 F6000
+G1 X14.30 S0.2 F6000
+G1 X14.20 S0.3 F6000
+G1 X13.90 S0.2 F6000
+G1 X13.70 S0.0 F6000
+G1 X13.60 S0.1 F6000
+G1 X13.40 S0.0 F6000
+G1 X13.20 S0.1 F6000
+G1 X13.00 S0.0 F6000
+G1 X12.90 S0.1 F6000
+G1 X12.80 S0.0 F6000
+G1 X12.60 S0.1 F6000
+G1 X12.50 S0.0 F6000
+G1 X12.40 S0.1 F6000
+G1 X12.30 S0.0 F6000
+G1 X12.20 S0.1 F6000
+G1 X12.00 S0.0 F6000
+G1 X11.90 S0.1 F6000
+G1 X11.80 S0.2 F6000
+G1 X11.70 S0.3 F6000
+G1 X11.20 S0.4 F6000
+G1 X10.90 S0.5 F6000
+G1 X10.80 S0.7 F6000
+G1 X10.60 S0.6 F6000
+G1 X10.50 S0.8 F6000
+G1 X10.40 S0.7 F6000
+G1 X10.30 S0.8 F6000
+G1 X10.20 S0.7 F6000
+G1 X10.10 S0.8 F6000
+G1 X10.00 S1.0 F6000
+G0 X10.00 Y12.20
+G1 X10.00 S0.9 F6000
+G1 X10.10 S0.8 F6000
+G1 X10.40 S0.7 F6000
+G1 X10.60 S0.6 F6000
+G1 X10.80 S0.5 F6000
+G1 X11.10 S0.3 F6000
+G1 X11.30 S0.4 F6000
+G1 X11.40 S0.3 F6000
+G1 X11.60 S0.2 F6000
+G1 X12.00 S0.0 F6000
+G1 X12.20 S0.1 F6000
+G1 X12.30 S0.0 F6000
+G1 X12.70 S0.1 F6000
+G1 X12.80 S0.0 F6000
+G1 X13.20 S0.1 F6000
+G1 X13.40 S0.0 F6000
+G1 X13.50 S0.2 F6000
+G1 X13.60 S0.0 F6000
+G1 X13.70 S0.1 F6000
+G1 X13.90 S0.2 F6000
+G1 X14.10 S0.4 F6000
+G1 X14.20 S0.3 F6000
+G1 X14.40 S0.5 F6000
+G1 X14.50 S0.4 F6000
+G1 X14.70 S0.5 F6000
+G1 X14.80 S0.6 F6000
+G1 X14.90 S0.5 F6000
+G1 X15.00 S0.7 F6000
+G1 X15.20 S0.8 F6000
+G1 X15.40 S0.7 F6000
+G1 X15.50 S0.9 F6000
+G1 X15.80 S0.8 F6000
+G1 X15.90 S1.0 F6000
+G1 X16.20 S0.9 F6000
+G1 X16.30 S1.0 F6000
+G1 X16.70 S0.9 F6000
+G1 X16.80 S1.0 F6000
+G1 X17.00 S0.9 F6000
+G1 X17.10 S1.0 F6000
+G1 X17.20 S0.9 F6000
+G1 X17.30 S0.8 F6000
+G1 X17.40 S0.9 F6000
+G1 X17.60 S0.8 F6000
+G1 X17.70 S0.7 F6000
+G1 X17.90 S0.8 F6000
+G1 X18.00 S0.7 F6000
+G1 X18.10 S0.6 F6000
+G1 X18.30 S0.5 F6000
+G1 X18.60 S0.4 F6000
+G1 X18.80 S0.3 F6000
+G1 X19.10 S0.2 F6000
+G1 X19.20 S0.1 F6000
+G1 X19.30 S0.2 F6000
+G1 X19.40 S0.0 F6000
+G1 X19.70 S0.1 F6000
+G1 X19.80 S0.0 F6000
+G1 X19.90 S0.1 F6000
+G1 X20.00 S0.0 F6000
+G1 X20.40 S0.1 F6000
+G1 X20.50 S0.0 F6000
+G1 X20.90 S0.1 F6000
+G1 X21.00 S0.0 F6000
+G1 X21.10 S0.1 F6000
+G1 X21.20 S0.2 F6000
+G1 X21.30 S0.1 F6000
+G1 X21.40 S0.2 F6000
+G1 X21.50 S0.3 F6000
+G1 X21.60 S0.2 F6000
+G1 X21.70 S0.3 F6000
+G1 X21.80 S0.4 F6000
+G1 X21.90 S0.3 F6000
+G1 X22.00 S0.4 F6000
+G1 X22.10 S0.5 F6000
+G1 X22.20 S0.4 F6000
+G1 X22.30 S0.5 F6000
+G1 X22.40 S0.7 F6000
+G1 X22.70 S0.8 F6000
+G1 X23.10 S0.9 F6000
+G1 X23.60 S1.0 F6000
+G1 X24.20 S0.9 F6000
+G1 X24.30 S1.0 F6000
+G1 X24.40 S0.9 F6000
+G1 X24.50 S1.0 F6000
+G1 X24.70 S0.8 F6000
+G1 X24.80 S0.9 F6000
+G0 X24.90 Y12.30
+G1 X24.90 S0.7 F6000
+G1 X24.80 S1.0 F6000
+G1 X24.60 S0.9 F6000
+G1 X24.30 S1.0 F6000
+G1 X24.10 S0.9 F6000
+G1 X23.90 S1.0 F6000
+G1 X23.40 S0.9 F6000
+G1 X23.30 S1.0 F6000
+G1 X23.20 S0.8 F6000
+G1 X23.10 S1.0 F6000
+G1 X23.00 S0.9 F6000
+G1 X22.80 S0.8 F6000
+G1 X22.60 S0.7 F6000
+G1 X22.30 S0.6 F6000
+G1 X22.20 S0.5 F6000
+G1 X22.10 S0.6 F6000
+G1 X22.00 S0.4 F6000
+G1 X21.60 S0.3 F6000
+G1 X21.50 S0.4 F6000
+G1 X21.40 S0.2 F6000
+G1 X21.30 S0.3 F6000
+G1 X21.20 S0.1 F6000
+G1 X21.00 S0.2 F6000
+G1 X20.90 S0.1 F6000
+G1 X20.80 S0.0 F6000
+G1 X20.70 S0.1 F6000
+G1 X20.50 S0.0 F6000
+G1 X20.30 S0.1 F6000
+G1 X20.20 S0.0 F6000
+G1 X20.00 S0.1 F6000
+G1 X19.90 S0.0 F6000
+G1 X19.80 S0.1 F6000
+G1 X19.70 S0.0 F6000
+G1 X19.60 S0.1 F6000
+G1 X19.20 S0.2 F6000
+G1 X19.10 S0.1 F6000
+G1 X19.00 S0.3 F6000
+G1 X18.90 S0.2 F6000
+G1 X18.80 S0.3 F6000
+G1 X18.70 S0.4 F6000
+G1 X18.50 S0.5 F6000
+G1 X18.30 S0.4 F6000
+G1 X18.10 S0.6 F6000
+G1 X18.00 S0.7 F6000
+G1 X17.90 S0.6 F6000
+G1 X17.70 S0.8 F6000
+G1 X17.40 S0.7 F6000
+G1 X17.30 S0.9 F6000
+G1 X17.10 S0.8 F6000
+G1 X17.00 S1.0 F6000
+G1 X16.60 S0.9 F6000
+G1 X16.50 S1.0 F6000
+G1 X15.60 S0.9 F6000
+G1 X15.50 S0.8 F6000
+G1 X15.40 S0.9 F6000
+G1 X15.30 S0.8 F6000
+G1 X14.90 S0.7 F6000
+G1 X14.70 S0.5 F6000
+G1 X14.40 S0.4 F6000
+G1 X14.30 S0.5 F6000
+G1 X14.20 S0.3 F6000
+G1 X14.10 S0.4 F6000
+G1 X13.90 S0.2 F6000
+G1 X13.80 S0.1 F6000
+G1 X13.70 S0.2 F6000
+G1 X13.60 S0.1 F6000
+G1 X13.50 S0.2 F6000
+G1 X13.40 S0.1 F6000
+G1 X13.30 S0.0 F6000
+G1 X13.20 S0.1 F6000
+G1 X13.10 S0.0 F6000
+G1 X12.80 S0.1 F6000
+G1 X12.30 S0.0 F6000
+G1 X12.20 S0.1 F6000
+G1 X12.10 S0.0 F6000
+G1 X11.90 S0.1 F6000
+G1 X11.60 S0.2 F6000
+G1 X11.30 S0.3 F6000
+G1 X11.20 S0.4 F6000
+G1 X11.10 S0.3 F6000
+G1 X10.90 S0.4 F6000
+G1 X10.80 S0.6 F6000
+G1 X10.60 S0.5 F6000
+G1 X10.50 S0.6 F6000
+G1 X10.20 S0.7 F6000
+G1 X10.10 S0.8 F6000
+G1 X10.00 S0.7 F6000
+G0 X10.00 Y12.40
+G1 X10.00 S0.7 F6000
+G1 X10.30 S0.5 F6000
+G1 X10.40 S0.6 F6000
+G1 X10.60 S0.5 F6000
+G1 X10.80 S0.4 F6000
+G1 X10.90 S0.3 F6000
+G1 X11.00 S0.4 F6000
+G1 X11.10 S0.3 F6000
+G1 X11.30 S0.2 F6000
+G1 X11.50 S0.1 F6000
+G1 X11.60 S0.0 F6000
+G1 X11.80 S0.1 F6000
+G1 X11.90 S0.0 F6000
+G1 X12.40 S0.1 F6000
+G1 X12.50 S0.0 F6000
+G1 X12.60 S0.1 F6000
+G1 X12.70 S0.0 F6000
+G1 X12.90 S0.1 F6000
+G1 X13.00 S0.0 F6000
+G1 X13.10 S0.1 F6000
+G1 X13.40 S0.2 F6000
+G1 X13.50 S0.1 F6000
+G1 X13.60 S0.2 F6000
+G1 X13.70 S0.3 F6000
+G1 X13.90 S0.2 F6000
+G1 X14.00 S0.4 F6000
+G1 X14.20 S0.5 F6000
+G1 X14.30 S0.4 F6000
+G1 X14.40 S0.5 F6000
+G1 X14.50 S0.6 F6000
+G1 X14.80 S0.7 F6000
+G1 X15.10 S0.8 F6000
+G1 X15.20 S0.9 F6000
+G1 X15.50 S1.0 F6000
+G1 X15.70 S0.9 F6000
+G1 X15.80 S1.0 F6000
+G1 X16.00 S0.9 F6000
+G1 X16.10 S1.0 F6000
+G1 X16.20 S0.9 F6000
+G1 X16.30 S1.0 F6000
+G1 X16.50 S0.9 F6000
+G1 X16.60 S1.0 F6000
+G1 X16.80 S0.9 F6000
+G1 X17.20 S0.8 F6000
+G1 X17.30 S0.9 F6000
+G1 X17.50 S0.7 F6000
+G1 X17.90 S0.5 F6000
+G1 X18.20 S0.4 F6000
+G1 X18.30 S0.3 F6000
+G1 X18.40 S0.4 F6000
+G1 X18.50 S0.3 F6000
+G1 X18.70 S0.2 F6000
+G1 X19.00 S0.1 F6000
+G1 X19.40 S0.0 F6000
+G1 X19.70 S0.1 F6000
+G1 X19.90 S0.0 F6000
+G1 X20.40 S0.1 F6000
+G1 X20.50 S0.0 F6000
+G1 X20.60 S0.1 F6000
+G1 X20.70 S0.2 F6000
+G1 X20.80 S0.0 F6000
+G1 X20.90 S0.2 F6000
+G1 X21.00 S0.3 F6000
+G1 X21.10 S0.1 F6000
+G1 X21.20 S0.3 F6000
+G1 X21.40 S0.2 F6000
+G1 X21.50 S0.4 F6000
+G1 X21.60 S0.3 F6000
+G1 X21.70 S0.4 F6000
+G1 X21.90 S0.5 F6000
+G1 X22.00 S0.6 F6000
+G1 X22.10 S0.5 F6000
+G1 X22.20 S0.6 F6000
+G1 X22.40 S0.7 F6000
+G1 X22.60 S0.8 F6000
+G1 X22.80 S0.9 F6000
+G1 X23.10 S0.8 F6000
+G1 X23.20 S0.9 F6000
+G1 X23.30 S1.0 F6000
+G1 X23.80 S0.9 F6000
+G1 X24.00 S1.0 F6000
+G1 X24.30 S0.9 F6000
+G1 X24.40 S0.8 F6000
+G1 X24.50 S0.9 F6000
+G1 X24.60 S0.8 F6000
+G1 X24.70 S0.9 F6000
+G1 X24.80 S0.8 F6000
+G1 X24.90 S0.7 F6000
+G0 X24.90 Y12.50
+G1 X24.90 S0.7 F6000
+G1 X24.60 S0.8 F6000
+G1 X24.50 S0.9 F6000
+G1 X24.30 S0.8 F6000
+G1 X24.20 S1.0 F6000
+G1 X24.10 S0.9 F6000
+G1 X24.00 S1.0 F6000
+G1 X23.90 S0.9 F6000
+G1 X23.80 S1.0 F6000
+G1 X23.40 S0.9 F6000
+G1 X23.30 S1.0 F6000
+G1 X23.20 S0.9 F6000
+G1 X23.10 S1.0 F6000
+G1 X22.90 S0.9 F6000
+G1 X22.80 S0.8 F6000
+G1 X22.70 S0.9 F6000
+G1 X22.60 S0.8 F6000
+G1 X22.40 S0.7 F6000
+G1 X22.30 S0.8 F6000
+G1 X22.20 S0.7 F6000
+G1 X22.00 S0.6 F6000
+G1 X21.60 S0.5 F6000
+G1 X21.50 S0.4 F6000
+G1 X21.20 S0.2 F6000
+G1 X20.90 S0.1 F6000
+G1 X20.80 S0.2 F6000
+G1 X20.70 S0.0 F6000
+G1 X20.60 S0.1 F6000
+G1 X20.50 S0.0 F6000
+G1 X19.90 S0.1 F6000
+G1 X19.80 S0.0 F6000
+G1 X19.60 S0.1 F6000
+G1 X19.40 S0.0 F6000
+G1 X19.30 S0.1 F6000
+G1 X19.10 S0.0 F6000
+G1 X18.90 S0.1 F6000
+G1 X18.80 S0.3 F6000
+G1 X18.70 S0.2 F6000
+G1 X18.60 S0.3 F6000
+G1 X18.40 S0.4 F6000
+G1 X18.10 S0.5 F6000
+G1 X18.00 S0.4 F6000
+G1 X17.90 S0.5 F6000
+G1 X17.70 S0.7 F6000
+G1 X17.60 S0.6 F6000
+G1 X17.40 S0.7 F6000
+G1 X17.20 S0.8 F6000
+G1 X16.90 S1.0 F6000
+G1 X16.80 S0.9 F6000
+G1 X16.60 S1.0 F6000
+G1 X16.40 S0.9 F6000
+G1 X16.10 S1.0 F6000
+G1 X15.80 S0.9 F6000
+G1 X15.70 S1.0 F6000
+G1 X15.40 S0.9 F6000
+G1 X15.00 S0.8 F6000
+G1 X14.80 S0.7 F6000
+G1 X14.60 S0.6 F6000
+G1 X14.50 S0.7 F6000
+G1 X14.30 S0.5 F6000
+G1 X14.20 S0.4 F6000
+G1 X13.80 S0.3 F6000
+G1 X13.70 S0.2 F6000
+G1 X13.60 S0.3 F6000
+G1 X13.50 S0.2 F6000
+G1 X13.40 S0.1 F6000
+G1 X13.20 S0.2 F6000
+G1 X13.10 S0.1 F6000
+G1 X13.00 S0.0 F6000
+G1 X11.80 S0.1 F6000
+G1 X11.70 S0.0 F6000
+G1 X11.60 S0.1 F6000
+G1 X11.30 S0.2 F6000
+G1 X11.20 S0.3 F6000
+G1 X10.90 S0.4 F6000
+G1 X10.40 S0.5 F6000
+G1 X10.20 S0.6 F6000
+G1 X10.00 S0.7 F6000
+G0 X10.00 Y12.60
+G1 X10.00 S0.5 F6000
+G1 X10.10 S0.7 F6000
+G1 X10.20 S0.6 F6000
+G1 X10.30 S0.5 F6000
+G1 X10.40 S0.4 F6000
+G1 X10.50 S0.5 F6000
+G1 X10.60 S0.3 F6000
+G1 X10.70 S0.4 F6000
+G1 X10.80 S0.2 F6000
+G1 X10.90 S0.3 F6000
+G1 X11.00 S0.2 F6000
+G1 X11.10 S0.3 F6000
+G1 X11.20 S0.1 F6000
+G1 X11.40 S0.0 F6000
+G1 X11.50 S0.2 F6000
+G1 X11.60 S0.1 F6000
+G1 X11.80 S0.0 F6000
+G1 X12.20 S0.1 F6000
+G1 X12.30 S0.0 F6000
+G1 X12.80 S0.1 F6000
+G1 X13.20 S0.2 F6000
+G1 X13.50 S0.3 F6000
+G1 X13.60 S0.4 F6000
+G1 X14.00 S0.5 F6000
+G1 X14.10 S0.6 F6000
+G1 X14.50 S0.7 F6000
+G1 X14.80 S0.9 F6000
+G1 X15.10 S0.8 F6000
+G1 X15.20 S0.9 F6000
+G1 X15.30 S0.8 F6000
+G1 X15.40 S1.0 F6000
+G1 X15.80 S0.9 F6000
+G1 X15.90 S1.0 F6000
+G1 X16.10 S0.9 F6000
+G1 X16.20 S1.0 F6000
+G1 X16.30 S0.9 F6000
+G1 X16.60 S0.8 F6000
+G1 X16.70 S0.9 F6000
+G1 X17.10 S0.8 F6000
+G1 X17.20 S0.7 F6000
+G1 X17.30 S0.8 F6000
+G1 X17.40 S0.7 F6000
+G1 X17.60 S0.5 F6000
+G1 X18.10 S0.3 F6000
+G1 X18.30 S0.2 F6000
+G1 X18.40 S0.3 F6000
+G1 X18.50 S0.2 F6000
+G1 X18.80 S0.1 F6000
+G1 X19.20 S0.0 F6000
+G1 X19.60 S0.1 F6000
+G1 X19.70 S0.0 F6000
+G1 X20.00 S0.1 F6000
+G1 X20.20 S0.0 F6000
+G1 X20.40 S0.1 F6000
+G1 X20.80 S0.2 F6000
+G1 X20.90 S0.3 F6000
+G1 X21.10 S0.2 F6000
+G1 X21.20 S0.3 F6000
+G1 X21.40 S0.4 F6000
+G1 X21.50 S0.5 F6000
+G1 X21.60 S0.4 F6000
+G1 X21.80 S0.6 F6000
+G1 X21.90 S0.7 F6000
+G1 X22.10 S0.6 F6000
+G1 X22.20 S0.8 F6000
+G1 X22.40 S0.7 F6000
+G1 X22.60 S0.9 F6000
+G1 X22.70 S0.8 F6000
+G1 X22.80 S0.9 F6000
+G1 X23.00 S1.0 F6000
+G1 X23.10 S0.9 F6000
+G1 X23.20 S1.0 F6000
+G1 X23.50 S0.9 F6000
+G1 X23.60 S1.0 F6000
+G1 X23.90 S0.9 F6000
+G1 X24.30 S0.8 F6000
+G1 X24.40 S0.9 F6000
+G1 X24.50 S0.8 F6000
+G1 X24.60 S0.9 F6000
+G1 X24.70 S0.7 F6000
+G0 X24.90 Y12.70
+G1 X24.90 S0.7 F6000
+G1 X24.80 S0.8 F6000
+G1 X24.40 S0.9 F6000
+G1 X24.30 S0.8 F6000
+G1 X24.20 S0.9 F6000
+G1 X24.10 S1.0 F6000
+G1 X24.00 S0.8 F6000
+G1 X23.90 S1.0 F6000
+G1 X23.50 S0.9 F6000
+G1 X23.40 S1.0 F6000
+G1 X23.30 S0.9 F6000
+G1 X23.20 S1.0 F6000
+G1 X22.90 S0.9 F6000
+G1 X22.80 S1.0 F6000
+G1 X22.70 S0.9 F6000
+G1 X22.60 S1.0 F6000
+G1 X22.50 S0.8 F6000
+G1 X22.40 S0.9 F6000
+G1 X22.30 S0.7 F6000
+G1 X22.20 S0.9 F6000
+G1 X22.10 S0.7 F6000
+G1 X21.90 S0.6 F6000
+G1 X21.80 S0.7 F6000
+G1 X21.60 S0.5 F6000
+G1 X21.40 S0.4 F6000
+G1 X21.30 S0.5 F6000
+G1 X21.20 S0.3 F6000
+G1 X21.00 S0.2 F6000
+G1 X20.90 S0.3 F6000
+G1 X20.80 S0.2 F6000
+G1 X20.70 S0.3 F6000
+G1 X20.60 S0.2 F6000
+G1 X20.50 S0.1 F6000
+G1 X20.40 S0.2 F6000
+G1 X20.20 S0.1 F6000
+G1 X20.00 S0.0 F6000
+G1 X19.70 S0.1 F6000
+G1 X19.50 S0.0 F6000
+G1 X18.80 S0.1 F6000
+G1 X18.50 S0.2 F6000
+G1 X18.40 S0.3 F6000
+G1 X17.90 S0.5 F6000
+G1 X17.80 S0.4 F6000
+G1 X17.70 S0.5 F6000
+G1 X17.40 S0.7 F6000
+G1 X17.20 S0.6 F6000
+G1 X17.10 S0.8 F6000
+G1 X17.00 S0.9 F6000
+G1 X16.90 S0.8 F6000
+G1 X16.70 S1.0 F6000
+G1 X16.60 S0.9 F6000
+G1 X16.50 S1.0 F6000
+G1 X16.40 S0.9 F6000
+G1 X16.30 S1.0 F6000
+G1 X16.20 S0.9 F6000
+G1 X16.00 S1.0 F6000
+G1 X15.90 S0.9 F6000
+G1 X15.80 S1.0 F6000
+G1 X15.60 S0.9 F6000
+G1 X15.50 S1.0 F6000
+G1 X15.40 S0.9 F6000
+G1 X15.20 S1.0 F6000
+G1 X15.10 S0.9 F6000
+G1 X14.80 S0.7 F6000
+G1 X14.70 S0.8 F6000
+G1 X14.60 S0.7 F6000
+G1 X14.50 S0.8 F6000
+G1 X14.40 S0.7 F6000
+G1 X14.20 S0.6 F6000
+G1 X14.10 S0.5 F6000
+G1 X13.90 S0.6 F6000
+G1 X13.80 S0.5 F6000
+G1 X13.60 S0.3 F6000
+G1 X13.50 S0.4 F6000
+G1 X13.40 S0.3 F6000
+G1 X13.20 S0.1 F6000
+G1 X13.10 S0.3 F6000
+G1 X13.00 S0.2 F6000
+G1 X12.90 S0.1 F6000
+G1 X12.80 S0.2 F6000
+G1 X12.70 S0.0 F6000
+G1 X12.30 S0.1 F6000
+G1 X12.20 S0.0 F6000
+G1 X12.00 S0.1 F6000
+G1 X11.90 S0.0 F6000
+G1 X11.50 S0.1 F6000
+G1 X11.10 S0.2 F6000
+G1 X11.00 S0.1 F6000
+G1 X10.90 S0.2 F6000
+G1 X10.70 S0.3 F6000
+G1 X10.30 S0.5 F6000
+G1 X10.00 S0.6 F6000
+G0 X10.00 Y12.80
+G1 X10.00 S0.6 F6000
+G1 X10.20 S0.4 F6000
+G1 X10.50 S0.2 F6000
+G1 X10.60 S0.3 F6000
+G1 X10.80 S0.2 F6000
+G1 X10.90 S0.1 F6000
+G1 X11.20 S0.2 F6000
+G1 X11.30 S0.1 F6000
+G1 X11.50 S0.0 F6000
+G1 X11.70 S0.1 F6000
+G1 X11.80 S0.0 F6000
+G1 X11.90 S0.1 F6000
+G1 X12.00 S0.0 F6000
+G1 X12.20 S0.1 F6000
+G1 X12.30 S0.0 F6000
+G1 X12.40 S0.1 F6000
+G1 X12.70 S0.0 F6000
+G1 X12.80 S0.1 F6000
+G1 X13.00 S0.2 F6000
+G1 X13.10 S0.1 F6000
+G1 X13.20 S0.3 F6000
+G1 X13.40 S0.4 F6000
+G1 X13.50 S0.3 F6000
+G1 X13.60 S0.4 F6000
+G1 X13.70 S0.5 F6000
+G1 X13.80 S0.4 F6000
+G1 X13.90 S0.5 F6000
+G1 X14.00 S0.6 F6000
+G1 X14.20 S0.7 F6000
+G1 X14.30 S0.8 F6000
+G1 X14.40 S0.7 F6000
+G1 X14.50 S0.8 F6000
+G1 X14.80 S0.9 F6000
+G1 X14.90 S0.8 F6000
+G1 X15.10 S1.0 F6000
+G1 X15.20 S0.9 F6000
+G1 X15.30 S1.0 F6000
+G1 X15.40 S0.9 F6000
+G1 X15.50 S1.0 F6000
+G1 X15.90 S0.9 F6000
+G1 X16.10 S1.0 F6000
+G1 X16.40 S0.9 F6000
+G1 X16.50 S0.8 F6000
+G1 X16.60 S0.9 F6000
+G1 X16.90 S0.8 F6000
+G1 X17.00 S0.7 F6000
+G1 X17.20 S0.6 F6000
+G1 X17.30 S0.7 F6000
+G1 X17.40 S0.6 F6000
+G1 X17.50 S0.5 F6000
+G1 X17.70 S0.4 F6000
+G1 X17.80 S0.3 F6000
+G1 X17.90 S0.4 F6000
+G1 X18.00 S0.3 F6000
+G1 X18.20 S0.2 F6000
+G1 X18.30 S0.3 F6000
+G1 X18.40 S0.2 F6000
+G1 X18.60 S0.1 F6000
+G1 X18.70 S0.0 F6000
+G1 X18.90 S0.1 F6000
+G1 X19.00 S0.0 F6000
+G1 X19.20 S0.1 F6000
+G1 X19.40 S0.0 F6000
+G1 X19.50 S0.1 F6000
+G1 X19.60 S0.0 F6000
+G1 X19.90 S0.1 F6000
+G1 X20.00 S0.0 F6000
+G1 X20.20 S0.1 F6000
+G1 X20.40 S0.2 F6000
+G1 X20.70 S0.1 F6000
+G1 X20.80 S0.2 F6000
+G1 X20.90 S0.3 F6000
+G1 X21.20 S0.5 F6000
+G1 X21.30 S0.4 F6000
+G1 X21.40 S0.6 F6000
+G1 X21.50 S0.5 F6000
+G1 X21.60 S0.6 F6000
+G1 X21.70 S0.7 F6000
+G1 X21.80 S0.8 F6000
+G1 X21.90 S0.7 F6000
+G1 X22.10 S0.9 F6000
+G1 X22.30 S0.8 F6000
+G1 X22.40 S0.9 F6000
+G1 X22.50 S0.8 F6000
+G1 X22.60 S0.9 F6000
+G1 X22.70 S1.0 F6000
+G1 X22.80 S0.9 F6000
+G1 X22.90 S1.0 F6000
+G1 X23.00 S0.9 F6000
+G1 X23.20 S1.0 F6000
+G1 X23.70 S0.9 F6000
+G1 X23.90 S1.0 F6000
+G1 X24.00 S0.8 F6000
+G1 X24.10 S1.0 F6000
+G1 X24.20 S0.8 F6000
+G1 X24.40 S0.7 F6000
+G1 X24.50 S0.8 F6000
+G1 X24.70 S0.6 F6000
+G0 X24.90 Y12.90
+G1 X24.90 S0.5 F6000
+G1 X24.80 S0.7 F6000
+G1 X24.70 S0.5 F6000
+G1 X24.60 S0.7 F6000
+G1 X24.50 S0.8 F6000
+G1 X24.30 S0.7 F6000
+G1 X24.00 S0.9 F6000
+G1 X23.80 S1.0 F6000
+G1 X23.70 S0.9 F6000
+G1 X23.60 S1.0 F6000
+G1 X23.50 S0.9 F6000
+G1 X23.40 S1.0 F6000
+G1 X23.00 S0.9 F6000
+G1 X22.80 S1.0 F6000
+G1 X22.70 S0.9 F6000
+G1 X22.60 S1.0 F6000
+G1 X22.40 S0.9 F6000
+G1 X22.30 S0.8 F6000
+G1 X22.20 S0.9 F6000
+G1 X22.00 S0.8 F6000
+G1 X21.80 S0.7 F6000
+G1 X21.70 S0.8 F6000
+G1 X21.60 S0.6 F6000
+G1 X21.50 S0.7 F6000
+G1 X21.40 S0.6 F6000
+G1 X21.10 S0.5 F6000
+G1 X21.00 S0.4 F6000
+G1 X20.90 S0.3 F6000
+G1 X20.70 S0.4 F6000
+G1 X20.60 S0.3 F6000
+G1 X20.40 S0.2 F6000
+G1 X20.30 S0.1 F6000
+G1 X20.20 S0.2 F6000
+G1 X20.10 S0.0 F6000
+G1 X19.90 S0.1 F6000
+G1 X19.70 S0.0 F6000
+G1 X19.30 S0.1 F6000
+G1 X19.20 S0.0 F6000
+G1 X18.70 S0.1 F6000
+G1 X18.60 S0.0 F6000
+G1 X18.40 S0.2 F6000
+G1 X17.90 S0.3 F6000
+G1 X17.80 S0.4 F6000
+G1 X17.70 S0.5 F6000
+G1 X17.50 S0.6 F6000
+G1 X17.00 S0.7 F6000
+G1 X16.80 S0.8 F6000
+G1 X16.70 S0.7 F6000
+G1 X16.60 S0.8 F6000
+G1 X16.40 S0.9 F6000
+G1 X16.30 S0.8 F6000
+G1 X16.20 S0.9 F6000
+G1 X16.10 S1.0 F6000
+G1 X15.90 S0.9 F6000
+G1 X15.60 S1.0 F6000
+G1 X15.50 S0.9 F6000
+G1 X15.40 S1.0 F6000
+G1 X15.30 S0.9 F6000
+G1 X15.20 S1.0 F6000
+G1 X15.10 S0.9 F6000
+G1 X15.00 S1.0 F6000
+G1 X14.70 S0.9 F6000
+G1 X14.40 S0.8 F6000
+G1 X14.30 S0.7 F6000
+G1 X14.20 S0.6 F6000
+G1 X13.50 S0.4 F6000
+G1 X13.40 S0.3 F6000
+G1 X13.30 S0.4 F6000
+G1 X13.20 S0.3 F6000
+G1 X12.90 S0.2 F6000
+G1 X12.70 S0.0 F6000
+G1 X12.60 S0.2 F6000
+G1 X12.50 S0.0 F6000
+G1 X12.40 S0.1 F6000
+G1 X12.30 S0.0 F6000
+G1 X12.00 S0.1 F6000
+G1 X11.90 S0.0 F6000
+G1 X11.80 S0.1 F6000
+G1 X11.60 S0.0 F6000
+G1 X11.10 S0.2 F6000
+G1 X10.90 S0.0 F6000
+G1 X10.80 S0.2 F6000
+G1 X10.60 S0.1 F6000
+G1 X10.50 S0.3 F6000
+G1 X10.30 S0.4 F6000
+G1 X10.20 S0.5 F6000
+G1 X10.10 S0.3 F6000
+G1 X10.00 S0.4 F6000
+G0 X10.00 Y13.00
+G1 X10.00 S0.4 F6000
+G1 X10.20 S0.3 F6000
+G1 X10.30 S0.4 F6000
+G1 X10.40 S0.2 F6000
+G1 X10.50 S0.1 F6000
+G1 X10.60 S0.3 F6000
+G1 X10.70 S0.1 F6000
+G1 X11.10 S0.0 F6000
+G1 X11.40 S0.1 F6000
+G1 X11.50 S0.0 F6000
+G1 X11.70 S0.1 F6000
+G1 X11.80 S0.0 F6000
+G1 X11.90 S0.1 F6000
+G1 X12.10 S0.0 F6000
+G1 X12.40 S0.1 F6000
+G1 X12.70 S0.2 F6000
+G1 X12.80 S0.1 F6000
+G1 X12.90 S0.3 F6000
+G1 X13.00 S0.2 F6000
+G1 X13.10 S0.4 F6000
+G1 X13.30 S0.3 F6000
+G1 X13.40 S0.4 F6000
+G1 X13.70 S0.5 F6000
+G1 X13.80 S0.6 F6000
+G1 X14.00 S0.7 F6000
+G1 X14.10 S0.8 F6000
+G1 X14.30 S0.9 F6000
+G1 X14.40 S0.7 F6000
+G1 X14.50 S0.8 F6000
+G1 X14.60 S0.9 F6000
+G1 X14.80 S1.0 F6000
+G1 X15.10 S0.9 F6000
+G1 X15.20 S1.0 F6000
+G1 X15.70 S0.9 F6000
+G1 X15.80 S1.0 F6000
+G1 X15.90 S0.9 F6000
+G1 X16.40 S0.8 F6000
+G1 X16.50 S0.9 F6000
+G1 X16.60 S0.7 F6000
+G1 X17.00 S0.6 F6000
+G1 X17.10 S0.5 F6000
+G1 X17.20 S0.6 F6000
+G1 X17.30 S0.5 F6000
+G1 X17.50 S0.4 F6000
+G1 X17.60 S0.3 F6000
+G1 X17.70 S0.4 F6000
+G1 X17.80 S0.2 F6000
+G1 X17.90 S0.3 F6000
+G1 X18.00 S0.2 F6000
+G1 X18.20 S0.1 F6000
+G1 X18.30 S0.2 F6000
+G1 X18.40 S0.0 F6000
+G1 X18.50 S0.1 F6000
+G1 X18.60 S0.0 F6000
+G1 X18.70 S0.1 F6000
+G1 X18.80 S0.0 F6000
+G1 X19.80 S0.1 F6000
+G1 X19.90 S0.2 F6000
+G1 X20.00 S0.0 F6000
+G1 X20.10 S0.1 F6000
+G1 X20.40 S0.2 F6000
+G1 X20.50 S0.3 F6000
+G1 X20.70 S0.4 F6000
+G1 X20.90 S0.3 F6000
+G1 X21.00 S0.6 F6000
+G1 X21.10 S0.5 F6000
+G1 X21.20 S0.6 F6000
+G1 X21.30 S0.7 F6000
+G1 X21.40 S0.6 F6000
+G1 X21.50 S0.7 F6000
+G1 X21.60 S0.8 F6000
+G1 X21.70 S0.7 F6000
+G1 X21.80 S0.8 F6000
+G1 X21.90 S0.9 F6000
+G1 X22.10 S0.8 F6000
+G1 X22.20 S0.9 F6000
+G1 X22.40 S1.0 F6000
+G1 X22.50 S0.9 F6000
+G1 X22.70 S1.0 F6000
+G1 X22.90 S0.9 F6000
+G1 X23.10 S1.0 F6000
+G1 X23.30 S0.9 F6000
+G1 X23.40 S1.0 F6000
+G1 X23.50 S0.9 F6000
+G1 X23.70 S1.0 F6000
+G1 X23.80 S0.9 F6000
+G1 X23.90 S1.0 F6000
+G1 X24.00 S0.9 F6000
+G1 X24.10 S0.8 F6000
+G1 X24.30 S0.7 F6000
+G1 X24.40 S0.8 F6000
+G1 X24.50 S0.6 F6000
+G1 X24.80 S0.5 F6000
+G1 X24.90 S0.4 F6000
+G0 X24.90 Y13.10
+G1 X24.90 S0.4 F6000
+G1 X24.80 S0.5 F6000
+G1 X24.70 S0.6 F6000
+G1 X24.60 S0.5 F6000
+G1 X24.40 S0.6 F6000
+G1 X24.20 S0.7 F6000
+G1 X24.10 S0.8 F6000
+G1 X23.80 S0.9 F6000
+G1 X23.60 S0.8 F6000
+G1 X23.50 S1.0 F6000
+G1 X23.40 S0.9 F6000
+G1 X23.30 S1.0 F6000
+G1 X23.20 S0.9 F6000
+G1 X23.10 S1.0 F6000
+G1 X22.20 S0.9 F6000
+G1 X22.00 S0.8 F6000
+G1 X21.90 S0.9 F6000
+G1 X21.80 S0.8 F6000
+G1 X21.50 S0.7 F6000
+G1 X21.10 S0.6 F6000
+G1 X21.00 S0.5 F6000
+G1 X20.90 S0.4 F6000
+G1 X20.80 S0.5 F6000
+G1 X20.60 S0.4 F6000
+G1 X20.50 S0.3 F6000
+G1 X20.20 S0.2 F6000
+G1 X20.10 S0.1 F6000
+G1 X20.00 S0.2 F6000
+G1 X19.90 S0.1 F6000
+G1 X19.70 S0.0 F6000
+G1 X19.60 S0.1 F6000
+G1 X19.40 S0.0 F6000
+G1 X19.00 S0.1 F6000
+G1 X18.70 S0.0 F6000
+G1 X18.50 S0.1 F6000
+G1 X18.30 S0.2 F6000
+G1 X18.10 S0.1 F6000
+G1 X18.00 S0.2 F6000
+G1 X17.80 S0.3 F6000
+G1 X17.70 S0.4 F6000
+G1 X17.50 S0.5 F6000
+G1 X17.40 S0.4 F6000
+G1 X17.30 S0.5 F6000
+G1 X17.10 S0.6 F6000
+G1 X17.00 S0.5 F6000
+G1 X16.90 S0.7 F6000
+G1 X16.80 S0.6 F6000
+G1 X16.70 S0.7 F6000
+G1 X16.50 S0.8 F6000
+G1 X16.20 S0.9 F6000
+G1 X16.00 S1.0 F6000
+G1 X15.70 S0.9 F6000
+G1 X15.60 S1.0 F6000
+G1 X15.20 S0.9 F6000
+G1 X14.70 S1.0 F6000
+G1 X14.60 S0.9 F6000
+G1 X14.50 S1.0 F6000
+G1 X14.40 S0.9 F6000
+G1 X14.20 S0.8 F6000
+G1 X14.10 S0.9 F6000
+G1 X14.00 S0.7 F6000
+G1 X13.70 S0.6 F6000
+G1 X13.40 S0.4 F6000
+G1 X13.00 S0.3 F6000
+G1 X12.90 S0.2 F6000
+G1 X12.80 S0.3 F6000
+G1 X12.60 S0.2 F6000
+G1 X12.50 S0.1 F6000
+G1 X12.30 S0.2 F6000
+G1 X12.20 S0.0 F6000
+G1 X12.10 S0.1 F6000
+G1 X12.00 S0.0 F6000
+G1 X11.90 S0.1 F6000
+G1 X11.80 S0.0 F6000
+G1 X11.60 S0.1 F6000
+G1 X11.50 S0.0 F6000
+G1 X11.20 S0.1 F6000
+G1 X11.10 S0.0 F6000
+G1 X10.90 S0.1 F6000
+G1 X10.80 S0.2 F6000
+G1 X10.70 S0.1 F6000
+G1 X10.60 S0.2 F6000
+G1 X10.50 S0.1 F6000
+G1 X10.40 S0.3 F6000
+G1 X10.30 S0.2 F6000
+G1 X10.10 S0.4 F6000
+G0 X10.00 Y13.20
+G1 X10.00 S0.3 F6000
+G1 X10.40 S0.1 F6000
+G1 X10.50 S0.2 F6000
+G1 X10.70 S0.1 F6000
+G1 X11.00 S0.0 F6000
+G1 X11.10 S0.1 F6000
+G1 X11.40 S0.0 F6000
+G1 X11.60 S0.1 F6000
+G1 X11.70 S0.0 F6000
+G1 X12.00 S0.1 F6000
+G1 X12.10 S0.0 F6000
+G1 X12.30 S0.2 F6000
+G1 X12.50 S0.1 F6000
+G1 X12.60 S0.2 F6000
+G1 X12.70 S0.3 F6000
+G1 X12.80 S0.4 F6000
+G1 X12.90 S0.3 F6000
+G1 X13.00 S0.5 F6000
+G1 X13.10 S0.3 F6000
+G1 X13.20 S0.6 F6000
+G1 X13.30 S0.5 F6000
+G1 X13.50 S0.6 F6000
+G1 X13.80 S0.7 F6000
+G1 X14.00 S0.8 F6000
+G1 X14.30 S0.9 F6000
+G1 X14.40 S0.8 F6000
+G1 X14.60 S0.9 F6000
+G1 X14.70 S1.0 F6000
+G1 X14.80 S0.9 F6000
+G1 X14.90 S1.0 F6000
+G1 X15.40 S0.9 F6000
+G1 X15.50 S1.0 F6000
+G1 X15.80 S0.9 F6000
+G1 X15.90 S0.8 F6000
+G1 X16.00 S0.9 F6000
+G1 X16.10 S1.0 F6000
+G1 X16.20 S0.8 F6000
+G1 X16.40 S0.7 F6000
+G1 X16.70 S0.6 F6000
+G1 X16.80 S0.7 F6000
+G1 X16.90 S0.6 F6000
+G1 X17.00 S0.5 F6000
+G1 X17.30 S0.3 F6000
+G1 X17.50 S0.4 F6000
+G1 X17.60 S0.3 F6000
+G1 X18.00 S0.2 F6000
+G1 X18.10 S0.1 F6000
+G1 X18.30 S0.0 F6000
+G1 X18.40 S0.1 F6000
+G1 X18.50 S0.0 F6000
+G1 X19.30 S0.1 F6000
+G1 X19.40 S0.0 F6000
+G1 X19.50 S0.1 F6000
+G1 X19.90 S0.2 F6000
+G1 X20.20 S0.3 F6000
+G1 X20.30 S0.2 F6000
+G1 X20.40 S0.3 F6000
+G1 X20.60 S0.5 F6000
+G1 X20.80 S0.6 F6000
+G1 X20.90 S0.5 F6000
+G1 X21.10 S0.6 F6000
+G1 X21.40 S0.8 F6000
+G1 X21.90 S0.9 F6000
+G1 X22.00 S1.0 F6000
+G1 X22.50 S0.9 F6000
+G1 X22.60 S1.0 F6000
+G1 X22.70 S0.9 F6000
+G1 X22.80 S1.0 F6000
+G1 X23.10 S0.9 F6000
+G1 X23.20 S1.0 F6000
+G1 X23.30 S0.9 F6000
+G1 X23.40 S1.0 F6000
+G1 X23.50 S0.9 F6000
+G1 X23.60 S0.8 F6000
+G1 X23.80 S0.9 F6000
+G1 X23.90 S0.8 F6000
+G1 X24.10 S0.6 F6000
+G1 X24.20 S0.8 F6000
+G1 X24.30 S0.6 F6000
+G1 X24.40 S0.7 F6000
+G1 X24.50 S0.6 F6000
+G1 X24.60 S0.5 F6000
+G1 X24.70 S0.4 F6000
+G1 X24.80 S0.5 F6000
+G1 X24.90 S0.4 F6000
+G0 X24.90 Y13.30
+G1 X24.90 S0.3 F6000
+G1 X24.80 S0.4 F6000
+G1 X24.70 S0.5 F6000
+G1 X24.50 S0.4 F6000
+G1 X24.40 S0.5 F6000
+G1 X24.30 S0.6 F6000
+G1 X24.20 S0.5 F6000
+G1 X24.10 S0.7 F6000
+G1 X24.00 S0.6 F6000
+G1 X23.90 S0.8 F6000
+G1 X23.80 S0.7 F6000
+G1 X23.60 S0.9 F6000
+G1 X23.10 S1.0 F6000
+G1 X23.00 S0.9 F6000
+G1 X22.90 S1.0 F6000
+G1 X22.80 S0.9 F6000
+G1 X22.70 S1.0 F6000
+G1 X22.60 S0.9 F6000
+G1 X22.50 S1.0 F6000
+G1 X22.40 S0.9 F6000
+G1 X22.20 S1.0 F6000
+G1 X22.10 S0.9 F6000
+G1 X21.90 S0.8 F6000
+G1 X21.80 S0.9 F6000
+G1 X21.70 S0.8 F6000
+G1 X21.60 S0.9 F6000
+G1 X21.50 S0.8 F6000
+G1 X21.20 S0.6 F6000
+G1 X21.10 S0.7 F6000
+G1 X21.00 S0.5 F6000
+G1 X20.90 S0.7 F6000
+G1 X20.80 S0.5 F6000
+G1 X20.70 S0.6 F6000
+G1 X20.60 S0.4 F6000
+G1 X20.50 S0.5 F6000
+G1 X20.40 S0.4 F6000
+G1 X20.30 S0.3 F6000
+G1 X20.20 S0.2 F6000
+G1 X20.10 S0.3 F6000
+G1 X20.00 S0.2 F6000
+G1 X19.90 S0.1 F6000
+G1 X19.70 S0.2 F6000
+G1 X19.60 S0.0 F6000
+G1 X19.30 S0.1 F6000
+G1 X19.20 S0.0 F6000
+G1 X19.10 S0.1 F6000
+G1 X19.00 S0.0 F6000
+G1 X18.40 S0.1 F6000
+G1 X18.30 S0.0 F6000
+G1 X18.20 S0.2 F6000
+G1 X18.10 S0.0 F6000
+G1 X18.00 S0.1 F6000
+G1 X17.90 S0.2 F6000
+G1 X17.60 S0.3 F6000
+G1 X17.50 S0.2 F6000
+G1 X17.30 S0.4 F6000
+G1 X17.20 S0.5 F6000
+G1 X17.00 S0.4 F6000
+G1 X16.90 S0.5 F6000
+G1 X16.80 S0.6 F6000
+G1 X16.60 S0.7 F6000
+G1 X16.50 S0.6 F6000
+G1 X16.30 S0.7 F6000
+G1 X16.10 S0.8 F6000
+G1 X16.00 S0.9 F6000
+G1 X15.80 S0.8 F6000
+G1 X15.70 S0.9 F6000
+G1 X15.60 S1.0 F6000
+G1 X15.40 S0.9 F6000
+G1 X15.30 S1.0 F6000
+G1 X14.90 S0.9 F6000
+G1 X14.80 S1.0 F6000
+G1 X14.60 S0.9 F6000
+G1 X14.40 S1.0 F6000
+G1 X14.30 S0.9 F6000
+G1 X14.10 S0.8 F6000
+G1 X13.50 S0.6 F6000
+G1 X13.40 S0.5 F6000
+G1 X13.30 S0.6 F6000
+G1 X13.10 S0.5 F6000
+G1 X13.00 S0.4 F6000
+G1 X12.90 S0.5 F6000
+G1 X12.80 S0.4 F6000
+G1 X12.60 S0.3 F6000
+G1 X12.40 S0.1 F6000
+G1 X12.00 S0.0 F6000
+G1 X11.80 S0.1 F6000
+G1 X11.70 S0.0 F6000
+G1 X10.90 S0.1 F6000
+G1 X10.60 S0.0 F6000
+G1 X10.50 S0.1 F6000
+G1 X10.00 S0.3 F6000
+G0 X10.00 Y13.40
+G1 X10.00 S0.3 F6000
+G1 X10.10 S0.1 F6000
+G1 X10.30 S0.0 F6000
+G1 X10.40 S0.1 F6000
+G1 X10.60 S0.0 F6000
+G1 X10.70 S0.1 F6000
+G1 X10.90 S0.0 F6000
+G1 X11.00 S0.1 F6000
+G1 X11.10 S0.0 F6000
+G1 X11.60 S0.1 F6000
+G1 X11.70 S0.0 F6000
+G1 X11.80 S0.1 F6000
+G1 X12.10 S0.2 F6000
+G1 X12.20 S0.1 F6000
+G1 X12.40 S0.3 F6000
+G1 X12.70 S0.4 F6000
+G1 X12.90 S0.5 F6000
+G1 X13.10 S0.6 F6000
+G1 X13.30 S0.7 F6000
+G1 X13.50 S0.6 F6000
+G1 X13.60 S0.7 F6000
+G1 X13.70 S0.8 F6000
+G1 X14.10 S1.0 F6000
+G1 X14.20 S0.9 F6000
+G1 X14.30 S1.0 F6000
+G1 X14.40 S0.9 F6000
+G1 X14.60 S1.0 F6000
+G1 X14.90 S0.9 F6000
+G1 X15.10 S1.0 F6000
+G1 X15.20 S0.9 F6000
+G1 X15.30 S1.0 F6000
+G1 X15.40 S0.9 F6000
+G1 X15.70 S0.8 F6000
+G1 X16.00 S0.9 F6000
+G1 X16.10 S0.8 F6000
+G1 X16.20 S0.7 F6000
+G1 X16.50 S0.6 F6000
+G1 X16.70 S0.5 F6000
+G1 X16.80 S0.6 F6000
+G1 X16.90 S0.4 F6000
+G1 X17.00 S0.3 F6000
+G1 X17.10 S0.4 F6000
+G1 X17.20 S0.3 F6000
+G1 X17.50 S0.2 F6000
+G1 X17.60 S0.1 F6000
+G1 X17.70 S0.2 F6000
+G1 X17.80 S0.0 F6000
+G1 X17.90 S0.1 F6000
+G1 X18.20 S0.0 F6000
+G1 X18.30 S0.1 F6000
+G1 X18.40 S0.0 F6000
+G1 X18.80 S0.1 F6000
+G1 X18.90 S0.0 F6000
+G1 X19.00 S0.1 F6000
+G1 X19.10 S0.0 F6000
+G1 X19.30 S0.1 F6000
+G1 X19.40 S0.0 F6000
+G1 X19.60 S0.1 F6000
+G1 X19.80 S0.2 F6000
+G1 X19.90 S0.3 F6000
+G1 X20.20 S0.4 F6000
+G1 X20.30 S0.5 F6000
+G1 X20.50 S0.4 F6000
+G1 X20.60 S0.6 F6000
+G1 X20.70 S0.5 F6000
+G1 X20.80 S0.7 F6000
+G1 X20.90 S0.6 F6000
+G1 X21.00 S0.7 F6000
+G1 X21.10 S0.8 F6000
+G1 X21.40 S0.9 F6000
+G1 X22.20 S1.0 F6000
+G1 X22.30 S0.9 F6000
+G1 X22.40 S1.0 F6000
+G1 X22.50 S0.9 F6000
+G1 X22.70 S1.0 F6000
+G1 X22.90 S0.9 F6000
+G1 X23.00 S1.0 F6000
+G1 X23.10 S0.9 F6000
+G1 X23.40 S0.8 F6000
+G1 X23.50 S0.7 F6000
+G1 X23.60 S0.9 F6000
+G1 X23.70 S0.7 F6000
+G1 X23.90 S0.6 F6000
+G1 X24.10 S0.5 F6000
+G1 X24.40 S0.4 F6000
+G1 X24.70 S0.2 F6000
+G1 X24.80 S0.3 F6000
+G0 X24.90 Y13.50
+G1 X24.90 S0.3 F6000
+G1 X24.30 S0.4 F6000
+G1 X24.20 S0.6 F6000
+G1 X24.00 S0.7 F6000
+G1 X23.90 S0.6 F6000
+G1 X23.70 S0.7 F6000
+G1 X23.40 S0.8 F6000
+G1 X23.30 S0.9 F6000
+G1 X23.10 S0.8 F6000
+G1 X22.90 S0.9 F6000
+G1 X22.70 S1.0 F6000
+G1 X22.60 S0.9 F6000
+G1 X22.50 S1.0 F6000
+G1 X21.90 S0.9 F6000
+G1 X21.30 S0.8 F6000
+G1 X21.10 S0.7 F6000
+G1 X21.00 S0.8 F6000
+G1 X20.90 S0.6 F6000
+G1 X20.80 S0.8 F6000
+G1 X20.70 S0.6 F6000
+G1 X20.50 S0.5 F6000
+G1 X20.30 S0.6 F6000
+G1 X20.20 S0.4 F6000
+G1 X20.00 S0.3 F6000
+G1 X19.90 S0.2 F6000
+G1 X19.60 S0.3 F6000
+G1 X19.50 S0.1 F6000
+G1 X19.10 S0.0 F6000
+G1 X19.00 S0.1 F6000
+G1 X18.90 S0.0 F6000
+G1 X18.80 S0.1 F6000
+G1 X18.60 S0.0 F6000
+G1 X18.30 S0.1 F6000
+G1 X18.20 S0.0 F6000
+G1 X18.00 S0.1 F6000
+G1 X17.70 S0.0 F6000
+G1 X17.60 S0.2 F6000
+G1 X17.50 S0.1 F6000
+G1 X17.40 S0.2 F6000
+G1 X17.20 S0.3 F6000
+G1 X17.00 S0.4 F6000
+G1 X16.80 S0.5 F6000
+G1 X16.40 S0.7 F6000
+G1 X16.00 S0.8 F6000
+G1 X15.70 S0.9 F6000
+G1 X15.60 S1.0 F6000
+G1 X15.50 S0.8 F6000
+G1 X15.40 S0.9 F6000
+G1 X15.30 S1.0 F6000
+G1 X14.90 S0.9 F6000
+G1 X14.80 S1.0 F6000
+G1 X14.60 S0.9 F6000
+G1 X14.50 S1.0 F6000
+G1 X13.90 S0.9 F6000
+G1 X13.80 S0.8 F6000
+G1 X13.70 S0.9 F6000
+G1 X13.60 S0.8 F6000
+G1 X13.30 S0.7 F6000
+G1 X13.20 S0.6 F6000
+G1 X13.10 S0.5 F6000
+G1 X12.90 S0.6 F6000
+G1 X12.80 S0.5 F6000
+G1 X12.70 S0.4 F6000
+G1 X12.60 S0.3 F6000
+G1 X12.50 S0.4 F6000
+G1 X12.40 S0.3 F6000
+G1 X12.30 S0.4 F6000
+G1 X12.20 S0.2 F6000
+G1 X12.00 S0.1 F6000
+G1 X11.90 S0.2 F6000
+G1 X11.80 S0.0 F6000
+G1 X11.50 S0.1 F6000
+G1 X11.30 S0.0 F6000
+G1 X11.20 S0.1 F6000
+G1 X11.00 S0.0 F6000
+G1 X10.70 S0.1 F6000
+G1 X10.50 S0.0 F6000
+G1 X10.40 S0.1 F6000
+G1 X10.00 S0.2 F6000
+G0 X10.00 Y13.60
+G1 X10.00 S0.1 F6000
+G1 X10.20 S0.0 F6000
+G1 X10.30 S0.1 F6000
+G1 X10.40 S0.0 F6000
+G1 X10.50 S0.1 F6000
+G1 X10.60 S0.0 F6000
+G1 X10.80 S0.1 F6000
+G1 X10.90 S0.0 F6000
+G1 X11.00 S0.1 F6000
+G1 X11.10 S0.0 F6000
+G1 X11.40 S0.1 F6000
+G1 X11.50 S0.0 F6000
+G1 X11.60 S0.2 F6000
+G1 X11.70 S0.1 F6000
+G1 X11.90 S0.2 F6000
+G1 X12.00 S0.3 F6000
+G1 X12.20 S0.2 F6000
+G1 X12.30 S0.4 F6000
+G1 X12.40 S0.3 F6000
+G1 X12.50 S0.4 F6000
+G1 X12.70 S0.6 F6000
+G1 X12.80 S0.4 F6000
+G1 X12.90 S0.6 F6000
+G1 X13.10 S0.7 F6000
+G1 X13.20 S0.6 F6000
+G1 X13.40 S0.7 F6000
+G1 X13.50 S0.8 F6000
+G1 X13.60 S0.7 F6000
+G1 X13.70 S0.9 F6000
+G1 X13.90 S1.0 F6000
+G1 X14.10 S0.9 F6000
+G1 X14.20 S1.0 F6000
+G1 X14.50 S0.9 F6000
+G1 X14.70 S1.0 F6000
+G1 X15.40 S0.9 F6000
+G1 X15.60 S0.8 F6000
+G1 X15.80 S0.7 F6000
+G1 X16.00 S0.8 F6000
+G1 X16.10 S0.6 F6000
+G1 X16.20 S0.7 F6000
+G1 X16.30 S0.6 F6000
+G1 X16.40 S0.5 F6000
+G1 X16.70 S0.4 F6000
+G1 X16.80 S0.5 F6000
+G1 X16.90 S0.3 F6000
+G1 X17.00 S0.4 F6000
+G1 X17.20 S0.3 F6000
+G1 X17.40 S0.1 F6000
+G1 X17.80 S0.2 F6000
+G1 X17.90 S0.1 F6000
+G1 X18.30 S0.0 F6000
+G1 X18.70 S0.1 F6000
+G1 X18.80 S0.0 F6000
+G1 X19.00 S0.2 F6000
+G1 X19.10 S0.1 F6000
+G1 X19.30 S0.2 F6000
+G1 X19.40 S0.1 F6000
+G1 X19.60 S0.2 F6000
+G1 X19.80 S0.3 F6000
+G1 X19.90 S0.4 F6000
+G1 X20.10 S0.3 F6000
+G1 X20.20 S0.5 F6000
+G1 X20.50 S0.6 F6000
+G1 X20.80 S0.7 F6000
+G1 X20.90 S0.8 F6000
+G1 X21.00 S0.7 F6000
+G1 X21.20 S0.9 F6000
+G1 X21.40 S0.8 F6000
+G1 X21.60 S0.9 F6000
+G1 X21.70 S1.0 F6000
+G1 X22.00 S0.9 F6000
+G1 X22.20 S1.0 F6000
+G1 X22.30 S0.9 F6000
+G1 X22.50 S1.0 F6000
+G1 X22.60 S0.9 F6000
+G1 X22.80 S1.0 F6000
+G1 X23.00 S0.8 F6000
+G1 X23.10 S0.9 F6000
+G1 X23.30 S0.8 F6000
+G1 X23.40 S0.7 F6000
+G1 X23.80 S0.6 F6000
+G1 X23.90 S0.5 F6000
+G1 X24.00 S0.6 F6000
+G1 X24.10 S0.4 F6000
+G1 X24.20 S0.5 F6000
+G1 X24.40 S0.4 F6000
+G1 X24.50 S0.2 F6000
+G0 X24.90 Y13.70
+G1 X24.90 S0.1 F6000
+G1 X24.70 S0.3 F6000
+G1 X24.50 S0.2 F6000
+G1 X24.40 S0.4 F6000
+G1 X24.30 S0.3 F6000
+G1 X24.20 S0.5 F6000
+G1 X23.80 S0.6 F6000
+G1 X23.40 S0.8 F6000
+G1 X23.10 S0.9 F6000
+G1 X23.00 S0.8 F6000
+G1 X22.90 S0.9 F6000
+G1 X22.60 S1.0 F6000
+G1 X21.90 S0.9 F6000
+G1 X21.80 S1.0 F6000
+G1 X21.60 S0.9 F6000
+G1 X21.40 S0.8 F6000
+G1 X21.30 S1.0 F6000
+G1 X21.20 S0.9 F6000
+G1 X21.00 S0.8 F6000
+G1 X20.90 S0.9 F6000
+G1 X20.80 S0.8 F6000
+G1 X20.70 S0.7 F6000
+G1 X20.60 S0.8 F6000
+G1 X20.50 S0.7 F6000
+G1 X20.40 S0.6 F6000
+G1 X20.30 S0.5 F6000
+G1 X20.00 S0.4 F6000
+G1 X19.80 S0.3 F6000
+G1 X19.40 S0.1 F6000
+G1 X19.30 S0.3 F6000
+G1 X19.20 S0.1 F6000
+G1 X19.10 S0.2 F6000
+G1 X19.00 S0.1 F6000
+G1 X18.80 S0.0 F6000
+G1 X18.60 S0.1 F6000
+G1 X18.50 S0.0 F6000
+G1 X17.90 S0.1 F6000
+G1 X17.80 S0.0 F6000
+G1 X17.60 S0.2 F6000
+G1 X17.50 S0.1 F6000
+G1 X17.40 S0.2 F6000
+G1 X17.30 S0.1 F6000
+G1 X17.20 S0.2 F6000
+G1 X16.70 S0.4 F6000
+G1 X16.60 S0.3 F6000
+G1 X16.50 S0.5 F6000
+G1 X16.40 S0.4 F6000
+G1 X16.30 S0.5 F6000
+G1 X16.10 S0.7 F6000
+G1 X16.00 S0.6 F6000
+G1 X15.90 S0.7 F6000
+G1 X15.80 S0.6 F6000
+G1 X15.70 S0.7 F6000
+G1 X15.60 S0.8 F6000
+G1 X15.50 S0.9 F6000
+G1 X15.20 S1.0 F6000
+G1 X15.00 S0.9 F6000
+G1 X14.80 S1.0 F6000
+G1 X14.70 S0.9 F6000
+G1 X14.60 S1.0 F6000
+G1 X14.50 S0.9 F6000
+G1 X14.30 S1.0 F6000
+G1 X14.20 S0.9 F6000
+G1 X14.10 S1.0 F6000
+G1 X14.00 S0.9 F6000
+G1 X13.80 S1.0 F6000
+G1 X13.60 S0.9 F6000
+G1 X13.50 S0.8 F6000
+G1 X13.10 S0.7 F6000
+G1 X13.00 S0.6 F6000
+G1 X12.90 S0.7 F6000
+G1 X12.80 S0.5 F6000
+G1 X12.50 S0.4 F6000
+G1 X12.10 S0.3 F6000
+G1 X12.00 S0.2 F6000
+G1 X11.90 S0.3 F6000
+G1 X11.70 S0.1 F6000
+G1 X11.30 S0.0 F6000
+G1 X11.00 S0.1 F6000
+G1 X10.90 S0.0 F6000
+G1 X10.60 S0.1 F6000
+G1 X10.50 S0.0 F6000
+G1 X10.40 S0.1 F6000
+G1 X10.20 S0.0 F6000
+G0 X10.00 Y13.80
+G1 X10.00 S0.1 F6000
+G1 X10.10 S0.0 F6000
+G1 X10.20 S0.1 F6000
+G1 X10.30 S0.0 F6000
+G1 X10.40 S0.1 F6000
+G1 X10.50 S0.0 F6000
+G1 X10.60 S0.1 F6000
+G1 X10.80 S0.0 F6000
+G1 X11.00 S0.1 F6000
+G1 X11.50 S0.0 F6000
+G1 X11.60 S0.2 F6000
+G1 X11.70 S0.3 F6000
+G1 X11.90 S0.4 F6000
+G1 X12.20 S0.5 F6000
+G1 X12.40 S0.4 F6000
+G1 X12.50 S0.5 F6000
+G1 X12.70 S0.6 F6000
+G1 X12.80 S0.7 F6000
+G1 X12.90 S0.6 F6000
+G1 X13.10 S0.7 F6000
+G1 X13.20 S0.8 F6000
+G1 X13.30 S0.9 F6000
+G1 X13.40 S0.8 F6000
+G1 X13.50 S0.9 F6000
+G1 X13.60 S0.8 F6000
+G1 X13.70 S1.0 F6000
+G1 X14.40 S0.9 F6000
+G1 X14.60 S1.0 F6000
+G1 X14.70 S0.9 F6000
+G1 X14.80 S1.0 F6000
+G1 X14.90 S0.9 F6000
+G1 X15.00 S1.0 F6000
+G1 X15.10 S0.9 F6000
+G1 X15.20 S1.0 F6000
+G1 X15.30 S0.8 F6000
+G1 X15.40 S0.7 F6000
+G1 X15.60 S0.8 F6000
+G1 X15.90 S0.7 F6000
+G1 X16.00 S0.5 F6000
+G1 X16.10 S0.7 F6000
+G1 X16.20 S0.4 F6000
+G1 X16.30 S0.5 F6000
+G1 X16.50 S0.4 F6000
+G1 X16.60 S0.3 F6000
+G1 X16.70 S0.4 F6000
+G1 X16.80 S0.2 F6000
+G1 X16.90 S0.3 F6000
+G1 X17.00 S0.2 F6000
+G1 X17.10 S0.1 F6000
+G1 X17.20 S0.2 F6000
+G1 X17.40 S0.1 F6000
+G1 X17.60 S0.0 F6000
+G1 X17.90 S0.1 F6000
+G1 X18.00 S0.0 F6000
+G1 X18.40 S0.1 F6000
+G1 X18.50 S0.0 F6000
+G1 X18.70 S0.1 F6000
+G1 X19.10 S0.2 F6000
+G1 X19.20 S0.3 F6000
+G1 X19.30 S0.2 F6000
+G1 X19.40 S0.3 F6000
+G1 X19.60 S0.4 F6000
+G1 X19.90 S0.5 F6000
+G1 X20.10 S0.6 F6000
+G1 X20.40 S0.7 F6000
+G1 X20.70 S0.8 F6000
+G1 X20.80 S0.9 F6000
+G1 X20.90 S0.8 F6000
+G1 X21.00 S0.9 F6000
+G1 X21.20 S1.0 F6000
+G1 X21.60 S0.9 F6000
+G1 X21.80 S1.0 F6000
+G1 X21.90 S0.9 F6000
+G1 X22.10 S1.0 F6000
+G1 X22.60 S0.9 F6000
+G1 X22.80 S0.8 F6000
+G1 X23.00 S0.7 F6000
+G1 X23.20 S0.8 F6000
+G1 X23.30 S0.7 F6000
+G1 X23.40 S0.6 F6000
+G1 X23.60 S0.7 F6000
+G1 X23.70 S0.5 F6000
+G1 X24.00 S0.3 F6000
+G1 X24.10 S0.4 F6000
+G1 X24.30 S0.2 F6000
+G1 X24.50 S0.3 F6000
+G1 X24.70 S0.2 F6000
+G1 X24.80 S0.0 F6000
+G0 X24.90 Y13.90
+G1 X24.90 S0.0 F6000
+G1 X24.80 S0.1 F6000
+G1 X24.60 S0.2 F6000
+G1 X24.40 S0.3 F6000
+G1 X24.30 S0.2 F6000
+G1 X24.20 S0.3 F6000
+G1 X24.00 S0.4 F6000
+G1 X23.80 S0.5 F6000
+G1 X23.30 S0.7 F6000
+G1 X22.90 S0.8 F6000
+G1 X22.80 S0.9 F6000
+G1 X22.70 S1.0 F6000
+G1 X22.60 S0.8 F6000
+G1 X22.50 S0.9 F6000
+G1 X22.40 S1.0 F6000
+G1 X22.30 S0.9 F6000
+G1 X22.10 S1.0 F6000
+G1 X21.40 S0.9 F6000
+G1 X21.10 S1.0 F6000
+G1 X20.90 S0.8 F6000
+G1 X20.50 S0.7 F6000
+G1 X20.30 S0.6 F6000
+G1 X19.90 S0.4 F6000
+G1 X19.80 S0.6 F6000
+G1 X19.70 S0.4 F6000
+G1 X19.50 S0.3 F6000
+G1 X19.30 S0.2 F6000
+G1 X19.20 S0.1 F6000
+G1 X19.10 S0.2 F6000
+G1 X19.00 S0.1 F6000
+G1 X18.80 S0.2 F6000
+G1 X18.70 S0.1 F6000
+G1 X18.60 S0.2 F6000
+G1 X18.50 S0.1 F6000
+G1 X18.40 S0.0 F6000
+G1 X18.10 S0.1 F6000
+G1 X18.00 S0.0 F6000
+G1 X17.90 S0.1 F6000
+G1 X17.80 S0.0 F6000
+G1 X17.60 S0.1 F6000
+G1 X17.50 S0.0 F6000
+G1 X17.40 S0.1 F6000
+G1 X17.30 S0.0 F6000
+G1 X17.20 S0.1 F6000
+G1 X17.10 S0.2 F6000
+G1 X16.90 S0.3 F6000
+G1 X16.80 S0.2 F6000
+G1 X16.70 S0.4 F6000
+G1 X16.50 S0.3 F6000
+G1 X16.40 S0.4 F6000
+G1 X16.10 S0.5 F6000
+G1 X15.90 S0.6 F6000
+G1 X15.80 S0.7 F6000
+G1 X15.40 S0.9 F6000
+G1 X15.30 S0.8 F6000
+G1 X14.90 S0.9 F6000
+G1 X14.60 S1.0 F6000
+G1 X14.30 S0.9 F6000
+G1 X14.20 S1.0 F6000
+G1 X13.70 S0.9 F6000
+G1 X13.60 S1.0 F6000
+G1 X13.40 S0.9 F6000
+G1 X13.10 S0.7 F6000
+G1 X13.00 S0.8 F6000
+G1 X12.80 S0.7 F6000
+G1 X12.70 S0.6 F6000
+G1 X12.50 S0.5 F6000
+G1 X12.40 S0.6 F6000
+G1 X12.30 S0.5 F6000
+G1 X12.00 S0.4 F6000
+G1 X11.80 S0.3 F6000
+G1 X11.70 S0.2 F6000
+G1 X11.50 S0.1 F6000
+G1 X11.10 S0.2 F6000
+G1 X11.00 S0.0 F6000
+G1 X10.80 S0.1 F6000
+G1 X10.60 S0.0 F6000
+G1 X10.50 S0.1 F6000
+G1 X10.40 S0.0 F6000
+G0 X10.00 Y14.00
+G1 X10.00 S0.1 F6000
+G1 X10.10 S0.0 F6000
+G1 X11.00 S0.1 F6000
+G1 X11.10 S0.2 F6000
+G1 X11.20 S0.1 F6000
+G1 X11.30 S0.2 F6000
+G1 X11.40 S0.1 F6000
+G1 X11.50 S0.2 F6000
+G1 X11.60 S0.3 F6000
+G1 X11.70 S0.2 F6000
+G1 X11.80 S0.3 F6000
+G1 X12.10 S0.5 F6000
+G1 X12.30 S0.6 F6000
+G1 X12.40 S0.5 F6000
+G1 X12.50 S0.6 F6000
+G1 X12.60 S0.7 F6000
+G1 X12.70 S0.6 F6000
+G1 X12.80 S0.7 F6000
+G1 X13.10 S0.8 F6000
+G1 X13.20 S0.9 F6000
+G1 X13.30 S0.8 F6000
+G1 X13.40 S1.0 F6000
+G1 X13.60 S0.9 F6000
+G1 X13.70 S1.0 F6000
+G1 X14.50 S0.9 F6000
+G1 X14.70 S1.0 F6000
+G1 X14.90 S0.9 F6000
+G1 X15.10 S0.8 F6000
+G1 X15.30 S0.7 F6000
+G1 X15.40 S0.8 F6000
+G1 X15.50 S0.6 F6000
+G1 X15.70 S0.7 F6000
+G1 X15.80 S0.6 F6000
+G1 X15.90 S0.5 F6000
+G1 X16.20 S0.4 F6000
+G1 X16.30 S0.5 F6000
+G1 X16.40 S0.4 F6000
+G1 X16.50 S0.2 F6000
+G1 X16.70 S0.3 F6000
+G1 X16.80 S0.2 F6000
+G1 X16.90 S0.1 F6000
+G1 X17.20 S0.0 F6000
+G1 X17.70 S0.1 F6000
+G1 X17.80 S0.0 F6000
+G1 X17.90 S0.1 F6000
+G1 X18.00 S0.0 F6000
+G1 X18.10 S0.1 F6000
+G1 X18.30 S0.0 F6000
+G1 X18.60 S0.1 F6000
+G1 X18.80 S0.2 F6000
+G1 X18.90 S0.1 F6000
+G1 X19.00 S0.2 F6000
+G1 X19.10 S0.3 F6000
+G1 X19.50 S0.4 F6000
+G1 X19.60 S0.5 F6000
+G1 X19.70 S0.4 F6000
+G1 X19.80 S0.5 F6000
+G1 X19.90 S0.6 F6000
+G1 X20.00 S0.5 F6000
+G1 X20.10 S0.7 F6000
+G1 X20.20 S0.6 F6000
+G1 X20.30 S0.8 F6000
+G1 X20.40 S0.7 F6000
+G1 X20.60 S0.8 F6000
+G1 X20.70 S0.9 F6000
+G1 X20.80 S0.8 F6000
+G1 X21.00 S0.9 F6000
+G1 X21.10 S1.0 F6000
+G1 X21.40 S0.9 F6000
+G1 X21.50 S1.0 F6000
+G1 X21.60 S0.9 F6000
+G1 X21.80 S1.0 F6000
+G1 X22.20 S0.9 F6000
+G1 X22.30 S1.0 F6000
+G1 X22.50 S0.9 F6000
+G1 X22.90 S0.7 F6000
+G1 X23.10 S0.6 F6000
+G1 X23.20 S0.5 F6000
+G1 X23.30 S0.6 F6000
+G1 X23.40 S0.5 F6000
+G1 X23.50 S0.4 F6000
+G1 X23.60 S0.5 F6000
+G1 X23.70 S0.3 F6000
+G1 X23.80 S0.5 F6000
+G1 X23.90 S0.4 F6000
+G1 X24.10 S0.2 F6000
+G1 X24.30 S0.1 F6000
+G1 X24.40 S0.2 F6000
+G1 X24.60 S0.0 F6000
+G1 X24.70 S0.2 F6000
+G1 X24.80 S0.0 F6000
+G1 X24.90 S0.1 F6000
+G0 X24.90 Y14.10
+G1 X24.90 S0.0 F6000
+G1 X24.80 S0.1 F6000
+G1 X24.70 S0.0 F6000
+G1 X24.60 S0.2 F6000
+G1 X24.40 S0.1 F6000
+G1 X24.20 S0.2 F6000
+G1 X24.10 S0.3 F6000
+G1 X24.00 S0.2 F6000
+G1 X23.70 S0.4 F6000
+G1 X23.60 S0.5 F6000
+G1 X23.10 S0.6 F6000
+G1 X23.00 S0.7 F6000
+G1 X22.70 S0.8 F6000
+G1 X22.40 S0.9 F6000
+G1 X22.00 S1.0 F6000
+G1 X21.70 S0.9 F6000
+G1 X21.60 S1.0 F6000
+G1 X21.40 S0.9 F6000
+G1 X21.30 S1.0 F6000
+G1 X21.10 S0.9 F6000
+G1 X21.00 S1.0 F6000
+G1 X20.70 S0.8 F6000
+G1 X20.50 S0.9 F6000
+G1 X20.30 S0.7 F6000
+G1 X20.20 S0.8 F6000
+G1 X20.00 S0.6 F6000
+G1 X19.80 S0.7 F6000
+G1 X19.70 S0.5 F6000
+G1 X19.40 S0.3 F6000
+G1 X19.30 S0.4 F6000
+G1 X19.20 S0.3 F6000
+G1 X19.10 S0.2 F6000
+G1 X18.90 S0.3 F6000
+G1 X18.70 S0.2 F6000
+G1 X18.50 S0.1 F6000
+G1 X18.40 S0.0 F6000
+G1 X18.20 S0.1 F6000
+G1 X18.10 S0.0 F6000
+G1 X18.00 S0.1 F6000
+G1 X17.90 S0.0 F6000
+G1 X17.40 S0.1 F6000
+G1 X17.30 S0.0 F6000
+G1 X17.20 S0.1 F6000
+G1 X17.10 S0.0 F6000
+G1 X17.00 S0.1 F6000
+G1 X16.70 S0.2 F6000
+G1 X16.60 S0.3 F6000
+G1 X16.50 S0.1 F6000
+G1 X16.40 S0.3 F6000
+G1 X16.30 S0.4 F6000
+G1 X16.10 S0.3 F6000
+G1 X16.00 S0.4 F6000
+G1 X15.80 S0.5 F6000
+G1 X15.60 S0.7 F6000
+G1 X15.50 S0.6 F6000
+G1 X15.40 S0.8 F6000
+G1 X15.30 S0.7 F6000
+G1 X15.10 S0.8 F6000
+G1 X15.00 S0.9 F6000
+G1 X14.40 S1.0 F6000
+G1 X14.30 S0.9 F6000
+G1 X14.20 S1.0 F6000
+G1 X14.00 S0.9 F6000
+G1 X13.90 S1.0 F6000
+G1 X13.40 S0.9 F6000
+G1 X12.90 S0.8 F6000
+G1 X12.80 S0.7 F6000
+G1 X12.50 S0.6 F6000
+G1 X12.40 S0.5 F6000
+G1 X12.30 S0.7 F6000
+G1 X12.20 S0.6 F6000
+G1 X12.10 S0.4 F6000
+G1 X11.70 S0.3 F6000
+G1 X11.40 S0.2 F6000
+G1 X11.30 S0.1 F6000
+G1 X11.20 S0.2 F6000
+G1 X11.00 S0.1 F6000
+G1 X10.90 S0.2 F6000
+G1 X10.80 S0.0 F6000
+G0 X10.00 Y14.20
+G1 X10.00 S0.0 F6000
+G1 X10.10 S0.1 F6000
+G1 X10.20 S0.0 F6000
+G1 X10.60 S0.1 F6000
+G1 X10.80 S0.2 F6000
+G1 X10.90 S0.0 F6000
+G1 X11.00 S0.2 F6000
+G1 X11.20 S0.3 F6000
+G1 X11.30 S0.2 F6000
+G1 X11.60 S0.3 F6000
+G1 X11.70 S0.4 F6000
+G1 X11.90 S0.6 F6000
+G1 X12.00 S0.5 F6000
+G1 X12.30 S0.7 F6000
+G1 X12.60 S0.8 F6000
+G1 X12.70 S0.7 F6000
+G1 X12.80 S0.9 F6000
+G1 X13.00 S1.0 F6000
+G1 X13.20 S0.9 F6000
+G1 X13.30 S1.0 F6000
+G1 X13.40 S0.9 F6000
+G1 X13.50 S1.0 F6000
+G1 X13.60 S0.9 F6000
+G1 X13.70 S1.0 F6000
+G1 X13.90 S0.9 F6000
+G1 X14.00 S1.0 F6000
+G1 X14.30 S0.9 F6000
+G1 X14.50 S1.0 F6000
+G1 X14.60 S0.9 F6000
+G1 X14.70 S0.8 F6000
+G1 X15.10 S0.7 F6000
+G1 X15.30 S0.6 F6000
+G1 X15.50 S0.5 F6000
+G1 X15.60 S0.6 F6000
+G1 X15.80 S0.5 F6000
+G1 X15.90 S0.4 F6000
+G1 X16.00 S0.3 F6000
+G1 X16.30 S0.2 F6000
+G1 X16.40 S0.3 F6000
+G1 X16.50 S0.2 F6000
+G1 X16.60 S0.3 F6000
+G1 X16.70 S0.2 F6000
+G1 X16.80 S0.1 F6000
+G1 X17.00 S0.0 F6000
+G1 X17.30 S0.1 F6000
+G1 X17.40 S0.0 F6000
+G1 X17.80 S0.1 F6000
+G1 X17.90 S0.0 F6000
+G1 X18.40 S0.1 F6000
+G1 X18.50 S0.2 F6000
+G1 X18.70 S0.1 F6000
+G1 X18.80 S0.2 F6000
+G1 X18.90 S0.3 F6000
+G1 X19.00 S0.4 F6000
+G1 X19.10 S0.3 F6000
+G1 X19.30 S0.4 F6000
+G1 X19.40 S0.5 F6000
+G1 X19.50 S0.6 F6000
+G1 X19.60 S0.5 F6000
+G1 X19.80 S0.7 F6000
+G1 X20.00 S0.6 F6000
+G1 X20.10 S0.8 F6000
+G1 X20.30 S0.9 F6000
+G1 X20.40 S0.8 F6000
+G1 X20.50 S0.9 F6000
+G1 X20.70 S1.0 F6000
+G1 X20.80 S0.9 F6000
+G1 X20.90 S1.0 F6000
+G1 X21.10 S0.9 F6000
+G1 X21.20 S1.0 F6000
+G1 X21.60 S0.9 F6000
+G1 X21.70 S1.0 F6000
+G1 X21.90 S0.9 F6000
+G1 X22.00 S1.0 F6000
+G1 X22.10 S0.9 F6000
+G1 X22.20 S1.0 F6000
+G1 X22.40 S0.8 F6000
+G1 X22.50 S0.9 F6000
+G1 X22.60 S0.7 F6000
+G1 X22.70 S0.8 F6000
+G1 X22.80 S0.7 F6000
+G1 X23.00 S0.6 F6000
+G1 X23.10 S0.5 F6000
+G1 X23.20 S0.6 F6000
+G1 X23.30 S0.4 F6000
+G1 X23.60 S0.3 F6000
+G1 X23.90 S0.2 F6000
+G1 X24.00 S0.3 F6000
+G1 X24.10 S0.2 F6000
+G1 X24.30 S0.1 F6000
+G1 X24.40 S0.0 F6000
+G1 X24.70 S0.1 F6000
+G1 X24.90 S0.0 F6000
+G0 X24.90 Y14.30
+G1 X24.90 S0.1 F6000
+G1 X24.80 S0.0 F6000
+G1 X24.10 S0.1 F6000
+G1 X23.80 S0.2 F6000
+G1 X23.60 S0.3 F6000
+G1 X23.50 S0.2 F6000
+G1 X23.40 S0.3 F6000
+G1 X23.30 S0.4 F6000
+G1 X23.20 S0.5 F6000
+G1 X23.10 S0.6 F6000
+G1 X23.00 S0.5 F6000
+G1 X22.90 S0.7 F6000
+G1 X22.80 S0.5 F6000
+G1 X22.70 S0.6 F6000
+G1 X22.60 S0.8 F6000
+G1 X22.20 S0.9 F6000
+G1 X22.00 S1.0 F6000
+G1 X21.90 S0.9 F6000
+G1 X21.70 S1.0 F6000
+G1 X21.30 S0.9 F6000
+G1 X21.10 S1.0 F6000
+G1 X21.00 S0.9 F6000
+G1 X20.30 S0.8 F6000
+G1 X20.20 S0.9 F6000
+G1 X20.10 S0.8 F6000
+G1 X19.80 S0.6 F6000
+G1 X19.50 S0.5 F6000
+G1 X19.20 S0.4 F6000
+G1 X18.90 S0.3 F6000
+G1 X18.60 S0.2 F6000
+G1 X18.50 S0.1 F6000
+G1 X18.40 S0.2 F6000
+G1 X18.30 S0.1 F6000
+G1 X18.00 S0.0 F6000
+G1 X17.70 S0.1 F6000
+G1 X17.60 S0.0 F6000
+G1 X17.20 S0.1 F6000
+G1 X17.10 S0.0 F6000
+G1 X16.90 S0.1 F6000
+G1 X16.70 S0.2 F6000
+G1 X16.30 S0.3 F6000
+G1 X16.20 S0.2 F6000
+G1 X16.10 S0.3 F6000
+G1 X16.00 S0.4 F6000
+G1 X15.90 S0.3 F6000
+G1 X15.80 S0.4 F6000
+G1 X15.60 S0.5 F6000
+G1 X15.50 S0.6 F6000
+G1 X15.40 S0.5 F6000
+G1 X15.30 S0.6 F6000
+G1 X15.10 S0.7 F6000
+G1 X14.90 S0.8 F6000
+G1 X14.80 S0.9 F6000
+G1 X14.70 S0.8 F6000
+G1 X14.60 S0.9 F6000
+G1 X14.30 S1.0 F6000
+G1 X13.70 S0.9 F6000
+G1 X13.50 S1.0 F6000
+G1 X13.00 S0.9 F6000
+G1 X12.90 S1.0 F6000
+G1 X12.80 S0.8 F6000
+G1 X12.30 S0.7 F6000
+G1 X12.10 S0.6 F6000
+G1 X12.00 S0.7 F6000
+G1 X11.90 S0.4 F6000
+G1 X11.80 S0.5 F6000
+G1 X11.50 S0.4 F6000
+G1 X11.40 S0.3 F6000
+G1 X11.30 S0.2 F6000
+G1 X11.20 S0.4 F6000
+G1 X11.10 S0.2 F6000
+G1 X11.00 S0.1 F6000
+G1 X10.70 S0.2 F6000
+G1 X10.50 S0.1 F6000
+G1 X10.20 S0.0 F6000
+G0 X10.00 Y14.40
+G1 X10.00 S0.1 F6000
+G1 X10.10 S0.0 F6000
+G1 X10.50 S0.2 F6000
+G1 X10.70 S0.1 F6000
+G1 X10.80 S0.2 F6000
+G1 X11.20 S0.4 F6000
+G1 X11.40 S0.5 F6000
+G1 X11.60 S0.4 F6000
+G1 X11.70 S0.6 F6000
+G1 X12.20 S0.8 F6000
+G1 X12.30 S0.7 F6000
+G1 X12.40 S0.8 F6000
+G1 X12.70 S0.9 F6000
+G1 X12.80 S1.0 F6000
+G1 X12.90 S0.8 F6000
+G1 X13.00 S0.9 F6000
+G1 X13.10 S1.0 F6000
+G1 X13.20 S0.9 F6000
+G1 X13.30 S1.0 F6000
+G1 X13.90 S0.9 F6000
+G1 X14.00 S1.0 F6000
+G1 X14.30 S0.9 F6000
+G1 X14.50 S0.8 F6000
+G1 X14.60 S0.7 F6000
+G1 X14.70 S0.8 F6000
+G1 X15.10 S0.7 F6000
+G1 X15.20 S0.6 F6000
+G1 X15.30 S0.5 F6000
+G1 X15.60 S0.4 F6000
+G1 X15.70 S0.3 F6000
+G1 X15.80 S0.4 F6000
+G1 X16.00 S0.3 F6000
+G1 X16.20 S0.1 F6000
+G1 X16.30 S0.2 F6000
+G1 X16.40 S0.1 F6000
+G1 X16.50 S0.2 F6000
+G1 X16.60 S0.1 F6000
+G1 X16.90 S0.0 F6000
+G1 X17.60 S0.1 F6000
+G1 X18.10 S0.0 F6000
+G1 X18.30 S0.2 F6000
+G1 X18.50 S0.3 F6000
+G1 X18.60 S0.2 F6000
+G1 X18.70 S0.3 F6000
+G1 X18.80 S0.4 F6000
+G1 X19.10 S0.6 F6000
+G1 X19.30 S0.5 F6000
+G1 X19.40 S0.7 F6000
+G1 X19.50 S0.6 F6000
+G1 X19.60 S0.7 F6000
+G1 X19.80 S0.8 F6000
+G1 X19.90 S0.9 F6000
+G1 X20.00 S0.8 F6000
+G1 X20.30 S0.9 F6000
+G1 X20.40 S1.0 F6000
+G1 X20.80 S0.9 F6000
+G1 X20.90 S1.0 F6000
+G1 X21.10 S0.9 F6000
+G1 X21.40 S1.0 F6000
+G1 X21.60 S0.9 F6000
+G1 X21.70 S1.0 F6000
+G1 X21.80 S0.9 F6000
+G1 X22.20 S0.8 F6000
+G1 X22.30 S0.7 F6000
+G1 X22.50 S0.6 F6000
+G1 X22.70 S0.5 F6000
+G1 X23.00 S0.4 F6000
+G1 X23.10 S0.5 F6000
+G1 X23.20 S0.4 F6000
+G1 X23.40 S0.3 F6000
+G1 X23.50 S0.2 F6000
+G1 X24.00 S0.1 F6000
+G1 X24.10 S0.0 F6000
+G1 X24.20 S0.1 F6000
+G1 X24.40 S0.0 F6000
+G1 X24.50 S0.1 F6000
+G1 X24.70 S0.0 F6000
+G1 X24.80 S0.1 F6000
+G0 X24.90 Y14.50
+G1 X24.90 S0.0 F6000
+G1 X24.10 S0.1 F6000
+G1 X24.00 S0.2 F6000
+G1 X23.80 S0.1 F6000
+G1 X23.50 S0.2 F6000
+G1 X23.40 S0.3 F6000
+G1 X23.20 S0.4 F6000
+G1 X22.80 S0.5 F6000
+G1 X22.60 S0.7 F6000
+G1 X22.10 S0.8 F6000
+G1 X22.00 S0.9 F6000
+G1 X21.80 S1.0 F6000
+G1 X21.70 S0.8 F6000
+G1 X21.60 S1.0 F6000
+G1 X21.40 S0.9 F6000
+G1 X21.20 S1.0 F6000
+G1 X20.30 S0.9 F6000
+G1 X20.20 S1.0 F6000
+G1 X20.10 S0.8 F6000
+G1 X20.00 S0.9 F6000
+G1 X19.90 S0.8 F6000
+G1 X19.70 S0.7 F6000
+G1 X19.50 S0.8 F6000
+G1 X19.40 S0.6 F6000
+G1 X19.10 S0.5 F6000
+G1 X19.00 S0.4 F6000
+G1 X18.60 S0.3 F6000
+G1 X18.50 S0.2 F6000
+G1 X18.40 S0.3 F6000
+G1 X18.30 S0.1 F6000
+G1 X18.20 S0.3 F6000
+G1 X18.10 S0.1 F6000
+G1 X18.00 S0.0 F6000
+G1 X17.90 S0.1 F6000
+G1 X17.80 S0.0 F6000
+G1 X17.50 S0.1 F6000
+G1 X17.40 S0.0 F6000
+G1 X17.00 S0.1 F6000
+G1 X16.90 S0.0 F6000
+G1 X16.80 S0.1 F6000
+G1 X16.60 S0.0 F6000
+G1 X16.30 S0.2 F6000
+G1 X15.80 S0.3 F6000
+G1 X15.60 S0.5 F6000
+G1 X15.50 S0.4 F6000
+G1 X15.40 S0.5 F6000
+G1 X15.30 S0.6 F6000
+G1 X15.20 S0.5 F6000
+G1 X15.00 S0.7 F6000
+G1 X14.90 S0.6 F6000
+G1 X14.80 S0.7 F6000
+G1 X14.70 S0.8 F6000
+G1 X14.60 S0.7 F6000
+G1 X14.50 S0.9 F6000
+G1 X14.20 S0.8 F6000
+G1 X14.10 S1.0 F6000
+G1 X13.30 S0.9 F6000
+G1 X13.20 S1.0 F6000
+G1 X12.80 S0.9 F6000
+G1 X12.60 S0.8 F6000
+G1 X12.40 S0.9 F6000
+G1 X12.20 S0.8 F6000
+G1 X12.00 S0.6 F6000
+G1 X11.80 S0.7 F6000
+G1 X11.70 S0.5 F6000
+G1 X11.50 S0.4 F6000
+G1 X11.40 S0.5 F6000
+G1 X11.20 S0.3 F6000
+G1 X10.80 S0.1 F6000
+G1 X10.70 S0.3 F6000
+G1 X10.60 S0.2 F6000
+G1 X10.50 S0.1 F6000
+G1 X10.40 S0.2 F6000
+G1 X10.30 S0.0 F6000
+G1 X10.20 S0.1 F6000
+G0 X10.00 Y14.60
+G1 X10.00 S0.1 F6000
+G1 X10.20 S0.0 F6000
+G1 X10.30 S0.2 F6000
+G1 X10.40 S0.1 F6000
+G1 X10.50 S0.2 F6000
+G1 X10.80 S0.3 F6000
+G1 X10.90 S0.4 F6000
+G1 X11.10 S0.3 F6000
+G1 X11.30 S0.5 F6000
+G1 X11.50 S0.6 F6000
+G1 X11.60 S0.5 F6000
+G1 X11.80 S0.6 F6000
+G1 X12.00 S0.8 F6000
+G1 X12.20 S0.9 F6000
+G1 X12.30 S0.8 F6000
+G1 X12.40 S0.9 F6000
+G1 X12.90 S1.0 F6000
+G1 X13.00 S0.9 F6000
+G1 X13.20 S1.0 F6000
+G1 X13.30 S0.9 F6000
+G1 X13.40 S1.0 F6000
+G1 X13.70 S0.9 F6000
+G1 X13.80 S1.0 F6000
+G1 X13.90 S0.9 F6000
+G1 X14.20 S0.8 F6000
+G1 X14.30 S0.9 F6000
+G1 X14.40 S0.8 F6000
+G1 X14.50 S0.7 F6000
+G1 X14.60 S0.6 F6000
+G1 X14.70 S0.8 F6000
+G1 X14.80 S0.7 F6000
+G1 X14.90 S0.6 F6000
+G1 X15.20 S0.5 F6000
+G1 X15.50 S0.4 F6000
+G1 X15.60 S0.3 F6000
+G1 X15.70 S0.2 F6000
+G1 X15.90 S0.3 F6000
+G1 X16.00 S0.2 F6000
+G1 X16.30 S0.1 F6000
+G1 X16.40 S0.0 F6000
+G1 X16.70 S0.1 F6000
+G1 X17.00 S0.0 F6000
+G1 X17.20 S0.1 F6000
+G1 X17.30 S0.0 F6000
+G1 X17.70 S0.1 F6000
+G1 X17.80 S0.0 F6000
+G1 X17.90 S0.1 F6000
+G1 X18.00 S0.2 F6000
+G1 X18.10 S0.1 F6000
+G1 X18.20 S0.2 F6000
+G1 X18.40 S0.3 F6000
+G1 X18.60 S0.4 F6000
+G1 X18.70 S0.5 F6000
+G1 X18.80 S0.3 F6000
+G1 X18.90 S0.4 F6000
+G1 X19.00 S0.6 F6000
+G1 X19.30 S0.7 F6000
+G1 X19.40 S0.6 F6000
+G1 X19.50 S0.8 F6000
+G1 X19.90 S0.9 F6000
+G1 X20.20 S1.0 F6000
+G1 X20.40 S0.9 F6000
+G1 X20.50 S1.0 F6000
+G1 X20.70 S0.9 F6000
+G1 X20.80 S1.0 F6000
+G1 X21.10 S0.9 F6000
+G1 X21.20 S1.0 F6000
+G1 X21.40 S0.9 F6000
+G1 X21.70 S0.8 F6000
+G1 X21.90 S0.9 F6000
+G1 X22.00 S0.8 F6000
+G1 X22.10 S0.7 F6000
+G1 X22.20 S0.6 F6000
+G1 X22.30 S0.7 F6000
+G1 X22.40 S0.6 F6000
+G1 X22.50 S0.7 F6000
+G1 X22.60 S0.6 F6000
+G1 X22.70 S0.5 F6000
+G1 X22.80 S0.4 F6000
+G1 X23.00 S0.5 F6000
+G1 X23.10 S0.3 F6000
+G1 X23.50 S0.1 F6000
+G1 X24.00 S0.0 F6000
+G1 X24.70 S0.1 F6000
+G1 X24.80 S0.0 F6000
+G0 X24.90 Y14.70
+G1 X24.90 S0.1 F6000
+G1 X24.80 S0.0 F6000
+G1 X24.50 S0.1 F6000
+G1 X24.20 S0.0 F6000
+G1 X24.00 S0.1 F6000
+G1 X23.90 S0.0 F6000
+G1 X23.60 S0.1 F6000
+G1 X23.40 S0.3 F6000
+G1 X23.30 S0.2 F6000
+G1 X23.10 S0.3 F6000
+G1 X23.00 S0.4 F6000
+G1 X22.90 S0.3 F6000
+G1 X22.70 S0.5 F6000
+G1 X22.30 S0.6 F6000
+G1 X22.10 S0.7 F6000
+G1 X22.00 S0.8 F6000
+G1 X21.90 S0.7 F6000
+G1 X21.80 S0.8 F6000
+G1 X21.70 S0.9 F6000
+G1 X21.60 S0.8 F6000
+G1 X21.50 S0.9 F6000
+G1 X21.20 S1.0 F6000
+G1 X21.00 S0.9 F6000
+G1 X20.90 S1.0 F6000
+G1 X20.40 S0.9 F6000
+G1 X20.20 S1.0 F6000
+G1 X20.00 S0.8 F6000
+G1 X19.90 S0.9 F6000
+G1 X19.80 S0.8 F6000
+G1 X19.30 S0.7 F6000
+G1 X19.10 S0.6 F6000
+G1 X19.00 S0.5 F6000
+G1 X18.90 S0.6 F6000
+G1 X18.70 S0.4 F6000
+G1 X18.60 S0.3 F6000
+G1 X18.40 S0.2 F6000
+G1 X18.30 S0.3 F6000
+G1 X18.20 S0.2 F6000
+G1 X18.10 S0.3 F6000
+G1 X18.00 S0.1 F6000
+G1 X17.90 S0.2 F6000
+G1 X17.80 S0.1 F6000
+G1 X17.70 S0.2 F6000
+G1 X17.60 S0.0 F6000
+G1 X17.50 S0.1 F6000
+G1 X17.40 S0.0 F6000
+G1 X17.30 S0.1 F6000
+G1 X17.10 S0.0 F6000
+G1 X16.90 S0.1 F6000
+G1 X16.60 S0.0 F6000
+G1 X16.40 S0.1 F6000
+G1 X16.20 S0.0 F6000
+G1 X16.10 S0.2 F6000
+G1 X16.00 S0.1 F6000
+G1 X15.80 S0.2 F6000
+G1 X15.50 S0.3 F6000
+G1 X15.40 S0.4 F6000
+G1 X15.30 S0.3 F6000
+G1 X15.20 S0.4 F6000
+G1 X15.10 S0.5 F6000
+G1 X15.00 S0.6 F6000
+G1 X14.60 S0.7 F6000
+G1 X14.50 S0.8 F6000
+G1 X14.40 S0.7 F6000
+G1 X14.20 S0.8 F6000
+G1 X14.00 S0.9 F6000
+G1 X13.90 S1.0 F6000
+G1 X13.80 S0.9 F6000
+G1 X13.50 S1.0 F6000
+G1 X12.80 S0.9 F6000
+G1 X12.60 S1.0 F6000
+G1 X12.40 S0.9 F6000
+G1 X12.20 S0.8 F6000
+G1 X11.70 S0.7 F6000
+G1 X11.60 S0.6 F6000
+G1 X11.30 S0.4 F6000
+G1 X11.10 S0.5 F6000
+G1 X11.00 S0.4 F6000
+G1 X10.90 S0.3 F6000
+G1 X10.60 S0.2 F6000
+G1 X10.40 S0.3 F6000
+G1 X10.30 S0.2 F6000
+G1 X10.20 S0.1 F6000
+G1 X10.10 S0.0 F6000
+G1 X10.00 S0.1 F6000
+G0 X10.00 Y14.80
+G1 X10.00 S0.0 F6000
+G1 X10.10 S0.1 F6000
+G1 X10.30 S0.2 F6000
+G1 X10.40 S0.3 F6000
+G1 X10.50 S0.2 F6000
+G1 X10.60 S0.3 F6000
+G1 X10.90 S0.5 F6000
+G1 X11.00 S0.4 F6000
+G1 X11.20 S0.5 F6000
+G1 X11.30 S0.6 F6000
+G1 X11.40 S0.5 F6000
+G1 X11.50 S0.6 F6000
+G1 X11.60 S0.7 F6000
+G1 X11.70 S0.8 F6000
+G1 X11.80 S0.7 F6000
+G1 X12.00 S0.8 F6000
+G1 X12.10 S1.0 F6000
+G1 X12.20 S0.9 F6000
+G1 X12.30 S1.0 F6000
+G1 X12.40 S0.9 F6000
+G1 X12.50 S1.0 F6000
+G1 X12.60 S0.9 F6000
+G1 X12.90 S1.0 F6000
+G1 X13.60 S0.9 F6000
+G1 X13.70 S0.8 F6000
+G1 X13.80 S0.9 F6000
+G1 X13.90 S0.8 F6000
+G1 X14.30 S0.7 F6000
+G1 X14.40 S0.6 F6000
+G1 X14.70 S0.5 F6000
+G1 X15.00 S0.4 F6000
+G1 X15.20 S0.5 F6000
+G1 X15.30 S0.3 F6000
+G1 X15.40 S0.4 F6000
+G1 X15.50 S0.3 F6000
+G1 X15.60 S0.2 F6000
+G1 X15.80 S0.3 F6000
+G1 X15.90 S0.0 F6000
+G1 X16.00 S0.1 F6000
+G1 X16.40 S0.0 F6000
+G1 X16.80 S0.1 F6000
+G1 X16.90 S0.0 F6000
+G1 X17.10 S0.1 F6000
+G1 X17.20 S0.0 F6000
+G1 X17.30 S0.1 F6000
+G1 X17.40 S0.0 F6000
+G1 X17.50 S0.2 F6000
+G1 X17.60 S0.1 F6000
+G1 X17.70 S0.2 F6000
+G1 X18.20 S0.3 F6000
+G1 X18.40 S0.5 F6000
+G1 X18.50 S0.4 F6000
+G1 X18.70 S0.5 F6000
+G1 X18.80 S0.6 F6000
+G1 X18.90 S0.5 F6000
+G1 X19.00 S0.6 F6000
+G1 X19.10 S0.7 F6000
+G1 X19.30 S0.8 F6000
+G1 X19.40 S0.9 F6000
+G1 X19.50 S0.7 F6000
+G1 X19.60 S0.8 F6000
+G1 X19.90 S0.9 F6000
+G1 X20.00 S1.0 F6000
+G1 X20.10 S0.9 F6000
+G1 X20.20 S1.0 F6000
+G1 X20.30 S0.9 F6000
+G1 X20.50 S1.0 F6000
+G1 X20.60 S0.9 F6000
+G1 X20.70 S1.0 F6000
+G1 X21.20 S0.9 F6000
+G1 X21.60 S0.8 F6000
+G1 X21.70 S0.9 F6000
+G1 X21.80 S0.8 F6000
+G1 X22.00 S0.6 F6000
+G1 X22.10 S0.7 F6000
+G1 X22.20 S0.6 F6000
+G1 X22.40 S0.5 F6000
+G1 X22.70 S0.4 F6000
+G1 X22.80 S0.3 F6000
+G1 X22.90 S0.4 F6000
+G1 X23.00 S0.3 F6000
+G1 X23.30 S0.2 F6000
+G1 X23.40 S0.1 F6000
+G1 X23.50 S0.0 F6000
+G1 X23.60 S0.1 F6000
+G1 X23.90 S0.0 F6000
+G1 X24.00 S0.1 F6000
+G1 X24.10 S0.0 F6000
+G1 X24.20 S0.1 F6000
+G1 X24.30 S0.0 F6000
+G1 X24.60 S0.1 F6000
+G1 X24.70 S0.0 F6000
+G1 X24.90 S0.1 F6000
+G0 X24.90 Y14.90
+G1 X24.90 S0.2 F6000
+G1 X24.80 S0.0 F6000
+G1 X24.70 S0.1 F6000
+G1 X24.60 S0.0 F6000
+G1 X24.40 S0.1 F6000
+G1 X24.30 S0.0 F6000
+G1 X24.20 S0.1 F6000
+G1 X24.10 S0.0 F6000
+G1 X24.00 S0.1 F6000
+G1 X23.80 S0.0 F6000
+G1 X23.40 S0.2 F6000
+G1 X23.10 S0.1 F6000
+G1 X22.90 S0.2 F6000
+G1 X22.70 S0.3 F6000
+G1 X22.60 S0.5 F6000
+G1 X22.50 S0.4 F6000
+G1 X22.20 S0.5 F6000
+G1 X22.00 S0.6 F6000
+G1 X21.80 S0.7 F6000
+G1 X21.50 S0.8 F6000
+G1 X21.40 S0.9 F6000
+G1 X21.00 S1.0 F6000
+G1 X20.50 S0.9 F6000
+G1 X20.30 S1.0 F6000
+G1 X20.00 S0.9 F6000
+G1 X19.90 S1.0 F6000
+G1 X19.80 S0.9 F6000
+G1 X19.50 S0.8 F6000
+G1 X19.40 S0.9 F6000
+G1 X19.30 S0.7 F6000
+G1 X19.10 S0.6 F6000
+G1 X19.00 S0.7 F6000
+G1 X18.90 S0.6 F6000
+G1 X18.50 S0.4 F6000
+G1 X18.00 S0.3 F6000
+G1 X17.70 S0.2 F6000
+G1 X17.50 S0.1 F6000
+G1 X17.40 S0.0 F6000
+G1 X17.10 S0.1 F6000
+G1 X17.00 S0.0 F6000
+G1 X16.90 S0.1 F6000
+G1 X16.80 S0.0 F6000
+G1 X16.40 S0.1 F6000
+G1 X16.30 S0.0 F6000
+G1 X16.00 S0.1 F6000
+G1 X15.90 S0.0 F6000
+G1 X15.80 S0.1 F6000
+G1 X15.70 S0.2 F6000
+G1 X15.60 S0.1 F6000
+G1 X15.50 S0.2 F6000
+G1 X15.30 S0.3 F6000
+G1 X15.10 S0.4 F6000
+G1 X15.00 S0.3 F6000
+G1 X14.90 S0.4 F6000
+G1 X14.80 S0.6 F6000
+G1 X14.60 S0.5 F6000
+G1 X14.50 S0.6 F6000
+G1 X14.40 S0.7 F6000
+G1 X14.30 S0.8 F6000
+G1 X14.20 S0.7 F6000
+G1 X14.10 S0.9 F6000
+G1 X13.90 S0.8 F6000
+G1 X13.70 S1.0 F6000
+G1 X13.60 S0.9 F6000
+G1 X13.50 S1.0 F6000
+G1 X13.10 S0.9 F6000
+G1 X12.90 S1.0 F6000
+G1 X12.80 S0.9 F6000
+G1 X12.50 S1.0 F6000
+G1 X12.40 S0.9 F6000
+G1 X12.30 S1.0 F6000
+G1 X12.20 S0.8 F6000
+G1 X12.10 S0.9 F6000
+G1 X12.00 S1.0 F6000
+G1 X11.90 S0.8 F6000
+G1 X11.70 S0.9 F6000
+G1 X11.60 S0.8 F6000
+G1 X11.40 S0.7 F6000
+G1 X11.30 S0.6 F6000
+G1 X11.10 S0.4 F6000
+G1 X11.00 S0.5 F6000
+G1 X10.90 S0.4 F6000
+G1 X10.80 S0.5 F6000
+G1 X10.70 S0.4 F6000
+G1 X10.50 S0.3 F6000
+G1 X10.40 S0.4 F6000
+G1 X10.30 S0.2 F6000
+G1 X10.00 S0.1 F6000
+G0 X10.00 Y15.00
+G1 X10.00 S0.2 F6000
+G1 X10.10 S0.1 F6000
+G1 X10.20 S0.3 F6000
+G1 X10.40 S0.2 F6000
+G1 X10.50 S0.3 F6000
+G1 X10.60 S0.4 F6000
+G1 X10.70 S0.5 F6000
+G1 X10.80 S0.4 F6000
+G1 X10.90 S0.5 F6000
+G1 X11.10 S0.6 F6000
+G1 X11.40 S0.7 F6000
+G1 X11.60 S0.8 F6000
+G1 X11.70 S0.9 F6000
+G1 X11.80 S0.8 F6000
+G1 X11.90 S0.9 F6000
+G1 X12.50 S1.0 F6000
+G1 X13.10 S0.9 F6000
+G1 X13.20 S1.0 F6000
+G1 X13.60 S0.9 F6000
+G1 X13.80 S0.8 F6000
+G1 X13.90 S0.9 F6000
+G1 X14.00 S0.7 F6000
+G1 X14.30 S0.6 F6000
+G1 X14.70 S0.5 F6000
+G1 X14.80 S0.4 F6000
+G1 X14.90 S0.5 F6000
+G1 X15.00 S0.3 F6000
+G1 X15.30 S0.2 F6000
+G1 X15.80 S0.0 F6000
+G1 X15.90 S0.1 F6000
+G1 X16.10 S0.0 F6000
+G1 X16.90 S0.1 F6000
+G1 X17.00 S0.0 F6000
+G1 X17.10 S0.1 F6000
+G1 X17.20 S0.0 F6000
+G1 X17.30 S0.1 F6000
+G1 X17.40 S0.2 F6000
+G1 X17.50 S0.1 F6000
+G1 X17.60 S0.2 F6000
+G1 X17.70 S0.1 F6000
+G1 X17.80 S0.3 F6000
+G1 X18.00 S0.4 F6000
+G1 X18.30 S0.5 F6000
+G1 X18.40 S0.4 F6000
+G1 X18.50 S0.5 F6000
+G1 X18.60 S0.6 F6000
+G1 X18.90 S0.7 F6000
+G1 X19.00 S0.8 F6000
+G1 X19.40 S0.9 F6000
+G1 X19.90 S1.0 F6000
+G1 X20.20 S0.9 F6000
+G1 X20.30 S1.0 F6000
+G1 X20.50 S0.9 F6000
+G1 X20.60 S1.0 F6000
+G1 X20.70 S0.9 F6000
+G1 X20.90 S0.8 F6000
+G1 X21.00 S0.9 F6000
+G1 X21.30 S0.8 F6000
+G1 X21.40 S0.7 F6000
+G1 X21.50 S0.8 F6000
+G1 X21.60 S0.7 F6000
+G1 X21.80 S0.6 F6000
+G1 X22.20 S0.5 F6000
+G1 X22.40 S0.4 F6000
+G1 X22.70 S0.3 F6000
+G1 X22.80 S0.2 F6000
+G1 X22.90 S0.3 F6000
+G1 X23.00 S0.2 F6000
+G1 X23.10 S0.1 F6000
+G1 X23.20 S0.2 F6000
+G1 X23.30 S0.1 F6000
+G1 X23.50 S0.0 F6000
+G1 X24.50 S0.1 F6000
+G1 X24.70 S0.0 F6000
+G1 X24.80 S0.1 F6000
+G1 X24.90 S0.2 F6000
+G0 X24.90 Y15.10
+G1 X24.90 S0.1 F6000
+G1 X24.80 S0.0 F6000
+G1 X24.70 S0.1 F6000
+G1 X24.50 S0.0 F6000
+G1 X24.40 S0.1 F6000
+G1 X24.30 S0.0 F6000
+G1 X24.10 S0.1 F6000
+G1 X24.00 S0.0 F6000
+G1 X23.80 S0.1 F6000
+G1 X23.70 S0.0 F6000
+G1 X23.40 S0.1 F6000
+G1 X23.00 S0.2 F6000
+G1 X22.80 S0.3 F6000
+G1 X22.60 S0.2 F6000
+G1 X22.50 S0.3 F6000
+G1 X22.40 S0.4 F6000
+G1 X22.10 S0.5 F6000
+G1 X22.00 S0.6 F6000
+G1 X21.60 S0.7 F6000
+G1 X21.50 S0.8 F6000
+G1 X21.30 S0.7 F6000
+G1 X21.20 S0.8 F6000
+G1 X21.00 S0.9 F6000
+G1 X20.70 S1.0 F6000
+G1 X20.60 S0.9 F6000
+G1 X20.50 S1.0 F6000
+G1 X20.40 S0.9 F6000
+G1 X20.10 S1.0 F6000
+G1 X20.00 S0.9 F6000
+G1 X19.90 S1.0 F6000
+G1 X19.80 S0.9 F6000
+G1 X19.40 S1.0 F6000
+G1 X19.30 S0.9 F6000
+G1 X19.20 S0.8 F6000
+G1 X19.00 S0.7 F6000
+G1 X18.60 S0.6 F6000
+G1 X18.40 S0.5 F6000
+G1 X18.00 S0.4 F6000
+G1 X17.90 S0.3 F6000
+G1 X17.80 S0.4 F6000
+G1 X17.70 S0.2 F6000
+G1 X17.50 S0.1 F6000
+G1 X17.30 S0.2 F6000
+G1 X17.20 S0.0 F6000
+G1 X16.80 S0.1 F6000
+G1 X16.60 S0.0 F6000
+G1 X16.10 S0.1 F6000
+G1 X15.40 S0.2 F6000
+G1 X15.30 S0.3 F6000
+G1 X15.20 S0.2 F6000
+G1 X14.90 S0.3 F6000
+G1 X14.60 S0.5 F6000
+G1 X14.50 S0.6 F6000
+G1 X14.40 S0.5 F6000
+G1 X14.30 S0.6 F6000
+G1 X13.90 S0.8 F6000
+G1 X13.40 S0.9 F6000
+G1 X13.30 S0.8 F6000
+G1 X13.20 S1.0 F6000
+G1 X13.00 S0.9 F6000
+G1 X12.90 S1.0 F6000
+G1 X12.60 S0.9 F6000
+G1 X12.50 S1.0 F6000
+G1 X11.90 S0.8 F6000
+G1 X11.80 S1.0 F6000
+G1 X11.70 S0.9 F6000
+G1 X11.60 S0.8 F6000
+G1 X11.50 S0.7 F6000
+G1 X11.30 S0.6 F6000
+G1 X11.10 S0.7 F6000
+G1 X11.00 S0.5 F6000
+G1 X10.80 S0.6 F6000
+G1 X10.70 S0.4 F6000
+G1 X10.50 S0.5 F6000
+G1 X10.40 S0.4 F6000
+G1 X10.30 S0.3 F6000
+G1 X10.20 S0.2 F6000
+G1 X10.10 S0.3 F6000
+G0 X10.00 Y15.20
+G1 X10.00 S0.3 F6000
+G1 X10.20 S0.2 F6000
+G1 X10.30 S0.3 F6000
+G1 X10.50 S0.4 F6000
+G1 X10.60 S0.5 F6000
+G1 X10.80 S0.6 F6000
+G1 X11.00 S0.7 F6000
+G1 X11.20 S0.8 F6000
+G1 X11.40 S0.9 F6000
+G1 X11.60 S0.8 F6000
+G1 X11.80 S0.9 F6000
+G1 X12.10 S1.0 F6000
+G1 X12.40 S0.9 F6000
+G1 X12.50 S1.0 F6000
+G1 X12.60 S0.9 F6000
+G1 X12.70 S1.0 F6000
+G1 X12.90 S0.9 F6000
+G1 X13.20 S1.0 F6000
+G1 X13.30 S0.9 F6000
+G1 X13.40 S0.8 F6000
+G1 X13.50 S0.9 F6000
+G1 X13.70 S0.7 F6000
+G1 X14.10 S0.6 F6000
+G1 X14.30 S0.4 F6000
+G1 X14.40 S0.5 F6000
+G1 X14.50 S0.4 F6000
+G1 X14.70 S0.3 F6000
+G1 X14.80 S0.4 F6000
+G1 X14.90 S0.3 F6000
+G1 X15.10 S0.2 F6000
+G1 X15.50 S0.1 F6000
+G1 X15.90 S0.0 F6000
+G1 X16.10 S0.1 F6000
+G1 X16.30 S0.0 F6000
+G1 X16.90 S0.1 F6000
+G1 X17.00 S0.0 F6000
+G1 X17.10 S0.1 F6000
+G1 X17.20 S0.2 F6000
+G1 X17.40 S0.1 F6000
+G1 X17.50 S0.2 F6000
+G1 X17.70 S0.3 F6000
+G1 X17.90 S0.5 F6000
+G1 X18.20 S0.4 F6000
+G1 X18.30 S0.5 F6000
+G1 X18.50 S0.6 F6000
+G1 X18.60 S0.7 F6000
+G1 X18.90 S0.9 F6000
+G1 X19.00 S0.8 F6000
+G1 X19.20 S0.9 F6000
+G1 X19.30 S0.8 F6000
+G1 X19.40 S0.9 F6000
+G1 X19.60 S1.0 F6000
+G1 X19.80 S0.9 F6000
+G1 X19.90 S1.0 F6000
+G1 X20.00 S0.9 F6000
+G1 X20.10 S1.0 F6000
+G1 X20.20 S0.9 F6000
+G1 X20.30 S1.0 F6000
+G1 X20.90 S0.8 F6000
+G1 X21.30 S0.7 F6000
+G1 X21.50 S0.8 F6000
+G1 X21.60 S0.7 F6000
+G1 X21.70 S0.6 F6000
+G1 X21.80 S0.5 F6000
+G1 X22.10 S0.4 F6000
+G1 X22.20 S0.3 F6000
+G1 X22.30 S0.4 F6000
+G1 X22.40 S0.2 F6000
+G1 X22.50 S0.3 F6000
+G1 X22.60 S0.2 F6000
+G1 X22.70 S0.1 F6000
+G1 X22.80 S0.2 F6000
+G1 X23.00 S0.1 F6000
+G1 X23.10 S0.0 F6000
+G1 X23.20 S0.1 F6000
+G1 X23.40 S0.0 F6000
+G1 X23.50 S0.1 F6000
+G1 X23.60 S0.0 F6000
+G1 X23.90 S0.1 F6000
+G1 X24.00 S0.0 F6000
+G1 X24.20 S0.1 F6000
+G1 X24.40 S0.0 F6000
+G1 X24.50 S0.1 F6000
+G0 X24.90 Y15.30
+G1 X24.90 S0.2 F6000
+G1 X24.80 S0.3 F6000
+G1 X24.70 S0.1 F6000
+G1 X24.60 S0.2 F6000
+G1 X24.50 S0.0 F6000
+G1 X24.40 S0.1 F6000
+G1 X24.30 S0.0 F6000
+G1 X24.00 S0.1 F6000
+G1 X23.90 S0.0 F6000
+G1 X23.80 S0.1 F6000
+G1 X23.60 S0.0 F6000
+G1 X23.10 S0.1 F6000
+G1 X23.00 S0.0 F6000
+G1 X22.90 S0.1 F6000
+G1 X22.60 S0.2 F6000
+G1 X22.50 S0.1 F6000
+G1 X22.40 S0.2 F6000
+G1 X22.30 S0.4 F6000
+G1 X22.20 S0.3 F6000
+G1 X22.10 S0.4 F6000
+G1 X21.90 S0.5 F6000
+G1 X21.70 S0.6 F6000
+G1 X21.60 S0.5 F6000
+G1 X21.50 S0.6 F6000
+G1 X21.30 S0.7 F6000
+G1 X21.20 S0.8 F6000
+G1 X21.00 S0.7 F6000
+G1 X20.90 S0.9 F6000
+G1 X20.80 S0.8 F6000
+G1 X20.70 S0.9 F6000
+G1 X20.30 S1.0 F6000
+G1 X20.10 S0.9 F6000
+G1 X20.00 S1.0 F6000
+G1 X19.80 S0.9 F6000
+G1 X19.70 S1.0 F6000
+G1 X19.30 S0.9 F6000
+G1 X19.20 S1.0 F6000
+G1 X19.10 S0.9 F6000
+G1 X19.00 S0.8 F6000
+G1 X18.50 S0.7 F6000
+G1 X18.40 S0.8 F6000
+G1 X18.30 S0.6 F6000
+G1 X18.10 S0.4 F6000
+G1 X18.00 S0.6 F6000
+G1 X17.90 S0.4 F6000
+G1 X17.80 S0.3 F6000
+G1 X17.70 S0.4 F6000
+G1 X17.50 S0.3 F6000
+G1 X17.30 S0.1 F6000
+G1 X17.20 S0.2 F6000
+G1 X17.10 S0.1 F6000
+G1 X17.00 S0.0 F6000
+G1 X16.90 S0.1 F6000
+G1 X16.80 S0.0 F6000
+G1 X16.70 S0.1 F6000
+G1 X16.20 S0.0 F6000
+G1 X15.50 S0.1 F6000
+G1 X15.30 S0.2 F6000
+G1 X15.20 S0.1 F6000
+G1 X15.10 S0.2 F6000
+G1 X15.00 S0.3 F6000
+G1 X14.60 S0.4 F6000
+G1 X14.50 S0.5 F6000
+G1 X14.30 S0.4 F6000
+G1 X14.20 S0.6 F6000
+G1 X13.90 S0.7 F6000
+G1 X13.60 S0.8 F6000
+G1 X13.50 S0.7 F6000
+G1 X13.40 S0.8 F6000
+G1 X13.30 S0.9 F6000
+G1 X13.20 S0.8 F6000
+G1 X13.10 S0.9 F6000
+G1 X13.00 S1.0 F6000
+G1 X12.80 S0.9 F6000
+G1 X12.60 S1.0 F6000
+G1 X12.50 S0.9 F6000
+G1 X12.40 S1.0 F6000
+G1 X11.90 S0.9 F6000
+G1 X11.70 S1.0 F6000
+G1 X11.40 S0.8 F6000
+G1 X11.20 S0.7 F6000
+G1 X10.80 S0.6 F6000
+G1 X10.70 S0.7 F6000
+G1 X10.60 S0.5 F6000
+G1 X10.50 S0.6 F6000
+G1 X10.40 S0.4 F6000
+G1 X10.30 S0.3 F6000
+G1 X10.20 S0.5 F6000
+G1 X10.10 S0.3 F6000
+G1 X10.00 S0.4 F6000
+G0 X10.00 Y15.40
+G1 X10.00 S0.4 F6000
+G1 X10.20 S0.5 F6000
+G1 X10.30 S0.4 F6000
+G1 X10.40 S0.5 F6000
+G1 X10.50 S0.6 F6000
+G1 X10.70 S0.7 F6000
+G1 X10.80 S0.6 F6000
+G1 X10.90 S0.7 F6000
+G1 X11.10 S0.8 F6000
+G1 X11.50 S0.9 F6000
+G1 X11.80 S1.0 F6000
+G1 X12.10 S0.9 F6000
+G1 X12.30 S1.0 F6000
+G1 X12.70 S0.9 F6000
+G1 X12.80 S1.0 F6000
+G1 X13.00 S0.9 F6000
+G1 X13.30 S0.8 F6000
+G1 X13.50 S0.7 F6000
+G1 X13.60 S0.6 F6000
+G1 X13.70 S0.8 F6000
+G1 X13.80 S0.7 F6000
+G1 X13.90 S0.5 F6000
+G1 X14.00 S0.6 F6000
+G1 X14.10 S0.5 F6000
+G1 X14.30 S0.4 F6000
+G1 X14.60 S0.3 F6000
+G1 X14.70 S0.2 F6000
+G1 X14.80 S0.3 F6000
+G1 X14.90 S0.1 F6000
+G1 X15.00 S0.2 F6000
+G1 X15.10 S0.1 F6000
+G1 X15.20 S0.2 F6000
+G1 X15.30 S0.1 F6000
+G1 X15.50 S0.0 F6000
+G1 X15.60 S0.1 F6000
+G1 X15.90 S0.0 F6000
+G1 X16.20 S0.1 F6000
+G1 X16.40 S0.0 F6000
+G1 X16.80 S0.2 F6000
+G1 X16.90 S0.1 F6000
+G1 X17.10 S0.2 F6000
+G1 X17.40 S0.3 F6000
+G1 X17.50 S0.4 F6000
+G1 X17.70 S0.5 F6000
+G1 X17.80 S0.4 F6000
+G1 X17.90 S0.5 F6000
+G1 X18.00 S0.6 F6000
+G1 X18.10 S0.5 F6000
+G1 X18.20 S0.7 F6000
+G1 X18.30 S0.6 F6000
+G1 X18.40 S0.8 F6000
+G1 X18.70 S0.9 F6000
+G1 X18.90 S1.0 F6000
+G1 X19.00 S0.9 F6000
+G1 X19.10 S1.0 F6000
+G1 X19.50 S0.9 F6000
+G1 X19.80 S1.0 F6000
+G1 X19.90 S0.9 F6000
+G1 X20.10 S1.0 F6000
+G1 X20.30 S0.9 F6000
+G1 X20.40 S1.0 F6000
+G1 X20.50 S0.9 F6000
+G1 X20.80 S0.8 F6000
+G1 X20.90 S0.9 F6000
+G1 X21.00 S0.7 F6000
+G1 X21.10 S0.8 F6000
+G1 X21.30 S0.7 F6000
+G1 X21.60 S0.4 F6000
+G1 X21.90 S0.3 F6000
+G1 X22.10 S0.2 F6000
+G1 X22.20 S0.3 F6000
+G1 X22.40 S0.2 F6000
+G1 X22.60 S0.1 F6000
+G1 X22.70 S0.2 F6000
+G1 X22.80 S0.0 F6000
+G1 X22.90 S0.1 F6000
+G1 X23.00 S0.0 F6000
+G1 X23.90 S0.1 F6000
+G1 X24.10 S0.0 F6000
+G1 X24.20 S0.1 F6000
+G1 X24.30 S0.2 F6000
+G1 X24.40 S0.0 F6000
+G1 X24.50 S0.2 F6000
+G1 X24.60 S0.1 F6000
+G1 X24.70 S0.2 F6000
+G1 X24.90 S0.4 F6000
+G0 X24.90 Y15.50
+G1 X24.90 S0.3 F6000
+G1 X24.80 S0.4 F6000
+G1 X24.70 S0.2 F6000
+G1 X24.50 S0.3 F6000
+G1 X24.40 S0.1 F6000
+G1 X24.30 S0.2 F6000
+G1 X24.20 S0.0 F6000
+G1 X24.10 S0.2 F6000
+G1 X24.00 S0.1 F6000
+G1 X23.80 S0.0 F6000
+G1 X23.70 S0.1 F6000
+G1 X23.40 S0.0 F6000
+G1 X22.80 S0.1 F6000
+G1 X22.70 S0.0 F6000
+G1 X22.60 S0.1 F6000
+G1 X22.50 S0.2 F6000
+G1 X22.30 S0.1 F6000
+G1 X22.20 S0.2 F6000
+G1 X22.00 S0.3 F6000
+G1 X21.70 S0.5 F6000
+G1 X21.50 S0.4 F6000
+G1 X21.40 S0.5 F6000
+G1 X21.20 S0.7 F6000
+G1 X21.00 S0.8 F6000
+G1 X20.90 S0.7 F6000
+G1 X20.80 S0.9 F6000
+G1 X20.50 S0.8 F6000
+G1 X20.20 S1.0 F6000
+G1 X20.10 S0.9 F6000
+G1 X19.90 S1.0 F6000
+G1 X18.90 S0.9 F6000
+G1 X18.80 S1.0 F6000
+G1 X18.70 S0.9 F6000
+G1 X18.50 S0.7 F6000
+G1 X18.40 S0.8 F6000
+G1 X18.30 S0.7 F6000
+G1 X18.20 S0.8 F6000
+G1 X18.10 S0.7 F6000
+G1 X18.00 S0.5 F6000
+G1 X17.90 S0.7 F6000
+G1 X17.80 S0.5 F6000
+G1 X17.70 S0.6 F6000
+G1 X17.60 S0.5 F6000
+G1 X17.50 S0.4 F6000
+G1 X17.40 S0.3 F6000
+G1 X17.30 S0.2 F6000
+G1 X17.20 S0.4 F6000
+G1 X17.10 S0.2 F6000
+G1 X17.00 S0.3 F6000
+G1 X16.90 S0.2 F6000
+G1 X16.70 S0.1 F6000
+G1 X16.60 S0.2 F6000
+G1 X16.50 S0.0 F6000
+G1 X16.40 S0.1 F6000
+G1 X16.30 S0.0 F6000
+G1 X15.90 S0.1 F6000
+G1 X15.80 S0.0 F6000
+G1 X15.50 S0.1 F6000
+G1 X15.30 S0.0 F6000
+G1 X15.10 S0.2 F6000
+G1 X15.00 S0.1 F6000
+G1 X14.90 S0.2 F6000
+G1 X14.80 S0.1 F6000
+G1 X14.70 S0.2 F6000
+G1 X14.60 S0.3 F6000
+G1 X14.40 S0.4 F6000
+G1 X14.30 S0.3 F6000
+G1 X14.20 S0.5 F6000
+G1 X14.00 S0.4 F6000
+G1 X13.90 S0.5 F6000
+G1 X13.80 S0.6 F6000
+G1 X13.50 S0.7 F6000
+G1 X13.30 S0.8 F6000
+G1 X13.20 S0.9 F6000
+G1 X13.10 S0.8 F6000
+G1 X12.90 S0.9 F6000
+G1 X12.70 S1.0 F6000
+G1 X12.60 S0.9 F6000
+G1 X12.50 S1.0 F6000
+G1 X12.40 S0.9 F6000
+G1 X12.30 S1.0 F6000
+G1 X12.00 S0.9 F6000
+G1 X11.90 S1.0 F6000
+G1 X11.50 S0.9 F6000
+G1 X11.30 S0.8 F6000
+G1 X11.20 S0.9 F6000
+G1 X11.10 S0.8 F6000
+G1 X10.80 S0.7 F6000
+G1 X10.50 S0.5 F6000
+G1 X10.30 S0.6 F6000
+G1 X10.20 S0.4 F6000
+G1 X10.10 S0.5 F6000
+G0 X10.00 Y15.60
+G1 X10.00 S0.4 F6000
+G1 X10.10 S0.5 F6000
+G1 X10.20 S0.6 F6000
+G1 X10.30 S0.5 F6000
+G1 X10.40 S0.7 F6000
+G1 X10.60 S0.6 F6000
+G1 X10.70 S0.7 F6000
+G1 X10.90 S0.9 F6000
+G1 X11.00 S0.8 F6000
+G1 X11.10 S0.9 F6000
+G1 X11.30 S1.0 F6000
+G1 X11.40 S0.9 F6000
+G1 X11.80 S1.0 F6000
+G1 X12.30 S0.9 F6000
+G1 X12.50 S1.0 F6000
+G1 X12.70 S0.9 F6000
+G1 X12.90 S0.8 F6000
+G1 X13.40 S0.7 F6000
+G1 X13.60 S0.6 F6000
+G1 X13.90 S0.5 F6000
+G1 X14.10 S0.4 F6000
+G1 X14.20 S0.3 F6000
+G1 X14.30 S0.2 F6000
+G1 X14.40 S0.4 F6000
+G1 X14.50 S0.3 F6000
+G1 X14.60 S0.1 F6000
+G1 X14.80 S0.2 F6000
+G1 X14.90 S0.1 F6000
+G1 X15.10 S0.0 F6000
+G1 X15.20 S0.1 F6000
+G1 X15.50 S0.0 F6000
+G1 X15.60 S0.1 F6000
+G1 X15.70 S0.0 F6000
+G1 X16.00 S0.1 F6000
+G1 X16.20 S0.0 F6000
+G1 X16.40 S0.1 F6000
+G1 X16.50 S0.0 F6000
+G1 X16.60 S0.1 F6000
+G1 X16.90 S0.3 F6000
+G1 X17.10 S0.2 F6000
+G1 X17.20 S0.4 F6000
+G1 X17.40 S0.5 F6000
+G1 X17.50 S0.4 F6000
+G1 X17.60 S0.5 F6000
+G1 X17.90 S0.6 F6000
+G1 X18.10 S0.8 F6000
+G1 X18.20 S0.7 F6000
+G1 X18.30 S0.9 F6000
+G1 X18.40 S0.7 F6000
+G1 X18.50 S0.8 F6000
+G1 X18.70 S0.9 F6000
+G1 X18.90 S0.8 F6000
+G1 X19.00 S1.0 F6000
+G1 X20.10 S0.9 F6000
+G1 X20.20 S0.8 F6000
+G1 X20.30 S1.0 F6000
+G1 X20.40 S0.9 F6000
+G1 X20.60 S0.7 F6000
+G1 X21.00 S0.6 F6000
+G1 X21.30 S0.5 F6000
+G1 X21.40 S0.4 F6000
+G1 X21.80 S0.3 F6000
+G1 X22.00 S0.2 F6000
+G1 X22.10 S0.3 F6000
+G1 X22.30 S0.2 F6000
+G1 X22.40 S0.0 F6000
+G1 X22.50 S0.1 F6000
+G1 X22.80 S0.0 F6000
+G1 X23.00 S0.1 F6000
+G1 X23.10 S0.0 F6000
+G1 X23.50 S0.1 F6000
+G1 X23.60 S0.0 F6000
+G1 X23.80 S0.1 F6000
+G1 X24.40 S0.2 F6000
+G1 X24.80 S0.3 F6000
+G1 X24.90 S0.4 F6000
+G0 X24.90 Y15.70
+G1 X24.90 S0.4 F6000
+G1 X24.80 S0.3 F6000
+G1 X24.20 S0.2 F6000
+G1 X24.10 S0.1 F6000
+G1 X23.80 S0.2 F6000
+G1 X23.70 S0.1 F6000
+G1 X23.60 S0.0 F6000
+G1 X22.60 S0.1 F6000
+G1 X22.50 S0.2 F6000
+G1 X22.40 S0.0 F6000
+G1 X22.30 S0.1 F6000
+G1 X22.10 S0.2 F6000
+G1 X21.70 S0.3 F6000
+G1 X21.50 S0.4 F6000
+G1 X21.30 S0.5 F6000
+G1 X21.10 S0.6 F6000
+G1 X20.80 S0.8 F6000
+G1 X20.40 S0.7 F6000
+G1 X20.30 S0.8 F6000
+G1 X20.20 S1.0 F6000
+G1 X20.10 S0.9 F6000
+G1 X19.90 S1.0 F6000
+G1 X19.80 S0.9 F6000
+G1 X19.70 S1.0 F6000
+G1 X19.30 S0.9 F6000
+G1 X19.20 S1.0 F6000
+G1 X19.10 S0.9 F6000
+G1 X19.00 S1.0 F6000
+G1 X18.90 S0.9 F6000
+G1 X18.70 S1.0 F6000
+G1 X18.50 S0.9 F6000
+G1 X18.40 S0.8 F6000
+G1 X18.30 S0.9 F6000
+G1 X18.20 S0.8 F6000
+G1 X18.00 S0.7 F6000
+G1 X17.90 S0.6 F6000
+G1 X17.80 S0.7 F6000
+G1 X17.70 S0.5 F6000
+G1 X17.30 S0.4 F6000
+G1 X17.10 S0.3 F6000
+G1 X16.80 S0.2 F6000
+G1 X16.50 S0.1 F6000
+G1 X16.30 S0.0 F6000
+G1 X15.80 S0.1 F6000
+G1 X15.50 S0.0 F6000
+G1 X15.20 S0.1 F6000
+G1 X15.10 S0.0 F6000
+G1 X15.00 S0.1 F6000
+G1 X14.90 S0.0 F6000
+G1 X14.80 S0.1 F6000
+G1 X14.70 S0.2 F6000
+G1 X14.50 S0.3 F6000
+G1 X14.40 S0.2 F6000
+G1 X14.20 S0.3 F6000
+G1 X14.00 S0.4 F6000
+G1 X13.90 S0.3 F6000
+G1 X13.80 S0.4 F6000
+G1 X13.70 S0.6 F6000
+G1 X13.50 S0.7 F6000
+G1 X13.40 S0.6 F6000
+G1 X13.30 S0.8 F6000
+G1 X13.00 S0.7 F6000
+G1 X12.80 S0.8 F6000
+G1 X12.70 S0.9 F6000
+G1 X12.40 S1.0 F6000
+G1 X11.80 S0.9 F6000
+G1 X11.70 S1.0 F6000
+G1 X11.40 S0.9 F6000
+G1 X11.10 S0.8 F6000
+G1 X10.80 S0.9 F6000
+G1 X10.70 S0.8 F6000
+G1 X10.60 S0.7 F6000
+G1 X10.10 S0.6 F6000
+G0 X10.00 Y15.80
+G1 X10.00 S0.6 F6000
+G1 X10.40 S0.7 F6000
+G1 X10.60 S0.8 F6000
+G1 X10.80 S0.9 F6000
+G1 X10.90 S0.8 F6000
+G1 X11.00 S0.9 F6000
+G1 X11.10 S1.0 F6000
+G1 X11.20 S0.9 F6000
+G1 X11.40 S1.0 F6000
+G1 X11.50 S0.9 F6000
+G1 X11.70 S1.0 F6000
+G1 X12.30 S0.9 F6000
+G1 X12.40 S0.8 F6000
+G1 X12.50 S0.9 F6000
+G1 X12.60 S0.8 F6000
+G1 X12.90 S0.7 F6000
+G1 X13.20 S0.6 F6000
+G1 X13.30 S0.7 F6000
+G1 X13.40 S0.6 F6000
+G1 X13.60 S0.5 F6000
+G1 X13.90 S0.4 F6000
+G1 X14.20 S0.3 F6000
+G1 X14.30 S0.2 F6000
+G1 X14.60 S0.0 F6000
+G1 X14.70 S0.1 F6000
+G1 X14.80 S0.0 F6000
+G1 X15.10 S0.1 F6000
+G1 X15.20 S0.0 F6000
+G1 X15.60 S0.1 F6000
+G1 X15.70 S0.0 F6000
+G1 X16.00 S0.1 F6000
+G1 X16.40 S0.2 F6000
+G1 X16.50 S0.3 F6000
+G1 X16.70 S0.2 F6000
+G1 X16.80 S0.3 F6000
+G1 X17.20 S0.5 F6000
+G1 X17.40 S0.6 F6000
+G1 X17.50 S0.5 F6000
+G1 X17.60 S0.6 F6000
+G1 X17.70 S0.7 F6000
+G1 X18.10 S0.8 F6000
+G1 X18.20 S0.9 F6000
+G1 X18.40 S0.8 F6000
+G1 X18.50 S0.9 F6000
+G1 X18.60 S0.8 F6000
+G1 X18.70 S1.0 F6000
+G1 X19.50 S0.9 F6000
+G1 X19.60 S1.0 F6000
+G1 X19.90 S0.9 F6000
+G1 X20.10 S1.0 F6000
+G1 X20.20 S0.9 F6000
+G1 X20.30 S0.8 F6000
+G1 X20.50 S0.7 F6000
+G1 X20.70 S0.6 F6000
+G1 X20.90 S0.5 F6000
+G1 X21.10 S0.4 F6000
+G1 X21.60 S0.3 F6000
+G1 X21.80 S0.2 F6000
+G1 X22.00 S0.1 F6000
+G1 X22.20 S0.2 F6000
+G1 X22.30 S0.1 F6000
+G1 X22.60 S0.0 F6000
+G1 X22.90 S0.1 F6000
+G1 X23.10 S0.0 F6000
+G1 X23.20 S0.1 F6000
+G1 X23.30 S0.0 F6000
+G1 X23.70 S0.1 F6000
+G1 X23.90 S0.2 F6000
+G1 X24.20 S0.1 F6000
+G1 X24.30 S0.2 F6000
+G1 X24.40 S0.3 F6000
+G1 X24.60 S0.5 F6000
+G1 X24.80 S0.4 F6000
+G1 X24.90 S0.5 F6000
+G0 X24.90 Y15.90
+G1 X24.90 S0.5 F6000
+G1 X24.80 S0.4 F6000
+G1 X24.60 S0.5 F6000
+G1 X24.50 S0.4 F6000
+G1 X24.30 S0.2 F6000
+G1 X24.20 S0.3 F6000
+G1 X24.00 S0.2 F6000
+G1 X23.90 S0.1 F6000
+G1 X23.70 S0.2 F6000
+G1 X23.60 S0.1 F6000
+G1 X23.50 S0.0 F6000
+G1 X23.40 S0.1 F6000
+G1 X23.30 S0.0 F6000
+G1 X23.10 S0.1 F6000
+G1 X23.00 S0.0 F6000
+G1 X22.40 S0.1 F6000
+G1 X21.90 S0.2 F6000
+G1 X21.80 S0.3 F6000
+G1 X21.70 S0.2 F6000
+G1 X21.40 S0.3 F6000
+G1 X21.30 S0.4 F6000
+G1 X21.20 S0.5 F6000
+G1 X21.10 S0.4 F6000
+G1 X20.90 S0.6 F6000
+G1 X20.80 S0.5 F6000
+G1 X20.70 S0.6 F6000
+G1 X20.60 S0.7 F6000
+G1 X20.50 S0.8 F6000
+G1 X20.40 S0.7 F6000
+G1 X20.30 S0.8 F6000
+G1 X19.90 S1.0 F6000
+G1 X19.80 S0.9 F6000
+G1 X19.70 S1.0 F6000
+G1 X19.20 S0.9 F6000
+G1 X19.10 S1.0 F6000
+G1 X18.90 S0.9 F6000
+G1 X18.80 S1.0 F6000
+G1 X18.50 S0.9 F6000
+G1 X18.40 S1.0 F6000
+G1 X18.20 S0.8 F6000
+G1 X17.90 S0.7 F6000
+G1 X17.70 S0.6 F6000
+G1 X17.60 S0.8 F6000
+G1 X17.50 S0.6 F6000
+G1 X17.40 S0.7 F6000
+G1 X17.30 S0.4 F6000
+G1 X16.80 S0.2 F6000
+G1 X16.70 S0.3 F6000
+G1 X16.60 S0.2 F6000
+G1 X16.40 S0.3 F6000
+G1 X16.30 S0.2 F6000
+G1 X16.20 S0.1 F6000
+G1 X16.10 S0.0 F6000
+G1 X15.90 S0.1 F6000
+G1 X15.80 S0.0 F6000
+G1 X15.00 S0.1 F6000
+G1 X14.80 S0.0 F6000
+G1 X14.60 S0.1 F6000
+G1 X14.50 S0.0 F6000
+G1 X14.40 S0.2 F6000
+G1 X14.30 S0.1 F6000
+G1 X14.10 S0.2 F6000
+G1 X14.00 S0.3 F6000
+G1 X13.70 S0.5 F6000
+G1 X13.30 S0.6 F6000
+G1 X12.90 S0.7 F6000
+G1 X12.80 S0.8 F6000
+G1 X12.60 S0.7 F6000
+G1 X12.50 S0.8 F6000
+G1 X12.40 S0.9 F6000
+G1 X12.20 S0.8 F6000
+G1 X12.10 S1.0 F6000
+G1 X11.20 S0.9 F6000
+G1 X11.00 S1.0 F6000
+G1 X10.90 S0.9 F6000
+G1 X10.80 S0.8 F6000
+G1 X10.70 S0.9 F6000
+G1 X10.40 S0.8 F6000
+G1 X10.20 S0.7 F6000
+G1 X10.10 S0.8 F6000
+G1 X10.00 S0.7 F6000
@@ -0,0 +1,4981 @@
+; sliced STL perimeters, 0.1-0.3mm segments
+G21
+G90
+G92 E0
+G1 Z0.3 F3000
+G1 Z0.300 F3000
+G0 X70.000 Y50.000 F6000
+G1 X70.050 Y50.127 E0.00400 F2400
+G1 X70.152 Y50.399 E0.00800 F2400
+G1 X70.241 Y50.657 E0.01200 F2400
+G1 X70.292 Y50.812 E0.01600 F2400
+G1 X70.354 Y51.018 E0.02000 F2400
+G1 X70.408 Y51.215 E0.02400 F2400
+G1 X70.465 Y51.455 E0.02800 F2400
+G1 X70.519 Y51.725 E0.03200 F2400
+G1 X70.540 Y51.849 E0.03600 F2400
+G1 X70.556 Y51.960 E0.04000 F2400
+G1 X70.587 Y52.241 E0.04400 F2400
+G1 X70.600 Y52.437 E0.04800 F2400
+G1 X70.607 Y52.702 E0.05200 F2400
+G1 X70.605 Y52.807 E0.05600 F2400
+G1 X70.598 Y53.005 E0.06000 F2400
+G1 X70.576 Y53.259 E0.06400 F2400
+G1 X70.558 Y53.410 E0.06800 F2400
+G1 X70.510 Y53.707 E0.07200 F2400
+G1 X70.449 Y53.993 E0.07600 F2400
+G1 X70.422 Y54.100 E0.08000 F2400
+G1 X70.394 Y54.206 E0.08400 F2400
+G1 X70.334 Y54.415 E0.08800 F2400
+G1 X70.241 Y54.701 E0.09200 F2400
+G1 X70.179 Y54.874 E0.09600 F2400
+G1 X70.126 Y55.014 E0.10000 F2400
+G1 X70.056 Y55.194 E0.10400 F2400
+G1 X70.015 Y55.296 E0.10800 F2400
+G1 X69.957 Y55.435 E0.11200 F2400
+G1 X69.880 Y55.615 E0.11600 F2400
+G1 X69.797 Y55.805 E0.12000 F2400
+G1 X69.735 Y55.945 E0.12400 F2400
+G1 X69.673 Y56.083 E0.12800 F2400
+G1 X69.612 Y56.219 E0.13200 F2400
+G1 X69.530 Y56.400 E0.13600 F2400
+G1 X69.463 Y56.548 E0.14000 F2400
+G1 X69.418 Y56.646 E0.14400 F2400
+G1 X69.306 Y56.898 E0.14800 F2400
+G1 X69.218 Y57.096 E0.15200 F2400
+G1 X69.125 Y57.311 E0.15600 F2400
+G1 X69.069 Y57.440 E0.16000 F2400
+G1 X68.950 Y57.721 E0.16400 F2400
+G1 X68.843 Y57.978 E0.16800 F2400
+G1 X68.795 Y58.096 E0.17200 F2400
+G1 X68.730 Y58.254 E0.17600 F2400
+G1 X68.635 Y58.485 E0.18000 F2400
+G1 X68.540 Y58.715 E0.18400 F2400
+G1 X68.426 Y58.986 E0.18800 F2400
+G1 X68.351 Y59.160 E0.19200 F2400
+G1 X68.240 Y59.410 E0.19600 F2400
+G1 X68.138 Y59.627 E0.20000 F2400
+G1 X68.065 Y59.776 E0.20400 F2400
+G1 X67.963 Y59.975 E0.20800 F2400
+G1 X67.826 Y60.224 E0.21200 F2400
+G1 X67.685 Y60.461 E0.21600 F2400
+G1 X67.573 Y60.635 E0.22000 F2400
+G1 X67.445 Y60.819 E0.22400 F2400
+G1 X67.380 Y60.908 E0.22800 F2400
+G1 X67.287 Y61.029 E0.23200 F2400
+G1 X67.116 Y61.235 E0.23600 F2400
+G1 X66.990 Y61.376 E0.24000 F2400
+G1 X66.895 Y61.477 E0.24400 F2400
+G1 X66.740 Y61.631 E0.24800 F2400
+G1 X66.555 Y61.800 E0.25200 F2400
+G1 X66.368 Y61.959 E0.25600 F2400
+G1 X66.224 Y62.073 E0.26000 F2400
+G1 X66.065 Y62.191 E0.26400 F2400
+G1 X65.891 Y62.313 E0.26800 F2400
+G1 X65.665 Y62.462 E0.27200 F2400
+G1 X65.481 Y62.576 E0.27600 F2400
+G1 X65.318 Y62.672 E0.28000 F2400
+G1 X65.136 Y62.776 E0.28400 F2400
+G1 X65.038 Y62.830 E0.28800 F2400
+G1 X64.937 Y62.885 E0.29200 F2400
+G1 X64.714 Y63.004 E0.29600 F2400
+G1 X64.439 Y63.148 E0.30000 F2400
+G1 X64.237 Y63.252 E0.30400 F2400
+G1 X64.073 Y63.336 E0.30800 F2400
+G1 X63.952 Y63.400 E0.31200 F2400
+G1 X63.772 Y63.495 E0.31600 F2400
+G1 X63.511 Y63.637 E0.32000 F2400
+G1 X63.292 Y63.762 E0.32400 F2400
+G1 X63.118 Y63.867 E0.32800 F2400
+G1 X62.895 Y64.008 E0.33200 F2400
+G1 X62.777 Y64.086 E0.33600 F2400
+G1 X62.618 Y64.198 E0.34000 F2400
+G1 X62.397 Y64.363 E0.34400 F2400
+G1 X62.237 Y64.491 E0.34800 F2400
+G1 X62.098 Y64.608 E0.35200 F2400
+G1 X61.988 Y64.705 E0.35600 F2400
+G1 X61.842 Y64.839 E0.36000 F2400
+G1 X61.641 Y65.033 E0.36400 F2400
+G1 X61.573 Y65.101 E0.36800 F2400
+G1 X61.400 Y65.279 E0.37200 F2400
+G1 X61.225 Y65.465 E0.37600 F2400
+G1 X61.041 Y65.664 E0.38000 F2400
+G1 X60.876 Y65.844 E0.38400 F2400
+G1 X60.700 Y66.034 E0.38800 F2400
+G1 X60.562 Y66.182 E0.39200 F2400
+G1 X60.417 Y66.335 E0.39600 F2400
+G1 X60.288 Y66.467 E0.40000 F2400
+G1 X60.209 Y66.545 E0.40400 F2400
+G1 X60.013 Y66.736 E0.40800 F2400
+G1 X59.856 Y66.881 E0.41200 F2400
+G1 X59.751 Y66.974 E0.41600 F2400
+G1 X59.599 Y67.104 E0.42000 F2400
+G1 X59.446 Y67.227 E0.42400 F2400
+G1 X59.311 Y67.331 E0.42800 F2400
+G1 X59.175 Y67.431 E0.43200 F2400
+G1 X59.006 Y67.548 E0.43600 F2400
+G1 X58.819 Y67.669 E0.44000 F2400
+G1 X58.630 Y67.784 E0.44400 F2400
+G1 X58.465 Y67.878 E0.44800 F2400
+G1 X58.373 Y67.927 E0.45200 F2400
+G1 X58.245 Y67.994 E0.45600 F2400
+G1 X58.125 Y68.054 E0.46000 F2400
+G1 X57.931 Y68.147 E0.46400 F2400
+G1 X57.685 Y68.257 E0.46800 F2400
+G1 X57.447 Y68.356 E0.47200 F2400
+G1 X57.208 Y68.451 E0.47600 F2400
+G1 X56.965 Y68.544 E0.48000 F2400
+G1 X56.825 Y68.596 E0.48400 F2400
+G1 X56.575 Y68.688 E0.48800 F2400
+G1 X56.357 Y68.768 E0.49200 F2400
+G1 X56.248 Y68.808 E0.49600 F2400
+G1 X56.152 Y68.844 E0.50000 F2400
+G1 X56.057 Y68.879 E0.50400 F2400
+G1 X55.824 Y68.968 E0.50800 F2400
+G1 X55.684 Y69.022 E0.51200 F2400
+G1 X55.571 Y69.067 E0.51600 F2400
+G1 X55.363 Y69.151 E0.52000 F2400
+G1 X55.207 Y69.217 E0.52400 F2400
+G1 X55.101 Y69.262 E0.52800 F2400
+G1 X54.979 Y69.315 E0.53200 F2400
+G1 X54.789 Y69.400 E0.53600 F2400
+G1 X54.666 Y69.457 E0.54000 F2400
+G1 X54.522 Y69.523 E0.54400 F2400
+G1 X54.297 Y69.631 E0.54800 F2400
+G1 X54.120 Y69.718 E0.55200 F2400
+G1 X53.966 Y69.794 E0.55600 F2400
+G1 X53.783 Y69.885 E0.56000 F2400
+G1 X53.685 Y69.935 E0.56400 F2400
+G1 X53.517 Y70.019 E0.56800 F2400
+G1 X53.342 Y70.106 E0.57200 F2400
+G1 X53.210 Y70.171 E0.57600 F2400
+G1 X53.093 Y70.228 E0.58000 F2400
+G1 X52.822 Y70.358 E0.58400 F2400
+G1 X52.624 Y70.448 E0.58800 F2400
+G1 X52.484 Y70.510 E0.59200 F2400
+G1 X52.265 Y70.603 E0.59600 F2400
+G1 X52.000 Y70.707 E0.60000 F2400
+G1 X51.895 Y70.745 E0.60400 F2400
+G1 X51.790 Y70.782 E0.60800 F2400
+G1 X51.658 Y70.825 E0.61200 F2400
+G1 X51.408 Y70.900 E0.61600 F2400
+G1 X51.272 Y70.936 E0.62000 F2400
+G1 X51.022 Y70.994 E0.62400 F2400
+G1 X50.775 Y71.038 E0.62800 F2400
+G1 X50.556 Y71.068 E0.63200 F2400
+G1 X50.405 Y71.083 E0.63600 F2400
+G1 X50.094 Y71.099 E0.64000 F2400
+G1 X49.820 Y71.097 E0.64400 F2400
+G1 X49.605 Y71.084 E0.64800 F2400
+G1 X49.453 Y71.069 E0.65200 F2400
+G1 X49.212 Y71.036 E0.65600 F2400
+G1 X49.025 Y71.003 E0.66000 F2400
+G1 X48.801 Y70.954 E0.66400 F2400
+G1 X48.632 Y70.911 E0.66800 F2400
+G1 X48.399 Y70.844 E0.67200 F2400
+G1 X48.285 Y70.807 E0.67600 F2400
+G1 X48.122 Y70.751 E0.68000 F2400
+G1 X47.827 Y70.640 E0.68400 F2400
+G1 X47.553 Y70.526 E0.68800 F2400
+G1 X47.394 Y70.456 E0.69200 F2400
+G1 X47.128 Y70.334 E0.69600 F2400
+G1 X46.971 Y70.259 E0.70000 F2400
+G1 X46.694 Y70.124 E0.70400 F2400
+G1 X46.458 Y70.006 E0.70800 F2400
+G1 X46.284 Y69.919 E0.71200 F2400
+G1 X46.143 Y69.848 E0.71600 F2400
+G1 X46.048 Y69.801 E0.72000 F2400
+G1 X45.790 Y69.674 E0.72400 F2400
+G1 X45.690 Y69.625 E0.72800 F2400
+G1 X45.445 Y69.508 E0.73200 F2400
+G1 X45.174 Y69.383 E0.73600 F2400
+G1 X44.976 Y69.295 E0.74000 F2400
+G1 X44.852 Y69.242 E0.74400 F2400
+G1 X44.599 Y69.136 E0.74800 F2400
+G1 X44.326 Y69.026 E0.75200 F2400
+G1 X44.102 Y68.939 E0.75600 F2400
+G1 X43.915 Y68.869 E0.76000 F2400
+G1 X43.752 Y68.808 E0.76400 F2400
+G1 X43.594 Y68.750 E0.76800 F2400
+G1 X43.463 Y68.702 E0.77200 F2400
+G1 X43.244 Y68.622 E0.77600 F2400
+G1 X43.071 Y68.557 E0.78000 F2400
+G1 X42.943 Y68.509 E0.78400 F2400
+G1 X42.831 Y68.466 E0.78800 F2400
+G1 X42.616 Y68.381 E0.79200 F2400
+G1 X42.470 Y68.322 E0.79600 F2400
+G1 X42.287 Y68.244 E0.80000 F2400
+G1 X42.138 Y68.178 E0.80400 F2400
+G1 X41.892 Y68.063 E0.80800 F2400
+G1 X41.645 Y67.937 E0.81200 F2400
+G1 X41.555 Y67.888 E0.81600 F2400
+G1 X41.433 Y67.820 E0.82000 F2400
+G1 X41.292 Y67.737 E0.82400 F2400
+G1 X41.042 Y67.580 E0.82800 F2400
+G1 X40.832 Y67.436 E0.83200 F2400
+G1 X40.697 Y67.337 E0.83600 F2400
+G1 X40.585 Y67.251 E0.84000 F2400
+G1 X40.402 Y67.105 E0.84400 F2400
+G1 X40.200 Y66.931 E0.84800 F2400
+G1 X39.989 Y66.738 E0.85200 F2400
+G1 X39.867 Y66.621 E0.85600 F2400
+G1 X39.672 Y66.426 E0.86000 F2400
+G1 X39.508 Y66.256 E0.86400 F2400
+G1 X39.373 Y66.113 E0.86800 F2400
+G1 X39.174 Y65.897 E0.87200 F2400
+G1 X39.076 Y65.791 E0.87600 F2400
+G1 X38.913 Y65.613 E0.88000 F2400
+G1 X38.835 Y65.529 E0.88400 F2400
+G1 X38.746 Y65.434 E0.88800 F2400
+G1 X38.558 Y65.236 E0.89200 F2400
+G1 X38.463 Y65.137 E0.89600 F2400
+G1 X38.292 Y64.967 E0.90000 F2400
+G1 X38.140 Y64.822 E0.90400 F2400
+G1 X37.951 Y64.651 E0.90800 F2400
+G1 X37.826 Y64.543 E0.91200 F2400
+G1 X37.703 Y64.442 E0.91600 F2400
+G1 X37.585 Y64.349 E0.92000 F2400
+G1 X37.376 Y64.194 E0.92400 F2400
+G1 X37.202 Y64.073 E0.92800 F2400
+G1 X36.967 Y63.919 E0.93200 F2400
+G1 X36.736 Y63.778 E0.93600 F2400
+G1 X36.627 Y63.715 E0.94000 F2400
+G1 X36.445 Y63.613 E0.94400 F2400
+G1 X36.339 Y63.555 E0.94800 F2400
+G1 X36.244 Y63.503 E0.95200 F2400
+G1 X36.141 Y63.449 E0.95600 F2400
+G1 X35.894 Y63.319 E0.96000 F2400
+G1 X35.657 Y63.197 E0.96400 F2400
+G1 X35.411 Y63.070 E0.96800 F2400
+G1 X35.255 Y62.988 E0.97200 F2400
+G1 X35.048 Y62.877 E0.97600 F2400
+G1 X34.811 Y62.746 E0.98000 F2400
+G1 X34.649 Y62.653 E0.98400 F2400
+G1 X34.455 Y62.537 E0.98800 F2400
+G1 X34.325 Y62.455 E0.99200 F2400
+G1 X34.221 Y62.389 E0.99600 F2400
+G1 X34.087 Y62.298 E1.00000 F2400
+G1 X33.848 Y62.127 E1.00400 F2400
+G1 X33.672 Y61.991 E1.00800 F2400
+G1 X33.443 Y61.799 E1.01200 F2400
+G1 X33.295 Y61.665 E1.01600 F2400
+G1 X33.179 Y61.552 E1.02000 F2400
+G1 X32.995 Y61.360 E1.02400 F2400
+G1 X32.814 Y61.153 E1.02800 F2400
+G1 X32.747 Y61.071 E1.03200 F2400
+G1 X32.600 Y60.881 E1.03600 F2400
+G1 X32.529 Y60.782 E1.04000 F2400
+G1 X32.457 Y60.678 E1.04400 F2400
+G1 X32.302 Y60.439 E1.04800 F2400
+G1 X32.244 Y60.344 E1.05200 F2400
+G1 X32.167 Y60.213 E1.05600 F2400
+G1 X32.021 Y59.945 E1.06000 F2400
+G1 X31.935 Y59.776 E1.06400 F2400
+G1 X31.879 Y59.662 E1.06800 F2400
+G1 X31.820 Y59.539 E1.07200 F2400
+G1 X31.756 Y59.400 E1.07600 F2400
+G1 X31.652 Y59.167 E1.08000 F2400
+G1 X31.603 Y59.053 E1.08400 F2400
+G1 X31.490 Y58.787 E1.08800 F2400
+G1 X31.421 Y58.620 E1.09200 F2400
+G1 X31.306 Y58.342 E1.09600 F2400
+G1 X31.197 Y58.075 E1.10000 F2400
+G1 X31.135 Y57.925 E1.10400 F2400
+G1 X31.076 Y57.782 E1.10800 F2400
+G1 X30.998 Y57.598 E1.11200 F2400
+G1 X30.950 Y57.485 E1.11600 F2400
+G1 X30.857 Y57.268 E1.12000 F2400
+G1 X30.813 Y57.167 E1.12400 F2400
+G1 X30.771 Y57.071 E1.12800 F2400
+G1 X30.647 Y56.792 E1.13200 F2400
+G1 X30.580 Y56.643 E1.13600 F2400
+G1 X30.487 Y56.436 E1.14000 F2400
+G1 X30.406 Y56.257 E1.14400 F2400
+G1 X30.336 Y56.104 E1.14800 F2400
+G1 X30.288 Y55.997 E1.15200 F2400
+G1 X30.169 Y55.729 E1.15600 F2400
+G1 X30.048 Y55.447 E1.16000 F2400
+G1 X29.932 Y55.163 E1.16400 F2400
+G1 X29.885 Y55.044 E1.16800 F2400
+G1 X29.832 Y54.904 E1.17200 F2400
+G1 X29.754 Y54.685 E1.17600 F2400
+G1 X29.659 Y54.390 E1.18000 F2400
+G1 X29.599 Y54.181 E1.18400 F2400
+G1 X29.539 Y53.941 E1.18800 F2400
+G1 X29.489 Y53.704 E1.19200 F2400
+G1 X29.462 Y53.548 E1.19600 F2400
+G1 X29.432 Y53.333 E1.20000 F2400
+G1 X29.414 Y53.165 E1.20400 F2400
+G1 X29.403 Y53.010 E1.20800 F2400
+G1 X29.397 Y52.888 E1.21200 F2400
+G1 X29.393 Y52.725 E1.21600 F2400
+G1 X29.401 Y52.414 E1.22000 F2400
+G1 X29.415 Y52.215 E1.22400 F2400
+G1 X29.442 Y51.972 E1.22800 F2400
+G1 X29.479 Y51.732 E1.23200 F2400
+G1 X29.540 Y51.431 E1.23600 F2400
+G1 X29.585 Y51.245 E1.24000 F2400
+G1 X29.629 Y51.077 E1.24400 F2400
+G1 X29.679 Y50.906 E1.24800 F2400
+G1 X29.732 Y50.738 E1.25200 F2400
+G1 X29.826 Y50.463 E1.25600 F2400
+G1 X29.930 Y50.180 E1.26000 F2400
+G1 X29.992 Y50.019 E1.26400 F2400
+G1 X30.059 Y49.853 E1.26800 F2400
+G1 X30.143 Y49.646 E1.27200 F2400
+G1 X30.231 Y49.434 E1.27600 F2400
+G1 X30.320 Y49.221 E1.28000 F2400
+G1 X30.380 Y49.077 E1.28400 F2400
+G1 X30.422 Y48.976 E1.28800 F2400
+G1 X30.480 Y48.834 E1.29200 F2400
+G1 X30.524 Y48.725 E1.29600 F2400
+G1 X30.603 Y48.525 E1.30000 F2400
+G1 X30.644 Y48.417 E1.30400 F2400
+G1 X30.684 Y48.308 E1.30800 F2400
+G1 X30.761 Y48.095 E1.31200 F2400
+G1 X30.811 Y47.946 E1.31600 F2400
+G1 X30.888 Y47.704 E1.32000 F2400
+G1 X30.941 Y47.518 E1.32400 F2400
+G1 X31.008 Y47.263 E1.32800 F2400
+G1 X31.038 Y47.141 E1.33200 F2400
+G1 X31.079 Y46.953 E1.33600 F2400
+G1 X31.127 Y46.710 E1.34000 F2400
+G1 X31.146 Y46.601 E1.34400 F2400
+G1 X31.190 Y46.326 E1.34800 F2400
+G1 X31.209 Y46.199 E1.35200 F2400
+G1 X31.241 Y45.955 E1.35600 F2400
+G1 X31.276 Y45.671 E1.36000 F2400
+G1 X31.305 Y45.416 E1.36400 F2400
+G1 X31.323 Y45.258 E1.36800 F2400
+G1 X31.336 Y45.141 E1.37200 F2400
+G1 X31.360 Y44.945 E1.37600 F2400
+G1 X31.396 Y44.670 E1.38000 F2400
+G1 X31.418 Y44.516 E1.38400 F2400
+G1 X31.462 Y44.247 E1.38800 F2400
+G1 X31.484 Y44.123 E1.39200 F2400
+G1 X31.538 Y43.852 E1.39600 F2400
+G1 X31.560 Y43.751 E1.40000 F2400
+G1 X31.597 Y43.595 E1.40400 F2400
+G1 X31.668 Y43.330 E1.40800 F2400
+G1 X31.742 Y43.086 E1.41200 F2400
+G1 X31.832 Y42.826 E1.41600 F2400
+G1 X31.925 Y42.582 E1.42000 F2400
+G1 X32.020 Y42.357 E1.42400 F2400
+G1 X32.116 Y42.146 E1.42800 F2400
+G1 X32.173 Y42.026 E1.43200 F2400
+G1 X32.254 Y41.863 E1.43600 F2400
+G1 X32.313 Y41.749 E1.44000 F2400
+G1 X32.426 Y41.540 E1.44400 F2400
+G1 X32.536 Y41.340 E1.44800 F2400
+G1 X32.609 Y41.213 E1.45200 F2400
+G1 X32.664 Y41.118 E1.45600 F2400
+G1 X32.808 Y40.871 E1.46000 F2400
+G1 X32.937 Y40.652 E1.46400 F2400
+G1 X33.040 Y40.475 E1.46800 F2400
+G1 X33.142 Y40.300 E1.47200 F2400
+G1 X33.271 Y40.071 E1.47600 F2400
+G1 X33.360 Y39.908 E1.48000 F2400
+G1 X33.442 Y39.754 E1.48400 F2400
+G1 X33.518 Y39.609 E1.48800 F2400
+G1 X33.584 Y39.476 E1.49200 F2400
+G1 X33.630 Y39.384 E1.49600 F2400
+G1 X33.726 Y39.179 E1.50000 F2400
+G1 X33.801 Y39.014 E1.50400 F2400
+G1 X33.886 Y38.817 E1.50800 F2400
+G1 X33.930 Y38.713 E1.51200 F2400
+G1 X33.995 Y38.553 E1.51600 F2400
+G1 X34.042 Y38.433 E1.52000 F2400
+G1 X34.088 Y38.314 E1.52400 F2400
+G1 X34.143 Y38.168 E1.52800 F2400
+G1 X34.238 Y37.909 E1.53200 F2400
+G1 X34.301 Y37.732 E1.53600 F2400
+G1 X34.364 Y37.553 E1.54000 F2400
+G1 X34.443 Y37.330 E1.54400 F2400
+G1 X34.495 Y37.182 E1.54800 F2400
+G1 X34.532 Y37.080 E1.55200 F2400
+G1 X34.607 Y36.872 E1.55600 F2400
+G1 X34.683 Y36.669 E1.56000 F2400
+G1 X34.773 Y36.437 E1.56400 F2400
+G1 X34.850 Y36.248 E1.56800 F2400
+G1 X34.952 Y36.012 E1.57200 F2400
+G1 X35.064 Y35.769 E1.57600 F2400
+G1 X35.136 Y35.626 E1.58000 F2400
+G1 X35.236 Y35.436 E1.58400 F2400
+G1 X35.340 Y35.253 E1.58800 F2400
+G1 X35.421 Y35.120 E1.59200 F2400
+G1 X35.527 Y34.956 E1.59600 F2400
+G1 X35.656 Y34.771 E1.60000 F2400
+G1 X35.839 Y34.535 E1.60400 F2400
+G1 X36.037 Y34.309 E1.60800 F2400
+G1 X36.150 Y34.191 E1.61200 F2400
+G1 X36.324 Y34.024 E1.61600 F2400
+G1 X36.410 Y33.947 E1.62000 F2400
+G1 X36.501 Y33.869 E1.62400 F2400
+G1 X36.668 Y33.737 E1.62800 F2400
+G1 X36.903 Y33.567 E1.63200 F2400
+G1 X37.018 Y33.490 E1.63600 F2400
+G1 X37.246 Y33.350 E1.64000 F2400
+G1 X37.502 Y33.208 E1.64400 F2400
+G1 X37.655 Y33.129 E1.64800 F2400
+G1 X37.883 Y33.020 E1.65200 F2400
+G1 X38.146 Y32.904 E1.65600 F2400
+G1 X38.317 Y32.834 E1.66000 F2400
+G1 X38.554 Y32.740 E1.66400 F2400
+G1 X38.800 Y32.649 E1.66800 F2400
+G1 X39.018 Y32.570 E1.67200 F2400
+G1 X39.287 Y32.476 E1.67600 F2400
+G1 X39.564 Y32.380 E1.68000 F2400
+G1 X39.852 Y32.281 E1.68400 F2400
+G1 X40.061 Y32.208 E1.68800 F2400
+G1 X40.193 Y32.161 E1.69200 F2400
+G1 X40.339 Y32.109 E1.69600 F2400
+G1 X40.477 Y32.059 E1.70000 F2400
+G1 X40.683 Y31.983 E1.70400 F2400
+G1 X40.922 Y31.892 E1.70800 F2400
+G1 X41.027 Y31.852 E1.71200 F2400
+G1 X41.250 Y31.764 E1.71600 F2400
+G1 X41.479 Y31.672 E1.72000 F2400
+G1 X41.638 Y31.607 E1.72400 F2400
+G1 X41.828 Y31.529 E1.72800 F2400
+G1 X41.952 Y31.478 E1.73200 F2400
+G1 X42.181 Y31.383 E1.73600 F2400
+G1 X42.282 Y31.342 E1.74000 F2400
+G1 X42.560 Y31.230 E1.74400 F2400
+G1 X42.806 Y31.134 E1.74800 F2400
+G1 X43.019 Y31.054 E1.75200 F2400
+G1 X43.165 Y31.002 E1.75600 F2400
+G1 X43.435 Y30.910 E1.76000 F2400
+G1 X43.717 Y30.825 E1.76400 F2400
+G1 X43.842 Y30.790 E1.76800 F2400
+G1 X44.092 Y30.728 E1.77200 F2400
+G1 X44.357 Y30.671 E1.77600 F2400
+G1 X44.588 Y30.631 E1.78000 F2400
+G1 X44.829 Y30.598 E1.78400 F2400
+G1 X45.020 Y30.579 E1.78800 F2400
+G1 X45.309 Y30.560 E1.79200 F2400
+G1 X45.610 Y30.555 E1.79600 F2400
+G1 X45.790 Y30.558 E1.80000 F2400
+G1 X46.057 Y30.570 E1.80400 F2400
+G1 X46.248 Y30.585 E1.80800 F2400
+G1 X46.385 Y30.598 E1.81200 F2400
+G1 X46.553 Y30.617 E1.81600 F2400
+G1 X46.681 Y30.633 E1.82000 F2400
+G1 X46.968 Y30.675 E1.82400 F2400
+G1 X47.264 Y30.725 E1.82800 F2400
+G1 X47.388 Y30.747 E1.83200 F2400
+G1 X47.609 Y30.788 E1.83600 F2400
+G1 X47.790 Y30.823 E1.84000 F2400
+G1 X47.912 Y30.846 E1.84400 F2400
+G1 X48.069 Y30.876 E1.84800 F2400
+G1 X48.216 Y30.904 E1.85200 F2400
+G1 X48.460 Y30.948 E1.85600 F2400
+G1 X48.558 Y30.964 E1.86000 F2400
+G1 X48.692 Y30.986 E1.86400 F2400
+G1 X48.873 Y31.014 E1.86800 F2400
+G1 X48.973 Y31.028 E1.87200 F2400
+G1 X49.188 Y31.054 E1.87600 F2400
+G1 X49.399 Y31.074 E1.88000 F2400
+G1 X49.652 Y31.091 E1.88400 F2400
+G1 X49.786 Y31.097 E1.88800 F2400
+G1 X49.934 Y31.100 E1.89200 F2400
+G1 X50.131 Y31.099 E1.89600 F2400
+G1 X50.277 Y31.094 E1.90000 F2400
+G1 X50.483 Y31.083 E1.90400 F2400
+G1 X50.625 Y31.072 E1.90800 F2400
+G1 X50.851 Y31.049 E1.91200 F2400
+G1 X51.098 Y31.018 E1.91600 F2400
+G1 X51.350 Y30.980 E1.92000 F2400
+G1 X51.636 Y30.931 E1.92400 F2400
+G1 X51.841 Y30.893 E1.92800 F2400
+G1 X52.036 Y30.856 E1.93200 F2400
+G1 X52.305 Y30.804 E1.93600 F2400
+G1 X52.559 Y30.757 E1.94000 F2400
+G1 X52.775 Y30.718 E1.94400 F2400
+G1 X52.953 Y30.688 E1.94800 F2400
+G1 X53.112 Y30.663 E1.95200 F2400
+G1 X53.236 Y30.644 E1.95600 F2400
+G1 X53.503 Y30.610 E1.96000 F2400
+G1 X53.630 Y30.596 E1.96400 F2400
+G1 X53.885 Y30.574 E1.96800 F2400
+G1 X54.099 Y30.562 E1.97200 F2400
+G1 X54.399 Y30.555 E1.97600 F2400
+G1 X54.657 Y30.559 E1.98000 F2400
+G1 X54.956 Y30.577 E1.98400 F2400
+G1 X55.085 Y30.589 E1.98800 F2400
+G1 X55.287 Y30.613 E1.99200 F2400
+G1 X55.501 Y30.646 E1.99600 F2400
+G1 X55.663 Y30.675 E2.00000 F2400
+G1 X55.861 Y30.717 E2.00400 F2400
+G1 X56.030 Y30.757 E2.00800 F2400
+G1 X56.230 Y30.810 E2.01200 F2400
+G1 X56.328 Y30.838 E2.01600 F2400
+G1 X56.510 Y30.893 E2.02000 F2400
+G1 X56.692 Y30.952 E2.02400 F2400
+G1 X56.846 Y31.005 E2.02800 F2400
+G1 X57.016 Y31.067 E2.03200 F2400
+G1 X57.259 Y31.159 E2.03600 F2400
+G1 X57.481 Y31.246 E2.04000 F2400
+G1 X57.667 Y31.321 E2.04400 F2400
+G1 X57.881 Y31.409 E2.04800 F2400
+G1 X58.045 Y31.477 E2.05200 F2400
+G1 X58.177 Y31.531 E2.05600 F2400
+G1 X58.271 Y31.570 E2.06000 F2400
+G1 X58.416 Y31.629 E2.06400 F2400
+G1 X58.622 Y31.713 E2.06800 F2400
+G1 X58.882 Y31.816 E2.07200 F2400
+G1 X59.134 Y31.914 E2.07600 F2400
+G1 X59.327 Y31.987 E2.08000 F2400
+G1 X59.613 Y32.092 E2.08400 F2400
+G1 X59.800 Y32.159 E2.08800 F2400
+G1 X60.060 Y32.250 E2.09200 F2400
+G1 X60.239 Y32.312 E2.09600 F2400
+G1 X60.484 Y32.397 E2.10000 F2400
+G1 X60.779 Y32.499 E2.10400 F2400
+G1 X60.940 Y32.555 E2.10800 F2400
+G1 X61.073 Y32.602 E2.11200 F2400
+G1 X61.296 Y32.684 E2.11600 F2400
+G1 X61.500 Y32.761 E2.12000 F2400
+G1 X61.670 Y32.828 E2.12400 F2400
+G1 X61.769 Y32.869 E2.12800 F2400
+G1 X61.943 Y32.942 E2.13200 F2400
+G1 X62.122 Y33.023 E2.13600 F2400
+G1 X62.296 Y33.105 E2.14000 F2400
+G1 X62.553 Y33.237 E2.14400 F2400
+G1 X62.753 Y33.349 E2.14800 F2400
+G1 X62.975 Y33.486 E2.15200 F2400
+G1 X63.218 Y33.652 E2.15600 F2400
+G1 X63.427 Y33.811 E2.16000 F2400
+G1 X63.587 Y33.945 E2.16400 F2400
+G1 X63.780 Y34.122 E2.16800 F2400
+G1 X63.949 Y34.294 E2.17200 F2400
+G1 X64.110 Y34.475 E2.17600 F2400
+G1 X64.261 Y34.661 E2.18000 F2400
+G1 X64.376 Y34.815 E2.18400 F2400
+G1 X64.512 Y35.014 E2.18800 F2400
+G1 X64.641 Y35.220 E2.19200 F2400
+G1 X64.793 Y35.490 E2.19600 F2400
+G1 X64.919 Y35.736 E2.20000 F2400
+G1 X65.043 Y36.001 E2.20400 F2400
+G1 X65.152 Y36.254 E2.20800 F2400
+G1 X65.259 Y36.518 E2.21200 F2400
+G1 X65.345 Y36.742 E2.21600 F2400
+G1 X65.408 Y36.914 E2.22000 F2400
+G1 X65.464 Y37.069 E2.22400 F2400
+G1 X65.551 Y37.312 E2.22800 F2400
+G1 X65.648 Y37.587 E2.23200 F2400
+G1 X65.721 Y37.794 E2.23600 F2400
+G1 X65.767 Y37.923 E2.24000 F2400
+G1 X65.862 Y38.182 E2.24400 F2400
+G1 X65.934 Y38.371 E2.24800 F2400
+G1 X66.005 Y38.554 E2.25200 F2400
+G1 X66.047 Y38.656 E2.25600 F2400
+G1 X66.125 Y38.844 E2.26000 F2400
+G1 X66.224 Y39.071 E2.26400 F2400
+G1 X66.300 Y39.237 E2.26800 F2400
+G1 X66.373 Y39.389 E2.27200 F2400
+G1 X66.474 Y39.592 E2.27600 F2400
+G1 X66.520 Y39.683 E2.28000 F2400
+G1 X66.612 Y39.856 E2.28400 F2400
+G1 X66.747 Y40.103 E2.28800 F2400
+G1 X66.861 Y40.305 E2.29200 F2400
+G1 X66.949 Y40.457 E2.29600 F2400
+G1 X67.066 Y40.657 E2.30000 F2400
+G1 X67.175 Y40.842 E2.30400 F2400
+G1 X67.245 Y40.961 E2.30800 F2400
+G1 X67.314 Y41.080 E2.31200 F2400
+G1 X67.449 Y41.315 E2.31600 F2400
+G1 X67.523 Y41.446 E2.32000 F2400
+G1 X67.577 Y41.544 E2.32400 F2400
+G1 X67.699 Y41.773 E2.32800 F2400
+G1 X67.790 Y41.951 E2.33200 F2400
+G1 X67.864 Y42.104 E2.33600 F2400
+G1 X67.947 Y42.283 E2.34000 F2400
+G1 X68.043 Y42.505 E2.34400 F2400
+G1 X68.092 Y42.626 E2.34800 F2400
+G1 X68.172 Y42.837 E2.35200 F2400
+G1 X68.249 Y43.061 E2.35600 F2400
+G1 X68.325 Y43.307 E2.36000 F2400
+G1 X68.365 Y43.452 E2.36400 F2400
+G1 X68.419 Y43.662 E2.36800 F2400
+G1 X68.451 Y43.802 E2.37200 F2400
+G1 X68.494 Y44.005 E2.37600 F2400
+G1 X68.518 Y44.134 E2.38000 F2400
+G1 X68.561 Y44.383 E2.38400 F2400
+G1 X68.601 Y44.648 E2.38800 F2400
+G1 X68.623 Y44.808 E2.39200 F2400
+G1 X68.640 Y44.948 E2.39600 F2400
+G1 X68.674 Y45.231 E2.40000 F2400
+G1 X68.701 Y45.464 E2.40400 F2400
+G1 X68.730 Y45.723 E2.40800 F2400
+G1 X68.743 Y45.824 E2.41200 F2400
+G1 X68.776 Y46.092 E2.41600 F2400
+G1 X68.806 Y46.305 E2.42000 F2400
+G1 X68.830 Y46.460 E2.42400 F2400
+G1 X68.860 Y46.636 E2.42800 F2400
+G1 X68.904 Y46.874 E2.43200 F2400
+G1 X68.956 Y47.115 E2.43600 F2400
+G1 X68.987 Y47.244 E2.44000 F2400
+G1 X69.041 Y47.455 E2.44400 F2400
+G1 X69.076 Y47.579 E2.44800 F2400
+G1 X69.159 Y47.855 E2.45200 F2400
+G1 X69.218 Y48.032 E2.45600 F2400
+G1 X69.312 Y48.298 E2.46000 F2400
+G1 X69.399 Y48.530 E2.46400 F2400
+G1 X69.482 Y48.740 E2.46800 F2400
+G1 X69.541 Y48.886 E2.47200 F2400
+G1 X69.622 Y49.083 E2.47600 F2400
+G1 X69.674 Y49.206 E2.48000 F2400
+G1 X69.725 Y49.330 E2.48400 F2400
+G1 X69.825 Y49.568 E2.48800 F2400
+G1 X69.895 Y49.738 E2.49200 F2400
+G1 X69.995 Y49.987 E2.49600 F2400
+G0 X69.550 Y50.000 F6000
+G1 X69.647 Y50.245 E2.50000 F2400
+G1 X69.739 Y50.492 E2.50400 F2400
+G1 X69.797 Y50.657 E2.50800 F2400
+G1 X69.838 Y50.781 E2.51200 F2400
+G1 X69.896 Y50.967 E2.51600 F2400
+G1 X69.954 Y51.173 E2.52000 F2400
+G1 X69.987 Y51.298 E2.52400 F2400
+G1 X70.021 Y51.441 E2.52800 F2400
+G1 X70.046 Y51.558 E2.53200 F2400
+G1 X70.088 Y51.788 E2.53600 F2400
+G1 X70.129 Y52.080 E2.54000 F2400
+G1 X70.143 Y52.231 E2.54400 F2400
+G1 X70.151 Y52.344 E2.54800 F2400
+G1 X70.160 Y52.597 E2.55200 F2400
+G1 X70.156 Y52.872 E2.55600 F2400
+G1 X70.133 Y53.177 E2.56000 F2400
+G1 X70.104 Y53.408 E2.56400 F2400
+G1 X70.076 Y53.581 E2.56800 F2400
+G1 X70.020 Y53.855 E2.57200 F2400
+G1 X69.989 Y53.980 E2.57600 F2400
+G1 X69.924 Y54.220 E2.58000 F2400
+G1 X69.888 Y54.340 E2.58400 F2400
+G1 X69.830 Y54.519 E2.58800 F2400
+G1 X69.761 Y54.715 E2.59200 F2400
+G1 X69.697 Y54.887 E2.59600 F2400
+G1 X69.646 Y55.017 E2.60000 F2400
+G1 X69.589 Y55.159 E2.60400 F2400
+G1 X69.482 Y55.413 E2.60800 F2400
+G1 X69.401 Y55.597 E2.61200 F2400
+G1 X69.310 Y55.803 E2.61600 F2400
+G1 X69.249 Y55.938 E2.62000 F2400
+G1 X69.144 Y56.167 E2.62400 F2400
+G1 X69.073 Y56.323 E2.62800 F2400
+G1 X68.980 Y56.529 E2.63200 F2400
+G1 X68.861 Y56.794 E2.63600 F2400
+G1 X68.737 Y57.075 E2.64000 F2400
+G1 X68.692 Y57.177 E2.64400 F2400
+G1 X68.588 Y57.422 E2.64800 F2400
+G1 X68.480 Y57.678 E2.65200 F2400
+G1 X68.416 Y57.833 E2.65600 F2400
+G1 X68.347 Y58.000 E2.66000 F2400
+G1 X68.264 Y58.205 E2.66400 F2400
+G1 X68.153 Y58.474 E2.66800 F2400
+G1 X68.082 Y58.645 E2.67200 F2400
+G1 X67.971 Y58.906 E2.67600 F2400
+G1 X67.867 Y59.143 E2.68000 F2400
+G1 X67.812 Y59.265 E2.68400 F2400
+G1 X67.687 Y59.527 E2.68800 F2400
+G1 X67.639 Y59.622 E2.69200 F2400
+G1 X67.579 Y59.740 E2.69600 F2400
+G1 X67.464 Y59.950 E2.70000 F2400
+G1 X67.407 Y60.050 E2.70400 F2400
+G1 X67.314 Y60.205 E2.70800 F2400
+G1 X67.245 Y60.314 E2.71200 F2400
+G1 X67.135 Y60.479 E2.71600 F2400
+G1 X66.973 Y60.702 E2.72000 F2400
+G1 X66.791 Y60.929 E2.72400 F2400
+G1 X66.719 Y61.012 E2.72800 F2400
+G1 X66.642 Y61.099 E2.73200 F2400
+G1 X66.448 Y61.299 E2.73600 F2400
+G1 X66.367 Y61.377 E2.74000 F2400
+G1 X66.248 Y61.487 E2.74400 F2400
+G1 X66.151 Y61.572 E2.74800 F2400
+G1 X66.057 Y61.651 E2.75200 F2400
+G1 X65.970 Y61.721 E2.75600 F2400
+G1 X65.780 Y61.866 E2.76000 F2400
+G1 X65.565 Y62.018 E2.76400 F2400
+G1 X65.355 Y62.156 E2.76800 F2400
+G1 X65.111 Y62.305 E2.77200 F2400
+G1 X64.897 Y62.428 E2.77600 F2400
+G1 X64.731 Y62.519 E2.78000 F2400
+G1 X64.520 Y62.632 E2.78400 F2400
+G1 X64.245 Y62.774 E2.78800 F2400
+G1 X64.032 Y62.882 E2.79200 F2400
+G1 X63.895 Y62.952 E2.79600 F2400
+G1 X63.792 Y63.004 E2.80000 F2400
+G1 X63.530 Y63.138 E2.80400 F2400
+G1 X63.335 Y63.241 E2.80800 F2400
+G1 X63.186 Y63.322 E2.81200 F2400
+G1 X62.995 Y63.430 E2.81600 F2400
+G1 X62.816 Y63.535 E2.82000 F2400
+G1 X62.647 Y63.640 E2.82400 F2400
+G1 X62.556 Y63.699 E2.82800 F2400
+G1 X62.420 Y63.790 E2.83200 F2400
+G1 X62.278 Y63.891 E2.83600 F2400
+G1 X62.171 Y63.970 E2.84000 F2400
+G1 X61.965 Y64.132 E2.84400 F2400
+G1 X61.831 Y64.244 E2.84800 F2400
+G1 X61.666 Y64.390 E2.85200 F2400
+G1 X61.497 Y64.548 E2.85600 F2400
+G1 X61.328 Y64.715 E2.86000 F2400
+G1 X61.164 Y64.883 E2.86400 F2400
+G1 X60.998 Y65.060 E2.86800 F2400
+G1 X60.899 Y65.167 E2.87200 F2400
+G1 X60.704 Y65.381 E2.87600 F2400
+G1 X60.618 Y65.476 E2.88000 F2400
+G1 X60.429 Y65.683 E2.88400 F2400
+G1 X60.245 Y65.881 E2.88800 F2400
+G1 X60.059 Y66.075 E2.89200 F2400
+G1 X59.981 Y66.154 E2.89600 F2400
+G1 X59.898 Y66.237 E2.90000 F2400
+G1 X59.708 Y66.419 E2.90400 F2400
+G1 X59.565 Y66.550 E2.90800 F2400
+G1 X59.435 Y66.664 E2.91200 F2400
+G1 X59.206 Y66.852 E2.91600 F2400
+G1 X59.121 Y66.917 E2.92000 F2400
+G1 X58.956 Y67.039 E2.92400 F2400
+G1 X58.802 Y67.147 E2.92800 F2400
+G1 X58.698 Y67.215 E2.93200 F2400
+G1 X58.548 Y67.310 E2.93600 F2400
+G1 X58.342 Y67.432 E2.94000 F2400
+G1 X58.101 Y67.563 E2.94400 F2400
+G1 X58.008 Y67.610 E2.94800 F2400
+G1 X57.826 Y67.699 E2.95200 F2400
+G1 X57.720 Y67.748 E2.95600 F2400
+G1 X57.485 Y67.853 E2.96000 F2400
+G1 X57.378 Y67.898 E2.96400 F2400
+G1 X57.280 Y67.938 E2.96800 F2400
+G1 X57.117 Y68.003 E2.97200 F2400
+G1 X56.890 Y68.091 E2.97600 F2400
+G1 X56.739 Y68.148 E2.98000 F2400
+G1 X56.622 Y68.191 E2.98400 F2400
+G1 X56.381 Y68.280 E2.98800 F2400
+G1 X56.138 Y68.369 E2.99200 F2400
+G1 X55.886 Y68.463 E2.99600 F2400
+G1 X55.737 Y68.520 E3.00000 F2400
+G1 X55.566 Y68.587 E3.00400 F2400
+G1 X55.427 Y68.642 E3.00800 F2400
+G1 X55.232 Y68.722 E3.01200 F2400
+G1 X55.078 Y68.787 E3.01600 F2400
+G1 X54.923 Y68.854 E3.02000 F2400
+G1 X54.686 Y68.961 E3.02400 F2400
+G1 X54.417 Y69.087 E3.02800 F2400
+G1 X54.216 Y69.184 E3.03200 F2400
+G1 X54.103 Y69.240 E3.03600 F2400
+G1 X53.888 Y69.347 E3.04000 F2400
+G1 X53.710 Y69.437 E3.04400 F2400
+G1 X53.430 Y69.580 E3.04800 F2400
+G1 X53.197 Y69.697 E3.05200 F2400
+G1 X52.941 Y69.825 E3.05600 F2400
+G1 X52.708 Y69.937 E3.06000 F2400
+G1 X52.504 Y70.030 E3.06400 F2400
+G1 X52.228 Y70.151 E3.06800 F2400
+G1 X51.960 Y70.257 E3.07200 F2400
+G1 X51.800 Y70.316 E3.07600 F2400
+G1 X51.666 Y70.362 E3.08000 F2400
+G1 X51.488 Y70.419 E3.08400 F2400
+G1 X51.278 Y70.479 E3.08800 F2400
+G1 X51.154 Y70.510 E3.09200 F2400
+G1 X50.978 Y70.549 E3.09600 F2400
+G1 X50.753 Y70.590 E3.10000 F2400
+G1 X50.639 Y70.606 E3.10400 F2400
+G1 X50.362 Y70.636 E3.10800 F2400
+G1 X50.119 Y70.648 E3.11200 F2400
+G1 X49.947 Y70.650 E3.11600 F2400
+G1 X49.779 Y70.645 E3.12000 F2400
+G1 X49.599 Y70.633 E3.12400 F2400
+G1 X49.425 Y70.615 E3.12800 F2400
+G1 X49.163 Y70.576 E3.13200 F2400
+G1 X48.954 Y70.534 E3.13600 F2400
+G1 X48.741 Y70.483 E3.14000 F2400
+G1 X48.607 Y70.447 E3.14400 F2400
+G1 X48.317 Y70.357 E3.14800 F2400
+G1 X48.149 Y70.298 E3.15200 F2400
+G1 X47.982 Y70.235 E3.15600 F2400
+G1 X47.867 Y70.190 E3.16000 F2400
+G1 X47.573 Y70.065 E3.16400 F2400
+G1 X47.380 Y69.978 E3.16800 F2400
+G1 X47.105 Y69.847 E3.17200 F2400
+G1 X46.830 Y69.711 E3.17600 F2400
+G1 X46.550 Y69.570 E3.18000 F2400
+G1 X46.302 Y69.444 E3.18400 F2400
+G1 X46.035 Y69.309 E3.18800 F2400
+G1 X45.770 Y69.177 E3.19200 F2400
+G1 X45.529 Y69.061 E3.19600 F2400
+G1 X45.412 Y69.006 E3.20000 F2400
+G1 X45.222 Y68.919 E3.20400 F2400
+G1 X45.023 Y68.831 E3.20800 F2400
+G1 X44.748 Y68.713 E3.21200 F2400
+G1 X44.510 Y68.617 E3.21600 F2400
+G1 X44.287 Y68.529 E3.22000 F2400
+G1 X44.056 Y68.441 E3.22400 F2400
+G1 X43.895 Y68.382 E3.22800 F2400
+G1 X43.627 Y68.283 E3.23200 F2400
+G1 X43.415 Y68.205 E3.23600 F2400
+G1 X43.247 Y68.143 E3.24000 F2400
+G1 X43.068 Y68.075 E3.24400 F2400
+G1 X42.795 Y67.968 E3.24800 F2400
+G1 X42.606 Y67.891 E3.25200 F2400
+G1 X42.484 Y67.839 E3.25600 F2400
+G1 X42.367 Y67.788 E3.26000 F2400
+G1 X42.153 Y67.689 E3.26400 F2400
+G1 X41.964 Y67.596 E3.26800 F2400
+G1 X41.718 Y67.466 E3.27200 F2400
+G1 X41.600 Y67.399 E3.27600 F2400
+G1 X41.445 Y67.306 E3.28000 F2400
+G1 X41.240 Y67.175 E3.28400 F2400
+G1 X41.150 Y67.113 E3.28800 F2400
+G1 X41.052 Y67.045 E3.29200 F2400
+G1 X40.885 Y66.922 E3.29600 F2400
+G1 X40.764 Y66.828 E3.30000 F2400
+G1 X40.670 Y66.752 E3.30400 F2400
+G1 X40.554 Y66.654 E3.30800 F2400
+G1 X40.384 Y66.505 E3.31200 F2400
+G1 X40.234 Y66.365 E3.31600 F2400
+G1 X40.151 Y66.285 E3.32000 F2400
+G1 X40.069 Y66.205 E3.32400 F2400
+G1 X39.880 Y66.012 E3.32800 F2400
+G1 X39.723 Y65.847 E3.33200 F2400
+G1 X39.632 Y65.749 E3.33600 F2400
+G1 X39.449 Y65.550 E3.34000 F2400
+G1 X39.380 Y65.474 E3.34400 F2400
+G1 X39.265 Y65.347 E3.34800 F2400
+G1 X39.087 Y65.152 E3.35200 F2400
+G1 X38.927 Y64.980 E3.35600 F2400
+G1 X38.823 Y64.870 E3.36000 F2400
+G1 X38.636 Y64.679 E3.36400 F2400
+G1 X38.486 Y64.532 E3.36800 F2400
+G1 X38.296 Y64.356 E3.37200 F2400
+G1 X38.097 Y64.183 E3.37600 F2400
+G1 X37.961 Y64.072 E3.38000 F2400
+G1 X37.784 Y63.936 E3.38400 F2400
+G1 X37.622 Y63.820 E3.38800 F2400
+G1 X37.392 Y63.665 E3.39200 F2400
+G1 X37.178 Y63.532 E3.39600 F2400
+G1 X36.971 Y63.410 E3.40000 F2400
+G1 X36.742 Y63.283 E3.40400 F2400
+G1 X36.475 Y63.141 E3.40800 F2400
+G1 X36.338 Y63.070 E3.41200 F2400
+G1 X36.210 Y63.005 E3.41600 F2400
+G1 X35.980 Y62.888 E3.42000 F2400
+G1 X35.743 Y62.768 E3.42400 F2400
+G1 X35.553 Y62.670 E3.42800 F2400
+G1 X35.369 Y62.573 E3.43200 F2400
+G1 X35.200 Y62.482 E3.43600 F2400
+G1 X34.945 Y62.337 E3.44000 F2400
+G1 X34.709 Y62.195 E3.44400 F2400
+G1 X34.515 Y62.071 E3.44800 F2400
+G1 X34.420 Y62.007 E3.45200 F2400
+G1 X34.187 Y61.842 E3.45600 F2400
+G1 X34.027 Y61.719 E3.46000 F2400
+G1 X33.915 Y61.628 E3.46400 F2400
+G1 X33.788 Y61.519 E3.46800 F2400
+G1 X33.605 Y61.351 E3.47200 F2400
+G1 X33.530 Y61.277 E3.47600 F2400
+G1 X33.440 Y61.185 E3.48000 F2400
+G1 X33.326 Y61.063 E3.48400 F2400
+G1 X33.140 Y60.846 E3.48800 F2400
+G1 X32.982 Y60.643 E3.49200 F2400
+G1 X32.808 Y60.395 E3.49600 F2400
+G1 X32.692 Y60.215 E3.50000 F2400
+G1 X32.579 Y60.026 E3.50400 F2400
+G1 X32.473 Y59.837 E3.50800 F2400
+G1 X32.375 Y59.650 E3.51200 F2400
+G1 X32.280 Y59.458 E3.51600 F2400
+G1 X32.165 Y59.213 E3.52000 F2400
+G1 X32.043 Y58.940 E3.52400 F2400
+G1 X31.970 Y58.768 E3.52800 F2400
+G1 X31.880 Y58.554 E3.53200 F2400
+G1 X31.817 Y58.401 E3.53600 F2400
+G1 X31.754 Y58.249 E3.54000 F2400
+G1 X31.676 Y58.058 E3.54400 F2400
+G1 X31.592 Y57.853 E3.54800 F2400
+G1 X31.510 Y57.654 E3.55200 F2400
+G1 X31.392 Y57.375 E3.55600 F2400
+G1 X31.339 Y57.250 E3.56000 F2400
+G1 X31.246 Y57.036 E3.56400 F2400
+G1 X31.122 Y56.756 E3.56800 F2400
+G1 X31.018 Y56.523 E3.57200 F2400
+G1 X30.927 Y56.323 E3.57600 F2400
+G1 X30.852 Y56.159 E3.58000 F2400
+G1 X30.775 Y55.989 E3.58400 F2400
+G1 X30.652 Y55.717 E3.58800 F2400
+G1 X30.535 Y55.451 E3.59200 F2400
+G1 X30.439 Y55.226 E3.59600 F2400
+G1 X30.329 Y54.955 E3.60000 F2400
+G1 X30.225 Y54.676 E3.60400 F2400
+G1 X30.134 Y54.409 E3.60800 F2400
+G1 X30.080 Y54.233 E3.61200 F2400
+G1 X30.026 Y54.038 E3.61600 F2400
+G1 X29.963 Y53.775 E3.62000 F2400
+G1 X29.927 Y53.597 E3.62400 F2400
+G1 X29.886 Y53.340 E3.62800 F2400
+G1 X29.863 Y53.136 E3.63200 F2400
+G1 X29.849 Y52.962 E3.63600 F2400
+G1 X29.841 Y52.762 E3.64000 F2400
+G1 X29.840 Y52.632 E3.64400 F2400
+G1 X29.843 Y52.453 E3.64800 F2400
+G1 X29.854 Y52.260 E3.65200 F2400
+G1 X29.864 Y52.151 E3.65600 F2400
+G1 X29.880 Y52.010 E3.66000 F2400
+G1 X29.902 Y51.850 E3.66400 F2400
+G1 X29.953 Y51.565 E3.66800 F2400
+G1 X30.004 Y51.337 E3.67200 F2400
+G1 X30.046 Y51.173 E3.67600 F2400
+G1 X30.136 Y50.862 E3.68000 F2400
+G1 X30.187 Y50.706 E3.68400 F2400
+G1 X30.259 Y50.499 E3.68800 F2400
+G1 X30.353 Y50.247 E3.69200 F2400
+G1 X30.447 Y50.007 E3.69600 F2400
+G1 X30.523 Y49.821 E3.70000 F2400
+G1 X30.629 Y49.569 E3.70400 F2400
+G1 X30.711 Y49.376 E3.70800 F2400
+G1 X30.812 Y49.141 E3.71200 F2400
+G1 X30.892 Y48.950 E3.71600 F2400
+G1 X31.007 Y48.669 E3.72000 F2400
+G1 X31.098 Y48.439 E3.72400 F2400
+G1 X31.140 Y48.328 E3.72800 F2400
+G1 X31.184 Y48.209 E3.73200 F2400
+G1 X31.278 Y47.934 E3.73600 F2400
+G1 X31.322 Y47.798 E3.74000 F2400
+G1 X31.352 Y47.700 E3.74400 F2400
+G1 X31.393 Y47.559 E3.74800 F2400
+G1 X31.442 Y47.376 E3.75200 F2400
+G1 X31.506 Y47.104 E3.75600 F2400
+G1 X31.542 Y46.936 E3.76000 F2400
+G1 X31.585 Y46.706 E3.76400 F2400
+G1 X31.626 Y46.453 E3.76800 F2400
+G1 X31.642 Y46.342 E3.77200 F2400
+G1 X31.671 Y46.130 E3.77600 F2400
+G1 X31.706 Y45.844 E3.78000 F2400
+G1 X31.729 Y45.642 E3.78400 F2400
+G1 X31.751 Y45.443 E3.78800 F2400
+G1 X31.769 Y45.280 E3.79200 F2400
+G1 X31.802 Y45.000 E3.79600 F2400
+G1 X31.840 Y44.715 E3.80000 F2400
+G1 X31.857 Y44.598 E3.80400 F2400
+G1 X31.889 Y44.395 E3.80800 F2400
+G1 X31.920 Y44.218 E3.81200 F2400
+G1 X31.965 Y43.993 E3.81600 F2400
+G1 X31.991 Y43.875 E3.82000 F2400
+G1 X32.026 Y43.729 E3.82400 F2400
+G1 X32.064 Y43.582 E3.82800 F2400
+G1 X32.116 Y43.397 E3.83200 F2400
+G1 X32.193 Y43.156 E3.83600 F2400
+G1 X32.282 Y42.907 E3.84000 F2400
+G1 X32.374 Y42.673 E3.84400 F2400
+G1 X32.465 Y42.462 E3.84800 F2400
+G1 X32.513 Y42.358 E3.85200 F2400
+G1 X32.588 Y42.201 E3.85600 F2400
+G1 X32.691 Y41.997 E3.86000 F2400
+G1 X32.763 Y41.860 E3.86400 F2400
+G1 X32.857 Y41.687 E3.86800 F2400
+G1 X32.992 Y41.449 E3.87200 F2400
+G1 X33.052 Y41.345 E3.87600 F2400
+G1 X33.185 Y41.117 E3.88000 F2400
+G1 X33.245 Y41.015 E3.88400 F2400
+G1 X33.332 Y40.867 E3.88800 F2400
+G1 X33.470 Y40.631 E3.89200 F2400
+G1 X33.538 Y40.513 E3.89600 F2400
+G1 X33.636 Y40.340 E3.90000 F2400
+G1 X33.722 Y40.184 E3.90400 F2400
+G1 X33.849 Y39.945 E3.90800 F2400
+G1 X33.980 Y39.684 E3.91200 F2400
+G1 X34.047 Y39.544 E3.91600 F2400
+G1 X34.129 Y39.366 E3.92000 F2400
+G1 X34.240 Y39.111 E3.92400 F2400
+G1 X34.320 Y38.917 E3.92800 F2400
+G1 X34.374 Y38.782 E3.93200 F2400
+G1 X34.465 Y38.542 E3.93600 F2400
+G1 X34.525 Y38.380 E3.94000 F2400
+G1 X34.594 Y38.187 E3.94400 F2400
+G1 X34.629 Y38.086 E3.94800 F2400
+G1 X34.732 Y37.789 E3.95200 F2400
+G1 X34.812 Y37.556 E3.95600 F2400
+G1 X34.913 Y37.266 E3.96000 F2400
+G1 X35.021 Y36.967 E3.96400 F2400
+G1 X35.080 Y36.811 E3.96800 F2400
+G1 X35.163 Y36.600 E3.97200 F2400
+G1 X35.241 Y36.411 E3.97600 F2400
+G1 X35.352 Y36.160 E3.98000 F2400
+G1 X35.480 Y35.898 E3.98400 F2400
+G1 X35.553 Y35.759 E3.98800 F2400
+G1 X35.634 Y35.612 E3.99200 F2400
+G1 X35.768 Y35.390 E3.99600 F2400
+G1 X35.875 Y35.227 E4.00000 F2400
+G1 X35.952 Y35.116 E4.00400 F2400
+G1 X36.040 Y34.998 E4.00800 F2400
+G1 X36.181 Y34.822 E4.01200 F2400
+G1 X36.334 Y34.647 E4.01600 F2400
+G1 X36.550 Y34.428 E4.02000 F2400
+G1 X36.711 Y34.281 E4.02400 F2400
+G1 X36.891 Y34.133 E4.02800 F2400
+G1 X37.000 Y34.049 E4.03200 F2400
+G1 X37.156 Y33.937 E4.03600 F2400
+G1 X37.293 Y33.846 E4.04000 F2400
+G1 X37.508 Y33.714 E4.04400 F2400
+G1 X37.650 Y33.633 E4.04800 F2400
+G1 X37.783 Y33.562 E4.05200 F2400
+G1 X37.948 Y33.479 E4.05600 F2400
+G1 X38.134 Y33.391 E4.06000 F2400
+G1 X38.298 Y33.319 E4.06400 F2400
+G1 X38.515 Y33.228 E4.06800 F2400
+G1 X38.649 Y33.174 E4.07200 F2400
+G1 X38.924 Y33.070 E4.07600 F2400
+G1 X39.162 Y32.984 E4.08000 F2400
+G1 X39.369 Y32.912 E4.08400 F2400
+G1 X39.480 Y32.874 E4.08800 F2400
+G1 X39.645 Y32.818 E4.09200 F2400
+G1 X39.881 Y32.738 E4.09600 F2400
+G1 X40.107 Y32.661 E4.10000 F2400
+G1 X40.364 Y32.572 E4.10400 F2400
+G1 X40.634 Y32.476 E4.10800 F2400
+G1 X40.791 Y32.419 E4.11200 F2400
+G1 X40.982 Y32.349 E4.11600 F2400
+G1 X41.140 Y32.289 E4.12000 F2400
+G1 X41.259 Y32.243 E4.12400 F2400
+G1 X41.380 Y32.195 E4.12800 F2400
+G1 X41.523 Y32.139 E4.13200 F2400
+G1 X41.633 Y32.094 E4.13600 F2400
+G1 X41.828 Y32.015 E4.14000 F2400
+G1 X42.053 Y31.923 E4.14400 F2400
+G1 X42.252 Y31.841 E4.14800 F2400
+G1 X42.473 Y31.750 E4.15200 F2400
+G1 X42.609 Y31.695 E4.15600 F2400
+G1 X42.740 Y31.642 E4.16000 F2400
+G1 X42.941 Y31.564 E4.16400 F2400
+G1 X43.203 Y31.466 E4.16800 F2400
+G1 X43.378 Y31.404 E4.17200 F2400
+G1 X43.475 Y31.371 E4.17600 F2400
+G1 X43.574 Y31.338 E4.18000 F2400
+G1 X43.730 Y31.290 E4.18400 F2400
+G1 X43.946 Y31.228 E4.18800 F2400
+G1 X44.060 Y31.197 E4.19200 F2400
+G1 X44.202 Y31.163 E4.19600 F2400
+G1 X44.436 Y31.112 E4.20000 F2400
+G1 X44.732 Y31.061 E4.20400 F2400
+G1 X44.901 Y31.038 E4.20800 F2400
+G1 X45.124 Y31.016 E4.21200 F2400
+G1 X45.330 Y31.002 E4.21600 F2400
+G1 X45.437 Y30.997 E4.22000 F2400
+G1 X45.607 Y30.994 E4.22400 F2400
+G1 X45.737 Y30.994 E4.22800 F2400
+G1 X45.891 Y30.998 E4.23200 F2400
+G1 X46.152 Y31.011 E4.23600 F2400
+G1 X46.394 Y31.032 E4.24000 F2400
+G1 X46.505 Y31.044 E4.24400 F2400
+G1 X46.623 Y31.059 E4.24800 F2400
+G1 X46.873 Y31.094 E4.25200 F2400
+G1 X46.996 Y31.113 E4.25600 F2400
+G1 X47.162 Y31.141 E4.26000 F2400
+G1 X47.317 Y31.168 E4.26400 F2400
+G1 X47.428 Y31.189 E4.26800 F2400
+G1 X47.535 Y31.209 E4.27200 F2400
+G1 X47.663 Y31.234 E4.27600 F2400
+G1 X47.842 Y31.270 E4.28000 F2400
+G1 X48.126 Y31.326 E4.28400 F2400
+G1 X48.349 Y31.369 E4.28800 F2400
+G1 X48.494 Y31.396 E4.29200 F2400
+G1 X48.722 Y31.435 E4.29600 F2400
+G1 X48.871 Y31.459 E4.30000 F2400
+G1 X49.066 Y31.486 E4.30400 F2400
+G1 X49.222 Y31.505 E4.30800 F2400
+G1 X49.498 Y31.531 E4.31200 F2400
+G1 X49.659 Y31.541 E4.31600 F2400
+G1 X49.905 Y31.549 E4.32000 F2400
+G1 X50.120 Y31.549 E4.32400 F2400
+G1 X50.374 Y31.539 E4.32800 F2400
+G1 X50.584 Y31.524 E4.33200 F2400
+G1 X50.844 Y31.497 E4.33600 F2400
+G1 X51.017 Y31.475 E4.34000 F2400
+G1 X51.244 Y31.441 E4.34400 F2400
+G1 X51.461 Y31.404 E4.34800 F2400
+G1 X51.661 Y31.367 E4.35200 F2400
+G1 X51.870 Y31.327 E4.35600 F2400
+G1 X52.074 Y31.286 E4.36000 F2400
+G1 X52.252 Y31.251 E4.36400 F2400
+G1 X52.532 Y31.197 E4.36800 F2400
+G1 X52.760 Y31.154 E4.37200 F2400
+G1 X52.973 Y31.118 E4.37600 F2400
+G1 X53.086 Y31.100 E4.38000 F2400
+G1 X53.291 Y31.070 E4.38400 F2400
+G1 X53.429 Y31.052 E4.38800 F2400
+G1 X53.576 Y31.035 E4.39200 F2400
+G1 X53.768 Y31.018 E4.39600 F2400
+G1 X53.982 Y31.003 E4.40000 F2400
+G1 X54.136 Y30.997 E4.40400 F2400
+G1 X54.294 Y30.994 E4.40800 F2400
+G1 X54.505 Y30.995 E4.41200 F2400
+G1 X54.703 Y31.003 E4.41600 F2400
+G1 X54.886 Y31.016 E4.42000 F2400
+G1 X55.008 Y31.028 E4.42400 F2400
+G1 X55.184 Y31.049 E4.42800 F2400
+G1 X55.416 Y31.085 E4.43200 F2400
+G1 X55.623 Y31.124 E4.43600 F2400
+G1 X55.829 Y31.170 E4.44000 F2400
+G1 X56.092 Y31.238 E4.44400 F2400
+G1 X56.329 Y31.308 E4.44800 F2400
+G1 X56.557 Y31.382 E4.45200 F2400
+G1 X56.658 Y31.416 E4.45600 F2400
+G1 X56.812 Y31.471 E4.46000 F2400
+G1 X57.035 Y31.555 E4.46400 F2400
+G1 X57.159 Y31.603 E4.46800 F2400
+G1 X57.424 Y31.708 E4.47200 F2400
+G1 X57.544 Y31.757 E4.47600 F2400
+G1 X57.802 Y31.863 E4.48000 F2400
+G1 X57.936 Y31.918 E4.48400 F2400
+G1 X58.187 Y32.021 E4.48800 F2400
+G1 X58.439 Y32.124 E4.49200 F2400
+G1 X58.597 Y32.186 E4.49600 F2400
+G1 X58.860 Y32.288 E4.50000 F2400
+G1 X58.986 Y32.336 E4.50400 F2400
+G1 X59.244 Y32.432 E4.50800 F2400
+G1 X59.414 Y32.494 E4.51200 F2400
+G1 X59.597 Y32.558 E4.51600 F2400
+G1 X59.718 Y32.600 E4.52000 F2400
+G1 X59.934 Y32.675 E4.52400 F2400
+G1 X60.086 Y32.726 E4.52800 F2400
+G1 X60.317 Y32.805 E4.53200 F2400
+G1 X60.576 Y32.893 E4.53600 F2400
+G1 X60.796 Y32.970 E4.54000 F2400
+G1 X60.898 Y33.006 E4.54400 F2400
+G1 X61.187 Y33.112 E4.54800 F2400
+G1 X61.469 Y33.221 E4.55200 F2400
+G1 X61.693 Y33.315 E4.55600 F2400
+G1 X61.864 Y33.390 E4.56000 F2400
+G1 X62.068 Y33.487 E4.56400 F2400
+G1 X62.329 Y33.622 E4.56800 F2400
+G1 X62.506 Y33.722 E4.57200 F2400
+G1 X62.736 Y33.865 E4.57600 F2400
+G1 X62.927 Y33.996 E4.58000 F2400
+G1 X63.082 Y34.112 E4.58400 F2400
+G1 X63.315 Y34.304 E4.58800 F2400
+G1 X63.456 Y34.434 E4.59200 F2400
+G1 X63.621 Y34.599 E4.59600 F2400
+G1 X63.700 Y34.685 E4.60000 F2400
+G1 X63.835 Y34.840 E4.60400 F2400
+G1 X63.906 Y34.929 E4.60800 F2400
+G1 X64.060 Y35.133 E4.61200 F2400
+G1 X64.121 Y35.221 E4.61600 F2400
+G1 X64.186 Y35.318 E4.62000 F2400
+G1 X64.256 Y35.428 E4.62400 F2400
+G1 X64.327 Y35.546 E4.62800 F2400
+G1 X64.435 Y35.735 E4.63200 F2400
+G1 X64.521 Y35.899 E4.63600 F2400
+G1 X64.595 Y36.049 E4.64000 F2400
+G1 X64.729 Y36.342 E4.64400 F2400
+G1 X64.847 Y36.626 E4.64800 F2400
+G1 X64.939 Y36.860 E4.65200 F2400
+G1 X65.036 Y37.125 E4.65600 F2400
+G1 X65.132 Y37.393 E4.66000 F2400
+G1 X65.184 Y37.545 E4.66400 F2400
+G1 X65.275 Y37.808 E4.66800 F2400
+G1 X65.326 Y37.956 E4.67200 F2400
+G1 X65.400 Y38.167 E4.67600 F2400
+G1 X65.459 Y38.335 E4.68000 F2400
+G1 X65.506 Y38.463 E4.68400 F2400
+G1 X65.598 Y38.709 E4.68800 F2400
+G1 X65.703 Y38.975 E4.69200 F2400
+G1 X65.766 Y39.126 E4.69600 F2400
+G1 X65.876 Y39.378 E4.70000 F2400
+G1 X65.946 Y39.530 E4.70400 F2400
+G1 X66.045 Y39.735 E4.70800 F2400
+G1 X66.177 Y39.995 E4.71200 F2400
+G1 X66.294 Y40.214 E4.71600 F2400
+G1 X66.346 Y40.309 E4.72000 F2400
+G1 X66.436 Y40.467 E4.72400 F2400
+G1 X66.520 Y40.615 E4.72800 F2400
+G1 X66.598 Y40.748 E4.73200 F2400
+G1 X66.728 Y40.969 E4.73600 F2400
+G1 X66.821 Y41.127 E4.74000 F2400
+G1 X66.939 Y41.328 E4.74400 F2400
+G1 X67.049 Y41.520 E4.74800 F2400
+G1 X67.146 Y41.694 E4.75200 F2400
+G1 X67.198 Y41.789 E4.75600 F2400
+G1 X67.306 Y41.991 E4.76000 F2400
+G1 X67.428 Y42.234 E4.76400 F2400
+G1 X67.484 Y42.352 E4.76800 F2400
+G1 X67.576 Y42.556 E4.77200 F2400
+G1 X67.651 Y42.734 E4.77600 F2400
+G1 X67.711 Y42.886 E4.78000 F2400
+G1 X67.791 Y43.109 E4.78400 F2400
+G1 X67.879 Y43.383 E4.78800 F2400
+G1 X67.908 Y43.481 E4.79200 F2400
+G1 X67.978 Y43.745 E4.79600 F2400
+G1 X68.017 Y43.913 E4.80000 F2400
+G1 X68.071 Y44.169 E4.80400 F2400
+G1 X68.095 Y44.299 E4.80800 F2400
+G1 X68.134 Y44.534 E4.81200 F2400
+G1 X68.151 Y44.650 E4.81600 F2400
+G1 X68.174 Y44.811 E4.82000 F2400
+G1 X68.210 Y45.096 E4.82400 F2400
+G1 X68.235 Y45.320 E4.82800 F2400
+G1 X68.263 Y45.568 E4.83200 F2400
+G1 X68.284 Y45.752 E4.83600 F2400
+G1 X68.305 Y45.939 E4.84000 F2400
+G1 X68.329 Y46.128 E4.84400 F2400
+G1 X68.362 Y46.371 E4.84800 F2400
+G1 X68.397 Y46.602 E4.85200 F2400
+G1 X68.420 Y46.733 E4.85600 F2400
+G1 X68.453 Y46.910 E4.86000 F2400
+G1 X68.494 Y47.105 E4.86400 F2400
+G1 X68.541 Y47.306 E4.86800 F2400
+G1 X68.611 Y47.573 E4.87200 F2400
+G1 X68.686 Y47.823 E4.87600 F2400
+G1 X68.725 Y47.944 E4.88000 F2400
+G1 X68.781 Y48.108 E4.88400 F2400
+G1 X68.821 Y48.223 E4.88800 F2400
+G1 X68.858 Y48.322 E4.89200 F2400
+G1 X68.899 Y48.430 E4.89600 F2400
+G1 X68.949 Y48.559 E4.90000 F2400
+G1 X69.046 Y48.799 E4.90400 F2400
+G1 X69.139 Y49.023 E4.90800 F2400
+G1 X69.245 Y49.274 E4.91200 F2400
+G1 X69.310 Y49.427 E4.91600 F2400
+G1 X69.365 Y49.555 E4.92000 F2400
+G1 X69.487 Y49.846 E4.92400 F2400
+G1 Z0.500 F3000
+G0 X70.673 Y50.000 F6000
+G1 X70.757 Y50.300 E4.92800 F2400
+G1 X70.784 Y50.409 E4.93200 F2400
+G1 X70.828 Y50.596 E4.93600 F2400
+G1 X70.878 Y50.835 E4.94000 F2400
+G1 X70.922 Y51.096 E4.94400 F2400
+G1 X70.959 Y51.395 E4.94800 F2400
+G1 X70.976 Y51.615 E4.95200 F2400
+G1 X70.984 Y51.803 E4.95600 F2400
+G1 X70.985 Y51.910 E4.96000 F2400
+G1 X70.978 Y52.186 E4.96400 F2400
+G1 X70.951 Y52.498 E4.96800 F2400
+G1 X70.907 Y52.791 E4.97200 F2400
+G1 X70.858 Y53.032 E4.97600 F2400
+G1 X70.814 Y53.205 E4.98000 F2400
+G1 X70.771 Y53.355 E4.98400 F2400
+G1 X70.686 Y53.613 E4.98800 F2400
+G1 X70.576 Y53.899 E4.99200 F2400
+G1 X70.449 Y54.185 E4.99600 F2400
+G1 X70.386 Y54.316 E5.00000 F2400
+G1 X70.279 Y54.523 E5.00400 F2400
+G1 X70.174 Y54.715 E5.00800 F2400
+G1 X70.074 Y54.889 E5.01200 F2400
+G1 X69.929 Y55.128 E5.01600 F2400
+G1 X69.764 Y55.389 E5.02000 F2400
+G1 X69.621 Y55.609 E5.02400 F2400
+G1 X69.480 Y55.822 E5.02800 F2400
+G1 X69.340 Y56.032 E5.03200 F2400
+G1 X69.205 Y56.234 E5.03600 F2400
+G1 X69.085 Y56.414 E5.04000 F2400
+G1 X69.000 Y56.544 E5.04400 F2400
+G1 X68.856 Y56.766 E5.04800 F2400
+G1 X68.788 Y56.873 E5.05200 F2400
+G1 X68.665 Y57.071 E5.05600 F2400
+G1 X68.572 Y57.225 E5.06000 F2400
+G1 X68.463 Y57.409 E5.06400 F2400
+G1 X68.349 Y57.608 E5.06800 F2400
+G1 X68.254 Y57.778 E5.07200 F2400
+G1 X68.114 Y58.037 E5.07600 F2400
+G1 X68.045 Y58.167 E5.08000 F2400
+G1 X67.998 Y58.257 E5.08400 F2400
+G1 X67.866 Y58.513 E5.08800 F2400
+G1 X67.793 Y58.656 E5.09200 F2400
+G1 X67.723 Y58.793 E5.09600 F2400
+G1 X67.640 Y58.954 E5.10000 F2400
+G1 X67.541 Y59.147 E5.10400 F2400
+G1 X67.404 Y59.407 E5.10800 F2400
+G1 X67.290 Y59.617 E5.11200 F2400
+G1 X67.210 Y59.758 E5.11600 F2400
+G1 X67.107 Y59.935 E5.12000 F2400
+G1 X67.010 Y60.095 E5.12400 F2400
+G1 X66.903 Y60.262 E5.12800 F2400
+G1 X66.802 Y60.413 E5.13200 F2400
+G1 X66.727 Y60.522 E5.13600 F2400
+G1 X66.623 Y60.665 E5.14000 F2400
+G1 X66.516 Y60.805 E5.14400 F2400
+G1 X66.429 Y60.913 E5.14800 F2400
+G1 X66.261 Y61.113 E5.15200 F2400
+G1 X66.147 Y61.240 E5.15600 F2400
+G1 X66.058 Y61.334 E5.16000 F2400
+G1 X65.909 Y61.486 E5.16400 F2400
+G1 X65.716 Y61.671 E5.16800 F2400
+G1 X65.526 Y61.841 E5.17200 F2400
+G1 X65.356 Y61.986 E5.17600 F2400
+G1 X65.165 Y62.141 E5.18000 F2400
+G1 X65.034 Y62.243 E5.18400 F2400
+G1 X64.933 Y62.321 E5.18800 F2400
+G1 X64.813 Y62.412 E5.19200 F2400
+G1 X64.678 Y62.512 E5.19600 F2400
+G1 X64.553 Y62.603 E5.20000 F2400
+G1 X64.399 Y62.715 E5.20400 F2400
+G1 X64.296 Y62.790 E5.20800 F2400
+G1 X64.196 Y62.863 E5.21200 F2400
+G1 X64.077 Y62.950 E5.21600 F2400
+G1 X63.968 Y63.030 E5.22000 F2400
+G1 X63.767 Y63.182 E5.22400 F2400
+G1 X63.609 Y63.304 E5.22800 F2400
+G1 X63.504 Y63.387 E5.23200 F2400
+G1 X63.367 Y63.499 E5.23600 F2400
+G1 X63.169 Y63.669 E5.24000 F2400
+G1 X63.017 Y63.807 E5.24400 F2400
+G1 X62.873 Y63.945 E5.24800 F2400
+G1 X62.753 Y64.065 E5.25200 F2400
+G1 X62.662 Y64.161 E5.25600 F2400
+G1 X62.517 Y64.320 E5.26000 F2400
+G1 X62.444 Y64.403 E5.26400 F2400
+G1 X62.284 Y64.594 E5.26800 F2400
+G1 X62.216 Y64.679 E5.27200 F2400
+G1 X62.067 Y64.873 E5.27600 F2400
+G1 X61.963 Y65.013 E5.28000 F2400
+G1 X61.825 Y65.205 E5.28400 F2400
+G1 X61.698 Y65.386 E5.28800 F2400
+G1 X61.626 Y65.492 E5.29200 F2400
+G1 X61.506 Y65.669 E5.29600 F2400
+G1 X61.439 Y65.767 E5.30000 F2400
+G1 X61.353 Y65.895 E5.30400 F2400
+G1 X61.250 Y66.047 E5.30800 F2400
+G1 X61.157 Y66.184 E5.31200 F2400
+G1 X61.017 Y66.385 E5.31600 F2400
+G1 X60.833 Y66.640 E5.32000 F2400
+G1 X60.724 Y66.786 E5.32400 F2400
+G1 X60.549 Y67.010 E5.32800 F2400
+G1 X60.452 Y67.129 E5.33200 F2400
+G1 X60.285 Y67.323 E5.33600 F2400
+G1 X60.165 Y67.456 E5.34000 F2400
+G1 X60.013 Y67.613 E5.34400 F2400
+G1 X59.925 Y67.700 E5.34800 F2400
+G1 X59.722 Y67.889 E5.35200 F2400
+G1 X59.610 Y67.986 E5.35600 F2400
+G1 X59.454 Y68.113 E5.36000 F2400
+G1 X59.324 Y68.212 E5.36400 F2400
+G1 X59.102 Y68.369 E5.36800 F2400
+G1 X58.912 Y68.491 E5.37200 F2400
+G1 X58.714 Y68.607 E5.37600 F2400
+G1 X58.486 Y68.729 E5.38000 F2400
+G1 X58.347 Y68.798 E5.38400 F2400
+G1 X58.243 Y68.847 E5.38800 F2400
+G1 X57.993 Y68.957 E5.39200 F2400
+G1 X57.837 Y69.019 E5.39600 F2400
+G1 X57.584 Y69.114 E5.40000 F2400
+G1 X57.301 Y69.210 E5.40400 F2400
+G1 X57.079 Y69.280 E5.40800 F2400
+G1 X56.960 Y69.316 E5.41200 F2400
+G1 X56.693 Y69.394 E5.41600 F2400
+G1 X56.469 Y69.457 E5.42000 F2400
+G1 X56.321 Y69.497 E5.42400 F2400
+G1 X56.181 Y69.535 E5.42800 F2400
+G1 X55.981 Y69.589 E5.43200 F2400
+G1 X55.858 Y69.622 E5.43600 F2400
+G1 X55.581 Y69.697 E5.44000 F2400
+G1 X55.342 Y69.763 E5.44400 F2400
+G1 X55.082 Y69.836 E5.44800 F2400
+G1 X54.908 Y69.886 E5.45200 F2400
+G1 X54.628 Y69.968 E5.45600 F2400
+G1 X54.503 Y70.005 E5.46000 F2400
+G1 X54.263 Y70.078 E5.46400 F2400
+G1 X54.115 Y70.123 E5.46800 F2400
+G1 X54.015 Y70.154 E5.47200 F2400
+G1 X53.893 Y70.191 E5.47600 F2400
+G1 X53.754 Y70.234 E5.48000 F2400
+G1 X53.503 Y70.310 E5.48400 F2400
+G1 X53.328 Y70.362 E5.48800 F2400
+G1 X53.132 Y70.419 E5.49200 F2400
+G1 X52.909 Y70.482 E5.49600 F2400
+G1 X52.754 Y70.523 E5.50000 F2400
+G1 X52.523 Y70.581 E5.50400 F2400
+G1 X52.285 Y70.636 E5.50800 F2400
+G1 X51.994 Y70.693 E5.51200 F2400
+G1 X51.788 Y70.728 E5.51600 F2400
+G1 X51.508 Y70.765 E5.52000 F2400
+G1 X51.203 Y70.791 E5.52400 F2400
+G1 X50.939 Y70.801 E5.52800 F2400
+G1 X50.747 Y70.800 E5.53200 F2400
+G1 X50.586 Y70.794 E5.53600 F2400
+G1 X50.462 Y70.787 E5.54000 F2400
+G1 X50.185 Y70.759 E5.54400 F2400
+G1 X50.054 Y70.741 E5.54800 F2400
+G1 X49.835 Y70.703 E5.55200 F2400
+G1 X49.638 Y70.661 E5.55600 F2400
+G1 X49.526 Y70.634 E5.56000 F2400
+G1 X49.380 Y70.594 E5.56400 F2400
+G1 X49.110 Y70.512 E5.56800 F2400
+G1 X48.901 Y70.438 E5.57200 F2400
+G1 X48.616 Y70.326 E5.57600 F2400
+G1 X48.338 Y70.205 E5.58000 F2400
+G1 X48.222 Y70.150 E5.58400 F2400
+G1 X47.994 Y70.038 E5.58800 F2400
+G1 X47.890 Y69.985 E5.59200 F2400
+G1 X47.714 Y69.893 E5.59600 F2400
+G1 X47.536 Y69.797 E5.60000 F2400
+G1 X47.263 Y69.645 E5.60400 F2400
+G1 X47.061 Y69.531 E5.60800 F2400
+G1 X46.934 Y69.459 E5.61200 F2400
+G1 X46.750 Y69.355 E5.61600 F2400
+G1 X46.565 Y69.251 E5.62000 F2400
+G1 X46.439 Y69.182 E5.62400 F2400
+G1 X46.284 Y69.098 E5.62800 F2400
+G1 X46.038 Y68.968 E5.63200 F2400
+G1 X45.773 Y68.836 E5.63600 F2400
+G1 X45.545 Y68.730 E5.64000 F2400
+G1 X45.444 Y68.685 E5.64400 F2400
+G1 X45.192 Y68.579 E5.64800 F2400
+G1 X45.020 Y68.512 E5.65200 F2400
+G1 X44.779 Y68.425 E5.65600 F2400
+G1 X44.656 Y68.383 E5.66000 F2400
+G1 X44.538 Y68.345 E5.66400 F2400
+G1 X44.280 Y68.268 E5.66800 F2400
+G1 X44.135 Y68.227 E5.67200 F2400
+G1 X44.034 Y68.200 E5.67600 F2400
+G1 X43.848 Y68.152 E5.68000 F2400
+G1 X43.569 Y68.084 E5.68400 F2400
+G1 X43.318 Y68.025 E5.68800 F2400
+G1 X43.148 Y67.986 E5.69200 F2400
+G1 X42.865 Y67.920 E5.69600 F2400
+G1 X42.619 Y67.860 E5.70000 F2400
+G1 X42.365 Y67.795 E5.70400 F2400
+G1 X42.149 Y67.736 E5.70800 F2400
+G1 X41.981 Y67.687 E5.71200 F2400
+G1 X41.718 Y67.603 E5.71600 F2400
+G1 X41.538 Y67.542 E5.72000 F2400
+G1 X41.275 Y67.443 E5.72400 F2400
+G1 X41.085 Y67.364 E5.72800 F2400
+G1 X40.833 Y67.251 E5.73200 F2400
+G1 X40.662 Y67.167 E5.73600 F2400
+G1 X40.501 Y67.084 E5.74000 F2400
+G1 X40.314 Y66.981 E5.74400 F2400
+G1 X40.176 Y66.901 E5.74800 F2400
+G1 X40.068 Y66.835 E5.75200 F2400
+G1 X39.887 Y66.722 E5.75600 F2400
+G1 X39.667 Y66.575 E5.76000 F2400
+G1 X39.542 Y66.489 E5.76400 F2400
+G1 X39.325 Y66.334 E5.76800 F2400
+G1 X39.123 Y66.185 E5.77200 F2400
+G1 X38.923 Y66.036 E5.77600 F2400
+G1 X38.781 Y65.928 E5.78000 F2400
+G1 X38.548 Y65.752 E5.78400 F2400
+G1 X38.347 Y65.601 E5.78800 F2400
+G1 X38.178 Y65.477 E5.79200 F2400
+G1 X38.081 Y65.407 E5.79600 F2400
+G1 X37.911 Y65.286 E5.80000 F2400
+G1 X37.828 Y65.229 E5.80400 F2400
+G1 X37.600 Y65.075 E5.80800 F2400
+G1 X37.462 Y64.985 E5.81200 F2400
+G1 X37.318 Y64.894 E5.81600 F2400
+G1 X37.139 Y64.785 E5.82000 F2400
+G1 X36.943 Y64.671 E5.82400 F2400
+G1 X36.753 Y64.563 E5.82800 F2400
+G1 X36.578 Y64.468 E5.83200 F2400
+G1 X36.372 Y64.359 E5.83600 F2400
+G1 X36.124 Y64.232 E5.84000 F2400
+G1 X35.947 Y64.143 E5.84400 F2400
+G1 X35.759 Y64.049 E5.84800 F2400
+G1 X35.509 Y63.925 E5.85200 F2400
+G1 X35.413 Y63.876 E5.85600 F2400
+G1 X35.287 Y63.813 E5.86000 F2400
+G1 X35.128 Y63.732 E5.86400 F2400
+G1 X34.991 Y63.662 E5.86800 F2400
+G1 X34.725 Y63.519 E5.87200 F2400
+G1 X34.601 Y63.451 E5.87600 F2400
+G1 X34.487 Y63.386 E5.88000 F2400
+G1 X34.334 Y63.297 E5.88400 F2400
+G1 X34.147 Y63.182 E5.88800 F2400
+G1 X33.908 Y63.025 E5.89200 F2400
+G1 X33.645 Y62.838 E5.89600 F2400
+G1 X33.418 Y62.658 E5.90000 F2400
+G1 X33.238 Y62.503 E5.90400 F2400
+G1 X33.154 Y62.425 E5.90800 F2400
+G1 X33.068 Y62.342 E5.91200 F2400
+G1 X32.901 Y62.171 E5.91600 F2400
+G1 X32.717 Y61.961 E5.92000 F2400
+G1 X32.616 Y61.835 E5.92400 F2400
+G1 X32.434 Y61.585 E5.92800 F2400
+G1 X32.314 Y61.399 E5.93200 F2400
+G1 X32.200 Y61.204 E5.93600 F2400
+G1 X32.089 Y60.996 E5.94000 F2400
+G1 X32.036 Y60.887 E5.94400 F2400
+G1 X31.976 Y60.759 E5.94800 F2400
+G1 X31.859 Y60.478 E5.95200 F2400
+G1 X31.801 Y60.326 E5.95600 F2400
+G1 X31.760 Y60.209 E5.96000 F2400
+G1 X31.707 Y60.052 E5.96400 F2400
+G1 X31.631 Y59.802 E5.96800 F2400
+G1 X31.587 Y59.646 E5.97200 F2400
+G1 X31.548 Y59.500 E5.97600 F2400
+G1 X31.507 Y59.340 E5.98000 F2400
+G1 X31.458 Y59.138 E5.98400 F2400
+G1 X31.400 Y58.882 E5.98800 F2400
+G1 X31.364 Y58.716 E5.99200 F2400
+G1 X31.304 Y58.434 E5.99600 F2400
+G1 X31.241 Y58.131 E6.00000 F2400
+G1 X31.185 Y57.862 E6.00400 F2400
+G1 X31.160 Y57.745 E6.00800 F2400
+G1 X31.124 Y57.580 E6.01200 F2400
+G1 X31.061 Y57.294 E6.01600 F2400
+G1 X30.998 Y57.023 E6.02000 F2400
+G1 X30.967 Y56.898 E6.02400 F2400
+G1 X30.921 Y56.712 E6.02800 F2400
+G1 X30.878 Y56.542 E6.03200 F2400
+G1 X30.814 Y56.297 E6.03600 F2400
+G1 X30.787 Y56.194 E6.04000 F2400
+G1 X30.744 Y56.035 E6.04400 F2400
+G1 X30.677 Y55.792 E6.04800 F2400
+G1 X30.603 Y55.522 E6.05200 F2400
+G1 X30.575 Y55.417 E6.05600 F2400
+G1 X30.518 Y55.205 E6.06000 F2400
+G1 X30.459 Y54.978 E6.06400 F2400
+G1 X30.392 Y54.709 E6.06800 F2400
+G1 X30.350 Y54.527 E6.07200 F2400
+G1 X30.289 Y54.237 E6.07600 F2400
+G1 X30.264 Y54.098 E6.08000 F2400
+G1 X30.242 Y53.976 E6.08400 F2400
+G1 X30.223 Y53.851 E6.08800 F2400
+G1 X30.193 Y53.633 E6.09200 F2400
+G1 X30.179 Y53.509 E6.09600 F2400
+G1 X30.165 Y53.355 E6.10000 F2400
+G1 X30.154 Y53.214 E6.10400 F2400
+G1 X30.148 Y53.102 E6.10800 F2400
+G1 X30.142 Y52.806 E6.11200 F2400
+G1 X30.144 Y52.637 E6.11600 F2400
+G1 X30.159 Y52.340 E6.12000 F2400
+G1 X30.182 Y52.092 E6.12400 F2400
+G1 X30.199 Y51.946 E6.12800 F2400
+G1 X30.243 Y51.657 E6.13200 F2400
+G1 X30.262 Y51.554 E6.13600 F2400
+G1 X30.323 Y51.256 E6.14000 F2400
+G1 X30.347 Y51.149 E6.14400 F2400
+G1 X30.384 Y50.999 E6.14800 F2400
+G1 X30.439 Y50.790 E6.15200 F2400
+G1 X30.466 Y50.689 E6.15600 F2400
+G1 X30.538 Y50.440 E6.16000 F2400
+G1 X30.572 Y50.326 E6.16400 F2400
+G1 X30.651 Y50.070 E6.16800 F2400
+G1 X30.684 Y49.966 E6.17200 F2400
+G1 X30.746 Y49.769 E6.17600 F2400
+G1 X30.789 Y49.633 E6.18000 F2400
+G1 X30.835 Y49.482 E6.18400 F2400
+G1 X30.893 Y49.294 E6.18800 F2400
+G1 X30.941 Y49.130 E6.19200 F2400
+G1 X30.988 Y48.962 E6.19600 F2400
+G1 X31.046 Y48.746 E6.20000 F2400
+G1 X31.078 Y48.616 E6.20400 F2400
+G1 X31.107 Y48.488 E6.20800 F2400
+G1 X31.153 Y48.267 E6.21200 F2400
+G1 X31.180 Y48.118 E6.21600 F2400
+G1 X31.221 Y47.850 E6.22000 F2400
+G1 X31.242 Y47.676 E6.22400 F2400
+G1 X31.260 Y47.493 E6.22800 F2400
+G1 X31.267 Y47.394 E6.23200 F2400
+G1 X31.273 Y47.295 E6.23600 F2400
+G1 X31.278 Y47.180 E6.24000 F2400
+G1 X31.283 Y46.965 E6.24400 F2400
+G1 X31.283 Y46.741 E6.24800 F2400
+G1 X31.276 Y46.459 E6.25200 F2400
+G1 X31.267 Y46.276 E6.25600 F2400
+G1 X31.253 Y46.038 E6.26000 F2400
+G1 X31.242 Y45.870 E6.26400 F2400
+G1 X31.234 Y45.755 E6.26800 F2400
+G1 X31.220 Y45.570 E6.27200 F2400
+G1 X31.202 Y45.326 E6.27600 F2400
+G1 X31.184 Y45.060 E6.28000 F2400
+G1 X31.168 Y44.763 E6.28400 F2400
+G1 X31.157 Y44.488 E6.28800 F2400
+G1 X31.154 Y44.269 E6.29200 F2400
+G1 X31.155 Y44.052 E6.29600 F2400
+G1 X31.160 Y43.846 E6.30000 F2400
+G1 X31.171 Y43.645 E6.30400 F2400
+G1 X31.191 Y43.403 E6.30800 F2400
+G1 X31.216 Y43.184 E6.31200 F2400
+G1 X31.258 Y42.910 E6.31600 F2400
+G1 X31.294 Y42.720 E6.32000 F2400
+G1 X31.337 Y42.527 E6.32400 F2400
+G1 X31.405 Y42.266 E6.32800 F2400
+G1 X31.475 Y42.038 E6.33200 F2400
+G1 X31.541 Y41.841 E6.33600 F2400
+G1 X31.617 Y41.640 E6.34000 F2400
+G1 X31.717 Y41.396 E6.34400 F2400
+G1 X31.808 Y41.191 E6.34800 F2400
+G1 X31.873 Y41.052 E6.35200 F2400
+G1 X31.945 Y40.905 E6.35600 F2400
+G1 X32.046 Y40.706 E6.36000 F2400
+G1 X32.097 Y40.608 E6.36400 F2400
+G1 X32.188 Y40.437 E6.36800 F2400
+G1 X32.324 Y40.191 E6.37200 F2400
+G1 X32.396 Y40.061 E6.37600 F2400
+G1 X32.490 Y39.895 E6.38000 F2400
+G1 X32.609 Y39.684 E6.38400 F2400
+G1 X32.751 Y39.433 E6.38800 F2400
+G1 X32.869 Y39.222 E6.39200 F2400
+G1 X32.980 Y39.022 E6.39600 F2400
+G1 X33.066 Y38.864 E6.40000 F2400
+G1 X33.156 Y38.696 E6.40400 F2400
+G1 X33.265 Y38.489 E6.40800 F2400
+G1 X33.345 Y38.333 E6.41200 F2400
+G1 X33.465 Y38.098 E6.41600 F2400
+G1 X33.512 Y38.004 E6.42000 F2400
+G1 X33.628 Y37.772 E6.42400 F2400
+G1 X33.742 Y37.540 E6.42800 F2400
+G1 X33.817 Y37.388 E6.43200 F2400
+G1 X33.865 Y37.292 E6.43600 F2400
+G1 X33.943 Y37.134 E6.44000 F2400
+G1 X34.046 Y36.929 E6.44400 F2400
+G1 X34.171 Y36.687 E6.44800 F2400
+G1 X34.308 Y36.431 E6.45200 F2400
+G1 X34.382 Y36.300 E6.45600 F2400
+G1 X34.443 Y36.192 E6.46000 F2400
+G1 X34.510 Y36.079 E6.46400 F2400
+G1 X34.676 Y35.811 E6.46800 F2400
+G1 X34.811 Y35.609 E6.47200 F2400
+G1 X34.888 Y35.500 E6.47600 F2400
+G1 X35.039 Y35.299 E6.48000 F2400
+G1 X35.235 Y35.062 E6.48400 F2400
+G1 X35.391 Y34.889 E6.48800 F2400
+G1 X35.499 Y34.779 E6.49200 F2400
+G1 X35.723 Y34.569 E6.49600 F2400
+G1 X35.917 Y34.407 E6.50000 F2400
+G1 X36.031 Y34.319 E6.50400 F2400
+G1 X36.249 Y34.164 E6.50800 F2400
+G1 X36.428 Y34.050 E6.51200 F2400
+G1 X36.626 Y33.935 E6.51600 F2400
+G1 X36.788 Y33.849 E6.52000 F2400
+G1 X36.941 Y33.774 E6.52400 F2400
+G1 X37.121 Y33.692 E6.52800 F2400
+G1 X37.325 Y33.607 E6.53200 F2400
+G1 X37.519 Y33.534 E6.53600 F2400
+G1 X37.799 Y33.438 E6.54000 F2400
+G1 X37.918 Y33.401 E6.54400 F2400
+G1 X38.063 Y33.357 E6.54800 F2400
+G1 X38.364 Y33.274 E6.55200 F2400
+G1 X38.597 Y33.215 E6.55600 F2400
+G1 X38.832 Y33.159 E6.56000 F2400
+G1 X39.069 Y33.105 E6.56400 F2400
+G1 X39.224 Y33.070 E6.56800 F2400
+G1 X39.410 Y33.029 E6.57200 F2400
+G1 X39.557 Y32.997 E6.57600 F2400
+G1 X39.691 Y32.967 E6.58000 F2400
+G1 X39.995 Y32.899 E6.58400 F2400
+G1 X40.244 Y32.840 E6.58800 F2400
+G1 X40.517 Y32.771 E6.59200 F2400
+G1 X40.616 Y32.745 E6.59600 F2400
+G1 X40.849 Y32.681 E6.60000 F2400
+G1 X41.004 Y32.635 E6.60400 F2400
+G1 X41.193 Y32.577 E6.60800 F2400
+G1 X41.412 Y32.504 E6.61200 F2400
+G1 X41.511 Y32.470 E6.61600 F2400
+G1 X41.671 Y32.412 E6.62000 F2400
+G1 X41.864 Y32.340 E6.62400 F2400
+G1 X42.112 Y32.241 E6.62800 F2400
+G1 X42.294 Y32.166 E6.63200 F2400
+G1 X42.441 Y32.104 E6.63600 F2400
+G1 X42.637 Y32.019 E6.64000 F2400
+G1 X42.830 Y31.934 E6.64400 F2400
+G1 X42.971 Y31.872 E6.64800 F2400
+G1 X43.158 Y31.790 E6.65200 F2400
+G1 X43.297 Y31.729 E6.65600 F2400
+G1 X43.388 Y31.690 E6.66000 F2400
+G1 X43.534 Y31.628 E6.66400 F2400
+G1 X43.640 Y31.584 E6.66800 F2400
+G1 X43.819 Y31.511 E6.67200 F2400
+G1 X44.001 Y31.441 E6.67600 F2400
+G1 X44.253 Y31.349 E6.68000 F2400
+G1 X44.484 Y31.271 E6.68400 F2400
+G1 X44.717 Y31.200 E6.68800 F2400
+G1 X44.998 Y31.125 E6.69200 F2400
+G1 X45.143 Y31.090 E6.69600 F2400
+G1 X45.310 Y31.054 E6.70000 F2400
+G1 X45.450 Y31.026 E6.70400 F2400
+G1 X45.566 Y31.006 E6.70800 F2400
+G1 X45.762 Y30.975 E6.71200 F2400
+G1 X45.958 Y30.950 E6.71600 F2400
+G1 X46.080 Y30.936 E6.72000 F2400
+G1 X46.358 Y30.912 E6.72400 F2400
+G1 X46.646 Y30.895 E6.72800 F2400
+G1 X46.757 Y30.890 E6.73200 F2400
+G1 X46.856 Y30.887 E6.73600 F2400
+G1 X46.965 Y30.884 E6.74000 F2400
+G1 X47.206 Y30.880 E6.74400 F2400
+G1 X47.469 Y30.879 E6.74800 F2400
+G1 X47.579 Y30.879 E6.75200 F2400
+G1 X47.678 Y30.879 E6.75600 F2400
+G1 X47.879 Y30.879 E6.76000 F2400
+G1 X48.040 Y30.878 E6.76400 F2400
+G1 X48.140 Y30.878 E6.76800 F2400
+G1 X48.238 Y30.877 E6.77200 F2400
+G1 X48.375 Y30.875 E6.77600 F2400
+G1 X48.510 Y30.872 E6.78000 F2400
+G1 X48.663 Y30.868 E6.78400 F2400
+G1 X48.864 Y30.859 E6.78800 F2400
+G1 X49.008 Y30.850 E6.79200 F2400
+G1 X49.148 Y30.840 E6.79600 F2400
+G1 X49.284 Y30.828 E6.80000 F2400
+G1 X49.550 Y30.799 E6.80400 F2400
+G1 X49.691 Y30.781 E6.80800 F2400
+G1 X49.894 Y30.750 E6.81200 F2400
+G1 X50.077 Y30.718 E6.81600 F2400
+G1 X50.238 Y30.688 E6.82000 F2400
+G1 X50.414 Y30.651 E6.82400 F2400
+G1 X50.514 Y30.628 E6.82800 F2400
+G1 X50.648 Y30.597 E6.83200 F2400
+G1 X50.872 Y30.542 E6.83600 F2400
+G1 X51.122 Y30.476 E6.84000 F2400
+G1 X51.265 Y30.437 E6.84400 F2400
+G1 X51.401 Y30.400 E6.84800 F2400
+G1 X51.685 Y30.320 E6.85200 F2400
+G1 X51.807 Y30.285 E6.85600 F2400
+G1 X52.072 Y30.211 E6.86000 F2400
+G1 X52.358 Y30.134 E6.86400 F2400
+G1 X52.492 Y30.099 E6.86800 F2400
+G1 X52.772 Y30.031 E6.87200 F2400
+G1 X52.909 Y29.999 E6.87600 F2400
+G1 X53.024 Y29.974 E6.88000 F2400
+G1 X53.190 Y29.941 E6.88400 F2400
+G1 X53.369 Y29.908 E6.88800 F2400
+G1 X53.601 Y29.872 E6.89200 F2400
+G1 X53.802 Y29.846 E6.89600 F2400
+G1 X54.078 Y29.821 E6.90000 F2400
+G1 X54.326 Y29.809 E6.90400 F2400
+G1 X54.457 Y29.807 E6.90800 F2400
+G1 X54.606 Y29.808 E6.91200 F2400
+G1 X54.869 Y29.819 E6.91600 F2400
+G1 X54.998 Y29.830 E6.92000 F2400
+G1 X55.300 Y29.867 E6.92400 F2400
+G1 X55.570 Y29.915 E6.92800 F2400
+G1 X55.717 Y29.948 E6.93200 F2400
+G1 X55.876 Y29.988 E6.93600 F2400
+G1 X56.027 Y30.030 E6.94000 F2400
+G1 X56.211 Y30.088 E6.94400 F2400
+G1 X56.358 Y30.140 E6.94800 F2400
+G1 X56.462 Y30.178 E6.95200 F2400
+G1 X56.608 Y30.236 E6.95600 F2400
+G1 X56.742 Y30.292 E6.96000 F2400
+G1 X56.904 Y30.365 E6.96400 F2400
+G1 X57.084 Y30.451 E6.96800 F2400
+G1 X57.341 Y30.581 E6.97200 F2400
+G1 X57.554 Y30.697 E6.97600 F2400
+G1 X57.757 Y30.811 E6.98000 F2400
+G1 X58.003 Y30.955 E6.98400 F2400
+G1 X58.161 Y31.050 E6.98800 F2400
+G1 X58.326 Y31.150 E6.99200 F2400
+G1 X58.458 Y31.231 E6.99600 F2400
+G1 X58.692 Y31.376 E7.00000 F2400
+G1 X58.935 Y31.525 E7.00400 F2400
+G1 X59.183 Y31.676 E7.00800 F2400
+G1 X59.377 Y31.794 E7.01200 F2400
+G1 X59.485 Y31.858 E7.01600 F2400
+G1 X59.586 Y31.918 E7.02000 F2400
+G1 X59.815 Y32.053 E7.02400 F2400
+G1 X60.060 Y32.194 E7.02800 F2400
+G1 X60.244 Y32.299 E7.03200 F2400
+G1 X60.496 Y32.443 E7.03600 F2400
+G1 X60.751 Y32.587 E7.04000 F2400
+G1 X60.974 Y32.715 E7.04400 F2400
+G1 X61.129 Y32.804 E7.04800 F2400
+G1 X61.298 Y32.904 E7.05200 F2400
+G1 X61.447 Y32.994 E7.05600 F2400
+G1 X61.604 Y33.091 E7.06000 F2400
+G1 X61.772 Y33.198 E7.06400 F2400
+G1 X61.861 Y33.256 E7.06800 F2400
+G1 X61.968 Y33.328 E7.07200 F2400
+G1 X62.080 Y33.406 E7.07600 F2400
+G1 X62.258 Y33.535 E7.08000 F2400
+G1 X62.480 Y33.707 E7.08400 F2400
+G1 X62.671 Y33.866 E7.08800 F2400
+G1 X62.771 Y33.955 E7.09200 F2400
+G1 X62.915 Y34.089 E7.09600 F2400
+G1 X63.079 Y34.253 E7.10000 F2400
+G1 X63.169 Y34.349 E7.10400 F2400
+G1 X63.249 Y34.438 E7.10800 F2400
+G1 X63.397 Y34.613 E7.11200 F2400
+G1 X63.492 Y34.732 E7.11600 F2400
+G1 X63.634 Y34.924 E7.12000 F2400
+G1 X63.713 Y35.039 E7.12400 F2400
+G1 X63.867 Y35.277 E7.12800 F2400
+G1 X63.954 Y35.423 E7.13200 F2400
+G1 X64.049 Y35.594 E7.13600 F2400
+G1 X64.152 Y35.790 E7.14000 F2400
+G1 X64.280 Y36.053 E7.14400 F2400
+G1 X64.403 Y36.326 E7.14800 F2400
+G1 X64.513 Y36.589 E7.15200 F2400
+G1 X64.605 Y36.820 E7.15600 F2400
+G1 X64.648 Y36.932 E7.16000 F2400
+G1 X64.700 Y37.066 E7.16400 F2400
+G1 X64.776 Y37.268 E7.16800 F2400
+G1 X64.884 Y37.556 E7.17200 F2400
+G1 X64.973 Y37.790 E7.17600 F2400
+G1 X65.023 Y37.921 E7.18000 F2400
+G1 X65.086 Y38.081 E7.18400 F2400
+G1 X65.197 Y38.350 E7.18800 F2400
+G1 X65.276 Y38.532 E7.19200 F2400
+G1 X65.389 Y38.774 E7.19600 F2400
+G1 X65.506 Y39.008 E7.20000 F2400
+G1 X65.623 Y39.224 E7.20400 F2400
+G1 X65.731 Y39.409 E7.20800 F2400
+G1 X65.848 Y39.596 E7.21200 F2400
+G1 X65.936 Y39.730 E7.21600 F2400
+G1 X66.003 Y39.827 E7.22000 F2400
+G1 X66.164 Y40.050 E7.22400 F2400
+G1 X66.225 Y40.131 E7.22800 F2400
+G1 X66.315 Y40.247 E7.23200 F2400
+G1 X66.449 Y40.415 E7.23600 F2400
+G1 X66.631 Y40.633 E7.24000 F2400
+G1 X66.720 Y40.738 E7.24400 F2400
+G1 X66.815 Y40.849 E7.24800 F2400
+G1 X66.988 Y41.049 E7.25200 F2400
+G1 X67.095 Y41.173 E7.25600 F2400
+G1 X67.212 Y41.308 E7.26000 F2400
+G1 X67.323 Y41.438 E7.26400 F2400
+G1 X67.394 Y41.522 E7.26800 F2400
+G1 X67.576 Y41.744 E7.27200 F2400
+G1 X67.725 Y41.932 E7.27600 F2400
+G1 X67.787 Y42.013 E7.28000 F2400
+G1 X67.858 Y42.108 E7.28400 F2400
+G1 X67.933 Y42.211 E7.28800 F2400
+G1 X68.033 Y42.353 E7.29200 F2400
+G1 X68.187 Y42.585 E7.29600 F2400
+G1 X68.255 Y42.693 E7.30000 F2400
+G1 X68.330 Y42.817 E7.30400 F2400
+G1 X68.410 Y42.958 E7.30800 F2400
+G1 X68.506 Y43.135 E7.31200 F2400
+G1 X68.630 Y43.384 E7.31600 F2400
+G1 X68.715 Y43.572 E7.32000 F2400
+G1 X68.822 Y43.830 E7.32400 F2400
+G1 X68.895 Y44.023 E7.32800 F2400
+G1 X68.956 Y44.197 E7.33200 F2400
+G1 X69.040 Y44.456 E7.33600 F2400
+G1 X69.101 Y44.661 E7.34000 F2400
+G1 X69.153 Y44.848 E7.34400 F2400
+G1 X69.205 Y45.042 E7.34800 F2400
+G1 X69.247 Y45.206 E7.35200 F2400
+G1 X69.291 Y45.386 E7.35600 F2400
+G1 X69.317 Y45.497 E7.36000 F2400
+G1 X69.350 Y45.633 E7.36400 F2400
+G1 X69.407 Y45.877 E7.36800 F2400
+G1 X69.436 Y45.999 E7.37200 F2400
+G1 X69.469 Y46.136 E7.37600 F2400
+G1 X69.499 Y46.264 E7.38000 F2400
+G1 X69.540 Y46.431 E7.38400 F2400
+G1 X69.567 Y46.537 E7.38800 F2400
+G1 X69.609 Y46.703 E7.39200 F2400
+G1 X69.666 Y46.918 E7.39600 F2400
+G1 X69.730 Y47.145 E7.40000 F2400
+G1 X69.808 Y47.410 E7.40400 F2400
+G1 X69.843 Y47.524 E7.40800 F2400
+G1 X69.913 Y47.746 E7.41200 F2400
+G1 X69.957 Y47.882 E7.41600 F2400
+G1 X70.012 Y48.046 E7.42000 F2400
+G1 X70.084 Y48.257 E7.42400 F2400
+G1 X70.175 Y48.521 E7.42800 F2400
+G1 X70.257 Y48.753 E7.43200 F2400
+G1 X70.362 Y49.050 E7.43600 F2400
+G1 X70.398 Y49.154 E7.44000 F2400
+G1 X70.455 Y49.319 E7.44400 F2400
+G1 X70.522 Y49.518 E7.44800 F2400
+G1 X70.558 Y49.627 E7.45200 F2400
+G1 X70.594 Y49.740 E7.45600 F2400
+G1 X70.649 Y49.919 E7.46000 F2400
+G0 X70.223 Y50.000 F6000
+G1 X70.262 Y50.132 E7.46400 F2400
+G1 X70.295 Y50.250 E7.46800 F2400
+G1 X70.340 Y50.421 E7.47200 F2400
+G1 X70.400 Y50.681 E7.47600 F2400
+G1 X70.445 Y50.907 E7.48000 F2400
+G1 X70.494 Y51.223 E7.48400 F2400
+G1 X70.519 Y51.458 E7.48800 F2400
+G1 X70.535 Y51.753 E7.49200 F2400
+G1 X70.536 Y51.980 E7.49600 F2400
+G1 X70.528 Y52.188 E7.50000 F2400
+G1 X70.512 Y52.380 E7.50400 F2400
+G1 X70.498 Y52.500 E7.50800 F2400
+G1 X70.481 Y52.618 E7.51200 F2400
+G1 X70.437 Y52.859 E7.51600 F2400
+G1 X70.369 Y53.139 E7.52000 F2400
+G1 X70.339 Y53.245 E7.52400 F2400
+G1 X70.296 Y53.383 E7.52800 F2400
+G1 X70.238 Y53.550 E7.53200 F2400
+G1 X70.176 Y53.712 E7.53600 F2400
+G1 X70.064 Y53.975 E7.54000 F2400
+G1 X69.995 Y54.122 E7.54400 F2400
+G1 X69.917 Y54.277 E7.54800 F2400
+G1 X69.818 Y54.466 E7.55200 F2400
+G1 X69.662 Y54.738 E7.55600 F2400
+G1 X69.574 Y54.886 E7.56000 F2400
+G1 X69.444 Y55.094 E7.56400 F2400
+G1 X69.380 Y55.193 E7.56800 F2400
+G1 X69.271 Y55.361 E7.57200 F2400
+G1 X69.101 Y55.616 E7.57600 F2400
+G1 X69.015 Y55.743 E7.58000 F2400
+G1 X68.913 Y55.893 E7.58400 F2400
+G1 X68.777 Y56.095 E7.58800 F2400
+G1 X68.653 Y56.280 E7.59200 F2400
+G1 X68.529 Y56.466 E7.59600 F2400
+G1 X68.405 Y56.658 E7.60000 F2400
+G1 X68.276 Y56.861 E7.60400 F2400
+G1 X68.188 Y57.003 E7.60800 F2400
+G1 X68.099 Y57.151 E7.61200 F2400
+G1 X68.008 Y57.306 E7.61600 F2400
+G1 X67.906 Y57.484 E7.62000 F2400
+G1 X67.802 Y57.670 E7.62400 F2400
+G1 X67.672 Y57.910 E7.62800 F2400
+G1 X67.590 Y58.068 E7.63200 F2400
+G1 X67.503 Y58.235 E7.63600 F2400
+G1 X67.383 Y58.469 E7.64000 F2400
+G1 X67.250 Y58.728 E7.64400 F2400
+G1 X67.183 Y58.859 E7.64800 F2400
+G1 X67.071 Y59.075 E7.65200 F2400
+G1 X67.001 Y59.206 E7.65600 F2400
+G1 X66.884 Y59.421 E7.66000 F2400
+G1 X66.831 Y59.514 E7.66400 F2400
+G1 X66.731 Y59.686 E7.66800 F2400
+G1 X66.622 Y59.867 E7.67200 F2400
+G1 X66.494 Y60.067 E7.67600 F2400
+G1 X66.335 Y60.298 E7.68000 F2400
+G1 X66.182 Y60.504 E7.68400 F2400
+G1 X66.051 Y60.668 E7.68800 F2400
+G1 X65.924 Y60.820 E7.69200 F2400
+G1 X65.856 Y60.896 E7.69600 F2400
+G1 X65.715 Y61.050 E7.70000 F2400
+G1 X65.567 Y61.200 E7.70400 F2400
+G1 X65.388 Y61.371 E7.70800 F2400
+G1 X65.290 Y61.461 E7.71200 F2400
+G1 X65.127 Y61.604 E7.71600 F2400
+G1 X65.043 Y61.674 E7.72000 F2400
+G1 X64.853 Y61.829 E7.72400 F2400
+G1 X64.645 Y61.990 E7.72800 F2400
+G1 X64.496 Y62.102 E7.73200 F2400
+G1 X64.306 Y62.242 E7.73600 F2400
+G1 X64.120 Y62.376 E7.74000 F2400
+G1 X63.991 Y62.468 E7.74400 F2400
+G1 X63.898 Y62.536 E7.74800 F2400
+G1 X63.699 Y62.680 E7.75200 F2400
+G1 X63.565 Y62.778 E7.75600 F2400
+G1 X63.462 Y62.855 E7.76000 F2400
+G1 X63.318 Y62.965 E7.76400 F2400
+G1 X63.118 Y63.124 E7.76800 F2400
+G1 X62.906 Y63.302 E7.77200 F2400
+G1 X62.755 Y63.436 E7.77600 F2400
+G1 X62.553 Y63.628 E7.78000 F2400
+G1 X62.463 Y63.719 E7.78400 F2400
+G1 X62.334 Y63.856 E7.78800 F2400
+G1 X62.268 Y63.928 E7.79200 F2400
+G1 X62.175 Y64.033 E7.79600 F2400
+G1 X62.005 Y64.237 E7.80000 F2400
+G1 X61.937 Y64.322 E7.80400 F2400
+G1 X61.799 Y64.502 E7.80800 F2400
+G1 X61.681 Y64.663 E7.81200 F2400
+G1 X61.509 Y64.907 E7.81600 F2400
+G1 X61.338 Y65.159 E7.82000 F2400
+G1 X61.267 Y65.265 E7.82400 F2400
+G1 X61.179 Y65.397 E7.82800 F2400
+G1 X61.007 Y65.656 E7.83200 F2400
+G1 X60.909 Y65.801 E7.83600 F2400
+G1 X60.829 Y65.920 E7.84000 F2400
+G1 X60.657 Y66.166 E7.84400 F2400
+G1 X60.518 Y66.358 E7.84800 F2400
+G1 X60.415 Y66.496 E7.85200 F2400
+G1 X60.277 Y66.672 E7.85600 F2400
+G1 X60.151 Y66.825 E7.86000 F2400
+G1 X60.018 Y66.978 E7.86400 F2400
+G1 X59.868 Y67.142 E7.86800 F2400
+G1 X59.770 Y67.244 E7.87200 F2400
+G1 X59.602 Y67.407 E7.87600 F2400
+G1 X59.374 Y67.609 E7.88000 F2400
+G1 X59.197 Y67.752 E7.88400 F2400
+G1 X58.982 Y67.911 E7.88800 F2400
+G1 X58.848 Y68.002 E7.89200 F2400
+G1 X58.734 Y68.075 E7.89600 F2400
+G1 X58.645 Y68.129 E7.90000 F2400
+G1 X58.379 Y68.279 E7.90400 F2400
+G1 X58.265 Y68.337 E7.90800 F2400
+G1 X58.102 Y68.417 E7.91200 F2400
+G1 X57.885 Y68.514 E7.91600 F2400
+G1 X57.650 Y68.609 E7.92000 F2400
+G1 X57.434 Y68.690 E7.92400 F2400
+G1 X57.251 Y68.753 E7.92800 F2400
+G1 X56.994 Y68.836 E7.93200 F2400
+G1 X56.808 Y68.893 E7.93600 F2400
+G1 X56.544 Y68.969 E7.94000 F2400
+G1 X56.435 Y69.000 E7.94400 F2400
+G1 X56.193 Y69.066 E7.94800 F2400
+G1 X56.074 Y69.098 E7.95200 F2400
+G1 X55.898 Y69.145 E7.95600 F2400
+G1 X55.712 Y69.196 E7.96000 F2400
+G1 X55.577 Y69.232 E7.96400 F2400
+G1 X55.389 Y69.283 E7.96800 F2400
+G1 X55.122 Y69.357 E7.97200 F2400
+G1 X55.016 Y69.387 E7.97600 F2400
+G1 X54.879 Y69.426 E7.98000 F2400
+G1 X54.589 Y69.511 E7.98400 F2400
+G1 X54.402 Y69.567 E7.98800 F2400
+G1 X54.227 Y69.620 E7.99200 F2400
+G1 X53.948 Y69.706 E7.99600 F2400
+G1 X53.696 Y69.784 E8.00000 F2400
+G1 X53.562 Y69.825 E8.00400 F2400
+G1 X53.344 Y69.892 E8.00800 F2400
+G1 X53.208 Y69.932 E8.01200 F2400
+G1 X52.953 Y70.006 E8.01600 F2400
+G1 X52.740 Y70.065 E8.02000 F2400
+G1 X52.478 Y70.132 E8.02400 F2400
+G1 X52.363 Y70.160 E8.02800 F2400
+G1 X52.071 Y70.223 E8.03200 F2400
+G1 X51.921 Y70.251 E8.03600 F2400
+G1 X51.643 Y70.295 E8.04000 F2400
+G1 X51.448 Y70.319 E8.04400 F2400
+G1 X51.160 Y70.342 E8.04800 F2400
+G1 X51.034 Y70.348 E8.05200 F2400
+G1 X50.919 Y70.351 E8.05600 F2400
+G1 X50.717 Y70.350 E8.06000 F2400
+G1 X50.419 Y70.334 E8.06400 F2400
+G1 X50.218 Y70.314 E8.06800 F2400
+G1 X50.008 Y70.284 E8.07200 F2400
+G1 X49.870 Y70.259 E8.07600 F2400
+G1 X49.655 Y70.213 E8.08000 F2400
+G1 X49.465 Y70.165 E8.08400 F2400
+G1 X49.182 Y70.079 E8.08800 F2400
+G1 X48.931 Y69.991 E8.09200 F2400
+G1 X48.735 Y69.914 E8.09600 F2400
+G1 X48.606 Y69.860 E8.10000 F2400
+G1 X48.479 Y69.804 E8.10400 F2400
+G1 X48.191 Y69.667 E8.10800 F2400
+G1 X47.977 Y69.558 E8.11200 F2400
+G1 X47.838 Y69.485 E8.11600 F2400
+G1 X47.590 Y69.349 E8.12000 F2400
+G1 X47.456 Y69.274 E8.12400 F2400
+G1 X47.278 Y69.173 E8.12800 F2400
+G1 X47.025 Y69.027 E8.13200 F2400
+G1 X46.915 Y68.963 E8.13600 F2400
+G1 X46.806 Y68.901 E8.14000 F2400
+G1 X46.705 Y68.843 E8.14400 F2400
+G1 X46.588 Y68.777 E8.14800 F2400
+G1 X46.431 Y68.689 E8.15200 F2400
+G1 X46.284 Y68.609 E8.15600 F2400
+G1 X46.144 Y68.535 E8.16000 F2400
+G1 X46.053 Y68.488 E8.16400 F2400
+G1 X45.877 Y68.400 E8.16800 F2400
+G1 X45.708 Y68.319 E8.17200 F2400
+G1 X45.487 Y68.220 E8.17600 F2400
+G1 X45.343 Y68.159 E8.18000 F2400
+G1 X45.149 Y68.082 E8.18400 F2400
+G1 X45.003 Y68.028 E8.18800 F2400
+G1 X44.776 Y67.949 E8.19200 F2400
+G1 X44.653 Y67.910 E8.19600 F2400
+G1 X44.472 Y67.855 E8.20000 F2400
+G1 X44.298 Y67.806 E8.20400 F2400
+G1 X44.120 Y67.759 E8.20800 F2400
+G1 X43.927 Y67.710 E8.21200 F2400
+G1 X43.733 Y67.663 E8.21600 F2400
+G1 X43.579 Y67.628 E8.22000 F2400
+G1 X43.329 Y67.570 E8.22400 F2400
+G1 X43.054 Y67.507 E8.22800 F2400
+G1 X42.853 Y67.459 E8.23200 F2400
+G1 X42.638 Y67.406 E8.23600 F2400
+G1 X42.406 Y67.345 E8.24000 F2400
+G1 X42.252 Y67.302 E8.24400 F2400
+G1 X42.047 Y67.240 E8.24800 F2400
+G1 X41.867 Y67.182 E8.25200 F2400
+G1 X41.685 Y67.119 E8.25600 F2400
+G1 X41.521 Y67.058 E8.26000 F2400
+G1 X41.333 Y66.982 E8.26400 F2400
+G1 X41.204 Y66.926 E8.26800 F2400
+G1 X41.072 Y66.867 E8.27200 F2400
+G1 X40.949 Y66.808 E8.27600 F2400
+G1 X40.758 Y66.711 E8.28000 F2400
+G1 X40.630 Y66.642 E8.28400 F2400
+G1 X40.413 Y66.518 E8.28800 F2400
+G1 X40.179 Y66.374 E8.29200 F2400
+G1 X39.973 Y66.239 E8.29600 F2400
+G1 X39.839 Y66.148 E8.30000 F2400
+G1 X39.609 Y65.985 E8.30400 F2400
+G1 X39.476 Y65.888 E8.30800 F2400
+G1 X39.341 Y65.788 E8.31200 F2400
+G1 X39.170 Y65.659 E8.31600 F2400
+G1 X38.990 Y65.522 E8.32000 F2400
+G1 X38.849 Y65.416 E8.32400 F2400
+G1 X38.649 Y65.265 E8.32800 F2400
+G1 X38.437 Y65.109 E8.33200 F2400
+G1 X38.312 Y65.019 E8.33600 F2400
+G1 X38.197 Y64.938 E8.34000 F2400
+G1 X38.052 Y64.838 E8.34400 F2400
+G1 X37.857 Y64.708 E8.34800 F2400
+G1 X37.663 Y64.584 E8.35200 F2400
+G1 X37.549 Y64.514 E8.35600 F2400
+G1 X37.397 Y64.424 E8.36000 F2400
+G1 X37.153 Y64.284 E8.36400 F2400
+G1 X36.893 Y64.143 E8.36800 F2400
+G1 X36.692 Y64.038 E8.37200 F2400
+G1 X36.456 Y63.918 E8.37600 F2400
+G1 X36.204 Y63.793 E8.38000 F2400
+G1 X36.066 Y63.726 E8.38400 F2400
+G1 X35.958 Y63.674 E8.38800 F2400
+G1 X35.745 Y63.569 E8.39200 F2400
+G1 X35.574 Y63.485 E8.39600 F2400
+G1 X35.340 Y63.367 E8.40000 F2400
+G1 X35.187 Y63.288 E8.40400 F2400
+G1 X35.008 Y63.192 E8.40800 F2400
+G1 X34.759 Y63.054 E8.41200 F2400
+G1 X34.648 Y62.988 E8.41600 F2400
+G1 X34.479 Y62.886 E8.42000 F2400
+G1 X34.359 Y62.810 E8.42400 F2400
+G1 X34.173 Y62.685 E8.42800 F2400
+G1 X33.958 Y62.528 E8.43200 F2400
+G1 X33.708 Y62.329 E8.43600 F2400
+G1 X33.508 Y62.151 E8.44000 F2400
+G1 X33.409 Y62.056 E8.44400 F2400
+G1 X33.271 Y61.913 E8.44800 F2400
+G1 X33.124 Y61.749 E8.45200 F2400
+G1 X32.973 Y61.562 E8.45600 F2400
+G1 X32.824 Y61.357 E8.46000 F2400
+G1 X32.656 Y61.096 E8.46400 F2400
+G1 X32.508 Y60.830 E8.46800 F2400
+G1 X32.441 Y60.697 E8.47200 F2400
+G1 X32.382 Y60.571 E8.47600 F2400
+G1 X32.261 Y60.284 E8.48000 F2400
+G1 X32.211 Y60.153 E8.48400 F2400
+G1 X32.109 Y59.858 E8.48800 F2400
+G1 X32.070 Y59.732 E8.49200 F2400
+G1 X32.005 Y59.510 E8.49600 F2400
+G1 X31.970 Y59.380 E8.50000 F2400
+G1 X31.936 Y59.249 E8.50400 F2400
+G1 X31.894 Y59.077 E8.50800 F2400
+G1 X31.833 Y58.809 E8.51200 F2400
+G1 X31.779 Y58.560 E8.51600 F2400
+G1 X31.744 Y58.391 E8.52000 F2400
+G1 X31.717 Y58.259 E8.52400 F2400
+G1 X31.681 Y58.082 E8.52800 F2400
+G1 X31.653 Y57.944 E8.53200 F2400
+G1 X31.622 Y57.794 E8.53600 F2400
+G1 X31.580 Y57.591 E8.54000 F2400
+G1 X31.537 Y57.391 E8.54400 F2400
+G1 X31.474 Y57.105 E8.54800 F2400
+G1 X31.448 Y56.987 E8.55200 F2400
+G1 X31.399 Y56.782 E8.55600 F2400
+G1 X31.348 Y56.571 E8.56000 F2400
+G1 X31.316 Y56.445 E8.56400 F2400
+G1 X31.273 Y56.276 E8.56800 F2400
+G1 X31.240 Y56.151 E8.57200 F2400
+G1 X31.167 Y55.879 E8.57600 F2400
+G1 X31.122 Y55.713 E8.58000 F2400
+G1 X31.092 Y55.603 E8.58400 F2400
+G1 X31.040 Y55.414 E8.58800 F2400
+G1 X30.986 Y55.213 E8.59200 F2400
+G1 X30.914 Y54.943 E8.59600 F2400
+G1 X30.854 Y54.704 E8.60000 F2400
+G1 X30.821 Y54.566 E8.60400 F2400
+G1 X30.759 Y54.289 E8.60800 F2400
+G1 X30.739 Y54.189 E8.61200 F2400
+G1 X30.694 Y53.952 E8.61600 F2400
+G1 X30.676 Y53.844 E8.62000 F2400
+G1 X30.639 Y53.580 E8.62400 F2400
+G1 X30.623 Y53.442 E8.62800 F2400
+G1 X30.601 Y53.181 E8.63200 F2400
+G1 X30.589 Y52.916 E8.63600 F2400
+G1 X30.588 Y52.658 E8.64000 F2400
+G1 X30.592 Y52.534 E8.64400 F2400
+G1 X30.601 Y52.351 E8.64800 F2400
+G1 X30.611 Y52.229 E8.65200 F2400
+G1 X30.637 Y51.981 E8.65600 F2400
+G1 X30.681 Y51.679 E8.66000 F2400
+G1 X30.719 Y51.473 E8.66400 F2400
+G1 X30.769 Y51.241 E8.66800 F2400
+G1 X30.825 Y51.008 E8.67200 F2400
+G1 X30.859 Y50.880 E8.67600 F2400
+G1 X30.906 Y50.707 E8.68000 F2400
+G1 X30.955 Y50.540 E8.68400 F2400
+G1 X31.030 Y50.295 E8.68800 F2400
+G1 X31.086 Y50.117 E8.69200 F2400
+G1 X31.139 Y49.950 E8.69600 F2400
+G1 X31.204 Y49.748 E8.70000 F2400
+G1 X31.248 Y49.613 E8.70400 F2400
+G1 X31.282 Y49.506 E8.70800 F2400
+G1 X31.325 Y49.366 E8.71200 F2400
+G1 X31.356 Y49.267 E8.71600 F2400
+G1 X31.421 Y49.047 E8.72000 F2400
+G1 X31.470 Y48.868 E8.72400 F2400
+G1 X31.524 Y48.659 E8.72800 F2400
+G1 X31.570 Y48.460 E8.73200 F2400
+G1 X31.592 Y48.356 E8.73600 F2400
+G1 X31.637 Y48.111 E8.74000 F2400
+G1 X31.673 Y47.865 E8.74400 F2400
+G1 X31.685 Y47.769 E8.74800 F2400
+G1 X31.702 Y47.595 E8.75200 F2400
+G1 X31.719 Y47.352 E8.75600 F2400
+G1 X31.725 Y47.178 E8.76000 F2400
+G1 X31.728 Y46.917 E8.76400 F2400
+G1 X31.723 Y46.686 E8.76800 F2400
+G1 X31.714 Y46.460 E8.77200 F2400
+G1 X31.697 Y46.183 E8.77600 F2400
+G1 X31.678 Y45.928 E8.78000 F2400
+G1 X31.661 Y45.710 E8.78400 F2400
+G1 X31.652 Y45.599 E8.78800 F2400
+G1 X31.637 Y45.406 E8.79200 F2400
+G1 X31.619 Y45.163 E8.79600 F2400
+G1 X31.605 Y44.953 E8.80000 F2400
+G1 X31.594 Y44.729 E8.80400 F2400
+G1 X31.588 Y44.554 E8.80800 F2400
+G1 X31.583 Y44.277 E8.81200 F2400
+G1 X31.585 Y44.123 E8.81600 F2400
+G1 X31.592 Y43.888 E8.82000 F2400
+G1 X31.603 Y43.695 E8.82400 F2400
+G1 X31.614 Y43.562 E8.82800 F2400
+G1 X31.625 Y43.456 E8.83200 F2400
+G1 X31.640 Y43.328 E8.83600 F2400
+G1 X31.663 Y43.168 E8.84000 F2400
+G1 X31.696 Y42.973 E8.84400 F2400
+G1 X31.717 Y42.867 E8.84800 F2400
+G1 X31.741 Y42.755 E8.85200 F2400
+G1 X31.804 Y42.499 E8.85600 F2400
+G1 X31.889 Y42.211 E8.86000 F2400
+G1 X31.950 Y42.032 E8.86400 F2400
+G1 X32.018 Y41.848 E8.86800 F2400
+G1 X32.101 Y41.641 E8.87200 F2400
+G1 X32.148 Y41.530 E8.87600 F2400
+G1 X32.235 Y41.339 E8.88000 F2400
+G1 X32.338 Y41.125 E8.88400 F2400
+G1 X32.470 Y40.865 E8.88800 F2400
+G1 X32.579 Y40.661 E8.89200 F2400
+G1 X32.680 Y40.475 E8.89600 F2400
+G1 X32.770 Y40.315 E8.90000 F2400
+G1 X32.910 Y40.066 E8.90400 F2400
+G1 X33.012 Y39.886 E8.90800 F2400
+G1 X33.109 Y39.713 E8.91200 F2400
+G1 X33.231 Y39.495 E8.91600 F2400
+G1 X33.323 Y39.329 E8.92000 F2400
+G1 X33.379 Y39.228 E8.92400 F2400
+G1 X33.484 Y39.032 E8.92800 F2400
+G1 X33.614 Y38.785 E8.93200 F2400
+G1 X33.696 Y38.627 E8.93600 F2400
+G1 X33.751 Y38.518 E8.94000 F2400
+G1 X33.807 Y38.406 E8.94400 F2400
+G1 X33.937 Y38.146 E8.94800 F2400
+G1 X33.993 Y38.032 E8.95200 F2400
+G1 X34.098 Y37.816 E8.95600 F2400
+G1 X34.152 Y37.705 E8.96000 F2400
+G1 X34.246 Y37.514 E8.96400 F2400
+G1 X34.378 Y37.247 E8.96800 F2400
+G1 X34.448 Y37.108 E8.97200 F2400
+G1 X34.526 Y36.956 E8.97600 F2400
+G1 X34.637 Y36.748 E8.98000 F2400
+G1 X34.747 Y36.548 E8.98400 F2400
+G1 X34.860 Y36.353 E8.98800 F2400
+G1 X34.959 Y36.191 E8.99200 F2400
+G1 X35.021 Y36.094 E8.99600 F2400
+G1 X35.150 Y35.901 E9.00000 F2400
+G1 X35.245 Y35.767 E9.00400 F2400
+G1 X35.388 Y35.578 E9.00800 F2400
+G1 X35.514 Y35.425 E9.01200 F2400
+G1 X35.621 Y35.303 E9.01600 F2400
+G1 X35.839 Y35.076 E9.02000 F2400
+G1 X35.964 Y34.957 E9.02400 F2400
+G1 X36.200 Y34.756 E9.02800 F2400
+G1 X36.364 Y34.630 E9.03200 F2400
+G1 X36.543 Y34.505 E9.03600 F2400
+G1 X36.680 Y34.417 E9.04000 F2400
+G1 X36.803 Y34.344 E9.04400 F2400
+G1 X37.028 Y34.220 E9.04800 F2400
+G1 X37.212 Y34.130 E9.05200 F2400
+G1 X37.425 Y34.034 E9.05600 F2400
+G1 X37.561 Y33.979 E9.06000 F2400
+G1 X37.766 Y33.901 E9.06400 F2400
+G1 X38.004 Y33.820 E9.06800 F2400
+G1 X38.266 Y33.740 E9.07200 F2400
+G1 X38.511 Y33.672 E9.07600 F2400
+G1 X38.703 Y33.623 E9.08000 F2400
+G1 X38.954 Y33.563 E9.08400 F2400
+G1 X39.185 Y33.510 E9.08800 F2400
+G1 X39.391 Y33.466 E9.09200 F2400
+G1 X39.627 Y33.415 E9.09600 F2400
+G1 X39.795 Y33.380 E9.10000 F2400
+G1 X39.911 Y33.355 E9.10400 F2400
+G1 X40.044 Y33.326 E9.10800 F2400
+G1 X40.344 Y33.260 E9.11200 F2400
+G1 X40.622 Y33.194 E9.11600 F2400
+G1 X40.883 Y33.127 E9.12000 F2400
+G1 X41.030 Y33.087 E9.12400 F2400
+G1 X41.287 Y33.012 E9.12800 F2400
+G1 X41.530 Y32.935 E9.13200 F2400
+G1 X41.723 Y32.869 E9.13600 F2400
+G1 X41.871 Y32.816 E9.14000 F2400
+G1 X41.982 Y32.775 E9.14400 F2400
+G1 X42.254 Y32.669 E9.14800 F2400
+G1 X42.523 Y32.558 E9.15200 F2400
+G1 X42.764 Y32.455 E9.15600 F2400
+G1 X42.932 Y32.381 E9.16000 F2400
+G1 X43.151 Y32.284 E9.16400 F2400
+G1 X43.402 Y32.174 E9.16800 F2400
+G1 X43.588 Y32.093 E9.17200 F2400
+G1 X43.700 Y32.046 E9.17600 F2400
+G1 X43.967 Y31.936 E9.18000 F2400
+G1 X44.156 Y31.863 E9.18400 F2400
+G1 X44.388 Y31.778 E9.18800 F2400
+G1 X44.596 Y31.708 E9.19200 F2400
+G1 X44.701 Y31.675 E9.19600 F2400
+G1 X44.881 Y31.621 E9.20000 F2400
+G1 X44.978 Y31.595 E9.20400 F2400
+G1 X45.122 Y31.557 E9.20800 F2400
+G1 X45.400 Y31.494 E9.21200 F2400
+G1 X45.629 Y31.451 E9.21600 F2400
+G1 X45.835 Y31.418 E9.22000 F2400
+G1 X45.953 Y31.402 E9.22400 F2400
+G1 X46.183 Y31.376 E9.22800 F2400
+G1 X46.399 Y31.357 E9.23200 F2400
+G1 X46.621 Y31.343 E9.23600 F2400
+G1 X46.853 Y31.333 E9.24000 F2400
+G1 X47.132 Y31.327 E9.24400 F2400
+G1 X47.316 Y31.325 E9.24800 F2400
+G1 X47.533 Y31.325 E9.25200 F2400
+G1 X47.733 Y31.325 E9.25600 F2400
+G1 X47.943 Y31.326 E9.26000 F2400
+G1 X48.171 Y31.326 E9.26400 F2400
+G1 X48.304 Y31.325 E9.26800 F2400
+G1 X48.411 Y31.324 E9.27200 F2400
+G1 X48.529 Y31.321 E9.27600 F2400
+G1 X48.633 Y31.319 E9.28000 F2400
+G1 X48.835 Y31.311 E9.28400 F2400
+G1 X48.989 Y31.303 E9.28800 F2400
+G1 X49.235 Y31.284 E9.29200 F2400
+G1 X49.361 Y31.272 E9.29600 F2400
+G1 X49.485 Y31.258 E9.30000 F2400
+G1 X49.747 Y31.224 E9.30400 F2400
+G1 X49.860 Y31.206 E9.30800 F2400
+G1 X50.024 Y31.178 E9.31200 F2400
+G1 X50.254 Y31.133 E9.31600 F2400
+G1 X50.460 Y31.088 E9.32000 F2400
+G1 X50.610 Y31.053 E9.32400 F2400
+G1 X50.734 Y31.022 E9.32800 F2400
+G1 X50.947 Y30.967 E9.33200 F2400
+G1 X51.095 Y30.926 E9.33600 F2400
+G1 X51.366 Y30.849 E9.34000 F2400
+G1 X51.520 Y30.805 E9.34400 F2400
+G1 X51.812 Y30.720 E9.34800 F2400
+G1 X51.919 Y30.689 E9.35200 F2400
+G1 X52.148 Y30.624 E9.35600 F2400
+G1 X52.310 Y30.579 E9.36000 F2400
+G1 X52.514 Y30.525 E9.36400 F2400
+G1 X52.711 Y30.476 E9.36800 F2400
+G1 X52.987 Y30.413 E9.37200 F2400
+G1 X53.133 Y30.383 E9.37600 F2400
+G1 X53.403 Y30.334 E9.38000 F2400
+G1 X53.517 Y30.316 E9.38400 F2400
+G1 X53.760 Y30.284 E9.38800 F2400
+G1 X54.042 Y30.259 E9.39200 F2400
+G1 X54.240 Y30.249 E9.39600 F2400
+G1 X54.527 Y30.247 E9.40000 F2400
+G1 X54.707 Y30.254 E9.40400 F2400
+G1 X54.887 Y30.266 E9.40800 F2400
+G1 X55.181 Y30.301 E9.41200 F2400
+G1 X55.488 Y30.357 E9.41600 F2400
+G1 X55.750 Y30.420 E9.42000 F2400
+G1 X55.897 Y30.461 E9.42400 F2400
+G1 X56.183 Y30.554 E9.42800 F2400
+G1 X56.352 Y30.618 E9.43200 F2400
+G1 X56.616 Y30.727 E9.43600 F2400
+G1 X56.773 Y30.798 E9.44000 F2400
+G1 X56.909 Y30.863 E9.44400 F2400
+G1 X57.051 Y30.934 E9.44800 F2400
+G1 X57.271 Y31.050 E9.45200 F2400
+G1 X57.541 Y31.202 E9.45600 F2400
+G1 X57.726 Y31.309 E9.46000 F2400
+G1 X57.835 Y31.374 E9.46400 F2400
+G1 X58.046 Y31.502 E9.46800 F2400
+G1 X58.294 Y31.655 E9.47200 F2400
+G1 X58.520 Y31.795 E9.47600 F2400
+G1 X58.608 Y31.849 E9.48000 F2400
+G1 X58.751 Y31.938 E9.48400 F2400
+G1 X58.975 Y32.075 E9.48800 F2400
+G1 X59.186 Y32.203 E9.49200 F2400
+G1 X59.450 Y32.360 E9.49600 F2400
+G1 X59.697 Y32.504 E9.50000 F2400
+G1 X59.927 Y32.637 E9.50400 F2400
+G1 X60.139 Y32.757 E9.50800 F2400
+G1 X60.296 Y32.846 E9.51200 F2400
+G1 X60.391 Y32.900 E9.51600 F2400
+G1 X60.617 Y33.028 E9.52000 F2400
+G1 X60.787 Y33.126 E9.52400 F2400
+G1 X61.029 Y33.267 E9.52800 F2400
+G1 X61.141 Y33.334 E9.53200 F2400
+G1 X61.378 Y33.480 E9.53600 F2400
+G1 X61.576 Y33.607 E9.54000 F2400
+G1 X61.811 Y33.767 E9.54400 F2400
+G1 X62.011 Y33.912 E9.54800 F2400
+G1 X62.163 Y34.029 E9.55200 F2400
+G1 X62.325 Y34.162 E9.55600 F2400
+G1 X62.418 Y34.242 E9.56000 F2400
+G1 X62.531 Y34.344 E9.56400 F2400
+G1 X62.691 Y34.497 E9.56800 F2400
+G1 X62.789 Y34.597 E9.57200 F2400
+G1 X62.909 Y34.726 E9.57600 F2400
+G1 X63.064 Y34.906 E9.58000 F2400
+G1 X63.205 Y35.084 E9.58400 F2400
+G1 X63.374 Y35.319 E9.58800 F2400
+G1 X63.482 Y35.482 E9.59200 F2400
+G1 X63.597 Y35.670 E9.59600 F2400
+G1 X63.693 Y35.839 E9.60000 F2400
+G1 X63.817 Y36.074 E9.60400 F2400
+G1 X63.921 Y36.288 E9.60800 F2400
+G1 X64.047 Y36.567 E9.61200 F2400
+G1 X64.100 Y36.693 E9.61600 F2400
+G1 X64.151 Y36.816 E9.62000 F2400
+G1 X64.213 Y36.971 E9.62400 F2400
+G1 X64.297 Y37.191 E9.62800 F2400
+G1 X64.381 Y37.415 E9.63200 F2400
+G1 X64.432 Y37.553 E9.63600 F2400
+G1 X64.487 Y37.703 E9.64000 F2400
+G1 X64.565 Y37.915 E9.64400 F2400
+G1 X64.619 Y38.062 E9.64800 F2400
+G1 X64.715 Y38.314 E9.65200 F2400
+G1 X64.760 Y38.427 E9.65600 F2400
+G1 X64.856 Y38.663 E9.66000 F2400
+G1 X64.907 Y38.781 E9.66400 F2400
+G1 X65.005 Y38.996 E9.66800 F2400
+G1 X65.113 Y39.219 E9.67200 F2400
+G1 X65.243 Y39.462 E9.67600 F2400
+G1 X65.377 Y39.692 E9.68000 F2400
+G1 X65.429 Y39.777 E9.68400 F2400
+G1 X65.549 Y39.961 E9.68800 F2400
+G1 X65.703 Y40.180 E9.69200 F2400
+G1 X65.848 Y40.374 E9.69600 F2400
+G1 X65.960 Y40.517 E9.70000 F2400
+G1 X66.112 Y40.704 E9.70400 F2400
+G1 X66.210 Y40.820 E9.70800 F2400
+G1 X66.375 Y41.012 E9.71200 F2400
+G1 X66.492 Y41.146 E9.71600 F2400
+G1 X66.683 Y41.365 E9.72000 F2400
+G1 X66.752 Y41.443 E9.72400 F2400
+G1 X66.893 Y41.606 E9.72800 F2400
+G1 X66.974 Y41.702 E9.73200 F2400
+G1 X67.136 Y41.896 E9.73600 F2400
+G1 X67.320 Y42.125 E9.74000 F2400
+G1 X67.441 Y42.283 E9.74400 F2400
+G1 X67.599 Y42.500 E9.74800 F2400
+G1 X67.682 Y42.621 E9.75200 F2400
+G1 X67.741 Y42.709 E9.75600 F2400
+G1 X67.879 Y42.929 E9.76000 F2400
+G1 X67.971 Y43.085 E9.76400 F2400
+G1 X68.028 Y43.187 E9.76800 F2400
+G1 X68.136 Y43.393 E9.77200 F2400
+G1 X68.257 Y43.645 E9.77600 F2400
+G1 X68.304 Y43.751 E9.78000 F2400
+G1 X68.388 Y43.954 E9.78400 F2400
+G1 X68.448 Y44.111 E9.78800 F2400
+G1 X68.485 Y44.212 E9.79200 F2400
+G1 X68.523 Y44.319 E9.79600 F2400
+G1 X68.557 Y44.422 E9.80000 F2400
+G1 X68.606 Y44.574 E9.80400 F2400
+G1 X68.652 Y44.728 E9.80800 F2400
+G1 X68.708 Y44.926 E9.81200 F2400
+G1 X68.765 Y45.140 E9.81600 F2400
+G1 X68.831 Y45.400 E9.82000 F2400
+G1 X68.894 Y45.662 E9.82400 F2400
+G1 X68.925 Y45.791 E9.82800 F2400
+G1 X68.976 Y46.009 E9.83200 F2400
+G1 X69.039 Y46.275 E9.83600 F2400
+G1 X69.075 Y46.419 E9.84000 F2400
+G1 X69.128 Y46.632 E9.84400 F2400
+G1 X69.203 Y46.920 E9.84800 F2400
+G1 X69.264 Y47.139 E9.85200 F2400
+G1 X69.332 Y47.371 E9.85600 F2400
+G1 X69.380 Y47.528 E9.86000 F2400
+G1 X69.473 Y47.818 E9.86400 F2400
+G1 X69.560 Y48.078 E9.86800 F2400
+G1 X69.615 Y48.239 E9.87200 F2400
+G1 X69.671 Y48.396 E9.87600 F2400
+G1 X69.706 Y48.496 E9.88000 F2400
+G1 X69.776 Y48.690 E9.88400 F2400
+G1 X69.874 Y48.964 E9.88800 F2400
+G1 X69.966 Y49.222 E9.89200 F2400
+G1 X70.012 Y49.353 E9.89600 F2400
+G1 X70.064 Y49.504 E9.90000 F2400
+G1 X70.109 Y49.639 E9.90400 F2400
+G1 X70.160 Y49.794 E9.90800 F2400
+G1 X70.205 Y49.939 E9.91200 F2400
+G1 Z0.700 F3000
+G0 X70.727 Y50.000 F6000
+G1 X70.749 Y50.219 E9.91600 F2400
+G1 X70.769 Y50.513 E9.92000 F2400
+G1 X70.779 Y50.795 E9.92400 F2400
+G1 X70.778 Y51.028 E9.92800 F2400
+G1 X70.773 Y51.198 E9.93200 F2400
+G1 X70.752 Y51.490 E9.93600 F2400
+G1 X70.736 Y51.637 E9.94000 F2400
+G1 X70.721 Y51.748 E9.94400 F2400
+G1 X70.698 Y51.896 E9.94800 F2400
+G1 X70.645 Y52.160 E9.95200 F2400
+G1 X70.585 Y52.404 E9.95600 F2400
+G1 X70.537 Y52.567 E9.96000 F2400
+G1 X70.491 Y52.711 E9.96400 F2400
+G1 X70.409 Y52.937 E9.96800 F2400
+G1 X70.328 Y53.135 E9.97200 F2400
+G1 X70.213 Y53.386 E9.97600 F2400
+G1 X70.123 Y53.567 E9.98000 F2400
+G1 X70.064 Y53.677 E9.98400 F2400
+G1 X70.005 Y53.785 E9.98800 F2400
+G1 X69.927 Y53.921 E9.99200 F2400
+G1 X69.813 Y54.110 E9.99600 F2400
+G1 X69.671 Y54.330 E10.00000 F2400
+G1 X69.545 Y54.519 E10.00400 F2400
+G1 X69.482 Y54.610 E10.00800 F2400
+G1 X69.302 Y54.864 E10.01200 F2400
+G1 X69.182 Y55.030 E10.01600 F2400
+G1 X69.051 Y55.208 E10.02000 F2400
+G1 X68.965 Y55.326 E10.02400 F2400
+G1 X68.872 Y55.451 E10.02800 F2400
+G1 X68.784 Y55.571 E10.03200 F2400
+G1 X68.649 Y55.757 E10.03600 F2400
+G1 X68.481 Y55.991 E10.04000 F2400
+G1 X68.393 Y56.118 E10.04400 F2400
+G1 X68.298 Y56.260 E10.04800 F2400
+G1 X68.212 Y56.391 E10.05200 F2400
+G1 X68.155 Y56.479 E10.05600 F2400
+G1 X68.102 Y56.564 E10.06000 F2400
+G1 X67.972 Y56.779 E10.06400 F2400
+G1 X67.832 Y57.029 E10.06800 F2400
+G1 X67.783 Y57.121 E10.07200 F2400
+G1 X67.732 Y57.220 E10.07600 F2400
+G1 X67.651 Y57.384 E10.08000 F2400
+G1 X67.585 Y57.523 E10.08400 F2400
+G1 X67.526 Y57.653 E10.08800 F2400
+G1 X67.423 Y57.894 E10.09200 F2400
+G1 X67.373 Y58.017 E10.09600 F2400
+G1 X67.324 Y58.141 E10.10000 F2400
+G1 X67.228 Y58.393 E10.10400 F2400
+G1 X67.154 Y58.597 E10.10800 F2400
+G1 X67.076 Y58.813 E10.11200 F2400
+G1 X67.000 Y59.027 E10.11600 F2400
+G1 X66.966 Y59.123 E10.12000 F2400
+G1 X66.867 Y59.394 E10.12400 F2400
+G1 X66.831 Y59.491 E10.12800 F2400
+G1 X66.781 Y59.624 E10.13200 F2400
+G1 X66.711 Y59.802 E10.13600 F2400
+G1 X66.612 Y60.045 E10.14000 F2400
+G1 X66.497 Y60.305 E10.14400 F2400
+G1 X66.455 Y60.395 E10.14800 F2400
+G1 X66.401 Y60.508 E10.15200 F2400
+G1 X66.356 Y60.598 E10.15600 F2400
+G1 X66.298 Y60.709 E10.16000 F2400
+G1 X66.165 Y60.952 E10.16400 F2400
+G1 X66.108 Y61.051 E10.16800 F2400
+G1 X66.002 Y61.225 E10.17200 F2400
+G1 X65.928 Y61.339 E10.17600 F2400
+G1 X65.873 Y61.422 E10.18000 F2400
+G1 X65.787 Y61.548 E10.18400 F2400
+G1 X65.700 Y61.668 E10.18800 F2400
+G1 X65.578 Y61.831 E10.19200 F2400
+G1 X65.410 Y62.042 E10.19600 F2400
+G1 X65.281 Y62.196 E10.20000 F2400
+G1 X65.149 Y62.349 E10.20400 F2400
+G1 X65.047 Y62.463 E10.20800 F2400
+G1 X64.958 Y62.561 E10.21200 F2400
+G1 X64.828 Y62.701 E10.21600 F2400
+G1 X64.708 Y62.829 E10.22000 F2400
+G1 X64.519 Y63.027 E10.22400 F2400
+G1 X64.423 Y63.126 E10.22800 F2400
+G1 X64.352 Y63.200 E10.23200 F2400
+G1 X64.278 Y63.278 E10.23600 F2400
+G1 X64.168 Y63.393 E10.24000 F2400
+G1 X64.072 Y63.495 E10.24400 F2400
+G1 X63.952 Y63.623 E10.24800 F2400
+G1 X63.771 Y63.822 E10.25200 F2400
+G1 X63.611 Y64.002 E10.25600 F2400
+G1 X63.472 Y64.165 E10.26000 F2400
+G1 X63.304 Y64.367 E10.26400 F2400
+G1 X63.135 Y64.582 E10.26800 F2400
+G1 X63.066 Y64.672 E10.27200 F2400
+G1 X62.923 Y64.864 E10.27600 F2400
+G1 X62.848 Y64.967 E10.28000 F2400
+G1 X62.741 Y65.118 E10.28400 F2400
+G1 X62.636 Y65.268 E10.28800 F2400
+G1 X62.546 Y65.400 E10.29200 F2400
+G1 X62.483 Y65.494 E10.29600 F2400
+G1 X62.402 Y65.614 E10.30000 F2400
+G1 X62.262 Y65.826 E10.30400 F2400
+G1 X62.091 Y66.084 E10.30800 F2400
+G1 X61.923 Y66.335 E10.31200 F2400
+G1 X61.860 Y66.429 E10.31600 F2400
+G1 X61.729 Y66.619 E10.32000 F2400
+G1 X61.643 Y66.741 E10.32400 F2400
+G1 X61.514 Y66.921 E10.32800 F2400
+G1 X61.379 Y67.100 E10.33200 F2400
+G1 X61.291 Y67.214 E10.33600 F2400
+G1 X61.211 Y67.313 E10.34000 F2400
+G1 X61.075 Y67.476 E10.34400 F2400
+G1 X60.996 Y67.566 E10.34800 F2400
+G1 X60.800 Y67.779 E10.35200 F2400
+G1 X60.589 Y67.989 E10.35600 F2400
+G1 X60.508 Y68.064 E10.36000 F2400
+G1 X60.298 Y68.245 E10.36400 F2400
+G1 X60.074 Y68.419 E10.36800 F2400
+G1 X59.981 Y68.485 E10.37200 F2400
+G1 X59.790 Y68.613 E10.37600 F2400
+G1 X59.614 Y68.719 E10.38000 F2400
+G1 X59.489 Y68.788 E10.38400 F2400
+G1 X59.241 Y68.913 E10.38800 F2400
+G1 X59.036 Y69.003 E10.39200 F2400
+G1 X58.778 Y69.103 E10.39600 F2400
+G1 X58.490 Y69.197 E10.40000 F2400
+G1 X58.189 Y69.279 E10.40400 F2400
+G1 X57.949 Y69.334 E10.40800 F2400
+G1 X57.662 Y69.389 E10.41200 F2400
+G1 X57.543 Y69.409 E10.41600 F2400
+G1 X57.367 Y69.436 E10.42000 F2400
+G1 X57.161 Y69.463 E10.42400 F2400
+G1 X56.947 Y69.488 E10.42800 F2400
+G1 X56.764 Y69.508 E10.43200 F2400
+G1 X56.486 Y69.534 E10.43600 F2400
+G1 X56.258 Y69.553 E10.44000 F2400
+G1 X55.976 Y69.575 E10.44400 F2400
+G1 X55.780 Y69.591 E10.44800 F2400
+G1 X55.481 Y69.615 E10.45200 F2400
+G1 X55.304 Y69.630 E10.45600 F2400
+G1 X54.998 Y69.658 E10.46000 F2400
+G1 X54.781 Y69.680 E10.46400 F2400
+G1 X54.603 Y69.700 E10.46800 F2400
+G1 X54.376 Y69.726 E10.47200 F2400
+G1 X54.254 Y69.741 E10.47600 F2400
+G1 X54.016 Y69.772 E10.48000 F2400
+G1 X53.796 Y69.802 E10.48400 F2400
+G1 X53.535 Y69.839 E10.48800 F2400
+G1 X53.420 Y69.856 E10.49200 F2400
+G1 X53.237 Y69.882 E10.49600 F2400
+G1 X53.020 Y69.914 E10.50000 F2400
+G1 X52.909 Y69.929 E10.50400 F2400
+G1 X52.657 Y69.964 E10.50800 F2400
+G1 X52.377 Y69.998 E10.51200 F2400
+G1 X52.151 Y70.023 E10.51600 F2400
+G1 X51.898 Y70.046 E10.52000 F2400
+G1 X51.607 Y70.064 E10.52400 F2400
+G1 X51.415 Y70.071 E10.52800 F2400
+G1 X51.212 Y70.074 E10.53200 F2400
+G1 X50.932 Y70.069 E10.53600 F2400
+G1 X50.695 Y70.055 E10.54000 F2400
+G1 X50.539 Y70.042 E10.54400 F2400
+G1 X50.320 Y70.017 E10.54800 F2400
+G1 X50.066 Y69.979 E10.55200 F2400
+G1 X49.798 Y69.927 E10.55600 F2400
+G1 X49.673 Y69.899 E10.56000 F2400
+G1 X49.541 Y69.867 E10.56400 F2400
+G1 X49.307 Y69.803 E10.56800 F2400
+G1 X49.069 Y69.730 E10.57200 F2400
+G1 X48.831 Y69.649 E10.57600 F2400
+G1 X48.640 Y69.579 E10.58000 F2400
+G1 X48.471 Y69.513 E10.58400 F2400
+G1 X48.195 Y69.400 E10.58800 F2400
+G1 X48.053 Y69.340 E10.59200 F2400
+G1 X47.906 Y69.276 E10.59600 F2400
+G1 X47.809 Y69.233 E10.60000 F2400
+G1 X47.701 Y69.185 E10.60400 F2400
+G1 X47.493 Y69.092 E10.60800 F2400
+G1 X47.281 Y68.997 E10.61200 F2400
+G1 X47.150 Y68.940 E10.61600 F2400
+G1 X46.925 Y68.842 E10.62000 F2400
+G1 X46.804 Y68.792 E10.62400 F2400
+G1 X46.647 Y68.728 E10.62800 F2400
+G1 X46.442 Y68.648 E10.63200 F2400
+G1 X46.211 Y68.565 E10.63600 F2400
+G1 X46.039 Y68.508 E10.64000 F2400
+G1 X45.801 Y68.436 E10.64400 F2400
+G1 X45.624 Y68.388 E10.64800 F2400
+G1 X45.410 Y68.337 E10.65200 F2400
+G1 X45.162 Y68.287 E10.65600 F2400
+G1 X44.963 Y68.254 E10.66000 F2400
+G1 X44.762 Y68.225 E10.66400 F2400
+G1 X44.487 Y68.193 E10.66800 F2400
+G1 X44.384 Y68.184 E10.67200 F2400
+G1 X44.283 Y68.175 E10.67600 F2400
+G1 X44.179 Y68.167 E10.68000 F2400
+G1 X44.019 Y68.156 E10.68400 F2400
+G1 X43.814 Y68.145 E10.68800 F2400
+G1 X43.590 Y68.134 E10.69200 F2400
+G1 X43.352 Y68.124 E10.69600 F2400
+G1 X43.247 Y68.119 E10.70000 F2400
+G1 X42.967 Y68.107 E10.70400 F2400
+G1 X42.816 Y68.099 E10.70800 F2400
+G1 X42.514 Y68.081 E10.71200 F2400
+G1 X42.340 Y68.067 E10.71600 F2400
+G1 X42.063 Y68.041 E10.72000 F2400
+G1 X41.814 Y68.011 E10.72400 F2400
+G1 X41.707 Y67.996 E10.72800 F2400
+G1 X41.501 Y67.963 E10.73200 F2400
+G1 X41.320 Y67.929 E10.73600 F2400
+G1 X41.021 Y67.863 E10.74000 F2400
+G1 X40.875 Y67.826 E10.74400 F2400
+G1 X40.699 Y67.776 E10.74800 F2400
+G1 X40.568 Y67.735 E10.75200 F2400
+G1 X40.470 Y67.702 E10.75600 F2400
+G1 X40.271 Y67.631 E10.76000 F2400
+G1 X40.060 Y67.546 E10.76400 F2400
+G1 X39.936 Y67.493 E10.76800 F2400
+G1 X39.691 Y67.378 E10.77200 F2400
+G1 X39.560 Y67.312 E10.77600 F2400
+G1 X39.305 Y67.172 E10.78000 F2400
+G1 X39.100 Y67.052 E10.78400 F2400
+G1 X38.848 Y66.893 E10.78800 F2400
+G1 X38.689 Y66.789 E10.79200 F2400
+G1 X38.466 Y66.635 E10.79600 F2400
+G1 X38.284 Y66.506 E10.80000 F2400
+G1 X38.085 Y66.361 E10.80400 F2400
+G1 X37.936 Y66.252 E10.80800 F2400
+G1 X37.772 Y66.130 E10.81200 F2400
+G1 X37.647 Y66.037 E10.81600 F2400
+G1 X37.511 Y65.935 E10.82000 F2400
+G1 X37.278 Y65.764 E10.82400 F2400
+G1 X37.184 Y65.694 E10.82800 F2400
+G1 X36.965 Y65.535 E10.83200 F2400
+G1 X36.758 Y65.388 E10.83600 F2400
+G1 X36.647 Y65.310 E10.84000 F2400
+G1 X36.491 Y65.201 E10.84400 F2400
+G1 X36.264 Y65.046 E10.84800 F2400
+G1 X36.092 Y64.930 E10.85200 F2400
+G1 X35.918 Y64.814 E10.85600 F2400
+G1 X35.744 Y64.699 E10.86000 F2400
+G1 X35.627 Y64.622 E10.86400 F2400
+G1 X35.367 Y64.449 E10.86800 F2400
+G1 X35.149 Y64.303 E10.87200 F2400
+G1 X35.012 Y64.209 E10.87600 F2400
+G1 X34.865 Y64.107 E10.88000 F2400
+G1 X34.657 Y63.959 E10.88400 F2400
+G1 X34.423 Y63.786 E10.88800 F2400
+G1 X34.248 Y63.649 E10.89200 F2400
+G1 X34.118 Y63.544 E10.89600 F2400
+G1 X33.980 Y63.426 E10.90000 F2400
+G1 X33.815 Y63.278 E10.90400 F2400
+G1 X33.605 Y63.075 E10.90800 F2400
+G1 X33.430 Y62.891 E10.91200 F2400
+G1 X33.329 Y62.776 E10.91600 F2400
+G1 X33.259 Y62.693 E10.92000 F2400
+G1 X33.109 Y62.501 E10.92400 F2400
+G1 X33.015 Y62.371 E10.92800 F2400
+G1 X32.855 Y62.130 E10.93200 F2400
+G1 X32.784 Y62.011 E10.93600 F2400
+G1 X32.634 Y61.733 E10.94000 F2400
+G1 X32.518 Y61.483 E10.94400 F2400
+G1 X32.456 Y61.335 E10.94800 F2400
+G1 X32.416 Y61.233 E10.95200 F2400
+G1 X32.323 Y60.966 E10.95600 F2400
+G1 X32.285 Y60.841 E10.96000 F2400
+G1 X32.246 Y60.706 E10.96400 F2400
+G1 X32.198 Y60.522 E10.96800 F2400
+G1 X32.164 Y60.380 E10.97200 F2400
+G1 X32.137 Y60.255 E10.97600 F2400
+G1 X32.094 Y60.031 E10.98000 F2400
+G1 X32.052 Y59.784 E10.98400 F2400
+G1 X32.012 Y59.508 E10.98800 F2400
+G1 X31.997 Y59.388 E10.99200 F2400
+G1 X31.983 Y59.269 E10.99600 F2400
+G1 X31.959 Y59.060 E11.00000 F2400
+G1 X31.932 Y58.795 E11.00400 F2400
+G1 X31.918 Y58.644 E11.00800 F2400
+G1 X31.896 Y58.412 E11.01200 F2400
+G1 X31.884 Y58.284 E11.01600 F2400
+G1 X31.856 Y57.992 E11.02000 F2400
+G1 X31.826 Y57.709 E11.02400 F2400
+G1 X31.790 Y57.417 E11.02800 F2400
+G1 X31.766 Y57.238 E11.03200 F2400
+G1 X31.749 Y57.122 E11.03600 F2400
+G1 X31.708 Y56.862 E11.04000 F2400
+G1 X31.675 Y56.678 E11.04400 F2400
+G1 X31.642 Y56.514 E11.04800 F2400
+G1 X31.605 Y56.336 E11.05200 F2400
+G1 X31.552 Y56.106 E11.05600 F2400
+G1 X31.493 Y55.874 E11.06000 F2400
+G1 X31.446 Y55.698 E11.06400 F2400
+G1 X31.406 Y55.555 E11.06800 F2400
+G1 X31.372 Y55.433 E11.07200 F2400
+G1 X31.341 Y55.331 E11.07600 F2400
+G1 X31.259 Y55.059 E11.08000 F2400
+G1 X31.176 Y54.786 E11.08400 F2400
+G1 X31.143 Y54.681 E11.08800 F2400
+G1 X31.081 Y54.477 E11.09200 F2400
+G1 X30.999 Y54.202 E11.09600 F2400
+G1 X30.942 Y54.000 E11.10000 F2400
+G1 X30.868 Y53.723 E11.10400 F2400
+G1 X30.838 Y53.600 E11.10800 F2400
+G1 X30.785 Y53.368 E11.11200 F2400
+G1 X30.733 Y53.112 E11.11600 F2400
+G1 X30.712 Y52.994 E11.12000 F2400
+G1 X30.690 Y52.858 E11.12400 F2400
+G1 X30.653 Y52.578 E11.12800 F2400
+G1 X30.638 Y52.436 E11.13200 F2400
+G1 X30.620 Y52.218 E11.13600 F2400
+G1 X30.606 Y51.943 E11.14000 F2400
+G1 X30.602 Y51.706 E11.14400 F2400
+G1 X30.605 Y51.457 E11.14800 F2400
+G1 X30.611 Y51.301 E11.15200 F2400
+G1 X30.625 Y51.038 E11.15600 F2400
+G1 X30.634 Y50.914 E11.16000 F2400
+G1 X30.649 Y50.738 E11.16400 F2400
+G1 X30.667 Y50.546 E11.16800 F2400
+G1 X30.692 Y50.313 E11.17200 F2400
+G1 X30.703 Y50.210 E11.17600 F2400
+G1 X30.716 Y50.099 E11.18000 F2400
+G1 X30.735 Y49.931 E11.18400 F2400
+G1 X30.750 Y49.805 E11.18800 F2400
+G1 X30.780 Y49.534 E11.19200 F2400
+G1 X30.799 Y49.354 E11.19600 F2400
+G1 X30.819 Y49.145 E11.20000 F2400
+G1 X30.834 Y48.968 E11.20400 F2400
+G1 X30.851 Y48.707 E11.20800 F2400
+G1 X30.861 Y48.434 E11.21200 F2400
+G1 X30.865 Y48.164 E11.21600 F2400
+G1 X30.864 Y48.051 E11.22000 F2400
+G1 X30.858 Y47.836 E11.22400 F2400
+G1 X30.845 Y47.586 E11.22800 F2400
+G1 X30.823 Y47.307 E11.23200 F2400
+G1 X30.802 Y47.097 E11.23600 F2400
+G1 X30.779 Y46.902 E11.24000 F2400
+G1 X30.762 Y46.766 E11.24400 F2400
+G1 X30.748 Y46.663 E11.24800 F2400
+G1 X30.733 Y46.556 E11.25200 F2400
+G1 X30.709 Y46.397 E11.25600 F2400
+G1 X30.671 Y46.145 E11.26000 F2400
+G1 X30.642 Y45.957 E11.26400 F2400
+G1 X30.608 Y45.739 E11.26800 F2400
+G1 X30.583 Y45.576 E11.27200 F2400
+G1 X30.538 Y45.263 E11.27600 F2400
+G1 X30.499 Y44.959 E11.28000 F2400
+G1 X30.480 Y44.795 E11.28400 F2400
+G1 X30.462 Y44.605 E11.28800 F2400
+G1 X30.451 Y44.474 E11.29200 F2400
+G1 X30.439 Y44.281 E11.29600 F2400
+G1 X30.432 Y44.121 E11.30000 F2400
+G1 X30.428 Y43.857 E11.30400 F2400
+G1 X30.430 Y43.683 E11.30800 F2400
+G1 X30.442 Y43.429 E11.31200 F2400
+G1 X30.451 Y43.318 E11.31600 F2400
+G1 X30.478 Y43.063 E11.32000 F2400
+G1 X30.515 Y42.825 E11.32400 F2400
+G1 X30.546 Y42.662 E11.32800 F2400
+G1 X30.608 Y42.402 E11.33200 F2400
+G1 X30.688 Y42.128 E11.33600 F2400
+G1 X30.785 Y41.851 E11.34000 F2400
+G1 X30.880 Y41.620 E11.34400 F2400
+G1 X30.962 Y41.442 E11.34800 F2400
+G1 X31.063 Y41.239 E11.35200 F2400
+G1 X31.190 Y41.008 E11.35600 F2400
+G1 X31.277 Y40.861 E11.36000 F2400
+G1 X31.432 Y40.616 E11.36400 F2400
+G1 X31.583 Y40.393 E11.36800 F2400
+G1 X31.728 Y40.190 E11.37200 F2400
+G1 X31.886 Y39.979 E11.37600 F2400
+G1 X31.956 Y39.887 E11.38000 F2400
+G1 X32.124 Y39.671 E11.38400 F2400
+G1 X32.247 Y39.516 E11.38800 F2400
+G1 X32.402 Y39.324 E11.39200 F2400
+G1 X32.552 Y39.138 E11.39600 F2400
+G1 X32.672 Y38.990 E11.40000 F2400
+G1 X32.831 Y38.791 E11.40400 F2400
+G1 X33.005 Y38.572 E11.40800 F2400
+G1 X33.195 Y38.331 E11.41200 F2400
+G1 X33.260 Y38.248 E11.41600 F2400
+G1 X33.436 Y38.018 E11.42000 F2400
+G1 X33.594 Y37.810 E11.42400 F2400
+G1 X33.728 Y37.631 E11.42800 F2400
+G1 X33.883 Y37.425 E11.43200 F2400
+G1 X33.987 Y37.286 E11.43600 F2400
+G1 X34.098 Y37.138 E11.44000 F2400
+G1 X34.164 Y37.050 E11.44400 F2400
+G1 X34.342 Y36.817 E11.44800 F2400
+G1 X34.507 Y36.606 E11.45200 F2400
+G1 X34.638 Y36.444 E11.45600 F2400
+G1 X34.784 Y36.269 E11.46000 F2400
+G1 X34.963 Y36.064 E11.46400 F2400
+G1 X35.055 Y35.963 E11.46800 F2400
+G1 X35.206 Y35.804 E11.47200 F2400
+G1 X35.384 Y35.628 E11.47600 F2400
+G1 X35.547 Y35.477 E11.48000 F2400
+G1 X35.778 Y35.281 E11.48400 F2400
+G1 X35.900 Y35.184 E11.48800 F2400
+G1 X36.095 Y35.040 E11.49200 F2400
+G1 X36.314 Y34.893 E11.49600 F2400
+G1 X36.471 Y34.796 E11.50000 F2400
+G1 X36.732 Y34.649 E11.50400 F2400
+G1 X36.901 Y34.562 E11.50800 F2400
+G1 X37.022 Y34.504 E11.51200 F2400
+G1 X37.150 Y34.446 E11.51600 F2400
+G1 X37.322 Y34.372 E11.52000 F2400
+G1 X37.614 Y34.259 E11.52400 F2400
+G1 X37.896 Y34.161 E11.52800 F2400
+G1 X38.179 Y34.074 E11.53200 F2400
+G1 X38.415 Y34.006 E11.53600 F2400
+G1 X38.618 Y33.951 E11.54000 F2400
+G1 X38.850 Y33.891 E11.54400 F2400
+G1 X39.074 Y33.835 E11.54800 F2400
+G1 X39.366 Y33.763 E11.55200 F2400
+G1 X39.544 Y33.719 E11.55600 F2400
+G1 X39.720 Y33.675 E11.56000 F2400
+G1 X39.960 Y33.612 E11.56400 F2400
+G1 X40.210 Y33.543 E11.56800 F2400
+G1 X40.444 Y33.473 E11.57200 F2400
+G1 X40.566 Y33.434 E11.57600 F2400
+G1 X40.774 Y33.363 E11.58000 F2400
+G1 X40.913 Y33.312 E11.58400 F2400
+G1 X41.051 Y33.259 E11.58800 F2400
+G1 X41.185 Y33.204 E11.59200 F2400
+G1 X41.273 Y33.166 E11.59600 F2400
+G1 X41.381 Y33.118 E11.60000 F2400
+G1 X41.582 Y33.023 E11.60400 F2400
+G1 X41.800 Y32.911 E11.60800 F2400
+G1 X41.901 Y32.856 E11.61200 F2400
+G1 X42.140 Y32.719 E11.61600 F2400
+G1 X42.298 Y32.623 E11.62000 F2400
+G1 X42.507 Y32.491 E11.62400 F2400
+G1 X42.595 Y32.434 E11.62800 F2400
+G1 X42.689 Y32.372 E11.63200 F2400
+G1 X42.902 Y32.229 E11.63600 F2400
+G1 X42.999 Y32.163 E11.64000 F2400
+G1 X43.086 Y32.103 E11.64400 F2400
+G1 X43.275 Y31.974 E11.64800 F2400
+G1 X43.364 Y31.914 E11.65200 F2400
+G1 X43.515 Y31.812 E11.65600 F2400
+G1 X43.734 Y31.667 E11.66000 F2400
+G1 X43.837 Y31.600 E11.66400 F2400
+G1 X44.065 Y31.457 E11.66800 F2400
+G1 X44.308 Y31.312 E11.67200 F2400
+G1 X44.566 Y31.169 E11.67600 F2400
+G1 X44.764 Y31.067 E11.68000 F2400
+G1 X45.003 Y30.953 E11.68400 F2400
+G1 X45.123 Y30.900 E11.68800 F2400
+G1 X45.321 Y30.818 E11.69200 F2400
+G1 X45.578 Y30.722 E11.69600 F2400
+G1 X45.836 Y30.636 E11.70000 F2400
+G1 X45.963 Y30.598 E11.70400 F2400
+G1 X46.218 Y30.529 E11.70800 F2400
+G1 X46.392 Y30.487 E11.71200 F2400
+G1 X46.588 Y30.445 E11.71600 F2400
+G1 X46.841 Y30.396 E11.72000 F2400
+G1 X47.070 Y30.358 E11.72400 F2400
+G1 X47.232 Y30.334 E11.72800 F2400
+G1 X47.499 Y30.297 E11.73200 F2400
+G1 X47.781 Y30.263 E11.73600 F2400
+G1 X48.040 Y30.234 E11.74000 F2400
+G1 X48.148 Y30.221 E11.74400 F2400
+G1 X48.250 Y30.210 E11.74800 F2400
+G1 X48.462 Y30.186 E11.75200 F2400
+G1 X48.581 Y30.173 E11.75600 F2400
+G1 X48.697 Y30.159 E11.76000 F2400
+G1 X48.968 Y30.126 E11.76400 F2400
+G1 X49.076 Y30.112 E11.76800 F2400
+G1 X49.231 Y30.091 E11.77200 F2400
+G1 X49.391 Y30.068 E11.77600 F2400
+G1 X49.676 Y30.023 E11.78000 F2400
+G1 X49.965 Y29.973 E11.78400 F2400
+G1 X50.223 Y29.925 E11.78800 F2400
+G1 X50.416 Y29.887 E11.79200 F2400
+G1 X50.541 Y29.862 E11.79600 F2400
+G1 X50.839 Y29.799 E11.80000 F2400
+G1 X50.987 Y29.767 E11.80400 F2400
+G1 X51.221 Y29.716 E11.80800 F2400
+G1 X51.486 Y29.659 E11.81200 F2400
+G1 X51.696 Y29.614 E11.81600 F2400
+G1 X51.987 Y29.555 E11.82000 F2400
+G1 X52.291 Y29.498 E11.82400 F2400
+G1 X52.474 Y29.467 E11.82800 F2400
+G1 X52.732 Y29.428 E11.83200 F2400
+G1 X52.859 Y29.411 E11.83600 F2400
+G1 X53.058 Y29.389 E11.84000 F2400
+G1 X53.308 Y29.368 E11.84400 F2400
+G1 X53.474 Y29.359 E11.84800 F2400
+G1 X53.661 Y29.354 E11.85200 F2400
+G1 X53.929 Y29.357 E11.85600 F2400
+G1 X54.080 Y29.363 E11.86000 F2400
+G1 X54.380 Y29.390 E11.86400 F2400
+G1 X54.514 Y29.407 E11.86800 F2400
+G1 X54.665 Y29.431 E11.87200 F2400
+G1 X54.896 Y29.478 E11.87600 F2400
+G1 X55.046 Y29.514 E11.88000 F2400
+G1 X55.317 Y29.593 E11.88400 F2400
+G1 X55.489 Y29.652 E11.88800 F2400
+G1 X55.613 Y29.699 E11.89200 F2400
+G1 X55.842 Y29.795 E11.89600 F2400
+G1 X56.020 Y29.879 E11.90000 F2400
+G1 X56.233 Y29.989 E11.90400 F2400
+G1 X56.347 Y30.053 E11.90800 F2400
+G1 X56.449 Y30.113 E11.91200 F2400
+G1 X56.595 Y30.203 E11.91600 F2400
+G1 X56.778 Y30.322 E11.92000 F2400
+G1 X56.902 Y30.408 E11.92400 F2400
+G1 X57.026 Y30.496 E11.92800 F2400
+G1 X57.257 Y30.669 E11.93200 F2400
+G1 X57.383 Y30.768 E11.93600 F2400
+G1 X57.526 Y30.882 E11.94000 F2400
+G1 X57.753 Y31.071 E11.94400 F2400
+G1 X57.998 Y31.278 E11.94800 F2400
+G1 X58.203 Y31.455 E11.95200 F2400
+G1 X58.305 Y31.544 E11.95600 F2400
+G1 X58.506 Y31.718 E11.96000 F2400
+G1 X58.600 Y31.799 E11.96400 F2400
+G1 X58.806 Y31.974 E11.96800 F2400
+G1 X58.928 Y32.077 E11.97200 F2400
+G1 X59.042 Y32.171 E11.97600 F2400
+G1 X59.189 Y32.290 E11.98000 F2400
+G1 X59.291 Y32.372 E11.98400 F2400
+G1 X59.476 Y32.517 E11.98800 F2400
+G1 X59.688 Y32.678 E11.99200 F2400
+G1 X59.876 Y32.816 E11.99600 F2400
+G1 X60.085 Y32.966 E12.00000 F2400
+G1 X60.193 Y33.041 E12.00400 F2400
+G1 X60.319 Y33.128 E12.00800 F2400
+G1 X60.537 Y33.278 E12.01200 F2400
+G1 X60.673 Y33.369 E12.01600 F2400
+G1 X60.877 Y33.506 E12.02000 F2400
+G1 X61.052 Y33.624 E12.02400 F2400
+G1 X61.159 Y33.696 E12.02800 F2400
+G1 X61.276 Y33.776 E12.03200 F2400
+G1 X61.507 Y33.937 E12.03600 F2400
+G1 X61.732 Y34.099 E12.04000 F2400
+G1 X61.905 Y34.229 E12.04400 F2400
+G1 X61.985 Y34.292 E12.04800 F2400
+G1 X62.065 Y34.355 E12.05200 F2400
+G1 X62.284 Y34.536 E12.05600 F2400
+G1 X62.477 Y34.706 E12.06000 F2400
+G1 X62.650 Y34.868 E12.06400 F2400
+G1 X62.756 Y34.973 E12.06800 F2400
+G1 X62.949 Y35.175 E12.07200 F2400
+G1 X63.025 Y35.260 E12.07600 F2400
+G1 X63.178 Y35.438 E12.08000 F2400
+G1 X63.326 Y35.622 E12.08400 F2400
+G1 X63.431 Y35.760 E12.08800 F2400
+G1 X63.583 Y35.972 E12.09200 F2400
+G1 X63.661 Y36.085 E12.09600 F2400
+G1 X63.820 Y36.329 E12.10000 F2400
+G1 X63.970 Y36.571 E12.10400 F2400
+G1 X64.055 Y36.714 E12.10800 F2400
+G1 X64.138 Y36.856 E12.11200 F2400
+G1 X64.265 Y37.078 E12.11600 F2400
+G1 X64.347 Y37.222 E12.12000 F2400
+G1 X64.452 Y37.408 E12.12400 F2400
+G1 X64.567 Y37.610 E12.12800 F2400
+G1 X64.707 Y37.853 E12.13200 F2400
+G1 X64.832 Y38.060 E12.13600 F2400
+G1 X64.910 Y38.186 E12.14000 F2400
+G1 X64.998 Y38.324 E12.14400 F2400
+G1 X65.058 Y38.415 E12.14800 F2400
+G1 X65.199 Y38.619 E12.15200 F2400
+G1 X65.350 Y38.825 E12.15600 F2400
+G1 X65.434 Y38.934 E12.16000 F2400
+G1 X65.551 Y39.077 E12.16400 F2400
+G1 X65.655 Y39.201 E12.16800 F2400
+G1 X65.755 Y39.313 E12.17200 F2400
+G1 X65.823 Y39.388 E12.17600 F2400
+G1 X65.969 Y39.542 E12.18000 F2400
+G1 X66.170 Y39.743 E12.18400 F2400
+G1 X66.266 Y39.834 E12.18800 F2400
+G1 X66.449 Y40.004 E12.19200 F2400
+G1 X66.640 Y40.176 E12.19600 F2400
+G1 X66.799 Y40.315 E12.20000 F2400
+G1 X67.009 Y40.497 E12.20400 F2400
+G1 X67.155 Y40.623 E12.20800 F2400
+G1 X67.332 Y40.777 E12.21200 F2400
+G1 X67.422 Y40.856 E12.21600 F2400
+G1 X67.525 Y40.947 E12.22000 F2400
+G1 X67.696 Y41.101 E12.22400 F2400
+G1 X67.905 Y41.295 E12.22800 F2400
+G1 X68.054 Y41.439 E12.23200 F2400
+G1 X68.268 Y41.656 E12.23600 F2400
+G1 X68.411 Y41.811 E12.24000 F2400
+G1 X68.538 Y41.956 E12.24400 F2400
+G1 X68.710 Y42.165 E12.24800 F2400
+G1 X68.890 Y42.403 E12.25200 F2400
+G1 X69.055 Y42.645 E12.25600 F2400
+G1 X69.182 Y42.851 E12.26000 F2400
+G1 X69.255 Y42.980 E12.26400 F2400
+G1 X69.334 Y43.127 E12.26800 F2400
+G1 X69.431 Y43.324 E12.27200 F2400
+G1 X69.477 Y43.424 E12.27600 F2400
+G1 X69.542 Y43.576 E12.28000 F2400
+G1 X69.638 Y43.823 E12.28400 F2400
+G1 X69.689 Y43.970 E12.28800 F2400
+G1 X69.760 Y44.195 E12.29200 F2400
+G1 X69.806 Y44.354 E12.29600 F2400
+G1 X69.839 Y44.480 E12.30000 F2400
+G1 X69.880 Y44.647 E12.30400 F2400
+G1 X69.918 Y44.812 E12.30800 F2400
+G1 X69.950 Y44.969 E12.31200 F2400
+G1 X69.982 Y45.133 E12.31600 F2400
+G1 X70.032 Y45.420 E12.32000 F2400
+G1 X70.067 Y45.639 E12.32400 F2400
+G1 X70.098 Y45.842 E12.32800 F2400
+G1 X70.120 Y45.997 E12.33200 F2400
+G1 X70.143 Y46.158 E12.33600 F2400
+G1 X70.179 Y46.422 E12.34000 F2400
+G1 X70.202 Y46.591 E12.34400 F2400
+G1 X70.220 Y46.723 E12.34800 F2400
+G1 X70.245 Y46.903 E12.35200 F2400
+G1 X70.280 Y47.141 E12.35600 F2400
+G1 X70.323 Y47.433 E12.36000 F2400
+G1 X70.366 Y47.703 E12.36400 F2400
+G1 X70.399 Y47.905 E12.36800 F2400
+G1 X70.421 Y48.040 E12.37200 F2400
+G1 X70.469 Y48.321 E12.37600 F2400
+G1 X70.488 Y48.431 E12.38000 F2400
+G1 X70.526 Y48.652 E12.38400 F2400
+G1 X70.577 Y48.952 E12.38800 F2400
+G1 X70.605 Y49.119 E12.39200 F2400
+G1 X70.638 Y49.329 E12.39600 F2400
+G1 X70.663 Y49.495 E12.40000 F2400
+G1 X70.689 Y49.684 E12.40400 F2400
+G1 X70.705 Y49.810 E12.40800 F2400
+G0 X70.277 Y50.000 F6000
+G1 X70.302 Y50.250 E12.41200 F2400
+G1 X70.312 Y50.380 E12.41600 F2400
+G1 X70.319 Y50.487 E12.42000 F2400
+G1 X70.326 Y50.641 E12.42400 F2400
+G1 X70.330 Y50.819 E12.42800 F2400
+G1 X70.329 Y51.014 E12.43200 F2400
+G1 X70.318 Y51.266 E12.43600 F2400
+G1 X70.301 Y51.478 E12.44000 F2400
+G1 X70.289 Y51.588 E12.44400 F2400
+G1 X70.275 Y51.696 E12.44800 F2400
+G1 X70.243 Y51.890 E12.45200 F2400
+G1 X70.217 Y52.027 E12.45600 F2400
+G1 X70.154 Y52.293 E12.46000 F2400
+G1 X70.080 Y52.545 E12.46400 F2400
+G1 X69.990 Y52.805 E12.46800 F2400
+G1 X69.901 Y53.025 E12.47200 F2400
+G1 X69.840 Y53.163 E12.47600 F2400
+G1 X69.720 Y53.411 E12.48000 F2400
+G1 X69.641 Y53.561 E12.48400 F2400
+G1 X69.571 Y53.686 E12.48800 F2400
+G1 X69.513 Y53.787 E12.49200 F2400
+G1 X69.414 Y53.951 E12.49600 F2400
+G1 X69.243 Y54.216 E12.50000 F2400
+G1 X69.099 Y54.428 E12.50400 F2400
+G1 X68.955 Y54.632 E12.50800 F2400
+G1 X68.843 Y54.785 E12.51200 F2400
+G1 X68.724 Y54.946 E12.51600 F2400
+G1 X68.545 Y55.186 E12.52000 F2400
+G1 X68.356 Y55.438 E12.52400 F2400
+G1 X68.253 Y55.577 E12.52800 F2400
+G1 X68.121 Y55.758 E12.53200 F2400
+G1 X68.005 Y55.922 E12.53600 F2400
+G1 X67.924 Y56.038 E12.54000 F2400
+G1 X67.810 Y56.206 E12.54400 F2400
+G1 X67.747 Y56.304 E12.54800 F2400
+G1 X67.611 Y56.520 E12.55200 F2400
+G1 X67.521 Y56.672 E12.55600 F2400
+G1 X67.412 Y56.867 E12.56000 F2400
+G1 X67.298 Y57.085 E12.56400 F2400
+G1 X67.235 Y57.211 E12.56800 F2400
+G1 X67.119 Y57.462 E12.57200 F2400
+G1 X67.007 Y57.723 E12.57600 F2400
+G1 X66.937 Y57.898 E12.58000 F2400
+G1 X66.897 Y58.001 E12.58400 F2400
+G1 X66.820 Y58.206 E12.58800 F2400
+G1 X66.743 Y58.419 E12.59200 F2400
+G1 X66.696 Y58.550 E12.59600 F2400
+G1 X66.614 Y58.784 E12.60000 F2400
+G1 X66.563 Y58.927 E12.60400 F2400
+G1 X66.513 Y59.067 E12.60800 F2400
+G1 X66.474 Y59.174 E12.61200 F2400
+G1 X66.398 Y59.380 E12.61600 F2400
+G1 X66.310 Y59.609 E12.62000 F2400
+G1 X66.221 Y59.826 E12.62400 F2400
+G1 X66.158 Y59.971 E12.62800 F2400
+G1 X66.094 Y60.113 E12.63200 F2400
+G1 X66.048 Y60.211 E12.63600 F2400
+G1 X65.990 Y60.330 E12.64000 F2400
+G1 X65.922 Y60.462 E12.64400 F2400
+G1 X65.857 Y60.584 E12.64800 F2400
+G1 X65.805 Y60.677 E12.65200 F2400
+G1 X65.717 Y60.829 E12.65600 F2400
+G1 X65.665 Y60.915 E12.66000 F2400
+G1 X65.560 Y61.080 E12.66400 F2400
+G1 X65.506 Y61.162 E12.66800 F2400
+G1 X65.408 Y61.304 E12.67200 F2400
+G1 X65.340 Y61.399 E12.67600 F2400
+G1 X65.262 Y61.503 E12.68000 F2400
+G1 X65.119 Y61.687 E12.68400 F2400
+G1 X65.048 Y61.774 E12.68800 F2400
+G1 X64.887 Y61.966 E12.69200 F2400
+G1 X64.734 Y62.139 E12.69600 F2400
+G1 X64.584 Y62.304 E12.70000 F2400
+G1 X64.447 Y62.451 E12.70400 F2400
+G1 X64.282 Y62.624 E12.70800 F2400
+G1 X64.185 Y62.725 E12.71200 F2400
+G1 X64.063 Y62.853 E12.71600 F2400
+G1 X63.993 Y62.925 E12.72000 F2400
+G1 X63.925 Y62.996 E12.72400 F2400
+G1 X63.802 Y63.126 E12.72800 F2400
+G1 X63.653 Y63.284 E12.73200 F2400
+G1 X63.460 Y63.495 E12.73600 F2400
+G1 X63.287 Y63.692 E12.74000 F2400
+G1 X63.216 Y63.774 E12.74400 F2400
+G1 X63.038 Y63.989 E12.74800 F2400
+G1 X62.927 Y64.127 E12.75200 F2400
+G1 X62.816 Y64.271 E12.75600 F2400
+G1 X62.736 Y64.377 E12.76000 F2400
+G1 X62.665 Y64.473 E12.76400 F2400
+G1 X62.553 Y64.629 E12.76800 F2400
+G1 X62.430 Y64.803 E12.77200 F2400
+G1 X62.274 Y65.034 E12.77600 F2400
+G1 X62.139 Y65.236 E12.78000 F2400
+G1 X62.059 Y65.358 E12.78400 F2400
+G1 X61.933 Y65.553 E12.78800 F2400
+G1 X61.779 Y65.789 E12.79200 F2400
+G1 X61.690 Y65.923 E12.79600 F2400
+G1 X61.596 Y66.066 E12.80000 F2400
+G1 X61.504 Y66.202 E12.80400 F2400
+G1 X61.321 Y66.464 E12.80800 F2400
+G1 X61.239 Y66.579 E12.81200 F2400
+G1 X61.091 Y66.776 E12.81600 F2400
+G1 X60.976 Y66.924 E12.82000 F2400
+G1 X60.806 Y67.129 E12.82400 F2400
+G1 X60.663 Y67.291 E12.82800 F2400
+G1 X60.557 Y67.405 E12.83200 F2400
+G1 X60.350 Y67.611 E12.83600 F2400
+G1 X60.186 Y67.760 E12.84000 F2400
+G1 X60.101 Y67.833 E12.84400 F2400
+G1 X59.982 Y67.929 E12.84800 F2400
+G1 X59.870 Y68.015 E12.85200 F2400
+G1 X59.728 Y68.117 E12.85600 F2400
+G1 X59.611 Y68.194 E12.86000 F2400
+G1 X59.405 Y68.320 E12.86400 F2400
+G1 X59.200 Y68.432 E12.86800 F2400
+G1 X59.031 Y68.514 E12.87200 F2400
+G1 X58.886 Y68.579 E12.87600 F2400
+G1 X58.663 Y68.668 E12.88000 F2400
+G1 X58.488 Y68.729 E12.88400 F2400
+G1 X58.232 Y68.808 E12.88800 F2400
+G1 X57.951 Y68.880 E12.89200 F2400
+G1 X57.697 Y68.934 E12.89600 F2400
+G1 X57.395 Y68.987 E12.90000 F2400
+G1 X57.226 Y69.012 E12.90400 F2400
+G1 X56.940 Y69.049 E12.90800 F2400
+G1 X56.748 Y69.070 E12.91200 F2400
+G1 X56.461 Y69.097 E12.91600 F2400
+G1 X56.225 Y69.116 E12.92000 F2400
+G1 X56.059 Y69.129 E12.92400 F2400
+G1 X55.895 Y69.141 E12.92800 F2400
+G1 X55.612 Y69.162 E12.93200 F2400
+G1 X55.408 Y69.178 E12.93600 F2400
+G1 X55.273 Y69.189 E12.94000 F2400
+G1 X55.050 Y69.208 E12.94400 F2400
+G1 X54.919 Y69.219 E12.94800 F2400
+G1 X54.804 Y69.230 E12.95200 F2400
+G1 X54.649 Y69.246 E12.95600 F2400
+G1 X54.391 Y69.274 E12.96000 F2400
+G1 X54.248 Y69.290 E12.96400 F2400
+G1 X53.973 Y69.325 E12.96800 F2400
+G1 X53.865 Y69.339 E12.97200 F2400
+G1 X53.697 Y69.362 E12.97600 F2400
+G1 X53.597 Y69.376 E12.98000 F2400
+G1 X53.359 Y69.410 E12.98400 F2400
+G1 X53.137 Y69.442 E12.98800 F2400
+G1 X52.881 Y69.479 E12.99200 F2400
+G1 X52.618 Y69.515 E12.99600 F2400
+G1 X52.337 Y69.550 E13.00000 F2400
+G1 X52.152 Y69.570 E13.00400 F2400
+G1 X51.978 Y69.587 E13.00800 F2400
+G1 X51.756 Y69.605 E13.01200 F2400
+G1 X51.557 Y69.616 E13.01600 F2400
+G1 X51.418 Y69.622 E13.02000 F2400
+G1 X51.230 Y69.625 E13.02400 F2400
+G1 X51.050 Y69.623 E13.02800 F2400
+G1 X50.770 Y69.612 E13.03200 F2400
+G1 X50.654 Y69.604 E13.03600 F2400
+G1 X50.407 Y69.579 E13.04000 F2400
+G1 X50.165 Y69.546 E13.04400 F2400
+G1 X49.882 Y69.494 E13.04800 F2400
+G1 X49.670 Y69.447 E13.05200 F2400
+G1 X49.432 Y69.385 E13.05600 F2400
+G1 X49.310 Y69.349 E13.06000 F2400
+G1 X49.041 Y69.264 E13.06400 F2400
+G1 X48.934 Y69.227 E13.06800 F2400
+G1 X48.721 Y69.149 E13.07200 F2400
+G1 X48.604 Y69.103 E13.07600 F2400
+G1 X48.465 Y69.048 E13.08000 F2400
+G1 X48.240 Y68.954 E13.08400 F2400
+G1 X48.075 Y68.881 E13.08800 F2400
+G1 X47.854 Y68.783 E13.09200 F2400
+G1 X47.721 Y68.723 E13.09600 F2400
+G1 X47.612 Y68.673 E13.10000 F2400
+G1 X47.457 Y68.603 E13.10400 F2400
+G1 X47.274 Y68.520 E13.10800 F2400
+G1 X47.036 Y68.415 E13.11200 F2400
+G1 X46.790 Y68.311 E13.11600 F2400
+G1 X46.632 Y68.247 E13.12000 F2400
+G1 X46.372 Y68.149 E13.12400 F2400
+G1 X46.180 Y68.083 E13.12800 F2400
+G1 X46.057 Y68.043 E13.13200 F2400
+G1 X45.874 Y67.990 E13.13600 F2400
+G1 X45.659 Y67.933 E13.14000 F2400
+G1 X45.426 Y67.881 E13.14400 F2400
+G1 X45.311 Y67.859 E13.14800 F2400
+G1 X45.035 Y67.813 E13.15200 F2400
+G1 X44.835 Y67.786 E13.15600 F2400
+G1 X44.738 Y67.775 E13.16000 F2400
+G1 X44.587 Y67.760 E13.16400 F2400
+G1 X44.328 Y67.739 E13.16800 F2400
+G1 X44.219 Y67.732 E13.17200 F2400
+G1 X44.059 Y67.724 E13.17600 F2400
+G1 X43.824 Y67.713 E13.18000 F2400
+G1 X43.698 Y67.708 E13.18400 F2400
+G1 X43.451 Y67.699 E13.18800 F2400
+G1 X43.229 Y67.691 E13.19200 F2400
+G1 X43.072 Y67.685 E13.19600 F2400
+G1 X42.802 Y67.672 E13.20000 F2400
+G1 X42.684 Y67.665 E13.20400 F2400
+G1 X42.541 Y67.655 E13.20800 F2400
+G1 X42.280 Y67.633 E13.21200 F2400
+G1 X42.053 Y67.608 E13.21600 F2400
+G1 X41.906 Y67.589 E13.22000 F2400
+G1 X41.724 Y67.561 E13.22400 F2400
+G1 X41.450 Y67.511 E13.22800 F2400
+G1 X41.315 Y67.482 E13.23200 F2400
+G1 X41.202 Y67.456 E13.23600 F2400
+G1 X41.003 Y67.404 E13.24000 F2400
+G1 X40.865 Y67.364 E13.24400 F2400
+G1 X40.636 Y67.290 E13.24800 F2400
+G1 X40.493 Y67.238 E13.25200 F2400
+G1 X40.362 Y67.188 E13.25600 F2400
+G1 X40.154 Y67.100 E13.26000 F2400
+G1 X39.886 Y66.974 E13.26400 F2400
+G1 X39.697 Y66.876 E13.26800 F2400
+G1 X39.439 Y66.730 E13.27200 F2400
+G1 X39.181 Y66.573 E13.27600 F2400
+G1 X38.969 Y66.434 E13.28000 F2400
+G1 X38.789 Y66.312 E13.28400 F2400
+G1 X38.644 Y66.210 E13.28800 F2400
+G1 X38.549 Y66.142 E13.29200 F2400
+G1 X38.380 Y66.020 E13.29600 F2400
+G1 X38.270 Y65.939 E13.30000 F2400
+G1 X38.096 Y65.810 E13.30400 F2400
+G1 X37.944 Y65.697 E13.30800 F2400
+G1 X37.772 Y65.570 E13.31200 F2400
+G1 X37.597 Y65.440 E13.31600 F2400
+G1 X37.423 Y65.313 E13.32000 F2400
+G1 X37.188 Y65.143 E13.32400 F2400
+G1 X37.012 Y65.019 E13.32800 F2400
+G1 X36.909 Y64.947 E13.33200 F2400
+G1 X36.675 Y64.787 E13.33600 F2400
+G1 X36.463 Y64.644 E13.34000 F2400
+G1 X36.313 Y64.544 E13.34400 F2400
+G1 X36.150 Y64.436 E13.34800 F2400
+G1 X35.964 Y64.315 E13.35200 F2400
+G1 X35.808 Y64.212 E13.35600 F2400
+G1 X35.603 Y64.077 E13.36000 F2400
+G1 X35.340 Y63.901 E13.36400 F2400
+G1 X35.244 Y63.835 E13.36800 F2400
+G1 X34.998 Y63.662 E13.37200 F2400
+G1 X34.743 Y63.474 E13.37600 F2400
+G1 X34.515 Y63.296 E13.38000 F2400
+G1 X34.358 Y63.165 E13.38400 F2400
+G1 X34.173 Y63.002 E13.38800 F2400
+G1 X34.025 Y62.862 E13.39200 F2400
+G1 X33.895 Y62.731 E13.39600 F2400
+G1 X33.800 Y62.630 E13.40000 F2400
+G1 X33.702 Y62.520 E13.40400 F2400
+G1 X33.570 Y62.362 E13.40800 F2400
+G1 X33.469 Y62.232 E13.41200 F2400
+G1 X33.382 Y62.111 E13.41600 F2400
+G1 X33.252 Y61.917 E13.42000 F2400
+G1 X33.166 Y61.776 E13.42400 F2400
+G1 X33.031 Y61.529 E13.42800 F2400
+G1 X32.976 Y61.418 E13.43200 F2400
+G1 X32.912 Y61.277 E13.43600 F2400
+G1 X32.836 Y61.096 E13.44000 F2400
+G1 X32.782 Y60.953 E13.44400 F2400
+G1 X32.691 Y60.682 E13.44800 F2400
+G1 X32.632 Y60.476 E13.45200 F2400
+G1 X32.601 Y60.359 E13.45600 F2400
+G1 X32.566 Y60.210 E13.46000 F2400
+G1 X32.513 Y59.956 E13.46400 F2400
+G1 X32.481 Y59.782 E13.46800 F2400
+G1 X32.454 Y59.611 E13.47200 F2400
+G1 X32.431 Y59.457 E13.47600 F2400
+G1 X32.417 Y59.347 E13.48000 F2400
+G1 X32.384 Y59.075 E13.48400 F2400
+G1 X32.365 Y58.897 E13.48800 F2400
+G1 X32.350 Y58.737 E13.49200 F2400
+G1 X32.338 Y58.607 E13.49600 F2400
+G1 X32.319 Y58.392 E13.50000 F2400
+G1 X32.296 Y58.130 E13.50400 F2400
+G1 X32.269 Y57.827 E13.50800 F2400
+G1 X32.240 Y57.531 E13.51200 F2400
+G1 X32.228 Y57.425 E13.51600 F2400
+G1 X32.204 Y57.223 E13.52000 F2400
+G1 X32.178 Y57.025 E13.52400 F2400
+G1 X32.147 Y56.817 E13.52800 F2400
+G1 X32.117 Y56.635 E13.53200 F2400
+G1 X32.065 Y56.357 E13.53600 F2400
+G1 X32.021 Y56.148 E13.54000 F2400
+G1 X31.980 Y55.969 E13.54400 F2400
+G1 X31.911 Y55.693 E13.54800 F2400
+G1 X31.859 Y55.503 E13.55200 F2400
+G1 X31.832 Y55.408 E13.55600 F2400
+G1 X31.771 Y55.198 E13.56000 F2400
+G1 X31.689 Y54.926 E13.56400 F2400
+G1 X31.623 Y54.712 E13.56800 F2400
+G1 X31.583 Y54.582 E13.57200 F2400
+G1 X31.507 Y54.333 E13.57600 F2400
+G1 X31.477 Y54.233 E13.58000 F2400
+G1 X31.403 Y53.981 E13.58400 F2400
+G1 X31.370 Y53.862 E13.58800 F2400
+G1 X31.303 Y53.609 E13.59200 F2400
+G1 X31.272 Y53.480 E13.59600 F2400
+G1 X31.243 Y53.357 E13.60000 F2400
+G1 X31.212 Y53.214 E13.60400 F2400
+G1 X31.174 Y53.022 E13.60800 F2400
+G1 X31.136 Y52.793 E13.61200 F2400
+G1 X31.108 Y52.597 E13.61600 F2400
+G1 X31.095 Y52.486 E13.62000 F2400
+G1 X31.070 Y52.205 E13.62400 F2400
+G1 X31.055 Y51.944 E13.62800 F2400
+G1 X31.051 Y51.775 E13.63200 F2400
+G1 X31.050 Y51.670 E13.63600 F2400
+G1 X31.052 Y51.492 E13.64000 F2400
+G1 X31.063 Y51.207 E13.64400 F2400
+G1 X31.081 Y50.923 E13.64800 F2400
+G1 X31.092 Y50.793 E13.65200 F2400
+G1 X31.104 Y50.658 E13.65600 F2400
+G1 X31.134 Y50.371 E13.66000 F2400
+G1 X31.153 Y50.209 E13.66400 F2400
+G1 X31.180 Y49.979 E13.66800 F2400
+G1 X31.212 Y49.704 E13.67200 F2400
+G1 X31.241 Y49.450 E13.67600 F2400
+G1 X31.266 Y49.200 E13.68000 F2400
+G1 X31.283 Y48.987 E13.68400 F2400
+G1 X31.300 Y48.737 E13.68800 F2400
+G1 X31.306 Y48.596 E13.69200 F2400
+G1 X31.312 Y48.327 E13.69600 F2400
+G1 X31.312 Y48.189 E13.70000 F2400
+G1 X31.311 Y48.069 E13.70400 F2400
+G1 X31.302 Y47.822 E13.70800 F2400
+G1 X31.283 Y47.530 E13.71200 F2400
+G1 X31.260 Y47.281 E13.71600 F2400
+G1 X31.234 Y47.056 E13.72000 F2400
+G1 X31.219 Y46.938 E13.72400 F2400
+G1 X31.190 Y46.730 E13.72800 F2400
+G1 X31.169 Y46.591 E13.73200 F2400
+G1 X31.136 Y46.377 E13.73600 F2400
+G1 X31.105 Y46.189 E13.74000 F2400
+G1 X31.083 Y46.055 E13.74400 F2400
+G1 X31.047 Y45.836 E13.74800 F2400
+G1 X31.004 Y45.563 E13.75200 F2400
+G1 X30.966 Y45.303 E13.75600 F2400
+G1 X30.947 Y45.166 E13.76000 F2400
+G1 X30.909 Y44.857 E13.76400 F2400
+G1 X30.881 Y44.548 E13.76800 F2400
+G1 X30.868 Y44.362 E13.77200 F2400
+G1 X30.857 Y44.043 E13.77600 F2400
+G1 X30.857 Y43.894 E13.78000 F2400
+G1 X30.862 Y43.701 E13.78400 F2400
+G1 X30.881 Y43.415 E13.78800 F2400
+G1 X30.893 Y43.291 E13.79200 F2400
+G1 X30.918 Y43.103 E13.79600 F2400
+G1 X30.935 Y42.996 E13.80000 F2400
+G1 X30.962 Y42.848 E13.80400 F2400
+G1 X31.000 Y42.672 E13.80800 F2400
+G1 X31.072 Y42.402 E13.81200 F2400
+G1 X31.144 Y42.178 E13.81600 F2400
+G1 X31.187 Y42.061 E13.82000 F2400
+G1 X31.288 Y41.809 E13.82400 F2400
+G1 X31.399 Y41.571 E13.82800 F2400
+G1 X31.475 Y41.420 E13.83200 F2400
+G1 X31.542 Y41.297 E13.83600 F2400
+G1 X31.672 Y41.073 E13.84000 F2400
+G1 X31.834 Y40.819 E13.84400 F2400
+G1 X31.918 Y40.694 E13.84800 F2400
+G1 X32.017 Y40.551 E13.85200 F2400
+G1 X32.120 Y40.409 E13.85600 F2400
+G1 X32.304 Y40.164 E13.86000 F2400
+G1 X32.375 Y40.073 E13.86400 F2400
+G1 X32.442 Y39.987 E13.86800 F2400
+G1 X32.530 Y39.875 E13.87200 F2400
+G1 X32.656 Y39.719 E13.87600 F2400
+G1 X32.848 Y39.482 E13.88000 F2400
+G1 X32.918 Y39.395 E13.88400 F2400
+G1 X33.087 Y39.187 E13.88800 F2400
+G1 X33.220 Y39.022 E13.89200 F2400
+G1 X33.399 Y38.799 E13.89600 F2400
+G1 X33.584 Y38.562 E13.90000 F2400
+G1 X33.737 Y38.365 E13.90400 F2400
+G1 X33.830 Y38.243 E13.90800 F2400
+G1 X34.004 Y38.013 E13.91200 F2400
+G1 X34.067 Y37.930 E13.91600 F2400
+G1 X34.250 Y37.686 E13.92000 F2400
+G1 X34.361 Y37.536 E13.92400 F2400
+G1 X34.456 Y37.410 E13.92800 F2400
+G1 X34.627 Y37.184 E13.93200 F2400
+G1 X34.752 Y37.022 E13.93600 F2400
+G1 X34.864 Y36.879 E13.94000 F2400
+G1 X34.968 Y36.751 E13.94400 F2400
+G1 X35.088 Y36.606 E13.94800 F2400
+G1 X35.188 Y36.489 E13.95200 F2400
+G1 X35.327 Y36.333 E13.95600 F2400
+G1 X35.457 Y36.192 E13.96000 F2400
+G1 X35.567 Y36.080 E13.96400 F2400
+G1 X35.640 Y36.006 E13.96800 F2400
+G1 X35.737 Y35.914 E13.97200 F2400
+G1 X35.932 Y35.738 E13.97600 F2400
+G1 X36.123 Y35.579 E13.98000 F2400
+G1 X36.357 Y35.402 E13.98400 F2400
+G1 X36.466 Y35.325 E13.98800 F2400
+G1 X36.714 Y35.166 E13.99200 F2400
+G1 X36.964 Y35.022 E13.99600 F2400
+G1 X37.121 Y34.940 E14.00000 F2400
+G1 X37.396 Y34.810 E14.00400 F2400
+G1 X37.685 Y34.690 E14.00800 F2400
+G1 X37.951 Y34.592 E14.01200 F2400
+G1 X38.163 Y34.521 E14.01600 F2400
+G1 X38.441 Y34.437 E14.02000 F2400
+G1 X38.574 Y34.399 E14.02400 F2400
+G1 X38.703 Y34.364 E14.02800 F2400
+G1 X38.833 Y34.330 E14.03200 F2400
+G1 X39.077 Y34.268 E14.03600 F2400
+G1 X39.374 Y34.197 E14.04000 F2400
+G1 X39.514 Y34.163 E14.04400 F2400
+G1 X39.642 Y34.133 E14.04800 F2400
+G1 X39.918 Y34.066 E14.05200 F2400
+G1 X40.188 Y33.998 E14.05600 F2400
+G1 X40.309 Y33.966 E14.06000 F2400
+G1 X40.411 Y33.938 E14.06400 F2400
+G1 X40.559 Y33.896 E14.06800 F2400
+G1 X40.704 Y33.852 E14.07200 F2400
+G1 X40.798 Y33.822 E14.07600 F2400
+G1 X40.917 Y33.783 E14.08000 F2400
+G1 X41.159 Y33.696 E14.08400 F2400
+G1 X41.260 Y33.657 E14.08800 F2400
+G1 X41.428 Y33.588 E14.09200 F2400
+G1 X41.639 Y33.495 E14.09600 F2400
+G1 X41.846 Y33.394 E14.10000 F2400
+G1 X41.982 Y33.324 E14.10400 F2400
+G1 X42.087 Y33.266 E14.10800 F2400
+G1 X42.240 Y33.179 E14.11200 F2400
+G1 X42.381 Y33.096 E14.11600 F2400
+G1 X42.536 Y33.000 E14.12000 F2400
+G1 X42.664 Y32.918 E14.12400 F2400
+G1 X42.822 Y32.814 E14.12800 F2400
+G1 X43.060 Y32.653 E14.13200 F2400
+G1 X43.142 Y32.596 E14.13600 F2400
+G1 X43.260 Y32.515 E14.14000 F2400
+G1 X43.480 Y32.363 E14.14400 F2400
+G1 X43.644 Y32.251 E14.14800 F2400
+G1 X43.857 Y32.107 E14.15200 F2400
+G1 X43.953 Y32.044 E14.15600 F2400
+G1 X44.205 Y31.883 E14.16000 F2400
+G1 X44.291 Y31.831 E14.16400 F2400
+G1 X44.514 Y31.700 E14.16800 F2400
+G1 X44.644 Y31.627 E14.17200 F2400
+G1 X44.859 Y31.513 E14.17600 F2400
+G1 X45.094 Y31.399 E14.18000 F2400
+G1 X45.319 Y31.300 E14.18400 F2400
+G1 X45.589 Y31.193 E14.18800 F2400
+G1 X45.724 Y31.144 E14.19200 F2400
+G1 X45.980 Y31.061 E14.19600 F2400
+G1 X46.193 Y31.000 E14.20000 F2400
+G1 X46.325 Y30.966 E14.20400 F2400
+G1 X46.463 Y30.932 E14.20800 F2400
+G1 X46.578 Y30.907 E14.21200 F2400
+G1 X46.851 Y30.852 E14.21600 F2400
+G1 X47.013 Y30.823 E14.22000 F2400
+G1 X47.179 Y30.797 E14.22400 F2400
+G1 X47.301 Y30.778 E14.22800 F2400
+G1 X47.558 Y30.744 E14.23200 F2400
+G1 X47.766 Y30.718 E14.23600 F2400
+G1 X47.905 Y30.702 E14.24000 F2400
+G1 X48.161 Y30.673 E14.24400 F2400
+G1 X48.365 Y30.650 E14.24800 F2400
+G1 X48.621 Y30.621 E14.25200 F2400
+G1 X48.859 Y30.592 E14.25600 F2400
+G1 X49.043 Y30.568 E14.26000 F2400
+G1 X49.213 Y30.545 E14.26400 F2400
+G1 X49.489 Y30.504 E14.26800 F2400
+G1 X49.625 Y30.483 E14.27200 F2400
+G1 X49.745 Y30.463 E14.27600 F2400
+G1 X50.016 Y30.414 E14.28000 F2400
+G1 X50.255 Y30.368 E14.28400 F2400
+G1 X50.543 Y30.309 E14.28800 F2400
+G1 X50.769 Y30.260 E14.29200 F2400
+G1 X51.076 Y30.192 E14.29600 F2400
+G1 X51.268 Y30.149 E14.30000 F2400
+G1 X51.385 Y30.123 E14.30400 F2400
+G1 X51.628 Y30.069 E14.30800 F2400
+G1 X51.785 Y30.036 E14.31200 F2400
+G1 X51.973 Y29.997 E14.31600 F2400
+G1 X52.156 Y29.961 E14.32000 F2400
+G1 X52.331 Y29.929 E14.32400 F2400
+G1 X52.548 Y29.893 E14.32800 F2400
+G1 X52.782 Y29.859 E14.33200 F2400
+G1 X52.905 Y29.844 E14.33600 F2400
+G1 X53.203 Y29.815 E14.34000 F2400
+G1 X53.385 Y29.804 E14.34400 F2400
+G1 X53.649 Y29.796 E14.34800 F2400
+G1 X53.830 Y29.798 E14.35200 F2400
+G1 X53.962 Y29.803 E14.35600 F2400
+G1 X54.138 Y29.815 E14.36000 F2400
+G1 X54.291 Y29.830 E14.36400 F2400
+G1 X54.459 Y29.853 E14.36800 F2400
+G1 X54.702 Y29.896 E14.37200 F2400
+G1 X54.945 Y29.953 E14.37600 F2400
+G1 X55.086 Y29.992 E14.38000 F2400
+G1 X55.328 Y30.070 E14.38400 F2400
+G1 X55.549 Y30.155 E14.38800 F2400
+G1 X55.679 Y30.210 E14.39200 F2400
+G1 X55.887 Y30.308 E14.39600 F2400
+G1 X55.993 Y30.362 E14.40000 F2400
+G1 X56.210 Y30.482 E14.40400 F2400
+G1 X56.352 Y30.566 E14.40800 F2400
+G1 X56.549 Y30.693 E14.41200 F2400
+G1 X56.805 Y30.869 E14.41600 F2400
+G1 X57.014 Y31.025 E14.42000 F2400
+G1 X57.195 Y31.166 E14.42400 F2400
+G1 X57.374 Y31.312 E14.42800 F2400
+G1 X57.498 Y31.416 E14.43200 F2400
+G1 X57.657 Y31.551 E14.43600 F2400
+G1 X57.747 Y31.628 E14.44000 F2400
+G1 X57.908 Y31.768 E14.44400 F2400
+G1 X58.142 Y31.974 E14.44800 F2400
+G1 X58.301 Y32.113 E14.45200 F2400
+G1 X58.498 Y32.284 E14.45600 F2400
+G1 X58.719 Y32.472 E14.46000 F2400
+G1 X58.887 Y32.612 E14.46400 F2400
+G1 X58.987 Y32.694 E14.46800 F2400
+G1 X59.223 Y32.882 E14.47200 F2400
+G1 X59.383 Y33.006 E14.47600 F2400
+G1 X59.532 Y33.118 E14.48000 F2400
+G1 X59.622 Y33.185 E14.48400 F2400
+G1 X59.820 Y33.327 E14.48800 F2400
+G1 X60.038 Y33.481 E14.49200 F2400
+G1 X60.207 Y33.597 E14.49600 F2400
+G1 X60.319 Y33.673 E14.50000 F2400
+G1 X60.517 Y33.806 E14.50400 F2400
+G1 X60.630 Y33.882 E14.50800 F2400
+G1 X60.768 Y33.975 E14.51200 F2400
+G1 X60.889 Y34.057 E14.51600 F2400
+G1 X61.057 Y34.172 E14.52000 F2400
+G1 X61.243 Y34.302 E14.52400 F2400
+G1 X61.413 Y34.424 E14.52800 F2400
+G1 X61.518 Y34.502 E14.53200 F2400
+G1 X61.634 Y34.589 E14.53600 F2400
+G1 X61.746 Y34.676 E14.54000 F2400
+G1 X61.902 Y34.802 E14.54400 F2400
+G1 X62.121 Y34.990 E14.54800 F2400
+G1 X62.290 Y35.144 E14.55200 F2400
+G1 X62.481 Y35.333 E14.55600 F2400
+G1 X62.562 Y35.417 E14.56000 F2400
+G1 X62.633 Y35.493 E14.56400 F2400
+G1 X62.771 Y35.647 E14.56800 F2400
+G1 X62.864 Y35.758 E14.57200 F2400
+G1 X62.968 Y35.886 E14.57600 F2400
+G1 X63.117 Y36.081 E14.58000 F2400
+G1 X63.186 Y36.176 E14.58400 F2400
+G1 X63.342 Y36.402 E14.58800 F2400
+G1 X63.442 Y36.554 E14.59200 F2400
+G1 X63.558 Y36.738 E14.59600 F2400
+G1 X63.614 Y36.830 E14.60000 F2400
+G1 X63.671 Y36.926 E14.60400 F2400
+G1 X63.788 Y37.127 E14.60800 F2400
+G1 X63.841 Y37.220 E14.61200 F2400
+G1 X63.951 Y37.415 E14.61600 F2400
+G1 X64.029 Y37.555 E14.62000 F2400
+G1 X64.106 Y37.692 E14.62400 F2400
+G1 X64.245 Y37.939 E14.62800 F2400
+G1 X64.377 Y38.168 E14.63200 F2400
+G1 X64.456 Y38.301 E14.63600 F2400
+G1 X64.545 Y38.446 E14.64000 F2400
+G1 X64.626 Y38.574 E14.64400 F2400
+G1 X64.690 Y38.673 E14.64800 F2400
+G1 X64.847 Y38.900 E14.65200 F2400
+G1 X64.976 Y39.076 E14.65600 F2400
+G1 X65.118 Y39.258 E14.66000 F2400
+G1 X65.230 Y39.393 E14.66400 F2400
+G1 X65.319 Y39.496 E14.66800 F2400
+G1 X65.466 Y39.656 E14.67200 F2400
+G1 X65.565 Y39.760 E14.67600 F2400
+G1 X65.761 Y39.955 E14.68000 F2400
+G1 X65.969 Y40.151 E14.68400 F2400
+G1 X66.189 Y40.348 E14.68800 F2400
+G1 X66.298 Y40.444 E14.69200 F2400
+G1 X66.421 Y40.551 E14.69600 F2400
+G1 X66.636 Y40.733 E14.70000 F2400
+G1 X66.789 Y40.864 E14.70400 F2400
+G1 X66.958 Y41.009 E14.70800 F2400
+G1 X67.152 Y41.177 E14.71200 F2400
+G1 X67.265 Y41.277 E14.71600 F2400
+G1 X67.417 Y41.414 E14.72000 F2400
+G1 X67.508 Y41.499 E14.72400 F2400
+G1 X67.591 Y41.577 E14.72800 F2400
+G1 X67.813 Y41.797 E14.73200 F2400
+G1 X67.992 Y41.986 E14.73600 F2400
+G1 X68.150 Y42.164 E14.74000 F2400
+G1 X68.246 Y42.278 E14.74400 F2400
+G1 X68.351 Y42.409 E14.74800 F2400
+G1 X68.528 Y42.649 E14.75200 F2400
+G1 X68.700 Y42.909 E14.75600 F2400
+G1 X68.821 Y43.114 E14.76000 F2400
+G1 X68.959 Y43.375 E14.76400 F2400
+G1 X69.039 Y43.542 E14.76800 F2400
+G1 X69.147 Y43.797 E14.77200 F2400
+G1 X69.236 Y44.035 E14.77600 F2400
+G1 X69.283 Y44.176 E14.78000 F2400
+G1 X69.367 Y44.456 E14.78400 F2400
+G1 X69.395 Y44.558 E14.78800 F2400
+G1 X69.433 Y44.712 E14.79200 F2400
+G1 X69.479 Y44.912 E14.79600 F2400
+G1 X69.538 Y45.202 E14.80000 F2400
+G1 X69.569 Y45.375 E14.80400 F2400
+G1 X69.590 Y45.499 E14.80800 F2400
+G1 X69.630 Y45.747 E14.81200 F2400
+G1 X69.665 Y45.986 E14.81600 F2400
+G1 X69.682 Y46.112 E14.82000 F2400
+G1 X69.716 Y46.354 E14.82400 F2400
+G1 X69.740 Y46.535 E14.82800 F2400
+G1 X69.766 Y46.722 E14.83200 F2400
+G1 X69.807 Y47.014 E14.83600 F2400
+G1 X69.846 Y47.284 E14.84000 F2400
+G1 X69.892 Y47.584 E14.84400 F2400
+G1 X69.931 Y47.827 E14.84800 F2400
+G1 X69.960 Y48.007 E14.85200 F2400
+G1 X69.990 Y48.184 E14.85600 F2400
+G1 X70.013 Y48.315 E14.86000 F2400
+G1 X70.033 Y48.430 E14.86400 F2400
+G1 X70.069 Y48.636 E14.86800 F2400
+G1 X70.092 Y48.771 E14.87200 F2400
+G1 X70.130 Y48.992 E14.87600 F2400
+G1 X70.155 Y49.138 E14.88000 F2400
+G1 X70.188 Y49.344 E14.88400 F2400
+G1 X70.231 Y49.632 E14.88800 F2400
+G1 X70.258 Y49.832 E14.89200 F2400
+G1 Z0.900 F3000
+G0 X70.113 Y50.000 F6000
+G1 X70.112 Y50.161 E14.89600 F2400
+G1 X70.109 Y50.289 E14.90000 F2400
+G1 X70.102 Y50.531 E14.90400 F2400
+G1 X70.092 Y50.719 E14.90800 F2400
+G1 X70.075 Y50.953 E14.91200 F2400
+G1 X70.053 Y51.169 E14.91600 F2400
+G1 X70.029 Y51.356 E14.92000 F2400
+G1 X70.003 Y51.528 E14.92400 F2400
+G1 X69.978 Y51.670 E14.92800 F2400
+G1 X69.916 Y51.965 E14.93200 F2400
+G1 X69.883 Y52.103 E14.93600 F2400
+G1 X69.831 Y52.290 E14.94000 F2400
+G1 X69.748 Y52.559 E14.94400 F2400
+G1 X69.658 Y52.811 E14.94800 F2400
+G1 X69.545 Y53.092 E14.95200 F2400
+G1 X69.452 Y53.301 E14.95600 F2400
+G1 X69.384 Y53.446 E14.96000 F2400
+G1 X69.259 Y53.697 E14.96400 F2400
+G1 X69.205 Y53.799 E14.96800 F2400
+G1 X69.064 Y54.058 E14.97200 F2400
+G1 X68.969 Y54.226 E14.97600 F2400
+G1 X68.848 Y54.433 E14.98000 F2400
+G1 X68.705 Y54.676 E14.98400 F2400
+G1 X68.600 Y54.852 E14.98800 F2400
+G1 X68.467 Y55.078 E14.99200 F2400
+G1 X68.335 Y55.307 E14.99600 F2400
+G1 X68.238 Y55.479 E15.00000 F2400
+G1 X68.109 Y55.720 E15.00400 F2400
+G1 X68.043 Y55.848 E15.00800 F2400
+G1 X67.988 Y55.961 E15.01200 F2400
+G1 X67.890 Y56.169 E15.01600 F2400
+G1 X67.791 Y56.400 E15.02000 F2400
+G1 X67.728 Y56.561 E15.02400 F2400
+G1 X67.693 Y56.654 E15.02800 F2400
+G1 X67.635 Y56.820 E15.03200 F2400
+G1 X67.593 Y56.951 E15.03600 F2400
+G1 X67.561 Y57.055 E15.04000 F2400
+G1 X67.526 Y57.177 E15.04400 F2400
+G1 X67.472 Y57.380 E15.04800 F2400
+G1 X67.432 Y57.545 E15.05200 F2400
+G1 X67.379 Y57.791 E15.05600 F2400
+G1 X67.351 Y57.929 E15.06000 F2400
+G1 X67.312 Y58.143 E15.06400 F2400
+G1 X67.286 Y58.294 E15.06800 F2400
+G1 X67.260 Y58.448 E15.07200 F2400
+G1 X67.239 Y58.577 E15.07600 F2400
+G1 X67.199 Y58.826 E15.08000 F2400
+G1 X67.174 Y58.983 E15.08400 F2400
+G1 X67.135 Y59.220 E15.08800 F2400
+G1 X67.093 Y59.461 E15.09200 F2400
+G1 X67.053 Y59.675 E15.09600 F2400
+G1 X67.005 Y59.911 E15.10000 F2400
+G1 X66.952 Y60.150 E15.10400 F2400
+G1 X66.922 Y60.270 E15.10800 F2400
+G1 X66.854 Y60.524 E15.11200 F2400
+G1 X66.793 Y60.726 E15.11600 F2400
+G1 X66.707 Y60.983 E15.12000 F2400
+G1 X66.664 Y61.101 E15.12400 F2400
+G1 X66.622 Y61.207 E15.12800 F2400
+G1 X66.531 Y61.424 E15.13200 F2400
+G1 X66.463 Y61.574 E15.13600 F2400
+G1 X66.327 Y61.844 E15.14000 F2400
+G1 X66.248 Y61.988 E15.14400 F2400
+G1 X66.150 Y62.155 E15.14800 F2400
+G1 X66.059 Y62.300 E15.15200 F2400
+G1 X65.940 Y62.479 E15.15600 F2400
+G1 X65.857 Y62.597 E15.16000 F2400
+G1 X65.680 Y62.834 E15.16400 F2400
+G1 X65.583 Y62.958 E15.16800 F2400
+G1 X65.399 Y63.179 E15.17200 F2400
+G1 X65.201 Y63.406 E15.17600 F2400
+G1 X65.088 Y63.532 E15.18000 F2400
+G1 X64.907 Y63.728 E15.18400 F2400
+G1 X64.712 Y63.934 E15.18800 F2400
+G1 X64.637 Y64.013 E15.19200 F2400
+G1 X64.431 Y64.228 E15.19600 F2400
+G1 X64.307 Y64.357 E15.20000 F2400
+G1 X64.190 Y64.480 E15.20400 F2400
+G1 X64.008 Y64.672 E15.20800 F2400
+G1 X63.915 Y64.771 E15.21200 F2400
+G1 X63.842 Y64.850 E15.21600 F2400
+G1 X63.639 Y65.070 E15.22000 F2400
+G1 X63.568 Y65.148 E15.22400 F2400
+G1 X63.413 Y65.322 E15.22800 F2400
+G1 X63.267 Y65.487 E15.23200 F2400
+G1 X63.142 Y65.629 E15.23600 F2400
+G1 X62.962 Y65.837 E15.24000 F2400
+G1 X62.783 Y66.045 E15.24400 F2400
+G1 X62.711 Y66.128 E15.24800 F2400
+G1 X62.558 Y66.305 E15.25200 F2400
+G1 X62.370 Y66.520 E15.25600 F2400
+G1 X62.245 Y66.660 E15.26000 F2400
+G1 X62.156 Y66.757 E15.26400 F2400
+G1 X62.002 Y66.924 E15.26800 F2400
+G1 X61.927 Y67.004 E15.27200 F2400
+G1 X61.796 Y67.138 E15.27600 F2400
+G1 X61.646 Y67.287 E15.28000 F2400
+G1 X61.536 Y67.391 E15.28400 F2400
+G1 X61.366 Y67.545 E15.28800 F2400
+G1 X61.152 Y67.727 E15.29200 F2400
+G1 X60.991 Y67.853 E15.29600 F2400
+G1 X60.814 Y67.983 E15.30000 F2400
+G1 X60.695 Y68.065 E15.30400 F2400
+G1 X60.605 Y68.123 E15.30800 F2400
+G1 X60.431 Y68.230 E15.31200 F2400
+G1 X60.294 Y68.308 E15.31600 F2400
+G1 X60.083 Y68.417 E15.32000 F2400
+G1 X59.969 Y68.470 E15.32400 F2400
+G1 X59.784 Y68.550 E15.32800 F2400
+G1 X59.584 Y68.626 E15.33200 F2400
+G1 X59.326 Y68.712 E15.33600 F2400
+G1 X59.214 Y68.744 E15.34000 F2400
+G1 X58.926 Y68.815 E15.34400 F2400
+G1 X58.789 Y68.844 E15.34800 F2400
+G1 X58.489 Y68.895 E15.35200 F2400
+G1 X58.208 Y68.931 E15.35600 F2400
+G1 X57.908 Y68.956 E15.36000 F2400
+G1 X57.599 Y68.972 E15.36400 F2400
+G1 X57.473 Y68.976 E15.36800 F2400
+G1 X57.286 Y68.979 E15.37200 F2400
+G1 X57.049 Y68.980 E15.37600 F2400
+G1 X56.869 Y68.978 E15.38000 F2400
+G1 X56.620 Y68.973 E15.38400 F2400
+G1 X56.327 Y68.966 E15.38800 F2400
+G1 X56.177 Y68.961 E15.39200 F2400
+G1 X56.005 Y68.956 E15.39600 F2400
+G1 X55.718 Y68.949 E15.40000 F2400
+G1 X55.546 Y68.947 E15.40400 F2400
+G1 X55.426 Y68.945 E15.40800 F2400
+G1 X55.171 Y68.945 E15.41200 F2400
+G1 X55.011 Y68.947 E15.41600 F2400
+G1 X54.793 Y68.953 E15.42000 F2400
+G1 X54.680 Y68.957 E15.42400 F2400
+G1 X54.469 Y68.968 E15.42800 F2400
+G1 X54.211 Y68.987 E15.43200 F2400
+G1 X54.027 Y69.004 E15.43600 F2400
+G1 X53.859 Y69.023 E15.44000 F2400
+G1 X53.615 Y69.054 E15.44400 F2400
+G1 X53.418 Y69.082 E15.44800 F2400
+G1 X53.231 Y69.112 E15.45200 F2400
+G1 X53.102 Y69.133 E15.45600 F2400
+G1 X52.877 Y69.172 E15.46000 F2400
+G1 X52.623 Y69.219 E15.46400 F2400
+G1 X52.528 Y69.236 E15.46800 F2400
+G1 X52.373 Y69.265 E15.47200 F2400
+G1 X52.153 Y69.305 E15.47600 F2400
+G1 X52.028 Y69.327 E15.48000 F2400
+G1 X51.767 Y69.371 E15.48400 F2400
+G1 X51.645 Y69.391 E15.48800 F2400
+G1 X51.501 Y69.412 E15.49200 F2400
+G1 X51.316 Y69.437 E15.49600 F2400
+G1 X51.192 Y69.452 E15.50000 F2400
+G1 X50.920 Y69.480 E15.50400 F2400
+G1 X50.724 Y69.495 E15.50800 F2400
+G1 X50.550 Y69.504 E15.51200 F2400
+G1 X50.334 Y69.510 E15.51600 F2400
+G1 X50.090 Y69.510 E15.52000 F2400
+G1 X49.887 Y69.504 E15.52400 F2400
+G1 X49.663 Y69.491 E15.52800 F2400
+G1 X49.433 Y69.471 E15.53200 F2400
+G1 X49.252 Y69.450 E15.53600 F2400
+G1 X49.101 Y69.430 E15.54000 F2400
+G1 X48.980 Y69.412 E15.54400 F2400
+G1 X48.756 Y69.375 E15.54800 F2400
+G1 X48.587 Y69.343 E15.55200 F2400
+G1 X48.309 Y69.287 E15.55600 F2400
+G1 X48.162 Y69.255 E15.56000 F2400
+G1 X47.918 Y69.200 E15.56400 F2400
+G1 X47.740 Y69.159 E15.56800 F2400
+G1 X47.616 Y69.130 E15.57200 F2400
+G1 X47.448 Y69.090 E15.57600 F2400
+G1 X47.236 Y69.041 E15.58000 F2400
+G1 X47.015 Y68.992 E15.58400 F2400
+G1 X46.856 Y68.958 E15.58800 F2400
+G1 X46.719 Y68.930 E15.59200 F2400
+G1 X46.595 Y68.907 E15.59600 F2400
+G1 X46.388 Y68.870 E15.60000 F2400
+G1 X46.164 Y68.834 E15.60400 F2400
+G1 X45.896 Y68.799 E15.60800 F2400
+G1 X45.706 Y68.778 E15.61200 F2400
+G1 X45.545 Y68.764 E15.61600 F2400
+G1 X45.291 Y68.747 E15.62000 F2400
+G1 X45.066 Y68.738 E15.62400 F2400
+G1 X44.821 Y68.732 E15.62800 F2400
+G1 X44.708 Y68.732 E15.63200 F2400
+G1 X44.439 Y68.733 E15.63600 F2400
+G1 X44.255 Y68.736 E15.64000 F2400
+G1 X44.012 Y68.743 E15.64400 F2400
+G1 X43.892 Y68.747 E15.64800 F2400
+G1 X43.787 Y68.750 E15.65200 F2400
+G1 X43.675 Y68.754 E15.65600 F2400
+G1 X43.554 Y68.758 E15.66000 F2400
+G1 X43.429 Y68.762 E15.66400 F2400
+G1 X43.138 Y68.770 E15.66800 F2400
+G1 X42.912 Y68.775 E15.67200 F2400
+G1 X42.791 Y68.776 E15.67600 F2400
+G1 X42.467 Y68.774 E15.68000 F2400
+G1 X42.265 Y68.769 E15.68400 F2400
+G1 X42.010 Y68.756 E15.68800 F2400
+G1 X41.760 Y68.737 E15.69200 F2400
+G1 X41.576 Y68.717 E15.69600 F2400
+G1 X41.295 Y68.677 E15.70000 F2400
+G1 X40.987 Y68.619 E15.70400 F2400
+G1 X40.799 Y68.575 E15.70800 F2400
+G1 X40.624 Y68.528 E15.71200 F2400
+G1 X40.438 Y68.471 E15.71600 F2400
+G1 X40.174 Y68.378 E15.72000 F2400
+G1 X39.979 Y68.298 E15.72400 F2400
+G1 X39.865 Y68.246 E15.72800 F2400
+G1 X39.768 Y68.200 E15.73200 F2400
+G1 X39.552 Y68.089 E15.73600 F2400
+G1 X39.434 Y68.023 E15.74000 F2400
+G1 X39.208 Y67.885 E15.74400 F2400
+G1 X39.017 Y67.757 E15.74800 F2400
+G1 X38.896 Y67.671 E15.75200 F2400
+G1 X38.801 Y67.600 E15.75600 F2400
+G1 X38.608 Y67.449 E15.76000 F2400
+G1 X38.502 Y67.361 E15.76400 F2400
+G1 X38.267 Y67.157 E15.76800 F2400
+G1 X38.111 Y67.013 E15.77200 F2400
+G1 X37.985 Y66.894 E15.77600 F2400
+G1 X37.790 Y66.703 E15.78000 F2400
+G1 X37.625 Y66.537 E15.78400 F2400
+G1 X37.456 Y66.364 E15.78800 F2400
+G1 X37.270 Y66.171 E15.79200 F2400
+G1 X37.133 Y66.028 E15.79600 F2400
+G1 X37.055 Y65.947 E15.80000 F2400
+G1 X36.961 Y65.848 E15.80400 F2400
+G1 X36.747 Y65.627 E15.80800 F2400
+G1 X36.586 Y65.461 E15.81200 F2400
+G1 X36.511 Y65.385 E15.81600 F2400
+G1 X36.417 Y65.290 E15.82000 F2400
+G1 X36.330 Y65.202 E15.82400 F2400
+G1 X36.220 Y65.093 E15.82800 F2400
+G1 X36.052 Y64.927 E15.83200 F2400
+G1 X35.843 Y64.723 E15.83600 F2400
+G1 X35.686 Y64.571 E15.84000 F2400
+G1 X35.539 Y64.429 E15.84400 F2400
+G1 X35.331 Y64.227 E15.84800 F2400
+G1 X35.238 Y64.137 E15.85200 F2400
+G1 X35.034 Y63.936 E15.85600 F2400
+G1 X34.870 Y63.770 E15.86000 F2400
+G1 X34.765 Y63.662 E15.86400 F2400
+G1 X34.586 Y63.473 E15.86800 F2400
+G1 X34.493 Y63.371 E15.87200 F2400
+G1 X34.345 Y63.203 E15.87600 F2400
+G1 X34.219 Y63.053 E15.88000 F2400
+G1 X34.141 Y62.956 E15.88400 F2400
+G1 X33.962 Y62.722 E15.88800 F2400
+G1 X33.879 Y62.606 E15.89200 F2400
+G1 X33.779 Y62.460 E15.89600 F2400
+G1 X33.654 Y62.263 E15.90000 F2400
+G1 X33.574 Y62.127 E15.90400 F2400
+G1 X33.514 Y62.020 E15.90800 F2400
+G1 X33.437 Y61.874 E15.91200 F2400
+G1 X33.357 Y61.712 E15.91600 F2400
+G1 X33.247 Y61.465 E15.92000 F2400
+G1 X33.167 Y61.263 E15.92400 F2400
+G1 X33.069 Y60.983 E15.92800 F2400
+G1 X33.029 Y60.856 E15.93200 F2400
+G1 X32.953 Y60.588 E15.93600 F2400
+G1 X32.880 Y60.284 E15.94000 F2400
+G1 X32.818 Y59.978 E15.94400 F2400
+G1 X32.788 Y59.812 E15.94800 F2400
+G1 X32.767 Y59.688 E15.95200 F2400
+G1 X32.727 Y59.425 E15.95600 F2400
+G1 X32.700 Y59.230 E15.96000 F2400
+G1 X32.669 Y58.994 E15.96400 F2400
+G1 X32.653 Y58.871 E15.96800 F2400
+G1 X32.616 Y58.571 E15.97200 F2400
+G1 X32.593 Y58.389 E15.97600 F2400
+G1 X32.554 Y58.095 E15.98000 F2400
+G1 X32.539 Y57.995 E15.98400 F2400
+G1 X32.516 Y57.838 E15.98800 F2400
+G1 X32.485 Y57.649 E15.99200 F2400
+G1 X32.454 Y57.481 E15.99600 F2400
+G1 X32.427 Y57.346 E16.00000 F2400
+G1 X32.365 Y57.067 E16.00400 F2400
+G1 X32.316 Y56.873 E16.00800 F2400
+G1 X32.240 Y56.610 E16.01200 F2400
+G1 X32.181 Y56.426 E16.01600 F2400
+G1 X32.098 Y56.197 E16.02000 F2400
+G1 X32.019 Y55.995 E16.02400 F2400
+G1 X31.973 Y55.883 E16.02800 F2400
+G1 X31.880 Y55.674 E16.03200 F2400
+G1 X31.779 Y55.457 E16.03600 F2400
+G1 X31.675 Y55.246 E16.04000 F2400
+G1 X31.588 Y55.074 E16.04400 F2400
+G1 X31.538 Y54.979 E16.04800 F2400
+G1 X31.417 Y54.748 E16.05200 F2400
+G1 X31.282 Y54.490 E16.05600 F2400
+G1 X31.229 Y54.391 E16.06000 F2400
+G1 X31.179 Y54.295 E16.06400 F2400
+G1 X31.094 Y54.129 E16.06800 F2400
+G1 X30.983 Y53.908 E16.07200 F2400
+G1 X30.901 Y53.736 E16.07600 F2400
+G1 X30.790 Y53.495 E16.08000 F2400
+G1 X30.682 Y53.240 E16.08400 F2400
+G1 X30.601 Y53.036 E16.08800 F2400
+G1 X30.525 Y52.825 E16.09200 F2400
+G1 X30.453 Y52.608 E16.09600 F2400
+G1 X30.403 Y52.441 E16.10000 F2400
+G1 X30.366 Y52.305 E16.10400 F2400
+G1 X30.300 Y52.032 E16.10800 F2400
+G1 X30.269 Y51.884 E16.11200 F2400
+G1 X30.223 Y51.624 E16.11600 F2400
+G1 X30.194 Y51.423 E16.12000 F2400
+G1 X30.165 Y51.178 E16.12400 F2400
+G1 X30.143 Y50.923 E16.12800 F2400
+G1 X30.127 Y50.649 E16.13200 F2400
+G1 X30.118 Y50.383 E16.13600 F2400
+G1 X30.115 Y50.218 E16.14000 F2400
+G1 X30.113 Y49.953 E16.14400 F2400
+G1 X30.114 Y49.681 E16.14800 F2400
+G1 X30.116 Y49.453 E16.15200 F2400
+G1 X30.117 Y49.314 E16.15600 F2400
+G1 X30.120 Y49.019 E16.16000 F2400
+G1 X30.121 Y48.760 E16.16400 F2400
+G1 X30.120 Y48.583 E16.16800 F2400
+G1 X30.118 Y48.423 E16.17200 F2400
+G1 X30.113 Y48.159 E16.17600 F2400
+G1 X30.105 Y47.925 E16.18000 F2400
+G1 X30.098 Y47.748 E16.18400 F2400
+G1 X30.082 Y47.462 E16.18800 F2400
+G1 X30.061 Y47.157 E16.19200 F2400
+G1 X30.042 Y46.914 E16.19600 F2400
+G1 X30.019 Y46.637 E16.20000 F2400
+G1 X29.998 Y46.408 E16.20400 F2400
+G1 X29.983 Y46.239 E16.20800 F2400
+G1 X29.959 Y45.964 E16.21200 F2400
+G1 X29.939 Y45.709 E16.21600 F2400
+G1 X29.918 Y45.413 E16.22000 F2400
+G1 X29.909 Y45.232 E16.22400 F2400
+G1 X29.898 Y44.922 E16.22800 F2400
+G1 X29.895 Y44.666 E16.23200 F2400
+G1 X29.901 Y44.397 E16.23600 F2400
+G1 X29.917 Y44.110 E16.24000 F2400
+G1 X29.936 Y43.907 E16.24400 F2400
+G1 X29.974 Y43.624 E16.24800 F2400
+G1 X30.028 Y43.334 E16.25200 F2400
+G1 X30.102 Y43.032 E16.25600 F2400
+G1 X30.169 Y42.810 E16.26000 F2400
+G1 X30.207 Y42.697 E16.26400 F2400
+G1 X30.262 Y42.551 E16.26800 F2400
+G1 X30.318 Y42.415 E16.27200 F2400
+G1 X30.373 Y42.291 E16.27600 F2400
+G1 X30.454 Y42.124 E16.28000 F2400
+G1 X30.563 Y41.921 E16.28400 F2400
+G1 X30.727 Y41.651 E16.28800 F2400
+G1 X30.796 Y41.547 E16.29200 F2400
+G1 X30.978 Y41.294 E16.29600 F2400
+G1 X31.116 Y41.117 E16.30000 F2400
+G1 X31.297 Y40.903 E16.30400 F2400
+G1 X31.490 Y40.691 E16.30800 F2400
+G1 X31.617 Y40.558 E16.31200 F2400
+G1 X31.800 Y40.373 E16.31600 F2400
+G1 X31.994 Y40.187 E16.32000 F2400
+G1 X32.124 Y40.065 E16.32400 F2400
+G1 X32.349 Y39.858 E16.32800 F2400
+G1 X32.567 Y39.661 E16.33200 F2400
+G1 X32.648 Y39.588 E16.33600 F2400
+G1 X32.860 Y39.397 E16.34000 F2400
+G1 X32.998 Y39.273 E16.34400 F2400
+G1 X33.220 Y39.068 E16.34800 F2400
+G1 X33.305 Y38.990 E16.35200 F2400
+G1 X33.504 Y38.800 E16.35600 F2400
+G1 X33.651 Y38.657 E16.36000 F2400
+G1 X33.762 Y38.546 E16.36400 F2400
+G1 X33.902 Y38.404 E16.36800 F2400
+G1 X34.087 Y38.212 E16.37200 F2400
+G1 X34.213 Y38.076 E16.37600 F2400
+G1 X34.341 Y37.936 E16.38000 F2400
+G1 X34.523 Y37.732 E16.38400 F2400
+G1 X34.697 Y37.532 E16.38800 F2400
+G1 X34.790 Y37.425 E16.39200 F2400
+G1 X34.921 Y37.273 E16.39600 F2400
+G1 X35.037 Y37.139 E16.40000 F2400
+G1 X35.126 Y37.035 E16.40400 F2400
+G1 X35.217 Y36.931 E16.40800 F2400
+G1 X35.296 Y36.840 E16.41200 F2400
+G1 X35.384 Y36.742 E16.41600 F2400
+G1 X35.505 Y36.607 E16.42000 F2400
+G1 X35.606 Y36.497 E16.42400 F2400
+G1 X35.772 Y36.322 E16.42800 F2400
+G1 X35.854 Y36.238 E16.43200 F2400
+G1 X35.957 Y36.135 E16.43600 F2400
+G1 X36.166 Y35.936 E16.44000 F2400
+G1 X36.324 Y35.795 E16.44400 F2400
+G1 X36.426 Y35.707 E16.44800 F2400
+G1 X36.628 Y35.542 E16.45200 F2400
+G1 X36.709 Y35.480 E16.45600 F2400
+G1 X36.837 Y35.385 E16.46000 F2400
+G1 X36.940 Y35.311 E16.46400 F2400
+G1 X37.089 Y35.209 E16.46800 F2400
+G1 X37.250 Y35.106 E16.47200 F2400
+G1 X37.490 Y34.961 E16.47600 F2400
+G1 X37.663 Y34.864 E16.48000 F2400
+G1 X37.908 Y34.734 E16.48400 F2400
+G1 X38.168 Y34.606 E16.48800 F2400
+G1 X38.266 Y34.560 E16.49200 F2400
+G1 X38.375 Y34.510 E16.49600 F2400
+G1 X38.612 Y34.404 E16.50000 F2400
+G1 X38.756 Y34.342 E16.50400 F2400
+G1 X38.931 Y34.267 E16.50800 F2400
+G1 X39.140 Y34.179 E16.51200 F2400
+G1 X39.307 Y34.108 E16.51600 F2400
+G1 X39.551 Y34.003 E16.52000 F2400
+G1 X39.644 Y33.963 E16.52400 F2400
+G1 X39.779 Y33.903 E16.52800 F2400
+G1 X39.877 Y33.858 E16.53200 F2400
+G1 X40.009 Y33.797 E16.53600 F2400
+G1 X40.264 Y33.672 E16.54000 F2400
+G1 X40.354 Y33.626 E16.54400 F2400
+G1 X40.529 Y33.532 E16.54800 F2400
+G1 X40.648 Y33.465 E16.55200 F2400
+G1 X40.851 Y33.345 E16.55600 F2400
+G1 X40.958 Y33.278 E16.56000 F2400
+G1 X41.156 Y33.147 E16.56400 F2400
+G1 X41.317 Y33.035 E16.56800 F2400
+G1 X41.544 Y32.865 E16.57200 F2400
+G1 X41.633 Y32.796 E16.57600 F2400
+G1 X41.790 Y32.669 E16.58000 F2400
+G1 X42.005 Y32.488 E16.58400 F2400
+G1 X42.160 Y32.353 E16.58800 F2400
+G1 X42.300 Y32.228 E16.59200 F2400
+G1 X42.517 Y32.031 E16.59600 F2400
+G1 X42.721 Y31.845 E16.60000 F2400
+G1 X42.920 Y31.664 E16.60400 F2400
+G1 X43.062 Y31.536 E16.60800 F2400
+G1 X43.193 Y31.420 E16.61200 F2400
+G1 X43.319 Y31.311 E16.61600 F2400
+G1 X43.559 Y31.110 E16.62000 F2400
+G1 X43.655 Y31.032 E16.62400 F2400
+G1 X43.761 Y30.949 E16.62800 F2400
+G1 X43.953 Y30.803 E16.63200 F2400
+G1 X44.193 Y30.634 E16.63600 F2400
+G1 X44.456 Y30.465 E16.64000 F2400
+G1 X44.657 Y30.346 E16.64400 F2400
+G1 X44.909 Y30.212 E16.64800 F2400
+G1 X45.071 Y30.133 E16.65200 F2400
+G1 X45.264 Y30.047 E16.65600 F2400
+G1 X45.509 Y29.951 E16.66000 F2400
+G1 X45.641 Y29.904 E16.66400 F2400
+G1 X45.878 Y29.830 E16.66800 F2400
+G1 X46.062 Y29.779 E16.67200 F2400
+G1 X46.171 Y29.752 E16.67600 F2400
+G1 X46.344 Y29.713 E16.68000 F2400
+G1 X46.595 Y29.666 E16.68400 F2400
+G1 X46.860 Y29.626 E16.68800 F2400
+G1 X47.102 Y29.597 E16.69200 F2400
+G1 X47.354 Y29.574 E16.69600 F2400
+G1 X47.533 Y29.562 E16.70000 F2400
+G1 X47.699 Y29.552 E16.70400 F2400
+G1 X47.885 Y29.544 E16.70800 F2400
+G1 X48.078 Y29.538 E16.71200 F2400
+G1 X48.248 Y29.534 E16.71600 F2400
+G1 X48.533 Y29.530 E16.72000 F2400
+G1 X48.779 Y29.527 E16.72400 F2400
+G1 X48.913 Y29.526 E16.72800 F2400
+G1 X49.043 Y29.524 E16.73200 F2400
+G1 X49.244 Y29.522 E16.73600 F2400
+G1 X49.477 Y29.519 E16.74000 F2400
+G1 X49.721 Y29.515 E16.74400 F2400
+G1 X49.911 Y29.510 E16.74800 F2400
+G1 X50.132 Y29.504 E16.75200 F2400
+G1 X50.359 Y29.497 E16.75600 F2400
+G1 X50.522 Y29.490 E16.76000 F2400
+G1 X50.790 Y29.479 E16.76400 F2400
+G1 X50.964 Y29.472 E16.76800 F2400
+G1 X51.094 Y29.466 E16.77200 F2400
+G1 X51.227 Y29.461 E16.77600 F2400
+G1 X51.465 Y29.451 E16.78000 F2400
+G1 X51.667 Y29.444 E16.78400 F2400
+G1 X51.946 Y29.436 E16.78800 F2400
+G1 X52.233 Y29.433 E16.79200 F2400
+G1 X52.385 Y29.434 E16.79600 F2400
+G1 X52.652 Y29.439 E16.80000 F2400
+G1 X52.898 Y29.451 E16.80400 F2400
+G1 X53.118 Y29.467 E16.80800 F2400
+G1 X53.428 Y29.501 E16.81200 F2400
+G1 X53.565 Y29.520 E16.81600 F2400
+G1 X53.754 Y29.552 E16.82000 F2400
+G1 X53.939 Y29.590 E16.82400 F2400
+G1 X54.095 Y29.626 E16.82800 F2400
+G1 X54.320 Y29.687 E16.83200 F2400
+G1 X54.589 Y29.773 E16.83600 F2400
+G1 X54.781 Y29.844 E16.84000 F2400
+G1 X54.893 Y29.890 E16.84400 F2400
+G1 X55.040 Y29.955 E16.84800 F2400
+G1 X55.271 Y30.066 E16.85200 F2400
+G1 X55.450 Y30.162 E16.85600 F2400
+G1 X55.551 Y30.219 E16.86000 F2400
+G1 X55.688 Y30.302 E16.86400 F2400
+G1 X55.873 Y30.420 E16.86800 F2400
+G1 X56.018 Y30.520 E16.87200 F2400
+G1 X56.141 Y30.608 E16.87600 F2400
+G1 X56.293 Y30.721 E16.88000 F2400
+G1 X56.396 Y30.802 E16.88400 F2400
+G1 X56.628 Y30.991 E16.88800 F2400
+G1 X56.762 Y31.106 E16.89200 F2400
+G1 X56.919 Y31.243 E16.89600 F2400
+G1 X57.081 Y31.390 E16.90000 F2400
+G1 X57.230 Y31.528 E16.90400 F2400
+G1 X57.451 Y31.734 E16.90800 F2400
+G1 X57.551 Y31.829 E16.91200 F2400
+G1 X57.703 Y31.971 E16.91600 F2400
+G1 X57.802 Y32.065 E16.92000 F2400
+G1 X57.887 Y32.144 E16.92400 F2400
+G1 X58.070 Y32.311 E16.92800 F2400
+G1 X58.196 Y32.425 E16.93200 F2400
+G1 X58.384 Y32.589 E16.93600 F2400
+G1 X58.534 Y32.716 E16.94000 F2400
+G1 X58.616 Y32.783 E16.94400 F2400
+G1 X58.705 Y32.854 E16.94800 F2400
+G1 X58.786 Y32.918 E16.95200 F2400
+G1 X58.953 Y33.044 E16.95600 F2400
+G1 X59.095 Y33.146 E16.96000 F2400
+G1 X59.220 Y33.233 E16.96400 F2400
+G1 X59.348 Y33.318 E16.96800 F2400
+G1 X59.499 Y33.414 E16.97200 F2400
+G1 X59.722 Y33.549 E16.97600 F2400
+G1 X59.953 Y33.681 E16.98000 F2400
+G1 X60.176 Y33.801 E16.98400 F2400
+G1 X60.389 Y33.911 E16.98800 F2400
+G1 X60.496 Y33.965 E16.99200 F2400
+G1 X60.646 Y34.040 E16.99600 F2400
+G1 X60.876 Y34.153 E17.00000 F2400
+G1 X60.999 Y34.214 E17.00400 F2400
+G1 X61.213 Y34.320 E17.00800 F2400
+G1 X61.319 Y34.373 E17.01200 F2400
+G1 X61.549 Y34.490 E17.01600 F2400
+G1 X61.680 Y34.559 E17.02000 F2400
+G1 X61.811 Y34.629 E17.02400 F2400
+G1 X62.062 Y34.770 E17.02800 F2400
+G1 X62.165 Y34.831 E17.03200 F2400
+G1 X62.399 Y34.975 E17.03600 F2400
+G1 X62.530 Y35.060 E17.04000 F2400
+G1 X62.656 Y35.146 E17.04400 F2400
+G1 X62.759 Y35.219 E17.04800 F2400
+G1 X62.848 Y35.283 E17.05200 F2400
+G1 X62.985 Y35.387 E17.05600 F2400
+G1 X63.130 Y35.503 E17.06000 F2400
+G1 X63.252 Y35.605 E17.06400 F2400
+G1 X63.327 Y35.670 E17.06800 F2400
+G1 X63.529 Y35.853 E17.07200 F2400
+G1 X63.717 Y36.036 E17.07600 F2400
+G1 X63.872 Y36.194 E17.08000 F2400
+G1 X63.957 Y36.284 E17.08400 F2400
+G1 X64.043 Y36.378 E17.08800 F2400
+G1 X64.172 Y36.521 E17.09200 F2400
+G1 X64.259 Y36.620 E17.09600 F2400
+G1 X64.359 Y36.736 E17.10000 F2400
+G1 X64.449 Y36.844 E17.10400 F2400
+G1 X64.608 Y37.034 E17.10800 F2400
+G1 X64.754 Y37.210 E17.11200 F2400
+G1 X64.842 Y37.317 E17.11600 F2400
+G1 X65.022 Y37.535 E17.12000 F2400
+G1 X65.160 Y37.700 E17.12400 F2400
+G1 X65.324 Y37.892 E17.12800 F2400
+G1 X65.475 Y38.064 E17.13200 F2400
+G1 X65.602 Y38.205 E17.13600 F2400
+G1 X65.731 Y38.345 E17.14000 F2400
+G1 X65.857 Y38.478 E17.14400 F2400
+G1 X65.936 Y38.558 E17.14800 F2400
+G1 X66.140 Y38.761 E17.15200 F2400
+G1 X66.262 Y38.879 E17.15600 F2400
+G1 X66.344 Y38.956 E17.16000 F2400
+G1 X66.433 Y39.039 E17.16400 F2400
+G1 X66.567 Y39.160 E17.16800 F2400
+G1 X66.753 Y39.327 E17.17200 F2400
+G1 X66.910 Y39.463 E17.17600 F2400
+G1 X67.041 Y39.577 E17.18000 F2400
+G1 X67.266 Y39.770 E17.18400 F2400
+G1 X67.358 Y39.848 E17.18800 F2400
+G1 X67.483 Y39.955 E17.19200 F2400
+G1 X67.707 Y40.149 E17.19600 F2400
+G1 X67.864 Y40.287 E17.20000 F2400
+G1 X68.019 Y40.427 E17.20400 F2400
+G1 X68.112 Y40.512 E17.20800 F2400
+G1 X68.285 Y40.676 E17.21200 F2400
+G1 X68.474 Y40.864 E17.21600 F2400
+G1 X68.674 Y41.074 E17.22000 F2400
+G1 X68.763 Y41.172 E17.22400 F2400
+G1 X68.913 Y41.348 E17.22800 F2400
+G1 X69.089 Y41.570 E17.23200 F2400
+G1 X69.262 Y41.812 E17.23600 F2400
+G1 X69.332 Y41.917 E17.24000 F2400
+G1 X69.404 Y42.033 E17.24400 F2400
+G1 X69.552 Y42.292 E17.24800 F2400
+G1 X69.637 Y42.458 E17.25200 F2400
+G1 X69.718 Y42.635 E17.25600 F2400
+G1 X69.816 Y42.876 E17.26000 F2400
+G1 X69.867 Y43.018 E17.26400 F2400
+G1 X69.909 Y43.148 E17.26800 F2400
+G1 X69.971 Y43.362 E17.27200 F2400
+G1 X70.026 Y43.591 E17.27600 F2400
+G1 X70.083 Y43.889 E17.28000 F2400
+G1 X70.102 Y44.015 E17.28400 F2400
+G1 X70.132 Y44.257 E17.28800 F2400
+G1 X70.145 Y44.389 E17.29200 F2400
+G1 X70.162 Y44.619 E17.29600 F2400
+G1 X70.173 Y44.862 E17.30000 F2400
+G1 X70.177 Y45.058 E17.30400 F2400
+G1 X70.178 Y45.248 E17.30800 F2400
+G1 X70.176 Y45.443 E17.31200 F2400
+G1 X70.169 Y45.724 E17.31600 F2400
+G1 X70.159 Y46.010 E17.32000 F2400
+G1 X70.150 Y46.210 E17.32400 F2400
+G1 X70.138 Y46.471 E17.32800 F2400
+G1 X70.128 Y46.667 E17.33200 F2400
+G1 X70.120 Y46.863 E17.33600 F2400
+G1 X70.110 Y47.095 E17.34000 F2400
+G1 X70.102 Y47.323 E17.34400 F2400
+G1 X70.096 Y47.519 E17.34800 F2400
+G1 X70.092 Y47.719 E17.35200 F2400
+G1 X70.089 Y47.996 E17.35600 F2400
+G1 X70.088 Y48.165 E17.36000 F2400
+G1 X70.089 Y48.393 E17.36400 F2400
+G1 X70.091 Y48.522 E17.36800 F2400
+G1 X70.095 Y48.820 E17.37200 F2400
+G1 X70.097 Y48.930 E17.37600 F2400
+G1 X70.103 Y49.187 E17.38000 F2400
+G1 X70.105 Y49.321 E17.38400 F2400
+G1 X70.110 Y49.555 E17.38800 F2400
+G1 X70.111 Y49.656 E17.39200 F2400
+G1 X70.113 Y49.822 E17.39600 F2400
+G1 X70.113 Y49.931 E17.40000 F2400
+G0 X69.663 Y50.000 F6000
+G1 X69.661 Y50.225 E17.40400 F2400
+G1 X69.658 Y50.329 E17.40800 F2400
+G1 X69.651 Y50.540 E17.41200 F2400
+G1 X69.641 Y50.721 E17.41600 F2400
+G1 X69.619 Y50.996 E17.42000 F2400
+G1 X69.600 Y51.175 E17.42400 F2400
+G1 X69.586 Y51.281 E17.42800 F2400
+G1 X69.565 Y51.428 E17.43200 F2400
+G1 X69.516 Y51.701 E17.43600 F2400
+G1 X69.474 Y51.895 E17.44000 F2400
+G1 X69.431 Y52.070 E17.44400 F2400
+G1 X69.387 Y52.229 E17.44800 F2400
+G1 X69.341 Y52.382 E17.45200 F2400
+G1 X69.300 Y52.505 E17.45600 F2400
+G1 X69.227 Y52.709 E17.46000 F2400
+G1 X69.180 Y52.830 E17.46400 F2400
+G1 X69.130 Y52.952 E17.46800 F2400
+G1 X69.078 Y53.073 E17.47200 F2400
+G1 X69.016 Y53.210 E17.47600 F2400
+G1 X68.892 Y53.467 E17.48000 F2400
+G1 X68.826 Y53.594 E17.48400 F2400
+G1 X68.775 Y53.690 E17.48800 F2400
+G1 X68.632 Y53.950 E17.49200 F2400
+G1 X68.531 Y54.125 E17.49600 F2400
+G1 X68.379 Y54.382 E17.50000 F2400
+G1 X68.245 Y54.605 E17.50400 F2400
+G1 X68.145 Y54.772 E17.50800 F2400
+G1 X68.050 Y54.930 E17.51200 F2400
+G1 X67.999 Y55.016 E17.51600 F2400
+G1 X67.908 Y55.172 E17.52000 F2400
+G1 X67.836 Y55.298 E17.52400 F2400
+G1 X67.753 Y55.447 E17.52800 F2400
+G1 X67.631 Y55.679 E17.53200 F2400
+G1 X67.536 Y55.871 E17.53600 F2400
+G1 X67.422 Y56.120 E17.54000 F2400
+G1 X67.330 Y56.342 E17.54400 F2400
+G1 X67.242 Y56.581 E17.54800 F2400
+G1 X67.205 Y56.690 E17.55200 F2400
+G1 X67.148 Y56.874 E17.55600 F2400
+G1 X67.080 Y57.116 E17.56000 F2400
+G1 X67.022 Y57.354 E17.56400 F2400
+G1 X66.969 Y57.605 E17.56800 F2400
+G1 X66.935 Y57.783 E17.57200 F2400
+G1 X66.913 Y57.906 E17.57600 F2400
+G1 X66.879 Y58.106 E17.58000 F2400
+G1 X66.845 Y58.317 E17.58400 F2400
+G1 X66.806 Y58.570 E17.58800 F2400
+G1 X66.780 Y58.745 E17.59200 F2400
+G1 X66.735 Y59.028 E17.59600 F2400
+G1 X66.688 Y59.308 E17.60000 F2400
+G1 X66.641 Y59.563 E17.60400 F2400
+G1 X66.589 Y59.816 E17.60800 F2400
+G1 X66.517 Y60.116 E17.61200 F2400
+G1 X66.486 Y60.235 E17.61600 F2400
+G1 X66.438 Y60.404 E17.62000 F2400
+G1 X66.380 Y60.590 E17.62400 F2400
+G1 X66.319 Y60.770 E17.62800 F2400
+G1 X66.233 Y60.996 E17.63200 F2400
+G1 X66.159 Y61.174 E17.63600 F2400
+G1 X66.084 Y61.337 E17.64000 F2400
+G1 X66.037 Y61.434 E17.64400 F2400
+G1 X65.987 Y61.533 E17.64800 F2400
+G1 X65.891 Y61.710 E17.65200 F2400
+G1 X65.807 Y61.855 E17.65600 F2400
+G1 X65.730 Y61.982 E17.66000 F2400
+G1 X65.673 Y62.071 E17.66400 F2400
+G1 X65.608 Y62.168 E17.66800 F2400
+G1 X65.530 Y62.282 E17.67200 F2400
+G1 X65.413 Y62.442 E17.67600 F2400
+G1 X65.324 Y62.560 E17.68000 F2400
+G1 X65.203 Y62.712 E17.68400 F2400
+G1 X65.041 Y62.905 E17.68800 F2400
+G1 X64.965 Y62.994 E17.69200 F2400
+G1 X64.813 Y63.165 E17.69600 F2400
+G1 X64.641 Y63.353 E17.70000 F2400
+G1 X64.447 Y63.560 E17.70400 F2400
+G1 X64.238 Y63.780 E17.70800 F2400
+G1 X64.141 Y63.880 E17.71200 F2400
+G1 X64.065 Y63.960 E17.71600 F2400
+G1 X63.904 Y64.128 E17.72000 F2400
+G1 X63.758 Y64.282 E17.72400 F2400
+G1 X63.563 Y64.491 E17.72800 F2400
+G1 X63.412 Y64.655 E17.73200 F2400
+G1 X63.231 Y64.855 E17.73600 F2400
+G1 X63.161 Y64.933 E17.74000 F2400
+G1 X63.029 Y65.083 E17.74400 F2400
+G1 X62.934 Y65.191 E17.74800 F2400
+G1 X62.842 Y65.297 E17.75200 F2400
+G1 X62.764 Y65.387 E17.75600 F2400
+G1 X62.569 Y65.616 E17.76000 F2400
+G1 X62.447 Y65.757 E17.76400 F2400
+G1 X62.270 Y65.964 E17.76800 F2400
+G1 X62.094 Y66.166 E17.77200 F2400
+G1 X61.910 Y66.373 E17.77600 F2400
+G1 X61.796 Y66.499 E17.78000 F2400
+G1 X61.612 Y66.694 E17.78400 F2400
+G1 X61.470 Y66.839 E17.78800 F2400
+G1 X61.251 Y67.050 E17.79200 F2400
+G1 X61.065 Y67.217 E17.79600 F2400
+G1 X60.838 Y67.406 E17.80000 F2400
+G1 X60.593 Y67.590 E17.80400 F2400
+G1 X60.444 Y67.692 E17.80800 F2400
+G1 X60.292 Y67.789 E17.81200 F2400
+G1 X60.201 Y67.843 E17.81600 F2400
+G1 X59.955 Y67.978 E17.82000 F2400
+G1 X59.743 Y68.080 E17.82400 F2400
+G1 X59.615 Y68.135 E17.82800 F2400
+G1 X59.394 Y68.221 E17.83200 F2400
+G1 X59.103 Y68.315 E17.83600 F2400
+G1 X58.809 Y68.392 E17.84000 F2400
+G1 X58.495 Y68.455 E17.84400 F2400
+G1 X58.317 Y68.483 E17.84800 F2400
+G1 X58.156 Y68.504 E17.85200 F2400
+G1 X58.048 Y68.516 E17.85600 F2400
+G1 X57.909 Y68.529 E17.86000 F2400
+G1 X57.745 Y68.541 E17.86400 F2400
+G1 X57.500 Y68.552 E17.86800 F2400
+G1 X57.390 Y68.556 E17.87200 F2400
+G1 X57.078 Y68.559 E17.87600 F2400
+G1 X56.829 Y68.557 E17.88000 F2400
+G1 X56.535 Y68.550 E17.88400 F2400
+G1 X56.367 Y68.545 E17.88800 F2400
+G1 X56.148 Y68.537 E17.89200 F2400
+G1 X55.848 Y68.527 E17.89600 F2400
+G1 X55.720 Y68.523 E17.90000 F2400
+G1 X55.599 Y68.519 E17.90400 F2400
+G1 X55.464 Y68.516 E17.90800 F2400
+G1 X55.319 Y68.513 E17.91200 F2400
+G1 X55.180 Y68.511 E17.91600 F2400
+G1 X55.071 Y68.511 E17.92000 F2400
+G1 X54.938 Y68.511 E17.92400 F2400
+G1 X54.749 Y68.515 E17.92800 F2400
+G1 X54.585 Y68.520 E17.93200 F2400
+G1 X54.397 Y68.528 E17.93600 F2400
+G1 X54.200 Y68.541 E17.94000 F2400
+G1 X53.964 Y68.561 E17.94400 F2400
+G1 X53.755 Y68.583 E17.94800 F2400
+G1 X53.471 Y68.620 E17.95200 F2400
+G1 X53.194 Y68.662 E17.95600 F2400
+G1 X52.927 Y68.707 E17.96000 F2400
+G1 X52.732 Y68.741 E17.96400 F2400
+G1 X52.590 Y68.767 E17.96800 F2400
+G1 X52.409 Y68.801 E17.97200 F2400
+G1 X52.219 Y68.836 E17.97600 F2400
+G1 X52.025 Y68.872 E17.98000 F2400
+G1 X51.749 Y68.919 E17.98400 F2400
+G1 X51.523 Y68.955 E17.98800 F2400
+G1 X51.246 Y68.993 E17.99200 F2400
+G1 X51.120 Y69.008 E17.99600 F2400
+G1 X50.899 Y69.030 E18.00000 F2400
+G1 X50.750 Y69.042 E18.00400 F2400
+G1 X50.649 Y69.049 E18.00800 F2400
+G1 X50.551 Y69.054 E18.01200 F2400
+G1 X50.381 Y69.059 E18.01600 F2400
+G1 X50.248 Y69.061 E18.02000 F2400
+G1 X50.086 Y69.060 E18.02400 F2400
+G1 X49.981 Y69.057 E18.02800 F2400
+G1 X49.877 Y69.053 E18.03200 F2400
+G1 X49.732 Y69.045 E18.03600 F2400
+G1 X49.493 Y69.026 E18.04000 F2400
+G1 X49.303 Y69.004 E18.04400 F2400
+G1 X49.066 Y68.972 E18.04800 F2400
+G1 X48.794 Y68.927 E18.05200 F2400
+G1 X48.602 Y68.891 E18.05600 F2400
+G1 X48.394 Y68.848 E18.06000 F2400
+G1 X48.261 Y68.819 E18.06400 F2400
+G1 X48.099 Y68.783 E18.06800 F2400
+G1 X47.863 Y68.728 E18.07200 F2400
+G1 X47.620 Y68.671 E18.07600 F2400
+G1 X47.499 Y68.642 E18.08000 F2400
+G1 X47.368 Y68.612 E18.08400 F2400
+G1 X47.187 Y68.570 E18.08800 F2400
+G1 X47.009 Y68.531 E18.09200 F2400
+G1 X46.799 Y68.488 E18.09600 F2400
+G1 X46.542 Y68.440 E18.10000 F2400
+G1 X46.400 Y68.416 E18.10400 F2400
+G1 X46.287 Y68.398 E18.10800 F2400
+G1 X46.175 Y68.382 E18.11200 F2400
+G1 X46.020 Y68.363 E18.11600 F2400
+G1 X45.853 Y68.344 E18.12000 F2400
+G1 X45.732 Y68.333 E18.12400 F2400
+G1 X45.473 Y68.315 E18.12800 F2400
+G1 X45.303 Y68.307 E18.13200 F2400
+G1 X45.155 Y68.302 E18.13600 F2400
+G1 X44.998 Y68.299 E18.14000 F2400
+G1 X44.719 Y68.299 E18.14400 F2400
+G1 X44.488 Y68.303 E18.14800 F2400
+G1 X44.217 Y68.312 E18.15200 F2400
+G1 X44.086 Y68.317 E18.15600 F2400
+G1 X43.946 Y68.322 E18.16000 F2400
+G1 X43.754 Y68.330 E18.16400 F2400
+G1 X43.549 Y68.339 E18.16800 F2400
+G1 X43.412 Y68.344 E18.17200 F2400
+G1 X43.262 Y68.349 E18.17600 F2400
+G1 X43.137 Y68.352 E18.18000 F2400
+G1 X43.014 Y68.355 E18.18400 F2400
+G1 X42.872 Y68.357 E18.18800 F2400
+G1 X42.711 Y68.357 E18.19200 F2400
+G1 X42.536 Y68.355 E18.19600 F2400
+G1 X42.297 Y68.348 E18.20000 F2400
+G1 X41.973 Y68.327 E18.20400 F2400
+G1 X41.742 Y68.305 E18.20800 F2400
+G1 X41.534 Y68.277 E18.21200 F2400
+G1 X41.346 Y68.246 E18.21600 F2400
+G1 X41.218 Y68.222 E18.22000 F2400
+G1 X40.977 Y68.167 E18.22400 F2400
+G1 X40.782 Y68.114 E18.22800 F2400
+G1 X40.549 Y68.040 E18.23200 F2400
+G1 X40.372 Y67.975 E18.23600 F2400
+G1 X40.233 Y67.919 E18.24000 F2400
+G1 X40.074 Y67.849 E18.24400 F2400
+G1 X39.951 Y67.790 E18.24800 F2400
+G1 X39.808 Y67.716 E18.25200 F2400
+G1 X39.545 Y67.565 E18.25600 F2400
+G1 X39.421 Y67.487 E18.26000 F2400
+G1 X39.231 Y67.358 E18.26400 F2400
+G1 X38.991 Y67.181 E18.26800 F2400
+G1 X38.843 Y67.063 E18.27200 F2400
+G1 X38.711 Y66.952 E18.27600 F2400
+G1 X38.615 Y66.869 E18.28000 F2400
+G1 X38.516 Y66.780 E18.28400 F2400
+G1 X38.296 Y66.576 E18.28800 F2400
+G1 X38.150 Y66.434 E18.29200 F2400
+G1 X38.028 Y66.312 E18.29600 F2400
+G1 X37.948 Y66.231 E18.30000 F2400
+G1 X37.771 Y66.050 E18.30400 F2400
+G1 X37.679 Y65.955 E18.30800 F2400
+G1 X37.536 Y65.804 E18.31200 F2400
+G1 X37.356 Y65.616 E18.31600 F2400
+G1 X37.170 Y65.421 E18.32000 F2400
+G1 X36.976 Y65.219 E18.32400 F2400
+G1 X36.867 Y65.107 E18.32800 F2400
+G1 X36.773 Y65.011 E18.33200 F2400
+G1 X36.683 Y64.921 E18.33600 F2400
+G1 X36.565 Y64.802 E18.34000 F2400
+G1 X36.443 Y64.681 E18.34400 F2400
+G1 X36.342 Y64.581 E18.34800 F2400
+G1 X36.251 Y64.492 E18.35200 F2400
+G1 X36.117 Y64.361 E18.35600 F2400
+G1 X35.982 Y64.231 E18.36000 F2400
+G1 X35.889 Y64.141 E18.36400 F2400
+G1 X35.694 Y63.953 E18.36800 F2400
+G1 X35.608 Y63.869 E18.37200 F2400
+G1 X35.478 Y63.742 E18.37600 F2400
+G1 X35.349 Y63.615 E18.38000 F2400
+G1 X35.220 Y63.485 E18.38400 F2400
+G1 X35.060 Y63.321 E18.38800 F2400
+G1 X34.918 Y63.169 E18.39200 F2400
+G1 X34.766 Y63.001 E18.39600 F2400
+G1 X34.602 Y62.810 E18.40000 F2400
+G1 X34.525 Y62.716 E18.40400 F2400
+G1 X34.341 Y62.478 E18.40800 F2400
+G1 X34.218 Y62.308 E18.41200 F2400
+G1 X34.076 Y62.093 E18.41600 F2400
+G1 X34.001 Y61.971 E18.42000 F2400
+G1 X33.901 Y61.798 E18.42400 F2400
+G1 X33.779 Y61.566 E18.42800 F2400
+G1 X33.707 Y61.413 E18.43200 F2400
+G1 X33.619 Y61.212 E18.43600 F2400
+G1 X33.517 Y60.946 E18.44000 F2400
+G1 X33.448 Y60.742 E18.44400 F2400
+G1 X33.386 Y60.537 E18.44800 F2400
+G1 X33.321 Y60.293 E18.45200 F2400
+G1 X33.255 Y60.001 E18.45600 F2400
+G1 X33.223 Y59.843 E18.46000 F2400
+G1 X33.170 Y59.536 E18.46400 F2400
+G1 X33.131 Y59.277 E18.46800 F2400
+G1 X33.106 Y59.091 E18.47200 F2400
+G1 X33.088 Y58.952 E18.47600 F2400
+G1 X33.069 Y58.794 E18.48000 F2400
+G1 X33.047 Y58.607 E18.48400 F2400
+G1 X33.018 Y58.359 E18.48800 F2400
+G1 X32.996 Y58.176 E18.49200 F2400
+G1 X32.983 Y58.064 E18.49600 F2400
+G1 X32.968 Y57.947 E18.50000 F2400
+G1 X32.928 Y57.662 E18.50400 F2400
+G1 X32.910 Y57.548 E18.50800 F2400
+G1 X32.863 Y57.277 E18.51200 F2400
+G1 X32.808 Y57.009 E18.51600 F2400
+G1 X32.759 Y56.801 E18.52000 F2400
+G1 X32.702 Y56.588 E18.52400 F2400
+G1 X32.627 Y56.342 E18.52800 F2400
+G1 X32.544 Y56.104 E18.53200 F2400
+G1 X32.461 Y55.889 E18.53600 F2400
+G1 X32.368 Y55.670 E18.54000 F2400
+G1 X32.255 Y55.423 E18.54400 F2400
+G1 X32.193 Y55.294 E18.54800 F2400
+G1 X32.115 Y55.137 E18.55200 F2400
+G1 X32.003 Y54.920 E18.55600 F2400
+G1 X31.895 Y54.715 E18.56000 F2400
+G1 X31.811 Y54.558 E18.56400 F2400
+G1 X31.672 Y54.296 E18.56800 F2400
+G1 X31.621 Y54.200 E18.57200 F2400
+G1 X31.557 Y54.078 E18.57600 F2400
+G1 X31.498 Y53.962 E18.58000 F2400
+G1 X31.422 Y53.812 E18.58400 F2400
+G1 X31.296 Y53.552 E18.58800 F2400
+G1 X31.173 Y53.279 E18.59200 F2400
+G1 X31.075 Y53.043 E18.59600 F2400
+G1 X31.009 Y52.870 E18.60000 F2400
+G1 X30.916 Y52.599 E18.60400 F2400
+G1 X30.866 Y52.440 E18.60800 F2400
+G1 X30.810 Y52.241 E18.61200 F2400
+G1 X30.752 Y52.005 E18.61600 F2400
+G1 X30.717 Y51.839 E18.62000 F2400
+G1 X30.674 Y51.603 E18.62400 F2400
+G1 X30.634 Y51.324 E18.62800 F2400
+G1 X30.615 Y51.156 E18.63200 F2400
+G1 X30.593 Y50.904 E18.63600 F2400
+G1 X30.585 Y50.790 E18.64000 F2400
+G1 X30.572 Y50.511 E18.64400 F2400
+G1 X30.567 Y50.318 E18.64800 F2400
+G1 X30.564 Y50.148 E18.65200 F2400
+G1 X30.563 Y49.858 E18.65600 F2400
+G1 X30.563 Y49.740 E18.66000 F2400
+G1 X30.565 Y49.538 E18.66400 F2400
+G1 X30.568 Y49.249 E18.66800 F2400
+G1 X30.569 Y49.074 E18.67200 F2400
+G1 X30.570 Y48.922 E18.67600 F2400
+G1 X30.570 Y48.731 E18.68000 F2400
+G1 X30.568 Y48.498 E18.68400 F2400
+G1 X30.565 Y48.345 E18.68800 F2400
+G1 X30.556 Y48.055 E18.69200 F2400
+G1 X30.543 Y47.769 E18.69600 F2400
+G1 X30.528 Y47.507 E18.70000 F2400
+G1 X30.513 Y47.297 E18.70400 F2400
+G1 X30.498 Y47.106 E18.70800 F2400
+G1 X30.484 Y46.954 E18.71200 F2400
+G1 X30.468 Y46.777 E18.71600 F2400
+G1 X30.449 Y46.575 E18.72000 F2400
+G1 X30.433 Y46.401 E18.72400 F2400
+G1 X30.412 Y46.185 E18.72800 F2400
+G1 X30.402 Y46.077 E18.73200 F2400
+G1 X30.378 Y45.798 E18.73600 F2400
+G1 X30.358 Y45.529 E18.74000 F2400
+G1 X30.342 Y45.252 E18.74400 F2400
+G1 X30.337 Y45.123 E18.74800 F2400
+G1 X30.332 Y44.956 E18.75200 F2400
+G1 X30.330 Y44.800 E18.75600 F2400
+G1 X30.333 Y44.571 E18.76000 F2400
+G1 X30.348 Y44.257 E18.76400 F2400
+G1 X30.363 Y44.074 E18.76800 F2400
+G1 X30.398 Y43.792 E18.77200 F2400
+G1 X30.416 Y43.678 E18.77600 F2400
+G1 X30.463 Y43.434 E18.78000 F2400
+G1 X30.507 Y43.251 E18.78400 F2400
+G1 X30.556 Y43.077 E18.78800 F2400
+G1 X30.633 Y42.844 E18.79200 F2400
+G1 X30.737 Y42.580 E18.79600 F2400
+G1 X30.865 Y42.305 E18.80000 F2400
+G1 X30.955 Y42.135 E18.80400 F2400
+G1 X31.064 Y41.950 E18.80800 F2400
+G1 X31.174 Y41.778 E18.81200 F2400
+G1 X31.241 Y41.681 E18.81600 F2400
+G1 X31.374 Y41.498 E18.82000 F2400
+G1 X31.540 Y41.288 E18.82400 F2400
+G1 X31.741 Y41.056 E18.82800 F2400
+G1 X31.845 Y40.943 E18.83200 F2400
+G1 X32.003 Y40.777 E18.83600 F2400
+G1 X32.203 Y40.580 E18.84000 F2400
+G1 X32.312 Y40.475 E18.84400 F2400
+G1 X32.435 Y40.359 E18.84800 F2400
+G1 X32.580 Y40.226 E18.85200 F2400
+G1 X32.769 Y40.056 E18.85600 F2400
+G1 X32.983 Y39.864 E18.86000 F2400
+G1 X33.109 Y39.753 E18.86400 F2400
+G1 X33.283 Y39.598 E18.86800 F2400
+G1 X33.510 Y39.394 E18.87200 F2400
+G1 X33.730 Y39.191 E18.87600 F2400
+G1 X33.927 Y39.005 E18.88000 F2400
+G1 X34.060 Y38.875 E18.88400 F2400
+G1 X34.231 Y38.704 E18.88800 F2400
+G1 X34.368 Y38.563 E18.89200 F2400
+G1 X34.508 Y38.417 E18.89600 F2400
+G1 X34.624 Y38.291 E18.90000 F2400
+G1 X34.822 Y38.072 E18.90400 F2400
+G1 X34.985 Y37.886 E18.90800 F2400
+G1 X35.120 Y37.731 E18.91200 F2400
+G1 X35.189 Y37.652 E18.91600 F2400
+G1 X35.295 Y37.528 E18.92000 F2400
+G1 X35.470 Y37.325 E18.92400 F2400
+G1 X35.547 Y37.237 E18.92800 F2400
+G1 X35.727 Y37.033 E18.93200 F2400
+G1 X35.852 Y36.895 E18.93600 F2400
+G1 X35.930 Y36.810 E18.94000 F2400
+G1 X36.061 Y36.670 E18.94400 F2400
+G1 X36.240 Y36.488 E18.94800 F2400
+G1 X36.317 Y36.412 E18.95200 F2400
+G1 X36.460 Y36.277 E18.95600 F2400
+G1 X36.634 Y36.120 E18.96000 F2400
+G1 X36.775 Y36.000 E18.96400 F2400
+G1 X36.897 Y35.902 E18.96800 F2400
+G1 X37.071 Y35.769 E18.97200 F2400
+G1 X37.238 Y35.648 E18.97600 F2400
+G1 X37.339 Y35.579 E18.98000 F2400
+G1 X37.571 Y35.429 E18.98400 F2400
+G1 X37.802 Y35.293 E18.98800 F2400
+G1 X37.982 Y35.193 E18.99200 F2400
+G1 X38.233 Y35.064 E18.99600 F2400
+G1 X38.433 Y34.967 E19.00000 F2400
+G1 X38.529 Y34.923 E19.00400 F2400
+G1 X38.790 Y34.806 E19.00800 F2400
+G1 X39.002 Y34.714 E19.01200 F2400
+G1 X39.120 Y34.664 E19.01600 F2400
+G1 X39.215 Y34.625 E19.02000 F2400
+G1 X39.442 Y34.530 E19.02400 F2400
+G1 X39.600 Y34.464 E19.02800 F2400
+G1 X39.714 Y34.416 E19.03200 F2400
+G1 X39.922 Y34.326 E19.03600 F2400
+G1 X40.107 Y34.244 E19.04000 F2400
+G1 X40.337 Y34.136 E19.04400 F2400
+G1 X40.525 Y34.043 E19.04800 F2400
+G1 X40.685 Y33.959 E19.05200 F2400
+G1 X40.823 Y33.883 E19.05600 F2400
+G1 X41.067 Y33.740 E19.06000 F2400
+G1 X41.300 Y33.590 E19.06400 F2400
+G1 X41.389 Y33.529 E19.06800 F2400
+G1 X41.622 Y33.362 E19.07200 F2400
+G1 X41.816 Y33.212 E19.07600 F2400
+G1 X41.931 Y33.119 E19.08000 F2400
+G1 X42.126 Y32.955 E19.08400 F2400
+G1 X42.299 Y32.803 E19.08800 F2400
+G1 X42.470 Y32.649 E19.09200 F2400
+G1 X42.678 Y32.458 E19.09600 F2400
+G1 X42.800 Y32.345 E19.10000 F2400
+G1 X43.002 Y32.157 E19.10400 F2400
+G1 X43.168 Y32.005 E19.10800 F2400
+G1 X43.306 Y31.880 E19.11200 F2400
+G1 X43.542 Y31.673 E19.11600 F2400
+G1 X43.635 Y31.593 E19.12000 F2400
+G1 X43.814 Y31.445 E19.12400 F2400
+G1 X44.040 Y31.269 E19.12800 F2400
+G1 X44.136 Y31.197 E19.13200 F2400
+G1 X44.373 Y31.031 E19.13600 F2400
+G1 X44.555 Y30.912 E19.14000 F2400
+G1 X44.745 Y30.797 E19.14400 F2400
+G1 X44.894 Y30.714 E19.14800 F2400
+G1 X45.131 Y30.593 E19.15200 F2400
+G1 X45.252 Y30.536 E19.15600 F2400
+G1 X45.441 Y30.455 E19.16000 F2400
+G1 X45.609 Y30.390 E19.16400 F2400
+G1 X45.814 Y30.318 E19.16800 F2400
+G1 X45.953 Y30.275 E19.17200 F2400
+G1 X46.161 Y30.217 E19.17600 F2400
+G1 X46.264 Y30.192 E19.18000 F2400
+G1 X46.491 Y30.142 E19.18400 F2400
+G1 X46.712 Y30.102 E19.18800 F2400
+G1 X46.843 Y30.082 E19.19200 F2400
+G1 X47.010 Y30.060 E19.19600 F2400
+G1 X47.203 Y30.039 E19.20000 F2400
+G1 X47.478 Y30.015 E19.20400 F2400
+G1 X47.785 Y29.998 E19.20800 F2400
+G1 X48.010 Y29.989 E19.21200 F2400
+G1 X48.275 Y29.983 E19.21600 F2400
+G1 X48.454 Y29.980 E19.22000 F2400
+G1 X48.743 Y29.977 E19.22400 F2400
+G1 X49.040 Y29.974 E19.22800 F2400
+G1 X49.346 Y29.971 E19.23200 F2400
+G1 X49.575 Y29.968 E19.23600 F2400
+G1 X49.695 Y29.965 E19.24000 F2400
+G1 X49.842 Y29.962 E19.24400 F2400
+G1 X49.990 Y29.958 E19.24800 F2400
+G1 X50.217 Y29.951 E19.25200 F2400
+G1 X50.391 Y29.945 E19.25600 F2400
+G1 X50.583 Y29.937 E19.26000 F2400
+G1 X50.844 Y29.926 E19.26400 F2400
+G1 X50.967 Y29.920 E19.26800 F2400
+G1 X51.076 Y29.915 E19.27200 F2400
+G1 X51.227 Y29.909 E19.27600 F2400
+G1 X51.465 Y29.899 E19.28000 F2400
+G1 X51.618 Y29.893 E19.28400 F2400
+G1 X51.915 Y29.884 E19.28800 F2400
+G1 X52.129 Y29.881 E19.29200 F2400
+G1 X52.348 Y29.881 E19.29600 F2400
+G1 X52.559 Y29.884 E19.30000 F2400
+G1 X52.676 Y29.888 E19.30400 F2400
+G1 X52.912 Y29.901 E19.30800 F2400
+G1 X53.138 Y29.920 E19.31200 F2400
+G1 X53.388 Y29.949 E19.31600 F2400
+G1 X53.559 Y29.975 E19.32000 F2400
+G1 X53.843 Y30.029 E19.32400 F2400
+G1 X54.030 Y30.073 E19.32800 F2400
+G1 X54.285 Y30.144 E19.33200 F2400
+G1 X54.385 Y30.176 E19.33600 F2400
+G1 X54.598 Y30.252 E19.34000 F2400
+G1 X54.875 Y30.366 E19.34400 F2400
+G1 X55.005 Y30.426 E19.34800 F2400
+G1 X55.100 Y30.472 E19.35200 F2400
+G1 X55.197 Y30.523 E19.35600 F2400
+G1 X55.358 Y30.611 E19.36000 F2400
+G1 X55.599 Y30.757 E19.36400 F2400
+G1 X55.727 Y30.841 E19.36800 F2400
+G1 X55.931 Y30.983 E19.37200 F2400
+G1 X56.155 Y31.151 E19.37600 F2400
+G1 X56.281 Y31.251 E19.38000 F2400
+G1 X56.512 Y31.444 E19.38400 F2400
+G1 X56.688 Y31.598 E19.38800 F2400
+G1 X56.834 Y31.731 E19.39200 F2400
+G1 X56.973 Y31.859 E19.39600 F2400
+G1 X57.078 Y31.958 E19.40000 F2400
+G1 X57.284 Y32.153 E19.40400 F2400
+G1 X57.484 Y32.345 E19.40800 F2400
+G1 X57.591 Y32.447 E19.41200 F2400
+G1 X57.675 Y32.527 E19.41600 F2400
+G1 X57.773 Y32.619 E19.42000 F2400
+G1 X57.907 Y32.743 E19.42400 F2400
+G1 X58.037 Y32.860 E19.42800 F2400
+G1 X58.254 Y33.050 E19.43200 F2400
+G1 X58.446 Y33.211 E19.43600 F2400
+G1 X58.548 Y33.293 E19.44000 F2400
+G1 X58.764 Y33.457 E19.44400 F2400
+G1 X58.993 Y33.621 E19.44800 F2400
+G1 X59.227 Y33.775 E19.45200 F2400
+G1 X59.389 Y33.875 E19.45600 F2400
+G1 X59.578 Y33.986 E19.46000 F2400
+G1 X59.813 Y34.116 E19.46400 F2400
+G1 X59.928 Y34.178 E19.46800 F2400
+G1 X60.184 Y34.309 E19.47200 F2400
+G1 X60.320 Y34.377 E19.47600 F2400
+G1 X60.467 Y34.449 E19.48000 F2400
+G1 X60.597 Y34.512 E19.48400 F2400
+G1 X60.807 Y34.615 E19.48800 F2400
+G1 X61.023 Y34.721 E19.49200 F2400
+G1 X61.150 Y34.785 E19.49600 F2400
+G1 X61.276 Y34.848 E19.50000 F2400
+G1 X61.535 Y34.985 E19.50400 F2400
+G1 X61.759 Y35.109 E19.50800 F2400
+G1 X61.889 Y35.185 E19.51200 F2400
+G1 X62.109 Y35.320 E19.51600 F2400
+G1 X62.306 Y35.449 E19.52000 F2400
+G1 X62.456 Y35.553 E19.52400 F2400
+G1 X62.683 Y35.721 E19.52800 F2400
+G1 X62.872 Y35.873 E19.53200 F2400
+G1 X62.988 Y35.971 E19.53600 F2400
+G1 X63.194 Y36.156 E19.54000 F2400
+G1 X63.316 Y36.272 E19.54400 F2400
+G1 X63.493 Y36.449 E19.54800 F2400
+G1 X63.627 Y36.590 E19.55200 F2400
+G1 X63.747 Y36.721 E19.55600 F2400
+G1 X63.839 Y36.823 E19.56000 F2400
+G1 X63.969 Y36.973 E19.56400 F2400
+G1 X64.100 Y37.126 E19.56800 F2400
+G1 X64.202 Y37.248 E19.57200 F2400
+G1 X64.293 Y37.358 E19.57600 F2400
+G1 X64.422 Y37.515 E19.58000 F2400
+G1 X64.537 Y37.654 E19.58400 F2400
+G1 X64.666 Y37.811 E19.58800 F2400
+G1 X64.825 Y38.000 E19.59200 F2400
+G1 X65.006 Y38.212 E19.59600 F2400
+G1 X65.138 Y38.360 E19.60000 F2400
+G1 X65.283 Y38.520 E19.60400 F2400
+G1 X65.363 Y38.606 E19.60800 F2400
+G1 X65.459 Y38.706 E19.61200 F2400
+G1 X65.582 Y38.832 E19.61600 F2400
+G1 X65.730 Y38.979 E19.62000 F2400
+G1 X65.833 Y39.078 E19.62400 F2400
+G1 X65.983 Y39.219 E19.62800 F2400
+G1 X66.171 Y39.390 E19.63200 F2400
+G1 X66.359 Y39.556 E19.63600 F2400
+G1 X66.572 Y39.739 E19.64000 F2400
+G1 X66.749 Y39.890 E19.64400 F2400
+G1 X66.953 Y40.061 E19.64800 F2400
+G1 X67.139 Y40.219 E19.65200 F2400
+G1 X67.238 Y40.303 E19.65600 F2400
+G1 X67.424 Y40.463 E19.66000 F2400
+G1 X67.615 Y40.633 E19.66400 F2400
+G1 X67.743 Y40.749 E19.66800 F2400
+G1 X67.948 Y40.942 E19.67200 F2400
+G1 X68.083 Y41.075 E19.67600 F2400
+G1 X68.286 Y41.288 E19.68000 F2400
+G1 X68.484 Y41.511 E19.68400 F2400
+G1 X68.610 Y41.665 E19.68800 F2400
+G1 X68.777 Y41.887 E19.69200 F2400
+G1 X68.868 Y42.018 E19.69600 F2400
+G1 X68.949 Y42.141 E19.70000 F2400
+G1 X69.096 Y42.388 E19.70400 F2400
+G1 X69.155 Y42.498 E19.70800 F2400
+G1 X69.265 Y42.722 E19.71200 F2400
+G1 X69.367 Y42.963 E19.71600 F2400
+G1 X69.439 Y43.159 E19.72000 F2400
+G1 X69.489 Y43.311 E19.72400 F2400
+G1 X69.520 Y43.419 E19.72800 F2400
+G1 X69.568 Y43.602 E19.73200 F2400
+G1 X69.610 Y43.788 E19.73600 F2400
+G1 X69.647 Y43.988 E19.74000 F2400
+G1 X69.670 Y44.136 E19.74400 F2400
+G1 X69.691 Y44.302 E19.74800 F2400
+G1 X69.707 Y44.457 E19.75200 F2400
+G1 X69.718 Y44.593 E19.75600 F2400
+G1 X69.729 Y44.771 E19.76000 F2400
+G1 X69.739 Y45.065 E19.76400 F2400
+G1 X69.740 Y45.358 E19.76800 F2400
+G1 X69.736 Y45.580 E19.77200 F2400
+G1 X69.729 Y45.830 E19.77600 F2400
+G1 X69.719 Y46.066 E19.78000 F2400
+G1 X69.708 Y46.295 E19.78400 F2400
+G1 X69.697 Y46.495 E19.78800 F2400
+G1 X69.684 Y46.740 E19.79200 F2400
+G1 X69.675 Y46.922 E19.79600 F2400
+G1 X69.667 Y47.091 E19.80000 F2400
+G1 X69.661 Y47.241 E19.80400 F2400
+G1 X69.654 Y47.425 E19.80800 F2400
+G1 X69.647 Y47.680 E19.81200 F2400
+G1 X69.644 Y47.790 E19.81600 F2400
+G1 X69.641 Y48.050 E19.82000 F2400
+G1 X69.640 Y48.314 E19.82400 F2400
+G1 X69.642 Y48.552 E19.82800 F2400
+G1 X69.645 Y48.786 E19.83200 F2400
+G1 X69.647 Y48.914 E19.83600 F2400
+G1 X69.651 Y49.086 E19.84000 F2400
+G1 X69.653 Y49.215 E19.84400 F2400
+G1 X69.657 Y49.417 E19.84800 F2400
+G1 X69.660 Y49.607 E19.85200 F2400
+G1 X69.662 Y49.788 E19.85600 F2400
@@ -0,0 +1,6003 @@
+; long gentle curve of 0.05mm segments at 200mm/s
+G21
+G90
+G1 X10 Y10 F12000
+G1 X10.0500 Y10.0000
+G1 X10.1000 Y10.0001
+G1 X10.1500 Y10.0001
+G1 X10.2000 Y10.0002
+G1 X10.2500 Y10.0004
+G1 X10.3000 Y10.0005
+G1 X10.3500 Y10.0007
+G1 X10.4000 Y10.0009
+G1 X10.4500 Y10.0011
+G1 X10.5000 Y10.0014
+G1 X10.5500 Y10.0016
+G1 X10.6000 Y10.0019
+G1 X10.6500 Y10.0023
+G1 X10.7000 Y10.0026
+G1 X10.7500 Y10.0030
+G1 X10.8000 Y10.0034
+G1 X10.8500 Y10.0038
+G1 X10.9000 Y10.0043
+G1 X10.9500 Y10.0047
+G1 X11.0000 Y10.0052
+G1 X11.0500 Y10.0058
+G1 X11.1000 Y10.0063
+G1 X11.1500 Y10.0069
+G1 X11.2000 Y10.0075
+G1 X11.2500 Y10.0081
+G1 X11.3000 Y10.0088
+G1 X11.3500 Y10.0094
+G1 X11.4000 Y10.0101
+G1 X11.4499 Y10.0109
+G1 X11.4999 Y10.0116
+G1 X11.5499 Y10.0124
+G1 X11.5999 Y10.0132
+G1 X11.6499 Y10.0140
+G1 X11.6999 Y10.0149
+G1 X11.7499 Y10.0157
+G1 X11.7999 Y10.0166
+G1 X11.8499 Y10.0176
+G1 X11.8999 Y10.0185
+G1 X11.9499 Y10.0195
+G1 X11.9999 Y10.0205
+G1 X12.0499 Y10.0215
+G1 X12.0998 Y10.0226
+G1 X12.1498 Y10.0236
+G1 X12.1998 Y10.0247
+G1 X12.2498 Y10.0259
+G1 X12.2998 Y10.0270
+G1 X12.3498 Y10.0282
+G1 X12.3998 Y10.0294
+G1 X12.4497 Y10.0306
+G1 X12.4997 Y10.0319
+G1 X12.5497 Y10.0331
+G1 X12.5997 Y10.0344
+G1 X12.6497 Y10.0358
+G1 X12.6997 Y10.0371
+G1 X12.7496 Y10.0385
+G1 X12.7996 Y10.0399
+G1 X12.8496 Y10.0413
+G1 X12.8996 Y10.0428
+G1 X12.9496 Y10.0442
+G1 X12.9995 Y10.0457
+G1 X13.0495 Y10.0473
+G1 X13.0995 Y10.0488
+G1 X13.1495 Y10.0504
+G1 X13.1994 Y10.0520
+G1 X13.2494 Y10.0536
+G1 X13.2994 Y10.0553
+G1 X13.3494 Y10.0569
+G1 X13.3993 Y10.0586
+G1 X13.4493 Y10.0604
+G1 X13.4993 Y10.0621
+G1 X13.5492 Y10.0639
+G1 X13.5992 Y10.0657
+G1 X13.6492 Y10.0675
+G1 X13.6991 Y10.0694
+G1 X13.7491 Y10.0712
+G1 X13.7991 Y10.0731
+G1 X13.8490 Y10.0751
+G1 X13.8990 Y10.0770
+G1 X13.9490 Y10.0790
+G1 X13.9989 Y10.0810
+G1 X14.0489 Y10.0830
+G1 X14.0988 Y10.0851
+G1 X14.1488 Y10.0871
+G1 X14.1987 Y10.0892
+G1 X14.2487 Y10.0914
+G1 X14.2987 Y10.0935
+G1 X14.3486 Y10.0957
+G1 X14.3986 Y10.0979
+G1 X14.4485 Y10.1001
+G1 X14.4985 Y10.1024
+G1 X14.5484 Y10.1046
+G1 X14.5984 Y10.1069
+G1 X14.6483 Y10.1093
+G1 X14.6982 Y10.1116
+G1 X14.7482 Y10.1140
+G1 X14.7981 Y10.1164
+G1 X14.8481 Y10.1188
+G1 X14.8980 Y10.1213
+G1 X14.9479 Y10.1237
+G1 X14.9979 Y10.1262
+G1 X15.0478 Y10.1287
+G1 X15.0978 Y10.1313
+G1 X15.1477 Y10.1339
+G1 X15.1976 Y10.1365
+G1 X15.2476 Y10.1391
+G1 X15.2975 Y10.1417
+G1 X15.3474 Y10.1444
+G1 X15.3973 Y10.1471
+G1 X15.4473 Y10.1498
+G1 X15.4972 Y10.1526
+G1 X15.5471 Y10.1554
+G1 X15.5970 Y10.1582
+G1 X15.6470 Y10.1610
+G1 X15.6969 Y10.1638
+G1 X15.7468 Y10.1667
+G1 X15.7967 Y10.1696
+G1 X15.8466 Y10.1725
+G1 X15.8965 Y10.1755
+G1 X15.9464 Y10.1784
+G1 X15.9964 Y10.1814
+G1 X16.0463 Y10.1845
+G1 X16.0962 Y10.1875
+G1 X16.1461 Y10.1906
+G1 X16.1960 Y10.1937
+G1 X16.2459 Y10.1968
+G1 X16.2958 Y10.2000
+G1 X16.3457 Y10.2031
+G1 X16.3956 Y10.2063
+G1 X16.4455 Y10.2096
+G1 X16.4954 Y10.2128
+G1 X16.5453 Y10.2161
+G1 X16.5952 Y10.2194
+G1 X16.6450 Y10.2227
+G1 X16.6949 Y10.2260
+G1 X16.7448 Y10.2294
+G1 X16.7947 Y10.2328
+G1 X16.8446 Y10.2362
+G1 X16.8945 Y10.2397
+G1 X16.9443 Y10.2432
+G1 X16.9942 Y10.2466
+G1 X17.0441 Y10.2502
+G1 X17.0940 Y10.2537
+G1 X17.1438 Y10.2573
+G1 X17.1937 Y10.2609
+G1 X17.2436 Y10.2645
+G1 X17.2935 Y10.2682
+G1 X17.3433 Y10.2718
+G1 X17.3932 Y10.2755
+G1 X17.4430 Y10.2792
+G1 X17.4929 Y10.2830
+G1 X17.5428 Y10.2868
+G1 X17.5926 Y10.2906
+G1 X17.6425 Y10.2944
+G1 X17.6923 Y10.2982
+G1 X17.7422 Y10.3021
+G1 X17.7920 Y10.3060
+G1 X17.8419 Y10.3099
+G1 X17.8917 Y10.3139
+G1 X17.9415 Y10.3178
+G1 X17.9914 Y10.3218
+G1 X18.0412 Y10.3258
+G1 X18.0911 Y10.3299
+G1 X18.1409 Y10.3340
+G1 X18.1907 Y10.3381
+G1 X18.2406 Y10.3422
+G1 X18.2904 Y10.3463
+G1 X18.3402 Y10.3505
+G1 X18.3900 Y10.3547
+G1 X18.4399 Y10.3589
+G1 X18.4897 Y10.3632
+G1 X18.5395 Y10.3674
+G1 X18.5893 Y10.3717
+G1 X18.6391 Y10.3760
+G1 X18.6889 Y10.3804
+G1 X18.7387 Y10.3848
+G1 X18.7885 Y10.3891
+G1 X18.8384 Y10.3936
+G1 X18.8882 Y10.3980
+G1 X18.9380 Y10.4025
+G1 X18.9878 Y10.4070
+G1 X19.0375 Y10.4115
+G1 X19.0873 Y10.4160
+G1 X19.1371 Y10.4206
+G1 X19.1869 Y10.4252
+G1 X19.2367 Y10.4298
+G1 X19.2865 Y10.4345
+G1 X19.3363 Y10.4391
+G1 X19.3861 Y10.4438
+G1 X19.4358 Y10.4485
+G1 X19.4856 Y10.4533
+G1 X19.5354 Y10.4580
+G1 X19.5851 Y10.4628
+G1 X19.6349 Y10.4677
+G1 X19.6847 Y10.4725
+G1 X19.7344 Y10.4774
+G1 X19.7842 Y10.4823
+G1 X19.8340 Y10.4872
+G1 X19.8837 Y10.4921
+G1 X19.9335 Y10.4971
+G1 X19.9832 Y10.5021
+G1 X20.0330 Y10.5071
+G1 X20.0827 Y10.5121
+G1 X20.1325 Y10.5172
+G1 X20.1822 Y10.5223
+G1 X20.2319 Y10.5274
+G1 X20.2817 Y10.5326
+G1 X20.3314 Y10.5377
+G1 X20.3811 Y10.5429
+G1 X20.4309 Y10.5481
+G1 X20.4806 Y10.5534
+G1 X20.5303 Y10.5586
+G1 X20.5800 Y10.5639
+G1 X20.6297 Y10.5692
+G1 X20.6795 Y10.5746
+G1 X20.7292 Y10.5799
+G1 X20.7789 Y10.5853
+G1 X20.8286 Y10.5907
+G1 X20.8783 Y10.5962
+G1 X20.9280 Y10.6016
+G1 X20.9777 Y10.6071
+G1 X21.0274 Y10.6126
+G1 X21.0771 Y10.6182
+G1 X21.1268 Y10.6238
+G1 X21.1764 Y10.6293
+G1 X21.2261 Y10.6350
+G1 X21.2758 Y10.6406
+G1 X21.3255 Y10.6463
+G1 X21.3752 Y10.6519
+G1 X21.4248 Y10.6577
+G1 X21.4745 Y10.6634
+G1 X21.5242 Y10.6692
+G1 X21.5738 Y10.6749
+G1 X21.6235 Y10.6808
+G1 X21.6732 Y10.6866
+G1 X21.7228 Y10.6924
+G1 X21.7725 Y10.6983
+G1 X21.8221 Y10.7042
+G1 X21.8718 Y10.7102
+G1 X21.9214 Y10.7161
+G1 X21.9710 Y10.7221
+G1 X22.0207 Y10.7281
+G1 X22.0703 Y10.7342
+G1 X22.1199 Y10.7402
+G1 X22.1696 Y10.7463
+G1 X22.2192 Y10.7524
+G1 X22.2688 Y10.7586
+G1 X22.3184 Y10.7647
+G1 X22.3681 Y10.7709
+G1 X22.4177 Y10.7771
+G1 X22.4673 Y10.7834
+G1 X22.5169 Y10.7896
+G1 X22.5665 Y10.7959
+G1 X22.6161 Y10.8022
+G1 X22.6657 Y10.8085
+G1 X22.7153 Y10.8149
+G1 X22.7649 Y10.8213
+G1 X22.8145 Y10.8277
+G1 X22.8640 Y10.8341
+G1 X22.9136 Y10.8406
+G1 X22.9632 Y10.8471
+G1 X23.0128 Y10.8536
+G1 X23.0623 Y10.8601
+G1 X23.1119 Y10.8666
+G1 X23.1615 Y10.8732
+G1 X23.2110 Y10.8798
+G1 X23.2606 Y10.8865
+G1 X23.3102 Y10.8931
+G1 X23.3597 Y10.8998
+G1 X23.4093 Y10.9065
+G1 X23.4588 Y10.9132
+G1 X23.5083 Y10.9200
+G1 X23.5579 Y10.9268
+G1 X23.6074 Y10.9336
+G1 X23.6569 Y10.9404
+G1 X23.7065 Y10.9473
+G1 X23.7560 Y10.9541
+G1 X23.8055 Y10.9610
+G1 X23.8550 Y10.9680
+G1 X23.9046 Y10.9749
+G1 X23.9541 Y10.9819
+G1 X24.0036 Y10.9889
+G1 X24.0531 Y10.9959
+G1 X24.1026 Y11.0030
+G1 X24.1521 Y11.0100
+G1 X24.2016 Y11.0171
+G1 X24.2511 Y11.0243
+G1 X24.3005 Y11.0314
+G1 X24.3500 Y11.0386
+G1 X24.3995 Y11.0458
+G1 X24.4490 Y11.0530
+G1 X24.4985 Y11.0603
+G1 X24.5479 Y11.0675
+G1 X24.5974 Y11.0748
+G1 X24.6468 Y11.0822
+G1 X24.6963 Y11.0895
+G1 X24.7458 Y11.0969
+G1 X24.7952 Y11.1043
+G1 X24.8447 Y11.1117
+G1 X24.8941 Y11.1192
+G1 X24.9435 Y11.1266
+G1 X24.9930 Y11.1341
+G1 X25.0424 Y11.1416
+G1 X25.0918 Y11.1492
+G1 X25.1412 Y11.1568
+G1 X25.1907 Y11.1644
+G1 X25.2401 Y11.1720
+G1 X25.2895 Y11.1796
+G1 X25.3389 Y11.1873
+G1 X25.3883 Y11.1950
+G1 X25.4377 Y11.2027
+G1 X25.4871 Y11.2105
+G1 X25.5365 Y11.2182
+G1 X25.5859 Y11.2260
+G1 X25.6353 Y11.2338
+G1 X25.6847 Y11.2417
+G1 X25.7340 Y11.2495
+G1 X25.7834 Y11.2574
+G1 X25.8328 Y11.2653
+G1 X25.8821 Y11.2733
+G1 X25.9315 Y11.2813
+G1 X25.9809 Y11.2892
+G1 X26.0302 Y11.2973
+G1 X26.0796 Y11.3053
+G1 X26.1289 Y11.3134
+G1 X26.1782 Y11.3215
+G1 X26.2276 Y11.3296
+G1 X26.2769 Y11.3377
+G1 X26.3262 Y11.3459
+G1 X26.3756 Y11.3541
+G1 X26.4249 Y11.3623
+G1 X26.4742 Y11.3705
+G1 X26.5235 Y11.3788
+G1 X26.5728 Y11.3871
+G1 X26.6221 Y11.3954
+G1 X26.6714 Y11.4037
+G1 X26.7207 Y11.4121
+G1 X26.7700 Y11.4204
+G1 X26.8193 Y11.4289
+G1 X26.8686 Y11.4373
+G1 X26.9179 Y11.4458
+G1 X26.9671 Y11.4542
+G1 X27.0164 Y11.4627
+G1 X27.0657 Y11.4713
+G1 X27.1149 Y11.4798
+G1 X27.1642 Y11.4884
+G1 X27.2135 Y11.4970
+G1 X27.2627 Y11.5057
+G1 X27.3120 Y11.5143
+G1 X27.3612 Y11.5230
+G1 X27.4104 Y11.5317
+G1 X27.4597 Y11.5404
+G1 X27.5089 Y11.5492
+G1 X27.5581 Y11.5580
+G1 X27.6073 Y11.5668
+G1 X27.6565 Y11.5756
+G1 X27.7058 Y11.5844
+G1 X27.7550 Y11.5933
+G1 X27.8042 Y11.6022
+G1 X27.8534 Y11.6112
+G1 X27.9026 Y11.6201
+G1 X27.9517 Y11.6291
+G1 X28.0009 Y11.6381
+G1 X28.0501 Y11.6471
+G1 X28.0993 Y11.6562
+G1 X28.1484 Y11.6652
+G1 X28.1976 Y11.6743
+G1 X28.2468 Y11.6835
+G1 X28.2959 Y11.6926
+G1 X28.3451 Y11.7018
+G1 X28.3942 Y11.7110
+G1 X28.4434 Y11.7202
+G1 X28.4925 Y11.7294
+G1 X28.5416 Y11.7387
+G1 X28.5908 Y11.7480
+G1 X28.6399 Y11.7573
+G1 X28.6890 Y11.7667
+G1 X28.7381 Y11.7760
+G1 X28.7872 Y11.7854
+G1 X28.8363 Y11.7949
+G1 X28.8854 Y11.8043
+G1 X28.9345 Y11.8138
+G1 X28.9836 Y11.8233
+G1 X29.0327 Y11.8328
+G1 X29.0818 Y11.8423
+G1 X29.1309 Y11.8519
+G1 X29.1799 Y11.8615
+G1 X29.2290 Y11.8711
+G1 X29.2781 Y11.8807
+G1 X29.3271 Y11.8904
+G1 X29.3762 Y11.9001
+G1 X29.4252 Y11.9098
+G1 X29.4743 Y11.9195
+G1 X29.5233 Y11.9293
+G1 X29.5723 Y11.9391
+G1 X29.6214 Y11.9489
+G1 X29.6704 Y11.9587
+G1 X29.7194 Y11.9686
+G1 X29.7684 Y11.9785
+G1 X29.8174 Y11.9884
+G1 X29.8664 Y11.9983
+G1 X29.9154 Y12.0083
+G1 X29.9644 Y12.0182
+G1 X30.0134 Y12.0283
+G1 X30.0624 Y12.0383
+G1 X30.1114 Y12.0483
+G1 X30.1603 Y12.0584
+G1 X30.2093 Y12.0685
+G1 X30.2583 Y12.0787
+G1 X30.3072 Y12.0888
+G1 X30.3562 Y12.0990
+G1 X30.4051 Y12.1092
+G1 X30.4541 Y12.1194
+G1 X30.5030 Y12.1297
+G1 X30.5520 Y12.1399
+G1 X30.6009 Y12.1502
+G1 X30.6498 Y12.1606
+G1 X30.6987 Y12.1709
+G1 X30.7476 Y12.1813
+G1 X30.7965 Y12.1917
+G1 X30.8454 Y12.2021
+G1 X30.8943 Y12.2126
+G1 X30.9432 Y12.2230
+G1 X30.9921 Y12.2335
+G1 X31.0410 Y12.2441
+G1 X31.0899 Y12.2546
+G1 X31.1387 Y12.2652
+G1 X31.1876 Y12.2758
+G1 X31.2365 Y12.2864
+G1 X31.2853 Y12.2970
+G1 X31.3342 Y12.3077
+G1 X31.3830 Y12.3184
+G1 X31.4318 Y12.3291
+G1 X31.4807 Y12.3398
+G1 X31.5295 Y12.3506
+G1 X31.5783 Y12.3614
+G1 X31.6271 Y12.3722
+G1 X31.6760 Y12.3830
+G1 X31.7248 Y12.3939
+G1 X31.7736 Y12.4048
+G1 X31.8224 Y12.4157
+G1 X31.8711 Y12.4266
+G1 X31.9199 Y12.4376
+G1 X31.9687 Y12.4486
+G1 X32.0175 Y12.4596
+G1 X32.0663 Y12.4706
+G1 X32.1150 Y12.4817
+G1 X32.1638 Y12.4928
+G1 X32.2125 Y12.5039
+G1 X32.2613 Y12.5150
+G1 X32.3100 Y12.5262
+G1 X32.3587 Y12.5373
+G1 X32.4075 Y12.5486
+G1 X32.4562 Y12.5598
+G1 X32.5049 Y12.5710
+G1 X32.5536 Y12.5823
+G1 X32.6023 Y12.5936
+G1 X32.6510 Y12.6049
+G1 X32.6997 Y12.6163
+G1 X32.7484 Y12.6277
+G1 X32.7971 Y12.6391
+G1 X32.8458 Y12.6505
+G1 X32.8944 Y12.6619
+G1 X32.9431 Y12.6734
+G1 X32.9918 Y12.6849
+G1 X33.0404 Y12.6964
+G1 X33.0891 Y12.7080
+G1 X33.1377 Y12.7195
+G1 X33.1864 Y12.7311
+G1 X33.2350 Y12.7427
+G1 X33.2836 Y12.7544
+G1 X33.3322 Y12.7661
+G1 X33.3808 Y12.7777
+G1 X33.4295 Y12.7895
+G1 X33.4781 Y12.8012
+G1 X33.5267 Y12.8130
+G1 X33.5752 Y12.8248
+G1 X33.6238 Y12.8366
+G1 X33.6724 Y12.8484
+G1 X33.7210 Y12.8603
+G1 X33.7695 Y12.8721
+G1 X33.8181 Y12.8841
+G1 X33.8667 Y12.8960
+G1 X33.9152 Y12.9079
+G1 X33.9638 Y12.9199
+G1 X34.0123 Y12.9319
+G1 X34.0608 Y12.9440
+G1 X34.1093 Y12.9560
+G1 X34.1579 Y12.9681
+G1 X34.2064 Y12.9802
+G1 X34.2549 Y12.9923
+G1 X34.3034 Y13.0045
+G1 X34.3519 Y13.0167
+G1 X34.4004 Y13.0289
+G1 X34.4489 Y13.0411
+G1 X34.4973 Y13.0533
+G1 X34.5458 Y13.0656
+G1 X34.5943 Y13.0779
+G1 X34.6427 Y13.0902
+G1 X34.6912 Y13.1026
+G1 X34.7396 Y13.1149
+G1 X34.7881 Y13.1273
+G1 X34.8365 Y13.1398
+G1 X34.8849 Y13.1522
+G1 X34.9333 Y13.1647
+G1 X34.9818 Y13.1772
+G1 X35.0302 Y13.1897
+G1 X35.0786 Y13.2022
+G1 X35.1270 Y13.2148
+G1 X35.1753 Y13.2274
+G1 X35.2237 Y13.2400
+G1 X35.2721 Y13.2526
+G1 X35.3205 Y13.2653
+G1 X35.3688 Y13.2780
+G1 X35.4172 Y13.2907
+G1 X35.4656 Y13.3034
+G1 X35.5139 Y13.3162
+G1 X35.5622 Y13.3289
+G1 X35.6106 Y13.3417
+G1 X35.6589 Y13.3546
+G1 X35.7072 Y13.3674
+G1 X35.7555 Y13.3803
+G1 X35.8038 Y13.3932
+G1 X35.8521 Y13.4061
+G1 X35.9004 Y13.4191
+G1 X35.9487 Y13.4321
+G1 X35.9970 Y13.4451
+G1 X36.0453 Y13.4581
+G1 X36.0935 Y13.4711
+G1 X36.1418 Y13.4842
+G1 X36.1901 Y13.4973
+G1 X36.2383 Y13.5104
+G1 X36.2865 Y13.5236
+G1 X36.3348 Y13.5367
+G1 X36.3830 Y13.5499
+G1 X36.4312 Y13.5631
+G1 X36.4794 Y13.5764
+G1 X36.5277 Y13.5896
+G1 X36.5759 Y13.6029
+G1 X36.6240 Y13.6162
+G1 X36.6722 Y13.6296
+G1 X36.7204 Y13.6429
+G1 X36.7686 Y13.6563
+G1 X36.8168 Y13.6697
+G1 X36.8649 Y13.6832
+G1 X36.9131 Y13.6966
+G1 X36.9612 Y13.7101
+G1 X37.0094 Y13.7236
+G1 X37.0575 Y13.7371
+G1 X37.1056 Y13.7507
+G1 X37.1538 Y13.7643
+G1 X37.2019 Y13.7779
+G1 X37.2500 Y13.7915
+G1 X37.2981 Y13.8051
+G1 X37.3462 Y13.8188
+G1 X37.3943 Y13.8325
+G1 X37.4423 Y13.8462
+G1 X37.4904 Y13.8600
+G1 X37.5385 Y13.8738
+G1 X37.5865 Y13.8875
+G1 X37.6346 Y13.9014
+G1 X37.6826 Y13.9152
+G1 X37.7307 Y13.9291
+G1 X37.7787 Y13.9430
+G1 X37.8267 Y13.9569
+G1 X37.8748 Y13.9708
+G1 X37.9228 Y13.9848
+G1 X37.9708 Y13.9988
+G1 X38.0188 Y14.0128
+G1 X38.0668 Y14.0268
+G1 X38.1147 Y14.0409
+G1 X38.1627 Y14.0549
+G1 X38.2107 Y14.0691
+G1 X38.2586 Y14.0832
+G1 X38.3066 Y14.0973
+G1 X38.3545 Y14.1115
+G1 X38.4025 Y14.1257
+G1 X38.4504 Y14.1399
+G1 X38.4983 Y14.1542
+G1 X38.5463 Y14.1685
+G1 X38.5942 Y14.1828
+G1 X38.6421 Y14.1971
+G1 X38.6900 Y14.2114
+G1 X38.7379 Y14.2258
+G1 X38.7858 Y14.2402
+G1 X38.8336 Y14.2546
+G1 X38.8815 Y14.2690
+G1 X38.9294 Y14.2835
+G1 X38.9772 Y14.2980
+G1 X39.0251 Y14.3125
+G1 X39.0729 Y14.3271
+G1 X39.1207 Y14.3416
+G1 X39.1686 Y14.3562
+G1 X39.2164 Y14.3708
+G1 X39.2642 Y14.3854
+G1 X39.3120 Y14.4001
+G1 X39.3598 Y14.4148
+G1 X39.4076 Y14.4295
+G1 X39.4554 Y14.4442
+G1 X39.5031 Y14.4590
+G1 X39.5509 Y14.4737
+G1 X39.5987 Y14.4885
+G1 X39.6464 Y14.5034
+G1 X39.6942 Y14.5182
+G1 X39.7419 Y14.5331
+G1 X39.7896 Y14.5480
+G1 X39.8373 Y14.5629
+G1 X39.8851 Y14.5778
+G1 X39.9328 Y14.5928
+G1 X39.9805 Y14.6078
+G1 X40.0282 Y14.6228
+G1 X40.0758 Y14.6379
+G1 X40.1235 Y14.6529
+G1 X40.1712 Y14.6680
+G1 X40.2189 Y14.6831
+G1 X40.2665 Y14.6982
+G1 X40.3142 Y14.7134
+G1 X40.3618 Y14.7286
+G1 X40.4094 Y14.7438
+G1 X40.4571 Y14.7590
+G1 X40.5047 Y14.7743
+G1 X40.5523 Y14.7895
+G1 X40.5999 Y14.8048
+G1 X40.6475 Y14.8202
+G1 X40.6951 Y14.8355
+G1 X40.7426 Y14.8509
+G1 X40.7902 Y14.8663
+G1 X40.8378 Y14.8817
+G1 X40.8853 Y14.8971
+G1 X40.9329 Y14.9126
+G1 X40.9804 Y14.9281
+G1 X41.0279 Y14.9436
+G1 X41.0755 Y14.9592
+G1 X41.1230 Y14.9747
+G1 X41.1705 Y14.9903
+G1 X41.2180 Y15.0059
+G1 X41.2655 Y15.0216
+G1 X41.3130 Y15.0372
+G1 X41.3605 Y15.0529
+G1 X41.4079 Y15.0686
+G1 X41.4554 Y15.0843
+G1 X41.5028 Y15.1001
+G1 X41.5503 Y15.1159
+G1 X41.5977 Y15.1316
+G1 X41.6452 Y15.1475
+G1 X41.6926 Y15.1633
+G1 X41.7400 Y15.1792
+G1 X41.7874 Y15.1951
+G1 X41.8348 Y15.2110
+G1 X41.8822 Y15.2269
+G1 X41.9296 Y15.2429
+G1 X41.9769 Y15.2589
+G1 X42.0243 Y15.2749
+G1 X42.0717 Y15.2909
+G1 X42.1190 Y15.3070
+G1 X42.1664 Y15.3231
+G1 X42.2137 Y15.3392
+G1 X42.2610 Y15.3553
+G1 X42.3083 Y15.3715
+G1 X42.3557 Y15.3877
+G1 X42.4030 Y15.4039
+G1 X42.4502 Y15.4201
+G1 X42.4975 Y15.4363
+G1 X42.5448 Y15.4526
+G1 X42.5921 Y15.4689
+G1 X42.6393 Y15.4852
+G1 X42.6866 Y15.5016
+G1 X42.7338 Y15.5179
+G1 X42.7811 Y15.5343
+G1 X42.8283 Y15.5507
+G1 X42.8755 Y15.5672
+G1 X42.9227 Y15.5837
+G1 X42.9699 Y15.6001
+G1 X43.0171 Y15.6166
+G1 X43.0643 Y15.6332
+G1 X43.1115 Y15.6497
+G1 X43.1587 Y15.6663
+G1 X43.2058 Y15.6829
+G1 X43.2530 Y15.6995
+G1 X43.3001 Y15.7162
+G1 X43.3473 Y15.7329
+G1 X43.3944 Y15.7496
+G1 X43.4415 Y15.7663
+G1 X43.4886 Y15.7830
+G1 X43.5357 Y15.7998
+G1 X43.5828 Y15.8166
+G1 X43.6299 Y15.8334
+G1 X43.6770 Y15.8503
+G1 X43.7241 Y15.8671
+G1 X43.7711 Y15.8840
+G1 X43.8182 Y15.9009
+G1 X43.8652 Y15.9178
+G1 X43.9123 Y15.9348
+G1 X43.9593 Y15.9518
+G1 X44.0063 Y15.9688
+G1 X44.0533 Y15.9858
+G1 X44.1003 Y16.0029
+G1 X44.1473 Y16.0199
+G1 X44.1943 Y16.0370
+G1 X44.2413 Y16.0542
+G1 X44.2883 Y16.0713
+G1 X44.3352 Y16.0885
+G1 X44.3822 Y16.1057
+G1 X44.4291 Y16.1229
+G1 X44.4761 Y16.1401
+G1 X44.5230 Y16.1574
+G1 X44.5699 Y16.1747
+G1 X44.6168 Y16.1920
+G1 X44.6637 Y16.2093
+G1 X44.7106 Y16.2267
+G1 X44.7575 Y16.2440
+G1 X44.8044 Y16.2614
+G1 X44.8512 Y16.2789
+G1 X44.8981 Y16.2963
+G1 X44.9449 Y16.3138
+G1 X44.9918 Y16.3313
+G1 X45.0386 Y16.3488
+G1 X45.0854 Y16.3664
+G1 X45.1322 Y16.3839
+G1 X45.1790 Y16.4015
+G1 X45.2258 Y16.4191
+G1 X45.2726 Y16.4368
+G1 X45.3194 Y16.4544
+G1 X45.3662 Y16.4721
+G1 X45.4129 Y16.4898
+G1 X45.4597 Y16.5075
+G1 X45.5064 Y16.5253
+G1 X45.5531 Y16.5431
+G1 X45.5999 Y16.5609
+G1 X45.6466 Y16.5787
+G1 X45.6933 Y16.5965
+G1 X45.7400 Y16.6144
+G1 X45.7867 Y16.6323
+G1 X45.8333 Y16.6502
+G1 X45.8800 Y16.6682
+G1 X45.9267 Y16.6861
+G1 X45.9733 Y16.7041
+G1 X46.0200 Y16.7221
+G1 X46.0666 Y16.7402
+G1 X46.1132 Y16.7582
+G1 X46.1599 Y16.7763
+G1 X46.2065 Y16.7944
+G1 X46.2531 Y16.8125
+G1 X46.2996 Y16.8307
+G1 X46.3462 Y16.8489
+G1 X46.3928 Y16.8671
+G1 X46.4394 Y16.8853
+G1 X46.4859 Y16.9035
+G1 X46.5325 Y16.9218
+G1 X46.5790 Y16.9401
+G1 X46.6255 Y16.9584
+G1 X46.6720 Y16.9767
+G1 X46.7185 Y16.9951
+G1 X46.7650 Y17.0135
+G1 X46.8115 Y17.0319
+G1 X46.8580 Y17.0503
+G1 X46.9045 Y17.0688
+G1 X46.9509 Y17.0872
+G1 X46.9974 Y17.1057
+G1 X47.0438 Y17.1243
+G1 X47.0903 Y17.1428
+G1 X47.1367 Y17.1614
+G1 X47.1831 Y17.1800
+G1 X47.2295 Y17.1986
+G1 X47.2759 Y17.2172
+G1 X47.3223 Y17.2359
+G1 X47.3687 Y17.2546
+G1 X47.4150 Y17.2733
+G1 X47.4614 Y17.2920
+G1 X47.5077 Y17.3108
+G1 X47.5541 Y17.3295
+G1 X47.6004 Y17.3483
+G1 X47.6467 Y17.3672
+G1 X47.6930 Y17.3860
+G1 X47.7393 Y17.4049
+G1 X47.7856 Y17.4238
+G1 X47.8319 Y17.4427
+G1 X47.8782 Y17.4616
+G1 X47.9245 Y17.4806
+G1 X47.9707 Y17.4996
+G1 X48.0170 Y17.5186
+G1 X48.0632 Y17.5376
+G1 X48.1094 Y17.5567
+G1 X48.1556 Y17.5758
+G1 X48.2019 Y17.5949
+G1 X48.2480 Y17.6140
+G1 X48.2942 Y17.6331
+G1 X48.3404 Y17.6523
+G1 X48.3866 Y17.6715
+G1 X48.4327 Y17.6907
+G1 X48.4789 Y17.7100
+G1 X48.5250 Y17.7292
+G1 X48.5712 Y17.7485
+G1 X48.6173 Y17.7678
+G1 X48.6634 Y17.7872
+G1 X48.7095 Y17.8065
+G1 X48.7556 Y17.8259
+G1 X48.8017 Y17.8453
+G1 X48.8477 Y17.8647
+G1 X48.8938 Y17.8842
+G1 X48.9399 Y17.9036
+G1 X48.9859 Y17.9231
+G1 X49.0319 Y17.9426
+G1 X49.0780 Y17.9622
+G1 X49.1240 Y17.9817
+G1 X49.1700 Y18.0013
+G1 X49.2160 Y18.0209
+G1 X49.2620 Y18.0406
+G1 X49.3079 Y18.0602
+G1 X49.3539 Y18.0799
+G1 X49.3999 Y18.0996
+G1 X49.4458 Y18.1193
+G1 X49.4917 Y18.1391
+G1 X49.5377 Y18.1589
+G1 X49.5836 Y18.1786
+G1 X49.6295 Y18.1985
+G1 X49.6754 Y18.2183
+G1 X49.7213 Y18.2382
+G1 X49.7671 Y18.2580
+G1 X49.8130 Y18.2780
+G1 X49.8589 Y18.2979
+G1 X49.9047 Y18.3178
+G1 X49.9505 Y18.3378
+G1 X49.9964 Y18.3578
+G1 X50.0422 Y18.3778
+G1 X50.0880 Y18.3979
+G1 X50.1338 Y18.4179
+G1 X50.1796 Y18.4380
+G1 X50.2253 Y18.4582
+G1 X50.2711 Y18.4783
+G1 X50.3169 Y18.4984
+G1 X50.3626 Y18.5186
+G1 X50.4084 Y18.5388
+G1 X50.4541 Y18.5591
+G1 X50.4998 Y18.5793
+G1 X50.5455 Y18.5996
+G1 X50.5912 Y18.6199
+G1 X50.6369 Y18.6402
+G1 X50.6826 Y18.6605
+G1 X50.7282 Y18.6809
+G1 X50.7739 Y18.7013
+G1 X50.8195 Y18.7217
+G1 X50.8651 Y18.7421
+G1 X50.9108 Y18.7626
+G1 X50.9564 Y18.7831
+G1 X51.0020 Y18.8036
+G1 X51.0476 Y18.8241
+G1 X51.0932 Y18.8447
+G1 X51.1387 Y18.8652
+G1 X51.1843 Y18.8858
+G1 X51.2299 Y18.9064
+G1 X51.2754 Y18.9271
+G1 X51.3209 Y18.9477
+G1 X51.3664 Y18.9684
+G1 X51.4120 Y18.9891
+G1 X51.4575 Y19.0099
+G1 X51.5029 Y19.0306
+G1 X51.5484 Y19.0514
+G1 X51.5939 Y19.0722
+G1 X51.6394 Y19.0930
+G1 X51.6848 Y19.1138
+G1 X51.7302 Y19.1347
+G1 X51.7757 Y19.1556
+G1 X51.8211 Y19.1765
+G1 X51.8665 Y19.1974
+G1 X51.9119 Y19.2184
+G1 X51.9573 Y19.2394
+G1 X52.0026 Y19.2604
+G1 X52.0480 Y19.2814
+G1 X52.0934 Y19.3025
+G1 X52.1387 Y19.3235
+G1 X52.1840 Y19.3446
+G1 X52.2294 Y19.3657
+G1 X52.2747 Y19.3869
+G1 X52.3200 Y19.4080
+G1 X52.3653 Y19.4292
+G1 X52.4106 Y19.4504
+G1 X52.4558 Y19.4717
+G1 X52.5011 Y19.4929
+G1 X52.5463 Y19.5142
+G1 X52.5916 Y19.5355
+G1 X52.6368 Y19.5568
+G1 X52.6820 Y19.5781
+G1 X52.7272 Y19.5995
+G1 X52.7724 Y19.6209
+G1 X52.8176 Y19.6423
+G1 X52.8628 Y19.6637
+G1 X52.9079 Y19.6852
+G1 X52.9531 Y19.7067
+G1 X52.9982 Y19.7282
+G1 X53.0434 Y19.7497
+G1 X53.0885 Y19.7712
+G1 X53.1336 Y19.7928
+G1 X53.1787 Y19.8144
+G1 X53.2238 Y19.8360
+G1 X53.2688 Y19.8576
+G1 X53.3139 Y19.8793
+G1 X53.3590 Y19.9010
+G1 X53.4040 Y19.9227
+G1 X53.4490 Y19.9444
+G1 X53.4941 Y19.9662
+G1 X53.5391 Y19.9879
+G1 X53.5841 Y20.0097
+G1 X53.6291 Y20.0315
+G1 X53.6740 Y20.0534
+G1 X53.7190 Y20.0752
+G1 X53.7640 Y20.0971
+G1 X53.8089 Y20.1190
+G1 X53.8538 Y20.1410
+G1 X53.8988 Y20.1629
+G1 X53.9437 Y20.1849
+G1 X53.9886 Y20.2069
+G1 X54.0335 Y20.2289
+G1 X54.0784 Y20.2509
+G1 X54.1232 Y20.2730
+G1 X54.1681 Y20.2951
+G1 X54.2129 Y20.3172
+G1 X54.2578 Y20.3393
+G1 X54.3026 Y20.3615
+G1 X54.3474 Y20.3837
+G1 X54.3922 Y20.4058
+G1 X54.4370 Y20.4281
+G1 X54.4818 Y20.4503
+G1 X54.5266 Y20.4726
+G1 X54.5713 Y20.4949
+G1 X54.6161 Y20.5172
+G1 X54.6608 Y20.5395
+G1 X54.7055 Y20.5619
+G1 X54.7502 Y20.5842
+G1 X54.7949 Y20.6066
+G1 X54.8396 Y20.6291
+G1 X54.8843 Y20.6515
+G1 X54.9290 Y20.6740
+G1 X54.9736 Y20.6965
+G1 X55.0183 Y20.7190
+G1 X55.0629 Y20.7415
+G1 X55.1075 Y20.7640
+G1 X55.1521 Y20.7866
+G1 X55.1967 Y20.8092
+G1 X55.2413 Y20.8318
+G1 X55.2859 Y20.8545
+G1 X55.3305 Y20.8772
+G1 X55.3750 Y20.8998
+G1 X55.4196 Y20.9226
+G1 X55.4641 Y20.9453
+G1 X55.5086 Y20.9680
+G1 X55.5531 Y20.9908
+G1 X55.5976 Y21.0136
+G1 X55.6421 Y21.0364
+G1 X55.6866 Y21.0593
+G1 X55.7311 Y21.0822
+G1 X55.7755 Y21.1051
+G1 X55.8200 Y21.1280
+G1 X55.8644 Y21.1509
+G1 X55.9088 Y21.1739
+G1 X55.9532 Y21.1968
+G1 X55.9976 Y21.2198
+G1 X56.0420 Y21.2429
+G1 X56.0864 Y21.2659
+G1 X56.1307 Y21.2890
+G1 X56.1751 Y21.3121
+G1 X56.2194 Y21.3352
+G1 X56.2638 Y21.3583
+G1 X56.3081 Y21.3815
+G1 X56.3524 Y21.4046
+G1 X56.3967 Y21.4278
+G1 X56.4409 Y21.4511
+G1 X56.4852 Y21.4743
+G1 X56.5295 Y21.4976
+G1 X56.5737 Y21.5208
+G1 X56.6180 Y21.5442
+G1 X56.6622 Y21.5675
+G1 X56.7064 Y21.5908
+G1 X56.7506 Y21.6142
+G1 X56.7948 Y21.6376
+G1 X56.8389 Y21.6610
+G1 X56.8831 Y21.6845
+G1 X56.9273 Y21.7080
+G1 X56.9714 Y21.7314
+G1 X57.0155 Y21.7549
+G1 X57.0596 Y21.7785
+G1 X57.1038 Y21.8020
+G1 X57.1478 Y21.8256
+G1 X57.1919 Y21.8492
+G1 X57.2360 Y21.8728
+G1 X57.2801 Y21.8965
+G1 X57.3241 Y21.9201
+G1 X57.3681 Y21.9438
+G1 X57.4122 Y21.9675
+G1 X57.4562 Y21.9913
+G1 X57.5002 Y22.0150
+G1 X57.5441 Y22.0388
+G1 X57.5881 Y22.0626
+G1 X57.6321 Y22.0864
+G1 X57.6760 Y22.1102
+G1 X57.7200 Y22.1341
+G1 X57.7639 Y22.1580
+G1 X57.8078 Y22.1819
+G1 X57.8517 Y22.2058
+G1 X57.8956 Y22.2298
+G1 X57.9395 Y22.2537
+G1 X57.9834 Y22.2777
+G1 X58.0272 Y22.3017
+G1 X58.0711 Y22.3258
+G1 X58.1149 Y22.3498
+G1 X58.1587 Y22.3739
+G1 X58.2025 Y22.3980
+G1 X58.2463 Y22.4221
+G1 X58.2901 Y22.4463
+G1 X58.3339 Y22.4705
+G1 X58.3776 Y22.4946
+G1 X58.4214 Y22.5189
+G1 X58.4651 Y22.5431
+G1 X58.5088 Y22.5673
+G1 X58.5525 Y22.5916
+G1 X58.5962 Y22.6159
+G1 X58.6399 Y22.6402
+G1 X58.6836 Y22.6646
+G1 X58.7273 Y22.6890
+G1 X58.7709 Y22.7133
+G1 X58.8145 Y22.7378
+G1 X58.8582 Y22.7622
+G1 X58.9018 Y22.7866
+G1 X58.9454 Y22.8111
+G1 X58.9890 Y22.8356
+G1 X59.0325 Y22.8601
+G1 X59.0761 Y22.8847
+G1 X59.1197 Y22.9092
+G1 X59.1632 Y22.9338
+G1 X59.2067 Y22.9584
+G1 X59.2502 Y22.9830
+G1 X59.2937 Y23.0077
+G1 X59.3372 Y23.0324
+G1 X59.3807 Y23.0571
+G1 X59.4242 Y23.0818
+G1 X59.4676 Y23.1065
+G1 X59.5111 Y23.1313
+G1 X59.5545 Y23.1560
+G1 X59.5979 Y23.1808
+G1 X59.6413 Y23.2057
+G1 X59.6847 Y23.2305
+G1 X59.7281 Y23.2554
+G1 X59.7715 Y23.2803
+G1 X59.8148 Y23.3052
+G1 X59.8581 Y23.3301
+G1 X59.9015 Y23.3550
+G1 X59.9448 Y23.3800
+G1 X59.9881 Y23.4050
+G1 X60.0314 Y23.4300
+G1 X60.0747 Y23.4551
+G1 X60.1179 Y23.4801
+G1 X60.1612 Y23.5052
+G1 X60.2044 Y23.5303
+G1 X60.2477 Y23.5554
+G1 X60.2909 Y23.5806
+G1 X60.3341 Y23.6058
+G1 X60.3773 Y23.6310
+G1 X60.4204 Y23.6562
+G1 X60.4636 Y23.6814
+G1 X60.5068 Y23.7067
+G1 X60.5499 Y23.7319
+G1 X60.5930 Y23.7572
+G1 X60.6361 Y23.7825
+G1 X60.6792 Y23.8079
+G1 X60.7223 Y23.8333
+G1 X60.7654 Y23.8586
+G1 X60.8085 Y23.8840
+G1 X60.8515 Y23.9095
+G1 X60.8946 Y23.9349
+G1 X60.9376 Y23.9604
+G1 X60.9806 Y23.9859
+G1 X61.0236 Y24.0114
+G1 X61.0666 Y24.0369
+G1 X61.1096 Y24.0625
+G1 X61.1525 Y24.0881
+G1 X61.1955 Y24.1137
+G1 X61.2384 Y24.1393
+G1 X61.2813 Y24.1649
+G1 X61.3243 Y24.1906
+G1 X61.3672 Y24.2163
+G1 X61.4100 Y24.2420
+G1 X61.4529 Y24.2677
+G1 X61.4958 Y24.2935
+G1 X61.5386 Y24.3192
+G1 X61.5815 Y24.3450
+G1 X61.6243 Y24.3708
+G1 X61.6671 Y24.3967
+G1 X61.7099 Y24.4225
+G1 X61.7527 Y24.4484
+G1 X61.7954 Y24.4743
+G1 X61.8382 Y24.5002
+G1 X61.8809 Y24.5262
+G1 X61.9237 Y24.5521
+G1 X61.9664 Y24.5781
+G1 X62.0091 Y24.6041
+G1 X62.0518 Y24.6302
+G1 X62.0945 Y24.6562
+G1 X62.1371 Y24.6823
+G1 X62.1798 Y24.7084
+G1 X62.2224 Y24.7345
+G1 X62.2650 Y24.7606
+G1 X62.3076 Y24.7868
+G1 X62.3502 Y24.8129
+G1 X62.3928 Y24.8391
+G1 X62.4354 Y24.8654
+G1 X62.4780 Y24.8916
+G1 X62.5205 Y24.9179
+G1 X62.5631 Y24.9442
+G1 X62.6056 Y24.9705
+G1 X62.6481 Y24.9968
+G1 X62.6906 Y25.0231
+G1 X62.7331 Y25.0495
+G1 X62.7755 Y25.0759
+G1 X62.8180 Y25.1023
+G1 X62.8604 Y25.1287
+G1 X62.9029 Y25.1552
+G1 X62.9453 Y25.1817
+G1 X62.9877 Y25.2082
+G1 X63.0301 Y25.2347
+G1 X63.0724 Y25.2612
+G1 X63.1148 Y25.2878
+G1 X63.1571 Y25.3143
+G1 X63.1995 Y25.3410
+G1 X63.2418 Y25.3676
+G1 X63.2841 Y25.3942
+G1 X63.3264 Y25.4209
+G1 X63.3687 Y25.4476
+G1 X63.4110 Y25.4743
+G1 X63.4532 Y25.5010
+G1 X63.4955 Y25.5278
+G1 X63.5377 Y25.5545
+G1 X63.5799 Y25.5813
+G1 X63.6221 Y25.6081
+G1 X63.6643 Y25.6350
+G1 X63.7065 Y25.6618
+G1 X63.7486 Y25.6887
+G1 X63.7908 Y25.7156
+G1 X63.8329 Y25.7425
+G1 X63.8750 Y25.7695
+G1 X63.9172 Y25.7964
+G1 X63.9593 Y25.8234
+G1 X64.0013 Y25.8504
+G1 X64.0434 Y25.8774
+G1 X64.0855 Y25.9045
+G1 X64.1275 Y25.9315
+G1 X64.1695 Y25.9586
+G1 X64.2115 Y25.9857
+G1 X64.2535 Y26.0129
+G1 X64.2955 Y26.0400
+G1 X64.3375 Y26.0672
+G1 X64.3795 Y26.0944
+G1 X64.4214 Y26.1216
+G1 X64.4633 Y26.1488
+G1 X64.5053 Y26.1761
+G1 X64.5472 Y26.2033
+G1 X64.5891 Y26.2306
+G1 X64.6309 Y26.2580
+G1 X64.6728 Y26.2853
+G1 X64.7146 Y26.3127
+G1 X64.7565 Y26.3400
+G1 X64.7983 Y26.3674
+G1 X64.8401 Y26.3949
+G1 X64.8819 Y26.4223
+G1 X64.9237 Y26.4498
+G1 X64.9655 Y26.4772
+G1 X65.0072 Y26.5048
+G1 X65.0490 Y26.5323
+G1 X65.0907 Y26.5598
+G1 X65.1324 Y26.5874
+G1 X65.1741 Y26.6150
+G1 X65.2158 Y26.6426
+G1 X65.2575 Y26.6702
+G1 X65.2991 Y26.6979
+G1 X65.3408 Y26.7256
+G1 X65.3824 Y26.7532
+G1 X65.4240 Y26.7810
+G1 X65.4656 Y26.8087
+G1 X65.5072 Y26.8364
+G1 X65.5488 Y26.8642
+G1 X65.5903 Y26.8920
+G1 X65.6319 Y26.9198
+G1 X65.6734 Y26.9477
+G1 X65.7149 Y26.9755
+G1 X65.7564 Y27.0034
+G1 X65.7979 Y27.0313
+G1 X65.8394 Y27.0592
+G1 X65.8809 Y27.0872
+G1 X65.9223 Y27.1151
+G1 X65.9637 Y27.1431
+G1 X66.0052 Y27.1711
+G1 X66.0466 Y27.1992
+G1 X66.0880 Y27.2272
+G1 X66.1294 Y27.2553
+G1 X66.1707 Y27.2834
+G1 X66.2121 Y27.3115
+G1 X66.2534 Y27.3396
+G1 X66.2947 Y27.3677
+G1 X66.3360 Y27.3959
+G1 X66.3773 Y27.4241
+G1 X66.4186 Y27.4523
+G1 X66.4599 Y27.4806
+G1 X66.5011 Y27.5088
+G1 X66.5424 Y27.5371
+G1 X66.5836 Y27.5654
+G1 X66.6248 Y27.5937
+G1 X66.6660 Y27.6220
+G1 X66.7072 Y27.6504
+G1 X66.7484 Y27.6788
+G1 X66.7895 Y27.7072
+G1 X66.8306 Y27.7356
+G1 X66.8718 Y27.7640
+G1 X66.9129 Y27.7925
+G1 X66.9540 Y27.8209
+G1 X66.9951 Y27.8494
+G1 X67.0361 Y27.8780
+G1 X67.0772 Y27.9065
+G1 X67.1182 Y27.9351
+G1 X67.1592 Y27.9637
+G1 X67.2003 Y27.9923
+G1 X67.2413 Y28.0209
+G1 X67.2822 Y28.0495
+G1 X67.3232 Y28.0782
+G1 X67.3642 Y28.1069
+G1 X67.4051 Y28.1356
+G1 X67.4460 Y28.1643
+G1 X67.4869 Y28.1930
+G1 X67.5278 Y28.2218
+G1 X67.5687 Y28.2506
+G1 X67.6096 Y28.2794
+G1 X67.6504 Y28.3082
+G1 X67.6913 Y28.3371
+G1 X67.7321 Y28.3659
+G1 X67.7729 Y28.3948
+G1 X67.8137 Y28.4237
+G1 X67.8545 Y28.4527
+G1 X67.8952 Y28.4816
+G1 X67.9360 Y28.5106
+G1 X67.9767 Y28.5396
+G1 X68.0175 Y28.5686
+G1 X68.0582 Y28.5976
+G1 X68.0989 Y28.6267
+G1 X68.1395 Y28.6558
+G1 X68.1802 Y28.6848
+G1 X68.2209 Y28.7140
+G1 X68.2615 Y28.7431
+G1 X68.3021 Y28.7722
+G1 X68.3427 Y28.8014
+G1 X68.3833 Y28.8306
+G1 X68.4239 Y28.8598
+G1 X68.4645 Y28.8891
+G1 X68.5050 Y28.9183
+G1 X68.5455 Y28.9476
+G1 X68.5861 Y28.9769
+G1 X68.6266 Y29.0062
+G1 X68.6670 Y29.0355
+G1 X68.7075 Y29.0649
+G1 X68.7480 Y29.0943
+G1 X68.7884 Y29.1237
+G1 X68.8289 Y29.1531
+G1 X68.8693 Y29.1825
+G1 X68.9097 Y29.2120
+G1 X68.9501 Y29.2415
+G1 X68.9904 Y29.2710
+G1 X69.0308 Y29.3005
+G1 X69.0711 Y29.3300
+G1 X69.1115 Y29.3596
+G1 X69.1518 Y29.3891
+G1 X69.1921 Y29.4187
+G1 X69.2324 Y29.4484
+G1 X69.2726 Y29.4780
+G1 X69.3129 Y29.5077
+G1 X69.3531 Y29.5373
+G1 X69.3933 Y29.5670
+G1 X69.4335 Y29.5968
+G1 X69.4737 Y29.6265
+G1 X69.5139 Y29.6563
+G1 X69.5541 Y29.6860
+G1 X69.5942 Y29.7158
+G1 X69.6344 Y29.7457
+G1 X69.6745 Y29.7755
+G1 X69.7146 Y29.8054
+G1 X69.7547 Y29.8352
+G1 X69.7948 Y29.8651
+G1 X69.8348 Y29.8951
+G1 X69.8749 Y29.9250
+G1 X69.9149 Y29.9550
+G1 X69.9549 Y29.9849
+G1 X69.9949 Y30.0149
+G1 X70.0349 Y30.0450
+G1 X70.0749 Y30.0750
+G1 X70.1148 Y30.1051
+G1 X70.1548 Y30.1351
+G1 X70.1947 Y30.1652
+G1 X70.2346 Y30.1954
+G1 X70.2745 Y30.2255
+G1 X70.3144 Y30.2557
+G1 X70.3542 Y30.2858
+G1 X70.3941 Y30.3160
+G1 X70.4339 Y30.3463
+G1 X70.4737 Y30.3765
+G1 X70.5135 Y30.4067
+G1 X70.5533 Y30.4370
+G1 X70.5931 Y30.4673
+G1 X70.6329 Y30.4976
+G1 X70.6726 Y30.5280
+G1 X70.7123 Y30.5583
+G1 X70.7520 Y30.5887
+G1 X70.7917 Y30.6191
+G1 X70.8314 Y30.6495
+G1 X70.8711 Y30.6800
+G1 X70.9107 Y30.7104
+G1 X70.9504 Y30.7409
+G1 X70.9900 Y30.7714
+G1 X71.0296 Y30.8019
+G1 X71.0692 Y30.8325
+G1 X71.1088 Y30.8630
+G1 X71.1483 Y30.8936
+G1 X71.1879 Y30.9242
+G1 X71.2274 Y30.9548
+G1 X71.2669 Y30.9854
+G1 X71.3064 Y31.0161
+G1 X71.3459 Y31.0468
+G1 X71.3854 Y31.0775
+G1 X71.4248 Y31.1082
+G1 X71.4643 Y31.1389
+G1 X71.5037 Y31.1697
+G1 X71.5431 Y31.2005
+G1 X71.5825 Y31.2312
+G1 X71.6219 Y31.2621
+G1 X71.6612 Y31.2929
+G1 X71.7006 Y31.3237
+G1 X71.7399 Y31.3546
+G1 X71.7792 Y31.3855
+G1 X71.8185 Y31.4164
+G1 X71.8578 Y31.4474
+G1 X71.8971 Y31.4783
+G1 X71.9363 Y31.5093
+G1 X71.9756 Y31.5403
+G1 X72.0148 Y31.5713
+G1 X72.0540 Y31.6023
+G1 X72.0932 Y31.6334
+G1 X72.1324 Y31.6644
+G1 X72.1715 Y31.6955
+G1 X72.2107 Y31.7266
+G1 X72.2498 Y31.7578
+G1 X72.2889 Y31.7889
+G1 X72.3280 Y31.8201
+G1 X72.3671 Y31.8513
+G1 X72.4062 Y31.8825
+G1 X72.4452 Y31.9137
+G1 X72.4842 Y31.9449
+G1 X72.5233 Y31.9762
+G1 X72.5623 Y32.0075
+G1 X72.6013 Y32.0388
+G1 X72.6402 Y32.0701
+G1 X72.6792 Y32.1014
+G1 X72.7181 Y32.1328
+G1 X72.7571 Y32.1642
+G1 X72.7960 Y32.1956
+G1 X72.8349 Y32.2270
+G1 X72.8737 Y32.2584
+G1 X72.9126 Y32.2899
+G1 X72.9515 Y32.3214
+G1 X72.9903 Y32.3529
+G1 X73.0291 Y32.3844
+G1 X73.0679 Y32.4159
+G1 X73.1067 Y32.4475
+G1 X73.1455 Y32.4791
+G1 X73.1842 Y32.5107
+G1 X73.2229 Y32.5423
+G1 X73.2617 Y32.5739
+G1 X73.3004 Y32.6056
+G1 X73.3391 Y32.6372
+G1 X73.3777 Y32.6689
+G1 X73.4164 Y32.7006
+G1 X73.4550 Y32.7324
+G1 X73.4937 Y32.7641
+G1 X73.5323 Y32.7959
+G1 X73.5709 Y32.8277
+G1 X73.6094 Y32.8595
+G1 X73.6480 Y32.8913
+G1 X73.6865 Y32.9232
+G1 X73.7251 Y32.9550
+G1 X73.7636 Y32.9869
+G1 X73.8021 Y33.0188
+G1 X73.8406 Y33.0507
+G1 X73.8790 Y33.0827
+G1 X73.9175 Y33.1146
+G1 X73.9559 Y33.1466
+G1 X73.9943 Y33.1786
+G1 X74.0327 Y33.2106
+G1 X74.0711 Y33.2427
+G1 X74.1095 Y33.2747
+G1 X74.1479 Y33.3068
+G1 X74.1862 Y33.3389
+G1 X74.2245 Y33.3710
+G1 X74.2628 Y33.4032
+G1 X74.3011 Y33.4353
+G1 X74.3394 Y33.4675
+G1 X74.3776 Y33.4997
+G1 X74.4159 Y33.5319
+G1 X74.4541 Y33.5641
+G1 X74.4923 Y33.5964
+G1 X74.5305 Y33.6286
+G1 X74.5687 Y33.6609
+G1 X74.6069 Y33.6932
+G1 X74.6450 Y33.7256
+G1 X74.6831 Y33.7579
+G1 X74.7212 Y33.7903
+G1 X74.7593 Y33.8226
+G1 X74.7974 Y33.8550
+G1 X74.8355 Y33.8875
+G1 X74.8735 Y33.9199
+G1 X74.9116 Y33.9524
+G1 X74.9496 Y33.9848
+G1 X74.9876 Y34.0173
+G1 X75.0256 Y34.0499
+G1 X75.0635 Y34.0824
+G1 X75.1015 Y34.1149
+G1 X75.1394 Y34.1475
+G1 X75.1773 Y34.1801
+G1 X75.2152 Y34.2127
+G1 X75.2531 Y34.2453
+G1 X75.2910 Y34.2780
+G1 X75.3288 Y34.3107
+G1 X75.3667 Y34.3434
+G1 X75.4045 Y34.3761
+G1 X75.4423 Y34.4088
+G1 X75.4801 Y34.4415
+G1 X75.5179 Y34.4743
+G1 X75.5556 Y34.5071
+G1 X75.5934 Y34.5399
+G1 X75.6311 Y34.5727
+G1 X75.6688 Y34.6055
+G1 X75.7065 Y34.6384
+G1 X75.7441 Y34.6713
+G1 X75.7818 Y34.7041
+G1 X75.8194 Y34.7371
+G1 X75.8571 Y34.7700
+G1 X75.8947 Y34.8029
+G1 X75.9323 Y34.8359
+G1 X75.9698 Y34.8689
+G1 X76.0074 Y34.9019
+G1 X76.0449 Y34.9349
+G1 X76.0825 Y34.9680
+G1 X76.1200 Y35.0010
+G1 X76.1575 Y35.0341
+G1 X76.1949 Y35.0672
+G1 X76.2324 Y35.1003
+G1 X76.2698 Y35.1335
+G1 X76.3073 Y35.1666
+G1 X76.3447 Y35.1998
+G1 X76.3821 Y35.2330
+G1 X76.4194 Y35.2662
+G1 X76.4568 Y35.2994
+G1 X76.4941 Y35.3327
+G1 X76.5315 Y35.3660
+G1 X76.5688 Y35.3993
+G1 X76.6061 Y35.4326
+G1 X76.6433 Y35.4659
+G1 X76.6806 Y35.4992
+G1 X76.7178 Y35.5326
+G1 X76.7551 Y35.5660
+G1 X76.7923 Y35.5994
+G1 X76.8295 Y35.6328
+G1 X76.8666 Y35.6662
+G1 X76.9038 Y35.6997
+G1 X76.9409 Y35.7332
+G1 X76.9781 Y35.7666
+G1 X77.0152 Y35.8002
+G1 X77.0523 Y35.8337
+G1 X77.0893 Y35.8672
+G1 X77.1264 Y35.9008
+G1 X77.1634 Y35.9344
+G1 X77.2005 Y35.9680
+G1 X77.2375 Y36.0016
+G1 X77.2745 Y36.0353
+G1 X77.3114 Y36.0689
+G1 X77.3484 Y36.1026
+G1 X77.3853 Y36.1363
+G1 X77.4223 Y36.1700
+G1 X77.4592 Y36.2037
+G1 X77.4960 Y36.2375
+G1 X77.5329 Y36.2713
+G1 X77.5698 Y36.3050
+G1 X77.6066 Y36.3388
+G1 X77.6434 Y36.3727
+G1 X77.6802 Y36.4065
+G1 X77.7170 Y36.4404
+G1 X77.7538 Y36.4743
+G1 X77.7906 Y36.5082
+G1 X77.8273 Y36.5421
+G1 X77.8640 Y36.5760
+G1 X77.9007 Y36.6100
+G1 X77.9374 Y36.6439
+G1 X77.9741 Y36.6779
+G1 X78.0107 Y36.7119
+G1 X78.0474 Y36.7460
+G1 X78.0840 Y36.7800
+G1 X78.1206 Y36.8141
+G1 X78.1572 Y36.8482
+G1 X78.1937 Y36.8823
+G1 X78.2303 Y36.9164
+G1 X78.2668 Y36.9505
+G1 X78.3033 Y36.9847
+G1 X78.3398 Y37.0188
+G1 X78.3763 Y37.0530
+G1 X78.4128 Y37.0872
+G1 X78.4492 Y37.1215
+G1 X78.4857 Y37.1557
+G1 X78.5221 Y37.1900
+G1 X78.5585 Y37.2243
+G1 X78.5948 Y37.2586
+G1 X78.6312 Y37.2929
+G1 X78.6676 Y37.3272
+G1 X78.7039 Y37.3616
+G1 X78.7402 Y37.3959
+G1 X78.7765 Y37.4303
+G1 X78.8128 Y37.4647
+G1 X78.8490 Y37.4992
+G1 X78.8853 Y37.5336
+G1 X78.9215 Y37.5681
+G1 X78.9577 Y37.6026
+G1 X78.9939 Y37.6371
+G1 X79.0301 Y37.6716
+G1 X79.0662 Y37.7061
+G1 X79.1024 Y37.7407
+G1 X79.1385 Y37.7753
+G1 X79.1746 Y37.8098
+G1 X79.2107 Y37.8445
+G1 X79.2467 Y37.8791
+G1 X79.2828 Y37.9137
+G1 X79.3188 Y37.9484
+G1 X79.3548 Y37.9831
+G1 X79.3908 Y38.0178
+G1 X79.4268 Y38.0525
+G1 X79.4628 Y38.0872
+G1 X79.4987 Y38.1220
+G1 X79.5347 Y38.1567
+G1 X79.5706 Y38.1915
+G1 X79.6065 Y38.2263
+G1 X79.6423 Y38.2612
+G1 X79.6782 Y38.2960
+G1 X79.7141 Y38.3309
+G1 X79.7499 Y38.3657
+G1 X79.7857 Y38.4006
+G1 X79.8215 Y38.4356
+G1 X79.8573 Y38.4705
+G1 X79.8930 Y38.5054
+G1 X79.9287 Y38.5404
+G1 X79.9645 Y38.5754
+G1 X80.0002 Y38.6104
+G1 X80.0359 Y38.6454
+G1 X80.0715 Y38.6805
+G1 X80.1072 Y38.7155
+G1 X80.1428 Y38.7506
+G1 X80.1784 Y38.7857
+G1 X80.2140 Y38.8208
+G1 X80.2496 Y38.8559
+G1 X80.2852 Y38.8911
+G1 X80.3207 Y38.9262
+G1 X80.3562 Y38.9614
+G1 X80.3918 Y38.9966
+G1 X80.4272 Y39.0318
+G1 X80.4627 Y39.0671
+G1 X80.4982 Y39.1023
+G1 X80.5336 Y39.1376
+G1 X80.5690 Y39.1729
+G1 X80.6044 Y39.2082
+G1 X80.6398 Y39.2435
+G1 X80.6752 Y39.2788
+G1 X80.7106 Y39.3142
+G1 X80.7459 Y39.3496
+G1 X80.7812 Y39.3850
+G1 X80.8165 Y39.4204
+G1 X80.8518 Y39.4558
+G1 X80.8870 Y39.4913
+G1 X80.9223 Y39.5267
+G1 X80.9575 Y39.5622
+G1 X80.9927 Y39.5977
+G1 X81.0279 Y39.6332
+G1 X81.0631 Y39.6688
+G1 X81.0983 Y39.7043
+G1 X81.1334 Y39.7399
+G1 X81.1685 Y39.7755
+G1 X81.2036 Y39.8111
+G1 X81.2387 Y39.8467
+G1 X81.2738 Y39.8823
+G1 X81.3088 Y39.9180
+G1 X81.3439 Y39.9537
+G1 X81.3789 Y39.9894
+G1 X81.4139 Y40.0251
+G1 X81.4488 Y40.0608
+G1 X81.4838 Y40.0966
+G1 X81.5187 Y40.1323
+G1 X81.5537 Y40.1681
+G1 X81.5886 Y40.2039
+G1 X81.6235 Y40.2397
+G1 X81.6583 Y40.2755
+G1 X81.6932 Y40.3114
+G1 X81.7280 Y40.3473
+G1 X81.7628 Y40.3831
+G1 X81.7976 Y40.4191
+G1 X81.8324 Y40.4550
+G1 X81.8672 Y40.4909
+G1 X81.9019 Y40.5269
+G1 X81.9367 Y40.5628
+G1 X81.9714 Y40.5988
+G1 X82.0061 Y40.6348
+G1 X82.0407 Y40.6709
+G1 X82.0754 Y40.7069
+G1 X82.1100 Y40.7430
+G1 X82.1446 Y40.7790
+G1 X82.1792 Y40.8151
+G1 X82.2138 Y40.8512
+G1 X82.2484 Y40.8874
+G1 X82.2829 Y40.9235
+G1 X82.3175 Y40.9597
+G1 X82.3520 Y40.9959
+G1 X82.3865 Y41.0320
+G1 X82.4210 Y41.0683
+G1 X82.4554 Y41.1045
+G1 X82.4898 Y41.1407
+G1 X82.5243 Y41.1770
+G1 X82.5587 Y41.2133
+G1 X82.5931 Y41.2496
+G1 X82.6274 Y41.2859
+G1 X82.6618 Y41.3222
+G1 X82.6961 Y41.3586
+G1 X82.7304 Y41.3950
+G1 X82.7647 Y41.4314
+G1 X82.7990 Y41.4678
+G1 X82.8332 Y41.5042
+G1 X82.8675 Y41.5406
+G1 X82.9017 Y41.5771
+G1 X82.9359 Y41.6135
+G1 X82.9701 Y41.6500
+G1 X83.0042 Y41.6865
+G1 X83.0384 Y41.7231
+G1 X83.0725 Y41.7596
+G1 X83.1066 Y41.7962
+G1 X83.1407 Y41.8327
+G1 X83.1748 Y41.8693
+G1 X83.2089 Y41.9059
+G1 X83.2429 Y41.9426
+G1 X83.2769 Y41.9792
+G1 X83.3109 Y42.0159
+G1 X83.3449 Y42.0525
+G1 X83.3789 Y42.0892
+G1 X83.4128 Y42.1259
+G1 X83.4467 Y42.1627
+G1 X83.4807 Y42.1994
+G1 X83.5145 Y42.2362
+G1 X83.5484 Y42.2730
+G1 X83.5823 Y42.3097
+G1 X83.6161 Y42.3466
+G1 X83.6499 Y42.3834
+G1 X83.6837 Y42.4202
+G1 X83.7175 Y42.4571
+G1 X83.7513 Y42.4940
+G1 X83.7850 Y42.5309
+G1 X83.8187 Y42.5678
+G1 X83.8524 Y42.6047
+G1 X83.8861 Y42.6417
+G1 X83.9198 Y42.6786
+G1 X83.9534 Y42.7156
+G1 X83.9871 Y42.7526
+G1 X84.0207 Y42.7896
+G1 X84.0543 Y42.8267
+G1 X84.0879 Y42.8637
+G1 X84.1214 Y42.9008
+G1 X84.1550 Y42.9378
+G1 X84.1885 Y42.9749
+G1 X84.2220 Y43.0121
+G1 X84.2555 Y43.0492
+G1 X84.2889 Y43.0863
+G1 X84.3224 Y43.1235
+G1 X84.3558 Y43.1607
+G1 X84.3892 Y43.1979
+G1 X84.4226 Y43.2351
+G1 X84.4560 Y43.2723
+G1 X84.4894 Y43.3096
+G1 X84.5227 Y43.3468
+G1 X84.5560 Y43.3841
+G1 X84.5893 Y43.4214
+G1 X84.6226 Y43.4587
+G1 X84.6558 Y43.4961
+G1 X84.6891 Y43.5334
+G1 X84.7223 Y43.5708
+G1 X84.7555 Y43.6082
+G1 X84.7887 Y43.6456
+G1 X84.8219 Y43.6830
+G1 X84.8550 Y43.7204
+G1 X84.8882 Y43.7579
+G1 X84.9213 Y43.7953
+G1 X84.9544 Y43.8328
+G1 X84.9874 Y43.8703
+G1 X85.0205 Y43.9078
+G1 X85.0535 Y43.9454
+G1 X85.0865 Y43.9829
+G1 X85.1195 Y44.0205
+G1 X85.1525 Y44.0580
+G1 X85.1855 Y44.0956
+G1 X85.2184 Y44.1333
+G1 X85.2513 Y44.1709
+G1 X85.2843 Y44.2085
+G1 X85.3171 Y44.2462
+G1 X85.3500 Y44.2839
+G1 X85.3829 Y44.3216
+G1 X85.4157 Y44.3593
+G1 X85.4485 Y44.3970
+G1 X85.4813 Y44.4348
+G1 X85.5141 Y44.4725
+G1 X85.5468 Y44.5103
+G1 X85.5796 Y44.5481
+G1 X85.6123 Y44.5859
+G1 X85.6450 Y44.6237
+G1 X85.6776 Y44.6616
+G1 X85.7103 Y44.6994
+G1 X85.7429 Y44.7373
+G1 X85.7756 Y44.7752
+G1 X85.8082 Y44.8131
+G1 X85.8408 Y44.8510
+G1 X85.8733 Y44.8890
+G1 X85.9059 Y44.9269
+G1 X85.9384 Y44.9649
+G1 X85.9709 Y45.0029
+G1 X86.0034 Y45.0409
+G1 X86.0359 Y45.0789
+G1 X86.0683 Y45.1170
+G1 X86.1007 Y45.1550
+G1 X86.1332 Y45.1931
+G1 X86.1655 Y45.2312
+G1 X86.1979 Y45.2693
+G1 X86.2303 Y45.3074
+G1 X86.2626 Y45.3455
+G1 X86.2949 Y45.3837
+G1 X86.3272 Y45.4219
+G1 X86.3595 Y45.4600
+G1 X86.3918 Y45.4982
+G1 X86.4240 Y45.5365
+G1 X86.4562 Y45.5747
+G1 X86.4884 Y45.6129
+G1 X86.5206 Y45.6512
+G1 X86.5528 Y45.6895
+G1 X86.5849 Y45.7278
+G1 X86.6171 Y45.7661
+G1 X86.6492 Y45.8044
+G1 X86.6813 Y45.8428
+G1 X86.7133 Y45.8811
+G1 X86.7454 Y45.9195
+G1 X86.7774 Y45.9579
+G1 X86.8094 Y45.9963
+G1 X86.8414 Y46.0347
+G1 X86.8734 Y46.0732
+G1 X86.9053 Y46.1116
+G1 X86.9373 Y46.1501
+G1 X86.9692 Y46.1886
+G1 X87.0011 Y46.2271
+G1 X87.0330 Y46.2656
+G1 X87.0648 Y46.3042
+G1 X87.0967 Y46.3427
+G1 X87.1285 Y46.3813
+G1 X87.1603 Y46.4199
+G1 X87.1921 Y46.4585
+G1 X87.2238 Y46.4971
+G1 X87.2556 Y46.5357
+G1 X87.2873 Y46.5744
+G1 X87.3190 Y46.6130
+G1 X87.3507 Y46.6517
+G1 X87.3823 Y46.6904
+G1 X87.4140 Y46.7291
+G1 X87.4456 Y46.7678
+G1 X87.4772 Y46.8066
+G1 X87.5088 Y46.8453
+G1 X87.5404 Y46.8841
+G1 X87.5719 Y46.9229
+G1 X87.6034 Y46.9617
+G1 X87.6349 Y47.0005
+G1 X87.6664 Y47.0394
+G1 X87.6979 Y47.0782
+G1 X87.7294 Y47.1171
+G1 X87.7608 Y47.1560
+G1 X87.7922 Y47.1949
+G1 X87.8236 Y47.2338
+G1 X87.8550 Y47.2727
+G1 X87.8863 Y47.3117
+G1 X87.9177 Y47.3506
+G1 X87.9490 Y47.3896
+G1 X87.9803 Y47.4286
+G1 X88.0115 Y47.4676
+G1 X88.0428 Y47.5066
+G1 X88.0740 Y47.5457
+G1 X88.1053 Y47.5847
+G1 X88.1365 Y47.6238
+G1 X88.1676 Y47.6629
+G1 X88.1988 Y47.7020
+G1 X88.2299 Y47.7411
+G1 X88.2610 Y47.7803
+G1 X88.2921 Y47.8194
+G1 X88.3232 Y47.8586
+G1 X88.3543 Y47.8978
+G1 X88.3853 Y47.9370
+G1 X88.4164 Y47.9762
+G1 X88.4474 Y48.0154
+G1 X88.4783 Y48.0547
+G1 X88.5093 Y48.0939
+G1 X88.5402 Y48.1332
+G1 X88.5712 Y48.1725
+G1 X88.6021 Y48.2118
+G1 X88.6330 Y48.2511
+G1 X88.6638 Y48.2904
+G1 X88.6947 Y48.3298
+G1 X88.7255 Y48.3692
+G1 X88.7563 Y48.4085
+G1 X88.7871 Y48.4479
+G1 X88.8178 Y48.4874
+G1 X88.8486 Y48.5268
+G1 X88.8793 Y48.5662
+G1 X88.9100 Y48.6057
+G1 X88.9407 Y48.6452
+G1 X88.9714 Y48.6847
+G1 X89.0020 Y48.7242
+G1 X89.0327 Y48.7637
+G1 X89.0633 Y48.8032
+G1 X89.0939 Y48.8428
+G1 X89.1244 Y48.8823
+G1 X89.1550 Y48.9219
+G1 X89.1855 Y48.9615
+G1 X89.2160 Y49.0011
+G1 X89.2465 Y49.0408
+G1 X89.2770 Y49.0804
+G1 X89.3074 Y49.1201
+G1 X89.3379 Y49.1597
+G1 X89.3683 Y49.1994
+G1 X89.3987 Y49.2391
+G1 X89.4290 Y49.2788
+G1 X89.4594 Y49.3186
+G1 X89.4897 Y49.3583
+G1 X89.5200 Y49.3981
+G1 X89.5503 Y49.4379
+G1 X89.5806 Y49.4777
+G1 X89.6108 Y49.5175
+G1 X89.6411 Y49.5573
+G1 X89.6713 Y49.5971
+G1 X89.7015 Y49.6370
+G1 X89.7316 Y49.6769
+G1 X89.7618 Y49.7168
+G1 X89.7919 Y49.7567
+G1 X89.8220 Y49.7966
+G1 X89.8521 Y49.8365
+G1 X89.8822 Y49.8765
+G1 X89.9122 Y49.9164
+G1 X89.9423 Y49.9564
+G1 X89.9723 Y49.9964
+G1 X90.0023 Y50.0364
+G1 X90.0323 Y50.0764
+G1 X90.0622 Y50.1164
+G1 X90.0921 Y50.1565
+G1 X90.1220 Y50.1966
+G1 X90.1519 Y50.2366
+G1 X90.1818 Y50.2767
+G1 X90.2117 Y50.3168
+G1 X90.2415 Y50.3570
+G1 X90.2713 Y50.3971
+G1 X90.3011 Y50.4373
+G1 X90.3309 Y50.4774
+G1 X90.3606 Y50.5176
+G1 X90.3903 Y50.5578
+G1 X90.4201 Y50.5980
+G1 X90.4498 Y50.6383
+G1 X90.4794 Y50.6785
+G1 X90.5091 Y50.7188
+G1 X90.5387 Y50.7591
+G1 X90.5683 Y50.7993
+G1 X90.5979 Y50.8396
+G1 X90.6275 Y50.8800
+G1 X90.6570 Y50.9203
+G1 X90.6866 Y50.9606
+G1 X90.7161 Y51.0010
+G1 X90.7456 Y51.0414
+G1 X90.7750 Y51.0818
+G1 X90.8045 Y51.1222
+G1 X90.8339 Y51.1626
+G1 X90.8633 Y51.2030
+G1 X90.8927 Y51.2435
+G1 X90.9221 Y51.2840
+G1 X90.9514 Y51.3244
+G1 X90.9807 Y51.3649
+G1 X91.0100 Y51.4054
+G1 X91.0393 Y51.4460
+G1 X91.0686 Y51.4865
+G1 X91.0978 Y51.5271
+G1 X91.1271 Y51.5676
+G1 X91.1563 Y51.6082
+G1 X91.1855 Y51.6488
+G1 X91.2146 Y51.6894
+G1 X91.2438 Y51.7301
+G1 X91.2729 Y51.7707
+G1 X91.3020 Y51.8114
+G1 X91.3311 Y51.8520
+G1 X91.3602 Y51.8927
+G1 X91.3892 Y51.9334
+G1 X91.4182 Y51.9741
+G1 X91.4472 Y52.0149
+G1 X91.4762 Y52.0556
+G1 X91.5052 Y52.0964
+G1 X91.5341 Y52.1371
+G1 X91.5630 Y52.1779
+G1 X91.5919 Y52.2187
+G1 X91.6208 Y52.2595
+G1 X91.6497 Y52.3004
+G1 X91.6785 Y52.3412
+G1 X91.7073 Y52.3821
+G1 X91.7361 Y52.4229
+G1 X91.7649 Y52.4638
+G1 X91.7937 Y52.5047
+G1 X91.8224 Y52.5456
+G1 X91.8511 Y52.5866
+G1 X91.8798 Y52.6275
+G1 X91.9085 Y52.6685
+G1 X91.9371 Y52.7095
+G1 X91.9658 Y52.7504
+G1 X91.9944 Y52.7914
+G1 X92.0230 Y52.8325
+G1 X92.0516 Y52.8735
+G1 X92.0801 Y52.9145
+G1 X92.1087 Y52.9556
+G1 X92.1372 Y52.9967
+G1 X92.1657 Y53.0378
+G1 X92.1941 Y53.0789
+G1 X92.2226 Y53.1200
+G1 X92.2510 Y53.1611
+G1 X92.2794 Y53.2023
+G1 X92.3078 Y53.2434
+G1 X92.3362 Y53.2846
+G1 X92.3645 Y53.3258
+G1 X92.3928 Y53.3670
+G1 X92.4212 Y53.4082
+G1 X92.4494 Y53.4494
+G1 X92.4777 Y53.4907
+G1 X92.5059 Y53.5319
+G1 X92.5342 Y53.5732
+G1 X92.5624 Y53.6145
+G1 X92.5906 Y53.6558
+G1 X92.6187 Y53.6971
+G1 X92.6469 Y53.7384
+G1 X92.6750 Y53.7798
+G1 X92.7031 Y53.8211
+G1 X92.7312 Y53.8625
+G1 X92.7592 Y53.9039
+G1 X92.7873 Y53.9453
+G1 X92.8153 Y53.9867
+G1 X92.8433 Y54.0281
+G1 X92.8712 Y54.0696
+G1 X92.8992 Y54.1110
+G1 X92.9271 Y54.1525
+G1 X92.9550 Y54.1940
+G1 X92.9829 Y54.2355
+G1 X93.0108 Y54.2770
+G1 X93.0387 Y54.3185
+G1 X93.0665 Y54.3600
+G1 X93.0943 Y54.4016
+G1 X93.1221 Y54.4432
+G1 X93.1499 Y54.4847
+G1 X93.1776 Y54.5263
+G1 X93.2053 Y54.5679
+G1 X93.2330 Y54.6096
+G1 X93.2607 Y54.6512
+G1 X93.2884 Y54.6929
+G1 X93.3160 Y54.7345
+G1 X93.3437 Y54.7762
+G1 X93.3713 Y54.8179
+G1 X93.3988 Y54.8596
+G1 X93.4264 Y54.9013
+G1 X93.4539 Y54.9430
+G1 X93.4815 Y54.9848
+G1 X93.5089 Y55.0266
+G1 X93.5364 Y55.0683
+G1 X93.5639 Y55.1101
+G1 X93.5913 Y55.1519
+G1 X93.6187 Y55.1937
+G1 X93.6461 Y55.2356
+G1 X93.6735 Y55.2774
+G1 X93.7008 Y55.3193
+G1 X93.7282 Y55.3611
+G1 X93.7555 Y55.4030
+G1 X93.7828 Y55.4449
+G1 X93.8100 Y55.4868
+G1 X93.8373 Y55.5287
+G1 X93.8645 Y55.5707
+G1 X93.8917 Y55.6126
+G1 X93.9189 Y55.6546
+G1 X93.9461 Y55.6966
+G1 X93.9732 Y55.7386
+G1 X94.0003 Y55.7806
+G1 X94.0274 Y55.8226
+G1 X94.0545 Y55.8646
+G1 X94.0816 Y55.9067
+G1 X94.1086 Y55.9487
+G1 X94.1356 Y55.9908
+G1 X94.1626 Y56.0329
+G1 X94.1896 Y56.0750
+G1 X94.2165 Y56.1171
+G1 X94.2435 Y56.1592
+G1 X94.2704 Y56.2014
+G1 X94.2973 Y56.2435
+G1 X94.3241 Y56.2857
+G1 X94.3510 Y56.3279
+G1 X94.3778 Y56.3701
+G1 X94.4046 Y56.4123
+G1 X94.4314 Y56.4545
+G1 X94.4581 Y56.4967
+G1 X94.4849 Y56.5390
+G1 X94.5116 Y56.5812
+G1 X94.5383 Y56.6235
+G1 X94.5650 Y56.6658
+G1 X94.5916 Y56.7081
+G1 X94.6183 Y56.7504
+G1 X94.6449 Y56.7928
+G1 X94.6715 Y56.8351
+G1 X94.6981 Y56.8775
+G1 X94.7246 Y56.9198
+G1 X94.7511 Y56.9622
+G1 X94.7776 Y57.0046
+G1 X94.8041 Y57.0470
+G1 X94.8306 Y57.0894
+G1 X94.8570 Y57.1319
+G1 X94.8835 Y57.1743
+G1 X94.9099 Y57.2168
+G1 X94.9362 Y57.2592
+G1 X94.9626 Y57.3017
+G1 X94.9889 Y57.3442
+G1 X95.0153 Y57.3867
+G1 X95.0416 Y57.4293
+G1 X95.0678 Y57.4718
+G1 X95.0941 Y57.5144
+G1 X95.1203 Y57.5569
+G1 X95.1465 Y57.5995
+G1 X95.1727 Y57.6421
+G1 X95.1989 Y57.6847
+G1 X95.2250 Y57.7273
+G1 X95.2512 Y57.7700
+G1 X95.2773 Y57.8126
+G1 X95.3033 Y57.8553
+G1 X95.3294 Y57.8979
+G1 X95.3554 Y57.9406
+G1 X95.3815 Y57.9833
+G1 X95.4075 Y58.0260
+G1 X95.4334 Y58.0687
+G1 X95.4594 Y58.1115
+G1 X95.4853 Y58.1542
+G1 X95.5112 Y58.1970
+G1 X95.5371 Y58.2398
+G1 X95.5630 Y58.2826
+G1 X95.5888 Y58.3254
+G1 X95.6147 Y58.3682
+G1 X95.6405 Y58.4110
+G1 X95.6663 Y58.4538
+G1 X95.6920 Y58.4967
+G1 X95.7178 Y58.5395
+G1 X95.7435 Y58.5824
+G1 X95.7692 Y58.6253
+G1 X95.7949 Y58.6682
+G1 X95.8205 Y58.7111
+G1 X95.8462 Y58.7541
+G1 X95.8718 Y58.7970
+G1 X95.8974 Y58.8400
+G1 X95.9229 Y58.8829
+G1 X95.9485 Y58.9259
+G1 X95.9740 Y58.9689
+G1 X95.9995 Y59.0119
+G1 X96.0250 Y59.0549
+G1 X96.0504 Y59.0980
+G1 X96.0759 Y59.1410
+G1 X96.1013 Y59.1841
+G1 X96.1267 Y59.2271
+G1 X96.1521 Y59.2702
+G1 X96.1774 Y59.3133
+G1 X96.2028 Y59.3564
+G1 X96.2281 Y59.3995
+G1 X96.2534 Y59.4427
+G1 X96.2786 Y59.4858
+G1 X96.3039 Y59.5290
+G1 X96.3291 Y59.5721
+G1 X96.3543 Y59.6153
+G1 X96.3795 Y59.6585
+G1 X96.4046 Y59.7017
+G1 X96.4298 Y59.7449
+G1 X96.4549 Y59.7882
+G1 X96.4800 Y59.8314
+G1 X96.5051 Y59.8747
+G1 X96.5301 Y59.9180
+G1 X96.5552 Y59.9612
+G1 X96.5802 Y60.0045
+G1 X96.6052 Y60.0478
+G1 X96.6301 Y60.0912
+G1 X96.6551 Y60.1345
+G1 X96.6800 Y60.1778
+G1 X96.7049 Y60.2212
+G1 X96.7298 Y60.2646
+G1 X96.7546 Y60.3080
+G1 X96.7795 Y60.3514
+G1 X96.8043 Y60.3948
+G1 X96.8291 Y60.4382
+G1 X96.8538 Y60.4816
+G1 X96.8786 Y60.5251
+G1 X96.9033 Y60.5685
+G1 X96.9280 Y60.6120
+G1 X96.9527 Y60.6555
+G1 X96.9774 Y60.6990
+G1 X97.0020 Y60.7425
+G1 X97.0266 Y60.7860
+G1 X97.0512 Y60.8295
+G1 X97.0758 Y60.8731
+G1 X97.1003 Y60.9166
+G1 X97.1249 Y60.9602
+G1 X97.1494 Y61.0038
+G1 X97.1739 Y61.0474
+G1 X97.1983 Y61.0910
+G1 X97.2228 Y61.1346
+G1 X97.2472 Y61.1782
+G1 X97.2716 Y61.2219
+G1 X97.2960 Y61.2655
+G1 X97.3203 Y61.3092
+G1 X97.3447 Y61.3529
+G1 X97.3690 Y61.3966
+G1 X97.3933 Y61.4403
+G1 X97.4175 Y61.4840
+G1 X97.4418 Y61.5277
+G1 X97.4660 Y61.5714
+G1 X97.4902 Y61.6152
+G1 X97.5144 Y61.6590
+G1 X97.5385 Y61.7027
+G1 X97.5627 Y61.7465
+G1 X97.5868 Y61.7903
+G1 X97.6109 Y61.8341
+G1 X97.6350 Y61.8780
+G1 X97.6590 Y61.9218
+G1 X97.6830 Y61.9656
+G1 X97.7071 Y62.0095
+G1 X97.7310 Y62.0534
+G1 X97.7550 Y62.0973
+G1 X97.7789 Y62.1412
+G1 X97.8029 Y62.1851
+G1 X97.8268 Y62.2290
+G1 X97.8506 Y62.2729
+G1 X97.8745 Y62.3169
+G1 X97.8983 Y62.3608
+G1 X97.9221 Y62.4048
+G1 X97.9459 Y62.4488
+G1 X97.9697 Y62.4928
+G1 X97.9934 Y62.5368
+G1 X98.0171 Y62.5808
+G1 X98.0408 Y62.6248
+G1 X98.0645 Y62.6688
+G1 X98.0882 Y62.7129
+G1 X98.1118 Y62.7570
+G1 X98.1354 Y62.8010
+G1 X98.1590 Y62.8451
+G1 X98.1826 Y62.8892
+G1 X98.2061 Y62.9333
+G1 X98.2296 Y62.9774
+G1 X98.2531 Y63.0216
+G1 X98.2766 Y63.0657
+G1 X98.3001 Y63.1099
+G1 X98.3235 Y63.1540
+G1 X98.3469 Y63.1982
+G1 X98.3703 Y63.2424
+G1 X98.3937 Y63.2866
+G1 X98.4170 Y63.3308
+G1 X98.4403 Y63.3751
+G1 X98.4636 Y63.4193
+G1 X98.4869 Y63.4636
+G1 X98.5102 Y63.5078
+G1 X98.5334 Y63.5521
+G1 X98.5566 Y63.5964
+G1 X98.5798 Y63.6407
+G1 X98.6030 Y63.6850
+G1 X98.6261 Y63.7293
+G1 X98.6493 Y63.7736
+G1 X98.6724 Y63.8180
+G1 X98.6954 Y63.8623
+G1 X98.7185 Y63.9067
+G1 X98.7415 Y63.9511
+G1 X98.7645 Y63.9955
+G1 X98.7875 Y64.0399
+G1 X98.8105 Y64.0843
+G1 X98.8334 Y64.1287
+G1 X98.8564 Y64.1731
+G1 X98.8793 Y64.2176
+G1 X98.9022 Y64.2620
+G1 X98.9250 Y64.3065
+G1 X98.9478 Y64.3510
+G1 X98.9707 Y64.3955
+G1 X98.9935 Y64.4400
+G1 X99.0162 Y64.4845
+G1 X99.0390 Y64.5290
+G1 X99.0617 Y64.5736
+G1 X99.0844 Y64.6181
+G1 X99.1071 Y64.6627
+G1 X99.1297 Y64.7072
+G1 X99.1524 Y64.7518
+G1 X99.1750 Y64.7964
+G1 X99.1976 Y64.8410
+G1 X99.2201 Y64.8856
+G1 X99.2427 Y64.9303
+G1 X99.2652 Y64.9749
+G1 X99.2877 Y65.0196
+G1 X99.3102 Y65.0642
+G1 X99.3326 Y65.1089
+G1 X99.3551 Y65.1536
+G1 X99.3775 Y65.1983
+G1 X99.3999 Y65.2430
+G1 X99.4222 Y65.2877
+G1 X99.4446 Y65.3324
+G1 X99.4669 Y65.3772
+G1 X99.4892 Y65.4219
+G1 X99.5115 Y65.4667
+G1 X99.5338 Y65.5115
+G1 X99.5560 Y65.5562
+G1 X99.5782 Y65.6010
+G1 X99.6004 Y65.6458
+G1 X99.6225 Y65.6907
+G1 X99.6447 Y65.7355
+G1 X99.6668 Y65.7803
+G1 X99.6889 Y65.8252
+G1 X99.7110 Y65.8700
+G1 X99.7330 Y65.9149
+G1 X99.7551 Y65.9598
+G1 X99.7771 Y66.0047
+G1 X99.7991 Y66.0496
+G1 X99.8210 Y66.0945
+G1 X99.8430 Y66.1395
+G1 X99.8649 Y66.1844
+G1 X99.8868 Y66.2293
+G1 X99.9087 Y66.2743
+G1 X99.9305 Y66.3193
+G1 X99.9523 Y66.3643
+G1 X99.9742 Y66.4093
+G1 X99.9959 Y66.4543
+G1 X100.0177 Y66.4993
+G1 X100.0394 Y66.5443
+G1 X100.0612 Y66.5893
+G1 X100.0828 Y66.6344
+G1 X100.1045 Y66.6794
+G1 X100.1262 Y66.7245
+G1 X100.1478 Y66.7696
+G1 X100.1694 Y66.8147
+G1 X100.1910 Y66.8598
+G1 X100.2125 Y66.9049
+G1 X100.2341 Y66.9500
+G1 X100.2556 Y66.9952
+G1 X100.2771 Y67.0403
+G1 X100.2985 Y67.0855
+G1 X100.3200 Y67.1306
+G1 X100.3414 Y67.1758
+G1 X100.3628 Y67.2210
+G1 X100.3842 Y67.2662
+G1 X100.4056 Y67.3114
+G1 X100.4269 Y67.3566
+G1 X100.4482 Y67.4019
+G1 X100.4695 Y67.4471
+G1 X100.4907 Y67.4924
+G1 X100.5120 Y67.5376
+G1 X100.5332 Y67.5829
+G1 X100.5544 Y67.6282
+G1 X100.5756 Y67.6735
+G1 X100.5967 Y67.7188
+G1 X100.6179 Y67.7641
+G1 X100.6390 Y67.8094
+G1 X100.6601 Y67.8548
+G1 X100.6811 Y67.9001
+G1 X100.7022 Y67.9455
+G1 X100.7232 Y67.9908
+G1 X100.7442 Y68.0362
+G1 X100.7651 Y68.0816
+G1 X100.7861 Y68.1270
+G1 X100.8070 Y68.1724
+G1 X100.8279 Y68.2178
+G1 X100.8488 Y68.2633
+G1 X100.8696 Y68.3087
+G1 X100.8905 Y68.3542
+G1 X100.9113 Y68.3996
+G1 X100.9321 Y68.4451
+G1 X100.9528 Y68.4906
+G1 X100.9736 Y68.5361
+G1 X100.9943 Y68.5816
+G1 X101.0150 Y68.6271
+G1 X101.0357 Y68.6726
+G1 X101.0563 Y68.7182
+G1 X101.0770 Y68.7637
+G1 X101.0976 Y68.8093
+G1 X101.1182 Y68.8548
+G1 X101.1387 Y68.9004
+G1 X101.1593 Y68.9460
+G1 X101.1798 Y68.9916
+G1 X101.2003 Y69.0372
+G1 X101.2207 Y69.0828
+G1 X101.2412 Y69.1284
+G1 X101.2616 Y69.1741
+G1 X101.2820 Y69.2197
+G1 X101.3024 Y69.2654
+G1 X101.3227 Y69.3110
+G1 X101.3431 Y69.3567
+G1 X101.3634 Y69.4024
+G1 X101.3837 Y69.4481
+G1 X101.4039 Y69.4938
+G1 X101.4242 Y69.5395
+G1 X101.4444 Y69.5853
+G1 X101.4646 Y69.6310
+G1 X101.4848 Y69.6768
+G1 X101.5049 Y69.7225
+G1 X101.5250 Y69.7683
+G1 X101.5451 Y69.8141
+G1 X101.5652 Y69.8599
+G1 X101.5853 Y69.9057
+G1 X101.6053 Y69.9515
+G1 X101.6253 Y69.9973
+G1 X101.6453 Y70.0431
+G1 X101.6653 Y70.0890
+G1 X101.6852 Y70.1348
+G1 X101.7052 Y70.1807
+G1 X101.7251 Y70.2265
+G1 X101.7449 Y70.2724
+G1 X101.7648 Y70.3183
+G1 X101.7846 Y70.3642
+G1 X101.8044 Y70.4101
+G1 X101.8242 Y70.4560
+G1 X101.8440 Y70.5020
+G1 X101.8637 Y70.5479
+G1 X101.8834 Y70.5939
+G1 X101.9031 Y70.6398
+G1 X101.9228 Y70.6858
+G1 X101.9424 Y70.7318
+G1 X101.9620 Y70.7778
+G1 X101.9816 Y70.8238
+G1 X102.0012 Y70.8698
+G1 X102.0208 Y70.9158
+G1 X102.0403 Y70.9618
+G1 X102.0598 Y71.0078
+G1 X102.0793 Y71.0539
+G1 X102.0988 Y71.1000
+G1 X102.1182 Y71.1460
+G1 X102.1376 Y71.1921
+G1 X102.1570 Y71.2382
+G1 X102.1764 Y71.2843
+G1 X102.1957 Y71.3304
+G1 X102.2150 Y71.3765
+G1 X102.2343 Y71.4226
+G1 X102.2536 Y71.4688
+G1 X102.2729 Y71.5149
+G1 X102.2921 Y71.5611
+G1 X102.3113 Y71.6072
+G1 X102.3305 Y71.6534
+G1 X102.3497 Y71.6996
+G1 X102.3688 Y71.7458
+G1 X102.3879 Y71.7920
+G1 X102.4070 Y71.8382
+G1 X102.4261 Y71.8844
+G1 X102.4451 Y71.9306
+G1 X102.4641 Y71.9769
+G1 X102.4831 Y72.0231
+G1 X102.5021 Y72.0694
+G1 X102.5211 Y72.1156
+G1 X102.5400 Y72.1619
+G1 X102.5589 Y72.2082
+G1 X102.5778 Y72.2545
+G1 X102.5967 Y72.3008
+G1 X102.6155 Y72.3471
+G1 X102.6343 Y72.3935
+G1 X102.6531 Y72.4398
+G1 X102.6719 Y72.4861
+G1 X102.6906 Y72.5325
+G1 X102.7093 Y72.5788
+G1 X102.7280 Y72.6252
+G1 X102.7467 Y72.6716
+G1 X102.7654 Y72.7180
+G1 X102.7840 Y72.7644
+G1 X102.8026 Y72.8108
+G1 X102.8212 Y72.8572
+G1 X102.8397 Y72.9036
+G1 X102.8583 Y72.9501
+G1 X102.8768 Y72.9965
+G1 X102.8953 Y73.0430
+G1 X102.9138 Y73.0895
+G1 X102.9322 Y73.1359
+G1 X102.9506 Y73.1824
+G1 X102.9690 Y73.2289
+G1 X102.9874 Y73.2754
+G1 X103.0057 Y73.3219
+G1 X103.0241 Y73.3684
+G1 X103.0424 Y73.4150
+G1 X103.0607 Y73.4615
+G1 X103.0789 Y73.5080
+G1 X103.0971 Y73.5546
+G1 X103.1154 Y73.6012
+G1 X103.1335 Y73.6477
+G1 X103.1517 Y73.6943
+G1 X103.1698 Y73.7409
+G1 X103.1880 Y73.7875
+G1 X103.2061 Y73.8341
+G1 X103.2241 Y73.8808
+G1 X103.2422 Y73.9274
+G1 X103.2602 Y73.9740
+G1 X103.2782 Y74.0207
+G1 X103.2962 Y74.0673
+G1 X103.3141 Y74.1140
+G1 X103.3321 Y74.1607
+G1 X103.3500 Y74.2073
+G1 X103.3679 Y74.2540
+G1 X103.3857 Y74.3007
+G1 X103.4036 Y74.3475
+G1 X103.4214 Y74.3942
+G1 X103.4392 Y74.4409
+G1 X103.4569 Y74.4876
+G1 X103.4747 Y74.5344
+G1 X103.4924 Y74.5811
+G1 X103.5101 Y74.6279
+G1 X103.5278 Y74.6747
+G1 X103.5454 Y74.7214
+G1 X103.5631 Y74.7682
+G1 X103.5807 Y74.8150
+G1 X103.5982 Y74.8618
+G1 X103.6158 Y74.9087
+G1 X103.6333 Y74.9555
+G1 X103.6508 Y75.0023
+G1 X103.6683 Y75.0492
+G1 X103.6858 Y75.0960
+G1 X103.7032 Y75.1429
+G1 X103.7206 Y75.1897
+G1 X103.7380 Y75.2366
+G1 X103.7554 Y75.2835
+G1 X103.7728 Y75.3304
+G1 X103.7901 Y75.3773
+G1 X103.8074 Y75.4242
+G1 X103.8247 Y75.4711
+G1 X103.8419 Y75.5181
+G1 X103.8591 Y75.5650
+G1 X103.8763 Y75.6119
+G1 X103.8935 Y75.6589
+G1 X103.9107 Y75.7059
+G1 X103.9278 Y75.7528
+G1 X103.9449 Y75.7998
+G1 X103.9620 Y75.8468
+G1 X103.9791 Y75.8938
+G1 X103.9961 Y75.9408
+G1 X104.0131 Y75.9878
+G1 X104.0301 Y76.0348
+G1 X104.0471 Y76.0819
+G1 X104.0641 Y76.1289
+G1 X104.0810 Y76.1760
+G1 X104.0979 Y76.2230
+G1 X104.1148 Y76.2701
+G1 X104.1316 Y76.3172
+G1 X104.1484 Y76.3642
+G1 X104.1652 Y76.4113
+G1 X104.1820 Y76.4584
+G1 X104.1988 Y76.5055
+G1 X104.2155 Y76.5527
+G1 X104.2322 Y76.5998
+G1 X104.2489 Y76.6469
+G1 X104.2656 Y76.6941
+G1 X104.2822 Y76.7412
+G1 X104.2988 Y76.7884
+G1 X104.3154 Y76.8355
+G1 X104.3320 Y76.8827
+G1 X104.3486 Y76.9299
+G1 X104.3651 Y76.9771
+G1 X104.3816 Y77.0243
+G1 X104.3981 Y77.0715
+G1 X104.4145 Y77.1187
+G1 X104.4309 Y77.1659
+G1 X104.4473 Y77.2132
+G1 X104.4637 Y77.2604
+G1 X104.4801 Y77.3077
+G1 X104.4964 Y77.3549
+G1 X104.5127 Y77.4022
+G1 X104.5290 Y77.4494
+G1 X104.5453 Y77.4967
+G1 X104.5615 Y77.5440
+G1 X104.5777 Y77.5913
+G1 X104.5939 Y77.6386
+G1 X104.6101 Y77.6859
+G1 X104.6262 Y77.7333
+G1 X104.6424 Y77.7806
+G1 X104.6585 Y77.8279
+G1 X104.6745 Y77.8753
+G1 X104.6906 Y77.9226
+G1 X104.7066 Y77.9700
+G1 X104.7226 Y78.0174
+G1 X104.7386 Y78.0647
+G1 X104.7546 Y78.1121
+G1 X104.7705 Y78.1595
+G1 X104.7864 Y78.2069
+G1 X104.8023 Y78.2543
+G1 X104.8181 Y78.3017
+G1 X104.8340 Y78.3492
+G1 X104.8498 Y78.3966
+G1 X104.8656 Y78.4440
+G1 X104.8813 Y78.4915
+G1 X104.8971 Y78.5389
+G1 X104.9128 Y78.5864
+G1 X104.9285 Y78.6339
+G1 X104.9442 Y78.6814
+G1 X104.9598 Y78.7289
+G1 X104.9754 Y78.7763
+G1 X104.9910 Y78.8239
+G1 X105.0066 Y78.8714
+G1 X105.0222 Y78.9189
+G1 X105.0377 Y78.9664
+G1 X105.0532 Y79.0139
+G1 X105.0687 Y79.0615
+G1 X105.0841 Y79.1090
+G1 X105.0996 Y79.1566
+G1 X105.1150 Y79.2042
+G1 X105.1304 Y79.2517
+G1 X105.1457 Y79.2993
+G1 X105.1611 Y79.3469
+G1 X105.1764 Y79.3945
+G1 X105.1917 Y79.4421
+G1 X105.2069 Y79.4897
+G1 X105.2222 Y79.5373
+G1 X105.2374 Y79.5850
+G1 X105.2526 Y79.6326
+G1 X105.2678 Y79.6802
+G1 X105.2829 Y79.7279
+G1 X105.2980 Y79.7756
+G1 X105.3131 Y79.8232
+G1 X105.3282 Y79.8709
+G1 X105.3433 Y79.9186
+G1 X105.3583 Y79.9663
+G1 X105.3733 Y80.0140
+G1 X105.3883 Y80.0617
+G1 X105.4032 Y80.1094
+G1 X105.4182 Y80.1571
+G1 X105.4331 Y80.2048
+G1 X105.4480 Y80.2525
+G1 X105.4628 Y80.3003
+G1 X105.4777 Y80.3480
+G1 X105.4925 Y80.3958
+G1 X105.5073 Y80.4436
+G1 X105.5220 Y80.4913
+G1 X105.5368 Y80.5391
+G1 X105.5515 Y80.5869
+G1 X105.5662 Y80.6347
+G1 X105.5809 Y80.6825
+G1 X105.5955 Y80.7303
+G1 X105.6101 Y80.7781
+G1 X105.6247 Y80.8259
+G1 X105.6393 Y80.8737
+G1 X105.6539 Y80.9216
+G1 X105.6684 Y80.9694
+G1 X105.6829 Y81.0173
+G1 X105.6974 Y81.0651
+G1 X105.7118 Y81.1130
+G1 X105.7263 Y81.1609
+G1 X105.7407 Y81.2087
+G1 X105.7551 Y81.2566
+G1 X105.7694 Y81.3045
+G1 X105.7838 Y81.3524
+G1 X105.7981 Y81.4003
+G1 X105.8124 Y81.4483
+G1 X105.8266 Y81.4962
+G1 X105.8409 Y81.5441
+G1 X105.8551 Y81.5920
+G1 X105.8693 Y81.6400
+G1 X105.8834 Y81.6879
+G1 X105.8976 Y81.7359
+G1 X105.9117 Y81.7839
+G1 X105.9258 Y81.8318
+G1 X105.9399 Y81.8798
+G1 X105.9539 Y81.9278
+G1 X105.9679 Y81.9758
+G1 X105.9819 Y82.0238
+G1 X105.9959 Y82.0718
+G1 X106.0099 Y82.1198
+G1 X106.0238 Y82.1678
+G1 X106.0377 Y82.2159
+G1 X106.0516 Y82.2639
+G1 X106.0654 Y82.3119
+G1 X106.0793 Y82.3600
+G1 X106.0931 Y82.4080
+G1 X106.1069 Y82.4561
+G1 X106.1206 Y82.5042
+G1 X106.1344 Y82.5522
+G1 X106.1481 Y82.6003
+G1 X106.1618 Y82.6484
+G1 X106.1754 Y82.6965
+G1 X106.1891 Y82.7446
+G1 X106.2027 Y82.7927
+G1 X106.2163 Y82.8408
+G1 X106.2298 Y82.8890
+G1 X106.2434 Y82.9371
+G1 X106.2569 Y82.9852
+G1 X106.2704 Y83.0334
+G1 X106.2839 Y83.0815
+G1 X106.2973 Y83.1297
+G1 X106.3107 Y83.1779
+G1 X106.3241 Y83.2260
+G1 X106.3375 Y83.2742
+G1 X106.3509 Y83.3224
+G1 X106.3642 Y83.3706
+G1 X106.3775 Y83.4188
+G1 X106.3908 Y83.4670
+G1 X106.4040 Y83.5152
+G1 X106.4172 Y83.5634
+G1 X106.4305 Y83.6116
+G1 X106.4436 Y83.6599
+G1 X106.4568 Y83.7081
+G1 X106.4699 Y83.7563
+G1 X106.4830 Y83.8046
+G1 X106.4961 Y83.8529
+G1 X106.5092 Y83.9011
+G1 X106.5222 Y83.9494
+G1 X106.5352 Y83.9977
+G1 X106.5482 Y84.0460
+G1 X106.5612 Y84.0942
+G1 X106.5741 Y84.1425
+G1 X106.5870 Y84.1908
+G1 X106.5999 Y84.2391
+G1 X106.6128 Y84.2875
+G1 X106.6257 Y84.3358
+G1 X106.6385 Y84.3841
+G1 X106.6513 Y84.4325
+G1 X106.6640 Y84.4808
+G1 X106.6768 Y84.5291
+G1 X106.6895 Y84.5775
+G1 X106.7022 Y84.6259
+G1 X106.7149 Y84.6742
+G1 X106.7275 Y84.7226
+G1 X106.7402 Y84.7710
+G1 X106.7528 Y84.8194
+G1 X106.7653 Y84.8678
+G1 X106.7779 Y84.9162
+G1 X106.7904 Y84.9646
+G1 X106.8029 Y85.0130
+G1 X106.8154 Y85.0614
+G1 X106.8279 Y85.1098
+G1 X106.8403 Y85.1582
+G1 X106.8527 Y85.2067
+G1 X106.8651 Y85.2551
+G1 X106.8775 Y85.3036
+G1 X106.8898 Y85.3520
+G1 X106.9021 Y85.4005
+G1 X106.9144 Y85.4489
+G1 X106.9267 Y85.4974
+G1 X106.9389 Y85.5459
+G1 X106.9511 Y85.5944
+G1 X106.9633 Y85.6429
+G1 X106.9755 Y85.6914
+G1 X106.9876 Y85.7399
+G1 X106.9997 Y85.7884
+G1 X107.0118 Y85.8369
+G1 X107.0239 Y85.8854
+G1 X107.0359 Y85.9339
+G1 X107.0480 Y85.9825
+G1 X107.0600 Y86.0310
+G1 X107.0719 Y86.0796
+G1 X107.0839 Y86.1281
+G1 X107.0958 Y86.1767
+G1 X107.1077 Y86.2252
+G1 X107.1196 Y86.2738
+G1 X107.1314 Y86.3224
+G1 X107.1433 Y86.3710
+G1 X107.1551 Y86.4195
+G1 X107.1668 Y86.4681
+G1 X107.1786 Y86.5167
+G1 X107.1903 Y86.5653
+G1 X107.2020 Y86.6140
+G1 X107.2137 Y86.6626
+G1 X107.2254 Y86.7112
+G1 X107.2370 Y86.7598
+G1 X107.2486 Y86.8085
+G1 X107.2602 Y86.8571
+G1 X107.2717 Y86.9057
+G1 X107.2833 Y86.9544
+G1 X107.2948 Y87.0030
+G1 X107.3063 Y87.0517
+G1 X107.3177 Y87.1004
+G1 X107.3292 Y87.1491
+G1 X107.3406 Y87.1977
+G1 X107.3520 Y87.2464
+G1 X107.3633 Y87.2951
+G1 X107.3747 Y87.3438
+G1 X107.3860 Y87.3925
+G1 X107.3973 Y87.4412
+G1 X107.4086 Y87.4899
+G1 X107.4198 Y87.5387
+G1 X107.4310 Y87.5874
+G1 X107.4422 Y87.6361
+G1 X107.4534 Y87.6848
+G1 X107.4645 Y87.7336
+G1 X107.4756 Y87.7823
+G1 X107.4867 Y87.8311
+G1 X107.4978 Y87.8798
+G1 X107.5089 Y87.9286
+G1 X107.5199 Y87.9774
+G1 X107.5309 Y88.0262
+G1 X107.5419 Y88.0749
+G1 X107.5528 Y88.1237
+G1 X107.5637 Y88.1725
+G1 X107.5746 Y88.2213
+G1 X107.5855 Y88.2701
+G1 X107.5964 Y88.3189
+G1 X107.6072 Y88.3677
+G1 X107.6180 Y88.4166
+G1 X107.6288 Y88.4654
+G1 X107.6395 Y88.5142
+G1 X107.6503 Y88.5630
+G1 X107.6610 Y88.6119
+G1 X107.6717 Y88.6607
+G1 X107.6823 Y88.7096
+G1 X107.6929 Y88.7584
+G1 X107.7036 Y88.8073
+G1 X107.7141 Y88.8562
+G1 X107.7247 Y88.9050
+G1 X107.7352 Y88.9539
+G1 X107.7457 Y89.0028
+G1 X107.7562 Y89.0517
+G1 X107.7667 Y89.1006
+G1 X107.7771 Y89.1495
+G1 X107.7875 Y89.1984
+G1 X107.7979 Y89.2473
+G1 X107.8083 Y89.2962
+G1 X107.8186 Y89.3451
+G1 X107.8289 Y89.3940
+G1 X107.8392 Y89.4430
+G1 X107.8495 Y89.4919
+G1 X107.8597 Y89.5409
+G1 X107.8700 Y89.5898
+G1 X107.8802 Y89.6387
+G1 X107.8903 Y89.6877
+G1 X107.9005 Y89.7367
+G1 X107.9106 Y89.7856
+G1 X107.9207 Y89.8346
+G1 X107.9308 Y89.8836
+G1 X107.9408 Y89.9326
+G1 X107.9508 Y89.9815
+G1 X107.9608 Y90.0305
+G1 X107.9708 Y90.0795
+G1 X107.9807 Y90.1285
+G1 X107.9907 Y90.1775
+G1 X108.0006 Y90.2265
+G1 X108.0104 Y90.2756
+G1 X108.0203 Y90.3246
+G1 X108.0301 Y90.3736
+G1 X108.0399 Y90.4226
+G1 X108.0497 Y90.4717
+G1 X108.0594 Y90.5207
+G1 X108.0692 Y90.5697
+G1 X108.0789 Y90.6188
+G1 X108.0885 Y90.6679
+G1 X108.0982 Y90.7169
+G1 X108.1078 Y90.7660
+G1 X108.1174 Y90.8150
+G1 X108.1270 Y90.8641
+G1 X108.1366 Y90.9132
+G1 X108.1461 Y90.9623
+G1 X108.1556 Y91.0114
+G1 X108.1651 Y91.0605
+G1 X108.1745 Y91.1096
+G1 X108.1840 Y91.1587
+G1 X108.1934 Y91.2078
+G1 X108.2028 Y91.2569
+G1 X108.2121 Y91.3060
+G1 X108.2215 Y91.3551
+G1 X108.2308 Y91.4042
+G1 X108.2401 Y91.4534
+G1 X108.2493 Y91.5025
+G1 X108.2586 Y91.5516
+G1 X108.2678 Y91.6008
+G1 X108.2770 Y91.6499
+G1 X108.2861 Y91.6991
+G1 X108.2953 Y91.7483
+G1 X108.3044 Y91.7974
+G1 X108.3135 Y91.8466
+G1 X108.3225 Y91.8958
+G1 X108.3316 Y91.9449
+G1 X108.3406 Y91.9941
+G1 X108.3496 Y92.0433
+G1 X108.3585 Y92.0925
+G1 X108.3675 Y92.1417
+G1 X108.3764 Y92.1909
+G1 X108.3853 Y92.2401
+G1 X108.3942 Y92.2893
+G1 X108.4030 Y92.3385
+G1 X108.4118 Y92.3877
+G1 X108.4206 Y92.4369
+G1 X108.4294 Y92.4862
+G1 X108.4381 Y92.5354
+G1 X108.4468 Y92.5846
+G1 X108.4555 Y92.6339
+G1 X108.4642 Y92.6831
+G1 X108.4729 Y92.7323
+G1 X108.4815 Y92.7816
+G1 X108.4901 Y92.8309
+G1 X108.4987 Y92.8801
+G1 X108.5072 Y92.9294
+G1 X108.5157 Y92.9786
+G1 X108.5242 Y93.0279
+G1 X108.5327 Y93.0772
+G1 X108.5411 Y93.1265
+G1 X108.5496 Y93.1758
+G1 X108.5580 Y93.2251
+G1 X108.5663 Y93.2743
+G1 X108.5747 Y93.3236
+G1 X108.5830 Y93.3729
+G1 X108.5913 Y93.4223
+G1 X108.5996 Y93.4716
+G1 X108.6078 Y93.5209
+G1 X108.6161 Y93.5702
+G1 X108.6243 Y93.6195
+G1 X108.6325 Y93.6688
+G1 X108.6406 Y93.7182
+G1 X108.6487 Y93.7675
+G1 X108.6568 Y93.8168
+G1 X108.6649 Y93.8662
+G1 X108.6730 Y93.9155
+G1 X108.6810 Y93.9649
+G1 X108.6890 Y94.0142
+G1 X108.6970 Y94.0636
+G1 X108.7049 Y94.1130
+G1 X108.7129 Y94.1623
+G1 X108.7208 Y94.2117
+G1 X108.7287 Y94.2611
+G1 X108.7365 Y94.3105
+G1 X108.7444 Y94.3598
+G1 X108.7522 Y94.4092
+G1 X108.7599 Y94.4586
+G1 X108.7677 Y94.5080
+G1 X108.7754 Y94.5574
+G1 X108.7831 Y94.6068
+G1 X108.7908 Y94.6562
+G1 X108.7985 Y94.7056
+G1 X108.8061 Y94.7550
+G1 X108.8137 Y94.8045
+G1 X108.8213 Y94.8539
+G1 X108.8289 Y94.9033
+G1 X108.8364 Y94.9527
+G1 X108.8439 Y95.0022
+G1 X108.8514 Y95.0516
+G1 X108.8589 Y95.1010
+G1 X108.8663 Y95.1505
+G1 X108.8737 Y95.1999
+G1 X108.8811 Y95.2494
+G1 X108.8885 Y95.2988
+G1 X108.8958 Y95.3483
+G1 X108.9031 Y95.3978
+G1 X108.9104 Y95.4472
+G1 X108.9177 Y95.4967
+G1 X108.9249 Y95.5462
+G1 X108.9321 Y95.5956
+G1 X108.9393 Y95.6451
+G1 X108.9465 Y95.6946
+G1 X108.9536 Y95.7441
+G1 X108.9607 Y95.7936
+G1 X108.9678 Y95.8431
+G1 X108.9749 Y95.8926
+G1 X108.9819 Y95.9421
+G1 X108.9890 Y95.9916
+G1 X108.9960 Y96.0411
+G1 X109.0029 Y96.0906
+G1 X109.0099 Y96.1401
+G1 X109.0168 Y96.1896
+G1 X109.0237 Y96.2392
+G1 X109.0305 Y96.2887
+G1 X109.0374 Y96.3382
+G1 X109.0442 Y96.3878
+G1 X109.0510 Y96.4373
+G1 X109.0578 Y96.4868
+G1 X109.0645 Y96.5364
+G1 X109.0712 Y96.5859
+G1 X109.0779 Y96.6355
+G1 X109.0846 Y96.6850
+G1 X109.0912 Y96.7346
+G1 X109.0979 Y96.7841
+G1 X109.1045 Y96.8337
+G1 X109.1110 Y96.8833
+G1 X109.1176 Y96.9328
+G1 X109.1241 Y96.9824
+G1 X109.1306 Y97.0320
+G1 X109.1371 Y97.0816
+G1 X109.1435 Y97.1312
+G1 X109.1499 Y97.1807
+G1 X109.1563 Y97.2303
+G1 X109.1627 Y97.2799
+G1 X109.1690 Y97.3295
+G1 X109.1754 Y97.3791
+G1 X109.1817 Y97.4287
+G1 X109.1879 Y97.4783
+G1 X109.1942 Y97.5279
+G1 X109.2004 Y97.5775
+G1 X109.2066 Y97.6272
+G1 X109.2128 Y97.6768
+G1 X109.2189 Y97.7264
+G1 X109.2251 Y97.7760
+G1 X109.2312 Y97.8256
+G1 X109.2372 Y97.8753
+G1 X109.2433 Y97.9249
+G1 X109.2493 Y97.9745
+G1 X109.2553 Y98.0242
+G1 X109.2613 Y98.0738
+G1 X109.2672 Y98.1235
+G1 X109.2732 Y98.1731
+G1 X109.2791 Y98.2228
+G1 X109.2849 Y98.2724
+G1 X109.2908 Y98.3221
+G1 X109.2966 Y98.3717
+G1 X109.3024 Y98.4214
+G1 X109.3082 Y98.4711
+G1 X109.3139 Y98.5207
+G1 X109.3197 Y98.5704
+G1 X109.3254 Y98.6201
+G1 X109.3311 Y98.6697
+G1 X109.3367 Y98.7194
+G1 X109.3423 Y98.7691
+G1 X109.3479 Y98.8188
+G1 X109.3535 Y98.8685
+G1 X109.3591 Y98.9182
+G1 X109.3646 Y98.9679
+G1 X109.3701 Y99.0176
+G1 X109.3756 Y99.0673
+G1 X109.3810 Y99.1170
+G1 X109.3865 Y99.1667
+G1 X109.3919 Y99.2164
+G1 X109.3972 Y99.2661
+G1 X109.4026 Y99.3158
+G1 X109.4079 Y99.3655
+G1 X109.4132 Y99.4152
+G1 X109.4185 Y99.4650
+G1 X109.4238 Y99.5147
+G1 X109.4290 Y99.5644
+G1 X109.4342 Y99.6141
+G1 X109.4394 Y99.6639
+G1 X109.4445 Y99.7136
+G1 X109.4497 Y99.7633
+G1 X109.4548 Y99.8131
+G1 X109.4599 Y99.8628
+G1 X109.4649 Y99.9126
+G1 X109.4699 Y99.9623
+G1 X109.4750 Y100.0120
+G1 X109.4799 Y100.0618
+G1 X109.4849 Y100.1116
+G1 X109.4898 Y100.1613
+G1 X109.4947 Y100.2111
+G1 X109.4996 Y100.2608
+G1 X109.5045 Y100.3106
+G1 X109.5093 Y100.3604
+G1 X109.5141 Y100.4101
+G1 X109.5189 Y100.4599
+G1 X109.5237 Y100.5097
+G1 X109.5284 Y100.5594
+G1 X109.5331 Y100.6092
+G1 X109.5378 Y100.6590
+G1 X109.5424 Y100.7088
+G1 X109.5471 Y100.7586
+G1 X109.5517 Y100.8084
+G1 X109.5563 Y100.8581
+G1 X109.5608 Y100.9079
+G1 X109.5653 Y100.9577
+G1 X109.5699 Y101.0075
+G1 X109.5743 Y101.0573
+G1 X109.5788 Y101.1071
+G1 X109.5832 Y101.1569
+G1 X109.5876 Y101.2067
+G1 X109.5920 Y101.2565
+G1 X109.5964 Y101.3064
+G1 X109.6007 Y101.3562
+G1 X109.6050 Y101.4060
+G1 X109.6093 Y101.4558
+G1 X109.6136 Y101.5056
+G1 X109.6178 Y101.5554
+G1 X109.6220 Y101.6053
+G1 X109.6262 Y101.6551
+G1 X109.6304 Y101.7049
+G1 X109.6345 Y101.7547
+G1 X109.6386 Y101.8046
+G1 X109.6427 Y101.8544
+G1 X109.6468 Y101.9042
+G1 X109.6508 Y101.9541
+G1 X109.6548 Y102.0039
+G1 X109.6588 Y102.0538
+G1 X109.6627 Y102.1036
+G1 X109.6667 Y102.1534
+G1 X109.6706 Y102.2033
+G1 X109.6745 Y102.2531
+G1 X109.6783 Y102.3030
+G1 X109.6822 Y102.3528
+G1 X109.6860 Y102.4027
+G1 X109.6898 Y102.4525
+G1 X109.6935 Y102.5024
+G1 X109.6973 Y102.5523
+G1 X109.7010 Y102.6021
+G1 X109.7047 Y102.6520
+G1 X109.7083 Y102.7019
+G1 X109.7120 Y102.7517
+G1 X109.7156 Y102.8016
+G1 X109.7192 Y102.8515
+G1 X109.7227 Y102.9013
+G1 X109.7263 Y102.9512
+G1 X109.7298 Y103.0011
+G1 X109.7333 Y103.0510
+G1 X109.7367 Y103.1009
+G1 X109.7402 Y103.1507
+G1 X109.7436 Y103.2006
+G1 X109.7470 Y103.2505
+G1 X109.7503 Y103.3004
+G1 X109.7537 Y103.3503
+G1 X109.7570 Y103.4002
+G1 X109.7603 Y103.4501
+G1 X109.7635 Y103.5000
+G1 X109.7668 Y103.5498
+G1 X109.7700 Y103.5997
+G1 X109.7732 Y103.6496
+G1 X109.7763 Y103.6995
+G1 X109.7795 Y103.7494
+G1 X109.7826 Y103.7993
+G1 X109.7857 Y103.8493
+G1 X109.7887 Y103.8992
+G1 X109.7918 Y103.9491
+G1 X109.7948 Y103.9990
+G1 X109.7978 Y104.0489
+G1 X109.8007 Y104.0988
+G1 X109.8037 Y104.1487
+G1 X109.8066 Y104.1986
+G1 X109.8095 Y104.2485
+G1 X109.8123 Y104.2985
+G1 X109.8152 Y104.3484
+G1 X109.8180 Y104.3983
+G1 X109.8208 Y104.4482
+G1 X109.8235 Y104.4981
+G1 X109.8263 Y104.5481
+G1 X109.8290 Y104.5980
+G1 X109.8317 Y104.6479
+G1 X109.8343 Y104.6979
+G1 X109.8370 Y104.7478
+G1 X109.8396 Y104.7977
+G1 X109.8422 Y104.8476
+G1 X109.8447 Y104.8976
+G1 X109.8473 Y104.9475
+G1 X109.8498 Y104.9975
+G1 X109.8523 Y105.0474
+G1 X109.8547 Y105.0973
+G1 X109.8572 Y105.1473
+G1 X109.8596 Y105.1972
+G1 X109.8620 Y105.2472
+G1 X109.8644 Y105.2971
+G1 X109.8667 Y105.3470
+G1 X109.8690 Y105.3970
+G1 X109.8713 Y105.4469
+G1 X109.8736 Y105.4969
+G1 X109.8758 Y105.5468
+G1 X109.8780 Y105.5968
+G1 X109.8802 Y105.6467
+G1 X109.8824 Y105.6967
+G1 X109.8845 Y105.7466
+G1 X109.8866 Y105.7966
+G1 X109.8887 Y105.8466
+G1 X109.8908 Y105.8965
+G1 X109.8928 Y105.9465
+G1 X109.8948 Y105.9964
+G1 X109.8968 Y106.0464
+G1 X109.8988 Y106.0964
+G1 X109.9007 Y106.1463
+G1 X109.9026 Y106.1963
+G1 X109.9045 Y106.2462
+G1 X109.9064 Y106.2962
+G1 X109.9082 Y106.3462
+G1 X109.9100 Y106.3961
+G1 X109.9118 Y106.4461
+G1 X109.9136 Y106.4961
+G1 X109.9153 Y106.5461
+G1 X109.9170 Y106.5960
+G1 X109.9187 Y106.6460
+G1 X109.9204 Y106.6960
+G1 X109.9220 Y106.7459
+G1 X109.9237 Y106.7959
+G1 X109.9252 Y106.8459
+G1 X109.9268 Y106.8959
+G1 X109.9284 Y106.9458
+G1 X109.9299 Y106.9958
+G1 X109.9314 Y107.0458
+G1 X109.9328 Y107.0958
+G1 X109.9343 Y107.1458
+G1 X109.9357 Y107.1957
+G1 X109.9371 Y107.2457
+G1 X109.9384 Y107.2957
+G1 X109.9398 Y107.3457
+G1 X109.9411 Y107.3957
+G1 X109.9424 Y107.4456
+G1 X109.9436 Y107.4956
+G1 X109.9449 Y107.5456
+G1 X109.9461 Y107.5956
+G1 X109.9473 Y107.6456
+G1 X109.9484 Y107.6956
+G1 X109.9496 Y107.7456
+G1 X109.9507 Y107.7955
+G1 X109.9518 Y107.8455
+G1 X109.9529 Y107.8955
+G1 X109.9539 Y107.9455
+G1 X109.9549 Y107.9955
+G1 X109.9559 Y108.0455
+G1 X109.9569 Y108.0955
+G1 X109.9578 Y108.1455
+G1 X109.9587 Y108.1955
+G1 X109.9596 Y108.2455
+G1 X109.9605 Y108.2954
+G1 X109.9613 Y108.3454
+G1 X109.9621 Y108.3954
+G1 X109.9629 Y108.4454
+G1 X109.9637 Y108.4954
+G1 X109.9644 Y108.5454
+G1 X109.9651 Y108.5954
+G1 X109.9658 Y108.6454
+G1 X109.9665 Y108.6954
+G1 X109.9671 Y108.7454
+G1 X109.9677 Y108.7954
+G1 X109.9683 Y108.8454
+G1 X109.9689 Y108.8954
+G1 X109.9694 Y108.9454
+G1 X109.9700 Y108.9954
+G1 X109.9704 Y109.0454
+G1 X109.9709 Y109.0954
+G1 X109.9713 Y109.1454
+G1 X109.9718 Y109.1954
+G1 X109.9722 Y109.2454
+G1 X109.9725 Y109.2954
+G1 X109.9729 Y109.3454
+G1 X109.9732 Y109.3954
+G1 X109.9735 Y109.4454
+G1 X109.9737 Y109.4954
+G1 X109.9740 Y109.5454
+G1 X109.9742 Y109.5954
+G1 X109.9744 Y109.6454
+G1 X109.9745 Y109.6954
+G1 X109.9747 Y109.7454
+G1 X109.9748 Y109.7954
+G1 X109.9749 Y109.8454
+G1 X109.9749 Y109.8954
+G1 X109.9750 Y109.9454
+G1 X109.9750 Y109.9954
+G1 X109.9750 Y110.0454
+G1 X109.9750 Y110.0954
+G1 X109.9749 Y110.1454
+G1 X109.9748 Y110.1954
+G1 X109.9747 Y110.2454
+G1 X109.9746 Y110.2954
+G1 X109.9744 Y110.3454
+G1 X109.9742 Y110.3954
+G1 X109.9740 Y110.4454
+G1 X109.9738 Y110.4954
+G1 X109.9735 Y110.5454
+G1 X109.9732 Y110.5954
+G1 X109.9729 Y110.6454
+G1 X109.9726 Y110.6954
+G1 X109.9722 Y110.7454
+G1 X109.9718 Y110.7954
+G1 X109.9714 Y110.8454
+G1 X109.9710 Y110.8954
+G1 X109.9705 Y110.9454
+G1 X109.9700 Y110.9953
+G1 X109.9695 Y111.0453
+G1 X109.9690 Y111.0953
+G1 X109.9684 Y111.1453
+G1 X109.9679 Y111.1953
+G1 X109.9672 Y111.2453
+G1 X109.9666 Y111.2953
+G1 X109.9660 Y111.3453
+G1 X109.9653 Y111.3953
+G1 X109.9646 Y111.4453
+G1 X109.9638 Y111.4953
+G1 X109.9631 Y111.5453
+G1 X109.9623 Y111.5953
+G1 X109.9615 Y111.6453
+G1 X109.9606 Y111.6953
+G1 X109.9598 Y111.7453
+G1 X109.9589 Y111.7953
+G1 X109.9580 Y111.8453
+G1 X109.9570 Y111.8953
+G1 X109.9561 Y111.9452
+G1 X109.9551 Y111.9952
+G1 X109.9541 Y112.0452
+G1 X109.9530 Y112.0952
+G1 X109.9520 Y112.1452
+G1 X109.9509 Y112.1952
+G1 X109.9498 Y112.2452
+G1 X109.9487 Y112.2952
+G1 X109.9475 Y112.3452
+G1 X109.9463 Y112.3951
+G1 X109.9451 Y112.4451
+G1 X109.9439 Y112.4951
+G1 X109.9426 Y112.5451
+G1 X109.9413 Y112.5951
+G1 X109.9400 Y112.6451
+G1 X109.9387 Y112.6950
+G1 X109.9373 Y112.7450
+G1 X109.9359 Y112.7950
+G1 X109.9345 Y112.8450
+G1 X109.9331 Y112.8950
+G1 X109.9316 Y112.9449
+G1 X109.9301 Y112.9949
+G1 X109.9286 Y113.0449
+G1 X109.9271 Y113.0949
+G1 X109.9255 Y113.1448
+G1 X109.9240 Y113.1948
+G1 X109.9223 Y113.2448
+G1 X109.9207 Y113.2948
+G1 X109.9190 Y113.3447
+G1 X109.9174 Y113.3947
+G1 X109.9157 Y113.4447
+G1 X109.9139 Y113.4947
+G1 X109.9122 Y113.5446
+G1 X109.9104 Y113.5946
+G1 X109.9086 Y113.6446
+G1 X109.9067 Y113.6945
+G1 X109.9049 Y113.7445
+G1 X109.9030 Y113.7945
+G1 X109.9011 Y113.8444
+G1 X109.8991 Y113.8944
+G1 X109.8972 Y113.9443
+G1 X109.8952 Y113.9943
+G1 X109.8932 Y114.0443
+G1 X109.8912 Y114.0942
+G1 X109.8891 Y114.1442
+G1 X109.8870 Y114.1941
+G1 X109.8849 Y114.2441
+G1 X109.8828 Y114.2940
+G1 X109.8806 Y114.3440
+G1 X109.8784 Y114.3940
+G1 X109.8762 Y114.4439
+G1 X109.8740 Y114.4939
+G1 X109.8717 Y114.5438
+G1 X109.8694 Y114.5937
+G1 X109.8671 Y114.6437
+G1 X109.8648 Y114.6936
+G1 X109.8624 Y114.7436
+G1 X109.8600 Y114.7935
+G1 X109.8576 Y114.8435
+G1 X109.8552 Y114.8934
+G1 X109.8527 Y114.9433
+G1 X109.8503 Y114.9933
+G1 X109.8477 Y115.0432
+G1 X109.8452 Y115.0932
+G1 X109.8427 Y115.1431
+G1 X109.8401 Y115.1930
+G1 X109.8375 Y115.2430
+G1 X109.8348 Y115.2929
+G1 X109.8322 Y115.3428
+G1 X109.8295 Y115.3927
+G1 X109.8268 Y115.4427
+G1 X109.8240 Y115.4926
+G1 X109.8213 Y115.5425
+G1 X109.8185 Y115.5924
+G1 X109.8157 Y115.6424
+G1 X109.8129 Y115.6923
+G1 X109.8100 Y115.7422
+G1 X109.8071 Y115.7921
+G1 X109.8042 Y115.8420
+G1 X109.8013 Y115.8920
+G1 X109.7983 Y115.9419
+G1 X109.7953 Y115.9918
+G1 X109.7923 Y116.0417
+G1 X109.7893 Y116.0916
+G1 X109.7862 Y116.1415
+G1 X109.7831 Y116.1914
+G1 X109.7800 Y116.2413
+G1 X109.7769 Y116.2912
+G1 X109.7738 Y116.3411
+G1 X109.7706 Y116.3910
+G1 X109.7674 Y116.4409
+G1 X109.7641 Y116.4908
+G1 X109.7609 Y116.5407
+G1 X109.7576 Y116.5906
+G1 X109.7543 Y116.6405
+G1 X109.7509 Y116.6904
+G1 X109.7476 Y116.7403
+G1 X109.7442 Y116.7901
+G1 X109.7408 Y116.8400
+G1 X109.7374 Y116.8899
+G1 X109.7339 Y116.9398
+G1 X109.7304 Y116.9897
+G1 X109.7269 Y117.0395
+G1 X109.7234 Y117.0894
+G1 X109.7198 Y117.1393
+G1 X109.7162 Y117.1892
+G1 X109.7126 Y117.2390
+G1 X109.7090 Y117.2889
+G1 X109.7054 Y117.3388
+G1 X109.7017 Y117.3886
+G1 X109.6980 Y117.4385
+G1 X109.6942 Y117.4883
+G1 X109.6905 Y117.5382
+G1 X109.6867 Y117.5881
+G1 X109.6829 Y117.6379
+G1 X109.6791 Y117.6878
+G1 X109.6752 Y117.7376
+G1 X109.6713 Y117.7875
+G1 X109.6674 Y117.8373
+G1 X109.6635 Y117.8872
+G1 X109.6595 Y117.9370
+G1 X109.6555 Y117.9868
+G1 X109.6515 Y118.0367
+G1 X109.6475 Y118.0865
+G1 X109.6434 Y118.1364
+G1 X109.6394 Y118.1862
+G1 X109.6353 Y118.2360
+G1 X109.6311 Y118.2859
+G1 X109.6270 Y118.3357
+G1 X109.6228 Y118.3855
+G1 X109.6186 Y118.4353
+G1 X109.6144 Y118.4852
+G1 X109.6101 Y118.5350
+G1 X109.6058 Y118.5848
+G1 X109.6015 Y118.6346
+G1 X109.5972 Y118.6844
+G1 X109.5928 Y118.7342
+G1 X109.5885 Y118.7840
+G1 X109.5841 Y118.8338
+G1 X109.5796 Y118.8836
+G1 X109.5752 Y118.9334
+G1 X109.5707 Y118.9832
+G1 X109.5662 Y119.0330
+G1 X109.5617 Y119.0828
+G1 X109.5571 Y119.1326
+G1 X109.5525 Y119.1824
+G1 X109.5479 Y119.2322
+G1 X109.5433 Y119.2820
+G1 X109.5386 Y119.3318
+G1 X109.5340 Y119.3815
+G1 X109.5293 Y119.4313
+G1 X109.5245 Y119.4811
+G1 X109.5198 Y119.5309
+G1 X109.5150 Y119.5806
+G1 X109.5102 Y119.6304
+G1 X109.5054 Y119.6802
+G1 X109.5005 Y119.7299
+G1 X109.4956 Y119.7797
+G1 X109.4907 Y119.8295
+G1 X109.4858 Y119.8792
+G1 X109.4809 Y119.9290
+G1 X109.4759 Y119.9787
+G1 X109.4709 Y120.0285
+G1 X109.4659 Y120.0782
+G1 X109.4608 Y120.1280
+G1 X109.4557 Y120.1777
+G1 X109.4506 Y120.2275
+G1 X109.4455 Y120.2772
+G1 X109.4403 Y120.3269
+G1 X109.4352 Y120.3767
+G1 X109.4300 Y120.4264
+G1 X109.4247 Y120.4761
+G1 X109.4195 Y120.5258
+G1 X109.4142 Y120.5756
+G1 X109.4089 Y120.6253
+G1 X109.4036 Y120.6750
+G1 X109.3982 Y120.7247
+G1 X109.3929 Y120.7744
+G1 X109.3875 Y120.8241
+G1 X109.3820 Y120.8738
+G1 X109.3766 Y120.9235
+G1 X109.3711 Y120.9732
+G1 X109.3656 Y121.0229
+G1 X109.3601 Y121.0726
+G1 X109.3545 Y121.1223
+G1 X109.3490 Y121.1720
+G1 X109.3434 Y121.2217
+G1 X109.3378 Y121.2714
+G1 X109.3321 Y121.3210
+G1 X109.3264 Y121.3707
+G1 X109.3207 Y121.4204
+G1 X109.3150 Y121.4701
+G1 X109.3093 Y121.5197
+G1 X109.3035 Y121.5694
+G1 X109.2977 Y121.6191
+G1 X109.2919 Y121.6687
+G1 X109.2860 Y121.7184
+G1 X109.2802 Y121.7680
+G1 X109.2743 Y121.8177
+G1 X109.2683 Y121.8673
+G1 X109.2624 Y121.9170
+G1 X109.2564 Y121.9666
+G1 X109.2504 Y122.0163
+G1 X109.2444 Y122.0659
+G1 X109.2384 Y122.1155
+G1 X109.2323 Y122.1652
+G1 X109.2262 Y122.2148
+G1 X109.2201 Y122.2644
+G1 X109.2139 Y122.3140
+G1 X109.2078 Y122.3636
+G1 X109.2016 Y122.4133
+G1 X109.1953 Y122.4629
+G1 X109.1891 Y122.5125
+G1 X109.1828 Y122.5621
+G1 X109.1765 Y122.6117
+G1 X109.1702 Y122.6613
+G1 X109.1639 Y122.7109
+G1 X109.1575 Y122.7605
+G1 X109.1511 Y122.8101
+G1 X109.1447 Y122.8597
+G1 X109.1383 Y122.9092
+G1 X109.1318 Y122.9588
+G1 X109.1253 Y123.0084
+G1 X109.1188 Y123.0580
+G1 X109.1122 Y123.1075
+G1 X109.1057 Y123.1571
+G1 X109.0991 Y123.2067
+G1 X109.0925 Y123.2562
+G1 X109.0858 Y123.3058
+G1 X109.0792 Y123.3553
+G1 X109.0725 Y123.4049
+G1 X109.0658 Y123.4544
+G1 X109.0590 Y123.5040
+G1 X109.0523 Y123.5535
+G1 X109.0455 Y123.6031
+G1 X109.0387 Y123.6526
+G1 X109.0318 Y123.7021
+G1 X109.0249 Y123.7516
+G1 X109.0181 Y123.8012
+G1 X109.0111 Y123.8507
+G1 X109.0042 Y123.9002
+G1 X108.9972 Y123.9497
+G1 X108.9903 Y123.9992
+G1 X108.9832 Y124.0487
+G1 X108.9762 Y124.0982
+G1 X108.9691 Y124.1477
+G1 X108.9621 Y124.1972
+G1 X108.9550 Y124.2467
+G1 X108.9478 Y124.2962
+G1 X108.9407 Y124.3457
+G1 X108.9335 Y124.3952
+G1 X108.9263 Y124.4447
+G1 X108.9190 Y124.4941
+G1 X108.9118 Y124.5436
+G1 X108.9045 Y124.5931
+G1 X108.8972 Y124.6425
+G1 X108.8898 Y124.6920
+G1 X108.8825 Y124.7414
+G1 X108.8751 Y124.7909
+G1 X108.8677 Y124.8403
+G1 X108.8603 Y124.8898
+G1 X108.8528 Y124.9392
+G1 X108.8453 Y124.9887
+G1 X108.8378 Y125.0381
+G1 X108.8303 Y125.0875
+G1 X108.8227 Y125.1370
+G1 X108.8151 Y125.1864
+G1 X108.8075 Y125.2358
+G1 X108.7999 Y125.2852
+G1 X108.7923 Y125.3346
+G1 X108.7846 Y125.3840
+G1 X108.7769 Y125.4334
+G1 X108.7691 Y125.4828
+G1 X108.7614 Y125.5322
+G1 X108.7536 Y125.5816
+G1 X108.7458 Y125.6310
+G1 X108.7380 Y125.6804
+G1 X108.7301 Y125.7298
+G1 X108.7222 Y125.7791
+G1 X108.7143 Y125.8285
+G1 X108.7064 Y125.8779
+G1 X108.6985 Y125.9272
+G1 X108.6905 Y125.9766
+G1 X108.6825 Y126.0260
+G1 X108.6745 Y126.0753
+G1 X108.6664 Y126.1247
+G1 X108.6583 Y126.1740
+G1 X108.6502 Y126.2233
+G1 X108.6421 Y126.2727
+G1 X108.6340 Y126.3220
+G1 X108.6258 Y126.3713
+G1 X108.6176 Y126.4207
+G1 X108.6094 Y126.4700
+G1 X108.6011 Y126.5193
+G1 X108.5929 Y126.5686
+G1 X108.5846 Y126.6179
+G1 X108.5762 Y126.6672
+G1 X108.5679 Y126.7165
+G1 X108.5595 Y126.7658
+G1 X108.5511 Y126.8151
+G1 X108.5427 Y126.8644
+G1 X108.5343 Y126.9137
+G1 X108.5258 Y126.9629
+G1 X108.5173 Y127.0122
+G1 X108.5088 Y127.0615
+G1 X108.5002 Y127.1108
+G1 X108.4917 Y127.1600
+G1 X108.4831 Y127.2093
+G1 X108.4745 Y127.2585
+G1 X108.4658 Y127.3078
+G1 X108.4572 Y127.3570
+G1 X108.4485 Y127.4062
+G1 X108.4397 Y127.4555
+G1 X108.4310 Y127.5047
+G1 X108.4222 Y127.5539
+G1 X108.4135 Y127.6032
+G1 X108.4046 Y127.6524
+G1 X108.3958 Y127.7016
+G1 X108.3869 Y127.7508
+G1 X108.3780 Y127.8000
+G1 X108.3691 Y127.8492
+G1 X108.3602 Y127.8984
+G1 X108.3512 Y127.9476
+G1 X108.3423 Y127.9968
+G1 X108.3332 Y128.0460
+G1 X108.3242 Y128.0951
+G1 X108.3151 Y128.1443
+G1 X108.3061 Y128.1935
+G1 X108.2970 Y128.2426
+G1 X108.2878 Y128.2918
+G1 X108.2787 Y128.3409
+G1 X108.2695 Y128.3901
+G1 X108.2603 Y128.4392
+G1 X108.2510 Y128.4884
+G1 X108.2418 Y128.5375
+G1 X108.2325 Y128.5866
+G1 X108.2232 Y128.6358
+G1 X108.2139 Y128.6849
+G1 X108.2045 Y128.7340
+G1 X108.1951 Y128.7831
+G1 X108.1857 Y128.8322
+G1 X108.1763 Y128.8813
+G1 X108.1668 Y128.9304
+G1 X108.1574 Y128.9795
+G1 X108.1479 Y129.0286
+G1 X108.1383 Y129.0777
+G1 X108.1288 Y129.1268
+G1 X108.1192 Y129.1759
+G1 X108.1096 Y129.2249
+G1 X108.1000 Y129.2740
+G1 X108.0903 Y129.3231
+G1 X108.0807 Y129.3721
+G1 X108.0710 Y129.4212
+G1 X108.0612 Y129.4702
+G1 X108.0515 Y129.5192
+G1 X108.0417 Y129.5683
+G1 X108.0319 Y129.6173
+G1 X108.0221 Y129.6663
+G1 X108.0123 Y129.7154
+G1 X108.0024 Y129.7644
+G1 X107.9925 Y129.8134
+G1 X107.9826 Y129.8624
+G1 X107.9726 Y129.9114
+G1 X107.9627 Y129.9604
+G1 X107.9527 Y130.0094
+G1 X107.9427 Y130.0584
+G1 X107.9326 Y130.1073
+G1 X107.9226 Y130.1563
+G1 X107.9125 Y130.2053
+G1 X107.9023 Y130.2543
+G1 X107.8922 Y130.3032
+G1 X107.8820 Y130.3522
+G1 X107.8719 Y130.4011
+G1 X107.8616 Y130.4501
+G1 X107.8514 Y130.4990
+G1 X107.8411 Y130.5480
+G1 X107.8309 Y130.5969
+G1 X107.8205 Y130.6458
+G1 X107.8102 Y130.6947
+G1 X107.7999 Y130.7436
+G1 X107.7895 Y130.7926
+G1 X107.7791 Y130.8415
+G1 X107.7686 Y130.8904
+G1 X107.7582 Y130.9393
+G1 X107.7477 Y130.9881
+G1 X107.7372 Y131.0370
+G1 X107.7266 Y131.0859
+G1 X107.7161 Y131.1348
+G1 X107.7055 Y131.1836
+G1 X107.6949 Y131.2325
+G1 X107.6843 Y131.2814
+G1 X107.6736 Y131.3302
+G1 X107.6630 Y131.3791
+G1 X107.6522 Y131.4279
+G1 X107.6415 Y131.4767
+G1 X107.6308 Y131.5256
+G1 X107.6200 Y131.5744
+G1 X107.6092 Y131.6232
+G1 X107.5984 Y131.6720
+G1 X107.5875 Y131.7208
+G1 X107.5767 Y131.7696
+G1 X107.5658 Y131.8184
+G1 X107.5548 Y131.8672
+G1 X107.5439 Y131.9160
+G1 X107.5329 Y131.9648
+G1 X107.5219 Y132.0136
+G1 X107.5109 Y132.0623
+G1 X107.4999 Y132.1111
+G1 X107.4888 Y132.1599
+G1 X107.4777 Y132.2086
+G1 X107.4666 Y132.2574
+G1 X107.4554 Y132.3061
+G1 X107.4443 Y132.3549
+G1 X107.4331 Y132.4036
+G1 X107.4219 Y132.4523
+G1 X107.4106 Y132.5010
+G1 X107.3994 Y132.5497
+G1 X107.3881 Y132.5985
+G1 X107.3768 Y132.6472
+G1 X107.3654 Y132.6959
+G1 X107.3541 Y132.7446
+G1 X107.3427 Y132.7932
+G1 X107.3313 Y132.8419
+G1 X107.3199 Y132.8906
+G1 X107.3084 Y132.9393
+G1 X107.2969 Y132.9879
+G1 X107.2854 Y133.0366
+G1 X107.2739 Y133.0852
+G1 X107.2623 Y133.1339
+G1 X107.2507 Y133.1825
+G1 X107.2391 Y133.2312
+G1 X107.2275 Y133.2798
+G1 X107.2159 Y133.3284
+G1 X107.2042 Y133.3770
+G1 X107.1925 Y133.4256
+G1 X107.1808 Y133.4742
+G1 X107.1690 Y133.5228
+G1 X107.1572 Y133.5714
+G1 X107.1454 Y133.6200
+G1 X107.1336 Y133.6686
+G1 X107.1218 Y133.7172
+G1 X107.1099 Y133.7658
+G1 X107.0980 Y133.8143
+G1 X107.0861 Y133.8629
+G1 X107.0741 Y133.9114
+G1 X107.0622 Y133.9600
+G1 X107.0502 Y134.0085
+G1 X107.0382 Y134.0571
+G1 X107.0261 Y134.1056
+G1 X107.0141 Y134.1541
+G1 X107.0020 Y134.2026
+G1 X106.9899 Y134.2511
+G1 X106.9777 Y134.2996
+G1 X106.9656 Y134.3481
+G1 X106.9534 Y134.3966
+G1 X106.9412 Y134.4451
+G1 X106.9289 Y134.4936
+G1 X106.9167 Y134.5421
+G1 X106.9044 Y134.5905
+G1 X106.8921 Y134.6390
+G1 X106.8797 Y134.6875
+G1 X106.8674 Y134.7359
+G1 X106.8550 Y134.7843
+G1 X106.8426 Y134.8328
+G1 X106.8302 Y134.8812
+G1 X106.8177 Y134.9296
+G1 X106.8052 Y134.9781
+G1 X106.7927 Y135.0265
+G1 X106.7802 Y135.0749
+G1 X106.7677 Y135.1233
+G1 X106.7551 Y135.1717
+G1 X106.7425 Y135.2201
+G1 X106.7299 Y135.2684
+G1 X106.7172 Y135.3168
+G1 X106.7046 Y135.3652
+G1 X106.6919 Y135.4135
+G1 X106.6791 Y135.4619
+G1 X106.6664 Y135.5102
+G1 X106.6536 Y135.5586
+G1 X106.6408 Y135.6069
+G1 X106.6280 Y135.6553
+G1 X106.6152 Y135.7036
+G1 X106.6023 Y135.7519
+G1 X106.5894 Y135.8002
+G1 X106.5765 Y135.8485
+G1 X106.5636 Y135.8968
+G1 X106.5506 Y135.9451
+G1 X106.5376 Y135.9934
+G1 X106.5246 Y136.0417
+G1 X106.5116 Y136.0899
+G1 X106.4985 Y136.1382
+G1 X106.4855 Y136.1865
+G1 X106.4724 Y136.2347
+G1 X106.4592 Y136.2830
+G1 X106.4461 Y136.3312
+G1 X106.4329 Y136.3794
+G1 X106.4197 Y136.4276
+G1 X106.4065 Y136.4759
+G1 X106.3932 Y136.5241
+G1 X106.3799 Y136.5723
+G1 X106.3666 Y136.6205
+G1 X106.3533 Y136.6687
+G1 X106.3400 Y136.7169
+G1 X106.3266 Y136.7650
+G1 X106.3132 Y136.8132
+G1 X106.2998 Y136.8614
+G1 X106.2864 Y136.9095
+G1 X106.2729 Y136.9577
+G1 X106.2594 Y137.0058
+G1 X106.2459 Y137.0540
+G1 X106.2323 Y137.1021
+G1 X106.2188 Y137.1502
+G1 X106.2052 Y137.1984
+G1 X106.1916 Y137.2465
+G1 X106.1779 Y137.2946
+G1 X106.1643 Y137.3427
+G1 X106.1506 Y137.3908
+G1 X106.1369 Y137.4388
+G1 X106.1232 Y137.4869
+G1 X106.1094 Y137.5350
+G1 X106.0956 Y137.5831
+G1 X106.0818 Y137.6311
+G1 X106.0680 Y137.6792
+G1 X106.0541 Y137.7272
+G1 X106.0403 Y137.7752
+G1 X106.0264 Y137.8233
+G1 X106.0124 Y137.8713
+G1 X105.9985 Y137.9193
+G1 X105.9845 Y137.9673
+G1 X105.9705 Y138.0153
+G1 X105.9565 Y138.0633
+G1 X105.9425 Y138.1113
+G1 X105.9284 Y138.1593
+G1 X105.9143 Y138.2073
+G1 X105.9002 Y138.2552
+G1 X105.8861 Y138.3032
+G1 X105.8719 Y138.3511
+G1 X105.8577 Y138.3991
+G1 X105.8435 Y138.4470
+G1 X105.8293 Y138.4949
+G1 X105.8150 Y138.5429
+G1 X105.8007 Y138.5908
+G1 X105.7864 Y138.6387
+G1 X105.7721 Y138.6866
+G1 X105.7577 Y138.7345
+G1 X105.7433 Y138.7824
+G1 X105.7289 Y138.8303
+G1 X105.7145 Y138.8781
+G1 X105.7001 Y138.9260
+G1 X105.6856 Y138.9739
+G1 X105.6711 Y139.0217
+G1 X105.6566 Y139.0696
+G1 X105.6420 Y139.1174
+G1 X105.6274 Y139.1652
+G1 X105.6129 Y139.2130
+G1 X105.5982 Y139.2609
+G1 X105.5836 Y139.3087
+G1 X105.5689 Y139.3565
+G1 X105.5542 Y139.4043
+G1 X105.5395 Y139.4520
+G1 X105.5248 Y139.4998
+G1 X105.5100 Y139.5476
+G1 X105.4952 Y139.5954
+G1 X105.4804 Y139.6431
+G1 X105.4656 Y139.6909
+G1 X105.4507 Y139.7386
+G1 X105.4359 Y139.7863
+G1 X105.4209 Y139.8341
+G1 X105.4060 Y139.8818
+G1 X105.3911 Y139.9295
+G1 X105.3761 Y139.9772
+G1 X105.3611 Y140.0249
+G1 X105.3461 Y140.0726
+G1 X105.3310 Y140.1203
+G1 X105.3159 Y140.1679
+G1 X105.3008 Y140.2156
+G1 X105.2857 Y140.2633
+G1 X105.2706 Y140.3109
+G1 X105.2554 Y140.3586
+G1 X105.2402 Y140.4062
+G1 X105.2250 Y140.4538
+G1 X105.2098 Y140.5014
+G1 X105.1945 Y140.5491
+G1 X105.1792 Y140.5967
+G1 X105.1639 Y140.6443
+G1 X105.1486 Y140.6919
+G1 X105.1332 Y140.7394
+G1 X105.1178 Y140.7870
+G1 X105.1024 Y140.8346
+G1 X105.0870 Y140.8821
+G1 X105.0716 Y140.9297
+G1 X105.0561 Y140.9772
+G1 X105.0406 Y141.0248
+G1 X105.0250 Y141.0723
+G1 X105.0095 Y141.1198
+G1 X104.9939 Y141.1673
+G1 X104.9783 Y141.2148
+G1 X104.9627 Y141.2623
+G1 X104.9471 Y141.3098
+G1 X104.9314 Y141.3573
+G1 X104.9157 Y141.4048
+G1 X104.9000 Y141.4523
+G1 X104.8843 Y141.4997
+G1 X104.8685 Y141.5472
+G1 X104.8527 Y141.5946
+G1 X104.8369 Y141.6420
+G1 X104.8211 Y141.6895
+G1 X104.8052 Y141.7369
+G1 X104.7893 Y141.7843
+G1 X104.7734 Y141.8317
+G1 X104.7575 Y141.8791
+G1 X104.7416 Y141.9265
+G1 X104.7256 Y141.9739
+G1 X104.7096 Y142.0212
+G1 X104.6936 Y142.0686
+G1 X104.6775 Y142.1160
+G1 X104.6614 Y142.1633
+G1 X104.6453 Y142.2106
+G1 X104.6292 Y142.2580
+G1 X104.6131 Y142.3053
+G1 X104.5969 Y142.3526
+G1 X104.5807 Y142.3999
+G1 X104.5645 Y142.4472
+G1 X104.5483 Y142.4945
+G1 X104.5320 Y142.5418
+G1 X104.5157 Y142.5891
+G1 X104.4994 Y142.6363
+G1 X104.4831 Y142.6836
+G1 X104.4668 Y142.7308
+G1 X104.4504 Y142.7781
+G1 X104.4340 Y142.8253
+G1 X104.4176 Y142.8725
+G1 X104.4011 Y142.9198
+G1 X104.3846 Y142.9670
+G1 X104.3681 Y143.0142
+G1 X104.3516 Y143.0614
+G1 X104.3351 Y143.1085
+G1 X104.3185 Y143.1557
+G1 X104.3019 Y143.2029
+G1 X104.2853 Y143.2500
+G1 X104.2687 Y143.2972
+G1 X104.2520 Y143.3443
+G1 X104.2353 Y143.3915
+G1 X104.2186 Y143.4386
+G1 X104.2019 Y143.4857
+G1 X104.1851 Y143.5328
+G1 X104.1684 Y143.5799
+G1 X104.1516 Y143.6270
+G1 X104.1347 Y143.6741
+G1 X104.1179 Y143.7212
+G1 X104.1010 Y143.7682
+G1 X104.0841 Y143.8153
+G1 X104.0672 Y143.8624
+G1 X104.0503 Y143.9094
+G1 X104.0333 Y143.9564
+G1 X104.0163 Y144.0035
+G1 X103.9993 Y144.0505
+G1 X103.9822 Y144.0975
+G1 X103.9652 Y144.1445
+G1 X103.9481 Y144.1915
+G1 X103.9310 Y144.2385
+G1 X103.9139 Y144.2854
+G1 X103.8967 Y144.3324
+G1 X103.8795 Y144.3793
+G1 X103.8623 Y144.4263
+G1 X103.8451 Y144.4732
+G1 X103.8279 Y144.5202
+G1 X103.8106 Y144.5671
+G1 X103.7933 Y144.6140
+G1 X103.7760 Y144.6609
+G1 X103.7586 Y144.7078
+G1 X103.7413 Y144.7547
+G1 X103.7239 Y144.8016
+G1 X103.7065 Y144.8484
+G1 X103.6890 Y144.8953
+G1 X103.6716 Y144.9422
+G1 X103.6541 Y144.9890
+G1 X103.6366 Y145.0358
+G1 X103.6190 Y145.0827
+G1 X103.6015 Y145.1295
+G1 X103.5839 Y145.1763
+G1 X103.5663 Y145.2231
+G1 X103.5487 Y145.2699
+G1 X103.5310 Y145.3167
+G1 X103.5134 Y145.3634
+G1 X103.4957 Y145.4102
+G1 X103.4780 Y145.4570
+G1 X103.4602 Y145.5037
+G1 X103.4425 Y145.5504
+G1 X103.4247 Y145.5972
+G1 X103.4069 Y145.6439
+G1 X103.3890 Y145.6906
+G1 X103.3712 Y145.7373
+G1 X103.3533 Y145.7840
+G1 X103.3354 Y145.8307
+G1 X103.3175 Y145.8774
+G1 X103.2995 Y145.9240
+G1 X103.2815 Y145.9707
+G1 X103.2635 Y146.0173
+G1 X103.2455 Y146.0640
+G1 X103.2275 Y146.1106
+G1 X103.2094 Y146.1572
+G1 X103.1913 Y146.2038
+G1 X103.1732 Y146.2504
+G1 X103.1551 Y146.2970
+G1 X103.1369 Y146.3436
+G1 X103.1187 Y146.3902
+G1 X103.1005 Y146.4368
+G1 X103.0823 Y146.4833
+G1 X103.0640 Y146.5299
+G1 X103.0458 Y146.5764
+G1 X103.0275 Y146.6229
+G1 X103.0091 Y146.6695
+G1 X102.9908 Y146.7160
+G1 X102.9724 Y146.7625
+G1 X102.9540 Y146.8090
+G1 X102.9356 Y146.8555
+G1 X102.9172 Y146.9019
+G1 X102.8987 Y146.9484
+G1 X102.8802 Y146.9949
+G1 X102.8617 Y147.0413
+G1 X102.8432 Y147.0877
+G1 X102.8246 Y147.1342
+G1 X102.8060 Y147.1806
+G1 X102.7874 Y147.2270
+G1 X102.7688 Y147.2734
+G1 X102.7502 Y147.3198
+G1 X102.7315 Y147.3662
+G1 X102.7128 Y147.4126
+G1 X102.6941 Y147.4589
+G1 X102.6753 Y147.5053
+G1 X102.6566 Y147.5516
+G1 X102.6378 Y147.5980
+G1 X102.6190 Y147.6443
+G1 X102.6002 Y147.6906
+G1 X102.5813 Y147.7369
+G1 X102.5624 Y147.7832
+G1 X102.5435 Y147.8295
+G1 X102.5246 Y147.8758
+G1 X102.5056 Y147.9220
+G1 X102.4867 Y147.9683
+G1 X102.4677 Y148.0146
+G1 X102.4486 Y148.0608
+G1 X102.4296 Y148.1070
+G1 X102.4105 Y148.1533
+G1 X102.3915 Y148.1995
+G1 X102.3723 Y148.2457
+G1 X102.3532 Y148.2919
+G1 X102.3341 Y148.3380
+G1 X102.3149 Y148.3842
+G1 X102.2957 Y148.4304
+G1 X102.2764 Y148.4765
+G1 X102.2572 Y148.5227
+G1 X102.2379 Y148.5688
+G1 X102.2186 Y148.6150
+G1 X102.1993 Y148.6611
+G1 X102.1800 Y148.7072
+G1 X102.1606 Y148.7533
+G1 X102.1412 Y148.7994
+G1 X102.1218 Y148.8454
+G1 X102.1024 Y148.8915
+G1 X102.0829 Y148.9376
+G1 X102.0634 Y148.9836
+G1 X102.0439 Y149.0297
+G1 X102.0244 Y149.0757
+G1 X102.0048 Y149.1217
+G1 X101.9853 Y149.1677
+G1 X101.9657 Y149.2137
+G1 X101.9461 Y149.2597
+G1 X101.9264 Y149.3057
+G1 X101.9068 Y149.3517
+G1 X101.8871 Y149.3976
+G1 X101.8674 Y149.4436
+G1 X101.8476 Y149.4895
+G1 X101.8279 Y149.5354
+G1 X101.8081 Y149.5814
+G1 X101.7883 Y149.6273
+G1 X101.7685 Y149.6732
+G1 X101.7486 Y149.7191
+G1 X101.7287 Y149.7649
+G1 X101.7088 Y149.8108
+G1 X101.6889 Y149.8567
+G1 X101.6690 Y149.9025
+G1 X101.6490 Y149.9484
+G1 X101.6290 Y149.9942
+G1 X101.6090 Y150.0400
+G1 X101.5890 Y150.0858
+G1 X101.5689 Y150.1316
+G1 X101.5489 Y150.1774
+G1 X101.5288 Y150.2232
+G1 X101.5086 Y150.2690
+G1 X101.4885 Y150.3148
+G1 X101.4683 Y150.3605
+G1 X101.4481 Y150.4062
+G1 X101.4279 Y150.4520
+G1 X101.4077 Y150.4977
+G1 X101.3874 Y150.5434
+G1 X101.3671 Y150.5891
+G1 X101.3468 Y150.6348
+G1 X101.3265 Y150.6805
+G1 X101.3062 Y150.7262
+G1 X101.2858 Y150.7718
+G1 X101.2654 Y150.8175
+G1 X101.2450 Y150.8631
+G1 X101.2245 Y150.9087
+G1 X101.2041 Y150.9544
+G1 X101.1836 Y151.0000
+G1 X101.1631 Y151.0456
+G1 X101.1425 Y151.0912
+G1 X101.1220 Y151.1367
+G1 X101.1014 Y151.1823
+G1 X101.0808 Y151.2279
+G1 X101.0602 Y151.2734
+G1 X101.0395 Y151.3189
+G1 X101.0188 Y151.3645
+G1 X100.9981 Y151.4100
+G1 X100.9774 Y151.4555
+G1 X100.9567 Y151.5010
+G1 X100.9359 Y151.5465
+G1 X100.9151 Y151.5919
+G1 X100.8943 Y151.6374
+G1 X100.8735 Y151.6829
+G1 X100.8527 Y151.7283
+G1 X100.8318 Y151.7737
+G1 X100.8109 Y151.8192
+G1 X100.7900 Y151.8646
+G1 X100.7690 Y151.9100
+G1 X100.7480 Y151.9554
+G1 X100.7271 Y152.0008
+G1 X100.7060 Y152.0461
+G1 X100.6850 Y152.0915
+G1 X100.6640 Y152.1368
+G1 X100.6429 Y152.1822
+G1 X100.6218 Y152.2275
+G1 X100.6007 Y152.2728
+G1 X100.5795 Y152.3181
+G1 X100.5583 Y152.3634
+G1 X100.5371 Y152.4087
+G1 X100.5159 Y152.4540
+G1 X100.4947 Y152.4993
+G1 X100.4734 Y152.5445
+G1 X100.4521 Y152.5898
+G1 X100.4308 Y152.6350
+G1 X100.4095 Y152.6802
+G1 X100.3882 Y152.7254
+G1 X100.3668 Y152.7706
+G1 X100.3454 Y152.8158
+G1 X100.3240 Y152.8610
+G1 X100.3025 Y152.9062
+G1 X100.2811 Y152.9513
+G1 X100.2596 Y152.9965
+G1 X100.2381 Y153.0416
+G1 X100.2165 Y153.0867
+G1 X100.1950 Y153.1318
+G1 X100.1734 Y153.1770
+G1 X100.1518 Y153.2220
+G1 X100.1302 Y153.2671
+G1 X100.1085 Y153.3122
+G1 X100.0869 Y153.3573
+G1 X100.0652 Y153.4023
+G1 X100.0435 Y153.4474
+G1 X100.0217 Y153.4924
+G1 X100.0000 Y153.5374
+G1 X99.9782 Y153.5824
+G1 X99.9564 Y153.6274
+G1 X99.9346 Y153.6724
+G1 X99.9127 Y153.7174
+G1 X99.8908 Y153.7623
+G1 X99.8690 Y153.8073
+G1 X99.8470 Y153.8522
+G1 X99.8251 Y153.8971
+G1 X99.8031 Y153.9421
+G1 X99.7812 Y153.9870
+G1 X99.7592 Y154.0319
+G1 X99.7371 Y154.0768
+G1 X99.7151 Y154.1216
+G1 X99.6930 Y154.1665
+G1 X99.6709 Y154.2114
+G1 X99.6488 Y154.2562
+G1 X99.6267 Y154.3010
+G1 X99.6045 Y154.3458
+G1 X99.5823 Y154.3907
+G1 X99.5601 Y154.4355
+G1 X99.5379 Y154.4802
+G1 X99.5156 Y154.5250
+G1 X99.4933 Y154.5698
+G1 X99.4711 Y154.6145
+G1 X99.4487 Y154.6593
+G1 X99.4264 Y154.7040
+G1 X99.4040 Y154.7487
+G1 X99.3816 Y154.7934
+G1 X99.3592 Y154.8381
+G1 X99.3368 Y154.8828
+G1 X99.3144 Y154.9275
+G1 X99.2919 Y154.9722
+G1 X99.2694 Y155.0168
+G1 X99.2469 Y155.0615
+G1 X99.2243 Y155.1061
+G1 X99.2018 Y155.1507
+G1 X99.1792 Y155.1953
+G1 X99.1566 Y155.2399
+G1 X99.1339 Y155.2845
+G1 X99.1113 Y155.3291
+G1 X99.0886 Y155.3736
+G1 X99.0659 Y155.4182
+G1 X99.0432 Y155.4627
+G1 X99.0204 Y155.5073
+G1 X98.9977 Y155.5518
+G1 X98.9749 Y155.5963
+G1 X98.9521 Y155.6408
+G1 X98.9292 Y155.6853
+G1 X98.9064 Y155.7297
+G1 X98.8835 Y155.7742
+G1 X98.8606 Y155.8186
+G1 X98.8377 Y155.8631
+G1 X98.8148 Y155.9075
+G1 X98.7918 Y155.9519
+G1 X98.7688 Y155.9963
+G1 X98.7458 Y156.0407
+G1 X98.7228 Y156.0851
+G1 X98.6997 Y156.1295
+G1 X98.6766 Y156.1738
+G1 X98.6535 Y156.2182
+G1 X98.6304 Y156.2625
+G1 X98.6073 Y156.3068
+G1 X98.5841 Y156.3511
+G1 X98.5609 Y156.3954
+G1 X98.5377 Y156.4397
+G1 X98.5145 Y156.4840
+G1 X98.4912 Y156.5282
+G1 X98.4680 Y156.5725
+G1 X98.4447 Y156.6167
+G1 X98.4213 Y156.6610
+G1 X98.3980 Y156.7052
+G1 X98.3746 Y156.7494
+G1 X98.3512 Y156.7936
+G1 X98.3278 Y156.8378
+G1 X98.3044 Y156.8819
+G1 X98.2810 Y156.9261
+G1 X98.2575 Y156.9702
+G1 X98.2340 Y157.0144
+G1 X98.2105 Y157.0585
+G1 X98.1869 Y157.1026
+G1 X98.1634 Y157.1467
+G1 X98.1398 Y157.1908
+G1 X98.1162 Y157.2349
+G1 X98.0925 Y157.2789
+G1 X98.0689 Y157.3230
+G1 X98.0452 Y157.3670
+G1 X98.0215 Y157.4111
+G1 X97.9978 Y157.4551
+G1 X97.9741 Y157.4991
+G1 X97.9503 Y157.5431
+G1 X97.9265 Y157.5871
+G1 X97.9027 Y157.6310
+G1 X97.8789 Y157.6750
+G1 X97.8550 Y157.7189
+G1 X97.8312 Y157.7629
+G1 X97.8073 Y157.8068
+G1 X97.7834 Y157.8507
+G1 X97.7594 Y157.8946
+G1 X97.7355 Y157.9385
+G1 X97.7115 Y157.9824
+G1 X97.6875 Y158.0262
+G1 X97.6635 Y158.0701
+G1 X97.6394 Y158.1139
+G1 X97.6154 Y158.1577
+G1 X97.5913 Y158.2016
+G1 X97.5672 Y158.2454
+G1 X97.5430 Y158.2891
+G1 X97.5189 Y158.3329
+G1 X97.4947 Y158.3767
+G1 X97.4705 Y158.4204
+G1 X97.4463 Y158.4642
+G1 X97.4220 Y158.5079
+G1 X97.3978 Y158.5516
+G1 X97.3735 Y158.5953
+G1 X97.3492 Y158.6390
+G1 X97.3248 Y158.6827
+G1 X97.3005 Y158.7264
+G1 X97.2761 Y158.7700
+G1 X97.2517 Y158.8137
+G1 X97.2273 Y158.8573
+G1 X97.2029 Y158.9009
+G1 X97.1784 Y158.9445
+G1 X97.1539 Y158.9881
+G1 X97.1294 Y159.0317
+G1 X97.1049 Y159.0753
+G1 X97.0803 Y159.1188
+G1 X97.0558 Y159.1624
+G1 X97.0312 Y159.2059
+G1 X97.0066 Y159.2495
+G1 X96.9819 Y159.2930
+G1 X96.9573 Y159.3365
+G1 X96.9326 Y159.3799
+G1 X96.9079 Y159.4234
+G1 X96.8832 Y159.4669
+G1 X96.8584 Y159.5103
+G1 X96.8336 Y159.5538
+G1 X96.8089 Y159.5972
+G1 X96.7841 Y159.6406
+G1 X96.7592 Y159.6840
+G1 X96.7344 Y159.7274
+G1 X96.7095 Y159.7708
+G1 X96.6846 Y159.8141
+G1 X96.6597 Y159.8575
+G1 X96.6347 Y159.9008
+G1 X96.6098 Y159.9441
+G1 X96.5848 Y159.9874
+G1 X96.5598 Y160.0307
+G1 X96.5348 Y160.0740
+G1 X96.5097 Y160.1173
+G1 X96.4846 Y160.1606
+G1 X96.4596 Y160.2038
+G1 X96.4344 Y160.2470
+G1 X96.4093 Y160.2903
+G1 X96.3842 Y160.3335
+G1 X96.3590 Y160.3767
+G1 X96.3338 Y160.4199
+G1 X96.3086 Y160.4630
+G1 X96.2833 Y160.5062
+G1 X96.2580 Y160.5493
+G1 X96.2328 Y160.5925
+G1 X96.2075 Y160.6356
+G1 X96.1821 Y160.6787
+G1 X96.1568 Y160.7218
+G1 X96.1314 Y160.7649
+G1 X96.1060 Y160.8080
+G1 X96.0806 Y160.8510
+G1 X96.0552 Y160.8941
+G1 X96.0297 Y160.9371
+G1 X96.0042 Y160.9801
+G1 X95.9787 Y161.0231
+G1 X95.9532 Y161.0661
+G1 X95.9277 Y161.1091
+G1 X95.9021 Y161.1521
+G1 X95.8765 Y161.1950
+G1 X95.8509 Y161.2380
+G1 X95.8253 Y161.2809
+G1 X95.7996 Y161.3238
+G1 X95.7739 Y161.3667
+G1 X95.7483 Y161.4096
+G1 X95.7225 Y161.4525
+G1 X95.6968 Y161.4954
+G1 X95.6710 Y161.5382
+G1 X95.6453 Y161.5811
+G1 X95.6195 Y161.6239
+G1 X95.5936 Y161.6667
+G1 X95.5678 Y161.7095
+G1 X95.5419 Y161.7523
+G1 X95.5160 Y161.7951
+G1 X95.4901 Y161.8378
+G1 X95.4642 Y161.8806
+G1 X95.4383 Y161.9233
+G1 X95.4123 Y161.9661
+G1 X95.3863 Y162.0088
+G1 X95.3603 Y162.0515
+G1 X95.3342 Y162.0942
+G1 X95.3082 Y162.1368
+G1 X95.2821 Y162.1795
+G1 X95.2560 Y162.2221
+G1 X95.2299 Y162.2648
+G1 X95.2037 Y162.3074
+G1 X95.1776 Y162.3500
+G1 X95.1514 Y162.3926
+G1 X95.1252 Y162.4352
+G1 X95.0989 Y162.4777
+G1 X95.0727 Y162.5203
+G1 X95.0464 Y162.5628
+G1 X95.0201 Y162.6054
+G1 X94.9938 Y162.6479
+G1 X94.9675 Y162.6904
+G1 X94.9411 Y162.7329
+G1 X94.9148 Y162.7754
+G1 X94.8884 Y162.8178
+G1 X94.8619 Y162.8603
+G1 X94.8355 Y162.9027
+G1 X94.8090 Y162.9451
+G1 X94.7825 Y162.9875
+G1 X94.7560 Y163.0299
+G1 X94.7295 Y163.0723
+G1 X94.7030 Y163.1147
+G1 X94.6764 Y163.1571
+G1 X94.6498 Y163.1994
+G1 X94.6232 Y163.2417
+G1 X94.5966 Y163.2840
+G1 X94.5699 Y163.3263
+G1 X94.5432 Y163.3686
+G1 X94.5166 Y163.4109
+G1 X94.4898 Y163.4532
+G1 X94.4631 Y163.4954
+G1 X94.4363 Y163.5377
+G1 X94.4096 Y163.5799
+G1 X94.3828 Y163.6221
+G1 X94.3559 Y163.6643
+G1 X94.3291 Y163.7065
+G1 X94.3022 Y163.7487
+G1 X94.2753 Y163.7908
+G1 X94.2484 Y163.8330
+G1 X94.2215 Y163.8751
+G1 X94.1946 Y163.9172
+G1 X94.1676 Y163.9593
+G1 X94.1406 Y164.0014
+G1 X94.1136 Y164.0435
+G1 X94.0866 Y164.0855
+G1 X94.0595 Y164.1276
+G1 X94.0324 Y164.1696
+G1 X94.0053 Y164.2116
+G1 X93.9782 Y164.2536
+G1 X93.9511 Y164.2956
+G1 X93.9239 Y164.3376
+G1 X93.8968 Y164.3796
+G1 X93.8696 Y164.4215
+G1 X93.8423 Y164.4635
+G1 X93.8151 Y164.5054
+G1 X93.7878 Y164.5473
+G1 X93.7605 Y164.5892
+G1 X93.7332 Y164.6311
+G1 X93.7059 Y164.6730
+G1 X93.6786 Y164.7148
+G1 X93.6512 Y164.7567
+G1 X93.6238 Y164.7985
+G1 X93.5964 Y164.8403
+G1 X93.5690 Y164.8821
+G1 X93.5415 Y164.9239
+G1 X93.5140 Y164.9657
+G1 X93.4865 Y165.0075
+G1 X93.4590 Y165.0492
+G1 X93.4315 Y165.0910
+G1 X93.4039 Y165.1327
+G1 X93.3764 Y165.1744
+G1 X93.3488 Y165.2161
+G1 X93.3211 Y165.2578
+G1 X93.2935 Y165.2994
+G1 X93.2658 Y165.3411
+G1 X93.2382 Y165.3827
+G1 X93.2105 Y165.4243
+G1 X93.1827 Y165.4659
+G1 X93.1550 Y165.5075
+G1 X93.1272 Y165.5491
+G1 X93.0995 Y165.5907
+G1 X93.0716 Y165.6323
+G1 X93.0438 Y165.6738
+G1 X93.0160 Y165.7153
+G1 X92.9881 Y165.7568
+G1 X92.9602 Y165.7983
+G1 X92.9323 Y165.8398
+G1 X92.9044 Y165.8813
+G1 X92.8764 Y165.9227
+G1 X92.8485 Y165.9642
+G1 X92.8205 Y166.0056
+G1 X92.7924 Y166.0470
+G1 X92.7644 Y166.0884
+G1 X92.7364 Y166.1298
+G1 X92.7083 Y166.1712
+G1 X92.6802 Y166.2126
+G1 X92.6521 Y166.2539
+G1 X92.6239 Y166.2952
+G1 X92.5958 Y166.3366
+G1 X92.5676 Y166.3779
+G1 X92.5394 Y166.4191
+G1 X92.5112 Y166.4604
+G1 X92.4829 Y166.5017
+G1 X92.4547 Y166.5429
+G1 X92.4264 Y166.5842
+G1 X92.3981 Y166.6254
+G1 X92.3698 Y166.6666
+G1 X92.3414 Y166.7078
+G1 X92.3131 Y166.7490
+G1 X92.2847 Y166.7901
+G1 X92.2563 Y166.8313
+G1 X92.2278 Y166.8724
+G1 X92.1994 Y166.9135
+G1 X92.1709 Y166.9546
+G1 X92.1424 Y166.9957
+G1 X92.1139 Y167.0368
+G1 X92.0854 Y167.0778
+G1 X92.0569 Y167.1189
+G1 X92.0283 Y167.1599
+G1 X91.9997 Y167.2010
+G1 X91.9711 Y167.2420
+G1 X91.9425 Y167.2829
+G1 X91.9138 Y167.3239
+G1 X91.8851 Y167.3649
+G1 X91.8564 Y167.4058
+G1 X91.8277 Y167.4468
+G1 X91.7990 Y167.4877
+G1 X91.7702 Y167.5286
+G1 X91.7415 Y167.5695
+G1 X91.7127 Y167.6104
+G1 X91.6839 Y167.6512
+G1 X91.6550 Y167.6921
+G1 X91.6262 Y167.7329
+G1 X91.5973 Y167.7737
+G1 X91.5684 Y167.8145
+G1 X91.5395 Y167.8553
+G1 X91.5105 Y167.8961
+G1 X91.4816 Y167.9368
+G1 X91.4526 Y167.9776
+G1 X91.4236 Y168.0183
+G1 X91.3946 Y168.0590
+G1 X91.3655 Y168.0997
+G1 X91.3365 Y168.1404
+G1 X91.3074 Y168.1811
+G1 X91.2783 Y168.2218
+G1 X91.2492 Y168.2624
+G1 X91.2200 Y168.3030
+G1 X91.1909 Y168.3437
+G1 X91.1617 Y168.3843
+G1 X91.1325 Y168.4248
+G1 X91.1033 Y168.4654
+G1 X91.0740 Y168.5060
+G1 X91.0448 Y168.5465
+G1 X91.0155 Y168.5870
+G1 X90.9862 Y168.6276
+G1 X90.9568 Y168.6680
+G1 X90.9275 Y168.7085
+G1 X90.8981 Y168.7490
+G1 X90.8688 Y168.7895
+G1 X90.8394 Y168.8299
+G1 X90.8099 Y168.8703
+G1 X90.7805 Y168.9107
+G1 X90.7510 Y168.9511
+G1 X90.7215 Y168.9915
+G1 X90.6920 Y169.0319
+G1 X90.6625 Y169.0722
+G1 X90.6330 Y169.1126
+G1 X90.6034 Y169.1529
+G1 X90.5738 Y169.1932
+G1 X90.5442 Y169.2335
+G1 X90.5146 Y169.2738
+G1 X90.4849 Y169.3140
+G1 X90.4553 Y169.3543
+G1 X90.4256 Y169.3945
+G1 X90.3959 Y169.4347
+G1 X90.3661 Y169.4749
+G1 X90.3364 Y169.5151
+G1 X90.3066 Y169.5553
+G1 X90.2768 Y169.5954
+G1 X90.2470 Y169.6356
+G1 X90.2172 Y169.6757
+G1 X90.1873 Y169.7158
+G1 X90.1575 Y169.7559
+G1 X90.1276 Y169.7960
+G1 X90.0977 Y169.8361
+G1 X90.0678 Y169.8761
+G1 X90.0378 Y169.9162
+G1 X90.0078 Y169.9562
+G1 X89.9778 Y169.9962
+G1 X89.9478 Y170.0362
+G1 X89.9178 Y170.0762
+G1 X89.8878 Y170.1161
+G1 X89.8577 Y170.1561
+G1 X89.8276 Y170.1960
+G1 X89.7975 Y170.2359
+G1 X89.7674 Y170.2758
+G1 X89.7372 Y170.3157
+G1 X89.7071 Y170.3556
+G1 X89.6769 Y170.3955
+G1 X89.6467 Y170.4353
+G1 X89.6164 Y170.4751
+G1 X89.5862 Y170.5150
+G1 X89.5559 Y170.5547
+G1 X89.5256 Y170.5945
+G1 X89.4953 Y170.6343
+G1 X89.4650 Y170.6741
+G1 X89.4346 Y170.7138
+G1 X89.4043 Y170.7535
+G1 X89.3739 Y170.7932
+G1 X89.3435 Y170.8329
+G1 X89.3131 Y170.8726
+G1 X89.2826 Y170.9122
+G1 X89.2521 Y170.9519
+G1 X89.2217 Y170.9915
+G1 X89.1912 Y171.0311
+G1 X89.1606 Y171.0707
+G1 X89.1301 Y171.1103
+G1 X89.0995 Y171.1499
+G1 X89.0689 Y171.1895
+G1 X89.0383 Y171.2290
+G1 X89.0077 Y171.2685
+G1 X88.9771 Y171.3080
+G1 X88.9464 Y171.3475
+G1 X88.9157 Y171.3870
+G1 X88.8850 Y171.4265
+G1 X88.8543 Y171.4659
+G1 X88.8235 Y171.5053
+G1 X88.7928 Y171.5448
+G1 X88.7620 Y171.5842
+G1 X88.7312 Y171.6235
+G1 X88.7004 Y171.6629
+G1 X88.6695 Y171.7023
+G1 X88.6387 Y171.7416
+G1 X88.6078 Y171.7809
+G1 X88.5769 Y171.8202
+G1 X88.5460 Y171.8595
+G1 X88.5150 Y171.8988
+G1 X88.4841 Y171.9381
+G1 X88.4531 Y171.9773
+G1 X88.4221 Y172.0165
+G1 X88.3911 Y172.0558
+G1 X88.3600 Y172.0950
+G1 X88.3290 Y172.1342
+G1 X88.2979 Y172.1733
+G1 X88.2668 Y172.2125
+G1 X88.2357 Y172.2516
+G1 X88.2046 Y172.2907
+G1 X88.1734 Y172.3298
+G1 X88.1422 Y172.3689
+G1 X88.1110 Y172.4080
+G1 X88.0798 Y172.4471
+G1 X88.0486 Y172.4861
+G1 X88.0173 Y172.5251
+G1 X87.9861 Y172.5642
+G1 X87.9548 Y172.6032
+G1 X87.9235 Y172.6421
+G1 X87.8921 Y172.6811
+G1 X87.8608 Y172.7201
+G1 X87.8294 Y172.7590
+G1 X87.7980 Y172.7979
+G1 X87.7666 Y172.8368
+G1 X87.7352 Y172.8757
+G1 X87.7037 Y172.9146
+G1 X87.6723 Y172.9534
+G1 X87.6408 Y172.9923
+G1 X87.6093 Y173.0311
+G1 X87.5778 Y173.0699
+G1 X87.5462 Y173.1087
+G1 X87.5146 Y173.1475
+G1 X87.4831 Y173.1862
+G1 X87.4515 Y173.2250
+G1 X87.4198 Y173.2637
+G1 X87.3882 Y173.3024
+G1 X87.3565 Y173.3411
+G1 X87.3249 Y173.3798
+G1 X87.2932 Y173.4185
+G1 X87.2614 Y173.4571
+G1 X87.2297 Y173.4958
+G1 X87.1979 Y173.5344
+G1 X87.1662 Y173.5730
+G1 X87.1344 Y173.6116
+G1 X87.1026 Y173.6501
+G1 X87.0707 Y173.6887
+G1 X87.0389 Y173.7272
+G1 X87.0070 Y173.7658
+G1 X86.9751 Y173.8043
+G1 X86.9432 Y173.8428
+G1 X86.9113 Y173.8812
+G1 X86.8793 Y173.9197
+G1 X86.8473 Y173.9581
+G1 X86.8153 Y173.9966
+G1 X86.7833 Y174.0350
+G1 X86.7513 Y174.0734
+G1 X86.7193 Y174.1118
+G1 X86.6872 Y174.1501
+G1 X86.6551 Y174.1885
+G1 X86.6230 Y174.2268
+G1 X86.5909 Y174.2651
+G1 X86.5587 Y174.3034
+G1 X86.5266 Y174.3417
+G1 X86.4944 Y174.3800
+G1 X86.4622 Y174.4182
+G1 X86.4300 Y174.4565
+G1 X86.3977 Y174.4947
+G1 X86.3655 Y174.5329
+G1 X86.3332 Y174.5711
+G1 X86.3009 Y174.6092
+G1 X86.2686 Y174.6474
+G1 X86.2363 Y174.6855
+G1 X86.2039 Y174.7237
+G1 X86.1715 Y174.7618
+G1 X86.1392 Y174.7999
+G1 X86.1067 Y174.8379
+G1 X86.0743 Y174.8760
+G1 X86.0419 Y174.9140
+G1 X86.0094 Y174.9521
+G1 X85.9769 Y174.9901
+G1 X85.9444 Y175.0281
+G1 X85.9119 Y175.0660
+G1 X85.8793 Y175.1040
+G1 X85.8468 Y175.1419
+G1 X85.8142 Y175.1799
+G1 X85.7816 Y175.2178
+G1 X85.7490 Y175.2557
+G1 X85.7164 Y175.2935
+G1 X85.6837 Y175.3314
+G1 X85.6510 Y175.3693
+G1 X85.6183 Y175.4071
+G1 X85.5856 Y175.4449
+G1 X85.5529 Y175.4827
+G1 X85.5201 Y175.5205
+G1 X85.4874 Y175.5582
+G1 X85.4546 Y175.5960
+G1 X85.4218 Y175.6337
+G1 X85.3889 Y175.6714
+G1 X85.3561 Y175.7091
+G1 X85.3232 Y175.7468
+G1 X85.2903 Y175.7845
+G1 X85.2574 Y175.8221
+G1 X85.2245 Y175.8598
+G1 X85.1916 Y175.8974
+G1 X85.1586 Y175.9350
+G1 X85.1257 Y175.9726
+G1 X85.0927 Y176.0101
+G1 X85.0596 Y176.0477
+G1 X85.0266 Y176.0852
+G1 X84.9936 Y176.1227
+G1 X84.9605 Y176.1602
+G1 X84.9274 Y176.1977
+G1 X84.8943 Y176.2352
+G1 X84.8612 Y176.2726
+G1 X84.8280 Y176.3101
+G1 X84.7949 Y176.3475
+G1 X84.7617 Y176.3849
+G1 X84.7285 Y176.4223
+G1 X84.6952 Y176.4596
+G1 X84.6620 Y176.4970
+G1 X84.6287 Y176.5343
+G1 X84.5955 Y176.5717
+G1 X84.5622 Y176.6090
+G1 X84.5289 Y176.6462
+G1 X84.4955 Y176.6835
+G1 X84.4622 Y176.7208
+G1 X84.4288 Y176.7580
+G1 X84.3954 Y176.7952
+G1 X84.3620 Y176.8324
+G1 X84.3286 Y176.8696
+G1 X84.2951 Y176.9068
+G1 X84.2617 Y176.9439
+G1 X84.2282 Y176.9811
+G1 X84.1947 Y177.0182
+G1 X84.1612 Y177.0553
+G1 X84.1276 Y177.0924
+G1 X84.0941 Y177.1294
+G1 X84.0605 Y177.1665
+G1 X84.0269 Y177.2035
+G1 X83.9933 Y177.2405
+G1 X83.9597 Y177.2775
+G1 X83.9260 Y177.3145
+G1 X83.8924 Y177.3515
+G1 X83.8587 Y177.3884
+G1 X83.8250 Y177.4254
+G1 X83.7913 Y177.4623
+G1 X83.7575 Y177.4992
+G1 X83.7238 Y177.5361
+G1 X83.6900 Y177.5729
+G1 X83.6562 Y177.6098
+G1 X83.6224 Y177.6466
+G1 X83.5885 Y177.6834
+G1 X83.5547 Y177.7202
+G1 X83.5208 Y177.7570
+G1 X83.4869 Y177.7938
+G1 X83.4530 Y177.8305
+G1 X83.4191 Y177.8673
+G1 X83.3852 Y177.9040
+G1 X83.3512 Y177.9407
+G1 X83.3172 Y177.9773
+G1 X83.2832 Y178.0140
+G1 X83.2492 Y178.0507
+G1 X83.2152 Y178.0873
+G1 X83.1811 Y178.1239
+G1 X83.1470 Y178.1605
+G1 X83.1130 Y178.1971
+G1 X83.0788 Y178.2336
+G1 X83.0447 Y178.2702
+G1 X83.0106 Y178.3067
+G1 X82.9764 Y178.3432
+G1 X82.9422 Y178.3797
+G1 X82.9080 Y178.4162
+G1 X82.8738 Y178.4526
+G1 X82.8396 Y178.4891
+G1 X82.8053 Y178.5255
+G1 X82.7711 Y178.5619
+G1 X82.7368 Y178.5983
+G1 X82.7025 Y178.6347
+G1 X82.6681 Y178.6710
+G1 X82.6338 Y178.7074
+G1 X82.5994 Y178.7437
+G1 X82.5650 Y178.7800
+G1 X82.5306 Y178.8163
+G1 X82.4962 Y178.8525
+G1 X82.4618 Y178.8888
+G1 X82.4273 Y178.9250
+G1 X82.3929 Y178.9612
+G1 X82.3584 Y178.9974
+G1 X82.3239 Y179.0336
+G1 X82.2893 Y179.0698
+G1 X82.2548 Y179.1059
+G1 X82.2202 Y179.1421
+G1 X82.1857 Y179.1782
+G1 X82.1511 Y179.2143
+G1 X82.1164 Y179.2504
+G1 X82.0818 Y179.2864
+G1 X82.0472 Y179.3225
+G1 X82.0125 Y179.3585
+G1 X81.9778 Y179.3945
+G1 X81.9431 Y179.4305
+G1 X81.9084 Y179.4665
+G1 X81.8736 Y179.5024
+G1 X81.8389 Y179.5384
+G1 X81.8041 Y179.5743
+G1 X81.7693 Y179.6102
+G1 X81.7345 Y179.6461
+G1 X81.6996 Y179.6820
+G1 X81.6648 Y179.7178
+G1 X81.6299 Y179.7536
+G1 X81.5950 Y179.7895
+G1 X81.5601 Y179.8253
+G1 X81.5252 Y179.8610
+G1 X81.4903 Y179.8968
+G1 X81.4553 Y179.9326
+G1 X81.4203 Y179.9683
+G1 X81.3854 Y180.0040
+G1 X81.3503 Y180.0397
+G1 X81.3153 Y180.0754
+G1 X81.2803 Y180.1110
+G1 X81.2452 Y180.1467
+G1 X81.2101 Y180.1823
+G1 X81.1750 Y180.2179
+G1 X81.1399 Y180.2535
+G1 X81.1048 Y180.2891
+G1 X81.0696 Y180.3246
+G1 X81.0344 Y180.3602
+G1 X80.9993 Y180.3957
+G1 X80.9640 Y180.4312
+G1 X80.9288 Y180.4667
+G1 X80.8936 Y180.5022
+G1 X80.8583 Y180.5376
+G1 X80.8230 Y180.5730
+G1 X80.7877 Y180.6085
+G1 X80.7524 Y180.6439
+G1 X80.7171 Y180.6792
+G1 X80.6818 Y180.7146
+G1 X80.6464 Y180.7499
+G1 X80.6110 Y180.7853
+G1 X80.5756 Y180.8206
+G1 X80.5402 Y180.8559
+G1 X80.5047 Y180.8911
+G1 X80.4693 Y180.9264
+G1 X80.4338 Y180.9616
+G1 X80.3983 Y180.9969
+G1 X80.3628 Y181.0321
+G1 X80.3273 Y181.0673
+G1 X80.2918 Y181.1024
+G1 X80.2562 Y181.1376
+G1 X80.2206 Y181.1727
+G1 X80.1850 Y181.2078
+G1 X80.1494 Y181.2429
+G1 X80.1138 Y181.2780
+G1 X80.0781 Y181.3130
+G1 X80.0425 Y181.3481
+G1 X80.0068 Y181.3831
+G1 X79.9711 Y181.4181
+G1 X79.9354 Y181.4531
+G1 X79.8996 Y181.4881
+G1 X79.8639 Y181.5230
+G1 X79.8281 Y181.5580
+G1 X79.7923 Y181.5929
+G1 X79.7565 Y181.6278
+G1 X79.7207 Y181.6627
+G1 X79.6849 Y181.6975
+G1 X79.6490 Y181.7324
+G1 X79.6131 Y181.7672
+G1 X79.5772 Y181.8020
+G1 X79.5413 Y181.8368
+G1 X79.5054 Y181.8716
+G1 X79.4694 Y181.9063
+G1 X79.4335 Y181.9411
+G1 X79.3975 Y181.9758
+G1 X79.3615 Y182.0105
+G1 X79.3255 Y182.0452
+G1 X79.2895 Y182.0799
+G1 X79.2534 Y182.1145
+G1 X79.2173 Y182.1491
+G1 X79.1813 Y182.1837
+G1 X79.1452 Y182.2183
+G1 X79.1090 Y182.2529
+G1 X79.0729 Y182.2875
+G1 X79.0368 Y182.3220
+G1 X79.0006 Y182.3565
+G1 X78.9644 Y182.3910
+G1 X78.9282 Y182.4255
+G1 X78.8920 Y182.4600
+G1 X78.8557 Y182.4944
+G1 X78.8195 Y182.5289
+G1 X78.7832 Y182.5633
+G1 X78.7469 Y182.5977
+G1 X78.7106 Y182.6321
+G1 X78.6743 Y182.6664
+G1 X78.6379 Y182.7008
+G1 X78.6016 Y182.7351
+G1 X78.5652 Y182.7694
+G1 X78.5288 Y182.8037
+G1 X78.4924 Y182.8379
+G1 X78.4560 Y182.8722
+G1 X78.4195 Y182.9064
+G1 X78.3831 Y182.9406
+G1 X78.3466 Y182.9748
+G1 X78.3101 Y183.0090
+G1 X78.2736 Y183.0432
+G1 X78.2371 Y183.0773
+G1 X78.2005 Y183.1114
+G1 X78.1639 Y183.1455
+G1 X78.1274 Y183.1796
+G1 X78.0908 Y183.2137
+G1 X78.0541 Y183.2477
+G1 X78.0175 Y183.2818
+G1 X77.9809 Y183.3158
+G1 X77.9442 Y183.3498
+G1 X77.9075 Y183.3837
+G1 X77.8708 Y183.4177
+G1 X77.8341 Y183.4516
+G1 X77.7974 Y183.4856
+G1 X77.7606 Y183.5195
+G1 X77.7238 Y183.5533
+G1 X77.6871 Y183.5872
+G1 X77.6503 Y183.6211
+G1 X77.6134 Y183.6549
+G1 X77.5766 Y183.6887
+G1 X77.5398 Y183.7225
+G1 X77.5029 Y183.7563
+G1 X77.4660 Y183.7900
+G1 X77.4291 Y183.8237
+G1 X77.3922 Y183.8575
+G1 X77.3552 Y183.8912
+G1 X77.3183 Y183.9248
+G1 X77.2813 Y183.9585
+G1 X77.2443 Y183.9921
+G1 X77.2073 Y184.0258
+G1 X77.1703 Y184.0594
+G1 X77.1333 Y184.0930
+G1 X77.0962 Y184.1265
+G1 X77.0591 Y184.1601
+G1 X77.0220 Y184.1936
+G1 X76.9849 Y184.2271
+G1 X76.9478 Y184.2606
+G1 X76.9107 Y184.2941
+G1 X76.8735 Y184.3276
+G1 X76.8363 Y184.3610
+G1 X76.7992 Y184.3944
+G1 X76.7620 Y184.4278
+G1 X76.7247 Y184.4612
+G1 X76.6875 Y184.4946
+G1 X76.6502 Y184.5279
+G1 X76.6130 Y184.5613
+G1 X76.5757 Y184.5946
+G1 X76.5384 Y184.6279
+G1 X76.5010 Y184.6611
+G1 X76.4637 Y184.6944
+G1 X76.4264 Y184.7276
+G1 X76.3890 Y184.7608
+G1 X76.3516 Y184.7940
+G1 X76.3142 Y184.8272
+G1 X76.2768 Y184.8604
+G1 X76.2393 Y184.8935
+G1 X76.2019 Y184.9266
+G1 X76.1644 Y184.9597
+G1 X76.1269 Y184.9928
+G1 X76.0894 Y185.0259
+G1 X76.0519 Y185.0589
+G1 X76.0143 Y185.0920
+G1 X75.9768 Y185.1250
+G1 X75.9392 Y185.1580
+G1 X75.9016 Y185.1909
+G1 X75.8640 Y185.2239
+G1 X75.8264 Y185.2568
+G1 X75.7888 Y185.2898
+G1 X75.7511 Y185.3226
+G1 X75.7135 Y185.3555
+G1 X75.6758 Y185.3884
+G1 X75.6381 Y185.4212
+G1 X75.6003 Y185.4541
+G1 X75.5626 Y185.4869
+G1 X75.5249 Y185.5196
+G1 X75.4871 Y185.5524
+G1 X75.4493 Y185.5851
+G1 X75.4115 Y185.6179
+G1 X75.3737 Y185.6506
+G1 X75.3359 Y185.6833
+G1 X75.2980 Y185.7159
+G1 X75.2601 Y185.7486
+G1 X75.2223 Y185.7812
+G1 X75.1844 Y185.8138
+G1 X75.1464 Y185.8464
+G1 X75.1085 Y185.8790
+G1 X75.0706 Y185.9116
+G1 X75.0326 Y185.9441
+G1 X74.9946 Y185.9766
+G1 X74.9566 Y186.0091
+G1 X74.9186 Y186.0416
+G1 X74.8806 Y186.0741
+G1 X74.8425 Y186.1065
+G1 X74.8045 Y186.1389
+G1 X74.7664 Y186.1713
+G1 X74.7283 Y186.2037
+G1 X74.6902 Y186.2361
+G1 X74.6521 Y186.2685
+G1 X74.6139 Y186.3008
+G1 X74.5758 Y186.3331
+G1 X74.5376 Y186.3654
+G1 X74.4994 Y186.3977
+G1 X74.4612 Y186.4299
+G1 X74.4230 Y186.4621
+G1 X74.3847 Y186.4944
+G1 X74.3465 Y186.5265
+G1 X74.3082 Y186.5587
+G1 X74.2699 Y186.5909
+G1 X74.2316 Y186.6230
+G1 X74.1933 Y186.6551
+G1 X74.1550 Y186.6872
+G1 X74.1166 Y186.7193
+G1 X74.0782 Y186.7514
+G1 X74.0399 Y186.7834
+G1 X74.0015 Y186.8154
+G1 X73.9630 Y186.8474
+G1 X73.9246 Y186.8794
+G1 X73.8862 Y186.9114
+G1 X73.8477 Y186.9433
+G1 X73.8092 Y186.9753
+G1 X73.7707 Y187.0072
+G1 X73.7322 Y187.0391
+G1 X73.6937 Y187.0709
+G1 X73.6551 Y187.1028
+G1 X73.6166 Y187.1346
+G1 X73.5780 Y187.1664
+G1 X73.5394 Y187.1982
+G1 X73.5008 Y187.2300
+G1 X73.4622 Y187.2617
+G1 X73.4235 Y187.2935
+G1 X73.3849 Y187.3252
+G1 X73.3462 Y187.3569
+G1 X73.3075 Y187.3886
+G1 X73.2688 Y187.4202
+G1 X73.2301 Y187.4519
+G1 X73.1914 Y187.4835
+G1 X73.1526 Y187.5151
+G1 X73.1139 Y187.5467
+G1 X73.0751 Y187.5782
+G1 X73.0363 Y187.6098
+G1 X72.9975 Y187.6413
+G1 X72.9586 Y187.6728
+G1 X72.9198 Y187.7043
+G1 X72.8809 Y187.7357
+G1 X72.8421 Y187.7672
+G1 X72.8032 Y187.7986
+G1 X72.7643 Y187.8300
+G1 X72.7253 Y187.8614
+G1 X72.6864 Y187.8927
+G1 X72.6475 Y187.9241
+G1 X72.6085 Y187.9554
+G1 X72.5695 Y187.9867
+G1 X72.5305 Y188.0180
+G1 X72.4915 Y188.0493
+G1 X72.4524 Y188.0805
+G1 X72.4134 Y188.1118
+G1 X72.3743 Y188.1430
+G1 X72.3353 Y188.1742
+G1 X72.2962 Y188.2053
+G1 X72.2571 Y188.2365
+G1 X72.2179 Y188.2676
+G1 X72.1788 Y188.2987
+G1 X72.1396 Y188.3298
+G1 X72.1005 Y188.3609
+G1 X72.0613 Y188.3919
+G1 X72.0221 Y188.4230
+G1 X71.9828 Y188.4540
+G1 X71.9436 Y188.4850
+G1 X71.9044 Y188.5160
+G1 X71.8651 Y188.5469
+G1 X71.8258 Y188.5778
+G1 X71.7865 Y188.6088
+G1 X71.7472 Y188.6397
+G1 X71.7079 Y188.6705
+G1 X71.6685 Y188.7014
+G1 X71.6292 Y188.7322
+G1 X71.5898 Y188.7630
+G1 X71.5504 Y188.7938
+G1 X71.5110 Y188.8246
+G1 X71.4716 Y188.8554
+G1 X71.4321 Y188.8861
+G1 X71.3927 Y188.9168
+G1 X71.3532 Y188.9475
+G1 X71.3138 Y188.9782
+G1 X71.2743 Y189.0089
+G1 X71.2347 Y189.0395
+G1 X71.1952 Y189.0701
+G1 X71.1557 Y189.1007
+G1 X71.1161 Y189.1313
+G1 X71.0765 Y189.1619
+G1 X71.0370 Y189.1924
+G1 X70.9973 Y189.2229
+G1 X70.9577 Y189.2534
+G1 X70.9181 Y189.2839
+G1 X70.8784 Y189.3144
+G1 X70.8388 Y189.3448
+G1 X70.7991 Y189.3752
+G1 X70.7594 Y189.4056
+G1 X70.7197 Y189.4360
+G1 X70.6800 Y189.4664
+G1 X70.6402 Y189.4967
+G1 X70.6005 Y189.5271
+G1 X70.5607 Y189.5574
+G1 X70.5209 Y189.5876
+G1 X70.4811 Y189.6179
+G1 X70.4413 Y189.6481
+G1 X70.4015 Y189.6784
+G1 X70.3616 Y189.7086
+G1 X70.3218 Y189.7388
+G1 X70.2819 Y189.7689
+G1 X70.2420 Y189.7991
+G1 X70.2021 Y189.8292
+G1 X70.1622 Y189.8593
+G1 X70.1222 Y189.8894
+G1 X70.0823 Y189.9194
+G1 X70.0423 Y189.9495
+G1 X70.0023 Y189.9795
+G1 X69.9623 Y190.0095
+G1 X69.9223 Y190.0395
+G1 X69.8823 Y190.0695
+G1 X69.8422 Y190.0994
+G1 X69.8022 Y190.1293
+G1 X69.7621 Y190.1592
+G1 X69.7220 Y190.1891
+G1 X69.6819 Y190.2190
+G1 X69.6418 Y190.2488
+G1 X69.6017 Y190.2786
+G1 X69.5615 Y190.3084
+G1 X69.5214 Y190.3382
+G1 X69.4812 Y190.3680
+G1 X69.4410 Y190.3977
+G1 X69.4008 Y190.4275
+G1 X69.3606 Y190.4572
+G1 X69.3203 Y190.4868
+G1 X69.2801 Y190.5165
+G1 X69.2398 Y190.5461
+G1 X69.1995 Y190.5758
+G1 X69.1592 Y190.6054
+G1 X69.1189 Y190.6349
+G1 X69.0786 Y190.6645
+G1 X69.0383 Y190.6941
+G1 X68.9979 Y190.7236
+G1 X68.9575 Y190.7531
+G1 X68.9172 Y190.7826
+G1 X68.8768 Y190.8120
+G1 X68.8363 Y190.8415
+G1 X68.7959 Y190.8709
+G1 X68.7555 Y190.9003
+G1 X68.7150 Y190.9297
+G1 X68.6745 Y190.9590
+G1 X68.6341 Y190.9884
+G1 X68.5936 Y191.0177
+G1 X68.5530 Y191.0470
+G1 X68.5125 Y191.0763
+G1 X68.4720 Y191.1055
+G1 X68.4314 Y191.1348
+G1 X68.3908 Y191.1640
+G1 X68.3502 Y191.1932
+G1 X68.3096 Y191.2223
+G1 X68.2690 Y191.2515
+G1 X68.2284 Y191.2806
+G1 X68.1877 Y191.3098
+G1 X68.1471 Y191.3389
+G1 X68.1064 Y191.3679
+G1 X68.0657 Y191.3970
+G1 X68.0250 Y191.4260
+G1 X67.9843 Y191.4550
+G1 X67.9435 Y191.4840
+G1 X67.9028 Y191.5130
+G1 X67.8620 Y191.5420
+G1 X67.8213 Y191.5709
+G1 X67.7805 Y191.5998
+G1 X67.7397 Y191.6287
+G1 X67.6988 Y191.6576
+G1 X67.6580 Y191.6864
+G1 X67.6172 Y191.7153
+G1 X67.5763 Y191.7441
+G1 X67.5354 Y191.7729
+G1 X67.4945 Y191.8016
+G1 X67.4536 Y191.8304
+G1 X67.4127 Y191.8591
+G1 X67.3717 Y191.8878
+G1 X67.3308 Y191.9165
+G1 X67.2898 Y191.9452
+G1 X67.2488 Y191.9738
+G1 X67.2079 Y192.0024
+G1 X67.1668 Y192.0310
+G1 X67.1258 Y192.0596
+G1 X67.0848 Y192.0882
+G1 X67.0437 Y192.1167
+G1 X67.0027 Y192.1453
+G1 X66.9616 Y192.1738
+G1 X66.9205 Y192.2023
+G1 X66.8794 Y192.2307
+G1 X66.8383 Y192.2592
+G1 X66.7971 Y192.2876
+G1 X66.7560 Y192.3160
+G1 X66.7148 Y192.3444
+G1 X66.6736 Y192.3727
+G1 X66.6324 Y192.4011
+G1 X66.5912 Y192.4294
+G1 X66.5500 Y192.4577
+G1 X66.5088 Y192.4860
+G1 X66.4675 Y192.5142
+G1 X66.4263 Y192.5424
+G1 X66.3850 Y192.5707
+G1 X66.3437 Y192.5989
+G1 X66.3024 Y192.6270
+G1 X66.2611 Y192.6552
+G1 X66.2197 Y192.6833
+G1 X66.1784 Y192.7114
+G1 X66.1370 Y192.7395
+G1 X66.0956 Y192.7676
+G1 X66.0542 Y192.7956
+G1 X66.0128 Y192.8237
+G1 X65.9714 Y192.8517
+G1 X65.9300 Y192.8797
+G1 X65.8885 Y192.9076
+G1 X65.8471 Y192.9356
+G1 X65.8056 Y192.9635
+G1 X65.7641 Y192.9914
+G1 X65.7226 Y193.0193
+G1 X65.6811 Y193.0472
+G1 X65.6396 Y193.0750
+G1 X65.5980 Y193.1028
+G1 X65.5565 Y193.1306
+G1 X65.5149 Y193.1584
+G1 X65.4733 Y193.1862
+G1 X65.4317 Y193.2139
+G1 X65.3901 Y193.2416
+G1 X65.3485 Y193.2693
+G1 X65.3068 Y193.2970
+G1 X65.2652 Y193.3246
+G1 X65.2235 Y193.3523
+G1 X65.1818 Y193.3799
+G1 X65.1401 Y193.4075
+G1 X65.0984 Y193.4351
+G1 X65.0567 Y193.4626
+G1 X65.0149 Y193.4901
+G1 X64.9732 Y193.5177
+G1 X64.9314 Y193.5451
+G1 X64.8897 Y193.5726
+G1 X64.8479 Y193.6001
+G1 X64.8061 Y193.6275
+G1 X64.7642 Y193.6549
+G1 X64.7224 Y193.6823
+G1 X64.6805 Y193.7096
+G1 X64.6387 Y193.7370
+G1 X64.5968 Y193.7643
+G1 X64.5549 Y193.7916
+G1 X64.5130 Y193.8189
+G1 X64.4711 Y193.8461
+G1 X64.4292 Y193.8734
+G1 X64.3872 Y193.9006
+G1 X64.3453 Y193.9278
+G1 X64.3033 Y193.9550
+G1 X64.2613 Y193.9821
+G1 X64.2193 Y194.0092
+G1 X64.1773 Y194.0364
+G1 X64.1353 Y194.0634
+G1 X64.0932 Y194.0905
+G1 X64.0512 Y194.1176
+G1 X64.0091 Y194.1446
+G1 X63.9671 Y194.1716
+G1 X63.9250 Y194.1986
+G1 X63.8829 Y194.2256
+G1 X63.8407 Y194.2525
+G1 X63.7986 Y194.2794
+G1 X63.7565 Y194.3063
+G1 X63.7143 Y194.3332
+G1 X63.6721 Y194.3601
+G1 X63.6299 Y194.3869
+G1 X63.5877 Y194.4137
+G1 X63.5455 Y194.4405
+G1 X63.5033 Y194.4673
+G1 X63.4611 Y194.4940
+G1 X63.4188 Y194.5208
+G1 X63.3765 Y194.5475
+G1 X63.3343 Y194.5742
+G1 X63.2920 Y194.6008
+G1 X63.2496 Y194.6275
+G1 X63.2073 Y194.6541
+G1 X63.1650 Y194.6807
+G1 X63.1226 Y194.7073
+G1 X63.0803 Y194.7339
+G1 X63.0379 Y194.7604
+G1 X62.9955 Y194.7869
+G1 X62.9531 Y194.8134
+G1 X62.9107 Y194.8399
+G1 X62.8683 Y194.8664
+G1 X62.8258 Y194.8928
+G1 X62.7834 Y194.9192
+G1 X62.7409 Y194.9456
+G1 X62.6984 Y194.9720
+G1 X62.6560 Y194.9983
+G1 X62.6135 Y195.0247
+G1 X62.5709 Y195.0510
+G1 X62.5284 Y195.0773
+G1 X62.4859 Y195.1035
+G1 X62.4433 Y195.1298
+G1 X62.4007 Y195.1560
+G1 X62.3581 Y195.1822
+G1 X62.3155 Y195.2084
+G1 X62.2729 Y195.2345
+G1 X62.2303 Y195.2607
+G1 X62.1877 Y195.2868
+G1 X62.1450 Y195.3129
+G1 X62.1024 Y195.3390
+G1 X62.0597 Y195.3650
+G1 X62.0170 Y195.3910
+G1 X61.9743 Y195.4171
+G1 X61.9316 Y195.4430
+G1 X61.8888 Y195.4690
+G1 X61.8461 Y195.4950
+G1 X61.8034 Y195.5209
+G1 X61.7606 Y195.5468
+G1 X61.7178 Y195.5727
+G1 X61.6750 Y195.5985
+G1 X61.6322 Y195.6244
+G1 X61.5894 Y195.6502
+G1 X61.5466 Y195.6760
+G1 X61.5037 Y195.7018
+G1 X61.4609 Y195.7275
+G1 X61.4180 Y195.7532
+G1 X61.3751 Y195.7790
+G1 X61.3322 Y195.8046
+G1 X61.2893 Y195.8303
+G1 X61.2464 Y195.8560
+G1 X61.2034 Y195.8816
+G1 X61.1605 Y195.9072
+G1 X61.1175 Y195.9328
+G1 X61.0746 Y195.9583
+G1 X61.0316 Y195.9839
+G1 X60.9886 Y196.0094
+G1 X60.9456 Y196.0349
+G1 X60.9025 Y196.0604
+G1 X60.8595 Y196.0858
+G1 X60.8165 Y196.1112
+G1 X60.7734 Y196.1367
+G1 X60.7303 Y196.1620
+G1 X60.6872 Y196.1874
+G1 X60.6441 Y196.2128
+G1 X60.6010 Y196.2381
+G1 X60.5579 Y196.2634
+G1 X60.5148 Y196.2887
+G1 X60.4716 Y196.3139
+G1 X60.4284 Y196.3392
+G1 X60.3853 Y196.3644
+G1 X60.3421 Y196.3896
+G1 X60.2989 Y196.4147
+G1 X60.2557 Y196.4399
+G1 X60.2124 Y196.4650
+G1 X60.1692 Y196.4901
+G1 X60.1259 Y196.5152
+G1 X60.0827 Y196.5403
+G1 X60.0394 Y196.5653
+G1 X59.9961 Y196.5903
+G1 X59.9528 Y196.6153
+G1 X59.9095 Y196.6403
+G1 X59.8662 Y196.6653
+G1 X59.8228 Y196.6902
+G1 X59.7795 Y196.7151
+G1 X59.7361 Y196.7400
+G1 X59.6927 Y196.7649
+G1 X59.6494 Y196.7897
+G1 X59.6060 Y196.8146
+G1 X59.5625 Y196.8394
+G1 X59.5191 Y196.8641
+G1 X59.4757 Y196.8889
+G1 X59.4322 Y196.9136
+G1 X59.3888 Y196.9384
+G1 X59.3453 Y196.9631
+G1 X59.3018 Y196.9877
+G1 X59.2583 Y197.0124
+G1 X59.2148 Y197.0370
+G1 X59.1713 Y197.0616
+G1 X59.1277 Y197.0862
+G1 X59.0842 Y197.1108
+G1 X59.0406 Y197.1353
+G1 X58.9970 Y197.1598
+G1 X58.9535 Y197.1843
+G1 X58.9099 Y197.2088
+G1 X58.8662 Y197.2333
+G1 X58.8226 Y197.2577
+G1 X58.7790 Y197.2821
+G1 X58.7353 Y197.3065
+G1 X58.6917 Y197.3309
+G1 X58.6480 Y197.3552
+G1 X58.6043 Y197.3796
+G1 X58.5606 Y197.4039
+G1 X58.5169 Y197.4281
+G1 X58.4732 Y197.4524
+G1 X58.4295 Y197.4766
+G1 X58.3857 Y197.5009
+G1 X58.3420 Y197.5251
+G1 X58.2982 Y197.5492
+G1 X58.2544 Y197.5734
+G1 X58.2106 Y197.5975
+G1 X58.1668 Y197.6216
+G1 X58.1230 Y197.6457
+G1 X58.0792 Y197.6698
+G1 X58.0353 Y197.6938
+G1 X57.9915 Y197.7178
+G1 X57.9476 Y197.7418
+G1 X57.9037 Y197.7658
+G1 X57.8599 Y197.7898
+G1 X57.8160 Y197.8137
+G1 X57.7720 Y197.8376
+G1 X57.7281 Y197.8615
+G1 X57.6842 Y197.8853
+G1 X57.6402 Y197.9092
+G1 X57.5963 Y197.9330
+G1 X57.5523 Y197.9568
+G1 X57.5083 Y197.9806
+G1 X57.4643 Y198.0043
+G1 X57.4203 Y198.0281
+G1 X57.3763 Y198.0518
+G1 X57.3323 Y198.0755
+G1 X57.2882 Y198.0991
+G1 X57.2442 Y198.1228
+G1 X57.2001 Y198.1464
+G1 X57.1560 Y198.1700
+G1 X57.1119 Y198.1936
+G1 X57.0678 Y198.2172
+G1 X57.0237 Y198.2407
+G1 X56.9796 Y198.2642
+G1 X56.9354 Y198.2877
+G1 X56.8913 Y198.3112
+G1 X56.8471 Y198.3346
+G1 X56.8030 Y198.3580
+G1 X56.7588 Y198.3814
+G1 X56.7146 Y198.4048
+G1 X56.6704 Y198.4282
+G1 X56.6261 Y198.4515
+G1 X56.5819 Y198.4748
+G1 X56.5377 Y198.4981
+G1 X56.4934 Y198.5214
+G1 X56.4492 Y198.5446
+G1 X56.4049 Y198.5679
+G1 X56.3606 Y198.5911
+G1 X56.3163 Y198.6143
+G1 X56.2720 Y198.6374
+G1 X56.2276 Y198.6605
+G1 X56.1833 Y198.6837
+G1 X56.1390 Y198.7068
+G1 X56.0946 Y198.7298
+G1 X56.0502 Y198.7529
+G1 X56.0058 Y198.7759
+G1 X55.9615 Y198.7989
+G1 X55.9170 Y198.8219
+G1 X55.8726 Y198.8448
+G1 X55.8282 Y198.8678
+G1 X55.7838 Y198.8907
+G1 X55.7393 Y198.9136
+G1 X55.6949 Y198.9365
+G1 X55.6504 Y198.9593
+G1 X55.6059 Y198.9821
+G1 X55.5614 Y199.0049
+G1 X55.5169 Y199.0277
+G1 X55.4724 Y199.0505
+G1 X55.4278 Y199.0732
+G1 X55.3833 Y199.0959
+G1 X55.3387 Y199.1186
+G1 X55.2942 Y199.1413
+G1 X55.2496 Y199.1640
+G1 X55.2050 Y199.1866
+G1 X55.1604 Y199.2092
+G1 X55.1158 Y199.2318
+G1 X55.0712 Y199.2543
+G1 X55.0265 Y199.2769
+G1 X54.9819 Y199.2994
+G1 X54.9372 Y199.3219
+G1 X54.8926 Y199.3443
+G1 X54.8479 Y199.3668
+G1 X54.8032 Y199.3892
+G1 X54.7585 Y199.4116
+G1 X54.7138 Y199.4340
+G1 X54.6691 Y199.4564
+G1 X54.6243 Y199.4787
+G1 X54.5796 Y199.5010
+G1 X54.5348 Y199.5233
+G1 X54.4901 Y199.5456
+G1 X54.4453 Y199.5678
+G1 X54.4005 Y199.5900
+G1 X54.3557 Y199.6122
+G1 X54.3109 Y199.6344
+G1 X54.2661 Y199.6566
+G1 X54.2212 Y199.6787
+G1 X54.1764 Y199.7008
+G1 X54.1315 Y199.7229
+G1 X54.0867 Y199.7450
+G1 X54.0418 Y199.7670
+G1 X53.9969 Y199.7890
+G1 X53.9520 Y199.8110
+G1 X53.9071 Y199.8330
+G1 X53.8622 Y199.8550
+G1 X53.8172 Y199.8769
+G1 X53.7723 Y199.8988
+G1 X53.7273 Y199.9207
+G1 X53.6824 Y199.9426
+G1 X53.6374 Y199.9644
+G1 X53.5924 Y199.9862
+G1 X53.5474 Y200.0080
+G1 X53.5024 Y200.0298
+G1 X53.4574 Y200.0516
+G1 X53.4124 Y200.0733
+G1 X53.3673 Y200.0950
+G1 X53.3223 Y200.1167
+G1 X53.2772 Y200.1383
+G1 X53.2321 Y200.1600
+G1 X53.1870 Y200.1816
+G1 X53.1419 Y200.2032
+G1 X53.0968 Y200.2248
+G1 X53.0517 Y200.2463
+G1 X53.0066 Y200.2678
+G1 X52.9614 Y200.2893
+G1 X52.9163 Y200.3108
+G1 X52.8711 Y200.3323
+G1 X52.8260 Y200.3537
+G1 X52.7808 Y200.3751
+G1 X52.7356 Y200.3965
+G1 X52.6904 Y200.4179
+G1 X52.6452 Y200.4392
+G1 X52.5999 Y200.4606
+G1 X52.5547 Y200.4819
+G1 X52.5095 Y200.5031
+G1 X52.4642 Y200.5244
+G1 X52.4189 Y200.5456
+G1 X52.3737 Y200.5668
+G1 X52.3284 Y200.5880
+G1 X52.2831 Y200.6092
+G1 X52.2378 Y200.6303
+G1 X52.1924 Y200.6515
+G1 X52.1471 Y200.6726
+G1 X52.1018 Y200.6936
+G1 X52.0564 Y200.7147
+G1 X52.0111 Y200.7357
+G1 X51.9657 Y200.7567
+G1 X51.9203 Y200.7777
+G1 X51.8749 Y200.7987
+G1 X51.8295 Y200.8196
+G1 X51.7841 Y200.8405
+G1 X51.7387 Y200.8614
+G1 X51.6932 Y200.8823
+G1 X51.6478 Y200.9031
+G1 X51.6023 Y200.9240
+G1 X51.5569 Y200.9448
+G1 X51.5114 Y200.9655
+G1 X51.4659 Y200.9863
+G1 X51.4204 Y201.0070
+G1 X51.3749 Y201.0277
+G1 X51.3294 Y201.0484
+G1 X51.2838 Y201.0691
+G1 X51.2383 Y201.0897
+G1 X51.1927 Y201.1104
+G1 X51.1472 Y201.1310
+G1 X51.1016 Y201.1515
+G1 X51.0560 Y201.1721
+G1 X51.0104 Y201.1926
+G1 X50.9648 Y201.2131
+G1 X50.9192 Y201.2336
+G1 X50.8736 Y201.2541
+G1 X50.8280 Y201.2745
+G1 X50.7823 Y201.2949
+G1 X50.7367 Y201.3153
+G1 X50.6910 Y201.3357
+G1 X50.6453 Y201.3560
+G1 X50.5997 Y201.3763
+G1 X50.5540 Y201.3966
+G1 X50.5083 Y201.4169
+G1 X50.4625 Y201.4372
+G1 X50.4168 Y201.4574
+G1 X50.3711 Y201.4776
+G1 X50.3253 Y201.4978
+G1 X50.2796 Y201.5180
+G1 X50.2338 Y201.5381
+G1 X50.1881 Y201.5582
+G1 X50.1423 Y201.5783
+G1 X50.0965 Y201.5984
+G1 X50.0507 Y201.6184
+G1 X50.0049 Y201.6385
+G1 X49.9590 Y201.6585
+G1 X49.9132 Y201.6785
+G1 X49.8674 Y201.6984
+G1 X49.8215 Y201.7184
+G1 X49.7756 Y201.7383
+G1 X49.7298 Y201.7582
+G1 X49.6839 Y201.7780
+G1 X49.6380 Y201.7979
+G1 X49.5921 Y201.8177
+G1 X49.5462 Y201.8375
+G1 X49.5002 Y201.8573
+G1 X49.4543 Y201.8770
+G1 X49.4084 Y201.8967
+G1 X49.3624 Y201.9164
+G1 X49.3165 Y201.9361
+G1 X49.2705 Y201.9558
+G1 X49.2245 Y201.9754
+G1 X49.1785 Y201.9950
+G1 X49.1325 Y202.0146
+G1 X49.0865 Y202.0342
+G1 X49.0405 Y202.0537
+G1 X48.9944 Y202.0733
+G1 X48.9484 Y202.0927
+G1 X48.9023 Y202.1122
+G1 X48.8563 Y202.1317
+G1 X48.8102 Y202.1511
+G1 X48.7641 Y202.1705
+G1 X48.7180 Y202.1899
+G1 X48.6719 Y202.2093
+G1 X48.6258 Y202.2286
+G1 X48.5797 Y202.2479
+G1 X48.5336 Y202.2672
+G1 X48.4874 Y202.2865
+G1 X48.4413 Y202.3057
+G1 X48.3951 Y202.3249
+G1 X48.3490 Y202.3441
+G1 X48.3028 Y202.3633
+G1 X48.2566 Y202.3825
+G1 X48.2104 Y202.4016
+G1 X48.1642 Y202.4207
+G1 X48.1180 Y202.4398
+G1 X48.0718 Y202.4588
+G1 X48.0255 Y202.4779
+G1 X47.9793 Y202.4969
+G1 X47.9330 Y202.5159
+G1 X47.8868 Y202.5348
+G1 X47.8405 Y202.5538
+G1 X47.7942 Y202.5727
+G1 X47.7479 Y202.5916
+G1 X47.7016 Y202.6105
+G1 X47.6553 Y202.6293
+G1 X47.6090 Y202.6482
+G1 X47.5627 Y202.6670
+G1 X47.5163 Y202.6858
+G1 X47.4700 Y202.7045
+G1 X47.4236 Y202.7232
+G1 X47.3773 Y202.7420
+G1 X47.3309 Y202.7606
+G1 X47.2845 Y202.7793
+G1 X47.2381 Y202.7980
+G1 X47.1917 Y202.8166
+G1 X47.1453 Y202.8352
+G1 X47.0989 Y202.8537
+G1 X47.0524 Y202.8723
+G1 X47.0060 Y202.8908
+G1 X46.9595 Y202.9093
+G1 X46.9131 Y202.9278
+G1 X46.8666 Y202.9463
+G1 X46.8201 Y202.9647
+G1 X46.7737 Y202.9831
+G1 X46.7272 Y203.0015
+G1 X46.6806 Y203.0199
+G1 X46.6341 Y203.0382
+G1 X46.5876 Y203.0565
+G1 X46.5411 Y203.0748
+G1 X46.4945 Y203.0931
+G1 X46.4480 Y203.1113
+G1 X46.4014 Y203.1296
+G1 X46.3549 Y203.1478
+G1 X46.3083 Y203.1659
+G1 X46.2617 Y203.1841
+G1 X46.2151 Y203.2022
+G1 X46.1685 Y203.2203
+G1 X46.1219 Y203.2384
+G1 X46.0752 Y203.2565
+G1 X46.0286 Y203.2745
+G1 X45.9820 Y203.2925
+G1 X45.9353 Y203.3105
+G1 X45.8887 Y203.3285
+G1 X45.8420 Y203.3464
+G1 X45.7953 Y203.3644
+G1 X45.7486 Y203.3823
+G1 X45.7019 Y203.4001
+G1 X45.6552 Y203.4180
+G1 X45.6085 Y203.4358
+G1 X45.5618 Y203.4536
+G1 X45.5151 Y203.4714
+G1 X45.4683 Y203.4892
+G1 X45.4216 Y203.5069
+G1 X45.3748 Y203.5246
+G1 X45.3281 Y203.5423
+G1 X45.2813 Y203.5600
+G1 X45.2345 Y203.5776
+G1 X45.1877 Y203.5952
+G1 X45.1409 Y203.6128
+G1 X45.0941 Y203.6304
+G1 X45.0473 Y203.6479
+G1 X45.0004 Y203.6655
+G1 X44.9536 Y203.6830
+G1 X44.9068 Y203.7004
+G1 X44.8599 Y203.7179
+G1 X44.8130 Y203.7353
+G1 X44.7662 Y203.7527
+G1 X44.7193 Y203.7701
+G1 X44.6724 Y203.7875
+G1 X44.6255 Y203.8048
+G1 X44.5786 Y203.8221
+G1 X44.5317 Y203.8394
+G1 X44.4847 Y203.8567
+G1 X44.4378 Y203.8739
+G1 X44.3909 Y203.8911
+G1 X44.3439 Y203.9083
+G1 X44.2970 Y203.9255
+G1 X44.2500 Y203.9427
+G1 X44.2030 Y203.9598
+G1 X44.1560 Y203.9769
+G1 X44.1090 Y203.9940
+G1 X44.0620 Y204.0110
+G1 X44.0150 Y204.0281
+G1 X43.9680 Y204.0451
+G1 X43.9210 Y204.0621
+G1 X43.8740 Y204.0790
+G1 X43.8269 Y204.0960
+G1 X43.7799 Y204.1129
+G1 X43.7328 Y204.1298
+G1 X43.6857 Y204.1466
+G1 X43.6387 Y204.1635
+G1 X43.5916 Y204.1803
+G1 X43.5445 Y204.1971
+G1 X43.4974 Y204.2139
+G1 X43.4503 Y204.2306
+G1 X43.4031 Y204.2473
+G1 X43.3560 Y204.2640
+G1 X43.3089 Y204.2807
+G1 X43.2617 Y204.2974
+G1 X43.2146 Y204.3140
+G1 X43.1674 Y204.3306
+G1 X43.1202 Y204.3472
+G1 X43.0731 Y204.3638
+G1 X43.0259 Y204.3803
+G1 X42.9787 Y204.3968
+G1 X42.9315 Y204.4133
+G1 X42.8843 Y204.4298
+G1 X42.8371 Y204.4462
+G1 X42.7898 Y204.4626
+G1 X42.7426 Y204.4790
+G1 X42.6954 Y204.4954
+G1 X42.6481 Y204.5117
+G1 X42.6008 Y204.5281
+G1 X42.5536 Y204.5444
+G1 X42.5063 Y204.5606
+G1 X42.4590 Y204.5769
+G1 X42.4117 Y204.5931
+G1 X42.3644 Y204.6093
+G1 X42.3171 Y204.6255
+G1 X42.2698 Y204.6417
+G1 X42.2225 Y204.6578
+G1 X42.1751 Y204.6739
+G1 X42.1278 Y204.6900
+G1 X42.0804 Y204.7061
+G1 X42.0331 Y204.7221
+G1 X41.9857 Y204.7381
+G1 X41.9383 Y204.7541
+G1 X41.8910 Y204.7701
+G1 X41.8436 Y204.7860
+G1 X41.7962 Y204.8020
+G1 X41.7488 Y204.8179
+G1 X41.7014 Y204.8337
+G1 X41.6539 Y204.8496
+G1 X41.6065 Y204.8654
+G1 X41.5591 Y204.8812
+G1 X41.5116 Y204.8970
+G1 X41.4642 Y204.9128
+G1 X41.4167 Y204.9285
+G1 X41.3693 Y204.9442
+G1 X41.3218 Y204.9599
+G1 X41.2743 Y204.9755
+G1 X41.2268 Y204.9912
+G1 X41.1793 Y205.0068
+G1 X41.1318 Y205.0224
+G1 X41.0843 Y205.0380
+G1 X41.0368 Y205.0535
+G1 X40.9892 Y205.0690
+G1 X40.9417 Y205.0845
+G1 X40.8941 Y205.1000
+G1 X40.8466 Y205.1154
+G1 X40.7990 Y205.1309
+G1 X40.7515 Y205.1463
+G1 X40.7039 Y205.1616
+G1 X40.6563 Y205.1770
+G1 X40.6087 Y205.1923
+G1 X40.5611 Y205.2076
+G1 X40.5135 Y205.2229
+G1 X40.4659 Y205.2382
+G1 X40.4183 Y205.2534
+G1 X40.3706 Y205.2686
+G1 X40.3230 Y205.2838
+G1 X40.2753 Y205.2989
+G1 X40.2277 Y205.3141
+G1 X40.1800 Y205.3292
+G1 X40.1324 Y205.3443
+G1 X40.0847 Y205.3594
+G1 X40.0370 Y205.3744
+G1 X39.9893 Y205.3894
+G1 X39.9416 Y205.4044
+G1 X39.8939 Y205.4194
+G1 X39.8462 Y205.4343
+G1 X39.7985 Y205.4493
+G1 X39.7507 Y205.4642
+G1 X39.7030 Y205.4790
+G1 X39.6553 Y205.4939
+G1 X39.6075 Y205.5087
+G1 X39.5598 Y205.5235
+G1 X39.5120 Y205.5383
+G1 X39.4642 Y205.5531
+G1 X39.4164 Y205.5678
+G1 X39.3686 Y205.5825
+G1 X39.3209 Y205.5972
+G1 X39.2731 Y205.6118
+G1 X39.2252 Y205.6265
+G1 X39.1774 Y205.6411
+G1 X39.1296 Y205.6557
+G1 X39.0818 Y205.6702
+G1 X39.0339 Y205.6848
+G1 X38.9861 Y205.6993
+G1 X38.9382 Y205.7138
+G1 X38.8904 Y205.7283
+G1 X38.8425 Y205.7427
+G1 X38.7946 Y205.7571
+G1 X38.7467 Y205.7715
+G1 X38.6989 Y205.7859
+G1 X38.6510 Y205.8003
+G1 X38.6031 Y205.8146
+G1 X38.5551 Y205.8289
+G1 X38.5072 Y205.8432
+G1 X38.4593 Y205.8574
+G1 X38.4114 Y205.8716
+G1 X38.3634 Y205.8859
+G1 X38.3155 Y205.9000
+G1 X38.2675 Y205.9142
+G1 X38.2196 Y205.9283
+G1 X38.1716 Y205.9424
+G1 X38.1236 Y205.9565
+G1 X38.0756 Y205.9706
+G1 X38.0277 Y205.9846
+G1 X37.9797 Y205.9986
+G1 X37.9317 Y206.0126
+G1 X37.8836 Y206.0266
+G1 X37.8356 Y206.0405
+G1 X37.7876 Y206.0545
+G1 X37.7396 Y206.0684
+G1 X37.6915 Y206.0822
+G1 X37.6435 Y206.0961
+G1 X37.5954 Y206.1099
+G1 X37.5474 Y206.1237
+G1 X37.4993 Y206.1375
+G1 X37.4512 Y206.1512
+G1 X37.4032 Y206.1649
+G1 X37.3551 Y206.1786
+G1 X37.3070 Y206.1923
+G1 X37.2589 Y206.2060
+G1 X37.2108 Y206.2196
+G1 X37.1627 Y206.2332
+G1 X37.1146 Y206.2468
+G1 X37.0664 Y206.2603
+G1 X37.0183 Y206.2739
+G1 X36.9701 Y206.2874
+G1 X36.9220 Y206.3009
+G1 X36.8738 Y206.3143
+G1 X36.8257 Y206.3278
+G1 X36.7775 Y206.3412
+G1 X36.7293 Y206.3546
+G1 X36.6812 Y206.3679
+G1 X36.6330 Y206.3813
+G1 X36.5848 Y206.3946
+G1 X36.5366 Y206.4079
+G1 X36.4884 Y206.4212
+G1 X36.4402 Y206.4344
+G1 X36.3919 Y206.4476
+G1 X36.3437 Y206.4608
+G1 X36.2955 Y206.4740
+G1 X36.2472 Y206.4871
+G1 X36.1990 Y206.5003
+G1 X36.1507 Y206.5134
+G1 X36.1025 Y206.5264
+G1 X36.0542 Y206.5395
+G1 X36.0059 Y206.5525
+G1 X35.9577 Y206.5655
+G1 X35.9094 Y206.5785
+G1 X35.8611 Y206.5915
+G1 X35.8128 Y206.6044
+G1 X35.7645 Y206.6173
+G1 X35.7162 Y206.6302
+G1 X35.6678 Y206.6430
+G1 X35.6195 Y206.6559
+G1 X35.5712 Y206.6687
+G1 X35.5229 Y206.6815
+G1 X35.4745 Y206.6942
+G1 X35.4262 Y206.7070
+G1 X35.3778 Y206.7197
+G1 X35.3294 Y206.7324
+G1 X35.2811 Y206.7450
+G1 X35.2327 Y206.7577
+G1 X35.1843 Y206.7703
+G1 X35.1359 Y206.7829
+G1 X35.0875 Y206.7955
+G1 X35.0391 Y206.8080
+G1 X34.9907 Y206.8205
+G1 X34.9423 Y206.8330
+G1 X34.8939 Y206.8455
+G1 X34.8455 Y206.8579
+G1 X34.7970 Y206.8704
+G1 X34.7486 Y206.8828
+G1 X34.7002 Y206.8951
+G1 X34.6517 Y206.9075
+G1 X34.6032 Y206.9198
+G1 X34.5548 Y206.9321
+G1 X34.5063 Y206.9444
+G1 X34.4578 Y206.9566
+G1 X34.4094 Y206.9689
+G1 X34.3609 Y206.9811
+G1 X34.3124 Y206.9933
+G1 X34.2639 Y207.0054
+G1 X34.2154 Y207.0175
+G1 X34.1669 Y207.0297
+G1 X34.1183 Y207.0417
+G1 X34.0698 Y207.0538
+G1 X34.0213 Y207.0658
+G1 X33.9727 Y207.0778
+G1 X33.9242 Y207.0898
+G1 X33.8757 Y207.1018
+G1 X33.8271 Y207.1137
+G1 X33.7785 Y207.1256
+G1 X33.7300 Y207.1375
+G1 X33.6814 Y207.1494
+G1 X33.6328 Y207.1612
+G1 X33.5842 Y207.1731
+G1 X33.5357 Y207.1849
+G1 X33.4871 Y207.1966
+G1 X33.4385 Y207.2084
+G1 X33.3899 Y207.2201
+G1 X33.3412 Y207.2318
+G1 X33.2926 Y207.2434
+G1 X33.2440 Y207.2551
+G1 X33.1954 Y207.2667
+G1 X33.1467 Y207.2783
+G1 X33.0981 Y207.2899
+G1 X33.0494 Y207.3014
+G1 X33.0008 Y207.3130
+G1 X32.9521 Y207.3245
+G1 X32.9035 Y207.3359
+G1 X32.8548 Y207.3474
+G1 X32.8061 Y207.3588
+G1 X32.7574 Y207.3702
+G1 X32.7087 Y207.3816
+G1 X32.6601 Y207.3930
+G1 X32.6114 Y207.4043
+G1 X32.5626 Y207.4156
+G1 X32.5139 Y207.4269
+G1 X32.4652 Y207.4381
+G1 X32.4165 Y207.4494
+G1 X32.3678 Y207.4606
+G1 X32.3190 Y207.4718
+G1 X32.2703 Y207.4829
+G1 X32.2216 Y207.4941
+G1 X32.1728 Y207.5052
+G1 X32.1240 Y207.5163
+G1 X32.0753 Y207.5273
+G1 X32.0265 Y207.5384
+G1 X31.9777 Y207.5494
+G1 X31.9290 Y207.5604
+G1 X31.8802 Y207.5713
+G1 X31.8314 Y207.5823
+G1 X31.7826 Y207.5932
+G1 X31.7338 Y207.6041
+G1 X31.6850 Y207.6149
+G1 X31.6362 Y207.6258
+G1 X31.5874 Y207.6366
+G1 X31.5386 Y207.6474
+G1 X31.4897 Y207.6582
+G1 X31.4409 Y207.6689
+G1 X31.3921 Y207.6796
+G1 X31.3432 Y207.6903
+G1 X31.2944 Y207.7010
+G1 X31.2455 Y207.7116
+G1 X31.1967 Y207.7223
+G1 X31.1478 Y207.7329
+G1 X31.0989 Y207.7434
+G1 X31.0501 Y207.7540
+G1 X31.0012 Y207.7645
+G1 X30.9523 Y207.7750
+G1 X30.9034 Y207.7855
+G1 X30.8545 Y207.7959
+G1 X30.8056 Y207.8064
+G1 X30.7567 Y207.8168
+G1 X30.7078 Y207.8272
+G1 X30.6589 Y207.8375
+G1 X30.6099 Y207.8478
+G1 X30.5610 Y207.8581
+G1 X30.5121 Y207.8684
+G1 X30.4632 Y207.8787
+G1 X30.4142 Y207.8889
+G1 X30.3653 Y207.8991
+G1 X30.3163 Y207.9093
+G1 X30.2674 Y207.9195
+G1 X30.2184 Y207.9296
+G1 X30.1694 Y207.9397
+G1 X30.1205 Y207.9498
+G1 X30.0715 Y207.9598
+G1 X30.0225 Y207.9699
+G1 X29.9735 Y207.9799
+G1 X29.9245 Y207.9899
+G1 X29.8755 Y207.9998
+G1 X29.8265 Y208.0098
+G1 X29.7775 Y208.0197
+G1 X29.7285 Y208.0296
+G1 X29.6795 Y208.0394
+G1 X29.6305 Y208.0493
+G1 X29.5814 Y208.0591
+G1 X29.5324 Y208.0689
+G1 X29.4834 Y208.0787
+G1 X29.4343 Y208.0884
+G1 X29.3853 Y208.0981
+G1 X29.3362 Y208.1078
+G1 X29.2872 Y208.1175
+G1 X29.2381 Y208.1271
+G1 X29.1890 Y208.1367
+G1 X29.1400 Y208.1463
+G1 X29.0909 Y208.1559
+G1 X29.0418 Y208.1655
+G1 X28.9927 Y208.1750
+G1 X28.9436 Y208.1845
+G1 X28.8945 Y208.1939
+G1 X28.8454 Y208.2034
+G1 X28.7963 Y208.2128
+G1 X28.7472 Y208.2222
+G1 X28.6981 Y208.2316
+G1 X28.6490 Y208.2409
+G1 X28.5999 Y208.2503
+G1 X28.5507 Y208.2596
+G1 X28.5016 Y208.2688
+G1 X28.4525 Y208.2781
+G1 X28.4033 Y208.2873
+G1 X28.3542 Y208.2965
+G1 X28.3050 Y208.3057
+G1 X28.2559 Y208.3148
+G1 X28.2067 Y208.3240
+G1 X28.1576 Y208.3331
+G1 X28.1084 Y208.3422
+G1 X28.0592 Y208.3512
+G1 X28.0100 Y208.3602
+G1 X27.9609 Y208.3692
+G1 X27.9117 Y208.3782
+G1 X27.8625 Y208.3872
+G1 X27.8133 Y208.3961
+G1 X27.7641 Y208.4050
+G1 X27.7149 Y208.4139
+G1 X27.6657 Y208.4228
+G1 X27.6165 Y208.4316
+G1 X27.5672 Y208.4404
+G1 X27.5180 Y208.4492
+G1 X27.4688 Y208.4579
+G1 X27.4196 Y208.4667
+G1 X27.3703 Y208.4754
+G1 X27.3211 Y208.4841
+G1 X27.2718 Y208.4927
+G1 X27.2226 Y208.5014
+G1 X27.1733 Y208.5100
+G1 X27.1241 Y208.5186
+G1 X27.0748 Y208.5271
+G1 X27.0255 Y208.5357
+G1 X26.9763 Y208.5442
+G1 X26.9270 Y208.5527
+G1 X26.8777 Y208.5611
+G1 X26.8284 Y208.5696
+G1 X26.7792 Y208.5780
+G1 X26.7299 Y208.5864
+G1 X26.6806 Y208.5947
+G1 X26.6313 Y208.6031
+G1 X26.5820 Y208.6114
+G1 X26.5327 Y208.6197
+G1 X26.4833 Y208.6280
+G1 X26.4340 Y208.6362
+G1 X26.3847 Y208.6444
+G1 X26.3354 Y208.6526
+G1 X26.2861 Y208.6608
+G1 X26.2367 Y208.6689
+G1 X26.1874 Y208.6770
+G1 X26.1381 Y208.6851
+G1 X26.0887 Y208.6932
+G1 X26.0394 Y208.7012
+G1 X25.9900 Y208.7093
+G1 X25.9406 Y208.7173
+G1 X25.8913 Y208.7252
+G1 X25.8419 Y208.7332
+G1 X25.7926 Y208.7411
+G1 X25.7432 Y208.7490
+G1 X25.6938 Y208.7569
+G1 X25.6444 Y208.7647
+G1 X25.5950 Y208.7725
+G1 X25.5457 Y208.7803
+G1 X25.4963 Y208.7881
+G1 X25.4469 Y208.7959
+G1 X25.3975 Y208.8036
+G1 X25.3481 Y208.8113
+G1 X25.2987 Y208.8190
+G1 X25.2492 Y208.8266
+G1 X25.1998 Y208.8342
+G1 X25.1504 Y208.8418
+G1 X25.1010 Y208.8494
+G1 X25.0516 Y208.8570
+G1 X25.0021 Y208.8645
+G1 X24.9527 Y208.8720
+G1 X24.9033 Y208.8795
+G1 X24.8538 Y208.8869
+G1 X24.8044 Y208.8943
+G1 X24.7549 Y208.9017
+G1 X24.7055 Y208.9091
+G1 X24.6560 Y208.9165
+G1 X24.6066 Y208.9238
+G1 X24.5571 Y208.9311
+G1 X24.5076 Y208.9384
+G1 X24.4581 Y208.9456
+G1 X24.4087 Y208.9529
+G1 X24.3592 Y208.9601
+G1 X24.3097 Y208.9672
+G1 X24.2602 Y208.9744
+G1 X24.2107 Y208.9815
+G1 X24.1612 Y208.9886
+G1 X24.1118 Y208.9957
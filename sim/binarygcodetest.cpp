@@ -0,0 +1,240 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+    Test for the binary Gcode frames.
+
+    Every line of the G-code files that can be a record is encoded with the reference encoder, decoded by BinaryGcode
+    and the Gcode it makes is compared with the one parsed from the text: the same G or M, letters, values, ints and
+    argument counts, before and after the parameters are stripped. The sequence numbers are checked next, then the
+    frames of the files are fuzzed: bits flipped, bytes changed, frames cut short or run on, or made up entirely, some
+    with the length and crc fixed up afterwards so the records get parsed. Nothing must crash (run it with SANITIZE=1),
+    no corruption a crc has to catch may get through, and every frame that is accepted must give sane Gcodes.
+
+    Exits with 1 if anything fails.
+*/
+
+#include "modules/communication/utils/BinaryGcode.h"
+#include "modules/communication/utils/Gcode.h"
+#include "BinaryGcodeEncoder.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <string>
+#include <vector>
+#include <random>
+
+static uint32_t failures;
+
+#define CHECK(cond, ...) do { if(!(cond)) { if(failures++ < 10) { fprintf(stderr, "FAIL: " __VA_ARGS__); fputc('\n', stderr); } } } while(0)
+
+static bool same_gcode(const Gcode &a, const Gcode &b)
+{
+    if(a.has_g != b.has_g || a.has_m != b.has_m || a.g != b.g || a.m != b.m || a.subcode != b.subcode) return false;
+    if(a.get_num_args() != b.get_num_args() || a.get_args() != b.get_args() || a.get_args_int() != b.get_args_int()) return false;
+    for (char c = 'A'; c <= 'Z'; ++c) {
+        if(a.has_letter(c) != b.has_letter(c) || a.get_value(c) != b.get_value(c) || a.get_int(c) != b.get_int(c)) return false;
+    }
+    return true;
+}
+
+static std::string as_string(const uint8_t *p, size_t n) { return std::string((const char *)p, n); }
+
+// a frame holding just a SYNC record, so the next one expected is seq + 1
+static std::string sync_frame(uint8_t seq)
+{
+    uint8_t f[6]= {BinaryGcode::frame_start, 4, seq, BinaryGcode::SYNC, 0, 0};
+    uint16_t crc= BinaryGcode::crc16(f + 1, 3);
+    f[4]= crc & 0xFF;
+    f[5]= crc >> 8;
+    return as_string(f, sizeof(f));
+}
+
+// make the length and crc right for whatever is in the frame now
+static void fix_frame(std::string &f)
+{
+    if(f.size() < 5 || f.size() > BinaryGcode::max_length + 2u) return;
+    f[1]= f.size() - 2;
+    uint16_t crc= BinaryGcode::crc16((const uint8_t *)f.data() + 1, f.size() - 3);
+    f[f.size() - 2]= crc & 0xFF;
+    f[f.size() - 1]= crc >> 8;
+}
+
+static void usage(const char *prog)
+{
+    fprintf(stderr, "Usage: %s [-n iterations] [-r seed] file.gcode...\n", prog);
+    fprintf(stderr, "  -n iterations      frames to fuzz (default 200000)\n");
+    fprintf(stderr, "  -r seed            random seed (default 1)\n");
+}
+
+int main(int argc, char *argv[])
+{
+    uint32_t iterations= 200000, seed= 1;
+    int c;
+    while((c= getopt(argc, argv, "n:r:h")) != -1) {
+        switch(c) {
+            case 'n': iterations= strtoul(optarg, nullptr, 10); break;
+            case 'r': seed= strtoul(optarg, nullptr, 10); break;
+            default: usage(argv[0]); return 1;
+        }
+    }
+    if(optind >= argc) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    std::vector<std::string> lines;
+    char buf[256];
+    for (int i = optind; i < argc; ++i) {
+        FILE *fp= fopen(argv[i], "r");
+        if(fp == nullptr) {
+            fprintf(stderr, "could not open %s\n", argv[i]);
+            return 1;
+        }
+        while(fgets(buf, sizeof(buf), fp) != nullptr) {
+            buf[strcspn(buf, "\r\n")]= '\0';
+            lines.push_back(buf);
+        }
+        fclose(fp);
+    }
+
+    // every record decodes to the Gcode the text makes, with floats and with fixed point where the encoder can
+    uint64_t records= 0;
+    for (int allow_fixed = 0; allow_fixed < 2; ++allow_fixed) {
+        BinaryGcodeEncoder encoder(allow_fixed);
+        BinaryGcode decoder;
+        for (auto &l : lines) {
+            std::string r= BinaryGcodeEncoder::record(l, allow_fixed);
+            if(r.empty()) continue;
+            ++records;
+
+            std::string f= encoder.frame(r);
+            BinaryGcode::STATUS s= decoder.check((const uint8_t *)f.data(), f.size());
+            CHECK(s == BinaryGcode::OK, "status %d for %s", s, l.c_str());
+            if(s != BinaryGcode::OK) continue;
+
+            Gcode *b= decoder.next_record(nullptr);
+            CHECK(decoder.next_record(nullptr) == nullptr, "more than one record for %s", l.c_str());
+            Gcode t(l.substr(0, l.find_first_of(";(")), nullptr);
+            CHECK(same_gcode(*b, t), "decoded Gcode differs from the text for %s", l.c_str());
+
+            Gcode copy(*b);
+            CHECK(same_gcode(copy, t), "copy of the decoded Gcode differs from the text for %s", l.c_str());
+            b->strip_parameters();
+            t.strip_parameters();
+            CHECK(same_gcode(*b, t), "stripped Gcode differs from the text for %s", l.c_str());
+            delete b;
+        }
+    }
+
+    // the frames of the whole corpus, as a host would send them
+    std::vector<std::string> frames;
+    {
+        BinaryGcodeEncoder encoder;
+        std::string stream;
+        for (auto &l : lines) {
+            if(!BinaryGcodeEncoder::record(l).empty()) encoder.add_line(l, stream);
+        }
+        encoder.flush(stream);
+        frames= BinaryGcodeEncoder::split(stream);
+    }
+    if(frames.size() < 2) {
+        fprintf(stderr, "not enough frames in the files to test with\n");
+        return 1;
+    }
+
+    // in order they are all taken, out of order or repeated they are not and the sequence stays where it was
+    {
+        BinaryGcode decoder;
+        const std::string &first= frames[0], &second= frames[1];
+        CHECK(decoder.check((const uint8_t *)second.data(), second.size()) == BinaryGcode::BAD_SEQUENCE, "a frame before the first was taken");
+        CHECK(decoder.check((const uint8_t *)first.data(), first.size()) == BinaryGcode::OK, "the first frame was not taken");
+        CHECK(decoder.check((const uint8_t *)second.data(), second.size()) == BinaryGcode::OK, "the second frame was not taken");
+        // the first has a SYNC record so it would be taken again
+        CHECK(decoder.check((const uint8_t *)second.data(), second.size()) == BinaryGcode::BAD_SEQUENCE, "a repeated frame was taken");
+        CHECK(decoder.get_expected_sequence() == 2, "the sequence moved on a repeated frame");
+        for (size_t i = 2; i < frames.size(); ++i) {
+            CHECK(decoder.check((const uint8_t *)frames[i].data(), frames[i].size()) == BinaryGcode::OK, "frame %lu was not taken", (unsigned long)i);
+            while(Gcode *g= decoder.next_record(nullptr)) delete g;
+        }
+        std::string s= sync_frame(42);
+        CHECK(decoder.check((const uint8_t *)s.data(), s.size()) == BinaryGcode::OK && decoder.get_expected_sequence() == 43, "a sync frame did not restart the sequence");
+        CHECK(decoder.next_record(nullptr) == nullptr, "a sync frame gave a Gcode");
+    }
+
+    // fuzz
+    std::mt19937 rng(seed);
+    auto rnd= [&rng](uint32_t n) { return (uint32_t)(rng() % n); };
+    uint64_t accepted= 0, gcodes= 0, undetected= 0;
+    uint64_t status_count[BinaryGcode::BAD_RECORD + 1]= {};
+    for (uint32_t it = 0; it < iterations; ++it) {
+        const std::string &original= frames[rnd(frames.size())];
+        std::string f= original;
+        bool must_reject= false;
+        switch(rnd(5)) {
+            case 0: // a few bits flipped, which a crc 16 always catches
+                for (int n = 1 + rnd(3); n > 0; --n) f[1 + rnd(f.size() - 1)] ^= 1 << rnd(8);
+                must_reject= true;
+                break;
+            case 1: // bytes changed
+                for (int n = 1 + rnd(4); n > 0; --n) f[1 + rnd(f.size() - 1)]= rng();
+                break;
+            case 2: // cut short
+                f.resize(rnd(f.size()));
+                must_reject= true;
+                break;
+            case 3: // run on
+                for (int n = 1 + rnd(8); n > 0; --n) f += (char)rng();
+                must_reject= true;
+                break;
+            case 4: // made up
+                f.assign(1, (char)BinaryGcode::frame_start);
+                for (int n = rnd(BinaryGcode::max_length + 8); n > 0; --n) f += (char)rng();
+                break;
+        }
+
+        // half of them are made to pass the length and crc checks so the records are looked at
+        if(rnd(2) == 0 && f.size() >= 5) {
+            fix_frame(f);
+            must_reject= false;
+        }
+        if(f == original) must_reject= false;
+
+        BinaryGcode decoder;
+        if(f.size() >= 3) {
+            std::string s= sync_frame(f[2] - 1);
+            decoder.check((const uint8_t *)s.data(), s.size());
+        }
+        BinaryGcode::STATUS s= decoder.check((const uint8_t *)f.data(), f.size());
+        ++status_count[s];
+        if(s != BinaryGcode::OK) continue;
+
+        ++accepted;
+        if(must_reject) ++undetected;
+        CHECK(!must_reject, "a corrupted frame was taken");
+        while(Gcode *g= decoder.next_record(nullptr)) {
+            ++gcodes;
+            CHECK(g->has_g != g->has_m && g->subcode < 8 && g->get_num_args() <= BinaryGcode::max_values, "insane Gcode from an accepted frame");
+            for (char c = 'A'; c <= 'Z'; ++c) {
+                if(g->has_letter(c)) CHECK(strchr(BinaryGcode::letter_order, c) != nullptr, "letter %c from an accepted frame", c);
+            }
+            delete g;
+        }
+    }
+
+    Gcode::pool_usage_t u= Gcode::get_pool_usage();
+    CHECK(u.gcodes == 0 && u.texts == 0, "%u Gcodes and %u texts still in use", u.gcodes, u.texts);
+
+    printf("%llu records round tripped, %lu frames, %lu fuzzed: %llu taken (%llu Gcodes), %llu bad length, %llu bad crc, %llu bad sequence, %llu bad record, %llu undetected\n",
+           (unsigned long long)records, (unsigned long)frames.size(), (unsigned long)iterations, (unsigned long long)accepted, (unsigned long long)gcodes,
+           (unsigned long long)status_count[BinaryGcode::BAD_LENGTH], (unsigned long long)status_count[BinaryGcode::BAD_CRC],
+           (unsigned long long)status_count[BinaryGcode::BAD_SEQUENCE], (unsigned long long)status_count[BinaryGcode::BAD_RECORD], (unsigned long long)undetected);
+    if(failures > 0) printf("FAIL: %u checks failed\n", failures);
+    return failures > 0 ? 1 : 0;
+}
@@ -0,0 +1,12 @@
+; 20mm square with a diagonal and a couple of arcs
+G21
+G90
+G1 X0 Y0 F3000
+G1 X20 Y0
+G1 X20 Y20
+G1 X0 Y20
+G1 X0 Y0
+G1 X20 Y20 Z1
+G2 X30 Y10 I5 J-5 F2000
+G3 X20 Y0 I-10 J0
+G0 X0 Y0 Z0
@@ -0,0 +1,78 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+    Reference encoder for the binary Gcode frames, see BinaryGcode.h.
+
+    Turns a G-code file into the stream a host would send over USB: the lines that can be records packed into frames,
+    the rest left as text lines in between. smoothiesim -b runs the result.
+*/
+
+#include "BinaryGcodeEncoder.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <string>
+
+static void usage(const char *prog)
+{
+    fprintf(stderr, "Usage: %s [-F] [-o out] file.gcode\n", prog);
+    fprintf(stderr, "  -F                 always send floats, never fixed point\n");
+    fprintf(stderr, "  -o out             where to write the stream (default stdout)\n");
+}
+
+int main(int argc, char *argv[])
+{
+    bool allow_fixed= true;
+    const char *out_fn= nullptr;
+    int c;
+    while((c= getopt(argc, argv, "Fo:h")) != -1) {
+        switch(c) {
+            case 'F': allow_fixed= false; break;
+            case 'o': out_fn= optarg; break;
+            default: usage(argv[0]); return 1;
+        }
+    }
+    if(optind != argc - 1) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    FILE *fp= fopen(argv[optind], "r");
+    if(fp == nullptr) {
+        fprintf(stderr, "could not open %s\n", argv[optind]);
+        return 1;
+    }
+
+    BinaryGcodeEncoder encoder(allow_fixed);
+    std::string out;
+    size_t text_bytes= 0, lines= 0, records= 0;
+    char buf[256];
+    while(fgets(buf, sizeof(buf), fp) != nullptr) {
+        text_bytes += strlen(buf);
+        buf[strcspn(buf, "\r\n")]= '\0';
+        ++lines;
+        if(!BinaryGcodeEncoder::record(buf, allow_fixed).empty()) ++records;
+        encoder.add_line(buf, out);
+    }
+    encoder.flush(out);
+    fclose(fp);
+
+    FILE *ofp= out_fn == nullptr ? stdout : fopen(out_fn, "wb");
+    if(ofp == nullptr) {
+        fprintf(stderr, "could not create %s\n", out_fn);
+        return 1;
+    }
+    fwrite(out.data(), 1, out.size(), ofp);
+    if(ofp != stdout) fclose(ofp);
+
+    fprintf(stderr, "%lu lines, %lu as records, %lu bytes of text became %lu (%1.1f%%)\n",
+            (unsigned long)lines, (unsigned long)records, (unsigned long)text_bytes, (unsigned long)out.size(),
+            text_bytes > 0 ? 100.0 * out.size() / text_bytes : 0.0);
+    return 0;
+}
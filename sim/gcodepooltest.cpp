@@ -0,0 +1,163 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+    Stress test for the Gcode pools.
+
+    Streams G-code files through the Gcode lifecycle the way GcodeDispatch and the modules use it: each line is split
+    into commands in place by GcodeLine, a Gcode is made with new for each command, its words are looked at, it is copied, the modules make a few more while handling it, the
+    parameters of moves are stripped, and it is deleted. malloc is counted throughout, and every command that fits in
+    a pooled command text must have gone through without a single call. At the end the pools must be empty again.
+
+    Exits with 1 if anything was allocated from the heap that should not have been, or a pool slot leaked.
+*/
+
+#include "modules/communication/utils/Gcode.h"
+#include "modules/communication/utils/GcodeLine.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <string>
+#include <vector>
+#include <algorithm>
+
+#ifndef GCODE_TEXT_SIZE
+#define GCODE_TEXT_SIZE 64
+#endif
+
+// count every call into the allocator, forwarding to glibc's own, the sanitizers have their own malloc so the count
+// is not available with SANITIZE=1
+#if defined(__SANITIZE_ADDRESS__)
+#define COUNT_MALLOC 0
+#else
+#define COUNT_MALLOC 1
+extern "C" {
+    void *__libc_malloc(size_t);
+    void *__libc_calloc(size_t, size_t);
+    void *__libc_realloc(void *, size_t);
+    void __libc_free(void *);
+}
+#endif
+
+static uint64_t mallocs;
+
+#if COUNT_MALLOC
+extern "C" void *malloc(size_t n) { ++mallocs; return __libc_malloc(n); }
+extern "C" void *calloc(size_t n, size_t s) { ++mallocs; return __libc_calloc(n, s); }
+extern "C" void *realloc(void *p, size_t n) { ++mallocs; return __libc_realloc(p, n); }
+extern "C" void free(void *p) { __libc_free(p); }
+#endif
+
+// what a line costs the modules, a couple of Gcodes on the stack as the M2 handling or homing make, and more when the
+// line asks for nesting to fill the pool
+static float handle(Gcode *gcode, int depth)
+{
+    float sum= 0;
+    for (char c = 'A'; c <= 'Z'; ++c) {
+        if(gcode->has_letter(c)) sum += gcode->get_value(c);
+    }
+    sum += gcode->get_num_args();
+
+    {
+        Gcode copy(*gcode);
+        Gcode assigned("M400", gcode->stream);
+        assigned= copy;
+        sum += copy.get_value('X') + assigned.get_value('Y');
+    }
+
+    if(depth > 0) {
+        Gcode *nested= new Gcode("G1 X1 Y2 F3000", gcode->stream);
+        sum += handle(nested, depth - 1);
+        delete nested;
+    }
+
+    Gcode gc1("M5", gcode->stream);
+    Gcode gc2("M9", gcode->stream);
+    sum += gc1.m + gc2.m;
+
+    gcode->strip_parameters();
+    return sum;
+}
+
+static void usage(const char *prog)
+{
+    fprintf(stderr, "Usage: %s [-r repeats] [-d depth] file.gcode...\n", prog);
+    fprintf(stderr, "  -r repeats         times to stream each file (default 1)\n");
+    fprintf(stderr, "  -d depth           Gcodes each line makes while it is handled, nested (default 2)\n");
+}
+
+int main(int argc, char *argv[])
+{
+    int repeats= 1, depth= 2;
+    int c;
+    while((c= getopt(argc, argv, "r:d:h")) != -1) {
+        switch(c) {
+            case 'r': repeats= atoi(optarg); break;
+            case 'd': depth= atoi(optarg); break;
+            default: usage(argv[0]); return 1;
+        }
+    }
+    if(optind >= argc) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    // read everything up front so the file handling is not counted, keep the lines GcodeDispatch makes Gcodes of
+    std::vector<std::string> lines;
+    char buf[256];
+    for (int i = optind; i < argc; ++i) {
+        FILE *fp= fopen(argv[i], "r");
+        if(fp == nullptr) {
+            fprintf(stderr, "could not open %s\n", argv[i]);
+            return 1;
+        }
+        while(fgets(buf, sizeof(buf), fp) != nullptr) {
+            buf[strcspn(buf, "\r\n")]= '\0';
+            if(buf[0] == 'G' || buf[0] == 'M' || buf[0] == 'T' || buf[0] == 'N') lines.push_back(buf);
+        }
+        fclose(fp);
+    }
+
+    uint64_t streamed= 0, long_lines= 0, bad_lines= 0;
+    uint64_t setup_mallocs= mallocs;
+    float sum= 0;
+    for (int r = 0; r < repeats; ++r) {
+        for (auto &l : lines) {
+            uint64_t before= mallocs;
+            GcodeLine line(l.data(), l.size());
+            const char *command;
+            size_t length, longest= 0;
+            while(line.next_command(command, length)) {
+                Gcode *gcode= new Gcode(command, length, nullptr);
+                sum += handle(gcode, depth);
+                delete gcode;
+                longest= std::max(longest, length);
+            }
+            ++streamed;
+
+            if(longest >= GCODE_TEXT_SIZE) {
+                ++long_lines;
+            } else if(COUNT_MALLOC && mallocs != before) {
+                if(bad_lines++ < 10) fprintf(stderr, "FAIL: %llu mallocs for %s\n", (unsigned long long)(mallocs - before), l.c_str());
+            }
+        }
+    }
+
+    Gcode::pool_usage_t u= Gcode::get_pool_usage();
+    printf("%llu lines streamed, %llu too long for the pool, %llu mallocs%s, pools: %u Gcodes %u texts at most, %lu from the heap (%g)\n",
+           (unsigned long long)streamed, (unsigned long long)long_lines, (unsigned long long)(mallocs - setup_mallocs), COUNT_MALLOC ? "" : " (not counted with the sanitizers)",
+           u.max_gcodes, u.max_texts, (unsigned long)u.heap_fallbacks, sum);
+
+    bool ok= bad_lines == 0;
+    if(u.gcodes != 0 || u.texts != 0) {
+        printf("FAIL: %u Gcodes and %u texts still in use\n", u.gcodes, u.texts);
+        ok= false;
+    }
+    return ok ? 0 : 1;
+}
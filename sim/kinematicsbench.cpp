@@ -0,0 +1,176 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+    Inverse kinematics benchmark.
+
+    Converts the same random points with the linear delta, rotary delta and Morgan SCARA arm solutions, once with a
+    call to BaseSolution::cartesian_to_actuator() per point, as Robot::plan_milestone() does, and once in batches with
+    BaseSolution::cartesian_to_actuators(), as Robot::append_line() does with the segments of a line. Both go through
+    a BaseSolution pointer so the virtual calls are counted as they are in the firmware.
+
+    Prints the host time per point each way. Exits with 1 if a batch gives anything but exactly what the calls per
+    point give.
+*/
+
+#include "libs/Kernel.h"
+#include "ActuatorCoordinates.h"
+#include "arm_solutions/BaseSolution.h"
+#include "arm_solutions/LinearDeltaSolution.h"
+#include "arm_solutions/RotaryDeltaSolution.h"
+#include "arm_solutions/MorganSCARASolution.h"
+#include "Sim.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <string>
+#include <vector>
+#include <random>
+#include <chrono>
+
+#ifndef SIM_DEFAULT_CONFIG
+#define SIM_DEFAULT_CONFIG "config"
+#endif
+
+using sim_clock= std::chrono::steady_clock;
+
+static double elapsed_ns(sim_clock::time_point start)
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(sim_clock::now() - start).count();
+}
+
+// points in structure of arrays form, as cartesian_to_actuators() takes them
+struct Points {
+    std::vector<float> axis[3];
+
+    explicit Points(size_t n) { for(auto &a : axis) a.resize(n); }
+};
+
+struct Solution {
+    const char *name;
+    BaseSolution *solution;
+    float lo[3], hi[3];                 // the box the points are taken from, all reachable with the default config
+};
+
+static void usage(const char *name)
+{
+    fprintf(stderr, "Usage: %s [-c config] [-s setting=value]... [-n points] [-b batch] [-r repeats] [-R seed]\n", name);
+    fprintf(stderr, "  -c config          config file, default %s, the arm solution settings are read from it\n", SIM_DEFAULT_CONFIG);
+    fprintf(stderr, "  -s setting=value   override a config setting, eg -s arm_length=300\n");
+    fprintf(stderr, "  -n points          number of points (default 100000)\n");
+    fprintf(stderr, "  -b batch           points per cartesian_to_actuators() call (default 8, as Robot::append_line())\n");
+    fprintf(stderr, "  -r repeats         times each is timed, the fastest is reported (default 5)\n");
+    fprintf(stderr, "  -R seed            random seed (default 1)\n");
+}
+
+int main(int argc, char *argv[])
+{
+    const char *config_fn= SIM_DEFAULT_CONFIG;
+    std::vector<const char*> settings;
+    size_t n_points= 100000;
+    size_t batch= 8;
+    int repeats= 5;
+    uint32_t seed= 1;
+
+    int c;
+    while((c= getopt(argc, argv, "c:s:n:b:r:R:h")) != -1) {
+        switch(c) {
+            case 'c': config_fn= optarg; break;
+            case 's': settings.push_back(optarg); break;
+            case 'n': n_points= strtoul(optarg, nullptr, 10); break;
+            case 'b': batch= strtoul(optarg, nullptr, 10); break;
+            case 'r': repeats= atoi(optarg); break;
+            case 'R': seed= strtoul(optarg, nullptr, 10); break;
+            default: usage(argv[0]); return 1;
+        }
+    }
+    if(n_points == 0 || batch == 0 || repeats <= 0) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    std::string config;
+    FILE *fp= fopen(config_fn, "r");
+    if(fp == nullptr) {
+        fprintf(stderr, "could not read config file %s\n", config_fn);
+        return 1;
+    }
+    char buf[4096];
+    size_t n;
+    while((n= fread(buf, 1, sizeof(buf), fp)) > 0) config.append(buf, n);
+    fclose(fp);
+    for(auto s : settings) {
+        if(!sim_override_setting(config, s)) {
+            fprintf(stderr, "bad setting %s, expected setting=value\n", s);
+            return 1;
+        }
+    }
+
+    sim_set_config(config.data(), config.data() + config.size());
+    new Kernel();
+
+    Solution solutions[]= {
+        {"linear_delta", new LinearDeltaSolution(THEKERNEL->config), {-100, -100, 0}, {100, 100, 200}},
+        {"rotary_delta", new RotaryDeltaSolution(THEKERNEL->config), {-50, -50, 0}, {50, 50, 50}},
+        {"morgan", new MorganSCARASolution(THEKERNEL->config), {0, 0, 0}, {200, 200, 200}},
+    };
+
+    std::mt19937 rng(seed);
+    bool failed= false;
+    printf("solution,ns_per_point,ns_per_point_batched,speedup\n");
+    for(auto &s : solutions) {
+        Points in(n_points), per_point(n_points), batched(n_points);
+        for (int a = 0; a < 3; a++) {
+            std::uniform_real_distribution<float> d(s.lo[a], s.hi[a]);
+            for(auto &v : in.axis[a]) v= d(rng);
+        }
+
+        const BaseSolution *solution= s.solution;
+        double best_single= 0, best_batch= 0;
+        for (int r = 0; r < repeats; r++) {
+            sim_clock::time_point start= sim_clock::now();
+            for (size_t i = 0; i < n_points; i++) {
+                float cartesian[3]= {in.axis[0][i], in.axis[1][i], in.axis[2][i]};
+                ActuatorCoordinates actuator;
+                solution->cartesian_to_actuator(cartesian, actuator);
+                for (int a = 0; a < 3; a++) per_point.axis[a][i]= actuator[a];
+            }
+            double ns= elapsed_ns(start);
+            if(r == 0 || ns < best_single) best_single= ns;
+
+            start= sim_clock::now();
+            for (size_t i = 0; i < n_points; i += batch) {
+                size_t m= std::min(batch, n_points - i);
+                const float *const cartesian[3]= {&in.axis[0][i], &in.axis[1][i], &in.axis[2][i]};
+                float *const actuator[3]= {&batched.axis[0][i], &batched.axis[1][i], &batched.axis[2][i]};
+                solution->cartesian_to_actuators(m, cartesian, actuator);
+            }
+            ns= elapsed_ns(start);
+            if(r == 0 || ns < best_batch) best_batch= ns;
+        }
+
+        // bit for bit, so a point that has no solution must fail the same way both ways
+        for (int a = 0; a < 3; a++) {
+            if(memcmp(per_point.axis[a].data(), batched.axis[a].data(), n_points * sizeof(float)) == 0) continue;
+            for (size_t i = 0; i < n_points; i++) {
+                if(memcmp(&per_point.axis[a][i], &batched.axis[a][i], sizeof(float)) != 0) {
+                    fprintf(stderr, "%s: actuator %d of point %zu (%f, %f, %f) is %.9g per point but %.9g batched\n", s.name, a, i,
+                            in.axis[0][i], in.axis[1][i], in.axis[2][i], per_point.axis[a][i], batched.axis[a][i]);
+                    break;
+                }
+            }
+            failed= true;
+        }
+
+        printf("%s,%.2f,%.2f,%.2f\n", s.name, best_single / n_points, best_batch / n_points, best_single / best_batch);
+    }
+
+    for(auto &s : solutions) delete s.solution;
+    return failed ? 1 : 0;
+}
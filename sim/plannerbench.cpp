@@ -0,0 +1,164 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+    Planner benchmark.
+
+    Runs each G-code file given through the simulated motion pipeline and reports, per file, how fast
+    Planner::append_block() and Planner::recalculate() are and how many blocks each recalculate touches.
+    The step ticker runs as in smoothiesim, so the queue fills and drains as it would on the board, but only
+    the time spent in the planner is counted.
+
+    One CSV line is written to stdout per file so results can be collected for regression tracking.
+*/
+
+#include "libs/Kernel.h"
+#include "libs/SerialMessage.h"
+#include "libs/StreamOutput.h"
+#include "libs/Config.h"
+#include "libs/ConfigValue.h"
+#include "libs/checksumm.h"
+#include "libs/StepTicker.h"
+#include "modules/robot/Conveyor.h"
+#include "modules/robot/Robot.h"
+#include "Sim.h"
+#include "SimTicker.h"
+#include "PlannerStats.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <string>
+#include <vector>
+
+#ifndef SIM_DEFAULT_CONFIG
+#define SIM_DEFAULT_CONFIG "config"
+#endif
+
+#define planner_queue_size_checksum CHECKSUM("planner_queue_size")
+
+// counts replies that are not ok
+class BenchReplyStream : public StreamOutput {
+    public:
+        int puts(const char *str) { if(strncmp(str, "ok", 2) != 0) ++errors; return strlen(str); }
+        uint32_t errors{0};
+};
+
+static bool read_file(const char *fn, std::string &buf)
+{
+    FILE *fp= fopen(fn, "r");
+    if(fp == nullptr) return false;
+    char b[4096];
+    size_t n;
+    while((n= fread(b, 1, sizeof(b), fp)) > 0) buf.append(b, n);
+    fclose(fp);
+    return true;
+}
+
+static void usage(const char *prog)
+{
+    fprintf(stderr, "Usage: %s [-c config] [-s setting=value]... [-t ticks_per_idle] [-n] file.gcode...\n", prog);
+    fprintf(stderr, "  -c config          configuration to load (default %s)\n", SIM_DEFAULT_CONFIG);
+    fprintf(stderr, "  -s setting=value   override a config setting, eg -s planner_queue_size=128, can be repeated\n");
+    fprintf(stderr, "  -t ticks_per_idle  step ticks run for each ON_IDLE (default 100)\n");
+    fprintf(stderr, "  -n                 do not write the CSV header\n");
+}
+
+int main(int argc, char *argv[])
+{
+    const char *config_fn= SIM_DEFAULT_CONFIG;
+    std::vector<const char*> settings;
+    uint32_t ticks_per_idle= 100;
+    bool header= true;
+
+    int c;
+    while((c= getopt(argc, argv, "c:s:t:nh")) != -1) {
+        switch(c) {
+            case 'c': config_fn= optarg; break;
+            case 's': settings.push_back(optarg); break;
+            case 't': ticks_per_idle= strtoul(optarg, nullptr, 10); break;
+            case 'n': header= false; break;
+            default: usage(argv[0]); return 1;
+        }
+    }
+    if(optind >= argc || ticks_per_idle == 0) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    std::string config;
+    if(!read_file(config_fn, config)) {
+        fprintf(stderr, "could not read config file %s\n", config_fn);
+        return 1;
+    }
+    for(auto s : settings) {
+        if(!sim_override_setting(config, s)) {
+            fprintf(stderr, "bad setting %s, expected setting=value\n", s);
+            return 1;
+        }
+    }
+
+    sim_set_config(config.data(), config.data() + config.size());
+    Kernel* kernel = new Kernel();
+    kernel->add_module(new SimTicker(ticks_per_idle, nullptr));
+
+    THEKERNEL->conveyor->start(THEROBOT->get_number_registered_motors());
+    THEKERNEL->step_ticker->start();
+
+    int queue_size= THEKERNEL->config->value(planner_queue_size_checksum)->by_default(32)->as_number();
+
+    if(header) {
+        printf("file,queue_size,lines,appends,blocks,blocks_per_sec,append_ns_avg,append_ns_max,"
+               "recalculate_ns_avg,recalculate_ns_max,blocks_touched_avg,blocks_touched_max\n");
+    }
+
+    int ret= 0;
+    BenchReplyStream replies;
+    for (int f = optind; f < argc; ++f) {
+        FILE *fp= fopen(argv[f], "r");
+        if(fp == nullptr) {
+            fprintf(stderr, "could not open %s\n", argv[f]);
+            ret= 1;
+            continue;
+        }
+
+        planner_stats_reset();
+        uint32_t lines= 0;
+        char buf[256];
+        while(fgets(buf, sizeof(buf), fp) != nullptr) {
+            size_t n= strlen(buf);
+            while(n > 0 && (buf[n-1] == '\n' || buf[n-1] == '\r')) buf[--n]= '\0';
+            ++lines;
+
+            struct SerialMessage message;
+            message.message= buf;
+            message.stream= &replies;
+            kernel->call_event(ON_CONSOLE_LINE_RECEIVED, &message);
+            kernel->call_event(ON_MAIN_LOOP);
+            kernel->call_event(ON_IDLE);
+        }
+        fclose(fp);
+        THECONVEYOR->wait_for_idle();
+
+        const PlannerStats &ps= planner_stats;
+        double recalcs= ps.recalculates > 0 ? ps.recalculates : 1;
+        printf("%s,%d,%lu,%llu,%llu,%1.0f,%1.0f,%llu,%1.0f,%llu,%1.2f,%lu\n",
+               argv[f], queue_size, (unsigned long)lines,
+               (unsigned long long)ps.appends, (unsigned long long)ps.recalculates,
+               ps.append_ns > 0 ? ps.recalculates * 1e9 / ps.append_ns : 0.0,
+               ps.appends > 0 ? (double)ps.append_ns / ps.appends : 0.0, (unsigned long long)ps.max_append_ns,
+               ps.recalculate_ns / recalcs, (unsigned long long)ps.max_recalculate_ns,
+               ps.blocks_touched / recalcs, (unsigned long)ps.max_blocks_touched);
+        fflush(stdout);
+    }
+
+    if(replies.errors > 0) fprintf(stderr, "WARNING: %lu replies were not ok\n", (unsigned long)replies.errors);
+    if(THEKERNEL->is_halted()) ret= 2;
+
+    return ret;
+}
@@ -0,0 +1,225 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+    Error test for the rotary delta inverse kinematics table.
+
+    Makes a RotaryDeltaSolution with its table, delta_ik_table_size defaults to 16384 here, and converts random points
+    in the volume the table covers with cartesian_to_actuator() and cartesian_to_actuators(). Each arm angle is compared
+    with the same inverse kinematics worked out in long double from the dimensions the solution reports, and with what
+    the solution gives without the table.
+
+    Prints the worst and mean error in degrees with the table and without it, and how much of the volume the table
+    covers. Exits with 1 if any angle is out by more than delta_ik_table_max_error plus what single precision alone
+    gives, or if the two calls disagree.
+*/
+
+#include "libs/Kernel.h"
+#include "libs/Config.h"
+#include "libs/ConfigValue.h"
+#include "libs/checksumm.h"
+#include "libs/ConfigSources/FirmConfigSource.h"
+#include "ActuatorCoordinates.h"
+#include "arm_solutions/RotaryDeltaSolution.h"
+#include "Sim.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <math.h>
+#include <string>
+#include <vector>
+#include <random>
+#include <chrono>
+
+#ifndef SIM_DEFAULT_CONFIG
+#define SIM_DEFAULT_CONFIG "config"
+#endif
+
+using real= long double;
+
+// the rotary delta inverse kinematics as RotaryDeltaSolution has them, in long double
+struct Reference {
+    real e, f, re, rf, z_offset, mirror;
+
+    // angle of the arm in the YZ plane, false if the point can not be reached
+    bool arm(real x0, real y0, real z0, real &theta) const
+    {
+        const real tan30= 1 / sqrtl(3);
+        real y1= -0.5L * tan30 * f;
+        y0 -= 0.5L * tan30 * e;
+        real a= (x0 * x0 + y0 * y0 + z0 * z0 + rf * rf - re * re - y1 * y1) / (2 * z0);
+        real b= (y1 - y0) / z0;
+        real d= -(a + b * y1) * (a + b * y1) + rf * (b * b * rf + rf);
+        if(d < 0) return false;
+        real yj= (y1 - a * b - sqrtl(d)) / (b * b + 1);
+        real zj= a + b * yj;
+        theta= 180 * atanl(-zj / (y1 - yj)) / M_PIl + ((yj > y1) ? 180 : 0);
+        return true;
+    }
+
+    bool angles(real x, real y, real z, real theta[3]) const
+    {
+        const real sin120= sqrtl(3) / 2, cos120= -0.5L;
+        x *= mirror;
+        y *= mirror;
+        z += z_offset;
+        return arm(x, y, z, theta[0]) &&
+               arm(x * cos120 + y * sin120, y * cos120 - x * sin120, z, theta[1]) &&
+               arm(x * cos120 - y * sin120, y * cos120 + x * sin120, z, theta[2]);
+    }
+};
+
+struct Errors {
+    real worst{0}, sum{0};
+    uint32_t n{0};
+    float at[3];
+
+    void add(real error, const float p[3])
+    {
+        if(error > worst) {
+            worst= error;
+            memcpy(at, p, sizeof(at));
+        }
+        sum += error;
+        ++n;
+    }
+
+    void print(const char *what) const
+    {
+        if(n == 0) return;
+        printf("%s: %u angles, worst %.6Lf at (%.3f, %.3f, %.3f), mean %.6Lf degrees\n", what, n, worst, at[0], at[1], at[2], sum / n);
+    }
+};
+
+static void usage(const char *name)
+{
+    fprintf(stderr, "Usage: %s [-c config] [-s setting=value]... [-n points] [-r seed]\n", name);
+    fprintf(stderr, "  -c config          config file, default %s, the rotary delta settings are read from it\n", SIM_DEFAULT_CONFIG);
+    fprintf(stderr, "  -s setting=value   override a config setting, eg -s delta_ik_table_size=8192\n");
+    fprintf(stderr, "  -n points          number of random points (default 100000)\n");
+    fprintf(stderr, "  -r seed            random seed (default 1)\n");
+}
+
+int main(int argc, char *argv[])
+{
+    const char *config_fn= SIM_DEFAULT_CONFIG;
+    std::vector<const char*> settings;
+    uint32_t n_points= 100000;
+    uint32_t seed= 1;
+
+    int c;
+    while((c= getopt(argc, argv, "c:s:n:r:h")) != -1) {
+        switch(c) {
+            case 'c': config_fn= optarg; break;
+            case 's': settings.push_back(optarg); break;
+            case 'n': n_points= strtoul(optarg, nullptr, 10); break;
+            case 'r': seed= strtoul(optarg, nullptr, 10); break;
+            default: usage(argv[0]); return 1;
+        }
+    }
+
+    std::string config;
+    FILE *fp= fopen(config_fn, "r");
+    if(fp == nullptr) {
+        fprintf(stderr, "could not read config file %s\n", config_fn);
+        return 1;
+    }
+    char buf[4096];
+    size_t n;
+    while((n= fread(buf, 1, sizeof(buf), fp)) > 0) config.append(buf, n);
+    fclose(fp);
+    sim_override_setting(config, "delta_ik_table_size=16384");
+    for(auto s : settings) {
+        if(!sim_override_setting(config, s)) {
+            fprintf(stderr, "bad setting %s, expected setting=value\n", s);
+            return 1;
+        }
+    }
+
+    // the same solution without the table
+    std::string analytic_config= config;
+    sim_override_setting(analytic_config, "delta_ik_table_size=0");
+    Config analytic_source(new FirmConfigSource("analytic", analytic_config.data(), analytic_config.data() + analytic_config.size()));
+    analytic_source.config_cache_load();
+    RotaryDeltaSolution analytic(&analytic_source);
+
+    sim_set_config(config.data(), config.data() + config.size());
+    new Kernel();
+
+    auto setting= [](uint16_t checksum, float def) { return THEKERNEL->config->value(checksum)->by_default(def)->as_number(); };
+    float radius= setting(CHECKSUM("delta_ik_table_radius"), 75.0F);
+    float z_min= setting(CHECKSUM("delta_ik_table_z_min"), 0.0F);
+    float z_max= setting(CHECKSUM("delta_ik_table_z_max"), 50.0F);
+    float max_error= setting(CHECKSUM("delta_ik_table_max_error"), 0.002F);
+    uint32_t solution_size= THEKERNEL->config->value(CHECKSUM("delta_ik_table_size"))->by_default(0)->as_int();
+
+    std::chrono::steady_clock::time_point start= std::chrono::steady_clock::now();
+    RotaryDeltaSolution solution(THEKERNEL->config);
+    double build_ms= std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count() / 1000.0;
+
+    BaseSolution::arm_options_t options;
+    solution.get_optional(options, true);
+    Reference ref;
+    ref.e= options['A'];
+    ref.f= options['B'];
+    ref.re= options['C'];
+    ref.rf= options['D'];
+    ref.z_offset= -((real)options['E'] - options['H'] - options['I']);
+    ref.mirror= THEKERNEL->config->value(CHECKSUM("delta_mirror_xy"))->by_default(true)->as_bool() ? -1 : 1;
+
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<float> unit(0, 1);
+    Errors table, single, interpolation;
+    uint32_t unreachable= 0, mismatched= 0, from_table= 0;
+    for (uint32_t i = 0; i < n_points; i++) {
+        // uniform over the cylinder the table covers
+        float r= radius * sqrtf(unit(rng)), a= unit(rng) * 2 * (float)M_PI;
+        float p[3]= {r * cosf(a), r * sinf(a), z_min + (z_max - z_min) * unit(rng)};
+
+        real theta[3];
+        if(!ref.angles(p[0], p[1], p[2], theta)) {
+            ++unreachable;
+            continue;
+        }
+
+        ActuatorCoordinates actuator, exact;
+        solution.cartesian_to_actuator(p, actuator);
+        analytic.cartesian_to_actuator(p, exact);
+
+        float batched[3];
+        const float *const cartesian_mm[3]= {&p[0], &p[1], &p[2]};
+        float *const actuator_mm[3]= {&batched[0], &batched[1], &batched[2]};
+        solution.cartesian_to_actuators(1, cartesian_mm, actuator_mm);
+        if(memcmp(batched, actuator.data(), sizeof(batched)) != 0) ++mismatched;
+
+        for (int k = 0; k < 3; k++) {
+            table.add(fabsl(actuator[k] - theta[k]), p);
+            single.add(fabsl(exact[k] - theta[k]), p);
+            if(actuator[k] != exact[k]) {
+                ++from_table;
+                interpolation.add(fabsf(actuator[k] - exact[k]), p);
+            }
+        }
+    }
+
+    printf("table of %u bytes: radius %.1f, z %.1f to %.1f, built in %.1f ms\n", solution_size, radius, z_min, z_max, build_ms);
+    table.print("with the table   ");
+    single.print("without the table");
+    interpolation.print("interpolated     ");
+    printf("%.1f%% of the angles interpolated, %u points out of reach, %u differ between the two calls\n",
+           table.n ? 100.0 * from_table / table.n : 0.0, unreachable, mismatched);
+
+    // the table holds single precision angles, so they may be out by as much as those worked out without it
+    real limit= max_error + single.worst;
+    if(table.worst > limit || mismatched > 0) {
+        printf("FAILED: more than %.6Lf degrees out or the calls differ\n", limit);
+        return 1;
+    }
+    return 0;
+}
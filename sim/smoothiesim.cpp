@@ -0,0 +1,232 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+    Host simulator driver.
+
+    Streams a G-code file through GcodeDispatch -> Robot -> Planner -> Conveyor exactly as the firmware main loop does,
+    and runs StepTicker::step_tick() from a virtual clock instead of the TIMER0 interrupt. Every ON_IDLE advances the clock
+    by a fixed number of ticks, so a run is fully deterministic and the step log can be diffed between firmware revisions.
+
+    With -b the file is a stream of binary frames and text lines from gcodeencode, handed to GcodeDispatch the way
+    USBSerial would.
+
+    The step log has one line per step: <tick> <actuator> <+|->
+    The summary printed at the end gives the host time spent planning (per G-code line) and generating steps (per tick).
+*/
+
+#include "libs/Kernel.h"
+#include "libs/SerialMessage.h"
+#include "libs/StreamOutput.h"
+#include "libs/StepTicker.h"
+#include "libs/FileStream.h"
+#include "modules/robot/Conveyor.h"
+#include "modules/robot/Robot.h"
+#include "Sim.h"
+#include "SimTicker.h"
+#include "PlannerStats.h"
+#include "BinaryGcodeEncoder.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <string>
+#include <vector>
+#include <chrono>
+
+#ifndef SIM_DEFAULT_CONFIG
+#define SIM_DEFAULT_CONFIG "config"
+#endif
+
+using sim_clock= std::chrono::steady_clock;
+
+static uint64_t elapsed_ns(sim_clock::time_point start)
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(sim_clock::now() - start).count();
+}
+
+// replies from the simulated firmware, discarded unless verbose
+class SimReplyStream : public StreamOutput {
+    public:
+        SimReplyStream(bool v) : verbose(v) {}
+        int puts(const char *str) { if(verbose) fputs(str, stderr); if(strncmp(str, "ok", 2) != 0 && strncmp(str, "!!", 2) != 0) ++errors; return strlen(str); }
+        bool verbose;
+        uint32_t errors{0};
+};
+
+static bool read_file(const char *fn, std::string &buf)
+{
+    FILE *fp= fopen(fn, "r");
+    if(fp == nullptr) return false;
+    char b[4096];
+    size_t n;
+    while((n= fread(b, 1, sizeof(b), fp)) > 0) buf.append(b, n);
+    fclose(fp);
+    return true;
+}
+
+static void usage(const char *prog)
+{
+    fprintf(stderr, "Usage: %s [-c config] [-s setting=value]... [-o steplog] [-T timeline] [-p profile.csv] [-t ticks_per_idle] [-b] [-v] file.gcode\n", prog);
+    fprintf(stderr, "  -c config          configuration to load (default %s)\n", SIM_DEFAULT_CONFIG);
+    fprintf(stderr, "  -s setting=value   override a config setting, can be repeated\n");
+    fprintf(stderr, "  -o steplog         write one line per step: <tick> <actuator> <+|->, use - for stdout\n");
+    fprintf(stderr, "  -T timeline        write the step timeline with the block parameters, for steptiming.py\n");
+    fprintf(stderr, "  -p profile.csv     write per line host planning time: line,ns,ticks\n");
+    fprintf(stderr, "  -t ticks_per_idle  step ticks run for each ON_IDLE (default 1)\n");
+    fprintf(stderr, "  -b                 the file is a binary Gcode stream from gcodeencode\n");
+    fprintf(stderr, "  -v                 echo the firmware replies to stderr\n");
+}
+
+int main(int argc, char *argv[])
+{
+    const char *config_fn= SIM_DEFAULT_CONFIG;
+    const char *log_fn= nullptr;
+    const char *timeline_fn= nullptr;
+    const char *profile_fn= nullptr;
+    std::vector<const char*> settings;
+    uint32_t ticks_per_idle= 1;
+    bool verbose= false;
+    bool binary_input= false;
+
+    int c;
+    while((c= getopt(argc, argv, "c:s:o:T:p:t:bvh")) != -1) {
+        switch(c) {
+            case 'c': config_fn= optarg; break;
+            case 's': settings.push_back(optarg); break;
+            case 'o': log_fn= optarg; break;
+            case 'T': timeline_fn= optarg; break;
+            case 'p': profile_fn= optarg; break;
+            case 't': ticks_per_idle= strtoul(optarg, nullptr, 10); break;
+            case 'b': binary_input= true; break;
+            case 'v': verbose= true; break;
+            default: usage(argv[0]); return 1;
+        }
+    }
+    if(optind != argc - 1 || ticks_per_idle == 0) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    std::string config;
+    if(!read_file(config_fn, config)) {
+        fprintf(stderr, "could not read config file %s\n", config_fn);
+        return 1;
+    }
+    for(auto s : settings) {
+        if(!sim_override_setting(config, s)) {
+            fprintf(stderr, "bad setting %s, expected setting=value\n", s);
+            return 1;
+        }
+    }
+
+    // a binary stream is split up front, a text file is read as it goes
+    FILE *gcode_fp= nullptr;
+    std::vector<std::string> units;
+    std::string stream;
+    if(binary_input ? !read_file(argv[optind], stream) : (gcode_fp= fopen(argv[optind], "r")) == nullptr) {
+        fprintf(stderr, "could not open %s\n", argv[optind]);
+        return 1;
+    }
+    if(binary_input) units= BinaryGcodeEncoder::split(stream);
+
+    FILE *step_log= nullptr;
+    if(log_fn != nullptr) {
+        step_log= strcmp(log_fn, "-") == 0 ? stdout : fopen(log_fn, "w");
+        if(step_log == nullptr) {
+            fprintf(stderr, "could not create %s\n", log_fn);
+            return 1;
+        }
+    }
+
+    FileStream *timeline= nullptr;
+    if(timeline_fn != nullptr) {
+        timeline= new FileStream(timeline_fn);
+        if(!timeline->is_open()) {
+            fprintf(stderr, "could not create %s\n", timeline_fn);
+            return 1;
+        }
+    }
+
+    FILE *profile= nullptr;
+    if(profile_fn != nullptr) {
+        profile= fopen(profile_fn, "w");
+        if(profile == nullptr) {
+            fprintf(stderr, "could not create %s\n", profile_fn);
+            return 1;
+        }
+        fprintf(profile, "line,ns,ticks\n");
+    }
+
+    sim_set_config(config.data(), config.data() + config.size());
+    Kernel* kernel = new Kernel();
+    SimTicker *ticker= new SimTicker(ticks_per_idle, step_log, timeline);
+    kernel->add_module(ticker);
+
+    // start the timers and interrupts, as main.cpp does once everything is loaded
+    THEKERNEL->conveyor->start(THEROBOT->get_number_registered_motors());
+    THEKERNEL->step_ticker->start();
+
+    SimReplyStream replies(verbose);
+    uint32_t lines= 0;
+    uint64_t plan_ns= 0, max_line_ns= 0;
+    char buf[256];
+    for (size_t next_unit = 0;; ++next_unit) {
+        struct SerialMessage message;
+        message.stream= &replies;
+        if(binary_input) {
+            if(next_unit == units.size()) break;
+            message.message= units[next_unit];
+
+        } else {
+            if(fgets(buf, sizeof(buf), gcode_fp) == nullptr) break;
+            // strip the line the same way the serial console does
+            size_t n= strlen(buf);
+            while(n > 0 && (buf[n-1] == '\n' || buf[n-1] == '\r')) buf[--n]= '\0';
+            message.message= buf;
+        }
+        ++lines;
+
+        // time spent idle while the dispatch was blocked on a full queue is not planning time
+        uint64_t idle0= sim_get_idle_ns(), start_ticks= sim_get_ticks();
+        sim_clock::time_point start= sim_clock::now();
+        kernel->call_event(ON_CONSOLE_LINE_RECEIVED, &message);
+        uint64_t ns= elapsed_ns(start) - (sim_get_idle_ns() - idle0);
+
+        plan_ns += ns;
+        if(ns > max_line_ns) max_line_ns= ns;
+        if(profile != nullptr) fprintf(profile, "%lu,%llu,%llu\n", (unsigned long)lines, (unsigned long long)ns, (unsigned long long)(sim_get_ticks() - start_ticks));
+
+        kernel->call_event(ON_MAIN_LOOP);
+        kernel->call_event(ON_IDLE);
+    }
+    if(gcode_fp != nullptr) fclose(gcode_fp);
+
+    // let everything that was planned run out
+    THECONVEYOR->wait_for_idle();
+
+    if(profile != nullptr) fclose(profile);
+    if(step_log != nullptr && step_log != stdout) fclose(step_log);
+    if(timeline != nullptr) delete timeline;
+
+    const SimTicker::stats_t &stats= ticker->get_stats();
+    uint64_t ticks= sim_get_ticks();
+    float freq= THEKERNEL->step_ticker->get_frequency();
+    fprintf(stderr, "lines: %lu, blocks: %llu, steps: %llu, ticks: %llu (%1.3f s simulated)\n",
+            (unsigned long)lines, (unsigned long long)stats.blocks, (unsigned long long)stats.steps, (unsigned long long)ticks, ticks / freq);
+    fprintf(stderr, "planning: %1.3f ms total, %1.0f ns/line avg, %llu ns/line max\n",
+            plan_ns / 1e6, lines > 0 ? (double)plan_ns / lines : 0.0, (unsigned long long)max_line_ns);
+    fprintf(stderr, "recalculate: %1.0f ns avg, %llu ns max, %1.1f blocks touched avg, %lu max\n",
+            planner_stats.recalculates > 0 ? (double)planner_stats.recalculate_ns / planner_stats.recalculates : 0.0, (unsigned long long)planner_stats.max_recalculate_ns,
+            planner_stats.recalculates > 0 ? (double)planner_stats.blocks_touched / planner_stats.recalculates : 0.0, (unsigned long)planner_stats.max_blocks_touched);
+    fprintf(stderr, "stepping: %1.3f ms total, %1.1f ns/tick avg\n",
+            stats.tick_ns / 1e6, ticks > 0 ? (double)stats.tick_ns / ticks : 0.0);
+    if(replies.errors > 0) fprintf(stderr, "WARNING: %lu replies were not ok, rerun with -v to see them\n", (unsigned long)replies.errors);
+
+    return THEKERNEL->is_halted() ? 2 : 0;
+}
@@ -0,0 +1,166 @@
+#!/usr/bin/env python3
+#
+# Step timing analyser for the step timeline, from smoothiesim -T or from the timeline console command on a board built
+# with STEPTICKER_TIMELINE, see README.md
+#
+# For every step it works out when the ideal trapezoid of its block says the step should have happened, from the
+# block's entry, exit and nominal speeds, acceleration and step counts, without any of the rounding the firmware does.
+# The difference is reported per actuator as the step jitter, split into the whole ticks the step ticker was out by
+# (rounding in the trapezoid and the step generator) and the time into the tick the step was issued (ISR latency).
+#
+#   steptiming.py [-o velocity.csv] timeline
+#
+# -o writes the velocity and acceleration of each actuator reconstructed from the step times as CSV:
+#   actuator,tick,velocity,acceleration   in steps/sec and steps/sec²
+
+import argparse
+import math
+import sys
+
+
+class Block:
+    def __init__(self, fields):
+        self.tick = int(fields[0])
+        nominal_rate, nominal_speed, entry_speed, exit_speed, acceleration, millimeters = map(float, fields[1:7])
+        self.steps_event_count = int(fields[7])
+        self.s_curve = fields[8] != '0'
+        self.steps = [int(s) for s in fields[9:]]
+
+        # the same trapezoid as Block::calculate_trapezoid(), in double precision and continuous time
+        n = self.steps_event_count
+        self.initial_rate = nominal_rate * entry_speed / nominal_speed if nominal_speed > 0 else 0.0
+        self.final_rate = nominal_rate * exit_speed / nominal_speed if nominal_speed > 0 else 0.0
+        self.accel = acceleration * n / millimeters if millimeters > 0 else 0.0
+        ri2, rf2 = self.initial_rate ** 2, self.final_rate ** 2
+        self.maximum_rate = min(math.sqrt(n * self.accel + (ri2 + rf2) / 2.0), nominal_rate)
+        if self.accel > 0:
+            self.accel_distance = max(0.0, (self.maximum_rate ** 2 - ri2) / (2.0 * self.accel))
+            self.decel_distance = max(0.0, (self.maximum_rate ** 2 - rf2) / (2.0 * self.accel))
+        else:
+            self.accel_distance = self.decel_distance = 0.0
+        self.plateau_distance = max(0.0, n - self.accel_distance - self.decel_distance)
+        self.accel_time = (self.maximum_rate - self.initial_rate) / self.accel if self.accel > 0 else 0.0
+        self.plateau_time = self.plateau_distance / self.maximum_rate if self.maximum_rate > 0 else 0.0
+
+    # seconds from the start of the block until the primary axis has moved s steps
+    def time_at(self, s):
+        a, ri, vmax = self.accel, self.initial_rate, self.maximum_rate
+        if s <= self.accel_distance:
+            return (math.sqrt(ri * ri + 2.0 * a * s) - ri) / a if a > 0 else s / ri
+        s -= self.accel_distance
+        if s <= self.plateau_distance:
+            return self.accel_time + s / vmax
+        s = min(s - self.plateau_distance, self.decel_distance)
+        return self.accel_time + self.plateau_time + (vmax - math.sqrt(max(0.0, vmax * vmax - 2.0 * a * s))) / a
+
+
+class Stats:
+    def __init__(self):
+        self.n = 0
+        self.sum = 0.0
+        self.sum2 = 0.0
+        self.max = 0.0
+        self.latency_sum = 0.0
+        self.latency_max = 0.0
+        self.all = []
+
+    def add(self, jitter, latency):
+        self.all.append(abs(jitter))
+        self.n += 1
+        self.sum += jitter
+        self.sum2 += jitter * jitter
+        if abs(jitter) > abs(self.max):
+            self.max = jitter
+        self.latency_sum += latency
+        self.latency_max = max(self.latency_max, latency)
+
+    def mean(self):
+        return self.sum / self.n
+
+    def std(self):
+        return math.sqrt(max(0.0, self.sum2 / self.n - self.mean() ** 2))
+
+    # the last steps of a move that stops take a long time each, so being a fraction of a step out there is a large
+    # time error, the percentile shows what most steps see
+    def percentile(self, p):
+        self.all.sort()
+        return self.all[min(len(self.all) - 1, int(len(self.all) * p / 100.0))]
+
+
+def main():
+    parser = argparse.ArgumentParser(description='step jitter against the ideal trapezoid from a step timeline')
+    parser.add_argument('-o', dest='velocity', help='write the reconstructed velocity and acceleration as CSV')
+    parser.add_argument('timeline')
+    args = parser.parse_args()
+
+    frequency, period = 100000.0, 250.0
+    block = None
+    step_in_block = {}
+    stats = {}
+    last_step = {}      # actuator -> (time, velocity)
+    skipped_s_curve = 0
+    dropped = False
+    out = open(args.velocity, 'w') if args.velocity else None
+    if out:
+        out.write('actuator,tick,velocity,acceleration\n')
+
+    for line in open(args.timeline):
+        f = line.split()
+        if not f:
+            continue
+        if f[0] == '#':
+            if len(f) >= 5 and f[1] == 'frequency':
+                frequency, period = float(f[2]), float(f[4])
+            elif len(f) >= 2 and f[1] == 'dropped':
+                dropped = True
+            continue
+        if f[0] == 'B':
+            block = Block(f[1:])
+            step_in_block = {}
+            if block.s_curve:
+                skipped_s_curve += 1
+            continue
+
+        tick, actuator, subtick = int(f[0]), int(f[1]), int(f[3]) if len(f) > 3 else 0
+        latency = subtick / period                 # in ticks
+        t = tick + latency                         # in ticks
+
+        if out:
+            if actuator in last_step:
+                t0, v0 = last_step[actuator]
+                v = frequency / (t - t0) if t > t0 else 0.0
+                acc = (v - v0) * frequency / (t - t0) if t > t0 and v0 is not None else 0.0
+                out.write('%d,%.3f,%.3f,%.3f\n' % (actuator, t, v, acc))
+                last_step[actuator] = (t, v)
+            else:
+                last_step[actuator] = (t, None)
+
+        if block is None or block.s_curve or actuator >= len(block.steps) or block.steps[actuator] == 0:
+            continue
+
+        # the k'th step of this actuator is due when the primary axis has moved k / ratio steps
+        k = step_in_block.get(actuator, 0) + 1
+        step_in_block[actuator] = k
+        s = k * block.steps_event_count / block.steps[actuator]
+        # the block's first tick is block.tick, the steps issued on it have had one tick of movement
+        ideal = block.tick - 1 + block.time_at(s) * frequency
+        stats.setdefault(actuator, Stats()).add(t - ideal, latency)
+
+    if out:
+        out.close()
+
+    us = 1e6 / frequency
+    print('step jitter against the ideal trapezoid, in ticks of %1.2f us (a perfect step generator is between 0 and 1)' % us)
+    for actuator in sorted(stats):
+        st = stats[actuator]
+        print('actuator %d: %d steps, jitter mean %1.3f std %1.3f 99%% within %1.3f max %1.3f ticks (%1.2f us), latency mean %1.3f max %1.3f ticks' %
+              (actuator, st.n, st.mean(), st.std(), st.percentile(99), st.max, st.max * us, st.latency_sum / st.n, st.latency_max))
+    if skipped_s_curve:
+        print('%d S-curve blocks were not compared' % skipped_s_curve)
+    if dropped:
+        print('WARNING: the timeline dropped events, the figures after that are not reliable')
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
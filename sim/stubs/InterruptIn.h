@@ -0,0 +1,15 @@
+// Host simulator stand in for the mbed InterruptIn class, pin interrupts never fire
+#pragma once
+
+#include "PinNames.h"
+
+namespace mbed {
+class InterruptIn {
+public:
+    InterruptIn(PinName pin) { (void)pin; }
+    template<typename T> void rise(T*, void (T::*)()) {}
+    template<typename T> void fall(T*, void (T::*)()) {}
+    void rise(void (*)()) {}
+    void fall(void (*)()) {}
+};
+}
@@ -0,0 +1,4 @@
+// Host simulator stand in for the mbed LPC17xx.h device header
+#pragma once
+
+#include "libs/LPC17xx/sLPC17xx.h"
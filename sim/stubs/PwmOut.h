@@ -0,0 +1,17 @@
+// Host simulator stand in for the mbed PwmOut class, no hardware pwm is simulated
+#pragma once
+
+#include "PinNames.h"
+
+namespace mbed {
+class PwmOut {
+public:
+    PwmOut(PinName pin) : value(0) { (void)pin; }
+    void write(float v) { value= v; }
+    float read() { return value; }
+    void period_us(int) {}
+    void pulsewidth_us(int) {}
+private:
+    float value;
+};
+}
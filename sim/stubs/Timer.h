@@ -0,0 +1,4 @@
+// Host simulator stand in for the mbed Timer header
+#pragma once
+
+#include "us_ticker_api.h"
@@ -0,0 +1,4 @@
+// Host simulator stand in for the mbed cmsis.h device header
+#pragma once
+
+#include "libs/LPC17xx/sLPC17xx.h"
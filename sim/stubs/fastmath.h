@@ -0,0 +1,4 @@
+// Host simulator stand in for the newlib fastmath.h header
+#pragma once
+
+#include <math.h>
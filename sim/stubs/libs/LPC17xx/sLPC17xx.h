@@ -0,0 +1,110 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+    Host simulator version of the LPC17xx peripheral header.
+    The real header is used for all the register layouts, then the peripheral pointers are
+    redirected into plain host memory so register accesses from firmware code become harmless
+    loads and stores. Core functions that would execute ARM instructions are replaced with no-ops.
+*/
+
+#pragma once
+
+#include "../../../../src/libs/LPC17xx/sLPC17xx.h"
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+void *sim_peripheral(uint32_t base);
+void sim_system_reset(void);
+SCB_Type *sim_scb(void);
+#ifdef __cplusplus
+}
+#endif
+
+// the base addresses stay as they are (PinNames.h builds its enum from them) but the registers live in host memory
+#undef LPC_SC
+#define LPC_SC         ((LPC_SC_TypeDef       *) sim_peripheral(LPC_SC_BASE))
+#undef LPC_GPIO0
+#define LPC_GPIO0      ((LPC_GPIO_TypeDef     *) sim_peripheral(LPC_GPIO0_BASE))
+#undef LPC_GPIO1
+#define LPC_GPIO1      ((LPC_GPIO_TypeDef     *) sim_peripheral(LPC_GPIO1_BASE))
+#undef LPC_GPIO2
+#define LPC_GPIO2      ((LPC_GPIO_TypeDef     *) sim_peripheral(LPC_GPIO2_BASE))
+#undef LPC_GPIO3
+#define LPC_GPIO3      ((LPC_GPIO_TypeDef     *) sim_peripheral(LPC_GPIO3_BASE))
+#undef LPC_GPIO4
+#define LPC_GPIO4      ((LPC_GPIO_TypeDef     *) sim_peripheral(LPC_GPIO4_BASE))
+#undef LPC_WDT
+#define LPC_WDT        ((LPC_WDT_TypeDef      *) sim_peripheral(LPC_WDT_BASE))
+#undef LPC_TIM0
+#define LPC_TIM0       ((LPC_TIM_TypeDef      *) sim_peripheral(LPC_TIM0_BASE))
+#undef LPC_TIM1
+#define LPC_TIM1       ((LPC_TIM_TypeDef      *) sim_peripheral(LPC_TIM1_BASE))
+#undef LPC_TIM2
+#define LPC_TIM2       ((LPC_TIM_TypeDef      *) sim_peripheral(LPC_TIM2_BASE))
+#undef LPC_TIM3
+#define LPC_TIM3       ((LPC_TIM_TypeDef      *) sim_peripheral(LPC_TIM3_BASE))
+#undef LPC_RIT
+#define LPC_RIT        ((LPC_RIT_TypeDef      *) sim_peripheral(LPC_RIT_BASE))
+#undef LPC_UART0
+#define LPC_UART0      ((LPC_UART0_TypeDef    *) sim_peripheral(LPC_UART0_BASE))
+#undef LPC_UART1
+#define LPC_UART1      ((LPC_UART1_TypeDef    *) sim_peripheral(LPC_UART1_BASE))
+#undef LPC_UART2
+#define LPC_UART2      ((LPC_UART_TypeDef     *) sim_peripheral(LPC_UART2_BASE))
+#undef LPC_UART3
+#define LPC_UART3      ((LPC_UART_TypeDef     *) sim_peripheral(LPC_UART3_BASE))
+#undef LPC_PWM1
+#define LPC_PWM1       ((LPC_PWM_TypeDef      *) sim_peripheral(LPC_PWM1_BASE))
+#undef LPC_I2C0
+#define LPC_I2C0       ((LPC_I2C_TypeDef      *) sim_peripheral(LPC_I2C0_BASE))
+#undef LPC_I2C1
+#define LPC_I2C1       ((LPC_I2C_TypeDef      *) sim_peripheral(LPC_I2C1_BASE))
+#undef LPC_I2C2
+#define LPC_I2C2       ((LPC_I2C_TypeDef      *) sim_peripheral(LPC_I2C2_BASE))
+#undef LPC_I2S
+#define LPC_I2S        ((LPC_I2S_TypeDef      *) sim_peripheral(LPC_I2S_BASE))
+#undef LPC_SPI
+#define LPC_SPI        ((LPC_SPI_TypeDef      *) sim_peripheral(LPC_SPI_BASE))
+#undef LPC_RTC
+#define LPC_RTC        ((LPC_RTC_TypeDef      *) sim_peripheral(LPC_RTC_BASE))
+#undef LPC_GPIOINT
+#define LPC_GPIOINT    ((LPC_GPIOINT_TypeDef  *) sim_peripheral(LPC_GPIOINT_BASE))
+#undef LPC_PINCON
+#define LPC_PINCON     ((LPC_PINCON_TypeDef   *) sim_peripheral(LPC_PINCON_BASE))
+#undef LPC_SSP0
+#define LPC_SSP0       ((LPC_SSP_TypeDef      *) sim_peripheral(LPC_SSP0_BASE))
+#undef LPC_SSP1
+#define LPC_SSP1       ((LPC_SSP_TypeDef      *) sim_peripheral(LPC_SSP1_BASE))
+#undef LPC_ADC
+#define LPC_ADC        ((LPC_ADC_TypeDef      *) sim_peripheral(LPC_ADC_BASE))
+#undef LPC_DAC
+#define LPC_DAC        ((LPC_DAC_TypeDef      *) sim_peripheral(LPC_DAC_BASE))
+#undef LPC_MCPWM
+#define LPC_MCPWM      ((LPC_MCPWM_TypeDef    *) sim_peripheral(LPC_MCPWM_BASE))
+#undef LPC_QEI
+#define LPC_QEI        ((LPC_QEI_TypeDef      *) sim_peripheral(LPC_QEI_BASE))
+#undef LPC_USB
+#define LPC_USB        ((LPC_USB_TypeDef      *) sim_peripheral(LPC_USB_BASE))
+
+// the core peripherals too, the simulator runs PendSV itself once it has been pended, see sim_run_ticks()
+#undef SCB
+#define SCB            (sim_scb())
+
+// there are no interrupts on the host, the simulator calls the handlers itself
+#define __disable_irq()                 ((void)0)
+#define __enable_irq()                  ((void)0)
+#define NVIC_EnableIRQ(irq)             ((void)(irq))
+#define NVIC_DisableIRQ(irq)            ((void)(irq))
+#define NVIC_SetPendingIRQ(irq)         ((void)(irq))
+#define NVIC_SetPriority(irq, pri)      ((void)(irq), (void)(pri))
+#define NVIC_GetPriority(irq)           ((void)(irq), 0)
+#define NVIC_SetPriorityGrouping(g)     ((void)(g))
+#define NVIC_SystemReset()              sim_system_reset()
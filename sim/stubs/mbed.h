@@ -0,0 +1,14 @@
+// Host simulator stand in for mbed.h, only the parts used by the motion pipeline are provided
+#pragma once
+
+#include "cmsis.h"
+#include "PinNames.h"
+#include "us_ticker_api.h"
+#include "wait_api.h"
+
+#ifdef __cplusplus
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+using namespace std;
+#endif
@@ -0,0 +1,10 @@
+// Host simulator stand in for the MRI debug monitor, a breakpoint aborts so it is caught by gdb or the sanitizers
+#pragma once
+
+#include <stdlib.h>
+
+#define __debugbreak()  abort()
+
+#define MRI_ENABLE 0
+
+static inline int __mriPlatform_CommUartIndex(void) { return 0; }
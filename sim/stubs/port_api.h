@@ -0,0 +1,13 @@
+// Host simulator stand in for the mbed port api
+#pragma once
+
+#include "PinNames.h"
+#include "PortNames.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+PinName port_pin(PortName port, int pin_n);
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,12 @@
+// Host simulator stand in for the mbed system_LPC17xx.h header
+#pragma once
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+extern uint32_t SystemCoreClock;
+#ifdef __cplusplus
+}
+#endif
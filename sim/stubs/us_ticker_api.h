@@ -0,0 +1,12 @@
+// Host simulator stand in for the mbed us_ticker api, reads the simulated clock
+#pragma once
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+uint32_t us_ticker_read(void);
+#ifdef __cplusplus
+}
+#endif
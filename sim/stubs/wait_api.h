@@ -0,0 +1,12 @@
+// Host simulator stand in for the mbed wait api, waiting advances the simulated clock
+#pragma once
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+void wait(float s);
+void wait_ms(int ms);
+void wait_us(int us);
+#ifdef __cplusplus
+}
+#endif
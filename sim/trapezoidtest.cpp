@@ -0,0 +1,398 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+    Property test for Block::calculate_trapezoid().
+
+    Builds random blocks, from a few steps to millions, with random entry, exit and nominal speeds and accelerations,
+    works out their trapezoids and runs the resulting tick_info tick by tick the way StepTicker::step_tick() does.
+    Each one is checked against the same trapezoid worked out in long double in continuous time:
+
+    * every motor gets all its steps without the step ticker having to force any out because the rate ran down to 0
+    * the ramps and the whole move are within a tick or two of the reference
+    * the last step of each motor is issued within a tick or two of when the reference says
+    * the rate at the end of each ramp is what was asked for
+    * an S-curve is compared with one with the same jerk, and its acceleration never goes over the block's
+
+    Exits with 1 if any block fails, printing the first few failures.
+*/
+
+#include "libs/Kernel.h"
+#include "libs/StepTicker.h"
+#include "modules/robot/Block.h"
+#include "Sim.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <math.h>
+#include <float.h>
+#include <string>
+#include <random>
+#include <algorithm>
+
+#ifndef SIM_DEFAULT_CONFIG
+#define SIM_DEFAULT_CONFIG "config"
+#endif
+
+using real= long double;
+
+// the continuous time trapezoid or S-curve for a block, all in ticks and steps of the primary axis
+struct Reference {
+    real accel_ticks, plateau_ticks, decel_ticks;
+    real initial_rate, maximum_rate, final_rate;    // steps/tick
+    real accel;                                     // steps/tick²
+    real jerk;                                      // steps/tick³, 0 for a trapezoid
+
+    // steps moved after t ticks
+    real position(real t) const
+    {
+        if(t <= accel_ticks) return initial_rate * t + accel * t * t / 2;
+        real s= (initial_rate + maximum_rate) / 2 * accel_ticks;
+        t -= accel_ticks;
+        if(t <= plateau_ticks) return s + maximum_rate * t;
+        s += maximum_rate * plateau_ticks;
+        t= std::min(t - plateau_ticks, decel_ticks);
+        return s + maximum_rate * t - accel * t * t / 2;
+    }
+};
+
+// the ticks an S-curve ramp takes to change the rate by dv, the acceleration ramps up to a at the jerk rate, is held and
+// ramps back down, or just ramps up and down if dv is too small to reach a
+static real s_curve_ticks(real dv, real a, real jerk)
+{
+    return (dv * jerk >= a * a) ? dv / a + a / jerk : 2 * sqrtl(dv / jerk);
+}
+
+static Reference reference(const Block &b, real entry, real exit, real frequency)
+{
+    Reference r;
+    real n= b.steps_event_count;
+    real ri= b.nominal_rate * entry / b.nominal_speed / frequency;
+    real rf= b.nominal_rate * exit / b.nominal_speed / frequency;
+    real a= (real)b.acceleration * n / b.millimeters / (frequency * frequency);
+    r.maximum_rate= std::min(sqrtl(n * a + (ri * ri + rf * rf) / 2), (real)b.nominal_rate / frequency);
+    real da= (r.maximum_rate * r.maximum_rate - ri * ri) / (2 * a);
+    real dd= (r.maximum_rate * r.maximum_rate - rf * rf) / (2 * a);
+    r.accel_ticks= (r.maximum_rate - ri) / a;
+    r.decel_ticks= (r.maximum_rate - rf) / a;
+    r.jerk= 0;
+    if(b.jerk > 0) {
+        // the same rate Block::calculate_trapezoid() goes for, taking both ramps as reaching the acceleration
+        real jerk= (real)b.jerk * n / b.millimeters / (frequency * frequency * frequency);
+        r.jerk= jerk;
+        real h= a * a / (2 * jerk);
+        real c= n * a + (ri * ri + rf * rf) / 2 - h * (ri + rf);
+        r.maximum_rate= std::min(std::max(sqrtl(h * h + std::max((real)0, c)) - h, std::max(ri, rf)), (real)b.nominal_rate / frequency);
+        r.accel_ticks= s_curve_ticks(r.maximum_rate - ri, a, jerk);
+        r.decel_ticks= s_curve_ticks(r.maximum_rate - rf, a, jerk);
+        da= (ri + r.maximum_rate) / 2 * r.accel_ticks;
+        dd= (rf + r.maximum_rate) / 2 * r.decel_ticks;
+    }
+    r.plateau_ticks= std::max((real)0, (n - da - dd) / r.maximum_rate);
+    r.initial_rate= ri;
+    r.final_rate= rf;
+    r.accel= a;
+    return r;
+}
+
+struct Result {
+    bool forced;            // a step had to be forced out by the rounding protection
+    uint32_t last_step;     // tick of the last step of the primary axis
+    uint32_t ticks;         // ticks until every motor was done
+    int32_t rate_at_accel_end, rate_at_decel_end;  // primary axis
+    int64_t distance;       // steps the rates of the primary axis add up to over the ticks of the move, in 2.30
+    int64_t peak_acceleration;  // of the primary axis on an S-curve, in 2.62
+};
+
+static real fromfp(int64_t x)
+{
+    return (real)x / STEPTICKER_FPSCALE;
+}
+
+// the ticks the step ticker runs the block for, the trapezoid's plateau starts on the last tick of the acceleration ramp
+// so has one more than the events say, as Block::prepare() works out
+static uint32_t move_ticks(const Block &b)
+{
+    if(!b.s_curve && (b.accelerate_until > 0 || b.decelerate_after > 0 || b.decelerate_after == b.total_move_ticks)) return b.total_move_ticks + 1;
+    return b.total_move_ticks;
+}
+
+// the rate updates of StepTicker::step_tick() and StepTicker::next_s_curve_phase(), for one block from its first tick
+// until all its motors are done
+static Result run(Block &b)
+{
+    Result res{false, 0, 0, 0, 0, 0, 0};
+    uint32_t done= 0;
+    uint32_t last_tick= 0;
+    bool finished[k_max_actuators]= {false};
+    uint32_t ticks= move_ticks(b);
+    struct { int64_t rate, acceleration, jerk; uint8_t phase; } ramp[k_max_actuators];
+    for (uint8_t i = 0; i < b.n_active_motors; i++) {
+        ramp[i].rate= (int64_t)b.tick_info[i].steps_per_tick << 32;
+        ramp[i].acceleration= 0;
+        ramp[i].jerk= b.tick_info[i].accel_jerk;
+        ramp[i].phase= 0;
+    }
+
+    // the rates are run on to the end of the deceleration even once a motor is done, for the distance
+    for (uint32_t tick = 0; done < b.n_active_motors || tick <= b.total_move_ticks; ++tick) {
+        for (uint8_t i = 0; i < b.n_active_motors; i++) {
+            Block::tickinfo_t &ti= b.tick_info[i];
+
+            if(b.s_curve) {
+                while(tick >= ti.next_accel_event) {
+                    switch(++ramp[i].phase) {
+                        case 1: case 3: case 5: ramp[i].jerk= 0; break;
+                        case 2: ramp[i].jerk= -ti.accel_jerk; break;
+                        case 4: ramp[i].jerk= -ti.decel_jerk; break;
+                        case 6: ramp[i].jerk= ti.decel_jerk; break;
+                    }
+                    if(ramp[i].phase == 3) {
+                        ramp[i].acceleration= 0;
+                        ramp[i].rate= (int64_t)ti.plateau_rate << 32;
+                    }
+                    ti.next_accel_event= b.s_curve_phase_end(ramp[i].phase);
+                }
+                ramp[i].acceleration += ramp[i].jerk;
+                if(ti.motor == 0) res.peak_acceleration= std::max(res.peak_acceleration, std::abs(ramp[i].acceleration));
+                ramp[i].rate += ramp[i].acceleration;
+
+            } else {
+                ramp[i].rate += ti.acceleration_change;
+                if(tick == ti.next_accel_event) {
+                    if(tick == b.accelerate_until) {
+                        ti.acceleration_change= 0;
+                        ramp[i].rate= (int64_t)ti.plateau_rate << 32;
+                        if(b.decelerate_after < b.total_move_ticks) ti.next_accel_event= b.decelerate_after;
+                    }
+                    if(tick == b.decelerate_after) ti.acceleration_change= ti.deceleration_change;
+                }
+            }
+            ti.steps_per_tick= (ramp[i].rate + 0xFFFFFFFFLL) >> 32;
+
+            if(ti.motor == 0) {
+                if(tick < ticks) res.distance += std::max(0, ti.steps_per_tick);
+                if(b.accelerate_until > 0 && tick == b.accelerate_until - 1) res.rate_at_accel_end= ti.steps_per_tick;
+                if(tick == b.total_move_ticks) res.rate_at_decel_end= ti.steps_per_tick;
+            }
+
+            if(finished[i]) continue;
+            if(ti.steps_per_tick <= 0) {
+                if(tick >= b.decelerate_after) {
+                    ti.counter = STEPTICKER_FPSCALE;
+                    res.forced= true;
+                }
+                ti.steps_per_tick = 0;
+            }
+            ti.counter += ti.steps_per_tick;
+            while(ti.counter >= STEPTICKER_FPSCALE && ti.step_count < ti.steps_to_move) {
+                ti.counter -= STEPTICKER_FPSCALE;
+                ++ti.step_count;
+                if(ti.motor == 0) res.last_step= tick;
+            }
+            if(ti.step_count == ti.steps_to_move) {
+                finished[i]= true;
+                ++done;
+                last_tick= tick;
+            }
+        }
+    }
+    res.ticks= last_tick + 1;
+    return res;
+}
+
+static void usage(const char *prog)
+{
+    fprintf(stderr, "Usage: %s [-c config] [-s setting=value]... [-n blocks] [-r seed] [-v]\n", prog);
+    fprintf(stderr, "  -c config          configuration to load (default %s), for the step ticker frequency\n", SIM_DEFAULT_CONFIG);
+    fprintf(stderr, "  -s setting=value   override a config setting, eg -s base_stepping_frequency=50000\n");
+    fprintf(stderr, "  -n blocks          number of random blocks to test (default 10000)\n");
+    fprintf(stderr, "  -r seed            random seed (default 1)\n");
+    fprintf(stderr, "  -v                 print every failure, not just the first 10\n");
+}
+
+int main(int argc, char *argv[])
+{
+    const char *config_fn= SIM_DEFAULT_CONFIG;
+    std::vector<const char*> settings;
+    uint32_t n_blocks= 10000;
+    uint32_t seed= 1;
+    bool verbose= false;
+
+    int c;
+    while((c= getopt(argc, argv, "c:s:n:r:vh")) != -1) {
+        switch(c) {
+            case 'c': config_fn= optarg; break;
+            case 's': settings.push_back(optarg); break;
+            case 'n': n_blocks= strtoul(optarg, nullptr, 10); break;
+            case 'r': seed= strtoul(optarg, nullptr, 10); break;
+            case 'v': verbose= true; break;
+            default: usage(argv[0]); return 1;
+        }
+    }
+
+    std::string config;
+    FILE *fp= fopen(config_fn, "r");
+    if(fp == nullptr) {
+        fprintf(stderr, "could not read config file %s\n", config_fn);
+        return 1;
+    }
+    char buf[4096];
+    size_t n;
+    while((n= fread(buf, 1, sizeof(buf), fp)) > 0) config.append(buf, n);
+    fclose(fp);
+    for(auto s : settings) {
+        if(!sim_override_setting(config, s)) {
+            fprintf(stderr, "bad setting %s, expected setting=value\n", s);
+            return 1;
+        }
+    }
+
+    sim_set_config(config.data(), config.data() + config.size());
+    new Kernel();
+    Block::n_actuators= 3;
+    real frequency= THEKERNEL->step_ticker->get_frequency();
+    real max_ticks= 3 * frequency;
+
+    std::mt19937 rng(seed);
+    auto uniform= [&rng](real lo, real hi) { return lo + (hi - lo) * std::uniform_real_distribution<double>(0, 1)(rng); };
+    auto log_uniform= [&uniform](real lo, real hi) { return expl(uniform(logl(lo), logl(hi))); };
+
+    uint32_t failures= 0, forced= 0, s_curves= 0;
+    real worst_boundary= 0, worst_total= 0, worst_position= 0, worst_peak= 0;
+    for (uint32_t i = 0; i < n_blocks; ++i) {
+        Block b;
+        b.clear();
+
+        // a move of a few steps up to millions, with up to two other motors moving some of the way
+        real steps_per_mm= log_uniform(5, 3200);
+        b.steps_event_count= std::max(1.0L, roundl(log_uniform(1, 4e6)));
+        b.millimeters= b.steps_event_count / steps_per_mm;
+        b.steps[0]= b.steps_event_count;
+        b.steps[1]= (rng() % 2) ? rng() % (b.steps_event_count + 1) : 0;
+        b.steps[2]= (rng() % 4 == 0) ? rng() % (b.steps_event_count + 1) : 0;
+
+        // no faster than the step ticker can go
+        real max_speed= frequency * 0.95L / steps_per_mm;
+        b.nominal_speed= std::min(log_uniform(0.1, 1000), max_speed);
+        b.nominal_rate= b.nominal_speed * steps_per_mm;
+        b.acceleration= log_uniform(1, 50000);
+        b.jerk= (i % 4 == 3) ? log_uniform(100, 1e6) : 0;
+
+        // entry and exit speeds the planner could have given, the exit reachable from the entry over the block
+        real reach= sqrtl(2 * (real)b.acceleration * b.millimeters);
+        real entry= (rng() % 3 == 0) ? 0 : uniform(0, b.nominal_speed);
+        real exit_max= std::min((real)b.nominal_speed, sqrtl(entry * entry + reach * reach));
+        if(b.jerk > 0) exit_max= std::min((real)b.nominal_speed, (real)b.max_allowable_speed(-b.acceleration, entry, b.millimeters));
+        real exit= (rng() % 3 == 0) ? 0 : uniform(0, exit_max);
+        if(entry * entry > exit * exit + reach * reach) entry= sqrtl(exit * exit + reach * reach);
+        if(b.jerk > 0) entry= std::min(entry, (real)b.max_allowable_speed(-b.acceleration, exit, b.millimeters));
+
+        // keep to moves of up to a few seconds or the test takes too long
+        Reference ref= reference(b, entry, exit, frequency);
+        if(ref.accel_ticks + ref.plateau_ticks + ref.decel_ticks > max_ticks) {
+            --i;
+            continue;
+        }
+
+        b.calculate_trapezoid(entry, exit);
+        if(b.s_curve) ++s_curves;
+        Result res= run(b);
+        if(res.forced) ++forced;
+
+        uint32_t ticks= move_ticks(b);
+        // the ramps are rounded to whole ticks, which moves the end of the move by up to a tick, the step ticker needs a tick
+        // of plateau the reference may not have, and the rates are rounded up to 2.30 which on a slow move adds up to a few more
+        real total_ticks= ref.accel_ticks + ref.plateau_ticks + ref.decel_ticks;
+        real accel_error= fabsl(b.accelerate_until - ref.accel_ticks);
+        real decel_error= fabsl((b.total_move_ticks - b.decelerate_after) - ref.decel_ticks);
+        real total_error= fabsl(ticks - total_ticks);
+        real resolution= total_ticks / b.maximum_rate_fp;
+        // the rates the ramps run between come from the planner in single precision and are rounded to 2.30, so on a very
+        // slow acceleration the ramps can be a few ticks out
+        real rate_resolution= (1 + 2 * FLT_EPSILON * STEPTICKER_FPSCALE * ref.maximum_rate) / STEPTICKER_FPSCALE;
+        real ramp_resolution= rate_resolution / ref.accel;
+        // an S-curve ramp's length goes as the square root of a rate change too small to reach the acceleration, so a
+        // close entry and exit rate can be out by many ticks, or have no ramp at all
+        if(b.jerk > 0) ramp_resolution= s_curve_ticks(rate_resolution, ref.accel, ref.jerk);
+        worst_boundary= std::max(worst_boundary, std::max(accel_error, decel_error));
+        worst_total= std::max(worst_total, total_error);
+
+        // S-curve ramps have their own rounding in the jerk, allow a little more. With no acceleration ramp the two ticks of
+        // plateau the step ticker needs can come out of the deceleration ramp
+        real allowed= (b.s_curve ? 3 : 1.5L) + ramp_resolution;
+        real decel_allowed= allowed + (b.accelerate_until == 0 ? 2 : 0);
+
+        // the ramps rounded to whole ticks can cover more than the steps on their own, on a short move with close entry
+        // and exit rates, then the plateau is held at the rate at the end of a ramp
+        bool held= b.maximum_rate_fp <= std::max(b.accelerate_until > 0 ? b.initial_rate_fp : 0, b.final_rate_fp);
+
+        // the rates over the ticks of the move add up to the steps, and go over by at most the rounding up of the rates,
+        // or when held by that rate for the few ticks the move then ends early
+        int64_t distance_error= res.distance - ((int64_t)b.steps_event_count << 30);
+        real jerk_rounding= 0;
+        if(b.s_curve) {
+            // and by the rounding up of the jerk, which adds up over a long ramp
+            real na= b.accelerate_until, nd= b.total_move_ticks - b.decelerate_after;
+            jerk_rounding= (na * na * na + nd * nd * nd) / (3 * 4294967296.0L);
+        }
+        bool distance_ok= distance_error >= 0 && distance_error <= 2 * (int64_t)ticks + 1 + jerk_rounding + (held ? (allowed + 2) * b.maximum_rate_fp : 0);
+
+        // how far the reference has got when the last step is issued, the step is issued on the tick that covers it so
+        // compare with the end of that tick. The last steps of a move that stops are far apart so this is compared in
+        // steps, not ticks: the end can move by the ramp rounding, at the rate at the end.
+        // The reference position is a trapezoid, which an S-curve only meets at the ends of its ramps, so those are left to the
+        // distance check
+        real position_error= b.jerk > 0 ? 0 : fabsl(b.steps_event_count - ref.position(res.last_step + 1));
+        real position_allowed= (allowed + 1 + resolution) * (ref.final_rate + (allowed + 1 + resolution) * ref.accel) + 1e-3L + (held ? (allowed + 2) * fromfp(b.maximum_rate_fp) : 0);
+        worst_position= std::max(worst_position, position_error);
+
+        // the trapezoid's ramps are worked out in 2.62 so end on their rates, rounded up to 2.30
+        bool rates_ok= true;
+        if(!b.s_curve) {
+            int32_t plateau_fp= b.tick_info[0].plateau_rate, final_fp= b.final_rate_fp;
+            if(b.accelerate_until > 0 && (res.rate_at_accel_end < plateau_fp || res.rate_at_accel_end > plateau_fp + 1)) rates_ok= false;
+            if(b.total_move_ticks > b.decelerate_after && res.ticks > b.total_move_ticks && (res.rate_at_decel_end < final_fp || res.rate_at_decel_end > final_fp + 1)) rates_ok= false;
+        }
+        // the plateau rate fits the steps into whole ticks of ramp, so can be out by the acceleration over a tick or so, by
+        // the rounding of the whole move to ticks and by the tick of plateau the step ticker needs, two with no acceleration.
+        // On a move that is mostly ramps the plateau rate only counts for about half of the distance, which doubles that
+        real rate_error= fabsl(fromfp(b.maximum_rate_fp) - ref.maximum_rate);
+        if(!held && rate_error > 2 * ref.accel + 2 * ref.maximum_rate * (fabsl(res.ticks - total_ticks) + (b.accelerate_until > 0 ? 2 : 4)) / std::max((real)1, total_ticks)) rates_ok= false;
+
+        // the S-curve's peak acceleration is the block's at most, less when the jerk is too low to reach it
+        real peak= b.s_curve ? (real)res.peak_acceleration / (STEPTICKER_FP62SCALE * ref.accel) : 0;
+        worst_peak= std::max(worst_peak, peak);
+        bool peak_ok= peak <= 1.001L;
+
+        bool ok= !res.forced && rates_ok && peak_ok && accel_error <= allowed && decel_error <= decel_allowed && total_error <= allowed + 2 + resolution && distance_ok && position_error <= position_allowed;
+        if(!ok) {
+            if(failures < 10 || verbose) {
+                printf("FAIL block %lu: steps %lu/%lu/%lu nominal %1.6f mm/s %1.3f steps/s acc %1.3f jerk %1.1f entry %1.6Lf exit %1.6Lf\n",
+                       (unsigned long)i, (unsigned long)b.steps[0], (unsigned long)b.steps[1], (unsigned long)b.steps[2],
+                       b.nominal_speed, b.nominal_rate, b.acceleration, b.jerk, entry, exit);
+                printf("  ticks accel %lu decel_after %lu total %lu finished %lu jerk %lu/%lu, reference accel %1.3Lf plateau %1.3Lf decel %1.3Lf\n",
+                       (unsigned long)b.accelerate_until, (unsigned long)b.decelerate_after, (unsigned long)b.total_move_ticks, (unsigned long)res.ticks,
+                       (unsigned long)b.accel_jerk_ticks, (unsigned long)b.decel_jerk_ticks,
+                       ref.accel_ticks, ref.plateau_ticks, ref.decel_ticks);
+                printf("  rates: accel end %ld max %ld decel end %ld final %ld plateau %ld acc %ld dec %ld\n", (long)res.rate_at_accel_end, (long)b.maximum_rate_fp,
+                       (long)res.rate_at_decel_end, (long)b.final_rate_fp, (long)b.tick_info[0].plateau_rate, (long)b.tick_info[0].acceleration_change, (long)b.tick_info[0].deceleration_change);
+                printf("  distance %1.9Lf rate error %1.9Lf, forced %d rates %s, errors accel %1.3Lf decel %1.3Lf total %1.3Lf ticks, last step %1.6Lf steps, peak acceleration %1.6Lf\n",
+                       fromfp(res.distance), rate_error, res.forced, rates_ok ? "ok" : "wrong", accel_error, decel_error, total_error, position_error, peak);
+            }
+            ++failures;
+        }
+    }
+
+    printf("%lu blocks (%lu S-curve) at %1.0Lf Hz: %lu failed, %lu had steps forced out, worst errors: ramps %1.3Lf ticks, total %1.3Lf ticks, last step %1.6Lf steps, S-curve peak acceleration %1.4Lf of the block's\n",
+           (unsigned long)n_blocks, (unsigned long)s_curves, frequency, (unsigned long)failures, (unsigned long)forced,
+           worst_boundary, worst_total, worst_position, worst_peak);
+
+    return failures > 0 ? 1 : 0;
+}
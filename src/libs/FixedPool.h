@@ -0,0 +1,61 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef FIXEDPOOL_H
+#define FIXEDPOOL_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+/*
+ * A pool of a fixed number of fixed size slots, for objects that are made and freed all the time and would otherwise
+ * fragment the heap. Allocating is finding a clear bit, so it takes the same time whatever has been allocated before.
+ *
+ * It needs no constructor, all zeros is an empty pool, so it can be placed in the AHB banks with
+ * __attribute__ ((section ("AHBSRAM1"))) which are zeroed at startup.
+ * Not interrupt safe, use it from the main loop only.
+ */
+template<size_t slot_size, int slots> class FixedPool {
+    public:
+        // nullptr if all the slots are in use or n is more than a slot holds
+        void *alloc(size_t n);
+        void dealloc(void *p);
+        bool has(const void *p) const { return p >= storage && p < storage + sizeof(storage); }
+
+        int used() const { return __builtin_popcount(in_use); }
+        int max_used() const { return high_water; }
+        static int size() { return slots; }
+
+    private:
+        static_assert(slots <= 32, "FixedPool keeps the slots in use in a 32 bit mask");
+        static const size_t stride= (slot_size + 7) & ~7; // keep every slot 8 byte aligned
+
+        uint8_t storage[stride * slots] __attribute__ ((aligned(8)));
+        uint32_t in_use;
+        uint8_t high_water;
+};
+
+template<size_t slot_size, int slots> void *FixedPool<slot_size, slots>::alloc(size_t n)
+{
+    uint32_t free_slots= ~in_use;
+    if(slots < 32) free_slots &= (1UL << slots) - 1;
+    if(n > slot_size || free_slots == 0) return nullptr;
+
+    int i= __builtin_ctz(free_slots);
+    in_use |= 1UL << i;
+    int u= used();
+    if(u > high_water) high_water= u;
+    return storage + i * stride;
+}
+
+template<size_t slot_size, int slots> void FixedPool<slot_size, slots>::dealloc(void *p)
+{
+    int i= ((uint8_t *)p - storage) / stride;
+    in_use &= ~(1UL << i);
+}
+
+#endif
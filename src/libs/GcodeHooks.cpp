@@ -0,0 +1,85 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "GcodeHooks.h"
+#include "Module.h"
+#include "Gcode.h"
+
+#include <algorithm>
+
+const uint16_t GcodeHooks::any_code;
+
+uint16_t GcodeHooks::order_of(Module *module)
+{
+    auto i= std::find(modules.begin(), modules.end(), module);
+    if(i != modules.end()) return i - modules.begin();
+    modules.push_back(module);
+    return modules.size() - 1;
+}
+
+void GcodeHooks::insert(uint16_t key, Module *module)
+{
+    hook_t h{key, order_of(module), module};
+    auto i= std::lower_bound(hooks.begin(), hooks.end(), h, [](const hook_t &a, const hook_t &b) { return a.key < b.key || (a.key == b.key && a.order < b.order); });
+    if(i != hooks.end() && i->key == h.key && i->module == module) return; // already there
+    hooks.insert(i, h);
+}
+
+// every Gcode
+void GcodeHooks::add(Module *module)
+{
+    insert(any_code, module);
+}
+
+// just G<code> or M<code>
+void GcodeHooks::add(Module *module, char letter, uint16_t code)
+{
+    if(code >= 0x8000) {
+        // does not fit in a key, so it has to look at them all
+        add(module);
+        return;
+    }
+    insert(key(letter, code), module);
+}
+
+void GcodeHooks::remove(Module *module)
+{
+    hooks.erase(std::remove_if(hooks.begin(), hooks.end(), [module](const hook_t &h) { return h.module == module; }), hooks.end());
+    // leave its place empty so the order of the others does not change, if it comes back it goes at the end
+    std::replace(modules.begin(), modules.end(), module, (Module *)nullptr);
+}
+
+void GcodeHooks::dispatch(Gcode *gcode) const
+{
+    auto by_key= [](const hook_t &h, uint16_t k) { return h.key < k; };
+    auto any= std::lower_bound(hooks.begin(), hooks.end(), any_code, by_key);
+
+    // the few Gcodes with no G or M, or with both, go to every module as they all check for themselves
+    if(gcode->has_g == gcode->has_m || (gcode->has_g ? gcode->g : gcode->m) >= 0x8000) {
+        for (auto m : modules) {
+            if(m != nullptr) m->on_gcode_received(gcode);
+        }
+        return;
+    }
+
+    // merge the modules that want this code with those that want everything, in order
+    uint16_t k= gcode->has_g ? key('G', gcode->g) : key('M', gcode->m);
+    auto a= std::lower_bound(hooks.begin(), any, k, by_key);
+    auto b= any;
+    while(true) {
+        bool more_a= a != any && a->key == k;
+        bool more_b= b != hooks.end();
+        if(!more_a && !more_b) break;
+
+        if(more_a && (!more_b || a->order <= b->order)) {
+            if(more_b && a->order == b->order) ++b; // registered both ways, only call it once
+            (a++)->module->on_gcode_received(gcode);
+        } else {
+            (b++)->module->on_gcode_received(gcode);
+        }
+    }
+}
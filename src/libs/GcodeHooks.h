@@ -0,0 +1,43 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef GCODEHOOKS_H
+#define GCODEHOOKS_H
+
+#include <stdint.h>
+#include <vector>
+
+class Module;
+class Gcode;
+
+// The modules that handle Gcodes, indexed by the G or M code they want so ON_GCODE_RECEIVED only calls those, rather
+// than every module looking at every Gcode to see if it is one of its own.
+// A module that needs to see every Gcode still can, register_for_event(ON_GCODE_RECEIVED) puts it here for all of them.
+// Either way the modules are called in the order they first registered, as they always have been.
+class GcodeHooks {
+    public:
+        void add(Module *module);
+        void add(Module *module, char letter, uint16_t code);
+        void remove(Module *module);
+        void dispatch(Gcode *gcode) const;
+
+    private:
+        static const uint16_t any_code= 0xFFFF;
+        static uint16_t key(char letter, uint16_t code) { return letter == 'M' ? (0x8000 | code) : code; }
+        uint16_t order_of(Module *module);
+        void insert(uint16_t key, Module *module);
+
+        struct hook_t {
+            uint16_t key;
+            uint16_t order;
+            Module *module;
+        };
+        std::vector<hook_t> hooks; // sorted by key then order
+        std::vector<Module*> modules; // every module handling Gcodes, its index is its order, nullptr once removed
+};
+
+#endif
@@ -28,6 +28,7 @@
 #include "EndstopsPublicAccess.h"
 #include "Configurator.h"
 #include "SimpleShell.h"
+#include "utils.h"
 
 #include "platform_memory.h"
 
@@ -40,9 +41,12 @@
 
 #define base_stepping_frequency_checksum            CHECKSUM("base_stepping_frequency")
 #define microseconds_per_step_pulse_checksum        CHECKSUM("microseconds_per_step_pulse")
+#define max_steps_per_tick_checksum                 CHECKSUM("max_steps_per_tick")
 #define disable_leds_checksum                       CHECKSUM("leds_disable")
 #define grbl_mode_checksum                          CHECKSUM("grbl_mode")
 #define ok_per_line_checksum                        CHECKSUM("ok_per_line")
+#define status_report_feedrate_checksum             CHECKSUM("status_report_feedrate")
+#define status_report_buffers_checksum              CHECKSUM("status_report_buffers")
 
 Kernel* Kernel::instance;
 
@@ -108,6 +112,10 @@ Kernel::Kernel(){
     // we exepct ok per line now not per G code, setting this to false will return to the old (incorrect) way of ok per G code
     this->ok_per_line= this->config->value( ok_per_line_checksum )->by_default(true)->as_bool();
 
+    // extra fields in the status report for hosts that poll it to follow the job
+    this->report_feedrate= this->config->value( status_report_feedrate_checksum )->by_default(false)->as_bool();
+    this->report_buffers= this->config->value( status_report_buffers_checksum )->by_default(false)->as_bool();
+
     this->add_module( this->serial );
 
     // HAL stuff
@@ -122,12 +130,15 @@ Kernel::Kernel(){
     NVIC_SetPriority(TIMER0_IRQn, 2);
     NVIC_SetPriority(TIMER1_IRQn, 1);
     NVIC_SetPriority(TIMER2_IRQn, 4);
-    NVIC_SetPriority(PendSV_IRQn, 3);
 
     // Set other priorities lower than the timers
     NVIC_SetPriority(ADC_IRQn, 5);
     NVIC_SetPriority(USB_IRQn, 5);
 
+    // PendSV works out trapezoids and makes arc chords through the kinematics for the step ticker, see StepTicker::handle_finish().
+    // That is too slow to hold up the comms interrupts for, so it is below them as well as the timers, and only above the main loop
+    NVIC_SetPriority(PendSV_IRQn, 6);
+
     // If MRI is enabled
     if( MRI_ENABLE ){
         if( NVIC_GetPriority(UART0_IRQn) > 0 ){ NVIC_SetPriority(UART0_IRQn, 5); }
@@ -147,7 +158,12 @@ Kernel::Kernel(){
 
     // Configure the step ticker
     this->step_ticker->set_frequency( this->base_stepping_frequency );
-    this->step_ticker->set_unstep_time( microseconds_per_step_pulse );
+    if(!this->step_ticker->set_unstep_time( microseconds_per_step_pulse )) {
+        this->streams->printf("WARNING: microseconds_per_step_pulse is longer than a tick at base_stepping_frequency\n");
+    }
+    if(!this->step_ticker->set_max_steps_per_tick( this->config->value(max_steps_per_tick_checksum)->by_default(1)->as_int() )) {
+        this->streams->printf("WARNING: max_steps_per_tick 2 needs three step pulses to fit in a tick at base_stepping_frequency, stepping once per tick\n");
+    }
 
     // Core modules
     this->add_module( this->conveyor       = new Conveyor()      );
@@ -160,61 +176,75 @@ Kernel::Kernel(){
 }
 
 // return a GRBL-like query string for serial ?
-std::string Kernel::get_query_string()
+// written straight into a fixed buffer with no strings built and no printf of floats, so it can be polled often
+size_t Kernel::get_query_string(char *buf, size_t size, StreamOutput *stream)
 {
-    std::string str;
     bool homing;
     bool ok = PublicData::get_value(endstops_checksum, get_homing_status_checksum, 0, &homing);
     if(!ok) homing= false;
     bool running= false;
 
-    str.append("<");
+    char *p= buf;
+    char *end= buf + size - 1;
+    auto append= [&p, end](const char *s) { while(*s && p < end) *p++= *s++; };
+    auto append_number= [&append](float v, int decimals) { char n[48]; format_fixed(n, v, decimals); append(n); };
+
+    append("<");
     if(halted) {
-        str.append("Alarm,");
+        append("Alarm,");
     }else if(homing) {
-        str.append("Home,");
+        append("Home,");
     }else if(feed_hold) {
-        str.append("Hold,");
+        append("Hold,");
     }else if(this->conveyor->is_idle()) {
-        str.append("Idle,");
+        append("Idle,");
     }else{
         running= true;
-        str.append("Run,");
+        append("Run,");
     }
 
+    float mpos[3];
     if(running) {
-        float mpos[3];
         robot->get_current_machine_position(mpos);
         // current_position/mpos includes the compensation transform so we need to get the inverse to get actual position
         if(robot->compensationTransform) robot->compensationTransform(mpos, true); // get inverse compensation transform
 
-        char buf[128];
-        // machine position
-        size_t n= snprintf(buf, sizeof(buf), "%1.4f,%1.4f,%1.4f,", robot->from_millimeters(mpos[0]), robot->from_millimeters(mpos[1]), robot->from_millimeters(mpos[2]));
-        str.append("MPos:").append(buf, n);
-
-        // work space position
-        Robot::wcs_t pos= robot->mcs2wcs(mpos);
-        n= snprintf(buf, sizeof(buf), "%1.4f,%1.4f,%1.4f", robot->from_millimeters(std::get<X_AXIS>(pos)), robot->from_millimeters(std::get<Y_AXIS>(pos)), robot->from_millimeters(std::get<Z_AXIS>(pos)));
-        str.append("WPos:").append(buf, n);
-        str.append(">\r\n");
-
     }else{
         // return the last milestone if idle
-        char buf[128];
-        // machine position
-        Robot::wcs_t mpos= robot->get_axis_position();
-        size_t n= snprintf(buf, sizeof(buf), "%1.4f,%1.4f,%1.4f,", robot->from_millimeters(std::get<X_AXIS>(mpos)), robot->from_millimeters(std::get<Y_AXIS>(mpos)), robot->from_millimeters(std::get<Z_AXIS>(mpos)));
-        str.append("MPos:").append(buf, n);
-
-        // work space position
-        Robot::wcs_t pos= robot->mcs2wcs(mpos);
-        n= snprintf(buf, sizeof(buf), "%1.4f,%1.4f,%1.4f", robot->from_millimeters(std::get<X_AXIS>(pos)), robot->from_millimeters(std::get<Y_AXIS>(pos)), robot->from_millimeters(std::get<Z_AXIS>(pos)));
-        str.append("WPos:").append(buf, n);
-        str.append(">\r\n");
+        robot->get_axis_position(mpos, 3);
+    }
+
+    // machine position
+    append("MPos:");
+    for (int i = 0; i < 3; ++i) {
+        append_number(robot->from_millimeters(mpos[i]), 4);
+        append(",");
+    }
 
+    // work space position
+    Robot::wcs_t pos= robot->mcs2wcs(mpos);
+    append("WPos:");
+    append_number(robot->from_millimeters(std::get<X_AXIS>(pos)), 4);
+    append(",");
+    append_number(robot->from_millimeters(std::get<Y_AXIS>(pos)), 4);
+    append(",");
+    append_number(robot->from_millimeters(std::get<Z_AXIS>(pos)), 4);
+
+    // as GRBL 0.9 has them, the feed rate per minute, the blocks queued and the bytes waiting to be read
+    if(report_feedrate) {
+        append(",F:");
+        append_number(running ? robot->from_millimeters(conveyor->get_current_feedrate() * 60.0F) : 0, 1);
+    }
+    if(report_buffers) {
+        append(",Buf:");
+        append_number(conveyor->get_queued_blocks(), 0);
+        append(",RX:");
+        append_number(stream == nullptr ? 0 : stream->rx_buffer_size() - stream->rx_buffer_free(), 0);
     }
-    return str;
+
+    append(">\r\n");
+    *p= '\0';
+    return p - buf;
 }
 
 // Add a module to Kernel. We don't actually hold a list of modules we just call its on_module_loaded
@@ -225,6 +255,7 @@ void Kernel::add_module(Module* module){
 // Adds a hook for a given module and event
 void Kernel::register_for_event(_EVENT_ENUM id_event, Module *mod){
     this->hooks[id_event].push_back(mod);
+    if(id_event == ON_GCODE_RECEIVED) this->gcode_hooks.add(mod);
 }
 
 // Call a specific event with an argument
@@ -236,8 +267,13 @@ void Kernel::call_event(_EVENT_ENUM id_event, void * argument){
     }
 
     // send to all registered modules
-    for (auto m : hooks[id_event]) {
-        (m->*kernel_callback_functions[id_event])(argument);
+    if(id_event == ON_GCODE_RECEIVED) {
+        // only to the modules that want this G or M code
+        gcode_hooks.dispatch(static_cast<Gcode *>(argument));
+    } else {
+        for (auto m : hooks[id_event]) {
+            (m->*kernel_callback_functions[id_event])(argument);
+        }
     }
 
     if(id_event == ON_HALT && this->halted && !was_idle) {
@@ -257,6 +293,7 @@ bool Kernel::kernel_has_event(_EVENT_ENUM id_event, Module *mod)
 
 void Kernel::unregister_for_event(_EVENT_ENUM id_event, Module *mod)
 {
+    if(id_event == ON_GCODE_RECEIVED) gcode_hooks.remove(mod);
     for (auto i = hooks[id_event].begin(); i != hooks[id_event].end(); ++i) {
         if(*i == mod) {
             hooks[id_event].erase(i);
@@ -13,6 +13,7 @@
 #define THEROBOT THEKERNEL->robot
 
 #include "Module.h"
+#include "GcodeHooks.h"
 #include <array>
 #include <vector>
 #include <string>
@@ -23,6 +24,7 @@ class Module;
 class Conveyor;
 class SlowTicker;
 class SerialConsole;
+class StreamOutput;
 class StreamOutputPool;
 class GcodeDispatch;
 class Robot;
@@ -42,6 +44,8 @@ class Kernel {
         void add_module(Module* module);
         void register_for_event(_EVENT_ENUM id_event, Module *module);
         void call_event(_EVENT_ENUM id_event, void * argument= nullptr);
+        // only call the module's on_gcode_received for G<code> or M<code>, letter is 'G' or 'M'
+        void register_for_gcode(char letter, uint16_t code, Module *module) { gcode_hooks.add(module, letter, code); }
 
         bool kernel_has_event(_EVENT_ENUM id_event, Module *module);
         void unregister_for_event(_EVENT_ENUM id_event, Module *module);
@@ -54,7 +58,9 @@ class Kernel {
         // void set_feed_hold(bool f) { feed_hold= f; }
         // bool get_feed_hold() const { return feed_hold; }
 
-        std::string get_query_string();
+        // the status report for ?, written into buf which should hold query_string_size, stream is the one asking
+        static const size_t query_string_size= 192;
+        size_t get_query_string(char *buf, size_t size, StreamOutput *stream= nullptr);
 
         // These modules are available to all other modules
         SerialConsole*    serial;
@@ -77,12 +83,16 @@ class Kernel {
     private:
         // When a module asks to be called for a specific event ( a hook ), this is where that request is remembered
         std::array<std::vector<Module*>, NUMBER_OF_DEFINED_EVENTS> hooks;
+        // ON_GCODE_RECEIVED is dispatched from here instead, by G or M code
+        GcodeHooks gcode_hooks;
         struct {
             bool use_leds:1;
             bool halted:1;
             bool grbl_mode:1;
             bool feed_hold:1;
             bool ok_per_line:1;
+            bool report_feedrate:1;
+            bool report_buffers:1;
         };
 
 };
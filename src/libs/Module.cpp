@@ -32,3 +32,8 @@ void Module::register_for_event(_EVENT_ENUM event_id){
     // You add things to Smoothie by making a new class that inherits the Module class. See http://smoothieware.org/moduleexample for a crude introduction
     THEKERNEL->register_for_event(event_id, this);
 }
+
+void Module::register_for_gcode(char letter, uint16_t code){
+    // only the Gcodes this module handles are dispatched to it, which matters when there are a lot of modules
+    THEKERNEL->register_for_gcode(letter, code, this);
+}
@@ -14,7 +14,10 @@ class CallbackStream : public StreamOutput {
         int puts(const char*);
         void inc() { use_count++; }
         void dec();
+        void retain() { inc(); }
+        void release() { dec(); }
         int get_count() { return use_count; }
+        bool is_closed() { return closed; }
         void mark_closed();
 
     private:
@@ -10,6 +10,7 @@
 #ifndef RINGBUFFER_H
 #define RINGBUFFER_H
 
+#include <string.h>
 
 template<class kind, int length> class RingBuffer {
     public:
@@ -20,6 +21,7 @@ template<class kind, int length> class RingBuffer {
         int          prev_block_index(int index);
         void         push_back(kind object);
         void         pop_front(kind &object);
+        void         pop_front(kind *objects, int n);
         kind*        get_head_ref();
         kind*        get_tail_ref();
         void         get( int index, kind &object);
@@ -110,6 +112,15 @@ template<class kind, int length> void RingBuffer<kind, length>::pop_front(kind &
     this->tail = (this->tail+1)&(length-1);
 }
 
+// take n off the front in one go, at most two copies as they may wrap around the end
+template<class kind, int length> void RingBuffer<kind, length>::pop_front(kind *objects, int n){
+    int first = length - this->tail;
+    if (first > n) first = n;
+    memcpy(objects, &this->buffer[this->tail], first * sizeof(kind));
+    memcpy(objects + first, &this->buffer[0], (n - first) * sizeof(kind));
+    this->tail = (this->tail + n)&(length-1);
+}
+
 template<class kind, int length> void RingBuffer<kind, length>::delete_tail(){
     //kind dummy;
     //this->pop_front(dummy);
@@ -15,6 +15,7 @@
 #include "StreamOutputPool.h"
 #include "Block.h"
 #include "Conveyor.h"
+#include "StreamOutput.h"
 
 #include "system_LPC17xx.h" // mbed.h lib
 #include <math.h>
@@ -29,6 +30,13 @@ GPIO stepticker_debug_pin(STEPTICKER_DEBUG_PIN);
 #define SET_STEPTICKER_DEBUG_PIN(n)
 #endif
 
+#ifdef STEPTICKER_TIMELINE
+// record every step, the timer count gives how far into the tick it was issued
+#define TIMELINE_STEP(m) timeline.add_step(timeline_tick, LPC_TIM0->TC, m, motor[m]->which_direction())
+#else
+#define TIMELINE_STEP(m)
+#endif
+
 StepTicker *StepTicker::instance;
 
 StepTicker::StepTicker()
@@ -50,7 +58,10 @@ StepTicker::StepTicker()
     this->set_unstep_time(100);
 
     this->unstep.reset();
+    this->restep.reset();
     this->num_motors = 0;
+    this->max_steps_per_tick = 1;
+    this->restepping = false;
 
     this->running = false;
     this->current_block = nullptr;
@@ -85,23 +96,66 @@ void StepTicker::set_frequency( float frequency )
 }
 
 // Set the reset delay, must be called after set_frequency
-void StepTicker::set_unstep_time( float microseconds )
+// false if the pulse would not end before the next tick
+bool StepTicker::set_unstep_time( float microseconds )
 {
-    uint32_t delay = floorf((SystemCoreClock / 4.0F) * (microseconds / 1000000.0F)); // SystemCoreClock/4 = Timer increments in a second
-    LPC_TIM1->MR0 = delay;
+    this->unstep_delay = floorf((SystemCoreClock / 4.0F) * (microseconds / 1000000.0F)); // SystemCoreClock/4 = Timer increments in a second
+    LPC_TIM1->MR0 = this->unstep_delay;
+    return this->unstep_delay < this->period;
+}
 
-    // TODO check that the unstep time is less than the step period, if not slow down step ticker
+// Set how many steps a motor can be given in one tick, 1 or 2, must be called after set_unstep_time
+// with 2 a motor can step at up to twice the base stepping frequency, the second step is issued from the unstep interrupt.
+// The unstep, the second step and its unstep each take a pulse width and must all be done before the next tick, if they
+// are not it steps once per tick and returns false
+bool StepTicker::set_max_steps_per_tick( uint8_t n )
+{
+    this->max_steps_per_tick = 1;
+    if(n < 2) return true;
+    if(3 * this->unstep_delay >= this->period) return false;
+    this->max_steps_per_tick = 2;
+    return true;
+}
+
+// The fastest a motor can step in steps/sec
+// steps_per_tick is 2.30 fixed point so it has to stay just under 2.0 when stepping twice per tick
+float StepTicker::get_max_step_rate() const
+{
+    return (max_steps_per_tick > 1) ? frequency * 1.99F : frequency;
 }
 
 // Reset step pins on any motor that was stepped
+// when motors are due a second step this tick, this runs twice more: once the pins have been low for the pulse time
+// to issue the second steps, and again to reset them
 void StepTicker::unstep_tick()
 {
+    if(this->restepping) {
+        this->restepping= false;
+        for (int i = 0; i < num_motors; i++) {
+            if(this->restep[i]) {
+                this->motor[i]->step();
+                TIMELINE_STEP(i);
+            }
+        }
+        this->unstep= this->restep;
+        this->restep.reset();
+        LPC_TIM1->TCR = 3;
+        LPC_TIM1->TCR = 1;
+        return;
+    }
+
     for (int i = 0; i < num_motors; i++) {
         if(this->unstep[i]) {
             this->motor[i]->unstep();
         }
     }
     this->unstep.reset();
+
+    if(this->restep.any()) {
+        this->restepping= true;
+        LPC_TIM1->TCR = 3;
+        LPC_TIM1->TCR = 1;
+    }
 }
 
 extern "C" void TIMER1_IRQHandler (void)
@@ -123,18 +177,32 @@ extern "C" void PendSV_Handler(void)
     StepTicker::getInstance()->handle_finish();
 }
 
-// slightly lower priority than TIMER0, the whole end of block/start of block is done here allowing the timer to continue ticking
+// below the timers and the comms interrupts, see Kernel, the work the step ticker needs done ahead of it that is too slow for the tick
 void StepTicker::handle_finish (void)
 {
+    // the trapezoids and the chords of an arc for the step ticker to run next
+    THECONVEYOR->prepare_next_blocks();
+    THECONVEYOR->fill_chords();
+
     // all moves finished signal block is finished
     if(finished_fnc) finished_fnc();
 }
 
+// have handle_finish() run from PendSV as soon as the interrupts above it return
+void StepTicker::pend_finish()
+{
+    SCB->ICSR = 0x10000000; // PENDSVSET, NVIC_SetPendingIRQ() does not work for PendSV
+}
+
 // step clock
 void StepTicker::step_tick (void)
 {
     //SET_STEPTICKER_DEBUG_PIN(running ? 1 : 0);
 
+#ifdef STEPTICKER_TIMELINE
+    ++timeline_tick;
+#endif
+
     // if nothing has been setup we ignore the ticks
     if(!running){
         // check if anything new available
@@ -153,51 +221,84 @@ void StepTicker::step_tick (void)
         return;
     }
 
+#ifdef STEPTICKER_TIMELINE
+    if(current_tick == 0) timeline.add_block(timeline_tick, current_block);
+#endif
+
     bool still_moving= false;
-    // foreach motor, if it is active see if time to issue a step to that motor
-    for (uint8_t m = 0; m < num_motors; m++) {
-        if(current_block->tick_info[m].steps_to_move == 0) continue; // not active
-
-        current_block->tick_info[m].steps_per_tick += current_block->tick_info[m].acceleration_change;
-
-        if(current_tick == current_block->tick_info[m].next_accel_event) {
-            if(current_tick == current_block->accelerate_until) { // We are done accelerating, deceleration becomes 0 : plateau
-                current_block->tick_info[m].acceleration_change = 0;
-                if(current_block->decelerate_after < current_block->total_move_ticks) {
-                    current_block->tick_info[m].next_accel_event = current_block->decelerate_after;
-                    if(current_tick != current_block->decelerate_after) { // We are plateauing
-                        // steps/sec / tick frequency to get steps per tick
-                        current_block->tick_info[m].steps_per_tick = current_block->tick_info[m].plateau_rate;
+    // foreach motor that has steps in this block, see if time to issue a step to that motor
+    for (uint8_t i = 0; i < current_block->n_active_motors; i++) {
+        Block::tickinfo_t &ti= current_block->tick_info[i];
+        if(ti.steps_to_move == 0) continue; // finished
+        uint8_t m= ti.motor;
+
+        if(current_block->s_curve) {
+            // jerk limited profile, the acceleration changes every tick and the rate follows it
+            while(current_tick >= ti.next_accel_event) {
+                next_s_curve_phase(i);
+            }
+            ramp[i].acceleration += ramp[i].jerk;
+            ramp[i].rate += ramp[i].acceleration;
+
+        } else {
+            ramp[i].rate += ti.acceleration_change;
+
+            if(current_tick == ti.next_accel_event) {
+                if(current_tick == current_block->accelerate_until) { // We are done accelerating, deceleration becomes 0 : plateau
+                    ti.acceleration_change = 0;
+                    // this tick is the first of the plateau, even when it is also the last, see Block::calculate_trapezoid()
+                    ramp[i].rate = (int64_t)ti.plateau_rate << 32;
+                    if(current_block->decelerate_after < current_block->total_move_ticks) {
+                        ti.next_accel_event = current_block->decelerate_after;
                     }
                 }
-            }
 
-            if(current_tick == current_block->decelerate_after) { // We start decelerating
-                current_block->tick_info[m].acceleration_change = current_block->tick_info[m].deceleration_change;
+                if(current_tick == current_block->decelerate_after) { // We start decelerating
+                    ti.acceleration_change = ti.deceleration_change;
+                }
             }
         }
+        ti.steps_per_tick = (ramp[i].rate + 0xFFFFFFFFLL) >> 32; // 2.62 to 2.30, rounded up as truncating would lose a little distance every tick
 
         // protect against rounding errors and such
-        if(current_block->tick_info[m].steps_per_tick <= 0) {
-            current_block->tick_info[m].counter = STEPTICKER_FPSCALE; // we force completion this step by setting to 1.0
-            current_block->tick_info[m].steps_per_tick = 0;
+        if(ti.steps_per_tick <= 0) {
+            // an S-curve starting from rest is slower than that for its first few ticks, so only once the move is slowing down
+            if(current_tick >= current_block->decelerate_after) ti.counter = STEPTICKER_FPSCALE; // we force completion this step by setting to 1.0
+            ti.steps_per_tick = 0;
         }
 
-        current_block->tick_info[m].counter += current_block->tick_info[m].steps_per_tick;
+        ti.counter += ti.steps_per_tick;
 
-        if(current_block->tick_info[m].counter >= STEPTICKER_FPSCALE) { // >= 1.0 step time
-            current_block->tick_info[m].counter -= STEPTICKER_FPSCALE; // -= 1.0F;
-            ++current_block->tick_info[m].step_count;
+        if(ti.counter >= STEPTICKER_FPSCALE) { // >= 1.0 step time
+            ti.counter -= STEPTICKER_FPSCALE; // -= 1.0F;
+            ++ti.step_count;
 
             // step the motor
             bool ismoving= motor[m]->step(); // returns false if the moving flag was set to false externally (probes, endstops etc)
+            TIMELINE_STEP(m);
             // we stepped so schedule an unstep
             unstep.set(m);
 
-            if(!ismoving || current_block->tick_info[m].step_count == current_block->tick_info[m].steps_to_move) {
+            if(!ismoving || ti.step_count == ti.steps_to_move) {
                 // done
-                current_block->tick_info[m].steps_to_move = 0;
+                ti.steps_to_move = 0;
                 motor[m]->stop_moving(); // let motor know it is no longer moving
+                continue;
+            }
+
+            if(ti.counter >= STEPTICKER_FPSCALE) { // a second step is due, only when stepping faster than the tick rate
+                ti.counter -= STEPTICKER_FPSCALE;
+                ++ti.step_count;
+                // the step is issued by the unstep interrupt once this one has been reset, see unstep_tick()
+                restep.set(m);
+
+                if(ti.step_count == ti.steps_to_move) {
+                    ti.steps_to_move = 0;
+                    motor[m]->stop_moving();
+                    // the block can't finish until the next tick, after the step has actually been issued
+                    still_moving= true;
+                    continue;
+                }
             }
         }
 
@@ -251,15 +352,23 @@ bool StepTicker::start_next_block()
 
     bool ok= false;
     // need to prepare each active motor
-    for (uint8_t m = 0; m < num_motors; m++) {
-        if(current_block->tick_info[m].steps_to_move == 0) continue;
+    for (uint8_t i = 0; i < current_block->n_active_motors; i++) {
+        Block::tickinfo_t &ti= current_block->tick_info[i];
+        if(ti.steps_to_move == 0) continue;
 
         ok= true; // mark at least one motor is moving
         // set direction bit here
         // NOTE this would be at least 10us before first step pulse.
         // TODO does this need to be done sooner, if so how without delaying next tick
-        motor[m]->set_direction(current_block->direction_bits[m]);
-        motor[m]->start_moving(); // also let motor know it is moving now
+        motor[ti.motor]->set_direction(current_block->direction_bits[ti.motor]);
+        motor[ti.motor]->start_moving(); // also let motor know it is moving now
+
+        ramp[i].rate = (int64_t)ti.steps_per_tick << 32; // 2.30 to 2.62
+        if(current_block->s_curve) {
+            ramp[i].acceleration = 0;
+            ramp[i].jerk = ti.accel_jerk;
+            ramp[i].phase = 0;
+        }
     }
 
     current_tick= 0;
@@ -278,6 +387,43 @@ bool StepTicker::start_next_block()
 }
 
 
+// move the given active motor on to the next phase of the S-curve, only called from the step tick ISR
+// the acceleration and rate carry on from the previous phase, except the plateau which starts at exactly the plateau rate
+void StepTicker::next_s_curve_phase(uint8_t m)
+{
+    Block::tickinfo_t &ti = current_block->tick_info[m];
+    switch(++ramp[m].phase) {
+        case 1: // constant acceleration
+        case 5: // constant deceleration
+            ramp[m].jerk = 0;
+            break;
+        case 2: // acceleration ramps down to 0
+            ramp[m].jerk = -ti.accel_jerk;
+            break;
+        case 3: // plateau
+            ramp[m].jerk = 0;
+            ramp[m].acceleration = 0;
+            ramp[m].rate = (int64_t)ti.plateau_rate << 32;
+            break;
+        case 4: // deceleration ramps up
+            ramp[m].jerk = -ti.decel_jerk;
+            break;
+        case 6: // deceleration ramps down to 0
+            ramp[m].jerk = ti.decel_jerk;
+            break;
+    }
+    ti.next_accel_event = current_block->s_curve_phase_end(ramp[m].phase);
+}
+
+#ifdef STEPTICKER_TIMELINE
+void StepTicker::print_timeline(StreamOutput *stream, bool header)
+{
+    // the subtick is in timer counts, period gives the counts per tick
+    if(header) stream->printf("# frequency %1.1f period %lu\n", frequency, (unsigned long)period);
+    timeline.print(stream);
+}
+#endif
+
 // returns index of the stepper motor in the array and bitset
 int StepTicker::register_motor(StepperMotor* m)
 {
@@ -17,28 +17,38 @@
 
 #include "ActuatorCoordinates.h"
 #include "TSRingBuffer.h"
+#include "StepTimeline.h"
 
 class StepperMotor;
 class Block;
+class StreamOutput;
 
 // handle 2.30 Fixed point
 #define STEPTICKER_FPSCALE (1<<30)
 #define STEPTICKER_TOFP(x) ((int32_t)roundf((float)(x)*STEPTICKER_FPSCALE))
 #define STEPTICKER_FROMFP(x) ((float)(x)/STEPTICKER_FPSCALE)
 
+// 2.62 fixed point for the S-curve, the jerk per tick is far too small for 2.30
+#define STEPTICKER_FP62SCALE (1LL<<62)
+#define STEPTICKER_TOFP62(x) ((int64_t)((float)(x)*(float)STEPTICKER_FP62SCALE))
+
 class StepTicker{
     public:
         StepTicker();
         ~StepTicker();
         void set_frequency( float frequency );
-        void set_unstep_time( float microseconds );
+        bool set_unstep_time( float microseconds );
+        bool set_max_steps_per_tick( uint8_t n );
+        float get_max_step_rate() const;
         int register_motor(StepperMotor* motor);
         float get_frequency() const { return frequency; }
         void unstep_tick();
+        bool is_unstep_pending() const { return unstep.any() || restep.any(); }
         const Block *get_current_block() const { return current_block; }
 
         void step_tick (void);
         void handle_finish (void);
+        void pend_finish();
         void start();
 
         // whatever setup the block should register this to know when it is done
@@ -46,21 +56,46 @@ class StepTicker{
 
         static StepTicker *getInstance() { return instance; }
 
+#ifdef STEPTICKER_TIMELINE
+        // prints and empties the step timeline, see StepTimeline.h
+        void print_timeline(StreamOutput *stream, bool header);
+#endif
+
     private:
         static StepTicker *instance;
 
         bool start_next_block();
+        void next_s_curve_phase(uint8_t m);
 
         float frequency;
         uint32_t period;
+        uint32_t unstep_delay;      // timer counts of a step pulse
         std::array<StepperMotor*, k_max_actuators> motor;
         std::bitset<k_max_actuators> unstep;
+        std::bitset<k_max_actuators> restep; // motors due a second step this tick
 
         Block *current_block;
         uint32_t current_tick{0};
 
+        // state of the ramps for each active motor of the current block, same order as its tick_info, 2.62 fixed point
+        // the rate is kept in 2.62 for the trapezoid too so a slow acceleration is not rounded to whole 2.30 steps per tick
+        struct ramp_t {
+            int64_t rate;           // steps/tick
+            int64_t acceleration;   // steps/tick², S-curve only
+            int64_t jerk;           // steps/tick³, S-curve only
+            uint8_t phase;          // S-curve only
+        };
+        std::array<ramp_t, k_max_actuators> ramp;
+
+#ifdef STEPTICKER_TIMELINE
+        StepTimeline timeline;
+        uint32_t timeline_tick{0}; // counts every tick, moving or not
+#endif
+
         struct {
             volatile bool running:1;
+            volatile bool restepping:1;
             uint8_t num_motors:4;
+            uint8_t max_steps_per_tick:2;
         };
 };
@@ -0,0 +1,95 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifdef STEPTICKER_TIMELINE
+
+#include "StepTimeline.h"
+
+#include "Block.h"
+#include "StreamOutput.h"
+
+StepTimeline::StepTimeline()
+{
+    steps_head= steps_tail= 0;
+    blocks_head= blocks_tail= 0;
+    dropped_steps= dropped_blocks= 0;
+}
+
+// single producer, the index is only moved on once the entry is written so the main loop never sees a partial entry
+void StepTimeline::add_step(uint32_t tick, uint16_t subtick, uint8_t motor, bool dir)
+{
+    uint32_t next= steps_head + 1;
+    if(next == STEPTICKER_TIMELINE) next= 0;
+    if(next == steps_tail) {
+        ++dropped_steps;
+        return;
+    }
+
+    step_t &s= steps[steps_head];
+    s.tick= tick;
+    s.subtick= subtick;
+    s.motor= motor;
+    s.dir= dir;
+    steps_head= next;
+}
+
+void StepTimeline::add_block(uint32_t tick, const Block *block)
+{
+    uint32_t next= blocks_head + 1;
+    if(next == STEPTICKER_TIMELINE_BLOCKS) next= 0;
+    if(next == blocks_tail) {
+        ++dropped_blocks;
+        return;
+    }
+
+    block_t &b= blocks[blocks_head];
+    b.tick= tick;
+    b.nominal_rate= block->nominal_rate;
+    b.nominal_speed= block->nominal_speed;
+    b.entry_speed= block->entry_speed;
+    b.exit_speed= block->exit_speed;
+    b.acceleration= block->acceleration;
+    b.millimeters= block->millimeters;
+    b.steps_event_count= block->steps_event_count;
+    b.steps= block->steps;
+    b.s_curve= block->s_curve;
+    blocks_head= next;
+}
+
+// B <tick> <nominal_rate> <nominal_speed> <entry_speed> <exit_speed> <acceleration> <millimeters> <steps_event_count> <s_curve> <steps>...
+// <tick> <motor> <+|-> <subtick>
+// blocks are printed before the steps on the same tick, as those belong to the block
+void StepTimeline::print(StreamOutput *stream)
+{
+    // only print what was there when we started, the ISR keeps adding
+    uint32_t shead= steps_head, bhead= blocks_head;
+
+    while(steps_tail != shead || blocks_tail != bhead) {
+        if(blocks_tail != bhead && (steps_tail == shead || blocks[blocks_tail].tick <= steps[steps_tail].tick)) {
+            const block_t &b= blocks[blocks_tail];
+            stream->printf("B %lu %1.6f %1.6f %1.6f %1.6f %1.6f %1.6f %lu %d", (unsigned long)b.tick, b.nominal_rate, b.nominal_speed, b.entry_speed, b.exit_speed,
+                           b.acceleration, b.millimeters, (unsigned long)b.steps_event_count, b.s_curve ? 1 : 0);
+            for (auto s : b.steps) {
+                stream->printf(" %lu", (unsigned long)s);
+            }
+            stream->printf("\n");
+            blocks_tail= (blocks_tail + 1 == STEPTICKER_TIMELINE_BLOCKS) ? 0 : blocks_tail + 1;
+
+        } else {
+            const step_t &s= steps[steps_tail];
+            stream->printf("%lu %u %c %u\n", (unsigned long)s.tick, s.motor, s.dir ? '-' : '+', s.subtick);
+            steps_tail= (steps_tail + 1 == STEPTICKER_TIMELINE) ? 0 : steps_tail + 1;
+        }
+    }
+
+    if(dropped_steps > 0 || dropped_blocks > 0) {
+        stream->printf("# dropped %lu steps %lu blocks\n", (unsigned long)dropped_steps, (unsigned long)dropped_blocks);
+        dropped_steps= dropped_blocks= 0;
+    }
+}
+
+#endif
@@ -0,0 +1,70 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#ifdef STEPTICKER_TIMELINE
+
+#include <stdint.h>
+#include <array>
+
+#include "ActuatorCoordinates.h"
+
+class Block;
+class StreamOutput;
+
+// number of blocks to hold, there are usually far fewer blocks than steps
+#ifndef STEPTICKER_TIMELINE_BLOCKS
+#define STEPTICKER_TIMELINE_BLOCKS 64
+#endif
+
+// Records every step the step ticker issues, and the parameters of the block it belongs to, so the step timing can be
+// analysed off line with sim/steptiming.py.
+// Only built when STEPTICKER_TIMELINE is set to the number of steps to hold, in src/makefile.
+// The step ticker ISR adds to it and the main loop empties it, when it is full new events are dropped and counted.
+class StepTimeline {
+    public:
+        StepTimeline();
+
+        // called from the step ticker ISR
+        void add_step(uint32_t tick, uint16_t subtick, uint8_t motor, bool dir);
+        void add_block(uint32_t tick, const Block *block);
+
+        // called from the main loop, prints what has been recorded so far in tick order and removes it
+        void print(StreamOutput *stream);
+
+    private:
+        using step_t = struct {
+            uint32_t tick;
+            uint16_t subtick;       // step ticker timer count when the step was issued, the ISR latency
+            uint8_t  motor;
+            bool     dir;           // direction pin as given to the motor, set is negative
+        };
+
+        // what is needed to work out the ideal trapezoid for the block
+        using block_t = struct {
+            uint32_t tick;
+            float    nominal_rate;
+            float    nominal_speed;
+            float    entry_speed;
+            float    exit_speed;
+            float    acceleration;
+            float    millimeters;
+            uint32_t steps_event_count;
+            std::array<uint32_t, k_max_actuators> steps;
+            bool     s_curve;
+        };
+
+        step_t steps[STEPTICKER_TIMELINE];
+        block_t blocks[STEPTICKER_TIMELINE_BLOCKS];
+
+        volatile uint32_t steps_head, steps_tail;
+        volatile uint32_t blocks_head, blocks_tail;
+        volatile uint32_t dropped_steps, dropped_blocks;
+};
+
+#endif
@@ -29,6 +29,16 @@ class StreamOutput {
         virtual int puts(const char* str) = 0;
         virtual bool ready() { return true; };
 
+        // the receive buffer behind this stream, for hosts that do their own flow control, 0 if there is none
+        virtual int rx_buffer_size() { return 0; }
+        virtual int rx_buffer_free() { return 0; }
+
+        // held by a module past the line it came with, a network stream is not deleted until it is released
+        virtual void retain() {}
+        virtual void release() {}
+        // the other end has gone, what is printed to it is dropped
+        virtual bool is_closed() { return false; }
+
         static NullStreamOutput NullStream;
 };
 
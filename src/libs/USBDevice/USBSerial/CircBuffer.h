@@ -20,6 +20,7 @@
 #define CIRCBUFFER_H
 
 #include <stdlib.h>
+#include <string.h>
 #include "sLPC17xx.h"
 #include "platform_memory.h"
 
@@ -52,6 +53,27 @@ public:
 		__enable_irq();
     }
 
+    // add n to the back in one go, at most two copies as they may wrap around the end, there must be room for them
+    void queue(const T * c, uint16_t n) {
+        uint16_t first = size - write;
+        if (first > n) first = n;
+        memcpy(&buf[write], c, first * sizeof(T));
+        memcpy(&buf[0], c + first, (n - first) * sizeof(T));
+        write = (write + n) % size;
+    }
+
+    // the free space at the back that can be written straight into without wrapping, advance() adds what was written
+    uint16_t contiguousFree(T ** p) {
+        uint16_t r = read;
+        *p = &buf[write];
+        if (r > write) return r - write - 1;
+        return size - write - (r == 0 ? 1 : 0);
+    }
+
+    void advance(uint16_t n) {
+        write = (write + n) % size;
+    }
+
     // pop last entered character
     void pop() {
         if(!isEmpty()) {
@@ -60,6 +82,22 @@ public:
         }
     }
 
+    // pop the last n entered, there must be that many
+    void pop(uint16_t n) {
+        write = (write + size - n) % size;
+    }
+
+    // use b of length instead, emptying the buffer, the one it had is returned so it can be freed
+    T * swapBuffer(T * b, int length) {
+        T * old = buf;
+        __disable_irq();
+        buf = b;
+        size = length;
+        read = write = 0;
+        __enable_irq();
+        return old;
+    }
+
     uint16_t available() {
 		__disable_irq();
 		uint16_t i= (write >= read) ? write - read : (size - read) + write;
@@ -70,6 +108,10 @@ public:
         return size - available() - 1;
     };
 
+    uint16_t capacity() {
+        return size - 1;
+    };
+
     void dump() {
         iprintf("[RingBuffer Sz:%2d Rd:%2d Wr:%2d Av:%2d Fr:%2d]\n", size, read, write, available(), free());
     }
@@ -83,6 +125,15 @@ public:
         return(!empty);
     };
 
+    // take n off the front in one go, at most two copies as they may wrap around the end
+    void dequeue(T * c, uint16_t n) {
+        uint16_t first = size - read;
+        if (first > n) first = n;
+        memcpy(c, &buf[read], first * sizeof(T));
+        memcpy(c + first, &buf[0], (n - first) * sizeof(T));
+        read = (read + n) % size;
+    }
+
     void peek(T * c, int offset) {
         int h = (read + offset) % size;
         *c = buf[h];
@@ -18,19 +18,30 @@
 
 #include <cstdint>
 #include <cstdio>
+#include <cstdarg>
 
 #include "USBSerial.h"
 
 #include "libs/Kernel.h"
 #include "libs/SerialMessage.h"
 #include "StreamOutputPool.h"
+#include "BinaryGcode.h"
+#include "Config.h"
+#include "ConfigValue.h"
+#include "checksumm.h"
+
+#define usb_rx_buffer_size_checksum    CHECKSUM("usb_rx_buffer_size")
+#define usb_rx_buffer_in_ahb_checksum  CHECKSUM("usb_rx_buffer_in_ahb")
+
+// the receive buffer until the config says otherwise, it has to hold the longest line and a packet
+#define RX_BUFFER_SIZE 1024
 
 // extern void setled(int, bool);
 #define setled(a, b) do {} while (0)
 
 #define iprintf(...) do { } while (0)
 
-USBSerial::USBSerial(USB *u): USBCDC(u), rxbuf(256 + 8), txbuf(128 + 8)
+USBSerial::USBSerial(USB *u): USBCDC(u), rxbuf(RX_BUFFER_SIZE), txbuf(128 + 8)
 {
     usb = u;
     nl_in_rx = 0;
@@ -39,6 +50,10 @@ USBSerial::USBSerial(USB *u): USBCDC(u), rxbuf(256 + 8), txbuf(128 + 8)
     halt_flag = false;
     query_flag = false;
     last_char_was_dollar = false;
+    at_line_start = true;
+    tx_zlp = false;
+    frame_left = 0;
+    line_length = 0;
 }
 
 void USBSerial::ensure_tx_space(int space)
@@ -67,39 +82,72 @@ int USBSerial::_getc()
     uint8_t c = 0;
     setled(4, 1); while (rxbuf.isEmpty()); setled(4, 0);
     rxbuf.dequeue(&c);
-    if (rxbuf.free() == MAX_PACKET_SIZE_EPBULK) {
-        usb->endpointSetInterrupt(CDC_BulkOut.bEndpointAddress, true);
-        iprintf("rxbuf has room for another packet, interrupt enabled\n");
-    } else if ((rxbuf.free() < MAX_PACKET_SIZE_EPBULK) && (nl_in_rx == 0)) {
-        // handle potential deadlock where a short line, and the beginning of a very long line are bundled in one usb packet
-        rxbuf.flush();
-        flush_to_nl = true;
-
-        usb->endpointSetInterrupt(CDC_BulkOut.bEndpointAddress, true);
-        iprintf("rxbuf has room for another packet, interrupt enabled\n");
-    }
     if (nl_in_rx > 0)
         if (c == '\n' || c == '\r')
             nl_in_rx--;
+    rx_dequeued();
 
     return c;
 }
 
+// called after taking bytes from rxbuf, restarts the endpoint once there is room for another packet
+void USBSerial::rx_dequeued()
+{
+    if (rxbuf.free() >= MAX_PACKET_SIZE_EPBULK) {
+        usb->endpointSetInterrupt(CDC_BulkOut.bEndpointAddress, true);
+        iprintf("rxbuf has room for another packet, interrupt enabled\n");
+    }
+}
+
+// queue it all a packet at a time, each copied in as a block and sent on as soon as it is there
+void USBSerial::write_tx(const uint8_t *buf, uint16_t size)
+{
+    while (size > 0) {
+        uint16_t n = (size > MAX_PACKET_SIZE_EPBULK) ? MAX_PACKET_SIZE_EPBULK : size;
+        ensure_tx_space(n);
+        txbuf.queue(buf, n);
+        usb->endpointSetInterrupt(CDC_BulkIn.bEndpointAddress, true);
+        buf += n;
+        size -= n;
+    }
+}
+
 int USBSerial::puts(const char *str)
+{
+    int n = strlen(str);
+    if (attached)
+        write_tx((const uint8_t *)str, n);
+    return n;
+}
+
+int USBSerial::printf(const char *format, ...)
 {
     if (!attached)
-        return strlen(str);
-    int i = 0;
-    while (*str) {
-        ensure_tx_space(1);
-        txbuf.queue(*str);
-        if ((txbuf.available() % 64) == 0)
-            usb->endpointSetInterrupt(CDC_BulkIn.bEndpointAddress, true);
-        i++;
-        str++;
+        return 0;
+
+    va_list args, args2;
+    va_start(args, format);
+    va_copy(args2, args);
+
+    // format straight into txbuf when it fits before the end, which it nearly always does
+    uint8_t *p;
+    uint16_t room = txbuf.contiguousFree(&p);
+    int n = vsnprintf((char *)p, room, format, args);
+    if (n >= 0 && n < room) {
+        txbuf.advance(n);
+        usb->endpointSetInterrupt(CDC_BulkIn.bEndpointAddress, true);
+
+    } else if (n > 0) {
+        char b[64];
+        char *buffer = (n < 64) ? b : new char[n + 1];
+        vsnprintf(buffer, n + 1, format, args2);
+        write_tx((const uint8_t *)buffer, n);
+        if (buffer != b)
+            delete[] buffer;
     }
-    usb->endpointSetInterrupt(CDC_BulkIn.bEndpointAddress, true);
-    return i;
+    va_end(args2);
+    va_end(args);
+    return n;
 }
 
 uint16_t USBSerial::writeBlock(const uint8_t * buf, uint16_t size)
@@ -110,9 +158,7 @@ uint16_t USBSerial::writeBlock(const uint8_t * buf, uint16_t size)
         size = txbuf.free();
     }
     if (size > 0) {
-        for (uint8_t i = 0; i < size; i++) {
-            txbuf.queue(buf[i]);
-        }
+        txbuf.queue(buf, size);
         usb->endpointSetInterrupt(CDC_BulkIn.bEndpointAddress, true);
     }
     return size;
@@ -137,18 +183,19 @@ bool USBSerial::USBEvent_EPIn(uint8_t bEP, uint8_t bEPStatus)
 
     int l = txbuf.available();
     if (l > 0) {
-        // Use MAX_PACKET_SIZE_EPBULK-1 below instead of MAX_PACKET_SIZE_EPBULK
-        // to work around a problem sending packets that are exactly MAX_PACKET_SIZE_EPBULK
-        // bytes in length. The problem is that these packets don't flush properly.
-        if (l > MAX_PACKET_SIZE_EPBULK-1)
-            l = MAX_PACKET_SIZE_EPBULK-1;
-        int i;
-        for (i = 0; i < l; i++) {
-            txbuf.dequeue(&b[i]);
-        }
+        // full packets, the host only passes on what it has when a transfer ends with a short one, so when a full
+        // one is the last there is a zero length packet after it
+        if (l > MAX_PACKET_SIZE_EPBULK)
+            l = MAX_PACKET_SIZE_EPBULK;
+        txbuf.dequeue(b, l);
         send(b, l);
-        if (txbuf.available() == 0)
+        tx_zlp = (l == MAX_PACKET_SIZE_EPBULK);
+        if (txbuf.available() == 0 && !tx_zlp)
             r = false;
+    } else if (tx_zlp) {
+        send(b, 0);
+        tx_zlp = false;
+        r = false;
     } else {
         r = false;
     }
@@ -181,9 +228,32 @@ bool USBSerial::USBEvent_EPOut(uint8_t bEP, uint8_t bEPStatus)
     iprintf("Read %ld bytes:\n\t", size);
     for (uint8_t i = 0; i < size; i++) {
 
-        // handle backspace and delete by deleting the last character in the buffer if there is one
+        // a binary frame is queued as it is, none of its bytes are control characters
+        if (frame_left != 0) {
+            rxbuf.queue(c[i]);
+            if (frame_left < 0) {
+                // the length, a bad one ends the frame here and GcodeDispatch asks for it again
+                frame_left = (c[i] >= 3 && c[i] <= BinaryGcode::max_length) ? c[i] : 0;
+            } else {
+                frame_left--;
+            }
+            if (frame_left == 0)
+                nl_in_rx++;
+            continue;
+        }
+
+        if (at_line_start && c[i] == BinaryGcode::frame_start && !flush_to_nl) {
+            rxbuf.queue(c[i]);
+            frame_left = -1;
+            continue;
+        }
+
+        // handle backspace and delete by deleting the last character of the line if there is one
         if(c[i] == 0x08 || c[i] == 0x7F) {
-            if(!rxbuf.isEmpty()) rxbuf.pop();
+            if(line_length > 0) {
+                rxbuf.pop();
+                line_length--;
+            }
             continue;
         }
 
@@ -216,8 +286,10 @@ bool USBSerial::USBEvent_EPOut(uint8_t bEP, uint8_t bEPStatus)
 
         last_char_was_dollar = (c[i] == '$');
 
-        if (flush_to_nl == false)
+        if (flush_to_nl == false) {
             rxbuf.queue(c[i]);
+            line_length++;
+        }
 
         // if (c[i] >= 32 && c[i] < 128)
         // {
@@ -228,32 +300,27 @@ bool USBSerial::USBEvent_EPOut(uint8_t bEP, uint8_t bEPStatus)
         //     iprintf("\\x%02X", c[i]);
         // }
 
+        at_line_start = (c[i] == '\n' || c[i] == '\r');
         if (c[i] == '\n' || c[i] == '\r') {
             if (flush_to_nl)
                 flush_to_nl = false;
             else
                 nl_in_rx++;
-        } else if (rxbuf.isFull() && (nl_in_rx == 0)) {
-            // to avoid a deadlock with very long lines, we must dump the buffer
+            line_length = 0;
+        } else if (line_length > max_line_length) {
+            // too long to ever be handled, take back what there is of it, the lines before it are kept,
             // and continue flushing to the next newline
-            rxbuf.flush();
+            rxbuf.pop(line_length);
+            line_length = 0;
             flush_to_nl = true;
         }
     }
     iprintf("\nQueued, %d empty\n", rxbuf.free());
 
     if (rxbuf.free() < MAX_PACKET_SIZE_EPBULK) {
-        // if buffer is full, stall endpoint, do not accept more data
+        // if buffer is full, stall endpoint, do not accept more data until the main loop has taken a line
+        // as only the end of the buffer can be part of a line or frame, there is always a whole one to take
         r = false;
-
-        if (nl_in_rx == 0) {
-            // we have to check for long line deadlock here too
-            flush_to_nl = true;
-            rxbuf.flush();
-
-            // and since our buffer is empty, we can accept more data
-            r = true;
-        }
     }
 
     usb->readStart(CDC_BulkOut.bEndpointAddress, MAX_PACKET_SIZE_EPBULK);
@@ -261,7 +328,7 @@ bool USBSerial::USBEvent_EPOut(uint8_t bEP, uint8_t bEPStatus)
     return r;
 }
 
-uint8_t USBSerial::available()
+uint16_t USBSerial::available()
 {
     return rxbuf.available();
 }
@@ -273,6 +340,27 @@ bool USBSerial::ready()
 
 void USBSerial::on_module_loaded()
 {
+    // a deeper receive buffer lets a fast host keep more lines in flight, the endpoint is held off when it is full
+    int size = THEKERNEL->config->value(usb_rx_buffer_size_checksum)->by_default(RX_BUFFER_SIZE)->as_int();
+    bool in_ahb = THEKERNEL->config->value(usb_rx_buffer_in_ahb_checksum)->by_default(true)->as_bool();
+    if (size < max_line_length + MAX_PACKET_SIZE_EPBULK + 1)
+        size = max_line_length + MAX_PACKET_SIZE_EPBULK + 1;
+    if (size > 16384)
+        size = 16384;
+    if (size != rxbuf.capacity() + 1 || !in_ahb) {
+        uint8_t *b = nullptr;
+        if (in_ahb) {
+            b = (uint8_t *)AHB0.alloc(size);
+            if (b == nullptr)
+                b = (uint8_t *)AHB1.alloc(size);
+        }
+        if (b == nullptr)
+            b = (uint8_t *)malloc(size);
+        // if there is no room for it the one there is will do
+        if (b != nullptr)
+            AHB0.dealloc(rxbuf.swapBuffer(b, size));
+    }
+
     this->register_for_event(ON_MAIN_LOOP);
     this->register_for_event(ON_IDLE);
 }
@@ -289,11 +377,17 @@ void USBSerial::on_idle(void *argument)
         }
         rxbuf.flush(); // flush the recieve buffer, hopefully upstream has stopped sending
         nl_in_rx = 0;
+        line_length = 0;
+        frame_left = 0;
+        at_line_start = true;
+        rx_dequeued();
     }
 
     if(query_flag) {
         query_flag = false;
-        puts(THEKERNEL->get_query_string().c_str());
+        char buf[Kernel::query_string_size];
+        THEKERNEL->get_query_string(buf, sizeof(buf), this);
+        puts(buf);
     }
 
 }
@@ -315,6 +409,9 @@ void USBSerial::on_main_loop(void *argument)
             txbuf.flush();
             rxbuf.flush();
             nl_in_rx = 0;
+            line_length = 0;
+            frame_left = 0;
+            at_line_start = true;
         }
     }
 
@@ -322,23 +419,50 @@ void USBSerial::on_main_loop(void *argument)
     //if(THEKERNEL->get_feed_hold()) return;
 
     if (nl_in_rx) {
-        string received;
-        while (available()) {
-            char c = _getc();
-            if( c == '\n' || c == '\r') {
-                struct SerialMessage message;
-                message.message = received;
-                message.stream = this;
-                iprintf("USBSerial Received: %s\n", message.message.c_str());
-                THEKERNEL->call_event(ON_CONSOLE_LINE_RECEIVED, &message );
-                return;
-            } else {
-                received += c;
-            }
+        uint8_t first;
+        rxbuf.peek(&first, 0);
+        if (first == BinaryGcode::frame_start) {
+            deliver_frame();
+            return;
         }
+
+        // nl_in_rx says there is a newline in there, the line is everything up to it and goes out in one copy
+        int n = 0;
+        uint8_t c = first;
+        while (c != '\n' && c != '\r')
+            rxbuf.peek(&c, ++n);
+        rxbuf.dequeue((uint8_t *)line, n + 1);
+        nl_in_rx--;
+        rx_dequeued();
+        line[n] = '\0';
+
+        struct SerialMessage message;
+        message.message.assign(line, n);
+        message.stream = this;
+        iprintf("USBSerial Received: %s\n", message.message.c_str());
+        THEKERNEL->call_event(ON_CONSOLE_LINE_RECEIVED, &message );
     }
 }
 
+// the frame at the front of rxbuf goes to GcodeDispatch whole, as the bytes of the line, it is not read with _getc()
+// as any of them may look like a newline
+void USBSerial::deliver_frame()
+{
+    uint8_t len;
+    rxbuf.peek(&len, 1);
+    int n = 2 + ((len >= 3 && len <= BinaryGcode::max_length) ? len : 0);
+    if (n > rxbuf.available())
+        n = rxbuf.available();
+    rxbuf.dequeue((uint8_t *)line, n);
+    nl_in_rx--;
+    rx_dequeued();
+
+    struct SerialMessage message;
+    message.message.assign(line, n);
+    message.stream = this;
+    THEKERNEL->call_event(ON_CONSOLE_LINE_RECEIVED, &message );
+}
+
 void USBSerial::on_attach()
 {
     attach = true;
@@ -38,9 +38,12 @@ public:
     int _putc(int c);
     int _getc();
     int puts(const char *);
+    int printf(const char *format, ...) __attribute__ ((format(printf, 2, 3)));
 
-    uint8_t available();
+    uint16_t available();
     bool ready();
+    int rx_buffer_size() { return rxbuf.capacity(); }
+    int rx_buffer_free() { return rxbuf.free(); }
 
     uint16_t writeBlock(const uint8_t * buf, uint16_t size);
 
@@ -62,11 +65,29 @@ protected:
     virtual void on_detach(void);
 
     void ensure_tx_space(int);
+    void write_tx(const uint8_t *, uint16_t);
+
+    void deliver_frame();
+    void rx_dequeued();
+
+    // a longer text line is dropped as it comes in, so a part of a line can never fill rxbuf and leave no room for a
+    // packet, it must be at least as long as a binary frame
+    static const int max_line_length = 256;
+
+    // lines are copied out of rxbuf into this
+    char line[max_line_length + 1];
+
+    // bytes of the text line being received that are in rxbuf
+    volatile uint16_t line_length;
 
     // keep track of number of newlines in the buffer
     // this makes it trivial to detect if there's a new line available
+    // a binary frame counts as a line once all of it is in the buffer
     volatile int nl_in_rx;
 
+    // bytes of the binary frame being received still to come, -1 when its length is next
+    volatile int16_t frame_left;
+
 
     volatile struct {
         volatile bool attach:1;
@@ -74,12 +95,16 @@ protected:
         bool halt_flag:1;
         bool query_flag:1;
         bool last_char_was_dollar:1;
-        // if we receive a line that's longer than the buffer, to avoid a deadlock
-        // we must flush the buffer.
+        // if we receive a line that's longer than max_line_length, what there is
+        // of it is taken back out of the buffer.
         // then to avoid delivering the tail of a line to Smoothie we must keep
         // flushing until we find a newline.
         // this flag asserts when we are doing this
         bool flush_to_nl:1;
+        // nothing but newlines since the last line, only here can a binary frame start
+        bool at_line_start:1;
+        // the last packet sent was a full one and nothing followed, a zero length packet must end the transfer
+        bool tx_zlp:1;
     };
 
 private:
@@ -15,6 +15,7 @@
 #include <cstring>
 #include <stdio.h>
 #include <cstdlib>
+#include <cmath>
 
 #include "mbed.h"
 
@@ -254,6 +255,38 @@ int append_parameters(char *buf, std::vector<std::pair<char,float>> params, size
     return n;
 }
 
+// the value with a number of decimals (at most 6) exactly as "%1.*f" prints it, but without printf's float formatting
+// which is slow and takes a lot of stack, buf must hold 48 characters, returns the length
+int format_fixed(char *buf, float value, int decimals)
+{
+    static const uint32_t scale[]= {1, 10, 100, 1000, 10000, 100000, 1000000};
+    if(decimals < 0) decimals= 0;
+    if(decimals > 6) decimals= 6;
+
+    // a float times a power of ten up to a million is exact in a double, so the rounding is printf's, half to even
+    double d= fabs((double)value * scale[decimals]);
+    if(!std::isfinite(d) || d >= 1e17) return snprintf(buf, 48, "%1.*f", decimals, value);
+    double f= floor(d);
+    uint64_t u= f;
+    if(d - f > 0.5 || (d - f == 0.5 && (u & 1))) u++;
+
+    char digits[20];
+    int n= 0;
+    do {
+        digits[n++]= '0' + u % 10;
+        u /= 10;
+    } while(u > 0 || n <= decimals);
+
+    char *p= buf;
+    if(std::signbit(value)) *p++= '-';
+    while(n > 0) {
+        if(n == decimals) *p++= '.';
+        *p++= digits[--n];
+    }
+    *p= '\0';
+    return p - buf;
+}
+
 string wcs2gcode(int wcs) {
     string str= "G5";
     str.append(1, std::min(wcs, 5) + '4');
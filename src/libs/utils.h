@@ -34,6 +34,7 @@ void system_reset( bool dfu= false );
 std::string absolute_from_relative( std::string path );
 
 int append_parameters(char *buf, std::vector<std::pair<char,float>> params, size_t bufsize);
+int format_fixed(char *buf, float value, int decimals);
 std::string wcs2gcode(int wcs);
 void safe_delay_us(uint32_t delay);
 void safe_delay_ms(uint32_t delay);
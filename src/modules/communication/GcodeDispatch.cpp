@@ -10,6 +10,7 @@
 #include "libs/Kernel.h"
 #include "Robot.h"
 #include "utils/Gcode.h"
+#include "utils/GcodeLine.h"
 #include "libs/nuts_bolts.h"
 #include "modules/robot/Conveyor.h"
 #include "libs/SerialMessage.h"
@@ -26,6 +27,8 @@
 #include "utils.h"
 #include "LPC17xx.h"
 
+#include <algorithm>
+
 #define panel_display_message_checksum CHECKSUM("display_message")
 #define panel_checksum             CHECKSUM("panel")
 
@@ -41,6 +44,7 @@ static bool is_allowed_mcode(int m) {
 GcodeDispatch::GcodeDispatch()
 {
     uploading = false;
+    lines_since_idle = false;
     currentline = -1;
     modal_group_1= 0;
 }
@@ -49,27 +53,99 @@ GcodeDispatch::GcodeDispatch()
 void GcodeDispatch::on_module_loaded()
 {
     this->register_for_event(ON_CONSOLE_LINE_RECEIVED);
+    this->register_for_event(ON_IDLE);
+}
+
+// In streaming mode the acknowledgements of a stream's lines are held back and sent together with the room there is
+// for more, so a host can keep the receive buffer and the planner full without waiting for each ok in turn.
+//
+//   M810 S1 P8     replies "ok R<rx buffer size> Q<planner blocks free>", the host may now have up to the receive
+//                  buffer size in bytes of lines it has not had acknowledged yet
+//   ok N3 R200 Q28 the next 3 lines sent have been handled, R bytes of the receive buffer and Q blocks of the planner
+//                  queue are free right now
+//   M810 S0        back to one ok per line
+//
+// Either reply is the one ack of the line M810 is on, sent once the rest of the line has been handled.
+//
+// The acks go out once P lines (default 8) are waiting for one, or as soon as no more lines are coming in. Any other
+// reply that ends a line, like an ok with text after it, an error or a resend request, counts as an ack of its own
+// line and goes after the acks held back. Text the modules print while handling a line can still come before them.
+void GcodeDispatch::send_ok(StreamOutput *stream)
+{
+    if(stream != streaming_stream) {
+        stream->printf("ok\r\n");
+        return;
+    }
+    if(++pending_acks >= ack_every) flush_acks();
+}
+
+void GcodeDispatch::flush_acks()
+{
+    if(pending_acks == 0) return;
+    streaming_stream->printf("ok N%u R%d Q%u\r\n", pending_acks, streaming_stream->rx_buffer_free(), THECONVEYOR->get_free_blocks());
+    pending_acks= 0;
+}
+
+// back to one ok per line, the stream is let go of which deletes a network stream whose session has closed
+void GcodeDispatch::end_streaming()
+{
+    streaming_stream->release();
+    streaming_stream= nullptr;
+    pending_acks= 0;
+}
+
+// the reply to M810, which acks the whole line it is on
+void GcodeDispatch::send_streaming_ok(StreamOutput *stream)
+{
+    if(stream == streaming_stream) {
+        stream->printf("ok R%d Q%u\r\n", stream->rx_buffer_size(), THECONVEYOR->get_free_blocks());
+    } else {
+        stream->printf("ok\r\n");
+    }
+}
+
+void GcodeDispatch::on_idle(void *)
+{
+    // nothing more can be sent to a stream whose session has closed, so it is not held on to until the next M810
+    if(streaming_stream != nullptr && streaming_stream->is_closed()) end_streaming();
+
+    // a whole idle pass with no new line, the host has stopped sending or is waiting for the acks
+    if(pending_acks > 0 && !lines_since_idle) flush_acks();
+    lines_since_idle= false;
+}
+
+// the text of a command from n characters in, as substr(n) would give
+static string after(const char *command, size_t length, size_t n)
+{
+    return n < length ? string(command + n, length - n) : string();
 }
 
 // When a command is received, if it is a Gcode, dispatch it as an object via an event
 void GcodeDispatch::on_console_line_received(void *line)
 {
-    SerialMessage new_message = *static_cast<SerialMessage *>(line);
-    string possible_command = new_message.message;
+    // the line is looked at where the stream put it, only the Gcodes made from it get a copy of their command
+    const SerialMessage &new_message = *static_cast<SerialMessage *>(line);
+    const char *text = new_message.message.data();
+    size_t length = new_message.message.size();
+    string pycam_command; // a line with a G put in front, the only time the text is rebuilt
 
-    int ln = 0;
-    int cs = 0;
+    if(new_message.stream == streaming_stream) lines_since_idle= true;
 
     // just reply ok to empty lines
-    if(possible_command.empty()) {
-        new_message.stream->printf("ok\r\n");
+    if(length == 0) {
+        send_ok(new_message.stream);
+        return;
+    }
+
+    if((uint8_t)text[0] == BinaryGcode::frame_start) {
+        handle_binary_frame((const uint8_t *)text, length, new_message.stream);
         return;
     }
 
 try_again:
 
-    char first_char = possible_command[0];
-    unsigned int n;
+    char first_char = text[0];
+    const char *xyzf;
 
     if(first_char == '$') {
         // ignore as simpleshell will handle it
@@ -82,70 +158,34 @@ try_again:
 
     if ( first_char == 'G' || first_char == 'M' || first_char == 'T' || first_char == 'S' || first_char == 'N' ) {
 
-        //Get linenumber
-        if ( first_char == 'N' ) {
-            Gcode full_line = Gcode(possible_command, new_message.stream, false);
-            ln = (int) full_line.get_value('N');
-            int chksum = (int) full_line.get_value('*');
-
-            //Catch message if it is M110: Set Current Line Number
-            if ( full_line.has_m ) {
-                if ( full_line.m == 110 ) {
-                    currentline = ln;
-                    new_message.stream->printf("ok\r\n");
-                    return;
-                }
-            }
-
-            //Strip checksum value from possible_command
-            size_t chkpos = possible_command.find_first_of("*");
-            possible_command = possible_command.substr(0, chkpos);
-            //Calculate checksum
-            if ( chkpos != string::npos ) {
-                for (auto c = possible_command.cbegin(); *c != '*' && c != possible_command.cend(); c++)
-                    cs = cs ^ *c;
-                cs &= 0xff;  // Defensive programming...
-                cs -= chksum;
-            }
-            //Strip line number value from possible_command
-            size_t lnsize = possible_command.find_first_not_of("N0123456789.,- ");
-            possible_command = possible_command.substr(lnsize);
-
-        } else {
-            //Assume checks succeeded
-            cs = 0x00;
-            ln = currentline + 1;
-        }
+        // line number, checksum and comment are found and the commands split apart in place
+        GcodeLine gcode_line(text, length);
 
-        //Remove comments
-        size_t comment = possible_command.find_first_of(";(");
-        if( comment != string::npos ) {
-            possible_command = possible_command.substr(0, comment);
+        //Catch message if it is M110: Set Current Line Number
+        if ( gcode_line.has_line_number() && gcode_line.is_m110() ) {
+            currentline = gcode_line.get_line_number();
+            new_message.stream->printf("ok\r\n");
+            return;
         }
 
-        //If checksum passes then process message, else request resend
+        //If checksum passes then process message, else request resend, a line without a number is the next one
         int nextline = currentline + 1;
-        if( cs == 0x00 && ln == nextline ) {
-            if( first_char == 'N' ) {
+        int ln = gcode_line.has_line_number() ? gcode_line.get_line_number() : nextline;
+        if( gcode_line.checksum_ok() && ln == nextline ) {
+            if( gcode_line.has_line_number() ) {
                 currentline = nextline;
             }
 
-            while(possible_command.size() > 0) {
-                // assumes G or M are always the first on the line
-                size_t nextcmd = possible_command.find_first_of("GM", 2);
-                string single_command;
-                if(nextcmd == string::npos) {
-                    single_command = possible_command;
-                    possible_command = "";
-                } else {
-                    single_command = possible_command.substr(0, nextcmd);
-                    possible_command = possible_command.substr(nextcmd);
-                }
-
+            const char *single_command;
+            size_t single_length;
+            bool streaming_ok= false; // M810 has been on the line, it replies for the whole line
+            while(gcode_line.next_command(single_command, single_length)) {
+                // the command and all after it on the line, for those that take the rest of the line as text
+                size_t to_end = gcode_line.rest() + gcode_line.rest_length() - single_command;
 
                 if(!uploading || upload_stream != new_message.stream) {
                     // Prepare gcode for dispatch
-                    Gcode *gcode = new Gcode(single_command, new_message.stream);
+                    Gcode *gcode = new Gcode(single_command, single_length, new_message.stream);
 
                     if(THEKERNEL->is_halted()) {
                         // we ignore all commands until M999, unless it is in the exceptions list (like M105 get temp)
@@ -175,7 +215,7 @@ try_again:
                         if(gcode->g == 53) { // G53 makes next movement command use machine coordinates
                             // this is ugly to implement as there may or may not be a G0/G1 on the same line
                             // valid version seem to include G53 G0 X1 Y2 Z3 G53 X1 Y2
-                            if(possible_command.empty()) {
+                            if(gcode_line.rest_length() == 0) {
                                 // use last gcode G1 or G0 if none on the line, and pass through as if it was a G0/G1
                                 // TODO it is really an error if the last is not G0 thru G3
                                 if(modal_group_1 > 3) {
@@ -189,8 +229,8 @@ try_again:
                             }else{
                                 delete gcode;
                                 // extract next G0/G1 from the rest of the line, ignore if it is not one of these
-                                gcode = new Gcode(possible_command, new_message.stream);
-                                possible_command= "";
+                                gcode = new Gcode(gcode_line.rest(), gcode_line.rest_length(), new_message.stream);
+                                gcode_line.skip_rest();
                                 if(!gcode->has_g || gcode->g > 1) {
                                     // not G0 or G1 so ignore it as it is invalid
                                     delete gcode;
@@ -214,7 +254,7 @@ try_again:
                             case 28: // start upload command
                                 delete gcode;
 
-                                this->upload_filename = "/sd/" + single_command.substr(4); // rest of line is filename
+                                this->upload_filename = "/sd/" + after(single_command, single_length, 4); // rest of line is filename
                                 // open file
                                 upload_fd = fopen(this->upload_filename.c_str(), "w");
                                 if(upload_fd != NULL) {
@@ -252,9 +292,25 @@ try_again:
                                 delete gcode;
                                 return;
 
+                            case 810: // M810 S1 Pn ack every n lines with the room there is for more, M810 S0 ok per line
+                                if(streaming_stream != nullptr) {
+                                    flush_acks();
+                                    end_streaming();
+                                }
+                                if(gcode->get_value('S') != 0) {
+                                    streaming_stream= new_message.stream;
+                                    streaming_stream->retain();
+                                    ack_every= gcode->has_letter('P') ? std::max(1, gcode->get_int('P')) : 8;
+                                }
+                                delete gcode;
+                                // the reply is the ack of the line, so waits for the rest of it
+                                streaming_ok= true;
+                                if(gcode_line.rest_length() == 0) send_streaming_ok(new_message.stream);
+                                continue;
+
                             case 117: // M117 is a special non compliant Gcode as it allows arbitrary text on the line following the command
                             {    // concatenate the command again and send to panel if enabled
-                                string str= single_command.substr(4) + possible_command;
+                                string str= after(single_command, to_end, 4);
                                 PublicData::set_value( panel_checksum, panel_display_message_checksum, &str );
                                 delete gcode;
                                 new_message.stream->printf("ok\r\n");
@@ -264,7 +320,7 @@ try_again:
                             case 1000: // M1000 is a special command that will pass thru the raw lowercased command to the simpleshell (for hosts that do not allow such things)
                             {
                                 // reconstruct entire command line again
-                                string str= single_command.substr(5) + possible_command;
+                                string str= after(single_command, to_end, 5);
                                 while(is_whitespace(str.front())){ str= str.substr(1); } // strip leading whitespace
 
                                 delete gcode;
@@ -307,7 +363,7 @@ try_again:
                             case 501: // load config override
                             case 504: // save to specific config override file
                                 {
-                                    string arg= get_arguments(single_command + possible_command); // rest of line is filename
+                                    string arg= get_arguments(string(single_command, to_end)); // rest of line is filename
                                     if(arg.empty()) arg= "/sd/config-override";
                                     else arg= "/sd/config-override." + arg;
                                     //new_message.stream->printf("args: <%s>\n", arg.c_str());
@@ -344,39 +400,29 @@ try_again:
                     THEKERNEL->call_event(ON_GCODE_RECEIVED, gcode );
 
                     if (gcode->is_error) {
-                        // report error
-                        if(THEKERNEL->is_grbl_mode()) {
-                            new_message.stream->printf("error: ");
-                        }else{
-                            new_message.stream->printf("Error: ");
-                        }
-
-                        if(!gcode->txt_after_ok.empty()) {
-                            new_message.stream->printf("%s\r\n", gcode->txt_after_ok.c_str());
-                            gcode->txt_after_ok.clear();
-
-                        }else{
-                            new_message.stream->printf("unknown\r\n");
-                        }
-
-                        // we cannot continue safely after an error so we enter HALT state
-                        new_message.stream->printf("Entering Alarm/Halt state\n");
-                        THEKERNEL->call_event(ON_HALT, nullptr);
+                        report_error(gcode, new_message.stream);
 
                     }else{
 
                         if(gcode->add_nl)
                             new_message.stream->printf("\r\n");
 
-                        if(!gcode->txt_after_ok.empty()) {
+                        if(streaming_ok) {
+                            // M810 earlier on the line acks it once the rest has been handled, any text goes before
+                            if(!gcode->txt_after_ok.empty()) new_message.stream->printf("%s\r\n", gcode->txt_after_ok.c_str());
+                            gcode->txt_after_ok.clear();
+                            if(gcode_line.rest_length() == 0) send_streaming_ok(new_message.stream);
+
+                        } else if(!gcode->txt_after_ok.empty()) {
+                            if(new_message.stream == streaming_stream) flush_acks();
                             new_message.stream->printf("ok %s\r\n", gcode->txt_after_ok.c_str());
                             gcode->txt_after_ok.clear();
 
                         } else {
-                            if(THEKERNEL->is_ok_per_line() || THEKERNEL->is_grbl_mode()) {
+                            if(THEKERNEL->is_ok_per_line() || THEKERNEL->is_grbl_mode() || new_message.stream == streaming_stream) {
                                 // only send ok once per line if this is a multi g code line send ok on the last one
-                                if(possible_command.empty())
-                                    new_message.stream->printf("ok\r\n");
+                                if(gcode_line.rest_length() == 0)
+                                    send_ok(new_message.stream);
                             } else {
                                 // maybe should do the above for all hosts?
                                 new_message.stream->printf("ok\r\n");
@@ -388,7 +434,7 @@ try_again:
 
                 } else {
                     // we are uploading and it is the upload stream so so save it
-                    if(single_command.substr(0, 3) == "M29") {
+                    if(single_length >= 3 && strncmp(single_command, "M29", 3) == 0) {
                         // done uploading, close file
                         fclose(upload_fd);
                         upload_fd = NULL;
@@ -405,9 +451,8 @@ try_again:
                         continue;
                     }
 
-                    single_command.append("\n");
                     static int cnt = 0;
-                    if(fwrite(single_command.c_str(), 1, single_command.size(), upload_fd) != single_command.size()) {
+                    if(fwrite(single_command, 1, single_length, upload_fd) != single_length || fwrite("\n", 1, 1, upload_fd) != 1) {
                         // error writing to file
                         new_message.stream->printf("Error:error writing to file.\r\n");
                         fclose(upload_fd);
@@ -415,7 +460,7 @@ try_again:
                         continue;
 
                     } else {
-                        cnt += single_command.size();
+                        cnt += single_length + 1;
                         if (cnt > 400) {
                             // HACK ALERT to get around fwrite corruption close and re open for append
                             fclose(upload_fd);
@@ -430,19 +475,119 @@ try_again:
 
         } else {
             //Request resend
+            if(new_message.stream == streaming_stream) flush_acks();
             new_message.stream->printf("rs N%d\r\n", nextline);
         }
 
-    } else if( (n=possible_command.find_first_of("XYZF")) == 0 || (first_char == ' ' && n != string::npos) ) {
+    } else if( (xyzf= std::find_first_of(text, text + length, "XYZF", "XYZF" + 4)) == text || (first_char == ' ' && xyzf != text + length) ) {
         // handle pycam syntax, use last modal group 1 command and resubmit if an X Y Z or F is found on its own line
         char buf[6];
         snprintf(buf, sizeof(buf), "G%d ", modal_group_1);
-        possible_command.insert(0, buf);
+        pycam_command.assign(buf).append(text, length);
+        text = pycam_command.data();
+        length = pycam_command.size();
         goto try_again;
 
         // Ignore comments and blank lines
     } else if ( first_char == ';' || first_char == '(' || first_char == ' ' || first_char == '\n' || first_char == '\r' ) {
-        new_message.stream->printf("ok\r\n");
+        send_ok(new_message.stream);
+    }
+}
+
+
+void GcodeDispatch::report_error(Gcode *gcode, StreamOutput *stream)
+{
+    if(stream == streaming_stream) flush_acks();
+    if(THEKERNEL->is_grbl_mode()) {
+        stream->printf("error: ");
+    }else{
+        stream->printf("Error: ");
+    }
+
+    if(!gcode->txt_after_ok.empty()) {
+        stream->printf("%s\r\n", gcode->txt_after_ok.c_str());
+        gcode->txt_after_ok.clear();
+
+    }else{
+        stream->printf("unknown\r\n");
     }
+
+    // we cannot continue safely after an error so we enter HALT state
+    stream->printf("Entering Alarm/Halt state\n");
+    THEKERNEL->call_event(ON_HALT, nullptr);
 }
 
+// A binary frame, see BinaryGcode.h. Its records go to the modules like the Gcodes of a text line but are never text,
+// so the commands handled here that need the rest of the line (M28, M117, M500 etc) must be sent as text
+void GcodeDispatch::handle_binary_frame(const uint8_t *frame, size_t size, StreamOutput *stream)
+{
+    BinaryGcode::STATUS status= binary_gcode.check(frame, size);
+    if(status == BinaryGcode::BAD_RECORD) {
+        stream->printf("Error: bad record in binary frame\r\nEntering Alarm/Halt state\n");
+        THEKERNEL->call_event(ON_HALT, nullptr);
+        return;
+    }
+    if(status != BinaryGcode::OK) {
+        // ask for the frame we wanted, the host sends again from there
+        stream->printf("rs B%u\r\n", binary_gcode.get_expected_sequence());
+        return;
+    }
+
+    while(Gcode *gcode= binary_gcode.next_record(stream)) {
+        if(THEKERNEL->is_halted()) {
+            // as for text, ignore everything until M999 unless it is in the exceptions list
+            if(gcode->has_m && gcode->m == 999) {
+                THEKERNEL->call_event(ON_HALT, (void *)1); // clears on_halt
+                stream->printf("WARNING: After HALT you should HOME as position is currently unknown\n");
+                delete gcode;
+                continue;
+
+            }else if(!gcode->has_m || !is_allowed_mcode(gcode->m)) {
+                stream->printf(THEKERNEL->is_grbl_mode() ? "error:Alarm lock\n" : "!!\r\n");
+                delete gcode;
+                return;
+            }
+        }
+
+        if(gcode->has_g && gcode->g < 4) {
+            modal_group_1= gcode->g;
+        }
+
+        if(gcode->has_m && gcode->m == 2) {
+            // issue M5 and M9 in case spindle and coolant are being used
+            modal_group_1= 1;
+            Gcode gc1("M5", &StreamOutput::NullStream);
+            THEKERNEL->call_event(ON_GCODE_RECEIVED, &gc1);
+            Gcode gc2("M9", &StreamOutput::NullStream);
+            THEKERNEL->call_event(ON_GCODE_RECEIVED, &gc2);
+
+        }else if(gcode->has_m && gcode->m == 112) {
+            THEKERNEL->call_event(ON_HALT, nullptr);
+            THEKERNEL->streams->printf("ok Emergency Stop Requested - reset or M999 required to exit HALT state\r\n");
+            delete gcode;
+            return;
+        }
+
+        THEKERNEL->call_event(ON_GCODE_RECEIVED, gcode);
+
+        if(gcode->is_error) {
+            // the rest of the frame is dropped as we are now halted
+            report_error(gcode, stream);
+            delete gcode;
+            return;
+        }
+
+        if(!gcode->txt_after_ok.empty()) {
+            stream->printf("%s\r\n", gcode->txt_after_ok.c_str());
+        }
+        delete gcode;
+    }
+
+    if(stream == streaming_stream) {
+        // the ack of a frame carries the room there is for more too, after any text lines held back
+        flush_acks();
+        stream->printf("ok B%u R%d Q%u\r\n", binary_gcode.get_sequence(), stream->rx_buffer_free(), THECONVEYOR->get_free_blocks());
+    } else {
+        stream->printf("ok B%u\r\n", binary_gcode.get_sequence());
+    }
+}
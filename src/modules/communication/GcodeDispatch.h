@@ -8,11 +8,13 @@
 #pragma once
 
 #include "libs/Module.h"
+#include "utils/BinaryGcode.h"
 
 #include <stdio.h>
 #include <string>
 
 class StreamOutput;
+class Gcode;
 
 class GcodeDispatch : public Module
 {
@@ -21,15 +23,30 @@ public:
 
     virtual void on_module_loaded();
     virtual void on_console_line_received(void *line);
+    virtual void on_idle(void *);
 
     uint8_t get_modal_command() const { return modal_group_1<4 ? modal_group_1 : 0; }
 private:
+    void handle_binary_frame(const uint8_t *frame, size_t size, StreamOutput *stream);
+    void report_error(Gcode *gcode, StreamOutput *stream);
+    void send_ok(StreamOutput *stream);
+    void flush_acks();
+    void end_streaming();
+    void send_streaming_ok(StreamOutput *stream);
+
+    BinaryGcode binary_gcode;
     int currentline;
     std::string upload_filename;
     FILE *upload_fd;
     StreamOutput* upload_stream{nullptr};
+    // the stream in streaming mode (M810), retained until it leaves it, and the lines from it that have been handled
+    // but not acknowledged yet
+    StreamOutput* streaming_stream{nullptr};
+    uint16_t pending_acks{0};
+    uint16_t ack_every{0};
     uint8_t modal_group_1;
     struct {
         bool uploading: 1;
+        bool lines_since_idle: 1;
     };
 };
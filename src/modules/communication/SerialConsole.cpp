@@ -31,6 +31,8 @@ void SerialConsole::on_module_loaded() {
     this->serial->attach(this, &SerialConsole::on_serial_char_received, mbed::Serial::RxIrq);
     query_flag= false;
     halt_flag= false;
+    flush_to_nl= false;
+    nl_in_rx= 0;
 
     // We only call the command dispatcher in the main loop, nowhere else
     this->register_for_event(ON_MAIN_LOOP);
@@ -54,7 +56,20 @@ void SerialConsole::on_serial_char_received(){
         }
         // convert CR to NL (for host OSs that don't send NL)
         if( received == '\r' ){ received = '\n'; }
+        if( flush_to_nl ){
+            if( received == '\n' ){ flush_to_nl= false; }
+            continue;
+        }
+        if( this->buffer.next_block_index(this->buffer.head) == this->buffer.tail ){
+            // full, a line longer than the buffer can never be read so it is dropped, otherwise the char is lost
+            if( nl_in_rx == 0 ){
+                this->buffer.tail= this->buffer.head;
+                flush_to_nl= (received != '\n');
+            }
+            continue;
+        }
         this->buffer.push_back(received);
+        if( received == '\n' ){ nl_in_rx++; }
     }
 }
 
@@ -62,7 +77,9 @@ void SerialConsole::on_idle(void * argument)
 {
     if(query_flag) {
         query_flag= false;
-        puts(THEKERNEL->get_query_string().c_str());
+        char buf[Kernel::query_string_size];
+        THEKERNEL->get_query_string(buf, sizeof(buf), this);
+        puts(buf);
     }
     if(halt_flag) {
         halt_flag= false;
@@ -72,23 +89,21 @@ void SerialConsole::on_idle(void * argument)
 
 // Actual event calling must happen in the main loop because if it happens in the interrupt we will loose data
 void SerialConsole::on_main_loop(void * argument){
-    if( this->has_char('\n') ){
-        string received;
-        received.reserve(20);
-        while(1){
-           char c;
-           this->buffer.pop_front(c);
-           if( c == '\n' ){
-                struct SerialMessage message;
-                message.message = received;
-                message.stream = this;
-                THEKERNEL->call_event(ON_CONSOLE_LINE_RECEIVED, &message );
-                return;
-            }else{
-                received += c;
-            }
-        }
-    }
+    if( nl_in_rx == 0 ){ return; }
+
+    // there is a newline in the buffer, the line is everything up to it and comes out in one copy
+    int n= 0;
+    for( int index = this->buffer.tail; this->buffer.buffer[index] != '\n'; index = this->buffer.next_block_index(index) ){ n++; }
+    this->buffer.pop_front(this->line, n + 1);
+    __disable_irq();
+    nl_in_rx--;
+    __enable_irq();
+    this->line[n]= '\0';
+
+    struct SerialMessage message;
+    message.message.assign(this->line, n);
+    message.stream = this;
+    THEKERNEL->call_event(ON_CONSOLE_LINE_RECEIVED, &message );
 }
 
 
@@ -33,14 +33,19 @@ class SerialConsole : public Module, public StreamOutput {
         int _putc(int c);
         int _getc(void);
         int puts(const char*);
+        int rx_buffer_size() { return buffer.capacity(); }
+        int rx_buffer_free() { return buffer.capacity() - buffer.size(); }
 
         //string receive_buffer;                 // Received chars are stored here until a newline character is received
         //vector<std::string> received_lines;    // Received lines are stored here until they are requested
         RingBuffer<char,256> buffer;             // Receive buffer
+        char line[256];                          // Lines are copied out of the receive buffer into this
+        volatile int nl_in_rx;                   // Newlines in the receive buffer, so a whole line is there when not 0
         mbed::Serial* serial;
         struct {
           bool query_flag:1;
           bool halt_flag:1;
+          bool flush_to_nl:1;                    // a line too long for the buffer is being dropped up to its newline
         };
 };
 
@@ -0,0 +1,116 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "BinaryGcode.h"
+#include "Gcode.h"
+
+#include <string.h>
+
+// the letters a record mask can have, the axes first as most records are moves
+const char BinaryGcode::letter_order[]= "XYZABCEFSIJKPRQL";
+
+BinaryGcode::BinaryGcode()
+{
+    next= end= nullptr;
+    sequence= 0;
+    expected= 0;
+}
+
+uint16_t BinaryGcode::crc16(const uint8_t *data, size_t size)
+{
+    uint16_t crc= 0xFFFF;
+    while(size--) {
+        crc ^= *data++ << 8;
+        for (int i = 0; i < 8; ++i) {
+            crc= (crc & 0x8000) ? (crc << 1) ^ 0x1021 : crc << 1;
+        }
+    }
+    return crc;
+}
+
+size_t BinaryGcode::record_size(const uint8_t *p, size_t size)
+{
+    if(size < 1) return 0;
+    if(p[0] == SYNC) return 1;
+    if(p[0] > M_FIXED || size < 5) return 0;
+
+    int n= __builtin_popcount(p[3] | (p[4] << 8));
+    if(n > max_values) return 0;
+    size_t s= 5 + n * ((p[0] == G_FLOAT || p[0] == M_FLOAT) ? 4 : 3);
+    return s <= size ? s : 0;
+}
+
+BinaryGcode::STATUS BinaryGcode::check(const uint8_t *frame, size_t size)
+{
+    next= end= nullptr;
+    if(size < 5 || frame[0] != frame_start || frame[1] < 3 || frame[1] > max_length || size != frame[1] + 2u) return BAD_LENGTH;
+
+    size_t n= frame[1] - 1; // len and seq and the records
+    uint16_t crc= frame[n + 1] | (frame[n + 2] << 8);
+    if(crc16(frame + 1, n) != crc) return BAD_CRC;
+
+    // check every record before any of them is used, a frame is all handled or not at all
+    const uint8_t *p= frame + 3, *e= frame + n + 1;
+    bool sync= p < e && *p == SYNC;
+    while(p < e) {
+        size_t s= record_size(p, e - p);
+        if(s == 0 || (*p == SYNC && p != frame + 3)) return BAD_RECORD;
+        p += s;
+    }
+
+    if(!sync && frame[2] != expected) return BAD_SEQUENCE;
+
+    sequence= frame[2];
+    expected= sequence + 1;
+    next= frame + 3;
+    end= e;
+    return OK;
+}
+
+Gcode *BinaryGcode::next_record(StreamOutput *stream)
+{
+    if(next != nullptr && next < end && *next == SYNC) ++next;
+    if(next == nullptr || next >= end) return nullptr;
+
+    const uint8_t *p= next;
+    next += record_size(p, end - p);
+
+    uint8_t type= p[0];
+    uint16_t code= p[1] | (p[2] << 8);
+    uint16_t mask= p[3] | (p[4] << 8);
+    bool fixed= type == G_FIXED || type == M_FIXED;
+    p += 5;
+
+    // the values come in letter_order, the Gcode wants them in alphabetical order
+    float by_letter[26];
+    uint32_t letters= 0;
+    for (int i = 0; mask != 0; ++i, mask >>= 1) {
+        if(!(mask & 1)) continue;
+        float v;
+        if(fixed) {
+            int32_t f= (int32_t)((uint32_t)p[0] << 8 | (uint32_t)p[1] << 16 | (uint32_t)p[2] << 24) >> 8;
+            v= f / 1000.0F;
+            p += 3;
+        } else {
+            uint32_t u= p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+            memcpy(&v, &u, sizeof(v));
+            p += 4;
+        }
+        int l= letter_order[i] - 'A';
+        by_letter[l]= v;
+        letters |= 1 << l;
+    }
+
+    float values[max_values];
+    int n= 0;
+    for (uint32_t b = letters; b != 0; b &= b - 1) {
+        values[n++]= by_letter[__builtin_ctz(b)];
+    }
+
+    bool is_m= type == M_FLOAT || type == M_FIXED;
+    return new Gcode(is_m, code & 0x1FFF, code >> 13, letters, values, stream);
+}
@@ -0,0 +1,82 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef BINARYGCODE_H
+#define BINARYGCODE_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+class Gcode;
+class StreamOutput;
+
+/*
+ * Binary Gcode frames, which a host can send over USB in between text lines to save the bytes on the wire and the
+ * parsing. A frame must start a line, and its first byte can never be in a text line.
+ *
+ *   frame:  0xFE len seq record... crc_lo crc_hi
+ *     len     the number of bytes after it, from seq to the crc, 3 to max_length
+ *     seq     one more than the sequence number of the last frame accepted, modulo 256
+ *     crc     CRC-16/CCITT-FALSE of len, seq and the records
+ *
+ *   record: type code_lo code_hi mask_lo mask_hi value...
+ *     type    G_FLOAT, G_FIXED, M_FLOAT or M_FIXED, or SYNC which is the type byte alone
+ *     code    the G or M number, with the subcode (the 2 of G28.2) in the top 3 bits
+ *     mask    bit n set when the n'th letter of letter_order has a value, at most max_values of them
+ *     value   one for each bit in mask in that order, a little endian float for the FLOAT types or a little endian
+ *             signed 24 bit count of thousandths for the FIXED types
+ *
+ * A frame that starts with a SYNC record is accepted whatever its sequence number, and the count carries on from it.
+ * GcodeDispatch replies "ok B<seq>" when a frame has been handled, or "rs B<seq>" with the frame it wants next when
+ * one is corrupt or out of sequence, the host sends again from there. In streaming mode (M810) the ok has the room
+ * there is for more after it as well. sim/gcodeencode is the reference encoder.
+ */
+class BinaryGcode {
+    public:
+        BinaryGcode();
+
+        static const uint8_t frame_start= 0xFE;
+        static const uint8_t max_length= 128;
+        static const int max_values= 12; // as many as a Gcode holds
+        static const char letter_order[];
+
+        enum RECORD_TYPE {
+            SYNC    = 0,
+            G_FLOAT = 1,
+            G_FIXED = 2,
+            M_FLOAT = 3,
+            M_FIXED = 4,
+        };
+
+        enum STATUS {
+            OK,
+            BAD_LENGTH,     // truncated, or len does not match the bytes there are
+            BAD_CRC,
+            BAD_SEQUENCE,
+            BAD_RECORD,     // the crc is right but a record is not, the host is broken
+        };
+
+        // check a whole frame from frame_start to the crc, if it is good its records can be had from next_record()
+        STATUS check(const uint8_t *frame, size_t size);
+        // the next record of the frame last checked as a new Gcode, nullptr once there are no more
+        Gcode *next_record(StreamOutput *stream);
+
+        uint8_t get_sequence() const { return sequence; }
+        uint8_t get_expected_sequence() const { return expected; }
+
+        static uint16_t crc16(const uint8_t *data, size_t size);
+        // the bytes the record at p takes, 0 if it is not a valid record or does not fit in size
+        static size_t record_size(const uint8_t *p, size_t size);
+
+    private:
+        const uint8_t *next;
+        const uint8_t *end;
+        uint8_t sequence;
+        uint8_t expected;
+};
+
+#endif
@@ -9,35 +9,131 @@
 #include "Gcode.h"
 #include "libs/StreamOutput.h"
 #include "utils.h"
+#include "libs/FixedPool.h"
 #include <stdlib.h>
+#include <string.h>
 #include <algorithm>
 
+#ifndef GCODE_POOL_SIZE
+#define GCODE_POOL_SIZE 8
+#endif
+#ifndef GCODE_TEXT_POOL_SIZE
+#define GCODE_TEXT_POOL_SIZE 8
+#endif
+#ifndef GCODE_TEXT_SIZE
+#define GCODE_TEXT_SIZE 64
+#endif
+
+// Gcodes and their command text come from these rather than the heap, so streaming does not fragment it. A line is
+// one Gcode plus the few the modules handling it make, anything more or a longer command than fits uses the heap.
+static FixedPool<sizeof(Gcode), GCODE_POOL_SIZE> gcode_pool __attribute__ ((section ("AHBSRAM1")));
+static FixedPool<GCODE_TEXT_SIZE, GCODE_TEXT_POOL_SIZE> text_pool __attribute__ ((section ("AHBSRAM1")));
+static uint32_t heap_fallbacks;
+
+// shared by every Gcode with no command text, nothing is ever written to it but the terminator it already has
+static char no_command[1];
+
+static char *dup_command(const char *str, size_t len)
+{
+    if(len == 0) return no_command;
+    char *p= (char *)text_pool.alloc(len + 1);
+    if(p == nullptr) {
+        ++heap_fallbacks;
+        p= (char *)malloc(len + 1);
+    }
+    memcpy(p, str, len);
+    p[len]= '\0';
+    return p;
+}
+
+static void free_command(char *p)
+{
+    if(p == no_command) return;
+    if(text_pool.has(p)) text_pool.dealloc(p);
+    else free(p);
+}
+
+void *Gcode::operator new(size_t size)
+{
+    void *p= gcode_pool.alloc(size);
+    if(p == nullptr) {
+        ++heap_fallbacks;
+        p= ::operator new(size);
+    }
+    return p;
+}
+
+void Gcode::operator delete(void *p)
+{
+    if(gcode_pool.has(p)) gcode_pool.dealloc(p);
+    else ::operator delete(p);
+}
+
+Gcode::pool_usage_t Gcode::get_pool_usage()
+{
+    pool_usage_t u;
+    u.gcodes= gcode_pool.used();
+    u.max_gcodes= gcode_pool.max_used();
+    u.texts= text_pool.used();
+    u.max_texts= text_pool.max_used();
+    u.heap_fallbacks= heap_fallbacks;
+    return u;
+}
+
 // This is a gcode object. It represents a GCode string/command, and caches some important values about that command for the sake of performance.
 // It gets passed around in events, and attached to the queue ( that'll change )
-Gcode::Gcode(const string &command, StreamOutput *stream, bool strip)
+Gcode::Gcode(const string &command, StreamOutput *stream, bool strip) : Gcode(command.data(), command.size(), stream, strip)
 {
-    this->command= strdup(command.c_str());
+}
+
+Gcode::Gcode(const char *command, size_t length, StreamOutput *stream, bool strip)
+{
+    this->command= dup_command(command, length);
     this->m= 0;
     this->g= 0;
     this->subcode= 0;
     this->add_nl= false;
     this->is_error= false;
+    this->binary= false;
     this->stream= stream;
     prepare_cached_values(strip);
     this->stripped= strip;
 }
 
+Gcode::Gcode(bool is_m, unsigned int code, unsigned int subcode, uint32_t letters, const float *values, StreamOutput *stream)
+{
+    this->command= no_command;
+    this->has_m= is_m;
+    this->has_g= !is_m;
+    this->m= is_m ? code : 0;
+    this->g= is_m ? 0 : code;
+    this->subcode= subcode;
+    this->add_nl= false;
+    this->is_error= false;
+    this->stripped= true;
+    this->overflowed= false;
+    this->binary= true;
+    this->stream= stream;
+
+    // every letter has a value, they come already in letter order
+    this->letters= letters;
+    this->valued= letters;
+    int n= __builtin_popcount(letters);
+    memcpy(this->values, values, n * sizeof(float));
+    this->num_args= __builtin_popcount(letters & ~(1 << ('T' - 'A')));
+}
+
 Gcode::~Gcode()
 {
     if(command != nullptr) {
         // TODO we can reference count this so we share copies, may save more ram than the extra count we need to store
-        free(command);
+        free_command(command);
     }
 }
 
 Gcode::Gcode(const Gcode &to_copy)
 {
-    this->command               = strdup(to_copy.command); // TODO we can reference count this so we share copies, may save more ram than the extra count we need to store
+    this->command               = dup_command(to_copy.command, strlen(to_copy.command)); // TODO we can reference count this so we share copies, may save more ram than the extra count we need to store
     this->has_m                 = to_copy.has_m;
     this->has_g                 = to_copy.has_g;
     this->m                     = to_copy.m;
@@ -47,12 +143,14 @@ Gcode::Gcode(const Gcode &to_copy)
     this->is_error              = to_copy.is_error;
     this->stream                = to_copy.stream;
     this->txt_after_ok.assign( to_copy.txt_after_ok );
+    copy_words(to_copy);
 }
 
 Gcode &Gcode::operator= (const Gcode &to_copy)
 {
     if( this != &to_copy ) {
-        this->command               = strdup(to_copy.command); // TODO we can reference count this so we share copies, may save more ram than the extra count we need to store
+        free_command(this->command);
+        this->command               = dup_command(to_copy.command, strlen(to_copy.command)); // TODO we can reference count this so we share copies, may save more ram than the extra count we need to store
         this->has_m                 = to_copy.has_m;
         this->has_g                 = to_copy.has_g;
         this->m                     = to_copy.m;
@@ -62,95 +160,123 @@ Gcode &Gcode::operator= (const Gcode &to_copy)
         this->is_error              = to_copy.is_error;
         this->stream                = to_copy.stream;
         this->txt_after_ok.assign( to_copy.txt_after_ok );
+        copy_words(to_copy);
     }
     return *this;
 }
 
 
+// the parsed words refer to the command by offset so they are valid for the copy
+void Gcode::copy_words(const Gcode &to_copy)
+{
+    this->stripped              = to_copy.stripped;
+    this->overflowed            = to_copy.overflowed;
+    this->binary                = to_copy.binary;
+    this->letters               = to_copy.letters;
+    this->valued                = to_copy.valued;
+    this->num_args              = to_copy.num_args;
+    memcpy(this->values, to_copy.values, sizeof(this->values));
+    memcpy(this->offsets, to_copy.offsets, sizeof(this->offsets));
+}
+
+// Find where the value of a letter starts, the slow way, for the characters that are not in the table
+static const char *find_value(const char *cs, char letter)
+{
+    char *cn;
+    for (; *cs; cs++) {
+        if( letter == *cs ) {
+            strtof(cs + 1, &cn);
+            if (cn > cs + 1)
+                return cs + 1;
+        }
+    }
+    return nullptr;
+}
+
+// Where the value for a given letter starts in the command, nullptr if it has none
+const char *Gcode::value_start( char letter ) const
+{
+    if( letter >= 'A' && letter <= 'Z' ) {
+        uint32_t bit = 1 << (letter - 'A');
+        if( valued & bit ) return command + offsets[__builtin_popcount(valued & (bit - 1))];
+        if( !overflowed || !(letters & bit) ) return nullptr;
+    }
+    return find_value(command, letter);
+}
 // Whether or not a Gcode has a letter
 bool Gcode::has_letter( char letter ) const
 {
-    for (size_t i = 0; i < strlen(this->command); ++i) {
-        if( command[i] == letter ) {
-            return true;
-        }
+    if( letter >= 'A' && letter <= 'Z' ) {
+        return letters & (1 << (letter - 'A'));
     }
-    return false;
+    return strchr(command, letter) != nullptr;
 }
 
 // Retrieve the value for a given letter
 float Gcode::get_value( char letter, char **ptr ) const
 {
-    const char *cs = command;
-    char *cn = NULL;
-    for (; *cs; cs++) {
-        if( letter == *cs ) {
-            cs++;
-            float r = strtof(cs, &cn);
-            if(ptr != nullptr) *ptr= cn;
-            if (cn > cs)
-                return r;
-        }
+    if( (ptr == nullptr || binary) && letter >= 'A' && letter <= 'Z' ) {
+        // a binary Gcode has no text for ptr to point into, it is as if the value ended the command
+        if( ptr != nullptr ) *ptr = nullptr;
+        uint32_t bit = 1 << (letter - 'A');
+        if( valued & bit ) return values[__builtin_popcount(valued & (bit - 1))];
+        if( !overflowed || !(letters & bit) ) return 0;
+    }
+
+    const char *cs = value_start(letter);
+    if(cs == nullptr) {
+        if(ptr != nullptr) *ptr= nullptr;
+        return 0;
     }
-    if(ptr != nullptr) *ptr= nullptr;
-    return 0;
+    return strtof(cs, ptr);
 }
 
 int Gcode::get_int( char letter, char **ptr ) const
 {
-    const char *cs = command;
-    char *cn = NULL;
-    for (; *cs; cs++) {
-        if( letter == *cs ) {
-            cs++;
-            int r = strtol(cs, &cn, 10);
-            if(ptr != nullptr) *ptr= cn;
-            if (cn > cs)
-                return r;
-        }
+    if( binary ) return get_value(letter, ptr);
+
+    const char *cs = value_start(letter);
+    if(cs == nullptr) {
+        if(ptr != nullptr) *ptr= nullptr;
+        return 0;
     }
-    if(ptr != nullptr) *ptr= nullptr;
-    return 0;
+    return strtol(cs, ptr, 10);
 }
 
 uint32_t Gcode::get_uint( char letter, char **ptr ) const
 {
-    const char *cs = command;
-    char *cn = NULL;
-    for (; *cs; cs++) {
-        if( letter == *cs ) {
-            cs++;
-            int r = strtoul(cs, &cn, 10);
-            if(ptr != nullptr) *ptr= cn;
-            if (cn > cs)
-                return r;
-        }
+    if( binary ) return (int32_t)get_value(letter, ptr);
+
+    const char *cs = value_start(letter);
+    if(cs == nullptr) {
+        if(ptr != nullptr) *ptr= nullptr;
+        return 0;
     }
-    if(ptr != nullptr) *ptr= nullptr;
-    return 0;
+    return strtoul(cs, ptr, 10);
 }
 
 int Gcode::get_num_args() const
 {
-    int count = 0;
-    for(size_t i = stripped?0:1; i < strlen(command); i++) {
-        if( this->command[i] >= 'A' && this->command[i] <= 'Z' ) {
-            if(this->command[i] == 'T') continue;
-            count++;
-        }
+    return num_args;
+}
+
+// the letters that are arguments, as counted by get_num_args()
+uint32_t Gcode::arg_letters() const
+{
+    uint32_t args = letters & ~(1 << ('T' - 'A'));
+    char c = command[0];
+    if( !stripped && c >= 'A' && c <= 'Z' && strchr(command + 1, c) == nullptr ) {
+        args &= ~(1 << (c - 'A'));
     }
-    return count;
+    return args;
 }
 
 std::map<char,float> Gcode::get_args() const
 {
     std::map<char,float> m;
-    for(size_t i = stripped?0:1; i < strlen(command); i++) {
-        char c= this->command[i];
-        if( c >= 'A' && c <= 'Z' ) {
-            if(c == 'T') continue;
-            m[c]= get_value(c);
-        }
+    uint32_t args = arg_letters();
+    for (char c = 'A'; args != 0; c++, args >>= 1) {
+        if(args & 1) m[c]= get_value(c);
     }
     return m;
 }
@@ -158,34 +284,77 @@ std::map<char,float> Gcode::get_args() const
 std::map<char,int> Gcode::get_args_int() const
 {
     std::map<char,int> m;
-    for(size_t i = stripped?0:1; i < strlen(command); i++) {
-        char c= this->command[i];
-        if( c >= 'A' && c <= 'Z' ) {
-            if(c == 'T') continue;
-            m[c]= get_int(c);
-        }
+    uint32_t args = arg_letters();
+    for (char c = 'A'; args != 0; c++, args >>= 1) {
+        if(args & 1) m[c]= get_int(c);
     }
     return m;
 }
 
+// Parse the words of the command in one pass: note every letter present and the value of the first occurrence of each
+// that is followed by a number, which is what a scan for the letter would find
+void Gcode::parse_words(bool strip)
+{
+    letters = 0;
+    valued = 0;
+    num_args = 0;
+    overflowed = false;
+    for (const char *cs = command; *cs; cs++) {
+        char c = *cs;
+        if( c < 'A' || c > 'Z' ) continue;
+
+        // an unstripped command starts with its G or M, which is not an argument
+        if( c != 'T' && (strip || cs != command) ) num_args++;
+
+        uint32_t bit = 1 << (c - 'A');
+        letters |= bit;
+        if( valued & bit ) continue;
+
+        char *cn;
+        float v = strtof(cs + 1, &cn);
+        if( cn == cs + 1 ) continue;
+
+        int n = __builtin_popcount(valued);
+        if( n == k_max_values ) {
+            // very rare, the letters that do not fit are found by scanning the command
+            overflowed = true;
+            continue;
+        }
+
+        // make room for it in letter order
+        int i = __builtin_popcount(valued & (bit - 1));
+        for (int j = n; j > i; j--) {
+            values[j] = values[j - 1];
+            offsets[j] = offsets[j - 1];
+        }
+        values[i] = v;
+        offsets[i] = cs + 1 - command;
+        valued |= bit;
+    }
+}
+
 // Cache some of this command's properties, so we don't have to parse the string every time we want to look at them
 void Gcode::prepare_cached_values(bool strip)
 {
+    // the command is only parsed into words once the G or M has been stripped, so these are looked for directly
     char *p= nullptr;
-    if( this->has_letter('G') ) {
+    const char *cs= find_value(command, 'G');
+    if( cs != nullptr ) {
         this->has_g = true;
-        this->g = this->get_int('G', &p);
+        this->g = strtol(cs, &p, 10);
 
     } else {
-        this->has_g = false;
+        this->has_g = strchr(command, 'G') != nullptr;
     }
 
-    if( this->has_letter('M') ) {
+    cs= find_value(command, 'M');
+    if( cs != nullptr ) {
         this->has_m = true;
-        this->m = this->get_int('M', &p);
+        this->m = strtol(cs, &p, 10);
 
     } else {
-        this->has_m = false;
+        this->has_m = strchr(command, 'M') != nullptr;
+        if(this->has_m) p= nullptr;
     }
 
     if(has_g || has_m) {
@@ -198,29 +367,40 @@ void Gcode::prepare_cached_values(bool strip)
         }
     }
 
-    if(!strip) return;
-
-    // remove the Gxxx or Mxxx from string
-    if (p != nullptr) {
-        char *n= strdup(p); // create new string starting at end of the numeric value
-        free(command);
-        command= n;
+    // remove the Gxxx or Mxxx from string, moving the rest down in place
+    if (strip && p != nullptr) {
+        memmove(command, p, strlen(p) + 1);
     }
+
+    parse_words(strip);
 }
 
 // strip off X Y Z I J K parameters if G0/1/2/3
 void Gcode::strip_parameters()
 {
-    if(has_g && g < 4){
-        // strip the command of the XYZIJK parameters
-        string newcmd;
+    if(has_g && g < 4 && binary) {
+        // there is no text, just drop them from the words
+        uint32_t keep = ~(1 << ('X' - 'A') | 1 << ('Y' - 'A') | 1 << ('Z' - 'A') | 1 << ('I' - 'A') | 1 << ('J' - 'A') | 1 << ('K' - 'A'));
+        int n = 0;
+        for (uint32_t b = valued; b != 0; b &= b - 1) {
+            uint32_t bit = b & -b;
+            if( keep & bit ) values[n++] = values[__builtin_popcount(valued & (bit - 1))];
+        }
+        num_args -= __builtin_popcount(letters & ~keep);
+        letters &= keep;
+        valued &= keep;
+
+    } else if(has_g && g < 4){
+        // strip the command of the XYZIJK parameters, in place as what is left is never longer
         char *cn= command;
+        char *dst= command;
         // find the start of each parameter
         char *pch= strpbrk(cn, "XYZIJK");
         while (pch != nullptr) {
             if(pch > cn) {
-                // copy non parameters to new string
-                newcmd.append(cn, pch-cn);
+                // copy non parameters down
+                memmove(dst, cn, pch-cn);
+                dst += pch-cn;
             }
             // find the end of the parameter and its value
             char *eos;
@@ -229,14 +409,11 @@ void Gcode::strip_parameters()
             pch= strpbrk(cn, "XYZIJK"); // find next parameter
         }
         // append anything left on the line
-        newcmd.append(cn);
+        memmove(dst, cn, strlen(cn) + 1);
 
         // strip whitespace to save even more, this causes problems so don't do it
         //newcmd.erase(std::remove_if(newcmd.begin(), newcmd.end(), ::isspace), newcmd.end());
 
-        // release the old one
-        free(command);
-        // copy the new shortened one
-        command= strdup(newcmd.c_str());
+        parse_words(stripped);
     }
 }
@@ -19,10 +19,21 @@ class StreamOutput;
 class Gcode {
     public:
         Gcode(const string&, StreamOutput*, bool strip=true);
+        Gcode(const char *command, size_t length, StreamOutput*, bool strip=true);
+        // from words that are already parsed, as a binary frame has them, values has one for each bit in letters
+        Gcode(bool is_m, unsigned int code, unsigned int subcode, uint32_t letters, const float *values, StreamOutput*);
         Gcode(const Gcode& to_copy);
         Gcode& operator= (const Gcode& to_copy);
         ~Gcode();
 
+        // from a fixed pool, see Gcode.cpp
+        static void *operator new(size_t size);
+        static void operator delete(void *p);
+
+        // the pooled Gcodes and command texts in use, the most ever in use and how often the heap had to be used instead
+        struct pool_usage_t { uint8_t gcodes, max_gcodes, texts, max_texts; uint32_t heap_fallbacks; };
+        static pool_usage_t get_pool_usage();
+
         const char* get_command() const { return command; }
         bool has_letter ( char letter ) const;
         float get_value ( char letter, char **ptr= nullptr ) const;
@@ -44,6 +55,8 @@ class Gcode {
             bool stripped:1;
             bool is_error:1;
             uint8_t subcode:3;
+            bool overflowed:1; // more letters had values than fit in values[]
+            bool binary:1; // made from words, there is no command text
         };
 
         StreamOutput* stream;
@@ -51,6 +64,19 @@ class Gcode {
 
     private:
         void prepare_cached_values(bool strip=true);
+        void parse_words(bool strip);
+        void copy_words(const Gcode& to_copy);
+        const char *value_start(char letter) const;
+        uint32_t arg_letters() const;
         char *command;
+
+        // the words of the command, parsed once so looking up a letter does not rescan the string
+        // the values are packed in letter order, the slot of a letter is the number of letters before it that have a value
+        static const int k_max_values= 12;
+        uint32_t letters; // bit n set when 'A'+n appears in the command
+        uint32_t valued; // bit n set when 'A'+n is followed by a number, and so has a slot in values[]
+        float values[k_max_values];
+        uint16_t offsets[k_max_values]; // where each value starts in command, for get_int() and get_uint()
+        uint16_t num_args;
 };
 #endif
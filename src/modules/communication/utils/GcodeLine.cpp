@@ -0,0 +1,81 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "GcodeLine.h"
+
+#include <string.h>
+
+// the integer at p, as strtol would read it but stopping at e, false if there is none
+static bool read_int(const char *p, const char *e, int &value)
+{
+    while(p < e && (*p == ' ' || *p == '\t')) p++;
+    bool negative= p < e && *p == '-';
+    if(p < e && (*p == '-' || *p == '+')) p++;
+    if(p == e || *p < '0' || *p > '9') return false;
+    int v= 0;
+    for (; p < e && *p >= '0' && *p <= '9'; p++) v= v * 10 + (*p - '0');
+    value= negative ? -v : v;
+    return true;
+}
+
+static const char *find_first_of(const char *p, const char *e, const char *chars)
+{
+    for (; p < e; p++) {
+        if(strchr(chars, *p) != nullptr) return p;
+    }
+    return e;
+}
+
+GcodeLine::GcodeLine(const char *text, size_t length)
+{
+    next= text;
+    end= text + length;
+    line_number= 0;
+    numbered= length > 0 && *text == 'N';
+    checksum_matches= true;
+    m110= false;
+
+    if(numbered) {
+        read_int(text + 1, end, line_number);
+
+        // the checksum is the xor of everything before the *
+        const char *star= (const char *)memchr(text, '*', length);
+        if(star != nullptr) {
+            int cs= 0, checksum= 0;
+            for (const char *p = text; p < star; p++) cs ^= *p;
+            read_int(star + 1, end, checksum);
+            checksum_matches= (cs & 0xff) == checksum;
+            end= star;
+        }
+
+        // the first M with a number says whether it is an M110
+        for (const char *p = text; p < end; p++) {
+            int m;
+            if(*p == 'M' && read_int(p + 1, end, m)) {
+                m110= m == 110;
+                break;
+            }
+        }
+
+        // skip the line number
+        while(next < end && strchr("N0123456789.,- ", *next) != nullptr) next++;
+    }
+
+    end= find_first_of(next, end, ";(");
+}
+
+bool GcodeLine::next_command(const char *&command, size_t &length)
+{
+    if(next == end) return false;
+
+    // assumes G or M are always the first on the line
+    const char *n= end - next > 2 ? find_first_of(next + 2, end, "GM") : end;
+    command= next;
+    length= n - next;
+    next= n;
+    return true;
+}
@@ -0,0 +1,53 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef GCODELINE_H
+#define GCODELINE_H
+
+#include <stddef.h>
+
+/*
+ * A line of G-code as it came from a stream, taken apart where it lies without copying any of it.
+ *
+ *   N<line number> <commands> *<checksum> ;comment
+ *
+ * A line that starts with N has its line number read and the checksum after the * checked, the xor of every byte
+ * before it, and both are left out of the commands. A line without N is taken as it is. Then everything from the first
+ * ; or ( is a comment and dropped, and what is left is split into commands before each G or M after the first two
+ * characters, so G1 X1 M3 is G1 X1 then M3.
+ *
+ * The text must stay as it is while the GcodeLine is in use.
+ */
+class GcodeLine {
+    public:
+        GcodeLine(const char *text, size_t length);
+
+        bool has_line_number() const { return numbered; }
+        int get_line_number() const { return line_number; }
+        // a line with no checksum is always ok
+        bool checksum_ok() const { return checksum_matches; }
+        // an M110, which sets the line number whatever the checksum is
+        bool is_m110() const { return m110; }
+
+        // the next command on the line, false once there are none left
+        bool next_command(const char *&command, size_t &length);
+
+        // what is after the last command returned, to the end of the line less its comment
+        const char *rest() const { return next; }
+        size_t rest_length() const { return end - next; }
+        void skip_rest() { next= end; }
+
+    private:
+        const char *next;
+        const char *end;
+        int line_number;
+        bool numbered;
+        bool checksum_matches;
+        bool m110;
+};
+
+#endif
@@ -0,0 +1,97 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "ArcPath.h"
+
+#include "libs/Kernel.h"
+#include "libs/nuts_bolts.h"
+#include "Block.h"
+#include "Robot.h"
+#include "StepperMotor.h"
+#include "arm_solutions/BaseSolution.h"
+
+#include <math.h>
+#include <stdlib.h>
+#include <algorithm>
+
+// called from PendSV, see Conveyor::fill_chords()
+bool ArcPath::next_chord(const Block *parent, Block *chord)
+{
+    if(chord_i == 0) {
+        entry_speed= speed= parent->entry_speed;
+        exit_speed= parent->exit_speed;
+    }
+
+    // the next point along the arc that gives some steps, a chord too short for any is run as part of the next one
+    uint16_t first= chord_i;
+    bool has_steps= false;
+    chord->clear();
+    while(!has_steps && chord_i < chords) {
+        ++chord_i;
+
+        ActuatorCoordinates actuator_pos;
+        if(chord_i == chords) {
+            actuator_pos= actuator_end;
+
+        } else {
+            float t= (float)chord_i / chords;
+            float position[k_max_actuators];
+            for (size_t i = 0; i < n_motors; i++) {
+                position[i]= start[i] + (end[i] - start[i]) * t;
+            }
+
+            // worked out from the start every time so there is no error to build up along the arc
+            float angle= angular_travel * t;
+            float c= cosf(angle), s= sinf(angle);
+            position[axis[0]]= center[0] + radius_vector[0] * c - radius_vector[1] * s;
+            position[axis[1]]= center[1] + radius_vector[0] * s + radius_vector[1] * c;
+
+            THEROBOT->arm_solution->cartesian_to_actuator(position, actuator_pos);
+            for (size_t i = E_AXIS; i < n_motors; i++) {
+                actuator_pos[i]= position[i];
+            }
+        }
+
+        for (size_t i = 0; i < n_motors; i++) {
+            // rounded the same way as StepperMotor::steps_to_target() so the chords add up to the steps of the block
+            int32_t target_steps= lroundf(actuator_pos[i] * THEROBOT->actuators[i]->get_steps_per_mm());
+            int32_t n= target_steps - steps[i];
+            steps[i]= target_steps;
+            chord->steps[i] += labs(n);
+            if(n != 0) {
+                chord->direction_bits[i]= (n < 0) ? 1 : 0;
+                has_steps= true;
+            }
+        }
+    }
+    if(!has_steps) return false;
+
+    // the speed at the end of the chord on the block's trapezoid
+    float length= parent->millimeters * (chord_i - first) / chords;
+    float exit= exit_speed;
+    if(chord_i < chords) {
+        float s= parent->millimeters * chord_i / chords;
+        float a2= 2.0F * parent->acceleration;
+        exit= std::min(parent->nominal_speed, std::min(sqrtf(entry_speed * entry_speed + a2 * s), sqrtf(exit_speed * exit_speed + a2 * (parent->millimeters - s))));
+    }
+
+    chord->steps_event_count= *std::max_element(chord->steps.begin(), chord->steps.end());
+    chord->millimeters= length;
+    chord->nominal_speed= parent->nominal_speed;
+    chord->nominal_rate= chord->steps_event_count * parent->nominal_speed / length;
+    chord->acceleration= parent->acceleration;
+    chord->primary_axis= true;
+    chord->is_g123= parent->is_g123;
+    chord->s_value= parent->s_value;
+    chord->entry_speed= speed;
+    chord->max_entry_speed= speed;
+    chord->calculate_trapezoid(speed, exit);
+    chord->ready();
+
+    speed= exit;
+    return true;
+}
@@ -0,0 +1,47 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <stdint.h>
+#include "ActuatorCoordinates.h"
+
+class Block;
+
+/*
+ * An arc queued as a single block, see Robot::plan_arc().
+ *
+ * The planner sees one block the length of the arc, entered in the direction it starts off in and left in the direction
+ * it ends in, so it is planned once rather than once per segment and there are no junctions between the segments to
+ * slow down for. The step ticker can only run straight lines, so the block is run as chords that the conveyor makes
+ * just before they are needed, see Conveyor::fill_chords(). Each chord gets the piece of the block's trapezoid it
+ * covers, so the speed follows the block's profile from one chord to the next.
+ *
+ * The chords are straight in actuator space, so this is only used on machines that do not cut lines into segments.
+ */
+class ArcPath {
+    public:
+        // the chord after the last one into chord, with the speeds of parent, false if there are none left
+        // once the first chord is made the speeds of parent are fixed, as they are for a block the step ticker is on
+        bool next_chord(const Block *parent, Block *chord);
+        bool is_done() const { return chord_i == chords; }
+
+        float center[2];                             // in the plane axes
+        float radius_vector[2];                      // from the center to the start
+        float angular_travel;                        // radians, negative for clockwise
+        float start[k_max_actuators];                // machine position at the start, actuator position for E and ABC
+        float end[k_max_actuators];                  // the same at the end
+        ActuatorCoordinates actuator_end;            // what the planner was given, so the chords add up to its steps
+        int32_t steps[k_max_actuators];              // step position at the end of the last chord
+        float entry_speed;                           // the speeds of the block once the first chord is made
+        float exit_speed;
+        float speed;                                 // speed at the end of the last chord
+        uint16_t chords;
+        volatile uint16_t chord_i;                   // chords made so far, from PendSV
+        uint8_t axis[3];                             // plane axis 0 and 1, then the linear axis
+        uint8_t n_motors;
+};
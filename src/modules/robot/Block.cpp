@@ -16,6 +16,7 @@
 #include "Gcode.h"
 #include "libs/StreamOutputPool.h"
 #include "StepTicker.h"
+#include "ArcPath.h"
 
 #include "mri.h"
 
@@ -40,6 +41,7 @@ Block::Block()
 void Block::clear()
 {
     is_ready            = false;
+    is_prepared         = false;
 
     this->steps.fill(0);
 
@@ -50,7 +52,11 @@ void Block::clear()
     entry_speed         = 0.0F;
     exit_speed          = 0.0F;
     acceleration        = 100.0F; // we don't want to get divide by zeroes if this is not set
+    jerk                = 0.0F;
     initial_rate        = 0.0F;
+    initial_rate_fp     = 0;
+    maximum_rate_fp     = 0;
+    final_rate_fp       = 0;
     accelerate_until    = 0;
     decelerate_after    = 0;
     direction_bits      = 0;
@@ -59,12 +65,20 @@ void Block::clear()
     max_entry_speed     = 0.0F;
     is_ticking          = false;
     is_g123             = false;
+    s_curve             = false;
     locked              = false;
     s_value             = 0.0F;
 
+    // only ever set on blocks in the queue, which are cleared on the main loop
+    delete arc;
+    arc                 = nullptr;
+
     acceleration_per_tick= 0;
     deceleration_per_tick= 0;
     total_move_ticks= 0;
+    accel_jerk_ticks= 0;
+    decel_jerk_ticks= 0;
+    n_active_motors= 0;
     if(tick_info.size() != n_actuators) {
         tick_info.resize(n_actuators);
     }
@@ -77,6 +91,7 @@ void Block::clear()
         i.steps_to_move= 0;
         i.step_count= 0;
         i.next_accel_event= 0;
+        i.motor= 0;
     }
 }
 
@@ -86,7 +101,7 @@ void Block::debug() const
     for (size_t i = E_AXIS; i < n_actuators; ++i) {
         THEKERNEL->streams->printf("E%d:%lu ", i-E_AXIS, this->steps[i]);
     }
-    THEKERNEL->streams->printf("(max:%lu) nominal:r%1.4f/s%1.4f mm:%1.4f acc:%1.2f accu:%lu decu:%lu ticks:%lu rates:%1.4f entry/max:%1.4f/%1.4f exit:%1.4f primary:%d ready:%d locked:%d ticking:%d recalc:%d nomlen:%d time:%f\r\n",
+    THEKERNEL->streams->printf("(max:%lu) nominal:r%1.4f/s%1.4f mm:%1.4f acc:%1.2f accu:%lu decu:%lu ticks:%lu rates:%1.4f entry/max:%1.4f/%1.4f exit:%1.4f primary:%d ready:%d prepared:%d locked:%d ticking:%d recalc:%d nomlen:%d time:%f\r\n",
                                this->steps_event_count,
                                this->nominal_rate,
                                this->nominal_speed,
@@ -101,6 +116,7 @@ void Block::debug() const
                                this->exit_speed,
                                this->primary_axis,
                                this->is_ready,
+                               this->is_prepared,
                                this->locked,
                                this->is_ticking,
                                recalculate_flag ? 1 : 0,
@@ -110,6 +126,79 @@ void Block::debug() const
 }
 
 
+// The ticks of an S-curve ramp that changes the rate by rate_change (2.30) without the acceleration going over the
+// block's (2.62, and acceleration_per_second in steps/s²). The acceleration ramps up at the jerk rate for jerk_ticks, is
+// held for the rest of the ramp less jerk_ticks, then ramps down for jerk_ticks, so the ramp takes jerk_ticks longer
+// than the trapezoid's. A change too small to reach the acceleration at the jerk rate only ramps it up and down.
+// Both are rounded up to whole ticks, so neither the jerk nor the peak acceleration prepare() works out from them is over.
+static uint32_t s_curve_ramp_ticks(int64_t rate_change, int64_t acceleration, float acceleration_per_second, float jerk_per_second, uint32_t &jerk_ticks)
+{
+    jerk_ticks = 0;
+    if(rate_change <= 0) return 0;
+
+    float dv = STEPTICKER_FROMFP(rate_change) * STEP_TICKER_FREQUENCY; // steps/sec
+    float tj = std::min(acceleration_per_second / jerk_per_second, sqrtf(dv / jerk_per_second));
+    jerk_ticks = std::max(1.0F, ceilf(tj * STEP_TICKER_FREQUENCY));
+
+    uint32_t constant_ticks = (((uint64_t)rate_change << 32) + acceleration - 1) / acceleration; // the trapezoid's ramp, rounded up
+    return jerk_ticks + std::max(jerk_ticks, constant_ticks);
+}
+
+// The plateau rate is fitted to the steps after the ramps are worked out, when it goes up so does the rate change of a
+// ramp, and with it the peak acceleration, rate_change over ramp_ticks - jerk_ticks. The jerk phases are then cut short
+// so the constant acceleration phase is long enough to keep that to the block's acceleration, if there is room for it.
+// That takes the jerk of the ramp a little over the set one, which is the lesser of the two.
+static uint32_t capped_jerk_ticks(int64_t rate_change, int64_t acceleration, uint32_t ramp_ticks, uint32_t jerk_ticks)
+{
+    if(ramp_ticks < 2 || rate_change <= 0) return jerk_ticks;
+    uint32_t constant_ticks = (((uint64_t)rate_change << 32) + acceleration - 1) / acceleration;
+    if(constant_ticks >= ramp_ticks) return 1;
+    return std::max<uint32_t>(1, std::min(jerk_ticks, ramp_ticks - constant_ticks));
+}
+
+// Twice the steps the step ticker covers over a block is w * rate + k, in 2.30, when it runs the ramps from initial
+// and down to final with a plateau of rate in between, all given in ticks.
+// The rate is changed before stepping on each tick, see StepTicker::step_tick(), so the acceleration ramp covers one
+// change more than a straight line would and the deceleration ramp one less. The S-curve adds to the acceleration on
+// the tick its phase starts on, so its acceleration comes on a tick early and goes a tick early, which is one more
+// change again on each ramp, except on a ramp of one tick which has no room for the jerk and is a straight line.
+static void distance_terms(bool s_curve, int64_t initial, int64_t final, uint32_t accel_ticks, uint32_t plateau_ticks, uint32_t decel_ticks, int64_t &w, int64_t &k)
+{
+    w = 2 * (int64_t)plateau_ticks;
+    k = 0;
+    if(accel_ticks > 0) {
+        int64_t shift = (s_curve && accel_ticks > 1) ? 2 : 1;
+        w += accel_ticks + shift;
+        k += initial * (accel_ticks - shift);
+    }
+    if(decel_ticks > 0) {
+        int64_t shift = (s_curve && decel_ticks > 1) ? 2 : 1;
+        w += decel_ticks - shift;
+        k += final * (decel_ticks + shift);
+    }
+}
+
+// The trapezoid's plateau starts on the last tick the acceleration ramp event is on, so there is always one tick of it
+// when accelerating. With no acceleration the entry rate is held up to and including decelerate_after, so there are no
+// plateau ticks when decelerate_after is 0 which starts off decelerating, and two when it is 1. A deceleration ramp of
+// one tick on its own does not move the rate, so needs at least one plateau tick before it.
+static uint32_t min_plateau_ticks(bool s_curve, uint32_t accel_ticks, uint32_t decel_ticks, uint32_t plateau_ticks)
+{
+    if(s_curve) return plateau_ticks;
+    if(accel_ticks > 0 || decel_ticks == 0) return std::max<uint32_t>(plateau_ticks, 1);
+    if(decel_ticks == 1 && plateau_ticks == 0) return 2;
+    return (plateau_ticks == 1) ? 2 : plateau_ticks;
+}
+
+// the plateau rate that covers exactly steps (in 2.30), rounded up, but never below the rates at either end
+static int64_t plateau_rate(bool s_curve, int64_t steps, int64_t initial, int64_t final, uint32_t accel_ticks, uint32_t plateau_ticks, uint32_t decel_ticks)
+{
+    int64_t w, k;
+    distance_terms(s_curve, initial, final, accel_ticks, plateau_ticks, decel_ticks, w, k);
+    int64_t rate = (w > 0) ? (2 * steps - k + w - 1) / w : 0;
+    return std::max(rate, std::max(accel_ticks > 0 ? initial : 0, final));
+}
+
 /* Calculates trapezoid parameters so that the entry- and exit-speed is compensated by the provided factors.
 // The factors represent a factor of braking and must be in the range 0.0-1.0.
 //                                +--------+ <- nominal_rate
@@ -121,8 +210,12 @@ void Block::debug() const
 */
 void Block::calculate_trapezoid( float entryspeed, float exitspeed )
 {
-    // if block is currently executing, don't touch anything!
-    if (is_ticking) return;
+    // locked first so the step ticker cannot start it part way through, then if it already has don't touch anything!
+    this->locked= true;
+    if (is_ticking) {
+        this->locked= false;
+        return;
+    }
 
     float initial_rate = this->nominal_rate * (entryspeed / this->nominal_speed); // steps/sec
     float final_rate = this->nominal_rate * (exitspeed / this->nominal_speed);
@@ -133,6 +226,17 @@ void Block::calculate_trapezoid( float entryspeed, float exitspeed )
 
     float maximum_possible_rate = sqrtf( ( this->steps_event_count * acceleration_per_second ) + ( ( powf(initial_rate, 2) + powf(final_rate, 2) ) / 2.0F ) );
 
+    // The S-curve ramps each take as long again as the acceleration takes to ramp up at the jerk rate, see s_curve_ramp_ticks().
+    // This takes both as long enough to reach the acceleration, a ramp that is not is shorter so the rate is a little under
+    // what the block could reach, but never below the entry or exit rate the planner found room for, see max_allowable_speed()
+    float jerk_per_second = (this->jerk * this->steps_event_count) / this->millimeters; // steps/s³
+    if(this->jerk > 0.0F) {
+        float h = acceleration_per_second * acceleration_per_second / (2.0F * jerk_per_second);
+        float c = this->steps_event_count * acceleration_per_second + (powf(initial_rate, 2) + powf(final_rate, 2)) / 2.0F - h * (initial_rate + final_rate);
+        float v = (c > 0.0F) ? c / (sqrtf(h * h + c) + h) : 0.0F; // sqrt(h² + c) - h, without losing c when h is large
+        maximum_possible_rate = std::max(v, std::max(initial_rate, final_rate));
+    }
+
     //printf("id %d: acceleration_per_second: %f, maximum_possible_rate: %f steps/sec, %f mm/sec\n", this->id, acceleration_per_second, maximum_possible_rate, maximum_possible_rate/100);
 
     // Now this is the maximum rate we'll achieve this move, either because
@@ -140,73 +244,98 @@ void Block::calculate_trapezoid( float entryspeed, float exitspeed )
     // allowed to achieve
     this->maximum_rate = std::min(maximum_possible_rate, this->nominal_rate);
 
-    // Now figure out how long it takes to accelerate in seconds
-    float time_to_accelerate = ( this->maximum_rate - initial_rate ) / acceleration_per_second;
-
-    // Now figure out how long it takes to decelerate
-    float time_to_decelerate = ( final_rate -  this->maximum_rate ) / -acceleration_per_second;
-
-    // Now we know how long it takes to accelerate and decelerate, but we must
-    // also know how long the entire move takes so we can figure out how long
-    // is the plateau if there is one
-    float plateau_time = 0;
-
-    // Only if there is actually a plateau ( we are limited by nominal_rate )
-    if(maximum_possible_rate > this->nominal_rate) {
-        // Figure out the acceleration and deceleration distances ( in steps )
-        float acceleration_distance = ( ( initial_rate + this->maximum_rate ) / 2.0F ) * time_to_accelerate;
-        float deceleration_distance = ( ( this->maximum_rate + final_rate ) / 2.0F ) * time_to_decelerate;
-
-        // Figure out the plateau steps
-        float plateau_distance = this->steps_event_count - acceleration_distance - deceleration_distance;
-
-        // Figure out the plateau time in seconds
-        plateau_time = plateau_distance / this->maximum_rate;
+    // From here on everything is worked out in ticks with integer math. The rates are in the 2.30 fixed point steps per
+    // tick the step ticker runs at, and the acceleration is in 2.62 so the ramps come out to well within a tick however
+    // long they are. Working out the times in float seconds and rounding them down to ticks lost whole ticks on long
+    // moves, and what the step ticker then ran did not add up to the steps of the block, so the last steps were forced
+    // out early by the rounding protection in StepTicker::step_tick().
+    // Instead the ramps are rounded to whole ticks, then the plateau is given the rate that makes the ticks add up to
+    // exactly the steps of the block, see plateau_rate() and sim/trapezoidtest.cpp
+    float frequency = STEP_TICKER_FREQUENCY;
+    int64_t maximum_rate_fp = std::max<int64_t>(1, STEPTICKER_TOFP(this->maximum_rate / frequency));
+    int64_t initial_rate_fp = std::min<int64_t>(maximum_rate_fp, STEPTICKER_TOFP(initial_rate / frequency));
+    int64_t final_rate_fp = std::min<int64_t>(maximum_rate_fp, STEPTICKER_TOFP(final_rate / frequency));
+    int64_t acceleration_fp = std::max<int64_t>(1, STEPTICKER_TOFP62(acceleration_per_second / STEP_TICKER_FREQUENCY_2)); // steps/tick²
+
+    uint32_t acceleration_ticks, deceleration_ticks;
+    uint32_t accel_jerk_ticks = 0, decel_jerk_ticks = 0;
+    if(this->jerk > 0.0F) {
+        acceleration_ticks = s_curve_ramp_ticks(maximum_rate_fp - initial_rate_fp, acceleration_fp, acceleration_per_second, jerk_per_second, accel_jerk_ticks);
+        deceleration_ticks = s_curve_ramp_ticks(maximum_rate_fp - final_rate_fp, acceleration_fp, acceleration_per_second, jerk_per_second, decel_jerk_ticks);
+    } else {
+        acceleration_ticks = (((uint64_t)(maximum_rate_fp - initial_rate_fp) << 32) + acceleration_fp / 2) / acceleration_fp;
+        deceleration_ticks = (((uint64_t)(maximum_rate_fp - final_rate_fp) << 32) + acceleration_fp / 2) / acceleration_fp;
+    }
+    if(acceleration_ticks == 0) initial_rate_fp = maximum_rate_fp; // less than half a tick of acceleration, start at the maximum rate
+
+    // the step ticker needs the tick at the end of the acceleration ramp for the plateau, see min_plateau_ticks()
+    bool jerk_limited = this->jerk > 0.0F && (acceleration_ticks > 0 || deceleration_ticks > 0);
+    uint32_t plateau_ticks = min_plateau_ticks(jerk_limited, acceleration_ticks, deceleration_ticks, 0);
+
+    int64_t steps_fp = (int64_t)this->steps_event_count << 30;
+    int64_t w, k;
+
+    // with no acceleration and an exit rate close to the entry rate the deceleration ramp rounded to whole ticks can cover
+    // more than the steps of the block on its own, it is then cut down so the rate does not have to drop below the exit rate.
+    // A shorter S-curve ramp would need more than the block's acceleration, so that starts below the entry rate instead, and
+    // is only cut down if it covers more than the steps even at the exit rate
+    if(acceleration_ticks == 0 && deceleration_ticks > 1) {
+        int64_t top = jerk_limited ? final_rate_fp : maximum_rate_fp;
+        int64_t shift = jerk_limited ? 2 : 1;
+        int64_t room = 2 * steps_fp - (2 * (int64_t)plateau_ticks - shift) * top - shift * final_rate_fp;
+        int64_t fit = std::max<int64_t>(1, room / std::max<int64_t>(1, top + final_rate_fp));
+        if(fit < deceleration_ticks) {
+            deceleration_ticks = fit;
+            decel_jerk_ticks = std::max<uint32_t>(1, std::min<uint32_t>(decel_jerk_ticks, fit / 2));
+            jerk_limited = this->jerk > 0.0F;
+            plateau_ticks = min_plateau_ticks(jerk_limited, acceleration_ticks, deceleration_ticks, 0);
+        }
     }
 
-    // Figure out how long the move takes total ( in seconds )
-    float total_move_time = time_to_accelerate + time_to_decelerate + plateau_time;
-    //puts "total move time: #{total_move_time}s time to accelerate: #{time_to_accelerate}, time to decelerate: #{time_to_decelerate}"
-
-    // We now have the full timing for acceleration, plateau and deceleration,
-    // yay \o/ Now this is very important these are in seconds, and we need to
-    // round them into ticks. This means instead of accelerating in 100.23
-    // ticks we'll accelerate in 100 ticks. Which means to reach the exact
-    // speed we want to reach, we must figure out a new/slightly different
-    // acceleration/deceleration to be sure we accelerate and decelerate at
-    // the exact rate we want
-
-    // First off round total time, acceleration time and deceleration time in ticks
-    uint32_t acceleration_ticks = floorf( time_to_accelerate * STEP_TICKER_FREQUENCY );
-    uint32_t deceleration_ticks = floorf( time_to_decelerate * STEP_TICKER_FREQUENCY );
-    uint32_t total_move_ticks   = floorf( total_move_time    * STEP_TICKER_FREQUENCY );
-
-    // Now deduce the plateau time for those new values expressed in tick
-    //uint32_t plateau_ticks = total_move_ticks - acceleration_ticks - deceleration_ticks;
-
-    // Now we figure out the acceleration value to reach EXACTLY maximum_rate(steps/s) in EXACTLY acceleration_ticks(ticks) amount of time in seconds
-    float acceleration_time = acceleration_ticks / STEP_TICKER_FREQUENCY;  // This can be moved into the operation below, separated for clarity, note we need to do this instead of using time_to_accelerate(seconds) directly because time_to_accelerate(seconds) and acceleration_ticks(seconds) do not have the same value anymore due to the rounding
-    float deceleration_time = deceleration_ticks / STEP_TICKER_FREQUENCY;
-
-    float acceleration_in_steps = (acceleration_time > 0.0F ) ? ( this->maximum_rate - initial_rate ) / acceleration_time : 0;
-    float deceleration_in_steps =  (deceleration_time > 0.0F ) ? ( this->maximum_rate - final_rate ) / deceleration_time : 0;
+    // then as many more plateau ticks as it takes to cover the steps without going over the maximum rate
+    distance_terms(jerk_limited, initial_rate_fp, final_rate_fp, acceleration_ticks, plateau_ticks, deceleration_ticks, w, k);
+    int64_t over = 2 * steps_fp - k - w * maximum_rate_fp;
+    if(over > 0) {
+        uint32_t more = (over + 2 * maximum_rate_fp - 1) / (2 * maximum_rate_fp);
+        plateau_ticks = min_plateau_ticks(jerk_limited, acceleration_ticks, deceleration_ticks, plateau_ticks + more);
+        // but not for the last fraction of a tick on a long move, going over by up to 1/4096 is better than a tick too long.
+        // Not on an S-curve, where that much on a small rate change would take the ramps over the block's acceleration
+        uint32_t fewer = min_plateau_ticks(jerk_limited, acceleration_ticks, deceleration_ticks, plateau_ticks - 1);
+        distance_terms(jerk_limited, initial_rate_fp, final_rate_fp, acceleration_ticks, fewer, deceleration_ticks, w, k);
+        if(!jerk_limited && fewer < plateau_ticks && 2 * steps_fp <= k + w * (maximum_rate_fp + (maximum_rate_fp >> 12))) {
+            plateau_ticks = fewer;
+        }
+    }
+    maximum_rate_fp = plateau_rate(jerk_limited, steps_fp, initial_rate_fp, final_rate_fp, acceleration_ticks, plateau_ticks, deceleration_ticks);
+    if(acceleration_ticks == 0) initial_rate_fp = maximum_rate_fp;
+    if(jerk_limited) {
+        accel_jerk_ticks = capped_jerk_ticks(maximum_rate_fp - initial_rate_fp, acceleration_fp, acceleration_ticks, accel_jerk_ticks);
+        decel_jerk_ticks = capped_jerk_ticks(maximum_rate_fp - final_rate_fp, acceleration_fp, deceleration_ticks, decel_jerk_ticks);
+    }
 
-    // we have a potential race condition here as we could get interrupted anywhere in the middle of this call, we need to lock
-    // the updates to the blocks to get around it
-    this->locked= true;
-    // Now figure out the two acceleration ramp change events in ticks
+    // Now figure out the two acceleration ramp change events in ticks, see prepare() for how they are used
     this->accelerate_until = acceleration_ticks;
-    this->decelerate_after = total_move_ticks - deceleration_ticks;
+    if(jerk_limited || plateau_ticks == 0) {
+        this->decelerate_after = acceleration_ticks + plateau_ticks;
+    } else {
+        this->decelerate_after = acceleration_ticks + plateau_ticks - 1;
+    }
+    this->total_move_ticks = this->decelerate_after + deceleration_ticks;
 
-    // Now figure out the acceleration PER TICK, this should ideally be held as a float, even a double if possible as it's very critical to the block timing
-    // steps/tick^2
+    this->initial_rate_fp = initial_rate_fp;
+    this->maximum_rate_fp = maximum_rate_fp;
+    this->final_rate_fp = final_rate_fp;
 
-    this->acceleration_per_tick =  acceleration_in_steps / STEP_TICKER_FREQUENCY_2;
-    this->deceleration_per_tick = deceleration_in_steps / STEP_TICKER_FREQUENCY_2;
+    // steps/tick^2, these and the rates in steps/sec are only for reporting and the S-curve, the step ticker is set up from the fixed point rates
+    this->acceleration_per_tick = (acceleration_ticks > 0) ? STEPTICKER_FROMFP(maximum_rate_fp - initial_rate_fp) / acceleration_ticks : 0;
+    this->deceleration_per_tick = (deceleration_ticks > 0) ? STEPTICKER_FROMFP(maximum_rate_fp - final_rate_fp) / deceleration_ticks : 0;
+    this->maximum_rate = STEPTICKER_FROMFP(maximum_rate_fp) * frequency;
+    initial_rate = STEPTICKER_FROMFP(initial_rate_fp) * frequency;
+    final_rate = STEPTICKER_FROMFP(final_rate_fp) * frequency;
 
-    // We now have everything we need for this block to call a Steppermotor->move method !!!!
-    // Theorically, if accel is done per tick, the speed curve should be perfect.
-    this->total_move_ticks = total_move_ticks;
+    this->s_curve= jerk_limited;
+    this->accel_jerk_ticks= accel_jerk_ticks;
+    this->decel_jerk_ticks= decel_jerk_ticks;
 
     //puts "accelerate_until: #{this->accelerate_until}, decelerate_after: #{this->decelerate_after}, acceleration_per_tick: #{this->acceleration_per_tick}, total_move_ticks: #{this->total_move_ticks}"
 
@@ -215,14 +344,34 @@ void Block::calculate_trapezoid( float entryspeed, float exitspeed )
 
     // prepare the block for stepticker
     this->prepare();
+    this->is_prepared= true;
     this->locked= false;
 }
 
 // Calculates the maximum allowable speed at this point when you must be able to reach target_velocity using the
 // acceleration within the allotted distance.
+// With the S-curve the speed change also takes the time the acceleration ramps up and down at the jerk rate, so needs
+// more distance, see s_curve_ramp_ticks(). Either way the ramp covers the time it takes at the average of the two speeds.
 float Block::max_allowable_speed(float acceleration, float target_velocity, float distance)
 {
-    return sqrtf(target_velocity * target_velocity - 2.0F * acceleration * distance);
+    if(this->jerk <= 0.0F) return sqrtf(target_velocity * target_velocity - 2.0F * acceleration * distance);
+
+    // a ramp that reaches the acceleration takes dv / a + a / jerk, so covers (v² - target²) / 2a + (v + target) * a / 2jerk
+    float a = -acceleration;
+    float h = a * a / (2.0F * this->jerk);
+    float v = sqrtf(powf(target_velocity - h, 2) + 2.0F * a * distance) - h;
+    if(v - target_velocity >= 2.0F * h) return v;
+
+    // a shorter one ramps the acceleration up for t and straight back down, changing the speed by jerk * t² over 2t, so
+    // covers (2 * target + jerk * t²) * t. That is convex in t, so Newton's method from above the root closes in on it
+    // from above, starting within twice it five steps are within float precision
+    float t = std::min(a / this->jerk, cbrtf(distance / this->jerk));
+    if(target_velocity > 0.0F) t = std::min(t, distance / (2.0F * target_velocity));
+    if(t <= 0.0F) return target_velocity;
+    for (int i = 0; i < 5; i++) {
+        t -= ((2.0F * target_velocity + this->jerk * t * t) * t - distance) / (2.0F * target_velocity + 3.0F * this->jerk * t * t);
+    }
+    return target_velocity + this->jerk * t * t;
 }
 
 // Called by Planner::recalculate() when scanning the plan from last to first entry.
@@ -248,6 +397,15 @@ float Block::reverse_pass(float exit_speed)
 }
 
 
+// Called by Planner::recalculate() with the planned exit speed. A block Conveyor::prepare_blocks() has not got to yet just
+// keeps it, one it has is worked out again straight away so the step ticker never finds it unprepared
+void Block::set_exit_speed(float exitspeed)
+{
+    if(is_ticking) return;
+    exit_speed= exitspeed;
+    if(is_prepared) calculate_trapezoid(entry_speed, exit_speed);
+}
+
 // Called by Planner::recalculate() when scanning the plan from first to last entry.
 // returns maximum exit speed of this block
 float Block::forward_pass(float prev_max_exit_speed)
@@ -299,37 +457,75 @@ float Block::max_exit_speed()
 // this is done during planning so does not delay tick generation and step ticker can simply grab the next block during the interrupt
 void Block::prepare()
 {
-    float inv = 1.0F / this->steps_event_count;
+    // the ramps and plateau in ticks, as calculate_trapezoid() worked them out
+    uint32_t acceleration_ticks = this->accelerate_until;
+    uint32_t deceleration_ticks = this->total_move_ticks - this->decelerate_after;
+    uint32_t plateau_ticks = this->decelerate_after - this->accelerate_until;
+    if(!this->s_curve && (this->accelerate_until > 0 || this->decelerate_after > 0 || deceleration_ticks == 0)) plateau_ticks++;
+
+    uint8_t n = 0;
     for (uint8_t m = 0; m < n_actuators; m++) {
         uint32_t steps = this->steps[m];
-        this->tick_info[m].steps_to_move = steps;
         if(steps == 0) continue;
 
-        float aratio = inv * steps;
-        this->tick_info[m].steps_per_tick = STEPTICKER_TOFP((this->initial_rate * aratio) / STEP_TICKER_FREQUENCY); // steps/sec / tick frequency to get steps per tick in 2.30 fixed point
-        this->tick_info[m].counter = 0; // 2.30 fixed point
-        this->tick_info[m].step_count = 0;
-        this->tick_info[m].next_accel_event = this->total_move_ticks + 1;
+        // motors with no steps get no entry at all
+        tickinfo_t &ti = this->tick_info[n++];
+        ti.motor = m;
+        ti.steps_to_move = steps;
+
+        // each motor gets the plateau rate that covers exactly its own steps, rather than the primary axis rate scaled, so
+        // the rounding to 2.30 never leaves one of them short of steps at the end of the block
+        int64_t steps_fp = (int64_t)steps << 30;
+        int64_t initial = (int64_t)this->initial_rate_fp * steps / this->steps_event_count; // 2.30 fixed point steps per tick
+        int64_t final = (int64_t)this->final_rate_fp * steps / this->steps_event_count;
+        int64_t plateau = plateau_rate(this->s_curve, steps_fp, initial, final, acceleration_ticks, plateau_ticks, deceleration_ticks);
+
+        ti.counter = 0; // 2.30 fixed point
+        ti.step_count = 0;
+        ti.next_accel_event = this->total_move_ticks + 1;
+        ti.acceleration_change = 0;
+        ti.deceleration_change = 0;
+
+        if(!this->s_curve) {
+            // in 2.62 so the ramps end within a fraction of a 2.30 step per tick of the plateau however slow they are, the
+            // acceleration rounded up and the deceleration down so neither ever covers less than plateau_rate() allowed for
+            ti.acceleration_change = (acceleration_ticks > 0) ? (((plateau - initial) << 32) + acceleration_ticks - 1) / acceleration_ticks : 0;
+            ti.deceleration_change = (deceleration_ticks > 0) ? -(((plateau - final) << 32) / deceleration_ticks) : 0;
+        }
+
+        ti.plateau_rate = plateau;
+        ti.steps_per_tick = (acceleration_ticks > 0) ? initial : plateau;
 
-        float acceleration_change = 0;
         if(this->accelerate_until != 0) { // If the next accel event is the end of accel
-            this->tick_info[m].next_accel_event = this->accelerate_until;
-            acceleration_change = this->acceleration_per_tick;
+            ti.next_accel_event = this->accelerate_until;
 
         } else if(this->decelerate_after == 0 /*&& this->accelerate_until == 0*/) {
             // we start off decelerating
-            acceleration_change = -this->deceleration_per_tick;
+            ti.acceleration_change = ti.deceleration_change;
 
         } else if(this->decelerate_after != this->total_move_ticks /*&& this->accelerate_until == 0*/) {
             // If the next event is the start of decel ( don't set this if the next accel event is accel end )
-            this->tick_info[m].next_accel_event = this->decelerate_after;
+            ti.next_accel_event = this->decelerate_after;
         }
 
-        // convert to fixed point after scaling
-        this->tick_info[m].acceleration_change= STEPTICKER_TOFP(acceleration_change * aratio);
-        this->tick_info[m].deceleration_change= -STEPTICKER_TOFP(this->deceleration_per_tick * aratio);
-        this->tick_info[m].plateau_rate= STEPTICKER_TOFP((this->maximum_rate * aratio) / STEP_TICKER_FREQUENCY);
+        if(this->s_curve) {
+            // the jerk that changes the rate by exactly the ramp's rate change, given the discrete steps the step ticker takes:
+            // over j ticks of jerk up, ramp-2j ticks of constant acceleration and j ticks of jerk down the rate changes by jerk * j * (ramp - j).
+            // The peak acceleration jerk * j is then the rate change over ramp-j ticks, which s_curve_ramp_ticks() made no more than the block's
+            // in 2.62, the acceleration rounded up and the deceleration down so neither covers less than plateau_rate() allowed for,
+            // the plateau then starts on exactly its rate
+            uint32_t j = this->accel_jerk_ticks;
+            int64_t d = std::max<int64_t>(1, (int64_t)j * (acceleration_ticks - j));
+            ti.accel_jerk = (j > 0) ? (((plateau - initial) << 32) + d - 1) / d : 0;
+
+            j = this->decel_jerk_ticks;
+            ti.decel_jerk = (j > 0) ? ((plateau - final) << 32) / std::max<int64_t>(1, (int64_t)j * (deceleration_ticks - j)) : 0;
+
+            ti.next_accel_event = this->accel_jerk_ticks;
+        }
     }
+
+    this->n_active_motors = n;
 }
 
 // returns current rate (steps/sec) for the given actuator
@@ -337,5 +533,9 @@ float Block::get_trapezoid_rate(int i) const
 {
     // convert steps per tick from fixed point to float and convert to steps/sec
     // FIXME steps_per_tick can change at any time, potential race condition if it changes while being read here
-    return STEPTICKER_FROMFP(tick_info[i].steps_per_tick) * STEP_TICKER_FREQUENCY;
+    for (uint8_t n = 0; n < n_active_motors; n++) {
+        if(tick_info[n].motor == i) return STEPTICKER_FROMFP(tick_info[n].steps_per_tick) * STEP_TICKER_FREQUENCY;
+    }
+    return 0; // not moving in this block
+
 }
@@ -9,8 +9,11 @@
 
 #include <vector>
 #include <bitset>
+#include <stdint.h>
 #include "ActuatorCoordinates.h"
 
+class ArcPath;
+
 class Block {
     public:
         Block();
@@ -22,6 +25,8 @@ class Block {
         float max_exit_speed();
         void debug() const;
         void ready() { is_ready= true; }
+        // the planner only sets the speeds, the trapezoid is worked out by Conveyor::prepare_blocks() and then kept up to date
+        void set_exit_speed(float exitspeed);
         void clear();
         void prepare();
 
@@ -35,9 +40,15 @@ class Block {
         float entry_speed;
         float exit_speed;
         float acceleration;       // the acceleration for this block
+        float jerk;               // mm/sec³ for the jerk limited (S-curve) profile, 0 for a plain trapezoid
         float initial_rate;       // Initial rate in steps per second
         float maximum_rate;
 
+        // the same rates for the primary axis in 2.30 fixed point steps per tick, the rates the step ticker actually runs at
+        int32_t initial_rate_fp;
+        int32_t maximum_rate_fp;
+        int32_t final_rate_fp;
+
         float acceleration_per_tick{0};
         float deceleration_per_tick {0};
 
@@ -47,33 +58,66 @@ class Block {
         uint32_t accelerate_until;
         uint32_t decelerate_after;
         uint32_t total_move_ticks;
+        uint32_t accel_jerk_ticks;   // S-curve only, ticks at each end of the acceleration ramp while the acceleration changes
+        uint32_t decel_jerk_ticks;   // S-curve only, same for the deceleration ramp
         std::bitset<k_max_actuators> direction_bits;     // Direction for each axis in bit form, relative to the direction port's mask
 
         // this is the data needed to determine when each motor needs to be issued a step
         using tickinfo_t= struct {
             int32_t steps_per_tick; // 2.30 fixed point
-            int32_t counter; // 2.30 fixed point
-            int32_t acceleration_change; // 2.30 fixed point signed
-            int32_t deceleration_change; // 2.30 fixed point
+            uint32_t counter; // 2.30 fixed point, unsigned as it can reach 3.0 when stepping twice per tick
+            // an S-curve block ramps the acceleration instead, so has its jerks in the same place
+            union {
+                int64_t acceleration_change; // 2.62 fixed point signed
+                int64_t accel_jerk;          // 2.62 fixed point, S-curve only
+            };
+            union {
+                int64_t deceleration_change; // 2.62 fixed point
+                int64_t decel_jerk;          // 2.62 fixed point, S-curve only
+            };
             int32_t plateau_rate; // 2.30 fixed point
             uint32_t steps_to_move;
             uint32_t step_count;
             uint32_t next_accel_event;
+            uint8_t motor;      // the motor this entry is for
         };
 
-        // need info for each active motor
+        // the tick at which the given phase of the S-curve ends
+        // 0: jerk up, 1: constant acceleration, 2: jerk down, 3: plateau, 4: jerk down, 5: constant deceleration, 6: jerk up
+        uint32_t s_curve_phase_end(uint8_t phase) const
+        {
+            switch(phase) {
+                case 0: return accel_jerk_ticks;
+                case 1: return accelerate_until - accel_jerk_ticks;
+                case 2: return accelerate_until;
+                case 3: return decelerate_after;
+                case 4: return decelerate_after + decel_jerk_ticks;
+                case 5: return total_move_ticks - decel_jerk_ticks;
+                default: return UINT32_MAX;
+            }
+        }
+
+        // need info for each active motor, only the first n_active_motors entries are used so the step ticker skips idle motors
         //std::array<tickinfo_t, k_max_actuators> tick_info;
         std::vector<tickinfo_t> tick_info;
+        uint8_t n_active_motors;
         static uint8_t n_actuators;
 
+        // set when the block is a whole arc, which the step ticker runs as chords, see ArcPath
+        ArcPath *arc{nullptr};
+
+        // not in the bit fields below as these are set from the step ticker interrupt while the rest are being written
+        volatile bool is_ticking;            // set when this block is being actively ticked by the stepticker
+        volatile bool locked;                // set to true when the critical data is being updated, stepticker will have to skip if this is set
+
         struct {
             bool recalculate_flag:1;             // Planner flag to recalculate trapezoids on entry junction
             bool nominal_length_flag:1;          // Planner flag for nominal speed always reached
             bool is_ready:1;
+            volatile bool is_prepared:1;         // set when the trapezoid and tick_info match the planned entry and exit speeds
             bool primary_axis:1;                 // set if this move is a primary axis
             bool is_g123:1;                      // set if this is a G1, G2 or G3
-            volatile bool is_ticking:1;          // set when this block is being actively ticked by the stepticker
-            volatile bool locked:1;              // set to true when the critical data is being updated, stepticker will have to skip if this is set
+            bool s_curve:1;                      // set if the step ticker should run the jerk limited profile
             uint16_t s_value:12;                 // for laser 1.11 Fixed point
         };
 };
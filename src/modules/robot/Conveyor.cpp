@@ -23,13 +23,16 @@
 #include "StepTicker.h"
 #include "Robot.h"
 #include "StepperMotor.h"
+#include "ArcPath.h"
 
 #include <functional>
 #include <vector>
+#include <algorithm>
 
 #include "mbed.h"
 
 #define planner_queue_size_checksum CHECKSUM("planner_queue_size")
+#define planner_prepare_window_checksum CHECKSUM("planner_prepare_window")
 #define queue_delay_time_ms_checksum CHECKSUM("queue_delay_time_ms")
 
 /*
@@ -77,6 +80,7 @@ void Conveyor::on_module_loaded()
     //THEKERNEL->step_ticker->finished_fnc = std::bind( &Conveyor::all_moves_finished, this);
     queue_size = THEKERNEL->config->value(planner_queue_size_checksum)->by_default(32)->as_number();
     queue_delay_time_ms = THEKERNEL->config->value(queue_delay_time_ms_checksum)->by_default(100)->as_number();
+    prepare_window = std::max(1, THEKERNEL->config->value(planner_prepare_window_checksum)->by_default(4)->as_int());
 }
 
 // we allocate the queue here after config is completed so we do not run out of memory during config
@@ -84,6 +88,11 @@ void Conveyor::start(uint8_t n)
 {
     Block::n_actuators= n; // set the number of motors which determines how big the tick info vector is
     queue.resize(queue_size);
+    chords= new chord_t[k_arc_chords];
+    for (uint8_t i = 0; i < k_arc_chords; i++) {
+        chords[i].block= new Block();
+        chords[i].parent= nullptr;
+    }
     running = true;
 }
 
@@ -103,6 +112,9 @@ void Conveyor::on_idle(void*)
         check_queue();
     }
 
+    // keep the trapezoids ready ahead of the step ticker as it moves through the queue
+    prepare_blocks();
+
     // we can garbage collect the block queue here
     if (queue.tail_i != queue.isr_tail_i) {
         if (queue.is_empty()) {
@@ -132,9 +144,19 @@ bool Conveyor::is_idle() const
     return false;
 }
 
+// number of blocks on the queue the step ticker has not finished yet
+unsigned int Conveyor::get_queued_blocks() const
+{
+    unsigned int head_i= queue.head_i, isr_tail_i= queue.isr_tail_i;
+    return head_i >= isr_tail_i ? head_i - isr_tail_i : head_i + queue.length - isr_tail_i;
+}
+
 // Wait for the queue to be empty and for all the jobs to finish in step ticker
 void Conveyor::wait_for_idle(bool wait_for_motors)
 {
+    // anything Robot is still merging has to go on the queue first
+    THEROBOT->flush_merged_segments();
+
     // wait for the job queue to empty, this means cycling everything on the block queue into the job queue
     // forcing them to be jobs
     running = false; // stops on_idle calling check_queue
@@ -205,6 +227,7 @@ bool Conveyor::get_next_block(Block **block)
         while (queue.isr_tail_i != queue.head_i) {
             queue.isr_tail_i = queue.next(queue.isr_tail_i);
         }
+        chord_tail= chord_head;
     }
 
     // default the feerate to zero if there is no block available
@@ -216,23 +239,162 @@ bool Conveyor::get_next_block(Block **block)
     if(!allow_fetch) return false;
 
     Block *b= queue.item_ref(queue.isr_tail_i);
+
+    // an arc is run as its chords
+    if(b->arc != nullptr) {
+        if(!b->is_ready) __debugbreak(); // should never happen
+        Block *chord= next_chord(b);
+        if(chord == nullptr) {
+            // once it has no more chords it is finished and the next block can start on this tick
+            return (b != queue.item_ref(queue.isr_tail_i)) ? get_next_block(block) : false;
+        }
+        b= chord;
+    }
+
     // we cannot use this now if it is being updated
     if(!b->locked) {
         if(!b->is_ready) __debugbreak(); // should never happen
 
+        // prepare_blocks() has not got to it, the main loop has been held up for the whole window. The trapezoid is too
+        // slow to work out here so it is made from PendSV, which runs as soon as the interrupts above it return, see
+        // prepare_next_blocks()
+        if(!b->is_prepared) {
+            THEKERNEL->step_ticker->pend_finish();
+            return false;
+        }
+
         b->is_ticking= true;
         b->recalculate_flag= false;
         this->current_feedrate= b->nominal_speed;
         *block= b;
+
+        // the chords of an arc after it can be made now its exit speed is fixed, see fill_chords(), and the next block
+        // is prepared while this one runs if the main loop has not got to it
+        unsigned int next= queue.next(queue.isr_tail_i);
+        if(next != queue.head_i && (queue.item_ref(next)->arc != nullptr || !queue.item_ref(next)->is_prepared)) THEKERNEL->step_ticker->pend_finish();
         return true;
     }
 
     return false;
 }
 
+// work out the trapezoid and tick info for every block whose speeds can no longer change, those behind the planned block,
+// and for the next prepare_window blocks after them, which may still be replanned but are kept up to date once prepared.
+// The rest only have their speeds planned, as they will most likely be replanned before they are needed
+void Conveyor::prepare_blocks()
+{
+    unsigned int i= queue.isr_tail_i; // can be moved on by the step ticker at any time
+    unsigned int planned= (THEKERNEL->planner->get_planned_i() + queue.length - i) % queue.length;
+    unsigned int queued= (queue.head_i + queue.length - i) % queue.length;
+    // the planned block may be one the step ticker has already finished
+    if(planned > queued) planned= 0;
+
+    for (uint32_t n = 0, unplanned = 0; unplanned < prepare_window; ++n) {
+        Block *b= queue.item_ref(i);
+        // the head block is included once it is ready, which is before it gets queued
+        if(!b->is_ready) break;
+        if(n >= planned) ++unplanned;
+        // an arc has a trapezoid for each chord instead
+        if(!b->is_prepared && b->arc == nullptr) b->calculate_trapezoid(b->entry_speed, b->exit_speed);
+        if(i == queue.head_i) break;
+        i= queue.next(i);
+    }
+
+    // the chords of an arc are made from PendSV, see fill_chords()
+    i= queue.isr_tail_i;
+    for (int n = 0; n < 2 && i != queue.head_i; n++, i= queue.next(i)) {
+        if(queue.item_ref(i)->arc != nullptr) {
+            THEKERNEL->step_ticker->pend_finish();
+            break;
+        }
+    }
+}
+
+// work out the trapezoids of the blocks the step ticker gets to next when prepare_blocks() has not, as the main loop is held
+// up. Called from PendSV, see StepTicker::handle_finish(), which the step ticker pends as it takes a block whose next one is
+// not prepared and waits for if it gets to it first. Not while the main loop is replanning, as the speeds may be half way
+// through changing, it prepares them itself straight after
+void Conveyor::prepare_next_blocks()
+{
+    if(halted || flush || replanning) return;
+
+    unsigned int i= queue.isr_tail_i;
+    for (int n = 0; n < 3 && i != queue.head_i; n++, i= queue.next(i)) {
+        Block *b= queue.item_ref(i);
+        // an arc has a trapezoid for each chord instead, made by fill_chords(). A locked one is being worked out by the
+        // main loop this interrupted, the step ticker waits for it to finish
+        if(!b->is_prepared && !b->locked && b->arc == nullptr) b->calculate_trapezoid(b->entry_speed, b->exit_speed);
+    }
+}
+
+// called from step ticker ISR, the chord to run next of the arc parent which is on the tail of the queue
+// nullptr if there is none yet, or if the arc is finished in which case it is taken off the queue
+// the chords are too slow to make here, they are made by fill_chords() which is pended to make the next one
+Block *Conveyor::next_chord(Block *parent)
+{
+    if(chord_tail != chord_head && chords[chord_tail].parent == parent) {
+        THEKERNEL->step_ticker->pend_finish();
+        return chords[chord_tail].block;
+    }
+
+    // it is being made right now, or has not been got to yet, which only happens if PendSV has been held up
+    if(filling || !parent->arc->is_done()) {
+        THEKERNEL->step_ticker->pend_finish();
+        return nullptr;
+    }
+
+    // all its chords have been run
+    queue.isr_tail_i= queue.next(queue.isr_tail_i);
+    return nullptr;
+}
+
+// make the chords of the arc the step ticker is on or gets to next, as many as there is room for
+// only one arc has chords made at a time, the chords of the next are made once all of the current one are made
+// called from the PendSV interrupt, see StepTicker::handle_finish(), which the step ticker pends whenever it takes or
+// finishes a chord and prepare_blocks() whenever there is an arc to start. It is below the timers and the comms interrupts,
+// which it would hold up, and above the main loop, so the chords are made ahead of the step ticker however long the main
+// loop is held up
+void Conveyor::fill_chords()
+{
+    if(chords == nullptr || halted || flush) return;
+
+    unsigned int i= queue.isr_tail_i;
+    for (int n = 0; n < 2 && i != queue.head_i; n++, i= queue.next(i)) {
+        Block *b= queue.item_ref(i);
+        if(b->arc == nullptr || b->arc->is_done()) continue;
+
+        // the next block can only be fixed once the one before it is, as its entry speed can change until then
+        if(n > 0 && !queue.item_ref(queue.isr_tail_i)->is_ticking) break;
+
+        // the first chord fixes the speeds of the arc, which the main loop may be in the middle of planning. It is
+        // pended again once it has finished
+        if(b->arc->chord_i == 0 && replanning) break;
+
+        // the step ticker does not take it off the queue while this is set, it may finish one it has run meanwhile
+        b->is_ticking= true;
+        filling= true;
+        while((chord_head + 1) % k_arc_chords != chord_tail && !b->arc->is_done() && !flush) {
+            chord_t &c= chords[chord_head];
+            if(b->arc->next_chord(b, c.block)) {
+                c.parent= b;
+                chord_head= (chord_head + 1) % k_arc_chords;
+            }
+        }
+        filling= false;
+        break;
+    }
+}
+
 // called from step ticker ISR when block is finished, do not do anything slow here
 void Conveyor::block_finished()
 {
+    // a chord of an arc, the arc itself is finished by next_chord() once it has run all of them
+    if(queue.item_ref(queue.isr_tail_i)->arc != nullptr) {
+        chord_tail= (chord_tail + 1) % k_arc_chords;
+        THEKERNEL->step_ticker->pend_finish();
+        return;
+    }
+
     // we increment the isr_tail_i so we can get the next block
     queue.isr_tail_i= queue.next(queue.isr_tail_i);
 }
@@ -254,6 +416,9 @@ void Conveyor::flush_queue()
     // now wait until the block queue has been flushed
     wait_for_idle(false);
 
+    // and drop any chords of the arcs that were on it
+    chord_tail= chord_head;
+
     flush= false;
 }
 
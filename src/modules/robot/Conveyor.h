@@ -27,10 +27,15 @@ public:
     bool is_queue_empty() { return queue.is_empty(); };
     bool is_queue_full() { return queue.is_full(); };
     bool is_idle() const;
+    unsigned int get_queued_blocks() const;
+    unsigned int get_free_blocks() const { return queue.length - 1 - get_queued_blocks(); }
 
     // returns next available block writes it to block and returns true
     bool get_next_block(Block **block);
+    void prepare_blocks();
+    void prepare_next_blocks();
     void block_finished();
+    void fill_chords();
 
     void dump_queue(void);
     void flush_queue(void);
@@ -42,6 +47,7 @@ private:
     // void all_moves_finished();
     void check_queue(bool force= false);
     void queue_head_block(void);
+    Block *next_chord(Block *parent);
 
     using  Queue_t= HeapRing<Block>;
     Queue_t queue;  // Queue of Blocks
@@ -49,8 +55,21 @@ private:
 
     uint32_t queue_delay_time_ms;
     size_t queue_size;
+    uint32_t prepare_window;   // number of blocks ahead of the step ticker that have their trapezoids worked out
     float current_feedrate{0}; // actual nominal feedrate that current block is running at in mm/sec
 
+    // the chords of arc blocks, made by fill_chords() from PendSV and run by the step ticker, see ArcPath
+    static const uint8_t k_arc_chords= 4;
+    struct chord_t {
+        Block *block;
+        Block *parent;                       // the arc block it is a chord of
+    };
+    chord_t *chords{nullptr};
+    volatile uint8_t chord_head{0};          // where the next chord is made
+    volatile uint8_t chord_tail{0};          // the chord the step ticker is on or gets next
+    volatile bool filling{false};            // set while fill_chords() is making one, the step ticker then waits for it
+    volatile bool replanning{false};         // set by the planner while it changes the speeds of queued blocks
+
     struct {
         volatile bool running:1;
         volatile bool halted:1;
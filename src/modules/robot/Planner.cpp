@@ -22,6 +22,7 @@ using namespace std;
 #include "checksumm.h"
 #include "Robot.h"
 #include "ConfigValue.h"
+#include "ArcPath.h"
 
 #include <math.h>
 #include <algorithm>
@@ -29,6 +30,7 @@ using namespace std;
 #define junction_deviation_checksum    CHECKSUM("junction_deviation")
 #define z_junction_deviation_checksum  CHECKSUM("z_junction_deviation")
 #define minimum_planner_speed_checksum CHECKSUM("minimum_planner_speed")
+#define s_curve_jerk_checksum          CHECKSUM("s_curve_jerk")
 
 // The Planner does the acceleration math for the queue of Blocks ( movements ).
 // It makes sure the speed stays within the configured constraints ( acceleration, junction_deviation, etc )
@@ -37,6 +39,7 @@ using namespace std;
 Planner::Planner()
 {
     memset(this->previous_unit_vec, 0, sizeof this->previous_unit_vec);
+    planned_i= 0;
     config_load();
 }
 
@@ -46,12 +49,18 @@ void Planner::config_load()
     this->junction_deviation = THEKERNEL->config->value(junction_deviation_checksum)->by_default(0.05F)->as_number();
     this->z_junction_deviation = THEKERNEL->config->value(z_junction_deviation_checksum)->by_default(NAN)->as_number(); // disabled by default
     this->minimum_planner_speed = THEKERNEL->config->value(minimum_planner_speed_checksum)->by_default(0.0f)->as_number();
+    this->s_curve_jerk = THEKERNEL->config->value(s_curve_jerk_checksum)->by_default(0.0f)->as_number(); // disabled by default
 }
 
 
 // Append a block to the queue, compute it's speed factors
-bool Planner::append_block( ActuatorCoordinates &actuator_pos, uint8_t n_motors, float rate_mm_s, float distance, float *unit_vec, float acceleration, float s_value, bool g123)
+// for an arc the block takes ownership of arc, unit_vec is the direction the arc starts off in and end_unit_vec the one it ends in
+bool Planner::append_block( ActuatorCoordinates &actuator_pos, uint8_t n_motors, float rate_mm_s, float distance, float *unit_vec, float acceleration, float s_value, bool g123, ArcPath *arc, const float *end_unit_vec)
 {
+#ifdef PLANNER_STATS
+    planner_stats_append_begin();
+#endif
+
     // Create ( recycle ) a new block
     Block* block = THECONVEYOR->queue.head_ref();
 
@@ -72,21 +81,26 @@ bool Planner::append_block( ActuatorCoordinates &actuator_pos, uint8_t n_motors,
     }
 
     // sometimes even though there is a detectable movement it turns out there are no steps to be had from such a small move
-    if(!has_steps) {
+    // an arc can end where it started, whether it has any steps is only known once its chords are made
+    if(!has_steps && arc == nullptr) {
         block->clear();
+#ifdef PLANNER_STATS
+        planner_stats_append_end();
+#endif
         return false;
     }
 
     // info needed by laser
     block->s_value = roundf(s_value*(1<<11)); // 1.11 fixed point
     block->is_g123 = g123;
+    block->arc = arc;
 
     // use default JD
     float junction_deviation = this->junction_deviation;
 
     // use either regular junction deviation or z specific and see if a primary axis move
     block->primary_axis = true;
-    if(block->steps[ALPHA_STEPPER] == 0 && block->steps[BETA_STEPPER] == 0) {
+    if(arc == nullptr && block->steps[ALPHA_STEPPER] == 0 && block->steps[BETA_STEPPER] == 0) {
         if(block->steps[GAMMA_STEPPER] != 0) {
             // z only move
             if(!isnan(this->z_junction_deviation)) junction_deviation = this->z_junction_deviation;
@@ -107,6 +121,7 @@ bool Planner::append_block( ActuatorCoordinates &actuator_pos, uint8_t n_motors,
     }
 
     block->acceleration = acceleration; // save in block
+    block->jerk = s_curve_jerk;
 
     // Max number of steps, for all axes
     auto mi = std::max_element(block->steps.begin(), block->steps.end());
@@ -174,7 +189,7 @@ bool Planner::append_block( ActuatorCoordinates &actuator_pos, uint8_t n_motors,
     block->max_entry_speed = vmax_junction;
 
     // Initialize block entry speed. Compute based on deceleration to user-defined minimum_planner_speed.
-    float v_allowable = max_allowable_speed(-acceleration, minimum_planner_speed, block->millimeters);
+    float v_allowable = block->max_allowable_speed(-acceleration, minimum_planner_speed, block->millimeters);
     block->entry_speed = std::min(vmax_junction, v_allowable);
 
     // Initialize planner efficiency flags
@@ -192,18 +207,32 @@ bool Planner::append_block( ActuatorCoordinates &actuator_pos, uint8_t n_motors,
     block->recalculate_flag = true;
 
     // Update previous path unit_vector and nominal speed
-    if(unit_vec != nullptr) {
+    if(end_unit_vec != nullptr) {
+        memcpy(previous_unit_vec, end_unit_vec, sizeof(previous_unit_vec)); // the next block joins the arc where it ends
+    } else if(unit_vec != nullptr) {
         memcpy(previous_unit_vec, unit_vec, sizeof(previous_unit_vec)); // previous_unit_vec[] = unit_vec[]
     } else {
         memset(previous_unit_vec, 0, sizeof(previous_unit_vec));
     }
 
     // Math-heavy re-computing of the whole queue to take the new
+    // an arc is not started from PendSV meanwhile, as that fixes its speeds
+    THECONVEYOR->replanning= true;
     this->recalculate();
+    THECONVEYOR->replanning= false;
 
     // The block can now be used
     block->ready();
 
+    // work out the trapezoids for the blocks the step ticker will get to next, the rest are left until they get closer
+    // as they will most likely be replanned again before then
+    THECONVEYOR->prepare_blocks();
+
+#ifdef PLANNER_STATS
+    // the time spent waiting for room in the queue is not part of the append
+    planner_stats_append_end();
+#endif
+
     THECONVEYOR->queue_head_block();
 
     return true;
@@ -225,11 +254,11 @@ void Planner::recalculate()
      *
      * for each block, walking backwards in the queue:
      *
-     * if max entry speed == current entry speed
-     * then we can set recalculate to false, since clearly adding another block didn't allow us to enter faster
-     * and thus we don't need to check entry speed for this block any more
+     * stop at the planned boundary (planned_i), this is the newest block whose entry speed can no longer change.
+     * a block is planned once it is accel limited or at its max entry speed, as nothing appended after it can
+     * let it enter any faster, and so nothing before it can change either (as newer Grbl does)
      *
-     * once we find an accel limited block, we must find the max exit speed and walk the queue forwards
+     * then walk the queue forwards from the planned block
      *
      * for each block, walking forwards in the queue:
      *
@@ -237,17 +266,22 @@ void Planner::recalculate()
      * we can tell if we're accel or decel limited (or coasting)
      *
      * if prev_exit > max_entry
-     *     then we're still decel limited. update previous trapezoid with our max entry for prev exit
+     *     then we're still decel limited. update previous exit speed with our max entry
      * if max_entry >= prev_exit
-     *     then we're accel limited. set recalculate to false, work out max exit speed
+     *     then we're accel limited. set recalculate to false, move the planned boundary up to here, work out max exit speed
      *
-     * finally, work out trapezoid for the final (and newest) block.
+     * finally, the final (and newest) block has to stop at the end.
+     *
+     * only the speeds are planned here, the trapezoids are worked out by Conveyor::prepare_blocks()
+     *
+     * so on long runs only the blocks that are still decelerating towards the end of the queue are touched,
+     * not the whole queue.
      */
 
-    /*
-     * Step 1:
-     * For each block, given the exit speed and acceleration, find the maximum entry speed
-     */
+#ifdef PLANNER_STATS
+    planner_stats_recalculate_begin();
+    uint32_t blocks_touched= 1;
+#endif
 
     float entry_speed = minimum_planner_speed;
 
@@ -255,8 +289,28 @@ void Planner::recalculate()
     current     = queue.item_ref(block_index);
 
     if (!queue.is_empty()) {
-        while ((block_index != queue.tail_i) && current->recalculate_flag) {
+        /*
+         * Step 0:
+         * the planned block must still be on the queue, and not be behind the block the step ticker is on as that one
+         * can not change either. If the step ticker has finished everything use the last block it finished.
+         */
+        unsigned int isr_tail_i = queue.isr_tail_i; // can be moved on by the step ticker at any time
+        unsigned int fixed_i = (isr_tail_i == queue.head_i) ? queue.prev(queue.head_i) : isr_tail_i;
+        unsigned int planned = (planned_i + queue.length - queue.tail_i) % queue.length;
+        if (planned >= (queue.head_i + queue.length - queue.tail_i) % queue.length ||
+            planned < (fixed_i + queue.length - queue.tail_i) % queue.length) {
+            planned_i = fixed_i;
+        }
+
+        /*
+         * Step 1:
+         * For each block, given the exit speed and acceleration, find the maximum entry speed
+         */
+        while (block_index != planned_i) {
             entry_speed = current->reverse_pass(entry_speed);
+#ifdef PLANNER_STATS
+            ++blocks_touched;
+#endif
 
             block_index = queue.prev(block_index);
             current     = queue.item_ref(block_index);
@@ -264,7 +318,7 @@ void Planner::recalculate()
 
         /*
          * Step 2:
-         * now current points to either tail or first non-recalculate block
+         * now current points to the planned block
          * and has not had its reverse_pass called
          * or its calculate_trapezoid
          * entry_speed is set to the *exit* speed of current.
@@ -282,27 +336,26 @@ void Planner::recalculate()
             // so this block can decide if it's accel or decel limited and update its fields as appropriate
             exit_speed = current->forward_pass(exit_speed);
 
-            previous->calculate_trapezoid(previous->entry_speed, current->entry_speed);
+            // once a block is accel limited or at its max entry speed it is planned
+            if (!current->recalculate_flag) planned_i = block_index;
+
+            previous->set_exit_speed(current->entry_speed);
         }
+
+    } else {
+        // nothing before the new block so it starts from rest, and is planned
+        planned_i = block_index;
     }
 
     /*
      * Step 3:
-     * work out trapezoid for final (and newest) block
+     * the final (and newest) block has to stop at the end
      */
 
     // now current points to the head item
-    // which has not had calculate_trapezoid run yet
-    current->calculate_trapezoid(current->entry_speed, minimum_planner_speed);
-}
-
+    current->set_exit_speed(minimum_planner_speed);
 
-// Calculates the maximum allowable speed at this point when you must be able to reach target_velocity using the
-// acceleration within the allotted distance.
-float Planner::max_allowable_speed(float acceleration, float target_velocity, float distance)
-{
-    // Was acceleration*60*60*distance, in case this breaks, but here we prefer to use seconds instead of minutes
-    return(sqrtf(target_velocity * target_velocity - 2.0F * acceleration * distance));
+#ifdef PLANNER_STATS
+    planner_stats_recalculate_end(blocks_touched);
+#endif
 }
-
-
@@ -10,25 +10,36 @@
 
 #include "ActuatorCoordinates.h"
 class Block;
+class ArcPath;
 
 class Planner
 {
 public:
     Planner();
-    float max_allowable_speed( float acceleration, float target_velocity, float distance);
+    unsigned int get_planned_i() const { return planned_i; }
 
-    friend class Robot; // for acceleration, junction deviation, minimum_planner_speed
+    friend class Robot; // for acceleration, junction deviation, minimum_planner_speed, s_curve_jerk
 
 private:
-    bool append_block(ActuatorCoordinates &target, uint8_t n_motors, float rate_mm_s, float distance, float unit_vec[], float accleration, float s_value, bool g123);
+    bool append_block(ActuatorCoordinates &target, uint8_t n_motors, float rate_mm_s, float distance, float unit_vec[], float accleration, float s_value, bool g123, ArcPath *arc= nullptr, const float end_unit_vec[]= nullptr);
     void recalculate();
     void config_load();
     float previous_unit_vec[N_PRIMARY_AXIS];
+    unsigned int planned_i;      // queue index of the newest block whose entry speed can no longer change
     float junction_deviation;    // Setting
     float z_junction_deviation;  // Setting
     float minimum_planner_speed; // Setting
+    float s_curve_jerk;          // Setting, mm/sec³ 0 uses trapezoids
 };
 
+#ifdef PLANNER_STATS
+// hooks for the planner statistics of the host simulator and benchmark (see sim/PlannerStats.cpp), not in the firmware build
+void planner_stats_append_begin();
+void planner_stats_append_end();
+void planner_stats_recalculate_begin();
+void planner_stats_recalculate_end(uint32_t blocks_touched);
+#endif
+
 
 
 #endif
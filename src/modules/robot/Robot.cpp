@@ -33,6 +33,7 @@
 #include "ExtruderPublicAccess.h"
 #include "GcodeDispatch.h"
 #include "ActuatorCoordinates.h"
+#include "ArcPath.h"
 
 #include "mbed.h" // for us_ticker_read()
 #include "mri.h"
@@ -45,14 +46,18 @@
 #define  default_feed_rate_checksum          CHECKSUM("default_feed_rate")
 #define  mm_per_line_segment_checksum        CHECKSUM("mm_per_line_segment")
 #define  delta_segments_per_second_checksum  CHECKSUM("delta_segments_per_second")
+#define  mm_max_segment_error_checksum       CHECKSUM("mm_max_segment_error")
 #define  mm_per_arc_segment_checksum         CHECKSUM("mm_per_arc_segment")
 #define  mm_max_arc_error_checksum           CHECKSUM("mm_max_arc_error")
+#define  arc_segment_min_time_checksum       CHECKSUM("arc_segment_min_time")
+#define  mm_max_merge_error_checksum         CHECKSUM("mm_max_merge_error")
 #define  arc_correction_checksum             CHECKSUM("arc_correction")
 #define  x_axis_max_speed_checksum           CHECKSUM("x_axis_max_speed")
 #define  y_axis_max_speed_checksum           CHECKSUM("y_axis_max_speed")
 #define  z_axis_max_speed_checksum           CHECKSUM("z_axis_max_speed")
 #define  segment_z_moves_checksum            CHECKSUM("segment_z_moves")
 #define  save_g92_checksum                   CHECKSUM("save_g92")
+#define  native_arcs_checksum                CHECKSUM("native_arcs")
 #define  set_g92_checksum                    CHECKSUM("set_g92")
 
 // arm solutions
@@ -88,6 +93,7 @@
 #define laser_module_default_power_checksum     CHECKSUM("laser_module_default_power")
 
 #define ARC_ANGULAR_TRAVEL_EPSILON 5E-7F // Float (radians)
+#define ARC_MAX_ANGLE_PER_SEGMENT 0.25F // Float (radians), arc_segment_min_time never makes segments longer than this
 #define PI 3.14159265358979323846F // force to be float, do not use M_PI
 
 // The Robot converts GCodes into actual movements, and then adds them to the Planner, which passes them to the Conveyor so they can be added to the queue
@@ -112,6 +118,7 @@ Robot::Robot()
     this->disable_segmentation= false;
     this->disable_arm_solution= false;
     this->n_motors= 0;
+    this->merged.n= 0;
 }
 
 //Called when the module has just been loaded
@@ -121,6 +128,9 @@ void Robot::on_module_loaded()
 
     // Configuration
     this->load_config();
+
+    // pending merged segments get planned when the queue is running low
+    if(this->mm_max_merge_error > 0.0F) this->register_for_event(ON_IDLE);
 }
 
 #define ACTUATOR_CHECKSUMS(X) {     \
@@ -170,9 +180,12 @@ void Robot::load_config()
     this->seek_rate           = THEKERNEL->config->value(default_seek_rate_checksum   )->by_default(  100.0F)->as_number();
     this->mm_per_line_segment = THEKERNEL->config->value(mm_per_line_segment_checksum )->by_default(    0.0F)->as_number();
     this->delta_segments_per_second = THEKERNEL->config->value(delta_segments_per_second_checksum )->by_default(0.0f   )->as_number();
+    this->mm_max_segment_error= THEKERNEL->config->value(mm_max_segment_error_checksum)->by_default(    0.0F)->as_number();
     this->mm_per_arc_segment  = THEKERNEL->config->value(mm_per_arc_segment_checksum  )->by_default(    0.0f)->as_number();
     this->mm_max_arc_error    = THEKERNEL->config->value(mm_max_arc_error_checksum    )->by_default(   0.01f)->as_number();
+    this->arc_segment_min_time= THEKERNEL->config->value(arc_segment_min_time_checksum)->by_default(    0.0F)->as_number();
     this->arc_correction      = THEKERNEL->config->value(arc_correction_checksum      )->by_default(    5   )->as_number();
+    this->mm_max_merge_error  = THEKERNEL->config->value(mm_max_merge_error_checksum  )->by_default(    0.0F)->as_number();
 
     // in mm/sec but specified in config as mm/min
     this->max_speeds[X_AXIS]  = THEKERNEL->config->value(x_axis_max_speed_checksum    )->by_default(60000.0F)->as_number() / 60.0F;
@@ -181,6 +194,7 @@ void Robot::load_config()
 
     this->segment_z_moves     = THEKERNEL->config->value(segment_z_moves_checksum     )->by_default(true)->as_bool();
     this->save_g92            = THEKERNEL->config->value(save_g92_checksum            )->by_default(false)->as_bool();
+    this->native_arcs         = THEKERNEL->config->value(native_arcs_checksum         )->by_default(false)->as_bool();
     string g92                = THEKERNEL->config->value(set_g92_checksum             )->by_default("")->as_string();
     if(!g92.empty()) {
         // optional setting for a fixed G92 offset
@@ -406,9 +420,10 @@ void Robot::check_max_actuator_speeds()
         if(actuators[i]->is_extruder()) continue; //extruders are not included in this check
 
         float step_freq = actuators[i]->get_max_rate() * actuators[i]->get_steps_per_mm();
-        if (step_freq > THEKERNEL->base_stepping_frequency) {
-            actuators[i]->set_max_rate(floorf(THEKERNEL->base_stepping_frequency / actuators[i]->get_steps_per_mm()));
-            THEKERNEL->streams->printf("WARNING: actuator %d rate exceeds base_stepping_frequency * ..._steps_per_mm: %f, setting to %f\n", i, step_freq, actuators[i]->get_max_rate());
+        float max_step_freq = THEKERNEL->step_ticker->get_max_step_rate(); // base_stepping_frequency, or nearly twice that with max_steps_per_tick 2
+        if (step_freq > max_step_freq) {
+            actuators[i]->set_max_rate(floorf(max_step_freq / actuators[i]->get_steps_per_mm()));
+            THEKERNEL->streams->printf("WARNING: actuator %d rate exceeds base_stepping_frequency * max_steps_per_tick * ..._steps_per_mm: %f, setting to %f\n", i, step_freq, actuators[i]->get_max_rate());
         }
     }
 }
@@ -600,7 +615,7 @@ void Robot::on_gcode_received(void *argument)
                     }
 
                     THEKERNEL->conveyor->wait_for_idle();
-                    THEKERNEL->call_event(ON_ENABLE, (void *)bm);
+                    THEKERNEL->call_event(ON_ENABLE, (void *)(uintptr_t)bm);
                     break;
                 }
                 // fall through
@@ -710,7 +725,7 @@ void Robot::on_gcode_received(void *argument)
                 }
                 break;
 
-            case 205: // M205 Xnnn - set junction deviation, Z - set Z junction deviation, Snnn - Set minimum planner speed
+            case 205: // M205 Xnnn - set junction deviation, Z - set Z junction deviation, Snnn - Set minimum planner speed, Jnnn - set S-curve jerk
                 if (gcode->has_letter('X')) {
                     float jd = gcode->get_value('X');
                     // enforce minimum
@@ -732,6 +747,13 @@ void Robot::on_gcode_received(void *argument)
                         mps = 0.0F;
                     THEKERNEL->planner->minimum_planner_speed = mps;
                 }
+                if (gcode->has_letter('J')) {
+                    float jerk = gcode->get_value('J');
+                    // 0 disables the S-curve
+                    if (jerk < 0.0F)
+                        jerk = 0.0F;
+                    THEKERNEL->planner->s_curve_jerk = jerk;
+                }
                 break;
 
             case 220: // M220 - speed override percentage
@@ -773,7 +795,7 @@ void Robot::on_gcode_received(void *argument)
                 }
                 gcode->stream->printf("\n");
 
-                gcode->stream->printf(";X- Junction Deviation, Z- Z junction deviation, S - Minimum Planner speed mm/sec:\nM205 X%1.5f Z%1.5f S%1.5f\n", THEKERNEL->planner->junction_deviation, isnan(THEKERNEL->planner->z_junction_deviation)?-1:THEKERNEL->planner->z_junction_deviation, THEKERNEL->planner->minimum_planner_speed);
+                gcode->stream->printf(";X- Junction Deviation, Z- Z junction deviation, S - Minimum Planner speed mm/sec, J - S-curve jerk mm/sec³:\nM205 X%1.5f Z%1.5f S%1.5f J%1.5f\n", THEKERNEL->planner->junction_deviation, isnan(THEKERNEL->planner->z_junction_deviation)?-1:THEKERNEL->planner->z_junction_deviation, THEKERNEL->planner->minimum_planner_speed, THEKERNEL->planner->s_curve_jerk);
 
                 gcode->stream->printf(";Max cartesian feedrates in mm/sec:\nM203 X%1.5f Y%1.5f Z%1.5f\n", this->max_speeds[X_AXIS], this->max_speeds[Y_AXIS], this->max_speeds[Z_AXIS]);
 
@@ -990,7 +1012,7 @@ void Robot::process_move(Gcode *gcode, enum MOTION_MODE_T motion_mode)
 
         case CW_ARC:
         case CCW_ARC:
-            // Note arcs are not currently supported by extruder based machines, as 3D slicers do not use arcs (G2/G3)
+            // E and ABC are moved along the arc in proportion, though slicers do not use arcs (G2/G3)
             moved= this->compute_arc(gcode, offset, target, motion_mode);
             break;
     }
@@ -1009,6 +1031,8 @@ void Robot::process_move(Gcode *gcode, enum MOTION_MODE_T motion_mode)
 // This works for cases where the Z endstop is fixed on the Z actuator and is the same regardless of where XY are.
 void Robot::reset_axis_position(float x, float y, float z)
 {
+    flush_merged_segments();
+
     // set both the same initially
     compensated_machine_position[X_AXIS]= machine_position[X_AXIS] = x;
     compensated_machine_position[Y_AXIS]= machine_position[Y_AXIS] = y;
@@ -1029,6 +1053,8 @@ void Robot::reset_axis_position(float x, float y, float z)
 // Reset the position for an axis (used in homing, and to reset extruder after suspend)
 void Robot::reset_axis_position(float position, int axis)
 {
+    flush_merged_segments();
+
     compensated_machine_position[axis] = position;
     if(axis <= Z_AXIS) {
         reset_axis_position(compensated_machine_position[X_AXIS], compensated_machine_position[Y_AXIS], compensated_machine_position[Z_AXIS]);
@@ -1046,6 +1072,8 @@ void Robot::reset_axis_position(float position, int axis)
 // then sets the axis positions to match. currently only called from Endstops.cpp and RotaryDeltaCalibration.cpp
 void Robot::reset_actuator_position(const ActuatorCoordinates &ac)
 {
+    flush_merged_segments();
+
     for (size_t i = X_AXIS; i <= Z_AXIS; i++) {
         if(!isnan(ac[i])) actuators[i]->change_last_milestone(ac[i]);
     }
@@ -1058,6 +1086,8 @@ void Robot::reset_actuator_position(const ActuatorCoordinates &ac)
 // TODO maybe we should only reset axis that are being homed unless this is due to a ON_HALT
 void Robot::reset_position_from_current_actuator_position()
 {
+    flush_merged_segments();
+
     ActuatorCoordinates actuator_pos;
     for (size_t i = X_AXIS; i < n_motors; i++) {
         // NOTE actuator::current_position is curently NOT the same as actuator::machine_position after an abrupt abort
@@ -1091,14 +1121,113 @@ void Robot::reset_position_from_current_actuator_position()
     #endif
 }
 
+// Append a milestone, if mergeable is set and mm_max_merge_error is enabled consecutive segments that are close enough to a straight line
+// are merged into one block. This cuts the number of blocks for sliced STL files with thousands of tiny nearly collinear segments,
+// and makes the planner look ahead much further for the same queue size.
+// The merged segments are planned when a segment can not be merged, when the queue is running low, or before waiting for idle.
+bool Robot::append_milestone(const float target[], float rate_mm_s, bool mergeable)
+{
+    if(this->mm_max_merge_error <= 0.0F) {
+        return plan_milestone(target, rate_mm_s, s_value, is_g123);
+    }
+
+    if(mergeable && merged.n > 0 && can_merge_segment(target, rate_mm_s)) {
+        memcpy(merged.points[++merged.n], target, n_motors*sizeof(float));
+        return true;
+    }
+
+    flush_merged_segments();
+
+    if(!mergeable) {
+        return plan_milestone(target, rate_mm_s, s_value, is_g123);
+    }
+
+    // start a new merge from the current position, the segment is planned later
+    memcpy(merged.points[0], machine_position, n_motors*sizeof(float));
+    memcpy(merged.points[1], target, n_motors*sizeof(float));
+    merged.rate_mm_s= rate_mm_s;
+    merged.s_value= s_value;
+    merged.is_g123= is_g123;
+    merged.n= 1;
+    return true;
+}
+
+// see if the segment to target can be merged with the pending segments
+// it can if every point merged so far stays within mm_max_merge_error of the line from the start to target
+bool Robot::can_merge_segment(const float target[], float rate_mm_s) const
+{
+    if(merged.n >= k_max_merged_segments || rate_mm_s != merged.rate_mm_s || s_value != merged.s_value || is_g123 != merged.is_g123) return false;
+
+    // the merged line, includes E and ABC so their rate along the line has to be constant too
+    const float *start= merged.points[0];
+    float chord[n_motors];
+    float chord_sq= 0;
+    for (size_t i = 0; i < n_motors; i++) {
+        chord[i]= target[i] - start[i];
+        chord_sq += chord[i] * chord[i];
+    }
+    if(chord_sq < 0.00001F) return false;
+
+    // the merged block must not be longer than a line would be segmented to
+    float max_length= max_segment_length(rate_mm_s);
+    if(max_length > 0 && chord_sq > max_length * max_length) return false;
+
+    float max_error_sq= this->mm_max_merge_error * this->mm_max_merge_error;
+    float last_t= 0;
+    for (size_t p = 1; p <= merged.n; p++) {
+        // project the point onto the line, it has to be further along than the last one and before the end, so there is no reversal
+        float dot= 0, len_sq= 0;
+        for (size_t i = 0; i < n_motors; i++) {
+            float v= merged.points[p][i] - start[i];
+            dot += v * chord[i];
+            len_sq += v * v;
+        }
+        float t= dot / chord_sq;
+        if(t <= last_t || t >= 1.0F) return false;
+        last_t= t;
+
+        // squared distance of the point from the line
+        if(len_sq - t * dot > max_error_sq) return false;
+    }
+
+    return true;
+}
+
+// the longest a line is cut into at this rate, 0 if lines are not segmented
+float Robot::max_segment_length(float rate_mm_s) const
+{
+    if(this->disable_segmentation) return 0;
+    if(this->delta_segments_per_second > 1.0F) return rate_mm_s / this->delta_segments_per_second;
+    return this->mm_per_line_segment;
+}
+
+// plan any merged segments now as one block
+void Robot::flush_merged_segments()
+{
+    if(merged.n == 0) return;
+    uint8_t n= merged.n;
+    merged.n= 0;
+
+    // nothing more can be planned once halted
+    if(THEKERNEL->is_halted()) return;
+
+    plan_milestone(merged.points[n], merged.rate_mm_s, merged.s_value, merged.is_g123);
+}
+
+// plan the merged segments if the queue is running low, so the step ticker does not run out of blocks waiting for the next segment
+void Robot::on_idle(void *argument)
+{
+    if(merged.n > 0 && !THECONVEYOR->is_queue_full() && THECONVEYOR->get_queued_blocks() <= 2) {
+        flush_merged_segments();
+    }
+}
+
 // Convert target (in machine coordinates) to machine_position, then convert to actuator position and append this to the planner
 // target is in machine coordinates without the compensation transform, however we save a compensated_machine_position that includes
 // all transforms and is what we actually convert to actuator positions
-bool Robot::append_milestone(const float target[], float rate_mm_s)
+bool Robot::plan_milestone(const float target[], float rate_mm_s, float s, bool g123)
 {
-    float deltas[n_motors];
     float transformed_target[n_motors]; // adjust target for bed compensation
-    float unit_vec[N_PRIMARY_AXIS];
 
     // unity transform by default
     memcpy(transformed_target, target, n_motors*sizeof(float));
@@ -1109,6 +1238,28 @@ bool Robot::append_milestone(const float target[], float rate_mm_s)
         compensationTransform(transformed_target, false);
     }
 
+    // find actuator position given the machine position, use actual adjusted target
+    ActuatorCoordinates actuator_pos;
+    if(!disable_arm_solution) {
+        arm_solution->cartesian_to_actuator( transformed_target, actuator_pos );
+
+    }else{
+        // basically the same as cartesian, would be used for special homing situations like for scara
+        for (size_t i = X_AXIS; i <= Z_AXIS; i++) {
+            actuator_pos[i] = transformed_target[i];
+        }
+    }
+
+    return plan_move(transformed_target, actuator_pos, rate_mm_s, s, g123);
+}
+
+// Plan the move to transformed_target, the target after compensation, given the actuator position the arm solution gives for it
+// in actuator_pos, only XYZ are used, the rest are filled in from transformed_target
+bool Robot::plan_move(const float transformed_target[], ActuatorCoordinates &actuator_pos, float rate_mm_s, float s, bool g123)
+{
+    float deltas[n_motors];
+    float unit_vec[N_PRIMARY_AXIS];
+
     bool move= false;
     float sos= 0; // sum of squares for just primary axis (XYZ usually)
 
@@ -1158,18 +1309,6 @@ bool Robot::append_milestone(const float target[], float rate_mm_s)
         }
     }
 
-    // find actuator position given the machine position, use actual adjusted target
-    ActuatorCoordinates actuator_pos;
-    if(!disable_arm_solution) {
-        arm_solution->cartesian_to_actuator( transformed_target, actuator_pos );
-
-    }else{
-        // basically the same as cartesian, would be used for special homing situations like for scara
-        for (size_t i = X_AXIS; i <= Z_AXIS; i++) {
-            actuator_pos[i] = transformed_target[i];
-        }
-    }
-
 #if MAX_ROBOT_ACTUATORS > 3
     sos= 0;
     // for the extruders just copy the position, and possibly scale it from mm³ to mm
@@ -1224,7 +1363,7 @@ bool Robot::append_milestone(const float target[], float rate_mm_s)
 
     // Append the block to the planner
     // NOTE that distance here should be either the distance travelled by the XYZ axis, or the E mm travel if a solo E move
-    if(THEKERNEL->planner->append_block( actuator_pos, n_motors, rate_mm_s, distance, auxilliary_move ? nullptr : unit_vec, acceleration, s_value, is_g123)) {
+    if(THEKERNEL->planner->append_block( actuator_pos, n_motors, rate_mm_s, distance, auxilliary_move ? nullptr : unit_vec, acceleration, s, g123)) {
         // this is the new compensated machine position
         memcpy(this->compensated_machine_position, transformed_target, n_motors*sizeof(float));
         return true;
@@ -1297,10 +1436,19 @@ bool Robot::append_line(Gcode *gcode, const float target[], float rate_mm_s, flo
     // In delta robots either mm_per_line_segment can be used OR delta_segments_per_second
     // The latter is more efficient and avoids splitting fast long lines into very small segments, like initial z move to 0, it is what Johanns Marlin delta port does
     uint16_t segments;
+    bool moved= false;
 
     if(this->disable_segmentation || (!segment_z_moves && !gcode->has_letter('X') && !gcode->has_letter('Y'))) {
         segments= 1;
 
+    } else if(this->mm_max_segment_error > 0.0F && !this->disable_arm_solution) {
+        // cut only where the path would stray too far from the line, which takes the place of the other settings
+        if(append_bisected_line(target, rate_mm_s, moved)) {
+            this->next_command_is_MCS = false; // always reset this
+            return moved;
+        }
+        segments= 1;
+
     } else if(this->delta_segments_per_second > 1.0F) {
         // enabled if set to something > 1, it is set to 0.0 by default
         // segment based on current speed and requested segments per second
@@ -1318,7 +1466,6 @@ bool Robot::append_line(Gcode *gcode, const float target[], float rate_mm_s, flo
         }
     }
 
-    bool moved= false;
     if (segments > 1) {
         // A vector to keep track of the endpoint of each segment
         float segment_delta[n_motors];
@@ -1329,21 +1476,52 @@ bool Robot::append_line(Gcode *gcode, const float target[], float rate_mm_s, flo
         for (int i = 0; i < n_motors; i++)
             segment_delta[i] = (target[i] - machine_position[i]) / segments;
 
+        // none of the segments can be merged, so they are planned directly
+        flush_merged_segments();
+
+        // the arm solution is worked out for a batch of segments in one call, which on a delta saves most of the cost of
+        // a call per segment, see BaseSolution::cartesian_to_actuators()
+        float points[k_segment_batch][n_motors]; // the end of each segment in the batch after compensation
+        float cartesian[3][k_segment_batch], actuator[3][k_segment_batch];
+        const float *const cartesian_mm[3]= {cartesian[X_AXIS], cartesian[Y_AXIS], cartesian[Z_AXIS]};
+        float *const actuator_mm[3]= {actuator[ALPHA_STEPPER], actuator[BETA_STEPPER], actuator[GAMMA_STEPPER]};
+
         // segment 0 is already done - it's the end point of the previous move so we start at segment 1
         // We always add another point after this loop so we stop at segments-1, ie i < segments
-        for (int i = 1; i < segments; i++) {
-            if(THEKERNEL->is_halted()) return false; // don't queue any more segments
-            for (int i = 0; i < n_motors; i++)
-                segment_end[i] += segment_delta[i];
-
-            // Append the end of this segment to the queue
-            bool b= this->append_milestone(segment_end, rate_mm_s);
-            moved= moved || b;
+        for (int i = 1; i < segments; ) {
+            int n= min((int)k_segment_batch, segments - i);
+            for (int j = 0; j < n; j++) {
+                for (int k = 0; k < n_motors; k++)
+                    segment_end[k] += segment_delta[k];
+
+                memcpy(points[j], segment_end, n_motors*sizeof(float));
+                if(compensationTransform) compensationTransform(points[j], false);
+                for (int k = X_AXIS; k <= Z_AXIS; k++)
+                    cartesian[k][j]= points[j][k];
+            }
+
+            // basically the same as cartesian when disabled, see plan_milestone()
+            const float *const *solved= cartesian_mm;
+            if(!disable_arm_solution) {
+                arm_solution->cartesian_to_actuators(n, cartesian_mm, actuator_mm);
+                solved= actuator_mm;
+            }
+
+            // Append the end of each segment to the queue
+            for (int j = 0; j < n; j++, i++) {
+                if(THEKERNEL->is_halted()) return false; // don't queue any more segments
+                ActuatorCoordinates actuator_pos;
+                for (int k = ALPHA_STEPPER; k <= GAMMA_STEPPER; k++)
+                    actuator_pos[k]= solved[k][j];
+
+                bool b= plan_move(points[j], actuator_pos, rate_mm_s, s_value, is_g123);
+                moved= moved || b;
+            }
         }
     }
 
-    // Append the end of this full move to the queue
-    if(this->append_milestone(target, rate_mm_s)) moved= true;
+    // Append the end of this full move to the queue, it can be merged with the next one if it was not cut up
+    if(this->append_milestone(target, rate_mm_s, segments == 1)) moved= true;
 
     this->next_command_is_MCS = false; // always reset this
 
@@ -1351,8 +1529,86 @@ bool Robot::append_line(Gcode *gcode, const float target[], float rate_mm_s, flo
 }
 
 
+// Cut the line to target into as few segments as keep the path within mm_max_segment_error of it and plan them. The actuators
+// move linearly along a segment, which on a delta takes the effector off the line, by very little near the middle and much
+// more towards the edges. So a segment is halved while the point the actuators reach half way along it, found by putting
+// the average of the actuator positions at its ends back through the arm solution, is further than mm_max_segment_error
+// from the middle of the line. Compensation is applied to every point, so the error is measured from the compensated path.
+// Returns false if the line needs no cutting, in which case nothing is planned, otherwise the segments have been planned.
+bool Robot::append_bisected_line(const float target[], float rate_mm_s, bool &moved)
+{
+    struct point_t {
+        float t;                                     // how far along the line, 0 to 1
+        uint8_t depth;                               // times the segment ending here has been halved
+        float position[k_max_actuators];             // after compensation
+        ActuatorCoordinates actuator;
+    };
+
+    auto point_at= [this, target](float t, point_t &p) {
+        p.t= t;
+        for (size_t i = 0; i < n_motors; i++) {
+            // the end is exactly the target so the segments add up to the line
+            p.position[i]= (t == 1.0F) ? target[i] : machine_position[i] + (target[i] - machine_position[i]) * t;
+        }
+        if(compensationTransform) compensationTransform(p.position, false);
+        arm_solution->cartesian_to_actuator(p.position, p.actuator);
+    };
+
+    // the ends of the segments still to be checked, the next one on top. Every entry has been halved at least as many
+    // times as its index so there can be no more than k_max_bisections + 1 of them
+    point_t stack[k_max_bisections + 1];
+    uint8_t n= 1;
+    point_t left, middle;
+    point_at(0.0F, left);
+    point_at(1.0F, stack[0]);
+    stack[0].depth= 0;
+
+    const float max_error_sq= this->mm_max_segment_error * this->mm_max_segment_error;
+    while(n > 0) {
+        point_t &right= stack[n - 1];
+        if(right.depth < k_max_bisections) {
+            point_at((left.t + right.t) / 2.0F, middle);
+
+            ActuatorCoordinates halfway;
+            for (size_t i = X_AXIS; i <= Z_AXIS; i++) {
+                halfway[i]= (left.actuator[i] + right.actuator[i]) / 2.0F;
+            }
+            float reached[k_max_actuators];
+            arm_solution->actuator_to_cartesian(halfway, reached);
+
+            float error_sq= 0;
+            for (size_t i = X_AXIS; i <= Z_AXIS; i++) {
+                error_sq += powf(reached[i] - middle.position[i], 2);
+            }
+            if(error_sq > max_error_sq) {
+                middle.depth= ++right.depth;
+                stack[n++]= middle;
+                continue;
+            }
+        }
+
+        // the segment to right is close enough to the line
+        if(left.t == 0.0F) {
+            if(right.t == 1.0F) return false; // all of it
+
+            // none of the segments can be merged, so they are planned directly
+            flush_merged_segments();
+        }
+        if(THEKERNEL->is_halted()) { // don't queue any more segments
+            moved= false;
+            return true;
+        }
+        bool b= plan_move(right.position, right.actuator, rate_mm_s, s_value, is_g123);
+        moved= moved || b;
+        left= right;
+        --n;
+    }
+
+    return true;
+}
+
 // Append an arc to the queue ( cutting it into segments as needed )
-// TODO does not support any E parameters so cannot be used for 3D printing.
+// E and ABC move in proportion along the arc, but the extruder's volumetric limit is not applied as it is for lines
 bool Robot::append_arc(Gcode * gcode, const float target[], const float offset[], float radius, bool is_clockwise )
 {
     float rate_mm_s= this->feed_rate / seconds_per_minute;
@@ -1397,9 +1653,33 @@ bool Robot::append_arc(Gcode * gcode, const float target[], const float offset[]
             arc_segment = min_err_segment;
         }
     }
+
+    // segments so short the planner takes longer to plan them than the head takes to run them starve the queue, so if
+    // arc_segment_min_time is set they are made to last at least that long at the speed they will run, which is the feed rate
+    // or the speed the acceleration allows round this radius if that is lower, but never longer than ARC_MAX_ANGLE_PER_SEGMENT
+    if(this->arc_segment_min_time > 0.0F) {
+        float speed= std::min(rate_mm_s, sqrtf(this->default_acceleration * radius));
+        float min_time_segment= std::min(speed * this->arc_segment_min_time, radius * ARC_MAX_ANGLE_PER_SEGMENT);
+        if (arc_segment < min_time_segment) {
+            arc_segment = min_time_segment;
+        }
+    }
+
+    // each segment is planned as one block, so on a delta it must not be longer than a line would be cut into
+    float max_length= max_segment_length(rate_mm_s);
+    if (max_length > 0 && (arc_segment <= 0 || arc_segment > max_length)) {
+        arc_segment = max_length;
+    }
+
     // Figure out how many segments for this gcode
-    // TODO for deltas we need to make sure we are at least as many segments as requested, also if mm_per_line_segment is set we need to use the
-    uint16_t segments = ceilf(millimeters_of_travel / arc_segment);
+    uint16_t segments = arc_segment > 0 ? std::min(65535.0F, std::max(1.0F, ceilf(millimeters_of_travel / arc_segment))) : 1;
+
+    // the segments can be run as the chords of one block, unless they have to go through a transform that is not linear
+    // or the step ticker is running S-curves, which the chords can not be cut from
+    if(this->native_arcs && segments > 1 && max_length == 0 && !compensationTransform && !disable_arm_solution && THEKERNEL->planner->s_curve_jerk <= 0.0F) {
+        float center[2]= {center_axis0, center_axis1};
+        return plan_arc(target, center, angular_travel, millimeters_of_travel, segments, rate_mm_s, radius);
+    }
 
   //printf("Radius %f - Segment Length %f - Number of Segments %d\r\n",radius,arc_segment,segments);  // Testing Purposes ONLY
     float theta_per_segment = angular_travel / segments;
@@ -1432,17 +1712,19 @@ bool Robot::append_arc(Gcode * gcode, const float target[], const float offset[]
     float cos_T = 1 - 0.5F * theta_per_segment * theta_per_segment; // Small angle approximation
     float sin_T = theta_per_segment;
 
-    // TODO we need to handle the ABC axis here by segmenting them
-    float arc_target[3];
+    // the whole target so E and ABC are segmented too, they move in step with the linear axis
+    float arc_target[n_motors];
+    float other_per_segment[n_motors];
+    memcpy(arc_target, this->machine_position, n_motors*sizeof(float));
+    for (size_t i = N_PRIMARY_AXIS; i < n_motors; i++) {
+        other_per_segment[i] = (target[i] - this->machine_position[i]) / segments;
+    }
     float sin_Ti;
     float cos_Ti;
     float r_axisi;
     uint16_t i;
     int8_t count = 0;
 
-    // Initialize the linear axis
-    arc_target[this->plane_axis_2] = this->machine_position[this->plane_axis_2];
-
     bool moved= false;
     for (i = 1; i < segments; i++) { // Increment (segments-1)
         if(THEKERNEL->is_halted()) return false; // don't queue any more segments
@@ -1467,6 +1749,9 @@ bool Robot::append_arc(Gcode * gcode, const float target[], const float offset[]
         arc_target[this->plane_axis_0] = center_axis0 + r_axis0;
         arc_target[this->plane_axis_1] = center_axis1 + r_axis1;
         arc_target[this->plane_axis_2] += linear_per_segment;
+        for (size_t j = N_PRIMARY_AXIS; j < n_motors; j++) {
+            arc_target[j] += other_per_segment[j];
+        }
 
         // Append this segment to the queue
         bool b= this->append_milestone(arc_target, rate_mm_s);
@@ -1479,6 +1764,92 @@ bool Robot::append_arc(Gcode * gcode, const float target[], const float offset[]
     return moved;
 }
 
+// Queue the arc as one block that the conveyor runs as chords, see ArcPath
+bool Robot::plan_arc(const float target[], const float center[], float angular_travel, float distance, uint16_t chords, float rate_mm_s, float radius)
+{
+    if(THEKERNEL->is_halted()) return false;
+    flush_merged_segments();
+
+    uint8_t axis0= this->plane_axis_0, axis1= this->plane_axis_1, axis2= this->plane_axis_2;
+    float r_axis0= this->machine_position[axis0] - center[0], r_axis1= this->machine_position[axis1] - center[1];
+    float rt_axis0= target[axis0] - center[0], rt_axis1= target[axis1] - center[1];
+
+    // the direction the arc starts off in and the one it ends in, for the junctions with the blocks either side
+    float unit_vec[N_PRIMARY_AXIS], end_unit_vec[N_PRIMARY_AXIS];
+    memset(unit_vec, 0, sizeof(unit_vec));
+    float k= angular_travel / distance;
+    unit_vec[axis0]= -r_axis1 * k;
+    unit_vec[axis1]= r_axis0 * k;
+    unit_vec[axis2]= (target[axis2] - this->machine_position[axis2]) / distance;
+    memcpy(end_unit_vec, unit_vec, sizeof(end_unit_vec));
+    end_unit_vec[axis0]= -rt_axis1 * k;
+    end_unit_vec[axis1]= rt_axis0 * k;
+
+    ActuatorCoordinates actuator_pos;
+    arm_solution->cartesian_to_actuator(target, actuator_pos);
+#if MAX_ROBOT_ACTUATORS > 3
+    for (size_t i = E_AXIS; i < n_motors; i++) {
+        actuator_pos[i]= target[i];
+        if(actuators[i]->is_extruder() && get_e_scale_fnc) {
+            actuator_pos[i] *= get_e_scale_fnc();
+        }
+    }
+#endif
+
+    // the plane axes each move at the full speed along the arc at some point on a circle, so they are limited as if they always did,
+    // the linear axis moves at a constant fraction of it
+    float plane_fraction= radius * fabsf(angular_travel) / distance;
+    float acceleration= default_acceleration;
+    for (size_t i = 0; i < n_motors; i++) {
+        float fraction;
+        if(i == axis0 || i == axis1) fraction= plane_fraction;
+        else if(i < E_AXIS) fraction= fabsf(unit_vec[i]);
+        else fraction= fabsf(actuator_pos[i] - actuators[i]->get_last_milestone()) / distance;
+        if(fraction == 0) continue;
+
+        if(i < N_PRIMARY_AXIS && max_speeds[i] > 0 && rate_mm_s * fraction > max_speeds[i]) {
+            rate_mm_s= max_speeds[i] / fraction;
+        }
+        if(actuators[i]->is_selected() && rate_mm_s * fraction > actuators[i]->get_max_rate()) {
+            rate_mm_s= actuators[i]->get_max_rate() / fraction;
+        }
+
+        // the lowest acceleration of the axes that move
+        float ma= actuators[i]->get_acceleration();
+        if(i < N_PRIMARY_AXIS && !isnan(ma) && ma < acceleration) acceleration= ma;
+    }
+
+    // no faster than the acceleration can turn it round the arc
+    rate_mm_s= std::min(rate_mm_s, sqrtf(acceleration * radius));
+
+    ArcPath *arc= new ArcPath;
+    arc->center[0]= center[0];
+    arc->center[1]= center[1];
+    arc->radius_vector[0]= r_axis0;
+    arc->radius_vector[1]= r_axis1;
+    arc->angular_travel= angular_travel;
+    arc->axis[0]= axis0;
+    arc->axis[1]= axis1;
+    arc->axis[2]= axis2;
+    arc->n_motors= n_motors;
+    arc->chords= chords;
+    arc->chord_i= 0;
+    arc->actuator_end= actuator_pos;
+    for (size_t i = 0; i < n_motors; i++) {
+        arc->start[i]= (i < E_AXIS) ? this->machine_position[i] : actuators[i]->get_last_milestone();
+        arc->end[i]= (i < E_AXIS) ? target[i] : actuator_pos[i];
+        arc->steps[i]= actuators[i]->get_last_milestone_steps();
+    }
+
+    // the planner owns the arc from here
+    if(THEKERNEL->planner->append_block(actuator_pos, n_motors, rate_mm_s, distance, unit_vec, acceleration, s_value, is_g123, arc, end_unit_vec)) {
+        memcpy(this->compensated_machine_position, target, n_motors*sizeof(float));
+        return true;
+    }
+
+    return false;
+}
+
 // Do the math for an arc and add it to the queue
 bool Robot::compute_arc(Gcode * gcode, const float offset[], const float target[], enum MOTION_MODE_T motion_mode)
 {
@@ -32,6 +32,7 @@ class Robot : public Module {
         Robot();
         void on_module_loaded();
         void on_gcode_received(void* argument);
+        void on_idle(void* argument);
 
         void reset_axis_position(float position, int axis);
         void reset_axis_position(float x, float y, float z);
@@ -59,6 +60,7 @@ class Robot : public Module {
         std::tuple<float, float, float, uint8_t> get_last_probe_position() const { return last_probe_position; }
         void set_last_probe_position(std::tuple<float, float, float, uint8_t> p) { last_probe_position = p; }
         bool delta_move(const float delta[], float rate_mm_s, uint8_t naxis);
+        void flush_merged_segments();
         uint8_t register_motor(StepperMotor*);
         uint8_t get_number_registered_motors() const {return n_motors; }
 
@@ -86,6 +88,7 @@ class Robot : public Module {
             bool segment_z_moves:1;
             bool save_g92:1;                                  // save g92 on M500 if set
             bool is_g123:1;
+            bool native_arcs:1;                               // set to queue each arc as one block, see ArcPath
             uint8_t plane_axis_0:2;                           // Current plane ( XY, XZ, YZ )
             uint8_t plane_axis_1:2;
             uint8_t plane_axis_2:2;
@@ -101,9 +104,15 @@ class Robot : public Module {
         };
 
         void load_config();
-        bool append_milestone(const float target[], float rate_mm_s);
+        bool append_milestone(const float target[], float rate_mm_s, bool mergeable= false);
+        bool plan_milestone(const float target[], float rate_mm_s, float s, bool g123);
+        bool plan_move(const float transformed_target[], ActuatorCoordinates &actuator_pos, float rate_mm_s, float s, bool g123);
+        bool append_bisected_line(const float target[], float rate_mm_s, bool &moved);
+        bool can_merge_segment(const float target[], float rate_mm_s) const;
+        float max_segment_length(float rate_mm_s) const;
         bool append_line( Gcode* gcode, const float target[], float rate_mm_s, float delta_e);
         bool append_arc( Gcode* gcode, const float target[], const float offset[], float radius, bool is_clockwise );
+        bool plan_arc(const float target[], const float center[], float angular_travel, float distance, uint16_t chords, float rate_mm_s, float radius);
         bool compute_arc(Gcode* gcode, const float offset[], const float target[], enum MOTION_MODE_T motion_mode);
         void process_move(Gcode *gcode, enum MOTION_MODE_T);
 
@@ -129,7 +138,10 @@ class Robot : public Module {
         float mm_per_line_segment;                           // Setting : Used to split lines into segments
         float mm_per_arc_segment;                            // Setting : Used to split arcs into segments
         float mm_max_arc_error;                              // Setting : Used to limit total arc segments to max error
+        float arc_segment_min_time;                          // Setting : Used to make arc segments last at least this long at the speed they will run, 0 disables
         float delta_segments_per_second;                     // Setting : Used to split lines into segments for delta based on speed
+        float mm_max_segment_error;                          // Setting : Used to split lines into segments only where the path strays this far from the line, 0 disables
+        float mm_max_merge_error;                            // Setting : Used to merge consecutive segments that deviate less than this into one block, 0 disables
         float seconds_per_minute;                            // for realtime speed change
         float default_acceleration;                          // the defualt accleration if not set for each axis
         float s_value;                                       // modal S value
@@ -144,6 +156,21 @@ class Robot : public Module {
 
         uint8_t n_motors;                                    //count of the motors/axis registered
 
+        // segments being merged into one block before they are planned, see append_milestone()
+        static const uint8_t k_max_merged_segments= 16;
+        struct {
+            float points[k_max_merged_segments + 1][k_max_actuators]; // start point, then the end point of each merged segment
+            float rate_mm_s;
+            float s_value;
+            uint8_t n;                                       // number of segments merged, 0 if there are none pending
+            bool is_g123;
+        } merged;
+
+        // line segments have the arm solution worked out this many at a time, see append_line()
+        static const uint8_t k_segment_batch= 8;
+        // the most times a segment is halved by append_bisected_line(), so a line is cut into at most 2^this segments
+        static const uint8_t k_max_bisections= 10;
+
         // Used by Planner
         friend class Planner;
 };
@@ -14,6 +14,19 @@ class BaseSolution {
         virtual ~BaseSolution() {};
         virtual void cartesian_to_actuator(const float[], ActuatorCoordinates &) const = 0;
         virtual void actuator_to_cartesian(const ActuatorCoordinates &, float[]) const = 0;
+        // n points at once, cartesian_mm[axis][i] to actuator_mm[actuator][i] for X Y Z and alpha beta gamma
+        // gives exactly what cartesian_to_actuator() gives for each point, a solution can do it faster than one call per point
+        virtual void cartesian_to_actuators(size_t n, const float *const cartesian_mm[3], float *const actuator_mm[3]) const
+        {
+            for (size_t i = 0; i < n; i++) {
+                float cartesian[3]= {cartesian_mm[0][i], cartesian_mm[1][i], cartesian_mm[2][i]};
+                ActuatorCoordinates actuator;
+                cartesian_to_actuator(cartesian, actuator);
+                actuator_mm[0][i]= actuator[0];
+                actuator_mm[1][i]= actuator[1];
+                actuator_mm[2][i]= actuator[2];
+            }
+        }
         typedef std::map<char, float> arm_options_t;
         virtual bool set_optional(const arm_options_t& options) { return false; };
         virtual bool get_optional(arm_options_t& options, bool force_all= false) const { return false; };
@@ -73,6 +73,22 @@ void LinearDeltaSolution::cartesian_to_actuator(const float cartesian_mm[], Actu
                                       ) + cartesian_mm[Z_AXIS];
 }
 
+// the same sums as cartesian_to_actuator() one tower at a time, with the tower in registers for the whole batch
+void LinearDeltaSolution::cartesian_to_actuators(size_t n, const float *const cartesian_mm[3], float *const actuator_mm[3]) const
+{
+    const float *x= cartesian_mm[X_AXIS], *y= cartesian_mm[Y_AXIS], *z= cartesian_mm[Z_AXIS];
+    const float tower_x[3]= {delta_tower1_x, delta_tower2_x, delta_tower3_x};
+    const float tower_y[3]= {delta_tower1_y, delta_tower2_y, delta_tower3_y};
+
+    for (int t = ALPHA_STEPPER; t <= GAMMA_STEPPER; t++) {
+        const float tx= tower_x[t], ty= tower_y[t], l2= this->arm_length_squared;
+        float *a= actuator_mm[t];
+        for (size_t i = 0; i < n; i++) {
+            a[i]= sqrtf(l2 - SQ(tx - x[i]) - SQ(ty - y[i])) + z[i];
+        }
+    }
+}
+
 void LinearDeltaSolution::actuator_to_cartesian(const ActuatorCoordinates &actuator_mm, float cartesian_mm[] ) const
 {
     // from http://en.wikipedia.org/wiki/Circumscribed_circle#Barycentric_coordinates_from_cross-_and_dot-products
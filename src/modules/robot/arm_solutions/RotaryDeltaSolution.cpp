@@ -9,6 +9,8 @@
 #include "libs/utils.h"
 #include "StreamOutputPool.h"
 #include <fastmath.h>
+#include <stdlib.h>
+#include <algorithm>
 
 #define delta_e_checksum                CHECKSUM("delta_e")
 #define delta_f_checksum                CHECKSUM("delta_f")
@@ -21,6 +23,12 @@
 
 #define delta_mirror_xy_checksum        CHECKSUM("delta_mirror_xy")
 
+#define delta_ik_table_size_checksum      CHECKSUM("delta_ik_table_size")
+#define delta_ik_table_radius_checksum    CHECKSUM("delta_ik_table_radius")
+#define delta_ik_table_z_min_checksum     CHECKSUM("delta_ik_table_z_min")
+#define delta_ik_table_z_max_checksum     CHECKSUM("delta_ik_table_z_max")
+#define delta_ik_table_max_error_checksum CHECKSUM("delta_ik_table_max_error")
+
 const static float pi     = 3.14159265358979323846;    // PI
 const static float two_pi = 2 * pi;
 const static float sin120 = 0.86602540378443864676372317075294; //sqrt3/2.0
@@ -56,19 +64,46 @@ RotaryDeltaSolution::RotaryDeltaSolution(Config *config)
     // mirror the XY axis
     mirror_xy= config->value(delta_mirror_xy_checksum)->by_default(true)->as_bool();
 
+    // optional table of the arm angles, in bytes, 0 to work every one out
+    table_size = config->value(delta_ik_table_size_checksum)->by_default(0)->as_int();
+    table_radius = config->value(delta_ik_table_radius_checksum)->by_default(75.0F)->as_number();
+    table_z_min = config->value(delta_ik_table_z_min_checksum)->by_default(0.0F)->as_number();
+    table_z_max = config->value(delta_ik_table_z_max_checksum)->by_default(50.0F)->as_number();
+    table_max_error = config->value(delta_ik_table_max_error_checksum)->by_default(0.002F)->as_number();
+
     debug_flag= false;
     init();
 }
 
+RotaryDeltaSolution::~RotaryDeltaSolution()
+{
+    free(table);
+    free(table_cells);
+}
+
 // inverse kinematics
 // helper functions, calculates angle theta1 (for YZ-pane)
 int RotaryDeltaSolution::delta_calcAngleYZ(float x0, float y0, float z0, float &theta) const
+{
+    float a, b;
+    delta_calcLineYZ(x0, y0, z0, a, b);
+    return delta_calcAngleAB(a, b, theta);
+}
+
+// the line z = a + b*y in the YZ-pane that the end of the servo horn has to be on to reach the point
+void RotaryDeltaSolution::delta_calcLineYZ(float x0, float y0, float z0, float &a, float &b) const
 {
     float y1 = -0.5F * tan30 * delta_f; // f/2 * tan 30
     y0      -=  0.5F * tan30 * delta_e; // shift center to edge
     // z = a + b*y
-    float a = (x0 * x0 + y0 * y0 + z0 * z0 + delta_rf * delta_rf - delta_re * delta_re - y1 * y1) / (2.0F * z0);
-    float b = (y1 - y0) / z0;
+    a = (x0 * x0 + y0 * y0 + z0 * z0 + delta_rf * delta_rf - delta_re * delta_re - y1 * y1) / (2.0F * z0);
+    b = (y1 - y0) / z0;
+}
+
+// the angle of the servo horn whose end is on the line z = a + b*y
+int RotaryDeltaSolution::delta_calcAngleAB(float a, float b, float &theta) const
+{
+    float y1 = -0.5F * tan30 * delta_f; // f/2 * tan 30
 
     float d = -(a + b * y1) * (a + b * y1) + delta_rf * (b * b * delta_rf + delta_rf); // discriminant
     if (d < 0.0F) return -1;                                            // non-existing point
@@ -138,6 +173,136 @@ void RotaryDeltaSolution::init()
 {
     //these are calculated here and not in the config() as these variables can be fine tuned by the user.
     z_calc_offset  = -(delta_z_offset - tool_offset - delta_ee_offs);
+
+    build_table();
+}
+
+// The angle of one arm, from the table if it covers the point, otherwise worked out
+int RotaryDeltaSolution::calc_angle(float x0, float y0, float z0, float &theta) const
+{
+    if(table == nullptr) return delta_calcAngleYZ(x0, y0, z0, theta);
+
+    float a, b;
+    delta_calcLineYZ(x0, y0, z0, a, b);
+    if(table_angle(a, b, theta)) return 0;
+    return delta_calcAngleAB(a, b, theta);
+}
+
+// Fills the table cartesian_to_actuator() interpolates the arm angles in rather than doing the trig for every point.
+// delta_calcAngleYZ() only depends on the point through the a and b of the line delta_calcLineYZ() gives, for all three
+// arms, so the table is of the angle over a and b, as finely spaced as fits in table_size with a bit for each cell. It
+// spans the a and b of the build volume set by table_radius, table_z_min and table_z_max; anything outside it, or in a
+// cell that interpolating in could be out by more than table_max_error, is left to delta_calcAngleAB().
+void RotaryDeltaSolution::build_table()
+{
+    free(table);
+    free(table_cells);
+    table= nullptr;
+    table_cells= nullptr;
+
+    float z0[2]= {table_z_min + z_calc_offset, table_z_max + z_calc_offset};
+    // a and b are undefined where z crosses the plane of the servos
+    if(table_size < 16 * sizeof(float) || table_radius <= 0 || z0[1] < z0[0] || z0[0] * z0[1] <= 0) return;
+
+    // the range of a and b, the same for every arm as the volume turns with it. b does not depend on x and a only goes
+    // up with |x|, so it is enough to look along the middle and the edge of the volume
+    const int samples= 64;
+    float lo[2]= {INFINITY, INFINITY}, hi[2]= {-INFINITY, -INFINITY};
+    for (int j = 0; j <= samples; j++) {
+        float y= table_radius * (2.0F * j / samples - 1);
+        float x[2]= {0, sqrtf(std::max(0.0F, table_radius * table_radius - y * y))};
+        for (int k = 0; k <= samples; k++) {
+            float z= z0[0] + (z0[1] - z0[0]) * k / samples;
+            for (int i = 0; i < 2; i++) {
+                float ab[2];
+                delta_calcLineYZ(x[i], y, z, ab[0], ab[1]);
+                for (int n = 0; n < 2; n++) {
+                    lo[n]= std::min(lo[n], ab[n]);
+                    hi[n]= std::max(hi[n], ab[n]);
+                }
+            }
+        }
+    }
+
+    // as many points along a as along b, at least 3 so there are second differences along both
+    uint32_t n= sqrtf(table_size / sizeof(float) * 32.0F / 33.0F);
+    n= std::min(n, (uint32_t)65535) + 1;
+    uint32_t cells;
+    do {
+        --n;
+        cells= (n - 1) * (n - 1);
+    } while(n >= 3 && (n * n + (cells + 31) / 32) * sizeof(uint32_t) > table_size);
+    if(n < 3) return;
+
+    for (int a = 0; a < 2; a++) {
+        table_min[a]= lo[a];
+        table_scale[a]= (n - 1) / (hi[a] - lo[a]);
+        if(!isfinite(table_scale[a]) || table_scale[a] <= 0) return;
+        table_n[a]= n;
+    }
+
+    table= (float *)malloc(n * n * sizeof(float));
+    table_cells= (uint32_t *)calloc((cells + 31) / 32, sizeof(uint32_t));
+    if(table == nullptr || table_cells == nullptr) {
+        free(table);
+        free(table_cells);
+        table= nullptr;
+        table_cells= nullptr;
+        return;
+    }
+
+    float *p= table;
+    for (uint32_t j = 0; j < n; j++) {
+        float b= lo[1] + j / table_scale[1];
+        for (uint32_t i = 0; i < n; i++, p++) {
+            if(delta_calcAngleAB(lo[0] + i / table_scale[0], b, *p) != 0) *p= NAN;
+        }
+    }
+
+    // interpolating in a cell is out by at most an eighth of the sum of the second differences of the angle along a
+    // and b, which are taken as the largest of those at its corners. A corner with no solution, or the jump where the
+    // arm passes straight out, makes them NAN or huge and the cell is not used
+    const uint32_t stride[2]= {1, n};
+    uint32_t cell= 0;
+    for (uint32_t j = 0; j + 1 < n; j++) {
+        for (uint32_t i = 0; i + 1 < n; i++, cell++) {
+            float error= 0;
+            for (int a = 0; a < 2; a++) {
+                float worst= 0;
+                for (int corner = 0; corner < 4; corner++) {
+                    uint32_t at[2]= {i + (corner & 1), j + (corner >> 1)};
+                    // the difference is taken around the nearest point that has one either side along the axis
+                    at[a]= std::max((uint32_t)1, std::min(n - 2, at[a]));
+                    const float *p= &table[at[1] * n + at[0]];
+                    float d= fabsf(p[-(int32_t)stride[a]] - 2 * p[0] + p[stride[a]]);
+                    if(!(d <= worst)) worst= d;
+                }
+                error += worst;
+            }
+            if(error / 8 <= table_max_error) table_cells[cell / 32] |= 1UL << (cell % 32);
+        }
+    }
+}
+
+// The angle bilinearly interpolated from the table, false if a and b are not in a cell the table can be used in
+bool RotaryDeltaSolution::table_angle(float a, float b, float &theta) const
+{
+    float fa= (a - table_min[0]) * table_scale[0], fb= (b - table_min[1]) * table_scale[1];
+    // written so a NAN is outside too
+    if(!(fa >= 0 && fa < table_n[0] - 1 && fb >= 0 && fb < table_n[1] - 1)) return false;
+
+    uint32_t i= fa, j= fb;
+    uint32_t cell= j * (table_n[0] - 1) + i;
+    if((table_cells[cell / 32] & (1UL << (cell % 32))) == 0) return false;
+
+    fa -= i;
+    fb -= j;
+    const uint32_t row= table_n[0];
+    const float *p= &table[j * row + i];
+    float lower= p[0]   + (p[1]       - p[0]  ) * fa;
+    float upper= p[row] + (p[row + 1] - p[row]) * fa;
+    theta= lower + (upper - lower) * fb;
+    return true;
 }
 
 void RotaryDeltaSolution::cartesian_to_actuator(const float cartesian_mm[], ActuatorCoordinates &actuator_mm ) const
@@ -159,9 +324,9 @@ void RotaryDeltaSolution::cartesian_to_actuator(const float cartesian_mm[], Actu
 
     float z_with_offset = cartesian_mm[Z_AXIS] + z_calc_offset; //The delta calculation below places zero at the top.  Subtract the Z offset to make zero at the bottom.
 
-    int status =              delta_calcAngleYZ(x0,                    y0,                  z_with_offset, alpha_theta);
-    if (status == 0) status = delta_calcAngleYZ(x0 * cos120 + y0 * sin120, y0 * cos120 - x0 * sin120, z_with_offset, beta_theta); // rotate co-ordinates to +120 deg
-    if (status == 0) status = delta_calcAngleYZ(x0 * cos120 - y0 * sin120, y0 * cos120 + x0 * sin120, z_with_offset, gamma_theta); // rotate co-ordinates to -120 deg
+    int status =              calc_angle(x0,                    y0,                  z_with_offset, alpha_theta);
+    if (status == 0) status = calc_angle(x0 * cos120 + y0 * sin120, y0 * cos120 - x0 * sin120, z_with_offset, beta_theta); // rotate co-ordinates to +120 deg
+    if (status == 0) status = calc_angle(x0 * cos120 - y0 * sin120, y0 * cos120 + x0 * sin120, z_with_offset, gamma_theta); // rotate co-ordinates to -120 deg
 
     if (status == -1) { //something went wrong,
         //force to actuator FPD home position as we know this is a valid position
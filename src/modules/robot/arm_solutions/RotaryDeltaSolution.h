@@ -8,6 +8,7 @@ class Config;
 class RotaryDeltaSolution : public BaseSolution {
     public:
         RotaryDeltaSolution(Config*);
+        ~RotaryDeltaSolution();
         void cartesian_to_actuator(const float[], ActuatorCoordinates &) const override;
         void actuator_to_cartesian(const ActuatorCoordinates &, float[] ) const override;
 
@@ -17,7 +18,12 @@ class RotaryDeltaSolution : public BaseSolution {
     private:
         void init();
         int delta_calcAngleYZ(float x0, float y0, float z0, float &theta) const;
+        void delta_calcLineYZ(float x0, float y0, float z0, float &a, float &b) const;
+        int delta_calcAngleAB(float a, float b, float &theta) const;
         int delta_calcForward(float theta1, float theta2, float theta3, float &x0, float &y0, float &z0) const;
+        int calc_angle(float x0, float y0, float z0, float &theta) const;
+        void build_table();
+        bool table_angle(float a, float b, float &theta) const;
 
         float delta_e;			// End effector length
         float delta_f;			// Base length
@@ -30,6 +36,17 @@ class RotaryDeltaSolution : public BaseSolution {
         float tool_offset;		// Distance between end effector ball joint plane and tip of tool
         float z_calc_offset;
 
+        // optional table of delta_calcAngleAB() over the build volume, see build_table()
+        float *table{nullptr};                  // the angle at each point, a fastest then b
+        uint32_t *table_cells{nullptr};         // a bit per cell, set if interpolating in it is within table_max_error
+        uint32_t table_size;                    // Setting : most bytes the table can take, 0 disables it
+        float table_radius;                     // Setting : covers the build volume out to this radius
+        float table_z_min, table_z_max;         // Setting : and between these heights
+        float table_max_error;                  // Setting : in degrees
+        float table_min[2];                     // a and b at the first point
+        float table_scale[2];                   // points per unit of a and b
+        uint16_t table_n[2];                    // points along a and b
+
         struct {
             bool debug_flag:1;
             bool mirror_xy:1;
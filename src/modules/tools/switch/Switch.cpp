@@ -75,7 +75,6 @@ void Switch::on_module_loaded()
 {
     this->switch_changed = false;
 
-    this->register_for_event(ON_GCODE_RECEIVED);
     this->register_for_event(ON_MAIN_LOOP);
     this->register_for_event(ON_GET_PUBLIC_DATA);
     this->register_for_event(ON_SET_PUBLIC_DATA);
@@ -203,6 +202,10 @@ void Switch::on_config_reload(void *argument)
         }
     }
 
+    // only the on and off commands are dispatched to us, there can be a lot of switches
+    if(input_on_command_letter != 0) this->register_for_gcode(input_on_command_letter, input_on_command_code);
+    if(input_off_command_letter != 0) this->register_for_gcode(input_off_command_letter, input_off_command_code);
+
     if(input_pin.connected()) {
         // set to initial state
         this->input_pin_state = this->input_pin.get();
@@ -93,8 +93,17 @@ void TemperatureControl::on_module_loaded()
     // Settings
     this->load_config();
 
-    // Register for events
-    this->register_for_event(ON_GCODE_RECEIVED);
+    // Register for events, only the M codes handled in on_gcode_received() are dispatched to us
+    this->register_for_gcode('M', this->get_m_code);
+    this->register_for_gcode('M', 305);
+    if(!this->readonly) {
+        this->register_for_gcode('M', 143);
+        this->register_for_gcode('M', 301);
+        this->register_for_gcode('M', 500);
+        this->register_for_gcode('M', 503);
+        this->register_for_gcode('M', this->set_m_code);
+        this->register_for_gcode('M', this->set_and_wait_m_code);
+    }
     this->register_for_event(ON_GET_PUBLIC_DATA);
 
     if(!this->readonly) {
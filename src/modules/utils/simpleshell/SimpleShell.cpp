@@ -29,6 +29,7 @@
 #include "StepperMotor.h"
 #include "Configurator.h"
 #include "Block.h"
+#include "StepTicker.h"
 
 #include "TemperatureControlPublicAccess.h"
 #include "EndstopsPublicAccess.h"
@@ -86,6 +87,9 @@ const SimpleShell::ptentry_t SimpleShell::commands_table[] = {
     {"thermistors", SimpleShell::print_thermistors_command},
     {"md5sum",   SimpleShell::md5sum_command},
     {"test",     SimpleShell::test_command},
+#ifdef STEPTICKER_TIMELINE
+    {"timeline", SimpleShell::timeline_command},
+#endif
 
     // unknown command
     {NULL, NULL}
@@ -592,6 +596,9 @@ void SimpleShell::mem_command( string parameters, StreamOutput *stream)
     }
 
     stream->printf("Block size: %u bytes\n", sizeof(Block));
+
+    Gcode::pool_usage_t u = Gcode::get_pool_usage();
+    stream->printf("Gcode pool: %u used, %u max, text %u used, %u max, %lu from heap\n", u.gcodes, u.max_gcodes, u.texts, u.max_texts, (unsigned long)u.heap_fallbacks);
 }
 
 static uint32_t getDeviceType()
@@ -846,7 +853,9 @@ void SimpleShell::get_command( string parameters, StreamOutput *stream)
 
     } else if (what == "status") {
         // also ? on serial and usb
-        stream->printf("%s\n", THEKERNEL->get_query_string().c_str());
+        char buf[Kernel::query_string_size];
+        THEKERNEL->get_query_string(buf, sizeof(buf), stream);
+        stream->printf("%s\n", buf);
 
     } else {
         stream->printf("error:unknown option %s\n", what.c_str());
@@ -1121,6 +1130,27 @@ void SimpleShell::test_command( string parameters, StreamOutput *stream)
     }
 }
 
+#ifdef STEPTICKER_TIMELINE
+// print the steps recorded by the step ticker since last time, or save them to a file, see sim/steptiming.py
+void SimpleShell::timeline_command( string parameters, StreamOutput *stream)
+{
+    string fn = shift_parameter(parameters);
+    if(fn.empty()) {
+        THEKERNEL->step_ticker->print_timeline(stream, true);
+        return;
+    }
+
+    fn = absolute_from_relative(fn);
+    FileStream fs(fn.c_str());
+    if(!fs.is_open()) {
+        stream->printf("could not open file %s\r\n", fn.c_str());
+        return;
+    }
+    THEKERNEL->step_ticker->print_timeline(&fs, true);
+    stream->printf("timeline saved to %s\r\n", fn.c_str());
+}
+#endif
+
 void SimpleShell::help_command( string parameters, StreamOutput *stream )
 {
     stream->printf("Commands:\r\n");
@@ -1151,5 +1181,8 @@ void SimpleShell::help_command( string parameters, StreamOutput *stream )
     stream->printf("calc_thermistor [-s0] T1,R1,T2,R2,T3,R3 - calculate the Steinhart Hart coefficients for a thermistor\r\n");
     stream->printf("thermistors - print out the predefined thermistors\r\n");
     stream->printf("md5sum file - prints md5 sum of the given file\r\n");
+#ifdef STEPTICKER_TIMELINE
+    stream->printf("timeline [file] - prints or saves the steps recorded since last time\r\n");
+#endif
 }
 
@@ -60,6 +60,9 @@ private:
     static void remount_command( string parameters, StreamOutput *stream);
 
     static void test_command( string parameters, StreamOutput *stream);
+#ifdef STEPTICKER_TIMELINE
+    static void timeline_command( string parameters, StreamOutput *stream);
+#endif
 
     typedef void (*PFUNC)(string parameters, StreamOutput *stream);
     typedef struct {
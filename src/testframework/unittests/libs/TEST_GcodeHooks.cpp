@@ -0,0 +1,73 @@
+#include "GcodeHooks.h"
+#include "Module.h"
+#include "Gcode.h"
+
+#include <vector>
+#include <string>
+
+#include "easyunit/test.h"
+
+// records the order the modules see each Gcode in
+static std::string calls;
+
+class HookTestModule : public Module {
+    public:
+        HookTestModule(char n) : name(n) {}
+        void on_gcode_received(void *) { calls += name; }
+        char name;
+};
+
+TEST(GcodeHooksTest,dispatch)
+{
+    GcodeHooks hooks;
+    HookTestModule a('a'), b('b'), c('c'), d('d');
+
+    hooks.add(&a);              // everything
+    hooks.add(&b, 'M', 104);
+    hooks.add(&b, 'M', 105);
+    hooks.add(&c);              // everything
+    hooks.add(&d, 'G', 1);
+    hooks.add(&d, 'M', 104);
+    hooks.add(&b, 'M', 104);    // again, only called once
+
+    Gcode g1("G1 X10", nullptr);
+    calls.clear();
+    hooks.dispatch(&g1);
+    ASSERT_TRUE(calls == "acd");
+
+    Gcode m104("M104 S200", nullptr);
+    calls.clear();
+    hooks.dispatch(&m104);
+    ASSERT_TRUE(calls == "abcd");
+
+    Gcode m105("M105", nullptr);
+    calls.clear();
+    hooks.dispatch(&m105);
+    ASSERT_TRUE(calls == "abc");
+
+    // no G or M goes to everyone
+    Gcode t1("T1", nullptr);
+    calls.clear();
+    hooks.dispatch(&t1);
+    ASSERT_TRUE(calls == "abcd");
+
+    // a module asking for a code as well as everything is only called once
+    hooks.add(&c, 'M', 105);
+    calls.clear();
+    hooks.dispatch(&m105);
+    ASSERT_TRUE(calls == "abc");
+
+    hooks.remove(&b);
+    calls.clear();
+    hooks.dispatch(&m104);
+    ASSERT_TRUE(calls == "acd");
+    calls.clear();
+    hooks.dispatch(&t1);
+    ASSERT_TRUE(calls == "acd");
+
+    // coming back puts it last
+    hooks.add(&b, 'M', 104);
+    calls.clear();
+    hooks.dispatch(&m104);
+    ASSERT_TRUE(calls == "acdb");
+}
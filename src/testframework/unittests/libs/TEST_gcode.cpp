@@ -1,6 +1,7 @@
 #include "utils.h"
 
 #include "Gcode.h"
+#include "GcodeLine.h"
 
 #include <vector>
 #include <stdio.h>
@@ -60,3 +61,207 @@ TEST(GCodeTest,subcode)
     ASSERT_EQUALS_DELTA_V(2.3, gc4.get_value('Y'), 0.001);
 
 }
+
+TEST(GCodeTest,words)
+{
+    Gcode gc1("G1 X10 Y-2.5 E.3 F3000 X99", nullptr);
+
+    ASSERT_EQUALS_V(1, gc1.g);
+    ASSERT_EQUALS_V(5, gc1.get_num_args());
+    ASSERT_TRUE(!gc1.has_letter('G'));
+    ASSERT_TRUE(!gc1.has_letter('Z'));
+    ASSERT_TRUE(gc1.has_letter('E'));
+    // the first occurrence wins
+    ASSERT_EQUALS_DELTA_V(10.0F, gc1.get_value('X'), 0.0001F);
+    ASSERT_EQUALS_DELTA_V(-2.5F, gc1.get_value('Y'), 0.0001F);
+    ASSERT_EQUALS_DELTA_V(0.3F, gc1.get_value('E'), 0.0001F);
+    ASSERT_EQUALS_V(3000, gc1.get_int('F'));
+    ASSERT_EQUALS_DELTA_V(0.0F, gc1.get_value('Z'), 0.0001F);
+
+    char *p;
+    ASSERT_EQUALS_DELTA_V(-2.5F, gc1.get_value('Y', &p), 0.0001F);
+    ASSERT_TRUE(p != nullptr && strncmp(p, " E.3", 4) == 0);
+    gc1.get_value('Z', &p);
+    ASSERT_TRUE(p == nullptr);
+
+    // a letter with no value is there but reads as 0
+    Gcode gc2("G28 X Y0", nullptr);
+    ASSERT_TRUE(gc2.has_letter('X'));
+    ASSERT_TRUE(gc2.has_letter('Y'));
+    ASSERT_TRUE(!gc2.has_letter('Z'));
+    ASSERT_EQUALS_V(0, gc2.get_int('X'));
+    ASSERT_EQUALS_V(2, gc2.get_num_args());
+
+    // more letters with values than fit in the table
+    Gcode gc3("M999 A1 B2 C3 D4 E5 F6 H7 I8 J9 K10 L11 N12 O13 P14 Q15 R16", nullptr);
+    ASSERT_EQUALS_V(16, gc3.get_num_args());
+    for (char c = 'A'; c <= 'R'; c++) {
+        if(c == 'G' || c == 'M') continue;
+        ASSERT_TRUE(gc3.has_letter(c));
+    }
+    ASSERT_EQUALS_DELTA_V(1.0F, gc3.get_value('A'), 0.0001F);
+    ASSERT_EQUALS_DELTA_V(16.0F, gc3.get_value('R'), 0.0001F);
+    ASSERT_EQUALS_V(15, gc3.get_uint('Q'));
+    std::map<char,float> args= gc3.get_args();
+    ASSERT_EQUALS_V(16, (int)args.size());
+    ASSERT_EQUALS_DELTA_V(12.0F, args['N'], 0.0001F);
+
+    // the checksum is not a letter but is still found
+    Gcode gc4("N10 G1 X1*91", nullptr, false);
+    ASSERT_EQUALS_V(10, (int)gc4.get_value('N'));
+    ASSERT_EQUALS_V(91, (int)gc4.get_value('*'));
+
+    // stripping the parameters parses the command again
+    Gcode gc5("G1 X1 Y2 F100", nullptr);
+    gc5.strip_parameters();
+    ASSERT_TRUE(!gc5.has_letter('X'));
+    ASSERT_TRUE(gc5.has_letter('F'));
+    ASSERT_EQUALS_DELTA_V(100.0F, gc5.get_value('F'), 0.0001F);
+}
+
+TEST(GCodeTest, from_words)
+{
+    // as a binary frame makes them, G28.2 X1 Y-2.5 F3000 with no text
+    float values[]= {3000.0F, 1.0F, -2.5F};
+    uint32_t letters= 1 << ('F' - 'A') | 1 << ('X' - 'A') | 1 << ('Y' - 'A');
+    Gcode gc(false, 28, 2, letters, values, nullptr);
+    ASSERT_TRUE(gc.has_g && !gc.has_m);
+    ASSERT_EQUALS_V(28, gc.g);
+    ASSERT_EQUALS_V(2, gc.subcode);
+    ASSERT_EQUALS_V(3, gc.get_num_args());
+    ASSERT_TRUE(!gc.has_letter('Z'));
+    ASSERT_EQUALS_DELTA_V(-2.5F, gc.get_value('Y'), 0.0001F);
+    ASSERT_EQUALS_V(-2, gc.get_int('Y'));
+    ASSERT_EQUALS_V(3000, gc.get_uint('F'));
+    ASSERT_TRUE(strlen(gc.get_command()) == 0);
+
+    char *p;
+    ASSERT_EQUALS_DELTA_V(1.0F, gc.get_value('X', &p), 0.0001F);
+    ASSERT_TRUE(p == nullptr);
+
+    Gcode copy(gc);
+    ASSERT_EQUALS_DELTA_V(3000.0F, copy.get_value('F'), 0.0001F);
+
+    // stripping drops the words as there is no text
+    Gcode move(false, 1, 0, letters, values, nullptr);
+    move.strip_parameters();
+    ASSERT_TRUE(!move.has_letter('X') && !move.has_letter('Y'));
+    ASSERT_EQUALS_V(1, move.get_num_args());
+    ASSERT_EQUALS_DELTA_V(3000.0F, move.get_value('F'), 0.0001F);
+}
+
+// a numbered line with the checksum a host would put on it
+static std::string with_checksum(const std::string &line)
+{
+    int cs= 0;
+    for (char c : line) cs ^= c;
+    return line + "*" + std::to_string(cs & 0xff);
+}
+
+static std::string next_command(GcodeLine &line)
+{
+    const char *command;
+    size_t length;
+    if(!line.next_command(command, length)) return "<none>";
+    return std::string(command, length);
+}
+
+TEST(GCodeTest, line_number_and_checksum)
+{
+    std::string s= with_checksum("N10 G1 X1.5 Y2");
+    GcodeLine l1(s.data(), s.size());
+    ASSERT_TRUE(l1.has_line_number());
+    ASSERT_EQUALS_V(10, l1.get_line_number());
+    ASSERT_TRUE(l1.checksum_ok());
+    ASSERT_TRUE(!l1.is_m110());
+    ASSERT_TRUE(next_command(l1) == "G1 X1.5 Y2");
+    ASSERT_TRUE(next_command(l1) == "<none>");
+
+    // one bit off in the text or the checksum
+    std::string bad= s;
+    bad[5]= 'H';
+    GcodeLine l2(bad.data(), bad.size());
+    ASSERT_TRUE(!l2.checksum_ok());
+    bad= s + "1";
+    GcodeLine l3(bad.data(), bad.size());
+    ASSERT_TRUE(!l3.checksum_ok());
+
+    // a numbered line need not have a checksum
+    std::string s4= "N11 M105";
+    GcodeLine l4(s4.data(), s4.size());
+    ASSERT_TRUE(l4.has_line_number() && l4.checksum_ok());
+    ASSERT_EQUALS_V(11, l4.get_line_number());
+    ASSERT_TRUE(next_command(l4) == "M105");
+
+    // M110 sets the line number, even with a bad checksum
+    std::string s5= with_checksum("N-1 M110") + "7";
+    GcodeLine l5(s5.data(), s5.size());
+    ASSERT_TRUE(l5.is_m110() && !l5.checksum_ok());
+    ASSERT_EQUALS_V(-1, l5.get_line_number());
+
+    // without a line number nothing is taken off
+    std::string s6= "G1 X2*15";
+    GcodeLine l6(s6.data(), s6.size());
+    ASSERT_TRUE(!l6.has_line_number() && l6.checksum_ok());
+    ASSERT_TRUE(next_command(l6) == "G1 X2*15");
+
+    // the view is not terminated, nothing past its end is looked at
+    std::string s7= "G1 X3 Y4 Z5";
+    GcodeLine l7(s7.data(), 6);
+    ASSERT_TRUE(next_command(l7) == "G1 X3 ");
+}
+
+TEST(GCodeTest, line_comments)
+{
+    std::string s1= "G1 X1 ; move";
+    GcodeLine l1(s1.data(), s1.size());
+    ASSERT_TRUE(next_command(l1) == "G1 X1 ");
+    ASSERT_TRUE(next_command(l1) == "<none>");
+
+    std::string s2= "G1 X1 (move) Y2";
+    GcodeLine l2(s2.data(), s2.size());
+    ASSERT_TRUE(next_command(l2) == "G1 X1 ");
+    ASSERT_TRUE(next_command(l2) == "<none>");
+
+    // a comment on a numbered line is in the checksum
+    std::string s3= with_checksum("N3 G0 Y1 ;go");
+    GcodeLine l3(s3.data(), s3.size());
+    ASSERT_TRUE(l3.checksum_ok());
+    ASSERT_TRUE(next_command(l3) == "G0 Y1 ");
+
+    std::string s4= "; nothing but a comment";
+    GcodeLine l4(s4.data(), s4.size());
+    ASSERT_TRUE(next_command(l4) == "<none>");
+}
+
+TEST(GCodeTest, line_commands)
+{
+    std::string s1= "G1 X1 M3 S100 G4 P1";
+    GcodeLine l1(s1.data(), s1.size());
+    ASSERT_TRUE(next_command(l1) == "G1 X1 ");
+    ASSERT_EQUALS_V(13, (int)l1.rest_length());
+    ASSERT_TRUE(next_command(l1) == "M3 S100 ");
+    ASSERT_TRUE(next_command(l1) == "G4 P1");
+    ASSERT_EQUALS_V(0, (int)l1.rest_length());
+    ASSERT_TRUE(next_command(l1) == "<none>");
+
+    // G53 takes the rest of the line as its move
+    std::string s2= with_checksum("N4 G53 G0 X1 Y2");
+    GcodeLine l2(s2.data(), s2.size());
+    ASSERT_TRUE(next_command(l2) == "G53 ");
+    ASSERT_TRUE(std::string(l2.rest(), l2.rest_length()) == "G0 X1 Y2");
+    l2.skip_rest();
+    ASSERT_TRUE(next_command(l2) == "<none>");
+
+    // a Gcode is made straight from the text of the line
+    const char *command;
+    size_t length;
+    GcodeLine l3(s1.data(), s1.size());
+    ASSERT_TRUE(l3.next_command(command, length));
+    Gcode gc(command, length, nullptr);
+    ASSERT_TRUE(gc.has_g && !gc.has_m);
+    ASSERT_EQUALS_V(1, gc.g);
+    ASSERT_EQUALS_V(1, gc.get_num_args());
+    ASSERT_TRUE(!gc.has_letter('S'));
+    ASSERT_EQUALS_DELTA_V(1.0F, gc.get_value('X'), 0.0001F);
+}
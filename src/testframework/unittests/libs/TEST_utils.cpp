@@ -45,3 +45,22 @@ TEST(UtilsTest,append_parameters)
     ASSERT_TRUE(n == 24);
     ASSERT_TRUE(strcmp(buf, "X1.0000 Y2.0000 Z3.0000 ") == 0);
 }
+
+TEST(UtilsTest,format_fixed)
+{
+    char buf[48], expect[48];
+
+    // the same as printf, rounding half to even and keeping the sign of -0
+    const float values[]= {0, -0.0F, 1, -1, 0.5F, 1.5F, 2.5F, 0.03125F, -0.00001F, 123.45678F, -9999.99995F, 1e10F, 3e38F};
+    for(float v : values) {
+        for (int d = 0; d <= 6; ++d) {
+            int n= format_fixed(buf, v, d);
+            snprintf(expect, sizeof(expect), "%1.*f", d, v);
+            ASSERT_TRUE(n == (int)strlen(expect));
+            ASSERT_TRUE(strcmp(buf, expect) == 0);
+        }
+    }
+
+    ASSERT_TRUE(format_fixed(buf, 12.3456F, 4) == 7);
+    ASSERT_TRUE(strcmp(buf, "12.3456") == 0);
+}